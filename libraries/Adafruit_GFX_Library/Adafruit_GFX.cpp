@@ -116,6 +116,8 @@ Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h) {
   textcolor = textbgcolor = 0xFFFF;
   wrap = true;
   _cp437 = false;
+  _glyphCache = true;
+  _textBgFill = false;
   gfxFont = NULL;
 }
 
@@ -1100,6 +1102,101 @@ void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap,
 // TEXT- AND CHARACTER-HANDLING FUNCTIONS ----------------------------------
 
 // Draw a character
+#if GFX_GLYPH_CACHE_FONTS
+// Glyphs of the custom fonts expanded to row runs on first use. Each glyph is
+// stored as, for every row: number of runs, then (start x, length) of each run.
+struct GFXfontRuns {
+  const GFXfont *font; ///< Font of the entry, NULL if unused
+  uint8_t **glyphs;    ///< Runs of each glyph, NULL if not expanded yet
+  uint16_t count;      ///< Number of glyphs in `glyphs`
+};
+
+static GFXfontRuns fontRuns[GFX_GLYPH_CACHE_FONTS];
+static uint8_t fontRunsNext; ///< Entry to replace when all are used
+
+static uint8_t *expandGlyph(const GFXfont *font, GFXglyph *glyph) {
+  uint8_t *bitmap = pgm_read_bitmap_ptr(font);
+  uint8_t w = pgm_read_byte(&glyph->width), h = pgm_read_byte(&glyph->height);
+
+  // Twice: count the runs, then store them
+  uint8_t *runs = NULL;
+  for (uint8_t pass = 0; pass < 2; pass++) {
+    uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
+    uint8_t bits = 0, bit = 0;
+    uint16_t len = 0;
+    for (uint8_t yy = 0; yy < h; yy++) {
+      uint16_t cnt_idx = len++;
+      uint8_t cnt = 0;
+      int16_t start = -1;
+      for (uint8_t xx = 0; xx <= w; xx++) {
+        bool set = false;
+        if (xx < w) {
+          if (!(bit++ & 7)) {
+            bits = pgm_read_byte(&bitmap[bo++]);
+          }
+          set = bits & 0x80;
+          bits <<= 1;
+        }
+        if (set && start < 0) {
+          start = xx;
+        } else if (!set && start >= 0) {
+          if (runs) {
+            runs[len] = start;
+            runs[len + 1] = xx - start;
+          }
+          len += 2;
+          cnt++;
+          start = -1;
+        }
+      }
+      if (runs)
+        runs[cnt_idx] = cnt;
+    }
+    if (!runs) {
+      runs = (uint8_t *)malloc(len ? len : 1);
+      if (!runs)
+        return NULL;
+    }
+  }
+  return runs;
+}
+
+// Runs of a glyph (index from font->first), NULL if out of memory
+static const uint8_t *getGlyphRuns(const GFXfont *font, uint8_t c) {
+  GFXfontRuns *entry = NULL;
+  for (uint8_t i = 0; i < GFX_GLYPH_CACHE_FONTS; i++) {
+    if (fontRuns[i].font == font) {
+      entry = &fontRuns[i];
+      break;
+    }
+  }
+
+  if (!entry) {
+    entry = &fontRuns[fontRunsNext];
+    fontRunsNext = (fontRunsNext + 1) % GFX_GLYPH_CACHE_FONTS;
+    // Free the glyphs of the replaced font, which may have another count
+    if (entry->glyphs) {
+      for (uint16_t i = 0; i < entry->count; i++)
+        free(entry->glyphs[i]);
+      free(entry->glyphs);
+    }
+    uint16_t cnt = (uint16_t)pgm_read_word(&font->last) -
+                   (uint16_t)pgm_read_word(&font->first) + 1;
+    entry->font = NULL;
+    entry->count = 0;
+    entry->glyphs = (uint8_t **)calloc(cnt, sizeof(uint8_t *));
+    if (!entry->glyphs)
+      return NULL;
+    entry->font = font;
+    entry->count = cnt;
+  }
+
+  if (!entry->glyphs[c])
+    entry->glyphs[c] = expandGlyph(font, pgm_read_glyph_ptr(font, c));
+  return entry->glyphs[c];
+}
+#endif
+
 /**************************************************************************/
 /*!
    @brief   Draw a single character
@@ -1211,6 +1308,29 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
     // this (a canvas object type for MCUs that can afford the RAM and
     // displays supporting setAddrWindow() and pushColors()), but haven't
     // implemented this yet.
+    // (With a frame buffer, setTextBgFill() fills the cells of a whole
+    // string before drawing it, which doesn't blink.)
+
+#if GFX_GLYPH_CACHE_FONTS
+    // Same pixels from the cached runs, one span per run
+    const uint8_t *runs = _glyphCache ? getGlyphRuns(gfxFont, c) : NULL;
+    if (runs) {
+      startWrite();
+      for (yy = 0; yy < h; yy++) {
+        for (uint8_t n = *runs++; n > 0; n--, runs += 2) {
+          if (size_x == 1 && size_y == 1) {
+            writeFastHLine(x + xo + runs[0], y + yo + yy, runs[1], color);
+          } else {
+            writeFillRect(x + (xo16 + runs[0]) * size_x,
+                          y + (yo16 + yy) * size_y, runs[1] * size_x, size_y,
+                          color);
+          }
+        }
+      }
+      endWrite();
+      return;
+    }
+#endif
 
     startWrite();
     for (yy = 0; yy < h; yy++) {
@@ -1285,6 +1405,72 @@ size_t Adafruit_GFX::write(uint8_t c) {
   return 1;
 }
 
+#if ARDUINO >= 100
+/**************************************************************************/
+/*!
+    @brief  Print a string in one write transaction, used to support print().
+            With setTextBgFill() the background of the custom font characters
+            is filled first.
+    @param  buffer  The characters to write
+    @param  size    Number of characters
+    @returns  Number of characters written
+*/
+/**************************************************************************/
+size_t Adafruit_GFX::write(const uint8_t *buffer, size_t size) {
+  startWrite();
+
+  if (gfxFont && _textBgFill && (textbgcolor != textcolor)) {
+    // Height of the font: the highest and lowest rows of all the glyphs
+    uint8_t first = pgm_read_byte(&gfxFont->first),
+            last = pgm_read_byte(&gfxFont->last);
+    int16_t top = 0, bottom = 0;
+    for (uint16_t i = 0; i <= (uint16_t)(last - first); i++) {
+      GFXglyph *glyph = pgm_read_glyph_ptr(gfxFont, i);
+      int16_t yo = (int8_t)pgm_read_byte(&glyph->yOffset);
+      int16_t yb = yo + pgm_read_byte(&glyph->height);
+      if (yo < top)
+        top = yo;
+      if (yb > bottom)
+        bottom = yb;
+    }
+
+    // Fill the cells where write() will draw the characters
+    int16_t x = cursor_x, y = cursor_y;
+    int16_t yAdvance =
+        (int16_t)textsize_y * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+    for (size_t i = 0; i < size; i++) {
+      uint8_t c = buffer[i];
+      if (c == '\n') {
+        x = 0;
+        y += yAdvance;
+      } else if ((c != '\r') && (c >= first) && (c <= last)) {
+        GFXglyph *glyph = pgm_read_glyph_ptr(gfxFont, c - first);
+        uint8_t w = pgm_read_byte(&glyph->width),
+                h = pgm_read_byte(&glyph->height);
+        int16_t xo = (int8_t)pgm_read_byte(&glyph->xOffset); // sic
+        int16_t xa =
+            (uint8_t)pgm_read_byte(&glyph->xAdvance) * (int16_t)textsize_x;
+        if ((w > 0) && (h > 0) && wrap &&
+            ((x + textsize_x * (xo + w)) > _width)) {
+          x = 0;
+          y += yAdvance;
+        }
+        writeFillRect(x, y + top * textsize_y, xa, (bottom - top) * textsize_y,
+                      textbgcolor);
+        x += xa;
+      }
+    }
+  }
+
+  size_t n = 0;
+  while (size--)
+    n += write(*buffer++);
+
+  endWrite();
+  return n;
+}
+#endif
+
 /**************************************************************************/
 /*!
     @brief   Set text 'magnification' size. Each increase in s makes 1 pixel
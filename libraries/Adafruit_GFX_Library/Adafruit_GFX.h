@@ -12,6 +12,16 @@
 #include <Adafruit_I2CDevice.h>
 #include <Adafruit_SPIDevice.h>
 
+/// Number of custom fonts whose glyphs are kept expanded to row runs in RAM,
+/// so drawChar() draws spans instead of single pixels. 0 disables the cache.
+#ifndef GFX_GLYPH_CACHE_FONTS
+#ifdef __AVR__
+#define GFX_GLYPH_CACHE_FONTS 0
+#else
+#define GFX_GLYPH_CACHE_FONTS 2
+#endif
+#endif
+
 /// A generic graphics superclass that can handle all sorts of drawing. At a
 /// minimum you can subclass and provide drawPixel(). At a maximum you can do a
 /// ton of overriding to optimize. Used for any/all Adafruit displays!
@@ -81,14 +91,15 @@ public:
                      int16_t radius, uint16_t color);
   void fillRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
                      int16_t radius, uint16_t color);
-  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
-                  int16_t h, uint16_t color);
-  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
-                  int16_t h, uint16_t color, uint16_t bg);
-  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
-                  uint16_t color);
-  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
-                  uint16_t color, uint16_t bg);
+  // These MAY be overridden by the subclass to blit whole rows at once
+  virtual void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                          int16_t w, int16_t h, uint16_t color);
+  virtual void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                          int16_t w, int16_t h, uint16_t color, uint16_t bg);
+  virtual void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w,
+                          int16_t h, uint16_t color);
+  virtual void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w,
+                          int16_t h, uint16_t color, uint16_t bg);
   void drawXBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
                    int16_t h, uint16_t color);
   void drawGrayscaleBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
@@ -99,10 +110,10 @@ public:
                            const uint8_t mask[], int16_t w, int16_t h);
   void drawGrayscaleBitmap(int16_t x, int16_t y, uint8_t *bitmap, uint8_t *mask,
                            int16_t w, int16_t h);
-  void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w,
-                     int16_t h);
-  void drawRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w,
-                     int16_t h);
+  virtual void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[],
+                             int16_t w, int16_t h);
+  virtual void drawRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w,
+                             int16_t h);
   void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[],
                      const uint8_t mask[], int16_t w, int16_t h);
   void drawRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, uint8_t *mask,
@@ -180,9 +191,31 @@ public:
   /**********************************************************************/
   void cp437(bool x = true) { _cp437 = x; }
 
+  /**********************************************************************/
+  /*!
+    @brief  Enable (or disable) drawing custom font glyphs from their
+            cached row runs (see GFX_GLYPH_CACHE_FONTS). The result is the
+            same, only faster, so it's enabled by default.
+    @param  c  true = use the cache, false = draw the packed bitmap bit by bit
+  */
+  /**********************************************************************/
+  void setGlyphCache(bool c) { _glyphCache = c; }
+
+  /**********************************************************************/
+  /*!
+    @brief  Fill the background of custom fonts with the color set by
+            setTextColor(c, bg) when printing. The cell of each character,
+            its advance width by the height of the font, is filled before
+            the string is drawn, so changing text can be redrawn in place.
+    @param  f  true = fill the background, false = transparent (default)
+  */
+  /**********************************************************************/
+  void setTextBgFill(bool f) { _textBgFill = f; }
+
   using Print::write;
 #if ARDUINO >= 100
   virtual size_t write(uint8_t);
+  virtual size_t write(const uint8_t *buffer, size_t size);
 #else
   virtual void write(uint8_t);
 #endif
@@ -245,6 +278,8 @@ protected:
   uint8_t rotation;     ///< Display rotation (0 thru 3)
   bool wrap;            ///< If set, 'wrap' text at right edge of display
   bool _cp437;          ///< If set, use correct CP437 charset (default is off)
+  bool _glyphCache;     ///< If set, draw custom fonts from the glyph cache
+  bool _textBgFill;     ///< If set, fill the background of custom fonts
   GFXfont *gfxFont;     ///< Pointer to special font
 };
 
@@ -0,0 +1,33 @@
+/* Minimal Arduino API for the host test */
+#ifndef MOCK_ARDUINO_H
+#define MOCK_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <string>
+
+class String : public std::string {
+  public:
+    String(const char *str = "") : std::string(str) { }
+    String& operator=(const char *str) { assign(str); return *this; }
+};
+
+class Print {
+  public:
+    virtual ~Print() { }
+    virtual size_t write(uint8_t) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size) {
+        size_t n = 0;
+        while (size--) n += write(*buffer++);
+        return n;
+    }
+    size_t print(const char *str) { return write((const uint8_t *)str, strlen(str)); }
+};
+
+inline void delay(unsigned long) { }
+
+#endif
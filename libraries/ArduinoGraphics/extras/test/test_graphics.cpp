@@ -0,0 +1,356 @@
+/*
+ * Host test of the ArduinoGraphics primitives.
+ * A display with only set() and one with the span backend draw the same random
+ * shapes, partially off screen too, and must give the same pixels, which are also
+ * compared with the previous per-pixel algorithms. The throughput of both is printed.
+ */
+
+#include <stdio.h>
+#include <chrono>
+#include <vector>
+
+#include "ArduinoGraphics.h"
+
+static int failures;
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+#define WIDTH   800
+#define HEIGHT  480
+
+/* Memory-backed display with only set() */
+class PixelDisplay : public ArduinoGraphics {
+  public:
+    PixelDisplay() : ArduinoGraphics(WIDTH, HEIGHT), pixels(WIDTH * HEIGHT), setCalls(0) { }
+
+    virtual void set(int x, int y, uint8_t r, uint8_t g, uint8_t b) {
+        setCalls++;
+        if (x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT) {
+            return;
+        }
+        pixels[y * WIDTH + x] = ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+    }
+
+    using ArduinoGraphics::set;
+    using ArduinoGraphics::bitmap;
+
+    std::vector<uint32_t> pixels;
+    uint32_t setCalls;
+};
+
+/* The same display filling and copying whole rows */
+class SpanDisplay : public PixelDisplay {
+  public:
+    SpanDisplay() : spanCalls(0), outside(0) { }
+
+  protected:
+    virtual void fillSpan(int x, int y, int width, uint8_t r, uint8_t g, uint8_t b) {
+        spanCalls++;
+        if (x < 0 || y < 0 || y >= HEIGHT || width <= 0 || x + width > WIDTH) {
+            outside++;
+            return;
+        }
+        uint32_t color = ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+        uint32_t *p = &pixels[y * WIDTH + x];
+        for (int i = 0; i < width; i++) {
+            p[i] = color;
+        }
+    }
+
+    virtual void blitRow(int x, int y, int width, const uint8_t *data, int encoding) {
+        spanCalls++;
+        if (x < 0 || y < 0 || y >= HEIGHT || width <= 0 || x + width > WIDTH || encoding != ENCODING_RGB16) {
+            outside++;
+            return;
+        }
+        const uint16_t *src = (const uint16_t *)data;
+        uint32_t *p = &pixels[y * WIDTH + x];
+        for (int i = 0; i < width; i++) {
+            uint16_t c = src[i];
+            p[i] = ((uint32_t)((c >> 8) & 0xf8) << 16) | ((uint32_t)((c >> 3) & 0xfc) << 8) | ((c << 3) & 0xf8);
+        }
+    }
+
+  public:
+    uint32_t spanCalls;
+    uint32_t outside;
+};
+
+static PixelDisplay pixelDisplay;
+static SpanDisplay spanDisplay;
+static std::vector<uint32_t> reference(WIDTH * HEIGHT);
+
+static uint16_t image_data[64 * 40];
+static const Image image(ENCODING_RGB16, image_data, 64, 40);
+
+static uint32_t rand_state = 1;
+
+static int32_t rnd(int32_t min, int32_t max) {
+    rand_state = rand_state * 1103515245 + 12345;
+    return min + (int32_t)((rand_state >> 8) % (uint32_t)(max - min + 1));
+}
+
+/* The previous per-pixel algorithms, for comparison */
+static void ref_set(int x, int y, uint32_t color) {
+    if (x >= 0 && x < WIDTH && y >= 0 && y < HEIGHT) {
+        reference[y * WIDTH + x] = color;
+    }
+}
+
+static void ref_line(int x1, int y1, int x2, int y2, uint32_t color) {
+    if (abs(y2 - y1) < abs(x2 - x1)) {
+        if (x1 > x2) {
+            int t = x1; x1 = x2; x2 = t;
+            t = y1; y1 = y2; y2 = t;
+        }
+        int dx = x2 - x1, dy = y2 - y1, yi = 1;
+        if (dy < 0) { yi = -1; dy = -dy; }
+        int D = 2 * dy - dx, y = y1;
+        for (int x = x1; x <= x2; x++) {
+            ref_set(x, y, color);
+            if (D > 0) { y += yi; D -= 2 * dx; }
+            D += 2 * dy;
+        }
+    } else {
+        if (y1 > y2) {
+            int t = x1; x1 = x2; x2 = t;
+            t = y1; y1 = y2; y2 = t;
+        }
+        int dx = x2 - x1, dy = y2 - y1, xi = 1;
+        if (dx < 0) { xi = -1; dx = -dx; }
+        int D = 2 * dx - dy, x = x1;
+        for (int y = y1; y <= y2; y++) {
+            ref_set(x, y, color);
+            if (D > 0) { x += xi; D -= 2 * dy; }
+            D += 2 * dx;
+        }
+    }
+}
+
+static void ref_ellipse_fill(int x, int y, int width, int height, uint32_t color) {
+    int64_t a = width / 2, b = height / 2;
+    int64_t a2 = a * a, b2 = b * b;
+    for (int64_t j = -b; j <= b; j++) {
+        for (int64_t i = -a; i <= a; i++) {
+            if (i * i * b2 + j * j * a2 <= a2 * b2) {
+                ref_set(x + i, y + j, color);
+            }
+        }
+    }
+}
+
+static void ref_rect(int x, int y, int width, int height, uint32_t stroke, uint32_t fill) {
+    int x2 = x + width - 1, y2 = y + height - 1;
+    for (int i = x; i <= x2; i++) {
+        for (int j = y; j <= y2; j++) {
+            ref_set(i, j, (i == x || i == x2 || j == y || j == y2) ? stroke : fill);
+        }
+    }
+}
+
+static uint32_t random_color() {
+    return (uint32_t)rnd(0, 0xFFFFFF);
+}
+
+/* Draw the same random shapes with both displays */
+template<typename F>
+static void check_op(const char *name, F op, bool with_reference) {
+    pixelDisplay.background(0x102030);
+    spanDisplay.background(0x102030);
+    pixelDisplay.clear();
+    spanDisplay.clear();
+    for (size_t i = 0; i < reference.size(); i++) {
+        reference[i] = 0x102030;
+    }
+
+    uint32_t seed = rand_state;
+    for (int i = 0; i < 300; i++) {
+        op(pixelDisplay, with_reference);
+    }
+    rand_state = seed;
+    for (int i = 0; i < 300; i++) {
+        op(spanDisplay, false);
+    }
+
+    if (pixelDisplay.pixels != spanDisplay.pixels) {
+        printf("%s differs with the span backend\n", name);
+        failures++;
+    }
+    if (with_reference && pixelDisplay.pixels != reference) {
+        printf("%s differs from the per-pixel algorithm\n", name);
+        failures++;
+    }
+}
+
+static void op_line(PixelDisplay &d, bool ref) {
+    int x1 = rnd(-200, WIDTH + 200), y1 = rnd(-200, HEIGHT + 200);
+    int x2 = rnd(-200, WIDTH + 200), y2 = rnd(-200, HEIGHT + 200);
+    switch (rnd(0, 3)) {
+        case 0: x2 = x1; break;
+        case 1: y2 = y1; break;
+        default: break;
+    }
+    uint32_t color = random_color();
+    d.stroke(color);
+    d.line(x1, y1, x2, y2);
+    if (ref) {
+        ref_line(x1, y1, x2, y2, color);
+    }
+}
+
+static void op_rect(PixelDisplay &d, bool ref) {
+    int x = rnd(-100, WIDTH), y = rnd(-100, HEIGHT);
+    int w = rnd(0, 200), h = rnd(0, 200);
+    uint32_t stroke = random_color(), fill = random_color();
+    d.stroke(stroke);
+    d.fill(fill);
+    d.rect(x, y, w, h);
+    if (ref) {
+        ref_rect(x, y, w, h, stroke, fill);
+    }
+}
+
+static void op_fill_rect(PixelDisplay &d, bool ref) {
+    int x = rnd(-100, WIDTH), y = rnd(-100, HEIGHT);
+    int w = rnd(0, 200), h = rnd(0, 200);
+    uint32_t fill = random_color();
+    d.noStroke();
+    d.fill(fill);
+    d.rect(x, y, w, h);
+    if (ref) {
+        ref_rect(x, y, w, h, fill, fill);
+    }
+}
+
+static void op_ellipse(PixelDisplay &d, bool ref) {
+    int x = rnd(-100, WIDTH + 100), y = rnd(-100, HEIGHT + 100);
+    int w = rnd(0, 250), h = rnd(0, 250);
+    uint32_t fill = random_color();
+    d.noStroke();
+    d.fill(fill);
+    d.ellipse(x, y, w, h);
+    if (ref) {
+        ref_ellipse_fill(x, y, w, h, fill);
+    }
+}
+
+static void op_ellipse_stroke(PixelDisplay &d, bool) {
+    d.stroke(random_color());
+    d.fill(random_color());
+    d.ellipse(rnd(-100, WIDTH + 100), rnd(-100, HEIGHT + 100), rnd(0, 250), rnd(0, 250));
+}
+
+static void op_text(PixelDisplay &d, bool) {
+    d.textFont(rnd(0, 1) ? Font_5x7 : Font_4x6);
+    d.textSize(rnd(1, 4), rnd(1, 4));
+    d.stroke(random_color());
+    d.background(random_color());
+    d.text("Temp 23.5C", rnd(-100, WIDTH), rnd(-50, HEIGHT));
+}
+
+static void op_image(PixelDisplay &d, bool) {
+    d.image(image, rnd(-70, WIDTH), rnd(-50, HEIGHT));
+}
+
+static void test_same_pixels() {
+    check_op("line", op_line, true);
+    check_op("rect", op_rect, true);
+    check_op("filled rect", op_fill_rect, true);
+    check_op("ellipse", op_ellipse, true);
+    check_op("stroked ellipse", op_ellipse_stroke, false);
+    check_op("text", op_text, false);
+    check_op("image", op_image, false);
+    CHECK(spanDisplay.outside == 0);
+}
+
+static void test_reversed_lines() {
+    pixelDisplay.background(0);
+    pixelDisplay.clear();
+    pixelDisplay.stroke(0xFFFFFF);
+    pixelDisplay.line(20, 10, 10, 10);
+    pixelDisplay.line(5, 30, 5, 20);
+    int drawn = 0;
+    for (size_t i = 0; i < pixelDisplay.pixels.size(); i++) {
+        drawn += (pixelDisplay.pixels[i] != 0);
+    }
+    CHECK(drawn == 22);
+}
+
+static void test_clipping() {
+    /* Nothing is drawn outside the screen so the backend is not even called */
+    pixelDisplay.setCalls = 0;
+    pixelDisplay.stroke(0xFFFFFF);
+    pixelDisplay.fill(0xFFFFFF);
+    pixelDisplay.line(-1000, -10, 5000, -3000);
+    pixelDisplay.rect(-500, -500, 400, 400);
+    pixelDisplay.ellipse(2000, 100, 300, 300);
+    pixelDisplay.line(-100000, 10, 100000, 10);
+    CHECK(pixelDisplay.setCalls == WIDTH);
+
+    /* A long line only steps over its visible part */
+    spanDisplay.spanCalls = 0;
+    spanDisplay.stroke(0xFFFFFF);
+    spanDisplay.line(-1000000, -1000, 1000000, 1000);
+    CHECK(spanDisplay.spanCalls <= 2);
+    CHECK(spanDisplay.outside == 0);
+}
+
+template<typename F>
+static double ops_per_s(PixelDisplay &d, F op) {
+    auto start = std::chrono::steady_clock::now();
+    double elapsed;
+    int n = 0;
+    uint32_t seed = rand_state;
+    do {
+        for (int i = 0; i < 20; i++) {
+            op(d, false);
+        }
+        n += 20;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < 0.2);
+    rand_state = seed;
+    return n / elapsed;
+}
+
+template<typename F>
+static void bench(const char *name, F op) {
+    double pixel = ops_per_s(pixelDisplay, op);
+    double span = ops_per_s(spanDisplay, op);
+    printf("%-16s set(): %9.0f/s  spans: %9.0f/s  x%.1f\n", name, pixel, span, span / pixel);
+}
+
+static void op_clear(PixelDisplay &d, bool) {
+    d.clear();
+}
+
+int main() {
+    for (size_t i = 0; i < sizeof(image_data) / sizeof(image_data[0]); i++) {
+        image_data[i] = (uint16_t)(i * 2654435761u >> 16);
+    }
+    pixelDisplay.begin();
+    spanDisplay.begin();
+
+    test_same_pixels();
+    test_reversed_lines();
+    test_clipping();
+
+    bench("clear", op_clear);
+    bench("line", op_line);
+    bench("rect", op_rect);
+    bench("filled rect", op_fill_rect);
+    bench("filled ellipse", op_ellipse);
+    bench("text", op_text);
+    bench("image", op_image);
+
+    if (failures) {
+        printf("%d failure(s)\n", failures);
+        return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
@@ -75,10 +75,8 @@ void ArduinoGraphics::background(uint32_t color)
 
 void ArduinoGraphics::clear()
 {
-  for (int x = 0; x < _width; x++) {
-    for (int y = 0; y < _height; y++) {
-      set(x, y, _backgroundR, _backgroundG, _backgroundB);
-    }
+  for (int y = 0; y < _height; y++) {
+    fillSpan(0, y, _width, _backgroundR, _backgroundG, _backgroundB);
   }
 }
 
@@ -142,24 +140,31 @@ void ArduinoGraphics::ellipse(int x, int y, int width, int height)
   
   if (_fill) {
       for (j = -b; j <= b; j++) {
-          for (i = -a; i <= a; i++) {
-              if (i*i*b2 + j*j*a2 <= a2*b2) {
-                  set(x + i, y + j, _fillR, _fillG, _fillB);
-              }
+          if (y + j < 0 || y + j >= _height) {
+              continue;
+          }
+          // the widest i of the row for which i*i*b2 + j*j*a2 <= a2*b2
+          int64_t rest = a2*b2 - j*j*a2;
+          i = a;
+          if (b2 > 0) {
+              i = (int64_t)sqrt((double)rest / b2);
+              while (i > 0 && i*i*b2 > rest) i--;
+              while (i < a && (i + 1)*(i + 1)*b2 <= rest) i++;
           }
+          span(x - i, y + j, 2*i + 1, _fillR, _fillG, _fillB);
       }
   }
   if (_stroke) {
       int x_val, y_val;
       for (i = -a; i <= a; i++) {
           y_val = b * sqrt(1 - (double)i*i / a2);
-          set(x + i, y + y_val, _strokeR, _strokeG, _strokeB);
-          set(x + i, y - y_val, _strokeR, _strokeG, _strokeB);
+          pixel(x + i, y + y_val, _strokeR, _strokeG, _strokeB);
+          pixel(x + i, y - y_val, _strokeR, _strokeG, _strokeB);
       }
       for (j = -b; j <= b; j++) {
           x_val = a * sqrt(1 - (double)j*j / b2);
-          set(x + x_val, y + j, _strokeR, _strokeG, _strokeB);
-          set(x - x_val, y + j, _strokeR, _strokeG, _strokeB);
+          pixel(x + x_val, y + j, _strokeR, _strokeG, _strokeB);
+          pixel(x - x_val, y + j, _strokeR, _strokeG, _strokeB);
       }
   }
 }
@@ -171,12 +176,25 @@ void ArduinoGraphics::line(int x1, int y1, int x2, int y2)
   }
 
   if (x1 == x2) {
+    if (y1 > y2) {
+      int y = y1;
+      y1 = y2;
+      y2 = y;
+    }
+    if (y1 < 0) {
+      y1 = 0;
+    }
+    if (y2 >= _height) {
+      y2 = _height - 1;
+    }
     for (int y = y1; y <= y2; y++) {
-      set(x1, y, _strokeR, _strokeG, _strokeB);
+      pixel(x1, y, _strokeR, _strokeG, _strokeB);
     }
   } else if (y1 == y2) {
-    for (int x = x1; x <= x2; x++) {
-      set(x, y1, _strokeR, _strokeG, _strokeB);
+    if (x1 > x2) {
+      span(x2, y1, x1 - x2 + 1, _strokeR, _strokeG, _strokeB);
+    } else {
+      span(x1, y1, x2 - x1 + 1, _strokeR, _strokeG, _strokeB);
     }
   } else if (abs(y2 - y1) < abs(x2 - x1)) {
     if (x1 > x2) {
@@ -196,13 +214,13 @@ void ArduinoGraphics::line(int x1, int y1, int x2, int y2)
 void ArduinoGraphics::point(int x, int y)
 {
   if (_stroke) {
-    set(x, y, _strokeR, _strokeG, _strokeB);
+    pixel(x, y, _strokeR, _strokeG, _strokeB);
   }
 }
 
 void ArduinoGraphics::rect(int x, int y, int width, int height)
 {
-  if (!_stroke && !_fill) {
+  if ((!_stroke && !_fill) || width <= 0 || height <= 0) {
     return;
   }
 
@@ -211,14 +229,23 @@ void ArduinoGraphics::rect(int x, int y, int width, int height)
   int x2 = x1 + width - 1;
   int y2 = y1 + height - 1;
 
-  for (x = x1; x <= x2; x++) {
-    for (y = y1; y <= y2; y++) {
-      if ((x == x1 || x == x2 || y == y1 || y == y2) && _stroke) {
-        // stroke
-        set(x, y, _strokeR, _strokeG, _strokeB);
-      } else if (_fill) {
-        // fill
-        set(x, y, _fillR, _fillG, _fillB);
+  int yStart = (y1 < 0) ? 0 : y1;
+  int yEnd = (y2 >= _height) ? _height - 1 : y2;
+
+  for (y = yStart; y <= yEnd; y++) {
+    if (!_stroke) {
+      // fill
+      span(x1, y, width, _fillR, _fillG, _fillB);
+    } else if (y == y1 || y == y2) {
+      // stroke
+      span(x1, y, width, _strokeR, _strokeG, _strokeB);
+    } else {
+      pixel(x1, y, _strokeR, _strokeG, _strokeB);
+      if (_fill) {
+        span(x1 + 1, y, width - 2, _fillR, _fillG, _fillB);
+      }
+      if (x2 > x1) {
+        pixel(x2, y, _strokeR, _strokeG, _strokeB);
       }
     }
   }
@@ -287,21 +314,40 @@ void ArduinoGraphics::bitmap(const uint8_t* data, int x, int y, int w, int h, ui
     return;
   }
 
-  int xStart = x;
-  for (int j = 0; j < h; j++) {
+  if (w > 8) {
+    w = 8;
+  }
+
+  for (int j = 0; j < h && y < _height; j++, y += scale_y) {
+    if (y + scale_y <= 0) {
+      continue;
+    }
+
+    // split the row into runs of the same color once and repeat them scale_y times
     uint8_t b = data[j];
+    int runX[8], runW[8];
+    bool runOn[8];
+    int runs = 0;
+    for (int i = 0; i < w; i++) {
+      bool on = b & (1 << (7 - i));
+      if (runs > 0 && runOn[runs - 1] == on) {
+        runW[runs - 1] += scale_x;
+      } else {
+        runX[runs] = x + i * scale_x;
+        runW[runs] = scale_x;
+        runOn[runs] = on;
+        runs++;
+      }
+    }
+
     for (uint8_t ys = 0; ys < scale_y; ys++) {
-      if (ys >= _height) return;
-      x = xStart;                  // reset for each row
-      for (int i = 0; i < w; i++) {
-        if (b & (1 << (7 - i))) {
-          for (uint8_t xs = 0; xs < scale_x; xs++) set(x++, y, _strokeR, _strokeG, _strokeB);
+      for (int r = 0; r < runs; r++) {
+        if (runOn[r]) {
+          span(runX[r], y + ys, runW[r], _strokeR, _strokeG, _strokeB);
         } else {
-          for (uint8_t xs = 0; xs < scale_x; xs++) set(x++, y, _backgroundR, _backgroundG, _backgroundB);
+          span(runX[r], y + ys, runW[r], _backgroundR, _backgroundG, _backgroundB);
         }
-        if (x >= _width) break;
       }
-      y++;
     }
   }
 }
@@ -309,52 +355,36 @@ void ArduinoGraphics::bitmap(const uint8_t* data, int x, int y, int w, int h, ui
 
 void ArduinoGraphics::imageRGB(const Image& img, int x, int y, int width, int height)
 {
-  const uint8_t* data = img.data();
-
-  for (int j = 0; j < height; j++) {
-    for (int i = 0; i < width; i++) {
-      uint8_t r = *data++;
-      uint8_t g = *data++;
-      uint8_t b = *data++;
-
-      set(x + i, y + j, r, g, b);
-
-      data++;
-    }
-
-    data += (4 * (img.width() - width));
-  }
+  imageRows(img, x, y, width, height, 4);
 }
 
 void ArduinoGraphics::imageRGB24(const Image& img, int x, int y, int width, int height)
 {
-  const uint8_t* data = img.data();
-
-  for (int j = 0; j < height; j++) {
-    for (int i = 0; i < width; i++) {
-      uint8_t r = *data++;
-      uint8_t g = *data++;
-      uint8_t b = *data++;
-
-      set(x + i, y + j, r, g, b);
-    }
-
-    data += (3 * (img.width() - width));
-  }
+  imageRows(img, x, y, width, height, 3);
 }
 
 void ArduinoGraphics::imageRGB16(const Image& img, int x, int y, int width, int height)
 {
-  const uint16_t* data = (const uint16_t*)img.data();
+  imageRows(img, x, y, width, height, 2);
+}
+
+void ArduinoGraphics::imageRows(const Image& img, int x, int y, int width, int height, int bpp)
+{
+  int stride = img.width() * bpp;
+  int i0 = (x < 0) ? -x : 0;
+  int i1 = (x + width > _width) ? _width - x : width;
+  int j0 = (y < 0) ? -y : 0;
+  int j1 = (y + height > _height) ? _height - y : height;
 
-  for (int j = 0; j < height; j++) {
-    for (int i = 0; i < width; i++) {
-      uint16_t pixel = *data++;
+  if (i0 >= i1) {
+    return;
+  }
 
-      set(x + i, y + j, ((pixel >> 8) & 0xf8), ((pixel >> 3) & 0xfc), (pixel << 3) & 0xf8);
-    }
+  const uint8_t* data = img.data() + j0 * stride + i0 * bpp;
 
-    data += (img.width() - width);
+  for (int j = j0; j < j1; j++) {
+    blitRow(x + i0, y + j, i1 - i0, data, img.encoding());
+    data += stride;
   }
 }
 
@@ -390,6 +420,68 @@ void ArduinoGraphics::set(int x, int y, uint32_t color)
   set(x, y, COLOR_R(color), COLOR_G(color), COLOR_B(color));
 }
 
+void ArduinoGraphics::fillSpan(int x, int y, int width, uint8_t r, uint8_t g, uint8_t b)
+{
+  for (int i = 0; i < width; i++) {
+    set(x + i, y, r, g, b);
+  }
+}
+
+void ArduinoGraphics::blitRow(int x, int y, int width, const uint8_t* data, int encoding)
+{
+  switch (encoding) {
+    case ENCODING_RGB:
+      for (int i = 0; i < width; i++, data += 4) {
+        set(x + i, y, data[0], data[1], data[2]);
+      }
+      break;
+
+    case ENCODING_RGB24:
+      for (int i = 0; i < width; i++, data += 3) {
+        set(x + i, y, data[0], data[1], data[2]);
+      }
+      break;
+
+    case ENCODING_RGB16: {
+      const uint16_t* pixels = (const uint16_t*)data;
+
+      for (int i = 0; i < width; i++) {
+        uint16_t pixel = *pixels++;
+
+        set(x + i, y, ((pixel >> 8) & 0xf8), ((pixel >> 3) & 0xfc), (pixel << 3) & 0xf8);
+      }
+      break;
+    }
+  }
+}
+
+void ArduinoGraphics::span(int x, int y, int width, uint8_t r, uint8_t g, uint8_t b)
+{
+  if (y < 0 || y >= _height) {
+    return;
+  }
+
+  if (x < 0) {
+    width += x;
+    x = 0;
+  }
+
+  if (width > _width - x) {
+    width = _width - x;
+  }
+
+  if (width > 0) {
+    fillSpan(x, y, width, r, g, b);
+  }
+}
+
+void ArduinoGraphics::pixel(int x, int y, uint8_t r, uint8_t g, uint8_t b)
+{
+  if (x >= 0 && x < _width && y >= 0 && y < _height) {
+    set(x, y, r, g, b);
+  }
+}
+
 size_t ArduinoGraphics::write(uint8_t b)
 {
   if (b != 0xc2 && b != 0xc3) {
@@ -547,19 +639,54 @@ void ArduinoGraphics::lineLow(int x1, int y1, int x2, int y2)
     dy = -dy;
   }
 
-  int D = 2 * dy - dx;
-  int y = y1;
+  // skip the steps before the line enters the screen, after k steps
+  // y has moved (2 * dy * k + dx - 1) / (2 * dx) times
+  int32_t k = (x1 < 0) ? -x1 : 0;
+  int32_t t = (yi > 0) ? -y1 : y1 - (_height - 1);
 
-  for (int x = x1; x <= x2; x++) {
-    set(x, y, _strokeR, _strokeG, _strokeB);
+  if (t > 0) {
+    int32_t kt = (int32_t)((2 * (int64_t)dx * t - dx + 2 * dy) / (2 * dy));
+
+    if (kt > k) {
+      k = kt;
+    }
+  }
+
+  if (k > dx) {
+    return;
+  }
 
+  int32_t n = (int32_t)((2 * (int64_t)dy * k + dx - 1) / (2 * dx));
+  int x = x1 + k;
+  int y = y1 + yi * n;
+  int xEnd = (x2 >= _width) ? _width - 1 : x2;
+
+  if (x > xEnd || y < 0 || y >= _height) {
+    return;
+  }
+
+  int D = (int)(2 * (int64_t)dy * (k + 1) - dx - 2 * (int64_t)dx * n);
+  int xStart = x;
+
+  // draw the pixels of the same y as one span
+  for (; x <= xEnd; x++) {
     if (D > 0) {
+      fillSpan(xStart, y, x - xStart + 1, _strokeR, _strokeG, _strokeB);
+      xStart = x + 1;
       y += yi;
       D -= (2 * dx);
+
+      if (y < 0 || y >= _height) {
+        return;
+      }
     }
 
     D += (2 * dy);
   }
+
+  if (xStart <= xEnd) {
+    fillSpan(xStart, y, xEnd - xStart + 1, _strokeR, _strokeG, _strokeB);
+  }
 }
 
 void ArduinoGraphics::lineHigh(int x1, int y1, int x2, int y2)
@@ -572,16 +699,44 @@ void ArduinoGraphics::lineHigh(int x1, int y1, int x2, int y2)
     xi = -1;
     dx = -dx;
   }
-  
-  int D = 2 * dx - dy;
-  int x = x1;
 
-  for (int y = y1; y <= y2; y++) {
+  // as in lineLow() with x and y swapped
+  int32_t k = (y1 < 0) ? -y1 : 0;
+  int32_t t = (xi > 0) ? -x1 : x1 - (_width - 1);
+
+  if (t > 0) {
+    int32_t kt = (int32_t)((2 * (int64_t)dy * t - dy + 2 * dx) / (2 * dx));
+
+    if (kt > k) {
+      k = kt;
+    }
+  }
+
+  if (k > dy) {
+    return;
+  }
+
+  int32_t n = (int32_t)((2 * (int64_t)dx * k + dy - 1) / (2 * dy));
+  int x = x1 + xi * n;
+  int y = y1 + k;
+  int yEnd = (y2 >= _height) ? _height - 1 : y2;
+
+  if (y > yEnd || x < 0 || x >= _width) {
+    return;
+  }
+
+  int D = (int)(2 * (int64_t)dx * (k + 1) - dy - 2 * (int64_t)dy * n);
+
+  for (; y <= yEnd; y++) {
     set(x, y, _strokeR, _strokeG, _strokeB);
 
     if (D > 0) {
-       x += xi;
-       D -= 2 * dy;
+      x += xi;
+      D -= 2 * dy;
+
+      if (x < 0 || x >= _width) {
+        return;
+      }
     }
 
     D += 2 * dx;
@@ -80,6 +80,13 @@ public:
   virtual void textScrollSpeed(unsigned long speed = 150);
 
 protected:
+  // Span backend, the primitives clip their shapes to the screen and draw them
+  // by rows with these. The defaults call set() for each pixel, override them
+  // when the display can fill or copy a row at once.
+  virtual void fillSpan(int x, int y, int width, uint8_t r, uint8_t g, uint8_t b);
+  // data is a row of pixels in the ENCODING_* format of an Image
+  virtual void blitRow(int x, int y, int width, const uint8_t* data, int encoding);
+
   virtual void bitmap(const uint8_t* data, int x, int y, int w, int h, uint8_t scale_x = 1, 
                       uint8_t scale_y = 1);
   virtual void imageRGB(const Image& img, int x, int y, int width, int height);
@@ -87,6 +94,9 @@ protected:
   virtual void imageRGB16(const Image& img, int x, int y, int width, int height);
 
 private:
+  void span(int x, int y, int width, uint8_t r, uint8_t g, uint8_t b);
+  void pixel(int x, int y, uint8_t r, uint8_t g, uint8_t b);
+  void imageRows(const Image& img, int x, int y, int width, int height, int bpp);
   void lineLow(int x1, int y1, int x2, int y2);
   void lineHigh(int x1, int y1, int x2, int y2);
 
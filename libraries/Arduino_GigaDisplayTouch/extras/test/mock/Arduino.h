@@ -0,0 +1,24 @@
+/* Minimal Arduino API for the host test */
+#ifndef MOCK_ARDUINO_H
+#define MOCK_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define LOW     0
+#define HIGH    1
+#define INPUT   0
+#define OUTPUT  1
+
+typedef int PinName;
+
+extern uint32_t mock_millis;
+
+inline uint32_t millis() { return mock_millis; }
+inline void delay(uint32_t ms) { mock_millis += ms; }
+inline void delayMicroseconds(uint32_t) { }
+inline void pinMode(uint8_t, uint8_t) { }
+inline void digitalWrite(uint8_t, uint8_t) { }
+inline PinName digitalPinToPinName(uint8_t pin) { return pin; }
+
+#endif
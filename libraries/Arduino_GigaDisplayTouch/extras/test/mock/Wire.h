@@ -0,0 +1,28 @@
+/* TwoWire backed by the simulated GT911 (see gt911_sim.h) */
+#ifndef MOCK_WIRE_H
+#define MOCK_WIRE_H
+
+#include "Arduino.h"
+
+class TwoWire {
+  public:
+    void setClock(uint32_t) { }
+    void begin() { }
+    void beginTransmission(uint8_t addr);
+    size_t write(uint8_t data);
+    uint8_t endTransmission();
+    uint8_t requestFrom(uint8_t addr, uint8_t len);
+    int available();
+    int read();
+
+    uint32_t transactions = 0;  /* Number of transfers on the bus */
+
+  private:
+    uint8_t _tx[64];
+    uint8_t _txLen = 0;
+    uint16_t _reg = 0;
+    uint8_t _rxPos = 0;
+    uint8_t _rxLen = 0;
+};
+
+#endif
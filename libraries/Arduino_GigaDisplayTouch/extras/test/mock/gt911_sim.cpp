@@ -0,0 +1,75 @@
+#include "gt911_sim.h"
+#include "Wire.h"
+#include "mbed.h"
+#include "lvgl.h"
+
+uint32_t mock_millis;
+lv_indev_drv_t * mock_indev_drv;
+mbed::InterruptIn * mbed::InterruptIn::last;
+
+namespace gt911_sim {
+
+uint8_t regs[0x200];
+
+static uint8_t & reg(uint16_t addr) {
+    return regs[(addr - 0x8000) & 0x1FF];
+}
+
+void write_report(uint8_t contacts, const GDTpoint_t * points) {
+    reg(0x814E) = 0x80 | contacts;
+    for (uint8_t i = 0; i < contacts; i++) {
+        uint16_t a = 0x814F + 8 * i;
+        reg(a + 0) = points[i].trackId;
+        reg(a + 1) = points[i].x & 0xFF;
+        reg(a + 2) = points[i].x >> 8;
+        reg(a + 3) = points[i].y & 0xFF;
+        reg(a + 4) = points[i].y >> 8;
+        reg(a + 5) = points[i].area & 0xFF;
+        reg(a + 6) = points[i].area >> 8;
+        reg(a + 7) = 0;
+    }
+}
+
+void report(uint8_t contacts, const GDTpoint_t * points) {
+    write_report(contacts, points);
+    mbed::InterruptIn::last->fire();
+}
+
+}
+
+void TwoWire::beginTransmission(uint8_t) {
+    _txLen = 0;
+}
+
+size_t TwoWire::write(uint8_t data) {
+    if (_txLen >= sizeof(_tx)) return 0;
+    _tx[_txLen++] = data;
+    return 1;
+}
+
+uint8_t TwoWire::endTransmission() {
+    transactions++;
+    if (_txLen < 2) return 4;
+
+    _reg = ((uint16_t)_tx[0] << 8) | _tx[1];
+    for (uint8_t i = 2; i < _txLen; i++) {
+        gt911_sim::reg(_reg + i - 2) = _tx[i];
+    }
+    return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t, uint8_t len) {
+    transactions++;
+    _rxPos = 0;
+    _rxLen = len;
+    return len;
+}
+
+int TwoWire::available() {
+    return _rxLen - _rxPos;
+}
+
+int TwoWire::read() {
+    if (_rxPos >= _rxLen) return -1;
+    return gt911_sim::reg(_reg + _rxPos++);
+}
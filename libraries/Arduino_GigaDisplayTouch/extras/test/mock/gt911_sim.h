@@ -0,0 +1,20 @@
+/* Simulated GT911 on the I2C bus of the host test */
+#ifndef GT911_SIM_H
+#define GT911_SIM_H
+
+#include "Arduino.h"
+#include "Arduino_GigaDisplayTouch.h"
+
+namespace gt911_sim {
+
+extern uint8_t regs[0x200];     /* Registers 0x8000..0x81FF */
+
+/* Write a report to the coordinate registers and raise the interrupt, like the controller does */
+void report(uint8_t contacts, const GDTpoint_t * points);
+
+/* Write a report without an interrupt, e.g. if the edge was lost */
+void write_report(uint8_t contacts, const GDTpoint_t * points);
+
+}
+
+#endif
@@ -0,0 +1,48 @@
+/* Minimal LVGL v8 input device API for the host test */
+#ifndef MOCK_LVGL_H
+#define MOCK_LVGL_H
+
+#include <stdint.h>
+
+#define LVGL_VERSION_MAJOR  8
+
+typedef int16_t lv_coord_t;
+
+typedef struct {
+    lv_coord_t x;
+    lv_coord_t y;
+} lv_point_t;
+
+enum {
+    LV_INDEV_STATE_REL = 0,
+    LV_INDEV_STATE_PR
+};
+typedef uint8_t lv_indev_state_t;
+
+enum {
+    LV_INDEV_TYPE_NONE,
+    LV_INDEV_TYPE_POINTER,
+};
+typedef uint8_t lv_indev_type_t;
+
+typedef struct {
+    lv_point_t point;
+    lv_indev_state_t state;
+    bool continue_reading;
+} lv_indev_data_t;
+
+struct _lv_indev_drv_t;
+typedef struct _lv_indev_drv_t lv_indev_drv_t;
+typedef struct _lv_indev_drv_t lv_indev_t;
+
+struct _lv_indev_drv_t {
+    lv_indev_type_t type;
+    void (*read_cb)(lv_indev_drv_t * indev_drv, lv_indev_data_t * data);
+};
+
+extern lv_indev_drv_t * mock_indev_drv;
+
+inline void lv_indev_drv_init(lv_indev_drv_t * drv) { *drv = lv_indev_drv_t(); }
+inline lv_indev_t * lv_indev_drv_register(lv_indev_drv_t * drv) { mock_indev_drv = drv; return drv; }
+
+#endif
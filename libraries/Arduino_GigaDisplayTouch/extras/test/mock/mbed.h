@@ -0,0 +1,76 @@
+/* Minimal mbed OS API for the host test. The event queue runs only when the test dispatches it. */
+#ifndef MOCK_MBED_H
+#define MOCK_MBED_H
+
+#include <functional>
+#include <deque>
+#include "Arduino.h"
+
+#define EVENTS_EVENT_SIZE   64
+
+namespace mbed {
+
+template<typename T>
+std::function<void()> callback(T * obj, void (T::*method)()) {
+    return [obj, method]() { (obj->*method)(); };
+}
+
+class InterruptIn {
+  public:
+    InterruptIn(PinName) { last = this; }
+    void rise(std::function<void()> handler) { _rise = handler; }
+
+    /* Simulate a rising edge */
+    void fire() { if (_rise) _rise(); }
+
+    static InterruptIn * last;
+
+  private:
+    std::function<void()> _rise;
+};
+
+}
+
+namespace events {
+
+class EventQueue {
+  public:
+    EventQueue(size_t) { }
+
+    std::function<void()> event(std::function<void()> f) {
+        return [this, f]() { _pending.push_back(f); };
+    }
+    void call(std::function<void()> f) { _pending.push_back(f); }
+    void dispatch_forever() { }
+
+    /* Run the posted events, as the event thread would */
+    size_t dispatch_pending() {
+        size_t n = 0;
+        while (!_pending.empty()) {
+            std::function<void()> f = _pending.front();
+            _pending.pop_front();
+            f();
+            n++;
+        }
+        return n;
+    }
+
+  private:
+    std::deque<std::function<void()>> _pending;
+};
+
+}
+
+namespace rtos {
+
+class Thread {
+  public:
+    void start(std::function<void()>) { started++; }
+    int started = 0;
+};
+
+}
+
+using namespace mbed;
+
+#endif
@@ -0,0 +1,5 @@
+/* Minimal pin definitions for the host test */
+#ifndef MOCK_PINDEFINITIONS_H
+#define MOCK_PINDEFINITIONS_H
+
+#endif
@@ -0,0 +1,290 @@
+/*
+ * Host test of Arduino_GigaDisplayTouch with a simulated GT911.
+ * The interrupt and the event queue thread are driven by the test, LVGL reads
+ * the input device like `lv_indev_read_timer_cb()` does.
+ */
+
+#include <stdio.h>
+#include <vector>
+
+#include "Arduino_GigaDisplayTouch.h"
+#include "gt911_sim.h"
+#include "lvgl.h"
+
+extern events::EventQueue queue;
+
+static int failures;
+
+#define CHECK(cond) do { \
+        if (!(cond)) { \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+#define CHECK_EQ(exp, act) do { \
+        long _e = (long)(exp), _a = (long)(act); \
+        if (_e != _a) { \
+            printf("%s:%d: CHECK_EQ(%s, %s) failed: %ld != %ld\n", __FILE__, __LINE__, #exp, #act, _e, _a); \
+            failures++; \
+        } \
+    } while (0)
+
+struct Read {
+    bool pressed;
+    int16_t x;
+    int16_t y;
+};
+
+static TwoWire wire;
+
+static GDTpoint_t pt(uint8_t id, uint16_t x, uint16_t y, uint16_t area = 20) {
+    GDTpoint_t p = {};
+    p.trackId = id;
+    p.x = x;
+    p.y = y;
+    p.area = area;
+    return p;
+}
+
+/* A report of the controller, handled by the event thread */
+static void touch(std::vector<GDTpoint_t> points) {
+    gt911_sim::report(points.size(), points.data());
+    queue.dispatch_pending();
+    mock_millis += 10;
+}
+
+/* One LVGL read cycle: read until `continue_reading` is cleared */
+static std::vector<Read> lvgl_read() {
+    std::vector<Read> reads;
+    lv_indev_data_t data = {};
+    do {
+        data.continue_reading = false;
+        mock_indev_drv->read_cb(mock_indev_drv, &data);
+        reads.push_back({data.state == LV_INDEV_STATE_PR, data.point.x, data.point.y});
+    } while (data.continue_reading);
+    return reads;
+}
+
+static void test_polling_before_lvgl(Arduino_GigaDisplayTouch& touchDetector) {
+    GDTpoint_t points[GT911_MAX_CONTACTS];
+
+    /* Nothing captures the reports until LVGL reads the touch */
+    touch({pt(0, 12, 34)});
+    CHECK_EQ(0, touchDetector.available());
+    CHECK_EQ(1, touchDetector.getTouchPoints(points));
+    CHECK_EQ(12, points[0].x);
+    CHECK_EQ(34, points[0].y);
+    CHECK_EQ(0, touchDetector.getTouchPoints(points));
+
+    CHECK(!lvgl_read()[0].pressed);
+    touch({pt(0, 56, 78)});
+    CHECK_EQ(0, touchDetector.getTouchPoints(points));
+    std::vector<Read> reads = lvgl_read();
+    CHECK(reads[0].pressed);
+    CHECK_EQ(56, reads[0].x);
+    touch({});
+    CHECK(!lvgl_read()[0].pressed);
+}
+
+static void test_no_i2c_when_idle(Arduino_GigaDisplayTouch& touchDetector) {
+    uint32_t trans = wire.transactions;
+    for (int i = 0; i < 100; i++) {
+        std::vector<Read> reads = lvgl_read();
+        CHECK_EQ(1, reads.size());
+        CHECK(!reads[0].pressed);
+        queue.dispatch_pending();
+        mock_millis += 5;
+    }
+    CHECK_EQ(trans, wire.transactions);
+}
+
+static void test_press_move_release(Arduino_GigaDisplayTouch& touchDetector) {
+    touch({pt(0, 100, 200)});
+    std::vector<Read> reads = lvgl_read();
+    CHECK_EQ(1, reads.size());
+    CHECK(reads[0].pressed);
+    CHECK_EQ(100, reads[0].x);
+    CHECK_EQ(200, reads[0].y);
+
+    /* No new report: stay pressed without I2C */
+    uint32_t trans = wire.transactions;
+    reads = lvgl_read();
+    CHECK(reads[0].pressed);
+    CHECK_EQ(100, reads[0].x);
+    CHECK_EQ(trans, wire.transactions);
+
+    touch({pt(0, 110, 210)});
+    reads = lvgl_read();
+    CHECK(reads[0].pressed);
+    CHECK_EQ(110, reads[0].x);
+    CHECK_EQ(210, reads[0].y);
+
+    touch({});
+    reads = lvgl_read();
+    CHECK(!reads[0].pressed);
+}
+
+/* More reports than LVGL read cycles: all the points arrive in order in one cycle */
+static void test_fast_swipe(Arduino_GigaDisplayTouch& touchDetector) {
+    for (uint16_t i = 0; i < 10; i++) {
+        touch({pt(0, 100 + 50 * i, 240)});
+    }
+    touch({});
+
+    std::vector<Read> reads = lvgl_read();
+    CHECK_EQ(11, reads.size());
+    for (uint16_t i = 0; i < 10; i++) {
+        CHECK(reads[i].pressed);
+        CHECK_EQ(100 + 50 * i, reads[i].x);
+    }
+    CHECK(!reads[10].pressed);
+    CHECK_EQ(0, touchDetector.available());
+    CHECK_EQ(0, touchDetector.getDroppedSamples());
+}
+
+static void test_multi_touch(Arduino_GigaDisplayTouch& touchDetector) {
+    touch({pt(3, 100, 100, 30)});
+    touch({pt(3, 105, 100, 31), pt(4, 400, 300, 45)});
+
+    std::vector<Read> reads = lvgl_read();
+    CHECK_EQ(2, reads.size());
+    CHECK(reads[1].pressed);
+    CHECK_EQ(105, reads[1].x);
+
+    /* All the points are available for gestures */
+    GDTsample_t sample;
+    CHECK_EQ(2, touchDetector.getLastSample(sample));
+    CHECK_EQ(3, sample.points[0].trackId);
+    CHECK_EQ(31, sample.points[0].area);
+    CHECK_EQ(4, sample.points[1].trackId);
+    CHECK_EQ(400, sample.points[1].x);
+    CHECK_EQ(300, sample.points[1].y);
+    CHECK_EQ(45, sample.points[1].area);
+
+    /* The controller may reorder the points: follow the track ID */
+    touch({pt(4, 410, 300), pt(3, 110, 100)});
+    reads = lvgl_read();
+    CHECK(reads[0].pressed);
+    CHECK_EQ(110, reads[0].x);
+
+    /* The first finger is lifted: released until all the fingers are lifted */
+    touch({pt(4, 420, 300)});
+    reads = lvgl_read();
+    CHECK(!reads[0].pressed);
+    touch({pt(4, 430, 300)});
+    reads = lvgl_read();
+    CHECK(!reads[0].pressed);
+    touch({});
+    reads = lvgl_read();
+    CHECK(!reads[0].pressed);
+
+    /* A new touch is reported again */
+    touch({pt(5, 50, 60)});
+    reads = lvgl_read();
+    CHECK(reads[0].pressed);
+    CHECK_EQ(50, reads[0].x);
+    touch({});
+    lvgl_read();
+}
+
+/* The queue is full: the newest points are lost but the release is not */
+static void test_overflow_keeps_release(Arduino_GigaDisplayTouch& touchDetector) {
+    for (uint16_t i = 0; i < GT911_SAMPLE_QUEUE_SIZE + 4; i++) {
+        touch({pt(0, i, 10)});
+    }
+    touch({});
+    CHECK_EQ(5, touchDetector.getDroppedSamples());
+    CHECK_EQ(GT911_SAMPLE_QUEUE_SIZE + 1, touchDetector.available());
+
+    std::vector<Read> reads = lvgl_read();
+    CHECK_EQ(GT911_SAMPLE_QUEUE_SIZE + 1, reads.size());
+    CHECK(reads[GT911_SAMPLE_QUEUE_SIZE - 1].pressed);
+    CHECK(!reads[GT911_SAMPLE_QUEUE_SIZE].pressed);
+
+    /* The lost release is queued before the next touch */
+    for (uint16_t i = 0; i < GT911_SAMPLE_QUEUE_SIZE; i++) {
+        touch({pt(0, i, 10)});
+    }
+    touch({});
+    CHECK_EQ(6, touchDetector.getDroppedSamples());
+    GDTsample_t sample;
+    CHECK(touchDetector.getSample(sample));
+    CHECK(touchDetector.getSample(sample));
+    touch({pt(1, 300, 30)});
+    CHECK_EQ(6, touchDetector.getDroppedSamples());
+    reads = lvgl_read();
+    CHECK_EQ(GT911_SAMPLE_QUEUE_SIZE, reads.size());
+    CHECK(!reads[GT911_SAMPLE_QUEUE_SIZE - 2].pressed);
+    CHECK(reads.back().pressed);
+    CHECK_EQ(300, reads.back().x);
+    touch({});
+    reads = lvgl_read();
+    CHECK(!reads.back().pressed);
+}
+
+/* The interrupt of the release is lost: the controller is polled once after the timeout */
+static void test_lost_irq(Arduino_GigaDisplayTouch& touchDetector) {
+    touch({pt(0, 100, 100)});
+    CHECK(lvgl_read()[0].pressed);
+
+    /* Last report without interrupt */
+    GDTpoint_t p = pt(0, 150, 100);
+    gt911_sim::write_report(1, &p);
+
+    mock_millis += GT911_TOUCH_TIMEOUT_MS + 1;
+    CHECK(lvgl_read()[0].pressed);
+    CHECK_EQ(1, queue.dispatch_pending());
+    std::vector<Read> reads = lvgl_read();
+    CHECK(reads[0].pressed);
+    CHECK_EQ(150, reads[0].x);
+
+    /* No report at all: the finger was lifted */
+    mock_millis += GT911_TOUCH_TIMEOUT_MS + 1;
+    lvgl_read();
+    CHECK_EQ(1, queue.dispatch_pending());
+    CHECK(!lvgl_read()[0].pressed);
+
+    /* Released: no more polling */
+    mock_millis += GT911_TOUCH_TIMEOUT_MS + 1;
+    lvgl_read();
+    CHECK_EQ(0, queue.dispatch_pending());
+}
+
+static void test_on_detect(Arduino_GigaDisplayTouch& touchDetector) {
+    static uint8_t contacts;
+    static uint16_t x;
+    touchDetector.onDetect([](uint8_t c, GDTpoint_t * points) { contacts = c; x = points[0].x; });
+
+    touch({pt(0, 77, 88)});
+    CHECK_EQ(1, contacts);
+    CHECK_EQ(77, x);
+
+    /* The samples are captured for LVGL too */
+    CHECK(lvgl_read()[0].pressed);
+    touch({});
+    CHECK(!lvgl_read()[0].pressed);
+}
+
+int main() {
+    Arduino_GigaDisplayTouch touchDetector(wire, 1, 2, GT911_I2C_ADDR_BA_BB);
+
+    CHECK(touchDetector.begin());
+    CHECK(mock_indev_drv != nullptr);
+
+    test_polling_before_lvgl(touchDetector);
+    test_no_i2c_when_idle(touchDetector);
+    test_press_move_release(touchDetector);
+    test_fast_swipe(touchDetector);
+    test_multi_touch(touchDetector);
+    test_overflow_keeps_release(touchDetector);
+    test_lost_irq(touchDetector);
+    test_on_detect(touchDetector);
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("All tests passed\n");
+    return 0;
+}
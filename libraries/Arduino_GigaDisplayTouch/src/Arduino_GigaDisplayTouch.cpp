@@ -25,10 +25,6 @@
  /* Includes -----------------------------------------------------------------*/
 #include "Arduino_GigaDisplayTouch.h"
 
-#if __has_include ("lvgl.h")
-#include "lvgl.h"
-#endif
-
 /* Private defines -----------------------------------------------------------*/
 #define GT911_REG_GESTURE_START_POINT   0x814E
 #define GT911_REG_CONFIG_VERSION        0x8047
@@ -49,7 +45,8 @@ void _lvglTouchCb(lv_indev_drv_t * indev, lv_indev_data_t * data);
 
 /* Functions -----------------------------------------------------------------*/
 Arduino_GigaDisplayTouch::Arduino_GigaDisplayTouch(TwoWire& wire, uint8_t intPin, uint8_t rstPin, uint8_t addr)
-: _wire{wire}, _intPin{intPin}, _rstPin{rstPin}, _addr{addr}, _irqInt{digitalPinToPinName(intPin)}
+: _wire{wire}, _intPin{intPin}, _rstPin{rstPin}, _addr{addr}, _irqInt{digitalPinToPinName(intPin)},
+  _gt911TouchHandler{nullptr}, _irqStarted{false}, _sampleHead{0}, _sampleTail{0}, _sampleDropped{0}, _releaseDropped{false}
 { }
 
 Arduino_GigaDisplayTouch::~Arduino_GigaDisplayTouch() 
@@ -83,6 +80,15 @@ bool Arduino_GigaDisplayTouch::begin() {
 
     _gt911TouchHandler = nullptr;
 
+    _sampleTail         = _sampleHead.load();
+    _sampleDropped      = 0;
+    _releaseDropped     = false;
+    _lvglSample.contacts = 0;
+    _lvglPoint          = {};
+    _lvglPressed        = false;
+    _lvglWaitRelease    = false;
+    _lvglLastSampleTime = 0;
+
     /* GT911 test communication */
     uint8_t testByte;
     uint8_t error = _gt911ReadOp(GT911_REG_CONFIG_VERSION,  &testByte, 1);
@@ -102,42 +108,49 @@ bool Arduino_GigaDisplayTouch::begin() {
 #endif
 
     gThis = this;
+
     return (error == 0);
 }
 
 #if __has_include ("lvgl.h")
 #if (LVGL_VERSION_MAJOR == 9)
 void _lvglTouchCb(lv_indev_t * indev, lv_indev_data_t * data) {
-    uint8_t contacts;
-    GDTpoint_t points[5];
+    uint16_t x, y;
 
-    contacts = gThis->getTouchPoints(points);
+    /* Capture the reports by interrupt only when LVGL reads them, a polling sketch reads the controller itself */
+    gThis->_startIrq();
 
-    if(contacts > 0) {
+    if(gThis->_lvglRead(x, y)) {
         data->state     = LV_INDEV_STATE_PRESSED;
-        data->point.x   = points[0].x;
-        data->point.y   = points[0].y;
+        data->point.x   = x;
+        data->point.y   = y;
     } else {
         data->state     = LV_INDEV_STATE_RELEASED;
     }
 
+    /* Pass all the queued reports in this cycle, so no point of a fast swipe is lost */
+    data->continue_reading = (gThis->available() > 0);
+
     return;
 }
 #else
 void _lvglTouchCb(lv_indev_drv_t * indev, lv_indev_data_t * data) {
-    uint8_t contacts;
-    GDTpoint_t points[5];
+    uint16_t x, y;
 
-    contacts = gThis->getTouchPoints(points);
+    /* Capture the reports by interrupt only when LVGL reads them, a polling sketch reads the controller itself */
+    gThis->_startIrq();
 
-    if(contacts > 0) {
+    if(gThis->_lvglRead(x, y)) {
         data->state     = LV_INDEV_STATE_PR;
-        data->point.x   = points[0].x;
-        data->point.y   = points[0].y;
+        data->point.x   = x;
+        data->point.y   = y;
     } else {
         data->state     = LV_INDEV_STATE_REL;
     }
 
+    /* Pass all the queued reports in this cycle, so no point of a fast swipe is lost */
+    data->continue_reading = (gThis->available() > 0);
+
     return;
 }
 #endif
@@ -147,7 +160,7 @@ void Arduino_GigaDisplayTouch::end()
 { }
 
 uint8_t Arduino_GigaDisplayTouch::getTouchPoints(GDTpoint_t* points) {
-    uint8_t rawpoints[GT911_MAX_CONTACTS * GT911_CONTACT_SIZE];
+    uint8_t rawpoints[1 + GT911_MAX_CONTACTS * GT911_CONTACT_SIZE];
     uint8_t contacts;
     uint8_t error;
 
@@ -158,12 +171,7 @@ uint8_t Arduino_GigaDisplayTouch::getTouchPoints(GDTpoint_t* points) {
         return 0;
     }
 
-    for (uint8_t i = 0; i < contacts; i++) {
-        points[i].trackId  = rawpoints[1 + 8*i];	    
-        points[i].x        = ((uint16_t)rawpoints[3 + 8*i] << 8) + rawpoints[2 + 8*i];
-        points[i].y        = ((uint16_t)rawpoints[5 + 8*i] << 8) + rawpoints[4 + 8*i];
-        points[i].area     = ((uint16_t)rawpoints[7 + 8*i] << 8) + rawpoints[6 + 8*i];
-    }
+    _gt911ParsePoints(rawpoints, contacts, points);
  
     _gt911WriteOp(GT911_REG_GESTURE_START_POINT, 0); /* Reset buffer status to finish the reading */
 
@@ -172,10 +180,125 @@ uint8_t Arduino_GigaDisplayTouch::getTouchPoints(GDTpoint_t* points) {
 
 void Arduino_GigaDisplayTouch::onDetect(void (*handler)(uint8_t, GDTpoint_t*)) {
     _gt911TouchHandler = handler;
+    _startIrq();
+}
+
+bool Arduino_GigaDisplayTouch::getSample(GDTsample_t& sample) {
+    uint32_t tail = _sampleTail.load(std::memory_order_relaxed);
+    uint32_t head = _sampleHead.load(std::memory_order_acquire);
+
+    if (tail == head) {
+        /* Nothing is queued after a lost release, so it can be reported now */
+        if (_releaseDropped.exchange(false)) {
+            sample.timestamp    = millis();
+            sample.contacts     = 0;
+            return true;
+        }
+        return false;
+    }
+
+    sample = _samples[tail & (GT911_SAMPLE_QUEUE_SIZE - 1)];
+    _sampleTail.store(tail + 1, std::memory_order_release);
+
+    return true;
+}
+
+uint8_t Arduino_GigaDisplayTouch::available() {
+    uint32_t tail = _sampleTail.load(std::memory_order_relaxed);
+    uint32_t head = _sampleHead.load(std::memory_order_acquire);
+
+    return (head - tail) + (_releaseDropped.load() ? 1 : 0);
+}
+
+uint32_t Arduino_GigaDisplayTouch::getDroppedSamples() {
+    return _sampleDropped.load();
+}
+
+uint8_t Arduino_GigaDisplayTouch::getLastSample(GDTsample_t& sample) {
+    sample = _lvglSample;
+    return sample.contacts;
+}
+
+bool Arduino_GigaDisplayTouch::_lvglRead(uint16_t& x, uint16_t& y) {
+    GDTsample_t sample;
+
+    if (getSample(sample)) {
+        _lvglSample         = sample;
+        _lvglLastSampleTime = millis();
+
+        if (sample.contacts == 0) {
+            _lvglPressed        = false;
+            _lvglWaitRelease    = false;
+        } else if (!_lvglWaitRelease) {
+            /* Follow the first finger until it's lifted, ignore the others */
+            int8_t primary = -1;
+            if (!_lvglPressed) {
+                _lvglTrackId = sample.points[0].trackId;
+            }
+            for (uint8_t i = 0; i < sample.contacts; i++) {
+                if (sample.points[i].trackId == _lvglTrackId) primary = i;
+            }
+
+            if (primary >= 0) {
+                _lvglPressed        = true;
+                _lvglPoint          = sample.points[primary];
+            } else {
+                /* The first finger was lifted: released until all the fingers are lifted */
+                _lvglPressed        = false;
+                _lvglWaitRelease    = true;
+            }
+        }
+    } else if ((_lvglPressed || _lvglWaitRelease) && millis() - _lvglLastSampleTime > GT911_TOUCH_TIMEOUT_MS) {
+        /* The controller reports ~100 times/s while touched. If the reports stopped
+         * (e.g. a lost interrupt) ask the controller again instead of staying pressed. */
+        _lvglLastSampleTime = millis();
+        queue.call(mbed::callback(this, &Arduino_GigaDisplayTouch::_gt911onTimeout));
+    }
+
+    x = _lvglPoint.x;
+    y = _lvglPoint.y;
+
+    return _lvglPressed;
+}
+
+void Arduino_GigaDisplayTouch::_startIrq() {
+    if (_irqStarted) return;
+
+    _irqStarted = true;
     t.start(callback(&queue, &events::EventQueue::dispatch_forever));
     _irqInt.rise(queue.event(mbed::callback(this, &Arduino_GigaDisplayTouch::_gt911onIrq)));
 }
 
+void Arduino_GigaDisplayTouch::_pushSample(uint8_t contacts, const GDTpoint_t * points) {
+    uint32_t head = _sampleHead.load(std::memory_order_relaxed);
+    uint32_t tail = _sampleTail.load(std::memory_order_acquire);
+    uint32_t space = GT911_SAMPLE_QUEUE_SIZE - (head - tail);
+
+    /* Keep the order: the lost release goes first, or nothing if it still doesn't fit */
+    if (_releaseDropped.load() && space >= 2 && _releaseDropped.exchange(false)) {
+        GDTsample_t& release    = _samples[head & (GT911_SAMPLE_QUEUE_SIZE - 1)];
+        release.timestamp       = millis();
+        release.contacts        = 0;
+        head++;
+        space--;
+        _sampleHead.store(head, std::memory_order_release);
+    }
+
+    if (space == 0 || _releaseDropped.load()) {
+        _sampleDropped++;
+        if (contacts == 0) _releaseDropped = true;
+        return;
+    }
+
+    GDTsample_t& sample = _samples[head & (GT911_SAMPLE_QUEUE_SIZE - 1)];
+    sample.timestamp    = millis();
+    sample.contacts     = contacts;
+    for (uint8_t i = 0; i < contacts; i++) {
+        sample.points[i] = points[i];
+    }
+    _sampleHead.store(head + 1, std::memory_order_release);
+}
+
 uint8_t Arduino_GigaDisplayTouch::_gt911WriteOp(uint16_t reg, uint8_t data) {
     uint8_t status = 0;
     status = _gt911WriteBytesOp(reg, &data, 1);
@@ -223,7 +346,7 @@ uint8_t Arduino_GigaDisplayTouch::_gt911ReadOp(uint16_t reg, uint8_t * data, uin
 
 void Arduino_GigaDisplayTouch::_gt911onIrq() {
     uint8_t contacts;
-    uint8_t rawpoints[GT911_MAX_CONTACTS * GT911_CONTACT_SIZE];
+    uint8_t rawpoints[1 + GT911_MAX_CONTACTS * GT911_CONTACT_SIZE];
     uint8_t error;
 
     error = _gt911ReadInputCoord(rawpoints, contacts);
@@ -232,23 +355,51 @@ void Arduino_GigaDisplayTouch::_gt911onIrq() {
         return;
     }
 
-    for (uint8_t i = 0; i < contacts; i++) {
-        _points[i].trackId  = rawpoints[1 + 8*i];	    
-        _points[i].x        = ((uint16_t)rawpoints[3 + 8*i] << 8) + rawpoints[2 + 8*i];
-        _points[i].y        = ((uint16_t)rawpoints[5 + 8*i] << 8) + rawpoints[4 + 8*i];
-        _points[i].area     = ((uint16_t)rawpoints[7 + 8*i] << 8) + rawpoints[6 + 8*i];
-    }
+    _gt911ParsePoints(rawpoints, contacts, _points);
+    _pushSample(contacts, _points);
 
     if (contacts > 0 && _gt911TouchHandler != nullptr) _gt911TouchHandler(contacts, _points);
  
     _gt911WriteOp(GT911_REG_GESTURE_START_POINT, 0); /* Reset buffer status to finish the reading */
 }
 
+void Arduino_GigaDisplayTouch::_gt911onTimeout() {
+    uint8_t contacts;
+    uint8_t rawpoints[1 + GT911_MAX_CONTACTS * GT911_CONTACT_SIZE];
+    uint8_t error;
+
+    error = _gt911ReadInputCoord(rawpoints, contacts);
+
+    if (error == 1) {
+        return;
+    }
+
+    if (error == 2) {
+        /* No new report while touched means the fingers were lifted */
+        _pushSample(0, _points);
+        return;
+    }
+
+    _gt911ParsePoints(rawpoints, contacts, _points);
+    _pushSample(contacts, _points);
+
+    _gt911WriteOp(GT911_REG_GESTURE_START_POINT, 0); /* Reset buffer status to finish the reading */
+}
+
+void Arduino_GigaDisplayTouch::_gt911ParsePoints(const uint8_t * pointsbuf, uint8_t contacts, GDTpoint_t * points) {
+    for (uint8_t i = 0; i < contacts; i++) {
+        points[i].trackId  = pointsbuf[1 + 8*i];
+        points[i].x        = ((uint16_t)pointsbuf[3 + 8*i] << 8) + pointsbuf[2 + 8*i];
+        points[i].y        = ((uint16_t)pointsbuf[5 + 8*i] << 8) + pointsbuf[4 + 8*i];
+        points[i].area     = ((uint16_t)pointsbuf[7 + 8*i] << 8) + pointsbuf[6 + 8*i];
+    }
+}
+
 uint8_t Arduino_GigaDisplayTouch::_gt911ReadInputCoord(uint8_t * pointsbuf, uint8_t& contacts) {
     uint8_t error;
     
     contacts = 0;
-    error    = _gt911ReadOp(GT911_REG_GESTURE_START_POINT, pointsbuf, GT911_CONTACT_SIZE * GT911_MAX_CONTACTS);
+    error    = _gt911ReadOp(GT911_REG_GESTURE_START_POINT, pointsbuf, 1 + GT911_CONTACT_SIZE * GT911_MAX_CONTACTS);  /* Status + points */
 
     if (error) {
         return 1; /* I2C comm error */
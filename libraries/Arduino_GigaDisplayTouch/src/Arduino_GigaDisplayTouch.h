@@ -33,6 +33,11 @@
 #include "Wire.h"
 #include "mbed.h"
 #include "pinDefinitions.h"
+#include <atomic>
+
+#if __has_include ("lvgl.h")
+#include "lvgl.h"
+#endif
 
 /* Exported defines ----------------------------------------------------------*/
 #define GT911_I2C_ADDR_BA_BB    (0x5D | 0x80)  // 0xBA/0xBB - 0x5D (7bit address)
@@ -41,8 +46,12 @@
 #define GT911_CONTACT_SIZE      8
 #define GT911_MAX_CONTACTS      5
 
+#define GT911_SAMPLE_QUEUE_SIZE 16      // Samples captured by the IRQ and not read yet. Must be a power of 2.
+#define GT911_TOUCH_TIMEOUT_MS  100     // Poll the controller once if it stops reporting a touch for this long
+
 /* Exported types ------------------------------------------------------------*/
 typedef struct GDTpoint_s GDTpoint_t;
+typedef struct GDTsample_s GDTsample_t;
 
 /* Exported enumeration ------------------------------------------------------*/
 
@@ -60,6 +69,15 @@ struct GDTpoint_s {
   uint8_t reserved;
 };
 
+/**
+ * @brief Struct representing a report of the touch controller.
+ */
+struct GDTsample_s {
+  uint32_t timestamp;                       // millis() when the report was read
+  uint8_t contacts;                         // 0 if all the fingers were lifted
+  GDTpoint_t points[GT911_MAX_CONTACTS];
+};
+
 /* Class ----------------------------------------------------------------------*/
 
 /**
@@ -119,6 +137,33 @@ class Arduino_GigaDisplayTouch {
        * @param handler The pointer to the user-defined handler function.
        */
       void onDetect(void (*handler)(uint8_t, GDTpoint_t*));
+
+      /**
+       * @brief Get the oldest report captured by the interrupt and remove it from the queue.
+       * The capturing starts with onDetect() or when LVGL reads the touch for the first time.
+       * @param sample The struct to store the report in.
+       * @return true If a report was available, false Otherwise
+       */
+      bool getSample(GDTsample_t& sample);
+
+      /**
+       * @brief Get the number of the reports in the queue.
+       * @return uint8_t The number of reports which can be read by getSample().
+       */
+      uint8_t available();
+
+      /**
+       * @brief Get the number of the reports lost because the queue was full.
+       * @return uint32_t The number of lost reports since begin().
+       */
+      uint32_t getDroppedSamples();
+
+      /**
+       * @brief Get the report last passed to LVGL with all the touch points, e.g. for multi-touch gestures.
+       * @param sample The struct to store the report in.
+       * @return uint8_t The number of touch points in the report.
+       */
+      uint8_t getLastSample(GDTsample_t& sample);
   private:
       TwoWire&          _wire;
       uint8_t           _intPin;
@@ -127,12 +172,41 @@ class Arduino_GigaDisplayTouch {
       uint8_t           _addr;
       GDTpoint_t        _points[GT911_MAX_CONTACTS];
       void              (*_gt911TouchHandler)(uint8_t, GDTpoint_t*);
+      bool              _irqStarted;
+
+      /* Single producer (event queue thread), single consumer (LVGL) ring buffer */
+      GDTsample_t             _samples[GT911_SAMPLE_QUEUE_SIZE];
+      std::atomic<uint32_t>   _sampleHead;    /* Written only by the producer */
+      std::atomic<uint32_t>   _sampleTail;    /* Written only by the consumer */
+      std::atomic<uint32_t>   _sampleDropped;
+      std::atomic<bool>       _releaseDropped; /* A release didn't fit, queue it before the next report */
+
+      /* State of the LVGL input device */
+      GDTsample_t       _lvglSample;
+      GDTpoint_t        _lvglPoint;
+      uint8_t           _lvglTrackId;
+      bool              _lvglPressed;
+      bool              _lvglWaitRelease;
+      uint32_t          _lvglLastSampleTime;
 
       uint8_t   _gt911WriteOp(uint16_t reg, uint8_t data);
       uint8_t   _gt911WriteBytesOp(uint16_t reg, uint8_t * data, uint8_t len);
       uint8_t   _gt911ReadOp(uint16_t reg, uint8_t * data, uint8_t len);
       void      _gt911onIrq();
       uint8_t   _gt911ReadInputCoord(uint8_t * pointsbuf, uint8_t& contacts);
+      void      _gt911ParsePoints(const uint8_t * pointsbuf, uint8_t contacts, GDTpoint_t * points);
+      void      _gt911onTimeout();
+      void      _startIrq();
+      void      _pushSample(uint8_t contacts, const GDTpoint_t * points);
+      bool      _lvglRead(uint16_t& x, uint16_t& y);
+
+#if __has_include ("lvgl.h")
+#if (LVGL_VERSION_MAJOR == 9)
+      friend void _lvglTouchCb(lv_indev_t * indev, lv_indev_data_t * data);
+#else
+      friend void _lvglTouchCb(lv_indev_drv_t * indev, lv_indev_data_t * data);
+#endif
+#endif
 };
 
 #endif /* __ARDUINO_GIGADISPLAYTOUCH_H */
\ No newline at end of file
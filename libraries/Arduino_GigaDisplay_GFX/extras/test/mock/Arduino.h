@@ -0,0 +1,24 @@
+/* Minimal Arduino API for the host test */
+#ifndef MOCK_ARDUINO_H
+#define MOCK_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Print.h"
+
+extern uint32_t mock_millis;
+
+inline uint32_t millis() { return mock_millis; }
+inline void delay(uint32_t ms) { mock_millis += ms; }
+
+#define PROGMEM
+
+template<class T, class L>
+auto min(const T& a, const L& b) -> decltype((b < a) ? b : a) { return (b < a) ? b : a; }
+template<class T, class L>
+auto max(const T& a, const L& b) -> decltype((b < a) ? b : a) { return (a < b) ? b : a; }
+
+#endif
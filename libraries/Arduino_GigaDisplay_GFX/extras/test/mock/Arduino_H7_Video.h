@@ -0,0 +1,16 @@
+/* Minimal display driver for the host test */
+#ifndef MOCK_ARDUINO_H7_VIDEO_H
+#define MOCK_ARDUINO_H7_VIDEO_H
+
+#include "Arduino.h"
+#include "mbed.h"
+
+#define GigaDisplayShield   0
+
+class Arduino_H7_Video {
+  public:
+    Arduino_H7_Video(int, int, int) { }
+    int begin() { return 0; }
+};
+
+#endif
@@ -0,0 +1,37 @@
+/* Minimal Print class for the host test */
+#ifndef MOCK_PRINT_H
+#define MOCK_PRINT_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+
+class __FlashStringHelper;
+
+class String : public std::string {
+  public:
+    String(const char *str = "") : std::string(str) { }
+};
+
+class Print {
+  public:
+    virtual ~Print() { }
+    virtual size_t write(uint8_t) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size) {
+        size_t n = 0;
+        while (size--) n += write(*buffer++);
+        return n;
+    }
+    size_t write(const char *str) { return write((const uint8_t *)str, strlen(str)); }
+    size_t print(const char *str) { return write(str); }
+    size_t print(long n) {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%ld", n);
+        return write(buf);
+    }
+    size_t print(int n) { return print((long)n); }
+};
+
+#endif
@@ -0,0 +1,9 @@
+/* SDRAM heap of the host test */
+#ifndef MOCK_SDRAM_H
+#define MOCK_SDRAM_H
+
+#include <stdlib.h>
+
+inline void *ea_malloc(size_t size) { return calloc(1, size); }
+
+#endif
@@ -0,0 +1,22 @@
+#include "dsi.h"
+#include "Arduino.h"
+
+uint32_t mock_millis;
+mock_dsi_stats_t mock_dsi_stats;
+uint16_t mock_frame_buffer[MOCK_LCD_X_SIZE * MOCK_LCD_Y_SIZE];
+
+void dsi_lcdDrawImage(void *pSrc, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t) {
+    const uint16_t *src = (const uint16_t *)pSrc;
+    uint16_t *dst = (uint16_t *)pDst;
+    for (uint32_t y = 0; y < ySize; y++) {
+        memcpy(dst, src, xSize * 2);
+        src += xSize;
+        dst += MOCK_LCD_X_SIZE;
+    }
+    mock_dsi_stats.transfers++;
+    mock_dsi_stats.bytes += xSize * ySize * 2;
+}
+
+void *dsi_getActiveFrameBuffer(void) {
+    return mock_frame_buffer;
+}
@@ -0,0 +1,24 @@
+/* Frame buffer of the host test. The transfers are counted. */
+#ifndef MOCK_DSI_H
+#define MOCK_DSI_H
+
+#include <stdint.h>
+
+#define DMA2D_INPUT_RGB565  2
+
+#define MOCK_LCD_X_SIZE     480
+#define MOCK_LCD_Y_SIZE     800
+
+struct mock_dsi_stats_t {
+    uint32_t transfers;
+    uint32_t bytes;
+};
+
+extern mock_dsi_stats_t mock_dsi_stats;
+extern uint16_t mock_frame_buffer[MOCK_LCD_X_SIZE * MOCK_LCD_Y_SIZE];
+
+/* Like the DMA2D: the source is contiguous, the destination lines are MOCK_LCD_X_SIZE apart */
+void dsi_lcdDrawImage(void *pSrc, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t ColorMode);
+void *dsi_getActiveFrameBuffer(void);
+
+#endif
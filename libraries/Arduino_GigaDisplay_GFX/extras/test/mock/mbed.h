@@ -0,0 +1,41 @@
+/* Minimal mbed OS API for the host test: the refresh thread is not started */
+#ifndef MOCK_MBED_H
+#define MOCK_MBED_H
+
+#include <stdint.h>
+
+#define osPriorityHigh  0
+
+namespace mbed {
+
+template<typename T>
+struct Callback {
+    T *obj;
+    void (T::*method)();
+};
+
+template<typename T>
+Callback<T> callback(T *obj, void (T::*method)()) {
+    return Callback<T>{obj, method};
+}
+
+}
+
+namespace rtos {
+
+class Thread {
+  public:
+    Thread(int) { }
+    template<typename T>
+    void start(mbed::Callback<T>) { }
+    uint32_t flags_set(uint32_t flags) { signals++; return flags; }
+    uint32_t signals = 0;
+};
+
+namespace ThisThread {
+inline uint32_t flags_wait_any(uint32_t flags) { return flags; }
+}
+
+}
+
+#endif
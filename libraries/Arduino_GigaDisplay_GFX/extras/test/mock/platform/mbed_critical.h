@@ -0,0 +1,8 @@
+/* Minimal mbed critical section for the host test */
+#ifndef MOCK_MBED_CRITICAL_H
+#define MOCK_MBED_CRITICAL_H
+
+inline void core_util_critical_section_enter(void) { }
+inline void core_util_critical_section_exit(void) { }
+
+#endif
@@ -0,0 +1,173 @@
+/*
+ * Host test of GigaDisplay_GFX with a simulated frame buffer.
+ * Checks that copying only the dirty areas gives the same screen as copying the
+ * whole buffer, and prints the bytes transferred for typical updates.
+ */
+
+#include <stdio.h>
+
+#include "Arduino_GigaDisplay_GFX.h"
+#include "test_common.h"
+
+#define FULL_FRAME_BYTES    (480 * 800 * 2)
+
+/* Runs the refresh of the refresh thread on demand */
+class TestGFX : public GigaDisplay_GFX {
+  public:
+    void update() {
+      endWrite();
+      refresh();
+    }
+    uint8_t dirtyCount() {
+      return dirty_cnt;
+    }
+};
+
+static TestGFX display;
+
+static bool screen_matches() {
+    return memcmp(display.getBuffer(), mock_frame_buffer, FULL_FRAME_BYTES) == 0;
+}
+
+static void stats_reset() {
+    mock_dsi_stats.transfers = 0;
+    mock_dsi_stats.bytes = 0;
+}
+
+static void report(const char *name) {
+    printf("%-28s %7u bytes %4u transfers  (%5.2f%% of a full frame)\n", name,
+           (unsigned)mock_dsi_stats.bytes, (unsigned)mock_dsi_stats.transfers,
+           100.0 * mock_dsi_stats.bytes / FULL_FRAME_BYTES);
+}
+
+/* 7-segment digit with 10 px thick segments in a 60x100 cell */
+static void draw_digit(int16_t x, int16_t y, uint8_t digit, uint16_t color) {
+    static const uint8_t segs[10] = {0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F};
+    uint8_t s = segs[digit];
+    display.fillRect(x, y, 60, 100, 0x0000);
+    if (s & 0x01) display.fillRect(x + 10, y, 40, 10, color);        /* a */
+    if (s & 0x02) display.fillRect(x + 50, y + 10, 10, 35, color);   /* b */
+    if (s & 0x04) display.fillRect(x + 50, y + 55, 10, 35, color);   /* c */
+    if (s & 0x08) display.fillRect(x + 10, y + 90, 40, 10, color);   /* d */
+    if (s & 0x10) display.fillRect(x, y + 55, 10, 35, color);        /* e */
+    if (s & 0x20) display.fillRect(x, y + 10, 10, 35, color);        /* f */
+    if (s & 0x40) display.fillRect(x + 10, y + 45, 40, 10, color);   /* g */
+}
+
+static void draw_readout(uint16_t value) {
+    for (int8_t i = 3; i >= 0; i--) {
+        draw_digit(40 + i * 70, 300, value % 10, 0xF800);
+        value /= 10;
+    }
+}
+
+static void draw_scene(uint8_t rotation) {
+    display.setRotation(rotation);
+    display.drawPixel(5, 7, 0x1234);
+    display.drawLine(10, 20, 200, 140, 0x07E0);
+    display.drawFastHLine(3, 300, 150, 0x001F);
+    display.drawFastVLine(400, 5, 250, 0xFFE0);
+    display.fillRect(100, 500, 80, 40, 0xF81F);
+    display.drawCircle(240, 400, 60, 0xFFFF);
+    display.fillTriangle(300, 600, 350, 700, 260, 720, 0x8410);
+    display.setCursor(20, 650);
+    display.setTextSize(2);
+    display.print("Hello");
+    display.setRotation(0);
+}
+
+static void test_partial_refresh_matches() {
+    for (uint8_t rotation = 0; rotation < 4; rotation++) {
+        draw_scene(rotation);
+        display.update();
+        CHECK(screen_matches());
+        CHECK(display.dirtyCount() == 0);
+    }
+
+    draw_readout(1234);
+    display.update();
+    draw_readout(1235);
+    display.update();
+    CHECK(screen_matches());
+
+    display.fillScreen(0x4208);
+    display.update();
+    CHECK(screen_matches());
+}
+
+static void test_pixels_merged_in_end_write() {
+    display.startWrite();
+    display.drawCircle(240, 400, 60, 0xFFFF);
+    display.drawPixel(5, 7, 0x1234);
+    CHECK(display.dirtyCount() == 0);
+    display.endWrite();
+    CHECK(display.dirtyCount() == 1);
+    display.update();
+    CHECK(screen_matches());
+}
+
+static void test_nothing_drawn() {
+    stats_reset();
+    display.update();
+    CHECK(mock_dsi_stats.bytes == 0);
+}
+
+static void bench() {
+    printf("\nBytes copied to the frame buffer per update (full frame: %u bytes)\n", FULL_FRAME_BYTES);
+
+    stats_reset();
+    display.drawPixel(100, 100, 0xFFFF);
+    display.update();
+    report("Single pixel");
+
+    draw_readout(1234);
+    display.update();
+    stats_reset();
+    draw_readout(1235);
+    display.update();
+    report("4 digit 7-segment readout");
+
+    stats_reset();
+    draw_digit(250, 300, 6, 0xF800);
+    display.update();
+    report("One 7-segment digit");
+
+    stats_reset();
+    display.setCursor(10, 100);
+    display.setTextSize(3);
+    display.print("Temp: 23.5 C");
+    display.update();
+    report("Line of text (size 3)");
+
+    stats_reset();
+    display.drawCircle(240, 600, 60, 0x07E0);
+    display.update();
+    report("Circle outline (r 60)");
+
+    stats_reset();
+    display.drawPixel(10, 10, 0xFFFF);
+    display.drawPixel(470, 790, 0xFFFF);
+    display.update();
+    report("Two far pixels");
+
+    stats_reset();
+    display.fillScreen(0x0000);
+    display.update();
+    report("fillScreen");
+
+    CHECK(screen_matches());
+}
+
+int main() {
+    display.begin();
+    CHECK(display.dirtyCount() == 1);
+    display.update();
+    CHECK(screen_matches());
+
+    test_partial_refresh_matches();
+    test_pixels_merged_in_end_write();
+    test_nothing_drawn();
+    bench();
+
+    return test_report();
+}
@@ -0,0 +1,143 @@
+/*
+ * Host test of the GigaDisplay_GFX raster primitives.
+ * The results are compared pixel by pixel with GFXcanvas16, which draws with the
+ * generic per-pixel Adafruit_GFX code, and the throughput of both is printed.
+ */
+
+#include <stdio.h>
+#include <chrono>
+
+#include "Arduino_GigaDisplay_GFX.h"
+#include "test_common.h"
+
+#define SCREEN_PIXELS   (480 * 800)
+
+static GigaDisplay_GFX display;
+static GFXcanvas16 canvas(480, 800);
+
+static uint16_t rgb_bitmap[70 * 45];
+static uint8_t mono_bitmap[((37 + 7) / 8) * 29];
+
+static uint32_t rand_state = 1;
+
+static int32_t rnd(int32_t min, int32_t max) {
+    rand_state = rand_state * 1103515245 + 12345;
+    return min + (int32_t)((rand_state >> 8) % (uint32_t)(max - min + 1));
+}
+
+static bool same_pixels() {
+    return memcmp(display.getBuffer(), canvas.getBuffer(), SCREEN_PIXELS * 2) == 0;
+}
+
+/* Draw the same random shapes, partially off screen too, with both */
+template<typename F>
+static void check_op(const char *name, F op) {
+    for (uint8_t rotation = 0; rotation < 4; rotation++) {
+        display.setRotation(rotation);
+        canvas.setRotation(rotation);
+        uint32_t seed = rand_state;
+        for (int i = 0; i < 200; i++) {
+            op(display);
+        }
+        rand_state = seed;
+        for (int i = 0; i < 200; i++) {
+            op(canvas);
+        }
+        if (!same_pixels()) {
+            printf("%s differs in rotation %u\n", name, rotation);
+            failures++;
+        }
+    }
+    display.setRotation(0);
+    canvas.setRotation(0);
+}
+
+static void test_pixel_exact() {
+    display.fillScreen(0x1234);
+    canvas.fillScreen(0x1234);
+    CHECK(same_pixels());
+
+    check_op("drawFastHLine", [](Adafruit_GFX &gfx) {
+        gfx.drawFastHLine(rnd(-50, 850), rnd(-50, 850), rnd(-100, 500), rnd(0, 0xFFFF));
+    });
+    check_op("drawFastVLine", [](Adafruit_GFX &gfx) {
+        gfx.drawFastVLine(rnd(-50, 850), rnd(-50, 850), rnd(-100, 500), rnd(0, 0xFFFF));
+    });
+    check_op("fillRect", [](Adafruit_GFX &gfx) {
+        gfx.fillRect(rnd(-50, 850), rnd(-50, 850), rnd(-20, 300), rnd(-20, 300), rnd(0, 0xFFFF));
+    });
+    check_op("fillCircle", [](Adafruit_GFX &gfx) {
+        gfx.fillCircle(rnd(-50, 850), rnd(-50, 850), rnd(0, 80), rnd(0, 0xFFFF));
+    });
+    check_op("drawRGBBitmap", [](Adafruit_GFX &gfx) {
+        gfx.drawRGBBitmap(rnd(-80, 850), rnd(-80, 850), rgb_bitmap, 70, 45);
+    });
+    check_op("drawBitmap", [](Adafruit_GFX &gfx) {
+        gfx.drawBitmap(rnd(-40, 850), rnd(-40, 850), mono_bitmap, 37, 29, rnd(0, 0xFFFF));
+    });
+    check_op("drawBitmap with bg", [](Adafruit_GFX &gfx) {
+        gfx.drawBitmap(rnd(-40, 850), rnd(-40, 850), mono_bitmap, 37, 29, rnd(0, 0xFFFF), rnd(0, 0xFFFF));
+    });
+
+    display.fillScreen(0xABCD);
+    canvas.fillScreen(0xABCD);
+    CHECK(same_pixels());
+}
+
+template<typename F>
+static double mpixels(Adafruit_GFX &gfx, uint32_t pixels_per_op, F op) {
+    uint32_t ops = 0;
+    auto start = std::chrono::steady_clock::now();
+    double s;
+    do {
+        for (int i = 0; i < 64; i++) {
+            op(gfx);
+        }
+        ops += 64;
+        s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (s < 0.05);
+    return (double)ops * pixels_per_op / s / 1e6;
+}
+
+template<typename F>
+static void bench_op(const char *name, uint32_t pixels_per_op, F op) {
+    printf("%-22s", name);
+    for (uint8_t rotation = 0; rotation < 4; rotation++) {
+        display.setRotation(rotation);
+        canvas.setRotation(rotation);
+        double old_mps = mpixels(canvas, pixels_per_op, op);
+        double new_mps = mpixels(display, pixels_per_op, op);
+        printf(" %7.1f %7.1f", old_mps, new_mps);
+    }
+    printf("\n");
+    display.setRotation(0);
+    canvas.setRotation(0);
+}
+
+static void bench() {
+    printf("\nMpixel/s per rotation (generic Adafruit_GFX, GigaDisplay_GFX)\n");
+    printf("%-22s", "");
+    for (int r = 0; r < 4; r++) printf("      rotation %d", r);
+    printf("\n");
+
+    bench_op("fillScreen", SCREEN_PIXELS, [](Adafruit_GFX &gfx) { gfx.fillScreen(0x1234); });
+    bench_op("fillRect 200x100", 200 * 100, [](Adafruit_GFX &gfx) { gfx.fillRect(13, 27, 200, 100, 0x4321); });
+    bench_op("drawFastHLine 300", 300, [](Adafruit_GFX &gfx) { gfx.drawFastHLine(7, 200, 300, 0x4321); });
+    bench_op("drawFastVLine 300", 300, [](Adafruit_GFX &gfx) { gfx.drawFastVLine(200, 7, 300, 0x4321); });
+    bench_op("drawRGBBitmap 70x45", 70 * 45, [](Adafruit_GFX &gfx) { gfx.drawRGBBitmap(31, 17, rgb_bitmap, 70, 45); });
+    bench_op("drawBitmap 37x29 bg", 37 * 29, [](Adafruit_GFX &gfx) {
+        gfx.drawBitmap(31, 17, mono_bitmap, 37, 29, 0xFFFF, 0x0000);
+    });
+}
+
+int main() {
+    for (uint32_t i = 0; i < sizeof(rgb_bitmap) / 2; i++) rgb_bitmap[i] = rnd(0, 0xFFFF);
+    for (uint32_t i = 0; i < sizeof(mono_bitmap); i++) mono_bitmap[i] = rnd(0, 0xFF);
+
+    display.begin();
+
+    test_pixel_exact();
+    bench();
+
+    return test_report();
+}
@@ -0,0 +1,157 @@
+/*
+ * Host test of the custom font rendering from the cached glyph runs.
+ * The result is compared pixel by pixel with the bit by bit drawing and the
+ * speed of both is printed.
+ */
+
+#include <stdio.h>
+#include <chrono>
+
+#include "Arduino_GigaDisplay_GFX.h"
+#include "test_common.h"
+#include "Fonts/FreeMono9pt7b.h"
+#include "Fonts/FreeSans24pt7b.h"
+#include "Fonts/FreeSerifBoldItalic12pt7b.h"
+
+#define SCREEN_PIXELS   (480 * 800)
+
+static GigaDisplay_GFX display;
+static GFXcanvas16 canvas(480, 800);
+
+static const char *text =
+    "The quick brown fox jumps over the lazy dog.\n"
+    "0123456789 !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~";
+
+static bool same_pixels() {
+    return memcmp(display.getBuffer(), canvas.getBuffer(), SCREEN_PIXELS * 2) == 0;
+}
+
+static void print_text(Adafruit_GFX &gfx, const GFXfont *font, uint8_t sx, uint8_t sy,
+                       uint8_t rotation, bool cache) {
+    gfx.fillScreen(0x0000);
+    gfx.setRotation(rotation);
+    gfx.setGlyphCache(cache);
+    gfx.setFont(font);
+    gfx.setTextSize(sx, sy);
+    gfx.setTextColor(0xFFE0);
+    gfx.setCursor(-7, 40);
+    gfx.print(text);
+    gfx.setRotation(0);
+}
+
+static void test_pixel_exact() {
+    const GFXfont *fonts[] = {&FreeMono9pt7b, &FreeSans24pt7b, &FreeSerifBoldItalic12pt7b};
+    const uint8_t sizes[][2] = {{1, 1}, {2, 3}};
+
+    for (const GFXfont *font : fonts) {
+        for (const uint8_t *size : sizes) {
+            for (uint8_t rotation = 0; rotation < 4; rotation++) {
+                print_text(display, font, size[0], size[1], rotation, true);
+                print_text(canvas, font, size[0], size[1], rotation, false);
+                if (!same_pixels()) {
+                    printf("Text differs: font %u, size %ux%u, rotation %u\n",
+                           (unsigned)(font - fonts[0]), size[0], size[1], rotation);
+                    failures++;
+                }
+            }
+        }
+    }
+    display.setGlyphCache(true);
+}
+
+/* More fonts than GFX_GLYPH_CACHE_FONTS with different glyph counts replace each other in the cache */
+static void test_font_eviction() {
+    GFXfont digits = FreeMono9pt7b;
+    digits.last = '9';
+    GFXfont upper = FreeSerifBoldItalic12pt7b;
+    upper.last = 'Z';
+    const GFXfont *fonts[] = {&digits, &FreeSans24pt7b, &upper, &FreeMono9pt7b};
+    CHECK(sizeof(fonts) / sizeof(fonts[0]) > GFX_GLYPH_CACHE_FONTS);
+
+    for (uint8_t round = 0; round < 3; round++) {
+        for (const GFXfont *font : fonts) {
+            print_text(display, font, 1, 1, 0, true);
+            print_text(canvas, font, 1, 1, 0, false);
+            CHECK(same_pixels());
+        }
+    }
+    display.setFont();
+    canvas.setFont();
+}
+
+/* A changing number is redrawn in place */
+static void test_bg_fill() {
+    display.setFont(&FreeSans24pt7b);
+    display.setTextSize(1);
+    display.setTextColor(0xFFFF, 0x001F);
+    display.setTextBgFill(true);
+
+    canvas.fillScreen(0xF800);
+    canvas.fillRect(20, 100, 200, 60, 0x001F);
+    canvas.setFont(&FreeSans24pt7b);
+    canvas.setTextSize(1);
+    canvas.setTextColor(0xFFFF);
+    canvas.setCursor(40, 140);
+    canvas.print("1147");
+
+    display.fillScreen(0xF800);
+    display.fillRect(20, 100, 200, 60, 0x001F);
+    display.setCursor(40, 140);
+    display.print("8888");
+    display.setCursor(40, 140);
+    display.print("1147");
+    CHECK(same_pixels());
+
+    display.setTextBgFill(false);
+    display.setFont();
+}
+
+template<typename F>
+static double us_per_call(F op) {
+    uint32_t calls = 0;
+    auto start = std::chrono::steady_clock::now();
+    double s;
+    do {
+        op();
+        calls++;
+        s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (s < 0.1);
+    return s * 1e6 / calls;
+}
+
+static void bench_font(const char *name, const GFXfont *font, uint8_t size) {
+    const char *line = "Temperature: 23.5 C";
+    display.setFont(font);
+    display.setTextSize(size);
+    display.setTextColor(0xFFFF);
+
+    double t[2];
+    for (int cache = 0; cache < 2; cache++) {
+        display.setGlyphCache(cache);
+        t[cache] = us_per_call([line]() {
+            display.setCursor(0, 100);
+            display.print(line);
+        });
+    }
+    printf("%-26s %9.1f us %9.1f us  %5.1fx\n", name, t[0], t[1], t[0] / t[1]);
+}
+
+static void bench() {
+    printf("\nPrinting \"Temperature: 23.5 C\"     bit by bit   cached runs\n");
+    bench_font("FreeMono9pt7b", &FreeMono9pt7b, 1);
+    bench_font("FreeSans24pt7b", &FreeSans24pt7b, 1);
+    bench_font("FreeSans24pt7b size 2", &FreeSans24pt7b, 2);
+    bench_font("FreeSerifBoldItalic12pt7b", &FreeSerifBoldItalic12pt7b, 1);
+    display.setFont();
+}
+
+int main() {
+    display.begin();
+
+    test_pixel_exact();
+    test_font_eviction();
+    test_bg_fill();
+    bench();
+
+    return test_report();
+}
@@ -2,6 +2,48 @@
 #include "Arduino_GigaDisplay_GFX.h"
 #include "platform/mbed_critical.h"
 
+typedef uint32_t __attribute__((__may_alias__)) pixel2_t;
+typedef uint64_t __attribute__((__may_alias__)) pixel4_t;
+
+// Fill n pixels with aligned 64-bit stores (4 RGB565 pixels each)
+static inline void fillPixels(uint16_t *dst, uint32_t n, uint16_t color) {
+  if (n == 0)
+    return;
+
+  if ((uintptr_t)dst & 2) {
+    *dst++ = color;
+    n--;
+  }
+  uint32_t color2 = color | ((uint32_t)color << 16);
+  if (((uintptr_t)dst & 4) && n >= 2) {
+    *(pixel2_t *)dst = color2;
+    dst += 2;
+    n -= 2;
+  }
+
+  uint64_t color4 = color2 | ((uint64_t)color2 << 32);
+  pixel4_t *dst4 = (pixel4_t *)dst;
+  for (; n >= 16; n -= 16) {
+    dst4[0] = color4;
+    dst4[1] = color4;
+    dst4[2] = color4;
+    dst4[3] = color4;
+    dst4 += 4;
+  }
+  for (; n >= 4; n -= 4) {
+    *dst4++ = color4;
+  }
+
+  dst = (uint16_t *)dst4;
+  if (n >= 2) {
+    *(pixel2_t *)dst = color2;
+    dst += 2;
+    n -= 2;
+  }
+  if (n)
+    *dst = color;
+}
+
 GigaDisplay_GFX::GigaDisplay_GFX() : Adafruit_GFX(480, 800) {
 
 }
@@ -16,19 +58,117 @@ GigaDisplay_GFX::~GigaDisplay_GFX(void) {
 void GigaDisplay_GFX::refresh_if_needed() {
   while (1) {
     rtos::ThisThread::flags_wait_any(0x1);
-    //refresh_sem.acquire();
-    dsi_lcdDrawImage((void *) this->getBuffer(), (void *)(dsi_getActiveFrameBuffer()), 480, 800, DMA2D_INPUT_RGB565);
-    //dsi_lcdDrawImage((void *) this->getBuffer(), (void *)(dsi_getActiveFrameBuffer()), this->width(), this->height(), DMA2D_INPUT_RGB565);
-    //refresh_sem.release();
-    delay(10);
+    // Cap the frame rate; what is drawn meanwhile is copied in the same refresh
+    uint32_t elapsed = millis() - last_refresh;
+    if (elapsed < 1000 / GIGADISPLAY_GFX_MAX_FPS) {
+      delay(1000 / GIGADISPLAY_GFX_MAX_FPS - elapsed);
+    }
+    last_refresh = millis();
+    refresh();
+  }
+}
+
+void GigaDisplay_GFX::refresh() {
+  DirtyRect rects[GIGADISPLAY_GFX_DIRTY_RECTS];
+  uint8_t cnt;
+
+  core_util_critical_section_enter();
+  cnt = dirty_cnt;
+  memcpy(rects, dirty, cnt * sizeof(DirtyRect));
+  dirty_cnt = 0;
+  core_util_critical_section_exit();
+
+  uint16_t *fb = (uint16_t *)dsi_getActiveFrameBuffer();
+  for (uint8_t i = 0; i < cnt; i++) {
+    int16_t w = rects[i].x2 - rects[i].x1 + 1;
+    int16_t h = rects[i].y2 - rects[i].y1 + 1;
+    if ((uint32_t)WIDTH * h + GIGADISPLAY_GFX_TRANSFER_COST <= ((uint32_t)w + GIGADISPLAY_GFX_TRANSFER_COST) * h) {
+      // Whole rows are contiguous in both buffers: one transfer
+      uint32_t offset = rects[i].y1 * WIDTH;
+      dsi_lcdDrawImage((void *)(buffer + offset), (void *)(fb + offset), WIDTH, h, DMA2D_INPUT_RGB565);
+    } else {
+      // The DMA2D source has no line offset, so narrow areas are copied row by row
+      for (int16_t y = rects[i].y1; y <= rects[i].y2; y++) {
+        uint32_t offset = y * WIDTH + rects[i].x1;
+        dsi_lcdDrawImage((void *)(buffer + offset), (void *)(fb + offset), w, 1, DMA2D_INPUT_RGB565);
+      }
+    }
   }
 }
 
+// Pixels copied plus the transfers: row by row, or whole rows at once
+static uint32_t refreshCost(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t width) {
+  uint32_t w = x2 - x1 + 1;
+  uint32_t h = y2 - y1 + 1;
+  uint32_t rows = (w + GIGADISPLAY_GFX_TRANSFER_COST) * h;
+  uint32_t band = width * h + GIGADISPLAY_GFX_TRANSFER_COST;
+  return rows < band ? rows : band;
+}
+
+void GigaDisplay_GFX::markRawDirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (w <= 0 || h <= 0)
+    return;
+
+  DirtyRect r = {x, y, (int16_t)(x + w - 1), (int16_t)(y + h - 1)};
+
+  core_util_critical_section_enter();
+
+  // Merge with the rects where copying the union is not more expensive than the two apart,
+  // e.g. touching or overlapping areas like the columns of a fillRect
+  uint8_t i = 0;
+  while (i < dirty_cnt) {
+    DirtyRect &d = dirty[i];
+    if (r.x1 >= d.x1 && r.y1 >= d.y1 && r.x2 <= d.x2 && r.y2 <= d.y2) {
+      core_util_critical_section_exit();
+      return; // Already dirty
+    }
+    DirtyRect u = {min(d.x1, r.x1), min(d.y1, r.y1), max(d.x2, r.x2), max(d.y2, r.y2)};
+    if (refreshCost(u.x1, u.y1, u.x2, u.y2, WIDTH) <=
+        refreshCost(d.x1, d.y1, d.x2, d.y2, WIDTH) + refreshCost(r.x1, r.y1, r.x2, r.y2, WIDTH)) {
+      // The union may reach other rects too, so check them again
+      r = u;
+      dirty[i] = dirty[--dirty_cnt];
+      i = 0;
+    } else {
+      i++;
+    }
+  }
+
+  if (dirty_cnt < GIGADISPLAY_GFX_DIRTY_RECTS) {
+    dirty[dirty_cnt++] = r;
+  } else {
+    // No free slot: merge with the rect which grows the least
+    uint8_t best = 0;
+    uint32_t best_growth = UINT32_MAX;
+    for (i = 0; i < dirty_cnt; i++) {
+      DirtyRect &d = dirty[i];
+      uint32_t growth = refreshCost(min(d.x1, r.x1), min(d.y1, r.y1), max(d.x2, r.x2), max(d.y2, r.y2), WIDTH) -
+                        refreshCost(d.x1, d.y1, d.x2, d.y2, WIDTH);
+      if (growth < best_growth) {
+        best_growth = growth;
+        best = i;
+      }
+    }
+    DirtyRect &d = dirty[best];
+    d.x1 = min(d.x1, r.x1);
+    d.y1 = min(d.y1, r.y1);
+    d.x2 = max(d.x2, r.x2);
+    d.y2 = max(d.y2, r.y2);
+  }
+
+  core_util_critical_section_exit();
+}
+
+void GigaDisplay_GFX::markDirty(void) {
+  markRawDirty(0, 0, WIDTH, HEIGHT);
+}
+
 
 void GigaDisplay_GFX::begin() {
     display = new Arduino_H7_Video(480, 800, GigaDisplayShield);
     display->begin();
     buffer = (uint16_t*)ea_malloc(this->width() * this-> height() * 2);
+    markDirty();
     _refresh_thd = new rtos::Thread(osPriorityHigh);
     _refresh_thd->start(mbed::callback(this, &GigaDisplay_GFX::refresh_if_needed));
     //buffer = (uint16_t*)dsi_getActiveFrameBuffer();
@@ -36,11 +176,22 @@ void GigaDisplay_GFX::begin() {
 
 void GigaDisplay_GFX::startWrite() {
   //refresh_sem.acquire();
+  write_depth++;
 }
 
 void GigaDisplay_GFX::endWrite() {
   //refresh_sem.release();
-  _refresh_thd->flags_set(0x1);
+  if (write_depth > 0 && --write_depth > 0)
+    return;
+
+  if (has_dirty_pixels) {
+    has_dirty_pixels = false;
+    markRawDirty(dirty_pixels.x1, dirty_pixels.y1, dirty_pixels.x2 - dirty_pixels.x1 + 1,
+                 dirty_pixels.y2 - dirty_pixels.y1 + 1);
+  }
+  if (dirty_cnt > 0) {
+    _refresh_thd->flags_set(0x1);
+  }
 }
 
 void GigaDisplay_GFX::drawPixel(int16_t x, int16_t y, uint16_t color) {
@@ -67,6 +218,17 @@ void GigaDisplay_GFX::drawPixel(int16_t x, int16_t y, uint16_t color) {
     }
 
     buffer[x + y * WIDTH] = color;
+    if (write_depth == 0) {
+      markRawDirty(x, y, 1, 1);
+    } else if (!has_dirty_pixels) {
+      dirty_pixels = {x, y, x, y};
+      has_dirty_pixels = true;
+    } else {
+      dirty_pixels.x1 = min(dirty_pixels.x1, x);
+      dirty_pixels.y1 = min(dirty_pixels.y1, y);
+      dirty_pixels.x2 = max(dirty_pixels.x2, x);
+      dirty_pixels.y2 = max(dirty_pixels.y2, y);
+    }
   }
 }
 
@@ -106,10 +268,9 @@ void GigaDisplay_GFX::fillScreen(uint16_t color) {
     if (hi == lo) {
       memset(buffer, lo, WIDTH * HEIGHT * 2);
     } else {
-      uint32_t i, pixels = WIDTH * HEIGHT;
-      for (i = 0; i < pixels; i++)
-        buffer[i] = color;
+      fillPixels(buffer, WIDTH * HEIGHT, color);
     }
+    markDirty();
   }
 }
 
@@ -118,6 +279,7 @@ void GigaDisplay_GFX::byteSwap(void) {
     uint32_t i, pixels = WIDTH * HEIGHT;
     for (i = 0; i < pixels; i++)
       buffer[i] = __builtin_bswap16(buffer[i]);
+    markDirty();
   }
 }
 
@@ -217,17 +379,228 @@ void GigaDisplay_GFX::drawFastRawVLine(int16_t x, int16_t y, int16_t h,
                                        uint16_t color) {
   // x & y already in raw (rotation 0) coordinates, no need to transform.
   uint16_t *buffer_ptr = buffer + y * WIDTH + x;
-  for (int16_t i = 0; i < h; i++) {
+  int16_t i = h;
+  for (; i >= 4; i -= 4) {
+    buffer_ptr[0] = color;
+    buffer_ptr[WIDTH] = color;
+    buffer_ptr[2 * WIDTH] = color;
+    buffer_ptr[3 * WIDTH] = color;
+    buffer_ptr += 4 * WIDTH;
+  }
+  for (; i > 0; i--) {
     (*buffer_ptr) = color;
     buffer_ptr += WIDTH;
   }
+  markRawDirty(x, y, 1, h);
 }
 
 void GigaDisplay_GFX::drawFastRawHLine(int16_t x, int16_t y, int16_t w,
                                        uint16_t color) {
   // x & y already in raw (rotation 0) coordinates, no need to transform.
-  uint32_t buffer_index = y * WIDTH + x;
-  for (uint32_t i = buffer_index; i < buffer_index + w; i++) {
-    buffer[i] = color;
+  fillPixels(buffer + y * WIDTH + x, w, color);
+  markRawDirty(x, y, w, 1);
+}
+
+// Clip a rect to the rotated screen. Returns false if nothing is visible.
+bool GigaDisplay_GFX::clipRect(int16_t &x, int16_t &y, int16_t &w, int16_t &h) {
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (x + w > width())
+    w = width() - x;
+  if (y + h > height())
+    h = height() - y;
+  return (w > 0) && (h > 0);
+}
+
+// The same area in raw (rotation 0) coordinates
+void GigaDisplay_GFX::rawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                              int16_t &rx, int16_t &ry, int16_t &rw, int16_t &rh) {
+  switch (rotation) {
+    default: // setRotation() keeps it 0..3
+    case 0:
+      rx = x;
+      ry = y;
+      rw = w;
+      rh = h;
+      break;
+    case 1:
+      rx = WIDTH - y - h;
+      ry = x;
+      rw = h;
+      rh = w;
+      break;
+    case 2:
+      rx = WIDTH - x - w;
+      ry = HEIGHT - y - h;
+      rw = w;
+      rh = h;
+      break;
+    case 3:
+      rx = y;
+      ry = HEIGHT - x - w;
+      rw = h;
+      rh = w;
+      break;
+  }
+}
+
+// Address of the rotated (x, y) pixel and the steps in the buffer for x+1 and y+1
+void GigaDisplay_GFX::rawSteps(int16_t x, int16_t y, uint16_t *&dst, int32_t &dx, int32_t &dy) {
+  switch (rotation) {
+    default: // setRotation() keeps it 0..3
+    case 0:
+      dst = buffer + y * WIDTH + x;
+      dx = 1;
+      dy = WIDTH;
+      break;
+    case 1:
+      dst = buffer + x * WIDTH + (WIDTH - 1 - y);
+      dx = WIDTH;
+      dy = -1;
+      break;
+    case 2:
+      dst = buffer + (HEIGHT - 1 - y) * WIDTH + (WIDTH - 1 - x);
+      dx = -1;
+      dy = -WIDTH;
+      break;
+    case 3:
+      dst = buffer + (HEIGHT - 1 - x) * WIDTH + y;
+      dx = -WIDTH;
+      dy = 1;
+      break;
   }
 }
+
+void GigaDisplay_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                               uint16_t color) {
+  if (!hasBuffer() || w <= 0)
+    return;
+  if (h < 0) { // Convert negative heights to positive equivalent
+    h *= -1;
+    y -= h - 1;
+  }
+  if (!clipRect(x, y, w, h))
+    return;
+
+  // Fill the rows of the buffer, whatever the rotation is
+  int16_t rx, ry, rw, rh;
+  rawRect(x, y, w, h, rx, ry, rw, rh);
+
+  startWrite();
+  uint16_t *row = buffer + ry * WIDTH + rx;
+  for (int16_t i = 0; i < rh; i++) {
+    fillPixels(row, rw, color);
+    row += WIDTH;
+  }
+  markRawDirty(rx, ry, rw, rh);
+  endWrite();
+}
+
+void GigaDisplay_GFX::drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[],
+                                    int16_t w, int16_t h) {
+  if (!hasBuffer())
+    return;
+
+  int16_t bw = w;
+  int16_t cx = x, cy = y;
+  if (!clipRect(cx, cy, w, h))
+    return;
+  bitmap += (cy - y) * bw + (cx - x);
+
+  uint16_t *dst;
+  int32_t dx, dy;
+  rawSteps(cx, cy, dst, dx, dy);
+
+  startWrite();
+  for (int16_t j = 0; j < h; j++) {
+    if (dx == 1) {
+      memcpy(dst, bitmap, w * 2);
+    } else {
+      uint16_t *d = dst;
+      for (int16_t i = 0; i < w; i++) {
+        *d = bitmap[i];
+        d += dx;
+      }
+    }
+    bitmap += bw;
+    dst += dy;
+  }
+
+  int16_t rx, ry, rw, rh;
+  rawRect(cx, cy, w, h, rx, ry, rw, rh);
+  markRawDirty(rx, ry, rw, rh);
+  endWrite();
+}
+
+void GigaDisplay_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                                 int16_t w, int16_t h, uint16_t color) {
+  if (!hasBuffer())
+    return;
+
+  int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
+  int16_t cx = x, cy = y;
+  if (!clipRect(cx, cy, w, h))
+    return;
+  int16_t skip = cx - x;
+  bitmap += (cy - y) * byteWidth;
+
+  uint16_t *dst;
+  int32_t dx, dy;
+  rawSteps(cx, cy, dst, dx, dy);
+
+  startWrite();
+  for (int16_t j = 0; j < h; j++) {
+    uint16_t *d = dst;
+    for (int16_t i = skip; i < skip + w; i++) {
+      if (bitmap[i >> 3] & (0x80 >> (i & 7)))
+        *d = color;
+      d += dx;
+    }
+    bitmap += byteWidth;
+    dst += dy;
+  }
+
+  int16_t rx, ry, rw, rh;
+  rawRect(cx, cy, w, h, rx, ry, rw, rh);
+  markRawDirty(rx, ry, rw, rh);
+  endWrite();
+}
+
+void GigaDisplay_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                                 int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+  if (!hasBuffer())
+    return;
+
+  int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
+  int16_t cx = x, cy = y;
+  if (!clipRect(cx, cy, w, h))
+    return;
+  int16_t skip = cx - x;
+  bitmap += (cy - y) * byteWidth;
+
+  uint16_t *dst;
+  int32_t dx, dy;
+  rawSteps(cx, cy, dst, dx, dy);
+
+  startWrite();
+  for (int16_t j = 0; j < h; j++) {
+    uint16_t *d = dst;
+    for (int16_t i = skip; i < skip + w; i++) {
+      *d = (bitmap[i >> 3] & (0x80 >> (i & 7))) ? color : bg;
+      d += dx;
+    }
+    bitmap += byteWidth;
+    dst += dy;
+  }
+
+  int16_t rx, ry, rw, rh;
+  rawRect(cx, cy, w, h, rx, ry, rw, rh);
+  markRawDirty(rx, ry, rw, rh);
+  endWrite();
+}
@@ -8,6 +8,22 @@
 #include "dsi.h"
 #include "SDRAM.h"
 
+// Number of separate dirty rectangles kept before merging the closest ones
+#ifndef GIGADISPLAY_GFX_DIRTY_RECTS
+#define GIGADISPLAY_GFX_DIRTY_RECTS 8
+#endif
+
+// Cost of starting a DMA2D transfer, in pixels copied. Rects are merged or widened to
+// full rows when it saves more transfers than the extra pixels cost.
+#ifndef GIGADISPLAY_GFX_TRANSFER_COST
+#define GIGADISPLAY_GFX_TRANSFER_COST 128
+#endif
+
+// The display is refreshed at most this many times per second
+#ifndef GIGADISPLAY_GFX_MAX_FPS
+#define GIGADISPLAY_GFX_MAX_FPS 60
+#endif
+
 class GigaDisplay_GFX : public Adafruit_GFX {
   public:
     GigaDisplay_GFX();
@@ -18,6 +34,22 @@ class GigaDisplay_GFX : public Adafruit_GFX {
     void byteSwap(void);
     void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
     void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+    using Adafruit_GFX::drawBitmap;
+    void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color);
+    void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg);
+    void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color) {
+      drawBitmap(x, y, (const uint8_t *)bitmap, w, h, color);
+    }
+    void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+      drawBitmap(x, y, (const uint8_t *)bitmap, w, h, color, bg);
+    }
+    using Adafruit_GFX::drawRGBBitmap;
+    void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h);
+    void drawRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w, int16_t h) {
+      drawRGBBitmap(x, y, (const uint16_t *)bitmap, w, h);
+    }
     uint16_t getPixel(int16_t x, int16_t y);
     uint16_t *getBuffer(void) {
       return buffer;
@@ -32,6 +64,9 @@ class GigaDisplay_GFX : public Adafruit_GFX {
     void startWrite();
     void endWrite();
 
+    // Refresh the whole screen with the next endWrite(), e.g. after writing getBuffer() directly
+    void markDirty(void);
+
     uint16_t color565(uint8_t red, uint8_t green, uint8_t blue) {
       return ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3);
     }
@@ -40,8 +75,25 @@ class GigaDisplay_GFX : public Adafruit_GFX {
     uint16_t getRawPixel(int16_t x, int16_t y);
     void drawFastRawVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
     void drawFastRawHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    bool clipRect(int16_t &x, int16_t &y, int16_t &w, int16_t &h);
+    void rawRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t &rx, int16_t &ry, int16_t &rw, int16_t &rh);
+    void rawSteps(int16_t x, int16_t y, uint16_t *&dst, int32_t &dx, int32_t &dy);
     uint16_t *buffer = nullptr; ///< Raster data: no longer private, allow subclass access
 
+    // Only the changed areas of the buffer are copied to the display
+    struct DirtyRect {
+      int16_t x1, y1, x2, y2; ///< Inclusive, in raw (rotation 0) coordinates
+    };
+    void markRawDirty(int16_t x, int16_t y, int16_t w, int16_t h);
+    void refresh();
+    DirtyRect dirty[GIGADISPLAY_GFX_DIRTY_RECTS];
+    uint8_t dirty_cnt = 0;
+    // Between startWrite() and endWrite() drawPixel() only grows a bounding box, which is merged
+    // into the dirty rects by the outermost endWrite()
+    DirtyRect dirty_pixels;
+    bool has_dirty_pixels = false;
+    uint8_t write_depth = 0;
+
   private:
     Arduino_H7_Video* display;
     void refresh_if_needed();
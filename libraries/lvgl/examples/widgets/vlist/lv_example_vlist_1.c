@@ -0,0 +1,32 @@
+#include "../../lv_examples.h"
+#if LV_USE_VLIST && LV_BUILD_EXAMPLES
+
+static void cell_cb(lv_obj_t * obj, uint32_t row, uint16_t col, char * buf, uint32_t buf_size)
+{
+    LV_UNUSED(obj);
+    if(col == 0) lv_snprintf(buf, buf_size, "Log entry %d", (int)row);
+    else lv_snprintf(buf, buf_size, "%d.%d s", (int)(row / 10), (int)(row % 10));
+}
+
+static void event_handler(lv_event_t * e)
+{
+    lv_obj_t * obj = lv_event_get_target(e);
+    LV_LOG_USER("Row %d selected", (int)lv_vlist_get_selected_row(obj));
+}
+
+/**
+ * A log with 100000 entries. Only the visible rows are created.
+ */
+void lv_example_vlist_1(void)
+{
+    lv_obj_t * vlist = lv_vlist_create(lv_scr_act());
+    lv_obj_set_size(vlist, 260, 200);
+    lv_obj_center(vlist);
+    lv_vlist_set_col_cnt(vlist, 2);
+    lv_vlist_set_col_width(vlist, 1, 80);
+    lv_vlist_set_cell_cb(vlist, cell_cb);
+    lv_vlist_set_row_cnt(vlist, 100000);
+    lv_obj_add_event_cb(vlist, event_handler, LV_EVENT_VALUE_CHANGED, NULL);
+}
+
+#endif
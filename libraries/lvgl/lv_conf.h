@@ -46,7 +46,7 @@
  *=========================*/
 
 /*1: use custom malloc/free, 0: use the built-in `lv_mem_alloc()` and `lv_mem_free()`*/
-#define LV_MEM_CUSTOM 1
+#define LV_MEM_CUSTOM 0
 #if LV_MEM_CUSTOM == 0
     /*Size of the memory available for `lv_mem_alloc()` in bytes (>= 2kB)*/
     #define LV_MEM_SIZE (256U * 1024U) //#define LV_MEM_SIZE (48U * 1024U)          /*[bytes]*/
@@ -55,10 +55,15 @@
     #define LV_MEM_ADR 0     /*0: unused*/
     /*Instead of an address give a memory allocator that will be called to get a memory pool for LVGL. E.g. my_malloc*/
     #if LV_MEM_ADR == 0
+        /*Not in the SDRAM of the GIGA R1: the display driver of the core calls `lv_init()` before `SDRAM.begin()`*/
         #undef LV_MEM_POOL_INCLUDE
         #undef LV_MEM_POOL_ALLOC
     #endif
 
+    /*Reserve this many bytes of the pool for fixed size blocks of the small allocations (objects, style lists,
+     *short strings, etc.). They are grouped by size in pages which reduces the fragmentation of the pool. 0: unused*/
+    #define LV_MEM_SLAB_SIZE (64U * 1024U)
+
 #else       /*LV_MEM_CUSTOM*/
     #define LV_MEM_CUSTOM_INCLUDE <stdlib.h>   /*Header for the dynamic memory function*/
     #define LV_MEM_CUSTOM_ALLOC   malloc
@@ -83,6 +88,10 @@
 /*Input device read period in milliseconds*/
 #define LV_INDEV_DEF_READ_PERIOD 30     /*[ms]*/
 
+/*Keep the timers in a heap ordered by their next run instead of checking all of them in every `lv_timer_handler()` call.
+ *The next timer to run and the time until it are known without walking the list.*/
+#define LV_TIMER_HEAP 1
+
 /*Use a custom tick source that tells the elapsed time in milliseconds.
  *It removes the need to manually update the tick with `lv_tick_inc()`)*/
 #define LV_TICK_CUSTOM 1
@@ -114,13 +123,13 @@
     /*Allow buffering some shadow calculation.
     *LV_SHADOW_CACHE_SIZE is the max. shadow size to buffer, where shadow size is `shadow_width + radius`
     *Caching has LV_SHADOW_CACHE_SIZE^2 RAM cost*/
-    #define LV_SHADOW_CACHE_SIZE 0
+    #define LV_SHADOW_CACHE_SIZE 64
 
     /* Set number of maximally cached circle data.
     * The circumference of 1/4 circle are saved for anti-aliasing
     * radius * 4 bytes are used per circle (the most often used radiuses are saved)
     * 0: to disable caching */
-    #define LV_CIRCLE_CACHE_SIZE 4
+    #define LV_CIRCLE_CACHE_SIZE 16
 #endif /*LV_DRAW_COMPLEX*/
 
 /**
@@ -139,12 +148,18 @@
 #define LV_LAYER_SIMPLE_BUF_SIZE          (24 * 1024)
 #define LV_LAYER_SIMPLE_FALLBACK_BUF_SIZE (3 * 1024)
 
+/*Size of an arena in bytes for the short living allocations of a refresh (layers, temporary draw buffers).
+ *They are taken from it one after the other and all are given back at once when the refresh ends.
+ *Larger requests and the requests out of a refresh use `lv_mem_alloc()`.
+ *See `lv_draw_arena_get_stats()` for the usage per refresh. 0: not used*/
+#define LV_DRAW_ARENA_SIZE (48 * 1024)
+
 /*Default image cache size. Image caching keeps the images opened.
  *If only the built-in image formats are used there is no real advantage of caching. (I.e. if no new image decoder is added)
  *With complex image decoders (e.g. PNG or JPG) caching can save the continuous open/decode of images.
  *However the opened images might consume additional RAM.
  *0: to disable caching*/
-#define LV_IMG_CACHE_DEF_SIZE 0
+#define LV_IMG_CACHE_DEF_SIZE 8
 
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
@@ -168,6 +183,22 @@
     #define LV_DITHER_ERROR_DIFFUSION 0
 #endif
 
+/*Shared memory budget of the image, gradient, shadow and circle caches in bytes.
+ *When a new item doesn't fit, the least recently used items of any of these caches are dropped.
+ *With a budget the gradients and shadows are cached one by one: `LV_GRAD_CACHE_DEF_SIZE` is not used,
+ *`LV_SHADOW_CACHE_SIZE` limits only the size of one shadow and the circles are kept between the frames.
+ *Can be changed with `lv_draw_cache_set_budget()`. 0: no shared budget*/
+#define LV_DRAW_CACHE_BUDGET (512U * 1024U)
+#if LV_DRAW_CACHE_BUDGET
+    /*1: Allocate the cached gradients and shadows with a custom function, e.g. in external RAM*/
+    #define LV_DRAW_CACHE_MEM_CUSTOM 1   /*In the SDRAM of the GIGA R1 (`SDRAM.begin()` is called by the display)*/
+    #if LV_DRAW_CACHE_MEM_CUSTOM
+        #define LV_DRAW_CACHE_MEM_CUSTOM_INCLUDE "ea_malloc.h"
+        #define LV_DRAW_CACHE_MEM_CUSTOM_ALLOC   ea_malloc
+        #define LV_DRAW_CACHE_MEM_CUSTOM_FREE    ea_free
+    #endif
+#endif
+
 /*Maximum buffer size to allocate for rotation.
  *Only used if software rotation is enabled in the display driver.*/
 #define LV_DISP_ROT_MAX_BUF (10*1024)
@@ -180,11 +211,22 @@
 #define LV_USE_GPU_ARM2D 0
 
 /*Use STM32's DMA2D (aka Chrom Art) GPU*/
-#define LV_USE_GPU_STM32_DMA2D 0
+#define LV_USE_GPU_STM32_DMA2D 1
 #if LV_USE_GPU_STM32_DMA2D
     /*Must be defined to include path of CMSIS header of target processor
     e.g. "stm32f7xx.h" or "stm32f4xx.h"*/
-    #define LV_GPU_DMA2D_CMSIS_INCLUDE
+    #define LV_GPU_DMA2D_CMSIS_INCLUDE "stm32h7xx.h"
+
+    /*1: Other code uses the DMA2D too, e.g. the display driver's flush.
+     *Before touching the DMA2D registers LVGL waits until the transfer of the other code is finished
+     *and its interrupt is handled, else the interrupt enable bit and flags of that transfer were cleared.
+     *0 here: the display driver of the GIGA core finishes its transfers before returning and has no wait hook*/
+    #define LV_GPU_DMA2D_SHARED 0
+    #if LV_GPU_DMA2D_SHARED
+        /*Header of the wait function and the expression waiting for the other code's transfer*/
+        #define LV_GPU_DMA2D_SHARED_INCLUDE "dsi_transfer.h"   /*E.g. Arduino GIGA Display*/
+        #define LV_GPU_DMA2D_SHARED_WAIT_EXPR dsi_waitTransfer()
+    #endif
 #endif
 
 /*Enable RA6M3 G2D GPU*/
@@ -291,9 +333,38 @@
     #define LV_USE_MEM_MONITOR_POS LV_ALIGN_BOTTOM_LEFT
 #endif
 
+/*1: Collect per-frame render/flush times, redrawn area and draw call counts.
+ *Read them with `lv_perf_stats_get()`, `lv_perf_stats_to_json()` or show them with `lv_perf_stats_set_overlay(true)`*/
+#define LV_USE_PERF_STATS 1
+#if LV_USE_PERF_STATS
+    /*Number of frames in the rolling window of the averages and histograms*/
+    #define LV_PERF_STATS_HISTORY 64
+    #define LV_PERF_STATS_OVERLAY_POS LV_ALIGN_TOP_LEFT
+
+    /*Use a custom microsecond time source. If 0 `lv_tick_get()` is used with 1 ms resolution*/
+    #define LV_PERF_STATS_TIME_CUSTOM 1
+    #if LV_PERF_STATS_TIME_CUSTOM
+        #define LV_PERF_STATS_TIME_CUSTOM_INCLUDE "Arduino.h"         /*Header for the system time function*/
+        #define LV_PERF_STATS_TIME_CUSTOM_US_EXPR (micros())    /*Expression evaluating to current system time in us*/
+    #endif
+#endif
+
 /*1: Draw random colored rectangles over the redrawn areas*/
 #define LV_USE_REFR_DEBUG 0
 
+/*1: Skip drawing the objects which are fully covered by opaque, not transformed younger siblings on the redrawn area.
+ *The number of skipped objects is shown in the perf. stats*/
+#define LV_USE_OCCLUSION_CULLING 1
+
+/*Number of style properties to cache with the object, part and state they were resolved for.
+ *It saves walking the styles of the object and its parents in `lv_obj_get_style_...()`.
+ *Every entry needs 20 bytes (on 32 bit systems). 0: to disable caching*/
+#define LV_OBJ_STYLE_CACHE_SIZE 1024
+#if LV_OBJ_STYLE_CACHE_SIZE
+    /*1: Compare the cached values with the styles in every look-up and assert if they differ. (Slow, for debugging)*/
+    #define LV_OBJ_STYLE_CACHE_CHECK 0
+#endif
+
 /*Change the built in (v)snprintf functions*/
 #define LV_SPRINTF_CUSTOM 0
 #if LV_SPRINTF_CUSTOM
@@ -419,6 +490,23 @@
 /*Enable drawing placeholders when glyph dsc is not found*/
 #define LV_USE_FONT_PLACEHOLDER 1
 
+/*Number of letters whose glyph ID is cached in a direct-mapped table (8 bytes each) per font
+ *enabled by `lv_font_fmt_txt_cache_create()`. Other fonts remember only the last letter. Must be a power of 2.*/
+#define LV_FONT_FMT_TXT_CACHE_SIZE 128
+
+/*Number of kerning pairs cached per enabled font (8 bytes each). Must be a power of 2. 0: disable*/
+#define LV_FONT_FMT_TXT_KERN_CACHE_SIZE 32
+
+/*Allow pre-rendering a range of letters of a font to 8 bpp bitmaps with `lv_font_fmt_txt_atlas_create()`.
+ *The glyphs of the atlas are drawn without decompressing and unpacking them.*/
+#define LV_USE_FONT_ATLAS 1
+
+/*`lv_font_load_lazy()` reads the glyph bitmaps of binary fonts in pages of this many bytes when they are drawn*/
+#define LV_FONT_LOADER_PAGE_SIZE 512
+
+/*Default RAM budget of the pages of a font loaded with `lv_font_load_lazy()`, in bytes*/
+#define LV_FONT_LOADER_CACHE_SIZE (8 * 1024)
+
 /*=================
  *  TEXT SETTINGS
  *=================*/
@@ -491,6 +579,7 @@
 #if LV_USE_LABEL
     #define LV_LABEL_TEXT_SELECTION 1 /*Enable selecting text of the label*/
     #define LV_LABEL_LONG_TXT_HINT 1  /*Store some extra info in labels to speed up drawing of very long texts*/
+    #define LV_LABEL_LAYOUT_CACHE 1   /*Store the line breaks of the text in labels to measure it only when the text, font or width changes*/
 #endif
 
 #define LV_USE_LINE       1
@@ -568,6 +657,8 @@
 
 #define LV_USE_WIN        1
 
+#define LV_USE_VLIST      1
+
 /*-----------
  * Themes
  *----------*/
@@ -648,6 +739,10 @@
 
 /*PNG decoder library*/
 #define LV_USE_PNG 0
+#if LV_USE_PNG
+    /*Decode the whole image when it's opened if it needs at most this many bytes, else row by row [bytes]*/
+    #define LV_PNG_WHOLE_MAX (256 * 1024)
+#endif
 
 /*BMP decoder library*/
 #define LV_USE_BMP 0
@@ -656,6 +751,29 @@
  * Split JPG is a custom format optimized for embedded systems. */
 #define LV_USE_SJPG 0
 
+/*Tiled images compressed with RLE or LZ4, made with scripts/img_to_timg.py.
+ *The tiles are decoded on demand from C arrays in flash or from files.*/
+#define LV_USE_TIMG 1
+#if LV_USE_TIMG
+    /*Decode the whole image when it's opened if it needs at most this many bytes [bytes]*/
+    #define LV_TIMG_WHOLE_MAX (128 * 1024)
+    /*RAM for the decoded tiles of a larger image [bytes]*/
+    #define LV_TIMG_TILE_CACHE_SIZE (16 * 1024)
+#endif
+
+/*Keep the decoded pixels of image files (e.g. PNG and JPG) in files, e.g. on LittleFS,
+ *so that they are decoded only once, also across restarts.
+ *0 here: no file system driver or cache directory is set up yet and every open hashes the whole file*/
+#define LV_USE_IMG_FSCACHE 0
+#if LV_USE_IMG_FSCACHE
+    /*Directory of the cache files with drive letter, e.g. "S:/imgcache". "": set it later with `lv_img_fscache_set_dir()`*/
+    #define LV_IMG_FSCACHE_DIR ""
+    /*Max. number of cache files*/
+    #define LV_IMG_FSCACHE_SLOTS 16
+    /*Max. total size of the cache files [bytes]*/
+    #define LV_IMG_FSCACHE_MAX_SIZE (4 * 1024 * 1024)
+#endif
+
 /*GIF decoder library*/
 #define LV_USE_GIF 0
 
@@ -702,7 +820,12 @@
  *----------*/
 
 /*1: Enable API to take snapshot for object*/
-#define LV_USE_SNAPSHOT 0
+#define LV_USE_SNAPSHOT 1
+#if LV_USE_SNAPSHOT
+    /*1: Draw the objects with `LV_OBJ_FLAG_CACHE_LAYER` and their children from a snapshot until one of them changes.
+     *The snapshots are kept in the budget of `LV_DRAW_CACHE_BUDGET` so it's required too*/
+    #define LV_USE_SNAPSHOT_CACHE 1
+#endif
 
 /*1: Enable Monkey test*/
 #define LV_USE_MONKEY 0
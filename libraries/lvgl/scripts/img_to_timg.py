@@ -0,0 +1,386 @@
+#!/usr/bin/env python3
+##################################################################
+# Convert a PNG image to a tiled, compressed image for lv_timg.
+# The output is a C array or a .timg file (e.g. for LittleFS).
+# Dependencies: (PYTHON-3), no external modules
+##################################################################
+import argparse, os, struct, sys, time, zlib
+
+TIMG_MAGIC = b"LVTI"
+TIMG_VERSION = 1
+TIMG_16_SWAP = 0x80
+
+COMPRESS_NONE = 0
+COMPRESS_RLE = 1
+COMPRESS_LZ4 = 2
+COMPRESS_NAMES = {"none": COMPRESS_NONE, "rle": COMPRESS_RLE, "lz4": COMPRESS_LZ4}
+
+LV_IMG_CF_TRUE_COLOR = 4
+LV_IMG_CF_TRUE_COLOR_ALPHA = 5
+
+
+def read_png(path):
+    """Read an 8 bit, non-interlaced PNG. Return the width, height and the RGBA pixels row by row."""
+    with open(path, "rb") as f:
+        d = f.read()
+    if d[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit(path + " is not a PNG file")
+
+    pos = 8
+    idat = bytearray()
+    plte = b""
+    trns = b""
+    while pos < len(d):
+        length, typ = struct.unpack(">I4s", d[pos:pos + 8])
+        body = d[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if typ == b"IHDR":
+            w, h, depth, ct, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif typ == b"PLTE":
+            plte = body
+        elif typ == b"tRNS":
+            trns = body
+        elif typ == b"IDAT":
+            idat += body
+
+    if depth != 8 or interlace:
+        sys.exit("only 8 bit, non-interlaced PNGs are supported")
+
+    bpp = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ct]
+    raw = zlib.decompress(bytes(idat))
+    stride = w * bpp
+    prev = bytearray(stride)
+    rows = []
+    p = 0
+    for y in range(h):
+        filt = raw[p]
+        line = bytearray(raw[p + 1:p + 1 + stride])
+        p += 1 + stride
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if filt == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif filt == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif filt == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif filt == 4:
+                pa = abs(b - c)
+                pb = abs(a - c)
+                pc = abs(a + b - 2 * c)
+                pr = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pr) & 0xFF
+        prev = line
+
+        row = []
+        for x in range(w):
+            px = line[x * bpp:(x + 1) * bpp]
+            if ct == 0:
+                row.append((px[0], px[0], px[0], 255))
+            elif ct == 2:
+                row.append((px[0], px[1], px[2], 255))
+            elif ct == 3:
+                i = px[0]
+                row.append((plte[i * 3], plte[i * 3 + 1], plte[i * 3 + 2], trns[i] if i < len(trns) else 255))
+            elif ct == 4:
+                row.append((px[0], px[0], px[0], px[1]))
+            else:
+                row.append((px[0], px[1], px[2], px[3]))
+        rows.append(row)
+
+    return w, h, rows
+
+
+def median_cut(colors, n):
+    """Reduce a {color: count} dict to at most n colors. Always split the box with
+    the largest error along its channel with the largest variance."""
+
+    def spread(box):
+        total = sum(c[1] for c in box)
+        best = (0, 0)
+        for ch in range(4):
+            mean = sum(c[0][ch] * c[1] for c in box) / total
+            err = sum((c[0][ch] - mean) ** 2 * c[1] for c in box)
+            best = max(best, (err, ch))
+        return best
+
+    boxes = [(spread(list(colors.items())), list(colors.items()))]
+    while len(boxes) < n:
+        i = max(range(len(boxes)), key=lambda k: boxes[k][0][0])
+        (err, ch), box = boxes[i]
+        if err == 0:
+            break
+        box = sorted(box, key=lambda c: c[0][ch])
+        total = sum(c[1] for c in box)
+        acc = 0
+        cut = len(box) - 1
+        for j, c in enumerate(box[:-1]):
+            acc += c[1]
+            if acc * 2 >= total:
+                cut = j + 1
+                break
+        boxes[i:i + 1] = [(spread(box[:cut]), box[:cut]), (spread(box[cut:]), box[cut:])]
+
+    palette = []
+    for _, box in boxes:
+        total = sum(c[1] for c in box)
+        palette.append(tuple((sum(c[0][ch] * c[1] for c in box) + total // 2) // total for ch in range(4)))
+    return palette
+
+
+def to_pixel(c, depth, swap, alpha):
+    """Convert an RGBA color to the bytes of an lv_color_t (and the alpha byte)."""
+    r, g, b, a = c
+    if depth == 32:
+        return bytes((b, g, r, a if alpha else 255))
+    if depth == 16:
+        v = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+        px = struct.pack(">H" if swap else "<H", v)
+    else:
+        px = bytes((((r >> 5) << 5) | ((g >> 5) << 2) | (b >> 6),))
+    return px + (bytes((a,)) if alpha else b"")
+
+
+def rle_compress(data, unit):
+    """Runs of repeated units and literal units, see rle_decode() in lv_timg.c"""
+    n = len(data) // unit
+    units = [data[i * unit:(i + 1) * unit] for i in range(n)]
+    min_run = 2 if unit > 1 else 3
+    out = bytearray()
+    lit = []
+
+    def flush():
+        while lit:
+            chunk = lit[:128]
+            del lit[:128]
+            out.append(len(chunk) - 1)
+            for u in chunk:
+                out.extend(u)
+
+    i = 0
+    while i < n:
+        j = i + 1
+        while j < n and j - i < 128 and units[j] == units[i]:
+            j += 1
+        if j - i >= min_run:
+            flush()
+            out.append(0x80 | (j - i - 1))
+            out.extend(units[i])
+            i = j
+        else:
+            lit.append(units[i])
+            i += 1
+    flush()
+    return bytes(out)
+
+
+def lz4_compress(src):
+    """Greedy LZ4 block compressor. It keeps the end of block rules of LZ4
+    (last 5 bytes are literals, no match starts in the last 12 bytes)."""
+    n = len(src)
+    out = bytearray()
+
+    def put_len(v):
+        while v >= 255:
+            out.append(255)
+            v -= 255
+        out.append(v)
+
+    def put_seq(lit, offset, mlen):
+        ml = mlen - 4
+        out.append((min(len(lit), 15) << 4) | (min(ml, 15) if mlen else 0))
+        if len(lit) >= 15:
+            put_len(len(lit) - 15)
+        out.extend(lit)
+        if mlen:
+            out.extend(struct.pack("<H", offset))
+            if ml >= 15:
+                put_len(ml - 15)
+
+    table = {}
+    anchor = 0
+    i = 0
+    while i < n - 12:
+        key = src[i:i + 4]
+        ref = table.get(key)
+        table[key] = i
+        if ref is None or i - ref > 0xFFFF:
+            i += 1
+            continue
+        m = 4
+        limit = n - 5 - i
+        while m < limit and src[ref + m] == src[i + m]:
+            m += 1
+        put_seq(src[anchor:i], i - ref, m)
+        i += m
+        anchor = i
+    put_seq(src[anchor:], 0, 0)
+    return bytes(out)
+
+
+def compress(data, method, unit):
+    if method == COMPRESS_RLE:
+        return rle_compress(data, unit)
+    if method == COMPRESS_LZ4:
+        return lz4_compress(data)
+    return data
+
+
+def convert(args):
+    w, h, rows = read_png(args.input)
+    alpha = any(c[3] != 255 for row in rows for c in row) and not args.no_alpha
+    tile_w, tile_h = (int(v) for v in args.tile.lower().split("x"))
+    tile_w = min(tile_w, w)
+    tile_h = min(tile_h, h)
+    px_size = (4 if args.depth == 32 else args.depth // 8 + (1 if alpha else 0))
+
+    palette = []
+    if args.colors:
+        counts = {}
+        for row in rows:
+            for c in row:
+                counts[c] = counts.get(c, 0) + 1
+        palette = list(counts) if len(counts) <= args.colors else median_cut(counts, args.colors)
+        index = {c: i for i, c in enumerate(palette)}
+        nearest = {}
+        pixels = []
+        for row in rows:
+            line = bytearray()
+            for c in row:
+                i = index.get(c)
+                if i is None:
+                    i = nearest.get(c)
+                if i is None:
+                    i = min(range(len(palette)),
+                            key=lambda k: sum((palette[k][ch] - c[ch]) ** 2 for ch in range(4)))
+                    nearest[c] = i
+                line.append(i)
+            pixels.append(bytes(line))
+        unit = 1
+    else:
+        pixels = [b"".join(to_pixel(c, args.depth, args.swap, alpha) for c in row) for row in rows]
+        unit = px_size
+
+    tiles = []
+    for ty in range(0, h, tile_h):
+        for tx in range(0, w, tile_w):
+            tw = min(tile_w, w - tx)
+            tiles.append(b"".join(pixels[y][tx * unit:(tx + tw) * unit] for y in range(ty, min(ty + tile_h, h))))
+
+    methods = list(COMPRESS_NAMES.values()) if args.compress == "auto" else [COMPRESS_NAMES[args.compress]]
+    best = None
+    for m in methods:
+        packed = [compress(t, m, unit) for t in tiles]
+        size = sum(len(p) for p in packed)
+        if best is None or size < best[0]:
+            best = (size, m, packed)
+    _, method, packed = best
+
+    depth_code = 0 if palette else (args.depth | (TIMG_16_SWAP if args.depth == 16 and args.swap else 0))
+    cf = LV_IMG_CF_TRUE_COLOR_ALPHA if alpha else LV_IMG_CF_TRUE_COLOR
+    out = bytearray(struct.pack("<4sBBBBHHHHHH", TIMG_MAGIC, TIMG_VERSION, cf, method, depth_code,
+                                w, h, tile_w, tile_h, len(palette), 0))
+    for c in palette:
+        out += bytes((c[2], c[1], c[0], c[3]))
+    offset = 0
+    for p in packed:
+        out += struct.pack("<I", offset)
+        offset += len(p)
+    out += struct.pack("<I", offset)
+    for p in packed:
+        out += p
+
+    return w, h, alpha, px_size, method, palette, bytes(out)
+
+
+def write_c(path, name, src_name, args, w, h, alpha, px_size, method, palette, data):
+    method_name = [k for k, v in COMPRESS_NAMES.items() if v == method][0].upper()
+    c = "// Generated by lvgl/scripts/img_to_timg.py from " + src_name + "\n"
+    c += "// %dx%d, %s, %s tiles, %s: %d bytes instead of %d\n\n" % (
+        w, h, "%d colors" % len(palette) if palette else "%d bit" % args.depth, args.tile, method_name,
+        len(data), w * h * px_size)
+    c += ("#ifdef __has_include\n"
+          "    #if __has_include(\"lvgl.h\")\n"
+          "        #ifndef LV_LVGL_H_INCLUDE_SIMPLE\n"
+          "            #define LV_LVGL_H_INCLUDE_SIMPLE\n"
+          "        #endif\n"
+          "    #endif\n"
+          "#endif\n\n"
+          "#if defined(LV_LVGL_H_INCLUDE_SIMPLE)\n"
+          "    #include \"lvgl.h\"\n"
+          "#else\n"
+          "    #include \"lvgl/lvgl.h\"\n"
+          "#endif\n\n")
+    c += ("#if !LV_USE_TIMG\n"
+          "    #error \"Enable LV_USE_TIMG in lv_conf.h to show " + name + "\"\n"
+          "#endif\n\n")
+    if not palette:
+        cond = "LV_COLOR_DEPTH != %d" % args.depth
+        if args.depth == 16:
+            cond += " || LV_COLOR_16_SWAP != %d" % (1 if args.swap else 0)
+        c += ("#if " + cond + "\n"
+              "    #error \"" + name + " was converted for other color settings (" + cond.replace(" || ", ", ")
+              .replace("!=", "=") + ")\"\n"
+              "#endif\n\n")
+    c += ("#ifndef LV_ATTRIBUTE_MEM_ALIGN\n"
+          "    #define LV_ATTRIBUTE_MEM_ALIGN\n"
+          "#endif\n\n"
+          "#ifndef LV_ATTRIBUTE_LARGE_CONST\n"
+          "    #define LV_ATTRIBUTE_LARGE_CONST\n"
+          "#endif\n\n")
+    c += "const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t " + name + "_data[] = {\n"
+    for i in range(0, len(data), 32):
+        c += "    " + ",".join("0x%02X" % b for b in data[i:i + 32]) + ",\n"
+    c += "};\n\n"
+    c += ("const lv_img_dsc_t " + name + " = {\n"
+          "    .header.always_zero = 0,\n"
+          "    .header.w = %d,\n"
+          "    .header.h = %d,\n"
+          "    .data_size = sizeof(" + name + "_data),\n"
+          "    .header.cf = %s,\n"
+          "    .data = " + name + "_data\n"
+          "};\n") % (w, h, "LV_IMG_CF_RAW_ALPHA" if alpha else "LV_IMG_CF_RAW")
+    with open(path, "w") as f:
+        f.write(c)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a PNG image to a tiled, compressed image for lv_timg")
+    parser.add_argument("input", help="8 bit PNG image")
+    parser.add_argument("-o", "--output", help="output .c or .timg file (default: <input>.c)")
+    parser.add_argument("--name", help="name of the lv_img_dsc_t in the C file (default: from the file name)")
+    parser.add_argument("--depth", type=int, choices=(8, 16, 32), default=16, help="LV_COLOR_DEPTH (default: 16)")
+    parser.add_argument("--swap", action="store_true", help="LV_COLOR_16_SWAP 1")
+    parser.add_argument("--tile", default="64x16", help="tile size WxH (default: 64x16)")
+    parser.add_argument("--compress", choices=("none", "rle", "lz4", "auto"), default="auto",
+                        help="compression of the tiles (default: auto, the smallest)")
+    parser.add_argument("--colors", type=int, default=0,
+                        help="store palette indices with at most this many colors (<= 256, independent of the depth)")
+    parser.add_argument("--no-alpha", action="store_true", help="drop the alpha channel")
+    args = parser.parse_args()
+
+    if args.colors < 0 or args.colors > 256:
+        sys.exit("--colors must be 1..256")
+
+    base = os.path.splitext(os.path.basename(args.input))[0]
+    output = args.output or base + ".c"
+    name = args.name or "".join(ch if ch.isalnum() else "_" for ch in base)
+
+    start = time.time()
+    w, h, alpha, px_size, method, palette, data = convert(args)
+    if output.endswith(".timg"):
+        with open(output, "wb") as f:
+            f.write(data)
+    else:
+        write_c(output, name, os.path.basename(args.input), args, w, h, alpha, px_size, method, palette, data)
+
+    raw = w * h * px_size
+    print("%s: %dx%d, %s, %s -> %s" % (args.input, w, h, "alpha" if alpha else "no alpha",
+                                       [k for k, v in COMPRESS_NAMES.items() if v == method][0], output))
+    print("\t%d bytes instead of %d (%.1f%%), %.1f s" % (len(data), raw, 100.0 * len(data) / raw, time.time() - start))
+
+
+if __name__ == "__main__":
+    main()
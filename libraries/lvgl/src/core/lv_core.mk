@@ -11,6 +11,7 @@ CSRCS += lv_obj_style.c
 CSRCS += lv_obj_style_gen.c
 CSRCS += lv_obj_tree.c
 CSRCS += lv_event.c
+CSRCS += lv_perf_stats.c
 CSRCS += lv_refr.c
 CSRCS += lv_theme.c
 
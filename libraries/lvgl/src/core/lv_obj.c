@@ -65,6 +65,7 @@ static void draw_scrollbar(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
 static lv_res_t scrollbar_init_draw_dsc(lv_obj_t * obj, lv_draw_rect_dsc_t * dsc);
 static bool obj_valid_child(const lv_obj_t * parent, const lv_obj_t * obj_to_find);
 static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state);
+static bool child_depends_on_size(lv_obj_t * obj, lv_obj_t * child, bool w_changed, bool h_changed);
 
 /**********************
  *  STATIC VARIABLES
@@ -118,6 +119,10 @@ void lv_init(void)
 
     lv_draw_init();
 
+#if LV_DRAW_CACHE_BUDGET
+    _lv_draw_cache_init();
+#endif
+
 #if LV_USE_GPU_STM32_DMA2D
     /*Initialize DMA2D GPU*/
     lv_draw_stm32_dma2d_init();
@@ -196,6 +201,13 @@ void lv_init(void)
 
 void lv_deinit(void)
 {
+#if LV_USE_SNAPSHOT && LV_USE_SNAPSHOT_CACHE
+    _lv_snapshot_cache_deinit();
+#endif
+#if LV_DRAW_CACHE_BUDGET
+    _lv_draw_cache_deinit();
+#endif
+
     _lv_gc_clear_roots();
 
     lv_disp_set_default(NULL);
@@ -453,6 +465,12 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
     _lv_event_mark_deleted(obj);
 
+    /*Don't let a new object at the same address find the cached values*/
+    _lv_obj_style_cache_invalidate();
+#if LV_USE_SNAPSHOT && LV_USE_SNAPSHOT_CACHE
+    _lv_snapshot_cache_drop(obj);
+#endif
+
     /*Remove all style*/
     lv_obj_enable_style_refresh(false); /*No need to refresh the style because the object will be deleted*/
     lv_obj_remove_style_all(obj);
@@ -846,11 +864,19 @@ static void lv_obj_event(const lv_obj_class_t * class_p, lv_event_t * e)
             lv_obj_mark_layout_as_dirty(obj);
         }
 
+        /*Update only the children whose size or position depends on the changed width or height.
+         *E.g. a column with content height doesn't need to update all its rows when it grows.*/
+        const lv_area_t * ori = lv_event_get_param(e);
+        bool w_changed = ori == NULL || lv_area_get_width(ori) != lv_obj_get_width(obj);
+        bool h_changed = ori == NULL || lv_area_get_height(ori) != lv_obj_get_height(obj);
+
         uint32_t i;
         uint32_t child_cnt = lv_obj_get_child_cnt(obj);
         for(i = 0; i < child_cnt; i++) {
             lv_obj_t * child = obj->spec_attr->children[i];
-            lv_obj_mark_layout_as_dirty(child);
+            if(child_depends_on_size(obj, child, w_changed, h_changed)) {
+                lv_obj_mark_layout_as_dirty(child);
+            }
         }
     }
     else if(code == LV_EVENT_CHILD_CHANGED) {
@@ -890,6 +916,9 @@ static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state)
     lv_state_t prev_state = obj->state;
     obj->state = new_state;
 
+    /*The children might inherit properties that depend on the state*/
+    _lv_obj_style_cache_invalidate();
+
     _lv_style_state_cmp_t cmp_res = _lv_obj_style_state_compare(obj, prev_state, new_state);
     /*If there is no difference in styles there is nothing else to do*/
     if(cmp_res == _LV_STYLE_STATE_CMP_SAME) return;
@@ -954,6 +983,38 @@ static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state)
     }
 }
 
+/**
+ * Check whether the size or position of a child is calculated from the size of its parent
+ * @param obj       pointer to the parent
+ * @param child     pointer to a child of `obj`
+ * @param w_changed true: the width of `obj` has changed
+ * @param h_changed true: the height of `obj` has changed
+ * @return          true: the child needs to be updated
+ */
+static bool child_depends_on_size(lv_obj_t * obj, lv_obj_t * child, bool w_changed, bool h_changed)
+{
+    if(w_changed) {
+        if(LV_COORD_IS_PCT(lv_obj_get_style_width(child, LV_PART_MAIN))) return true;
+        if(LV_COORD_IS_PCT(lv_obj_get_style_min_width(child, LV_PART_MAIN))) return true;
+        if(LV_COORD_IS_PCT(lv_obj_get_style_max_width(child, LV_PART_MAIN))) return true;
+        if(LV_COORD_IS_PCT(lv_obj_get_style_x(child, LV_PART_MAIN))) return true;
+    }
+
+    if(h_changed) {
+        if(LV_COORD_IS_PCT(lv_obj_get_style_height(child, LV_PART_MAIN))) return true;
+        if(LV_COORD_IS_PCT(lv_obj_get_style_min_height(child, LV_PART_MAIN))) return true;
+        if(LV_COORD_IS_PCT(lv_obj_get_style_max_height(child, LV_PART_MAIN))) return true;
+        if(LV_COORD_IS_PCT(lv_obj_get_style_y(child, LV_PART_MAIN))) return true;
+    }
+
+    /*Aligned to the right, bottom or center*/
+    lv_align_t align = lv_obj_get_style_align(child, LV_PART_MAIN);
+    if(align == LV_ALIGN_DEFAULT) {
+        return w_changed && lv_obj_get_style_base_dir(obj, LV_PART_MAIN) == LV_BASE_DIR_RTL;
+    }
+    return align != LV_ALIGN_TOP_LEFT;
+}
+
 static bool obj_valid_child(const lv_obj_t * parent, const lv_obj_t * obj_to_find)
 {
     /*Check all children of `parent`*/
@@ -9,6 +9,7 @@
 #include "lv_obj.h"
 #include "lv_disp.h"
 #include "../misc/lv_gc.h"
+#include <string.h>
 
 /*********************
  *      DEFINES
@@ -35,6 +36,17 @@ typedef enum {
     CACHE_NEED_CHECK = 4,
 } cache_t;
 
+#if LV_OBJ_STYLE_CACHE_SIZE
+typedef struct {
+    const lv_obj_t * obj;
+    uint32_t epoch;             /*The entry is valid only in the epoch it was stored in*/
+    lv_style_value_t value;
+    lv_style_prop_t prop;
+    lv_state_t state;
+    uint8_t part;               /*`part >> 16`*/
+} style_cache_entry_t;
+#endif
+
 /**********************
  *  GLOBAL PROTOTYPES
  **********************/
@@ -45,6 +57,10 @@ typedef enum {
 static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector);
 static _lv_obj_style_t * get_trans_style(lv_obj_t * obj, uint32_t part);
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v);
+static lv_style_value_t get_prop_resolved(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
+#if LV_OBJ_STYLE_CACHE_SIZE
+static inline uint32_t style_cache_hash(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
+#endif
 static void report_style_change_core(void * style, lv_obj_t * obj);
 static void refresh_children_style(lv_obj_t * obj);
 static bool trans_del(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, trans_t * tr_limit);
@@ -59,6 +75,12 @@ static void fade_in_anim_ready(lv_anim_t * a);
  *  STATIC VARIABLES
  **********************/
 static bool style_refr = true;
+#if LV_OBJ_STYLE_CACHE_SIZE
+static style_cache_entry_t style_cache[LV_OBJ_STYLE_CACHE_SIZE];
+static uint32_t style_cache_epoch = 1;
+static uint32_t style_cache_change_cnt;     /*`_lv_style_get_change_cnt()` when the epoch was started*/
+static bool style_cache_en = true;
+#endif
 
 /**********************
  *      MACROS
@@ -152,6 +174,7 @@ void lv_obj_remove_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t
 
 void lv_obj_report_style_change(lv_style_t * style)
 {
+    _lv_obj_style_cache_invalidate();
     if(!style_refr) return;
     lv_disp_t * d = lv_disp_get_next(NULL);
 
@@ -168,6 +191,8 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    _lv_obj_style_cache_invalidate();
+
     if(!style_refr) return;
 
     lv_obj_invalidate(obj);
@@ -220,51 +245,61 @@ void lv_obj_enable_style_refresh(bool en)
     style_refr = en;
 }
 
-lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+void lv_obj_enable_style_cache(bool en)
 {
-    lv_style_value_t value_act;
-    bool inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT);
-    lv_style_res_t found = LV_STYLE_RES_NOT_FOUND;
-    while(obj) {
-        found = get_prop_core(obj, part, prop, &value_act);
-        if(found == LV_STYLE_RES_FOUND) break;
-        if(!inheritable) break;
-
-        /*If not found, check the `MAIN` style first*/
-        if(found != LV_STYLE_RES_INHERIT && part != LV_PART_MAIN) {
-            part = LV_PART_MAIN;
-            continue;
-        }
+#if LV_OBJ_STYLE_CACHE_SIZE
+    style_cache_en = en;
+    _lv_obj_style_cache_invalidate();
+#else
+    LV_UNUSED(en);
+#endif
+}
 
-        /*Check the parent too.*/
-        obj = lv_obj_get_parent(obj);
+void _lv_obj_style_cache_invalidate(void)
+{
+#if LV_OBJ_STYLE_CACHE_SIZE
+    style_cache_epoch++;
+    /*Clear the entries on overflow to not find very old entries valid again*/
+    if(style_cache_epoch == 0) {
+        lv_memset_00(style_cache, sizeof(style_cache));
+        style_cache_epoch = 1;
     }
+#endif
+}
 
-    if(found != LV_STYLE_RES_FOUND) {
-        if(part == LV_PART_MAIN && (prop == LV_STYLE_WIDTH || prop == LV_STYLE_HEIGHT)) {
-            const lv_obj_class_t * cls = obj->class_p;
-            while(cls) {
-                if(prop == LV_STYLE_WIDTH) {
-                    if(cls->width_def != 0) break;
-                }
-                else {
-                    if(cls->height_def != 0) break;
-                }
-                cls = cls->base_class;
-            }
+lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+#if LV_OBJ_STYLE_CACHE_SIZE
+    /*With `skip_trans` the values are read without the transitions temporarily*/
+    if(!style_cache_en || obj->skip_trans) return get_prop_resolved(obj, part, prop);
 
-            if(cls) {
-                value_act.num = prop == LV_STYLE_WIDTH ? cls->width_def : cls->height_def;
-            }
-            else {
-                value_act.num = 0;
-            }
-        }
-        else {
-            value_act = lv_style_prop_get_default(prop);
-        }
+    /*Any style might have been changed without reporting it*/
+    uint32_t change_cnt = _lv_style_get_change_cnt();
+    if(style_cache_change_cnt != change_cnt) {
+        style_cache_change_cnt = change_cnt;
+        _lv_obj_style_cache_invalidate();
     }
-    return value_act;
+
+    style_cache_entry_t * entry = &style_cache[style_cache_hash(obj, part, prop) % LV_OBJ_STYLE_CACHE_SIZE];
+    if(entry->epoch == style_cache_epoch && entry->obj == obj && entry->prop == prop &&
+       entry->state == obj->state && entry->part == (uint8_t)(part >> 16)) {
+#if LV_OBJ_STYLE_CACHE_CHECK
+        lv_style_value_t value_act = get_prop_resolved(obj, part, prop);
+        LV_ASSERT_MSG(memcmp(&value_act, &entry->value, sizeof(value_act)) == 0, "Outdated style cache entry");
+#endif
+        return entry->value;
+    }
+
+    entry->value = get_prop_resolved(obj, part, prop);
+    entry->obj = obj;
+    entry->epoch = style_cache_epoch;
+    entry->prop = prop;
+    entry->state = obj->state;
+    entry->part = (uint8_t)(part >> 16);
+    return entry->value;
+#else
+    return get_prop_resolved(obj, part, prop);
+#endif
 }
 
 void lv_obj_set_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_style_value_t value,
@@ -670,6 +705,69 @@ static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_sty
     else return LV_STYLE_RES_NOT_FOUND;
 }
 
+/**
+ * Get the value of a style property without the style cache.
+ * The same as `lv_obj_get_style_prop()` without `LV_OBJ_STYLE_CACHE_SIZE`.
+ */
+static lv_style_value_t get_prop_resolved(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+    lv_style_value_t value_act;
+    /*Clear the unused bytes of the union to make the values comparable*/
+    lv_memset_00(&value_act, sizeof(value_act));
+    bool inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT);
+    lv_style_res_t found = LV_STYLE_RES_NOT_FOUND;
+    while(obj) {
+        found = get_prop_core(obj, part, prop, &value_act);
+        if(found == LV_STYLE_RES_FOUND) break;
+        if(!inheritable) break;
+
+        /*If not found, check the `MAIN` style first*/
+        if(found != LV_STYLE_RES_INHERIT && part != LV_PART_MAIN) {
+            part = LV_PART_MAIN;
+            continue;
+        }
+
+        /*Check the parent too.*/
+        obj = lv_obj_get_parent(obj);
+    }
+
+    if(found != LV_STYLE_RES_FOUND) {
+        if(part == LV_PART_MAIN && (prop == LV_STYLE_WIDTH || prop == LV_STYLE_HEIGHT)) {
+            const lv_obj_class_t * cls = obj->class_p;
+            while(cls) {
+                if(prop == LV_STYLE_WIDTH) {
+                    if(cls->width_def != 0) break;
+                }
+                else {
+                    if(cls->height_def != 0) break;
+                }
+                cls = cls->base_class;
+            }
+
+            if(cls) {
+                value_act.num = prop == LV_STYLE_WIDTH ? cls->width_def : cls->height_def;
+            }
+            else {
+                value_act.num = 0;
+            }
+        }
+        else {
+            value_act = lv_style_prop_get_default(prop);
+        }
+    }
+    return value_act;
+}
+
+#if LV_OBJ_STYLE_CACHE_SIZE
+static inline uint32_t style_cache_hash(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+    /*The objects are at least 8 byte aligned. Multiply to mix the bits and use the upper ones.*/
+    uint32_t h = (uint32_t)((lv_uintptr_t)obj >> 3);
+    h ^= ((uint32_t)prop << 12) ^ ((uint32_t)part << 4);
+    return (h * 2654435761UL) >> 16;
+}
+#endif
+
 /**
  * Refresh the style of all children of an object. (Called recursively)
  * @param style refresh objects only with this
@@ -118,6 +118,20 @@ void lv_obj_refresh_style(struct _lv_obj_t * obj, lv_part_t part, lv_style_prop_
  */
 void lv_obj_enable_style_refresh(bool en);
 
+/**
+ * Enable or disable the cache of the resolved style properties (`LV_OBJ_STYLE_CACHE_SIZE`).
+ * It's enabled by default, disabling is useful mainly to measure its effect.
+ * @param en        true: enable the cache; false: disable the cache
+ */
+void lv_obj_enable_style_cache(bool en);
+
+/**
+ * Drop all the cached style property values. Needs to be called when the result of
+ * `lv_obj_get_style_prop()` might change, e.g. because of a state or parent change.
+ * The changes of the styles themselves are detected automatically.
+ */
+void _lv_obj_style_cache_invalidate(void);
+
 /**
  * Get the value of a style property. The current state of the object will be considered.
  * Inherited properties will be inherited.
@@ -0,0 +1,405 @@
+/**
+ * @file lv_perf_stats.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_perf_stats.h"
+#if LV_USE_PERF_STATS
+
+#include <stdarg.h>
+#include "lv_disp.h"
+#include "../misc/lv_printf.h"
+#include "../misc/lv_assert.h"
+#include "../misc/lv_mem.h"
+#include "../draw/lv_draw_arena.h"
+#include "../hal/lv_hal_tick.h"
+#include "../widgets/lv_label.h"
+
+#if LV_PERF_STATS_TIME_CUSTOM
+    #include LV_PERF_STATS_TIME_CUSTOM_INCLUDE
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#define OVERLAY_REFR_PERIOD     500
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void window_add(const lv_perf_stats_frame_t * f, int32_t sign);
+static uint32_t hist_bucket(uint32_t v);
+static void hist_add(lv_perf_stats_hist_t * hist, uint32_t v, int32_t sign);
+static uint32_t buf_append(char * buf, uint32_t buf_size, uint32_t len, const char * fmt, ...) LV_FORMAT_ATTRIBUTE(4, 5);
+static uint32_t json_append_time(char * buf, uint32_t buf_size, uint32_t len, const char * name, uint32_t sum,
+                                 uint32_t max, const lv_perf_stats_hist_t * hist);
+#if LV_USE_LABEL
+    static void overlay_delete_event_cb(lv_event_t * e);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_perf_stats_t stats;
+static lv_perf_stats_frame_t history[LV_PERF_STATS_HISTORY];
+static uint16_t history_next;
+
+static lv_perf_stats_frame_t frame_act;
+static uint32_t frame_start;
+static bool frame_in_progress;
+
+static lv_obj_t * overlay_label;
+static uint32_t overlay_last_refr;
+
+static const char * const draw_names[_LV_PERF_STATS_DRAW_LAST] = {
+    "rect", "label", "img", "line", "arc", "polygon", "layer"
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void _lv_perf_stats_init(void)
+{
+    lv_perf_stats_reset();
+    frame_in_progress = false;
+    overlay_label = NULL;
+    overlay_last_refr = 0;
+}
+
+const lv_perf_stats_t * lv_perf_stats_get(void)
+{
+    return &stats;
+}
+
+void lv_perf_stats_reset(void)
+{
+    lv_memset_00(&stats, sizeof(stats));
+    lv_memset_00(history, sizeof(history));
+    history_next = 0;
+}
+
+uint32_t lv_perf_stats_hist_percentile(const lv_perf_stats_hist_t * hist, uint8_t pct)
+{
+    LV_ASSERT_NULL(hist);
+
+    uint32_t total = 0;
+    uint32_t i;
+    for(i = 0; i < LV_PERF_STATS_HIST_BUCKETS; i++) total += hist->bucket[i];
+    if(total == 0) return 0;
+
+    if(pct > 100) pct = 100;
+    /*Rank of the value to find, rounded up and at least 1*/
+    uint32_t rank = (total * pct + 99) / 100;
+    if(rank == 0) rank = 1;
+
+    uint32_t cnt = 0;
+    for(i = 0; i < LV_PERF_STATS_HIST_BUCKETS; i++) {
+        cnt += hist->bucket[i];
+        if(cnt >= rank) break;
+    }
+
+    if(i == 0) return 0;
+    if(i >= LV_PERF_STATS_HIST_BUCKETS - 1) return UINT32_MAX;
+    return ((uint32_t)1 << i) - 1;
+}
+
+const char * lv_perf_stats_draw_name(lv_perf_stats_draw_t type)
+{
+    if(type >= _LV_PERF_STATS_DRAW_LAST) return "unknown";
+    return draw_names[type];
+}
+
+uint32_t lv_perf_stats_to_json(char * buf, uint32_t buf_size)
+{
+    const lv_perf_stats_frame_t * last = &stats.last;
+    uint32_t len = 0;
+
+    len = buf_append(buf, buf_size, len,
+                     "{\"frames\":%"LV_PRIu32",\"window\":%d,"
+                     "\"last\":{\"render_us\":%"LV_PRIu32",\"flush_us\":%"LV_PRIu32","
+                     "\"area_px\":%"LV_PRIu32",\"areas\":%d,\"joined\":%d,\"culled\":%"LV_PRIu32"},",
+                     stats.frame_cnt, stats.window_cnt,
+                     last->render_us, last->flush_us, last->area_px, last->area_cnt, last->joined_cnt,
+                     last->culled_cnt);
+
+    len = json_append_time(buf, buf_size, len, "render_us", stats.render_sum_us, stats.render_max_us,
+                           &stats.render_hist);
+    len = json_append_time(buf, buf_size, len, "flush_us", stats.flush_sum_us, stats.flush_max_us,
+                           &stats.flush_hist);
+    len = json_append_time(buf, buf_size, len, "area_px", stats.area_sum_px, 0, &stats.area_hist);
+
+    len = buf_append(buf, buf_size, len, "\"draw\":{");
+    uint32_t i;
+    for(i = 0; i < _LV_PERF_STATS_DRAW_LAST; i++) {
+        len = buf_append(buf, buf_size, len, "%s\"%s\":%"LV_PRIu32, i == 0 ? "" : ",",
+                         draw_names[i], stats.draw_cnt[i]);
+    }
+    len = buf_append(buf, buf_size, len, "},\"culled\":%"LV_PRIu32, stats.culled_cnt);
+
+#if LV_DRAW_ARENA_SIZE
+    lv_draw_arena_stats_t arena;
+    lv_draw_arena_get_stats(&arena);
+    len = buf_append(buf, buf_size, len,
+                     ",\"arena\":{\"size\":%"LV_PRIu32",\"allocs\":%"LV_PRIu32",\"bytes\":%"LV_PRIu32","
+                     "\"peak\":%"LV_PRIu32",\"fallbacks\":%"LV_PRIu32",\"fallback_bytes\":%"LV_PRIu32"}",
+                     arena.size, arena.last.alloc_cnt, arena.last.alloc_size, arena.last.peak_size,
+                     arena.last.fallback_cnt, arena.last.fallback_size);
+#endif
+
+    len = buf_append(buf, buf_size, len, "}");
+
+    return len;
+}
+
+uint32_t lv_perf_stats_to_text(char * buf, uint32_t buf_size)
+{
+    uint32_t n = stats.window_cnt ? stats.window_cnt : 1;
+    uint32_t render_avg = stats.render_sum_us / n;
+    uint32_t flush_avg = stats.flush_sum_us / n;
+    uint32_t render_p95 = lv_perf_stats_hist_percentile(&stats.render_hist, 95);
+    uint32_t flush_p95 = lv_perf_stats_hist_percentile(&stats.flush_hist, 95);
+
+    /*Print the times in ms with 1 decimal as floats might not be supported by `lv_snprintf`*/
+    uint32_t len = 0;
+    len = buf_append(buf, buf_size, len,
+                     "render %"LV_PRIu32".%"LV_PRIu32" ms (p95 <%"LV_PRIu32".%"LV_PRIu32")\n"
+                     "flush %"LV_PRIu32".%"LV_PRIu32" ms (p95 <%"LV_PRIu32".%"LV_PRIu32")\n"
+                     "%"LV_PRIu32" px/frame, %"LV_PRIu32" areas\n",
+                     render_avg / 1000, (render_avg % 1000) / 100, render_p95 / 1000, (render_p95 % 1000) / 100,
+                     flush_avg / 1000, (flush_avg % 1000) / 100, flush_p95 / 1000, (flush_p95 % 1000) / 100,
+                     stats.area_sum_px / n, (uint32_t)stats.last.area_cnt);
+
+    uint32_t i;
+    for(i = 0; i < _LV_PERF_STATS_DRAW_LAST; i++) {
+        len = buf_append(buf, buf_size, len, "%s%s %"LV_PRIu32, i == 0 ? "" : " ", draw_names[i],
+                         stats.draw_cnt[i] / n);
+    }
+
+#if LV_USE_OCCLUSION_CULLING
+    len = buf_append(buf, buf_size, len, "\nculled %"LV_PRIu32" obj/frame", stats.culled_cnt / n);
+#endif
+
+#if LV_DRAW_ARENA_SIZE
+    lv_draw_arena_stats_t arena;
+    lv_draw_arena_get_stats(&arena);
+    len = buf_append(buf, buf_size, len, "\narena %"LV_PRIu32" allocs %"LV_PRIu32" B, %"LV_PRIu32" fallbacks",
+                     arena.last.alloc_cnt, arena.last.alloc_size, arena.last.fallback_cnt);
+#endif
+
+    return len;
+}
+
+void lv_perf_stats_set_overlay(bool en)
+{
+#if LV_USE_LABEL
+    if(overlay_label == NULL) {
+        if(!en) return;
+        if(lv_disp_get_default() == NULL) {
+            LV_LOG_WARN("no display to show the overlay on");
+            return;
+        }
+
+        overlay_label = lv_label_create(lv_layer_sys());
+        lv_obj_set_style_bg_opa(overlay_label, LV_OPA_50, 0);
+        lv_obj_set_style_bg_color(overlay_label, lv_color_black(), 0);
+        lv_obj_set_style_text_color(overlay_label, lv_color_white(), 0);
+        lv_obj_set_style_pad_top(overlay_label, 3, 0);
+        lv_obj_set_style_pad_bottom(overlay_label, 3, 0);
+        lv_obj_set_style_pad_left(overlay_label, 3, 0);
+        lv_obj_set_style_pad_right(overlay_label, 3, 0);
+        lv_obj_align(overlay_label, LV_PERF_STATS_OVERLAY_POS, 0, 0);
+        lv_label_set_text(overlay_label, "?");
+        lv_obj_add_event_cb(overlay_label, overlay_delete_event_cb, LV_EVENT_DELETE, NULL);
+        overlay_last_refr = 0;
+    }
+
+    if(en) lv_obj_clear_flag(overlay_label, LV_OBJ_FLAG_HIDDEN);
+    else lv_obj_add_flag(overlay_label, LV_OBJ_FLAG_HIDDEN);
+#else
+    LV_UNUSED(en);
+    LV_LOG_WARN("the overlay requires LV_USE_LABEL");
+#endif
+}
+
+bool lv_perf_stats_get_overlay(void)
+{
+    if(overlay_label == NULL) return false;
+    return !lv_obj_has_flag(overlay_label, LV_OBJ_FLAG_HIDDEN);
+}
+
+uint32_t _lv_perf_stats_time_us(void)
+{
+#if LV_PERF_STATS_TIME_CUSTOM
+    return LV_PERF_STATS_TIME_CUSTOM_US_EXPR;
+#else
+    return lv_tick_get() * 1000;
+#endif
+}
+
+void _lv_perf_stats_frame_begin(void)
+{
+    lv_memset_00(&frame_act, sizeof(frame_act));
+    frame_in_progress = true;
+    frame_start = _lv_perf_stats_time_us();
+}
+
+void _lv_perf_stats_frame_end(uint32_t area_px, uint16_t area_cnt, uint16_t joined_cnt)
+{
+    if(!frame_in_progress) return;
+    frame_in_progress = false;
+
+    uint32_t elaps = _lv_perf_stats_time_us() - frame_start;
+    frame_act.render_us = elaps > frame_act.flush_us ? elaps - frame_act.flush_us : 0;
+    frame_act.area_px = area_px;
+    frame_act.area_cnt = area_cnt;
+    frame_act.joined_cnt = joined_cnt;
+
+    /*Drop the oldest frame from the window if it's full*/
+    if(stats.window_cnt >= LV_PERF_STATS_HISTORY) window_add(&history[history_next], -1);
+    else stats.window_cnt++;
+
+    history[history_next] = frame_act;
+    history_next++;
+    if(history_next >= LV_PERF_STATS_HISTORY) history_next = 0;
+
+    window_add(&frame_act, 1);
+
+    stats.last = frame_act;
+    stats.frame_cnt++;
+    if(frame_act.render_us > stats.render_max_us) stats.render_max_us = frame_act.render_us;
+    if(frame_act.flush_us > stats.flush_max_us) stats.flush_max_us = frame_act.flush_us;
+}
+
+void _lv_perf_stats_frame_cancel(void)
+{
+    frame_in_progress = false;
+}
+
+void _lv_perf_stats_add_flush_time(uint32_t us)
+{
+    if(frame_in_progress) frame_act.flush_us += us;
+}
+
+void _lv_perf_stats_add_draw(lv_perf_stats_draw_t type)
+{
+    if(frame_in_progress && type < _LV_PERF_STATS_DRAW_LAST) frame_act.draw_cnt[type]++;
+}
+
+void _lv_perf_stats_add_culled(void)
+{
+    if(frame_in_progress) frame_act.culled_cnt++;
+}
+
+void _lv_perf_stats_overlay_refr(void)
+{
+#if LV_USE_LABEL
+    if(!lv_perf_stats_get_overlay()) return;
+    if(overlay_last_refr != 0 && lv_tick_elaps(overlay_last_refr) < OVERLAY_REFR_PERIOD) return;
+    overlay_last_refr = lv_tick_get();
+    if(overlay_last_refr == 0) overlay_last_refr = 1;
+
+    char buf[256];
+    lv_perf_stats_to_text(buf, sizeof(buf));
+    lv_label_set_text(overlay_label, buf);
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Add a frame to the rolling window or remove it
+ * @param f         pointer to a frame
+ * @param sign      1: add the frame; -1: remove the frame
+ */
+static void window_add(const lv_perf_stats_frame_t * f, int32_t sign)
+{
+    stats.render_sum_us += sign * (int32_t)f->render_us;
+    stats.flush_sum_us += sign * (int32_t)f->flush_us;
+    stats.area_sum_px += sign * (int32_t)f->area_px;
+
+    uint32_t i;
+    for(i = 0; i < _LV_PERF_STATS_DRAW_LAST; i++) stats.draw_cnt[i] += sign * (int32_t)f->draw_cnt[i];
+    stats.culled_cnt += sign * (int32_t)f->culled_cnt;
+
+    hist_add(&stats.render_hist, f->render_us, sign);
+    hist_add(&stats.flush_hist, f->flush_us, sign);
+    hist_add(&stats.area_hist, f->area_px, sign);
+}
+
+static uint32_t hist_bucket(uint32_t v)
+{
+    uint32_t i = 0;
+    while(v) {
+        v >>= 1;
+        i++;
+    }
+
+    return i < LV_PERF_STATS_HIST_BUCKETS ? i : LV_PERF_STATS_HIST_BUCKETS - 1;
+}
+
+static void hist_add(lv_perf_stats_hist_t * hist, uint32_t v, int32_t sign)
+{
+    uint32_t i = hist_bucket(v);
+    if(sign > 0) hist->bucket[i]++;
+    else if(hist->bucket[i] > 0) hist->bucket[i]--;
+}
+
+/**
+ * `snprintf` into `buf + len` and keep counting the length on truncation
+ * @return the new length
+ */
+static uint32_t buf_append(char * buf, uint32_t buf_size, uint32_t len, const char * fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    int ret;
+    if(len < buf_size) ret = lv_vsnprintf(buf + len, buf_size - len, fmt, args);
+    else ret = lv_vsnprintf(NULL, 0, fmt, args);
+    va_end(args);
+
+    return ret > 0 ? len + (uint32_t)ret : len;
+}
+
+static uint32_t json_append_time(char * buf, uint32_t buf_size, uint32_t len, const char * name, uint32_t sum,
+                                 uint32_t max, const lv_perf_stats_hist_t * hist)
+{
+    uint32_t n = stats.window_cnt ? stats.window_cnt : 1;
+    len = buf_append(buf, buf_size, len,
+                     "\"%s\":{\"avg\":%"LV_PRIu32",\"p50\":%"LV_PRIu32",\"p95\":%"LV_PRIu32",\"p99\":%"LV_PRIu32",",
+                     name, sum / n, lv_perf_stats_hist_percentile(hist, 50), lv_perf_stats_hist_percentile(hist, 95),
+                     lv_perf_stats_hist_percentile(hist, 99));
+    if(max) len = buf_append(buf, buf_size, len, "\"max\":%"LV_PRIu32",", max);
+
+    len = buf_append(buf, buf_size, len, "\"hist\":[");
+    uint32_t i;
+    for(i = 0; i < LV_PERF_STATS_HIST_BUCKETS; i++) {
+        len = buf_append(buf, buf_size, len, "%s%d", i == 0 ? "" : ",", hist->bucket[i]);
+    }
+    len = buf_append(buf, buf_size, len, "]},");
+
+    return len;
+}
+
+#if LV_USE_LABEL
+static void overlay_delete_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    overlay_label = NULL;
+}
+#endif
+
+#endif /*LV_USE_PERF_STATS*/
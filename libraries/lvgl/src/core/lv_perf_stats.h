@@ -0,0 +1,220 @@
+/**
+ * @file lv_perf_stats.h
+ *
+ */
+
+#ifndef LV_PERF_STATS_H
+#define LV_PERF_STATS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Number of log2 buckets of a histogram. The last bucket collects everything >= 2^(N-2)*/
+#define LV_PERF_STATS_HIST_BUCKETS  20
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Draw primitives counted by the statistics
+ */
+typedef enum {
+    LV_PERF_STATS_DRAW_RECT,
+    LV_PERF_STATS_DRAW_LABEL,
+    LV_PERF_STATS_DRAW_IMG,
+    LV_PERF_STATS_DRAW_LINE,
+    LV_PERF_STATS_DRAW_ARC,
+    LV_PERF_STATS_DRAW_POLYGON,
+    LV_PERF_STATS_DRAW_LAYER,
+    _LV_PERF_STATS_DRAW_LAST
+} lv_perf_stats_draw_t;
+
+/**
+ * Data recorded about one refreshed frame
+ */
+typedef struct {
+    uint32_t render_us;     /**< Time spent with layout and rendering (flushing excluded)*/
+    uint32_t flush_us;      /**< Time spent in `flush_cb` and waiting for the flush to be ready*/
+    uint32_t area_px;       /**< Number of redrawn pixels*/
+    uint16_t area_cnt;      /**< Number of areas drawn after joining the invalidated areas*/
+    uint16_t joined_cnt;    /**< Number of invalidated areas merged into an other one*/
+    uint32_t draw_cnt[_LV_PERF_STATS_DRAW_LAST];    /**< Draw calls per primitive type*/
+    uint32_t culled_cnt;    /**< Objects not drawn because they were covered by siblings*/
+} lv_perf_stats_frame_t;
+
+/**
+ * Histogram with power of 2 sized buckets.
+ * Bucket `i` counts the values in the `[2^(i-1), 2^i)` range, bucket 0 counts the zeros.
+ */
+typedef struct {
+    uint16_t bucket[LV_PERF_STATS_HIST_BUCKETS];
+} lv_perf_stats_hist_t;
+
+/**
+ * Rolling statistics of the last `LV_PERF_STATS_HISTORY` frames
+ */
+typedef struct {
+    lv_perf_stats_frame_t last;         /**< The most recent frame*/
+    uint32_t frame_cnt;                 /**< Number of frames since the last reset*/
+    uint16_t window_cnt;                /**< Number of frames in the rolling window*/
+    uint32_t render_sum_us;             /**< Sum of `render_us` in the window*/
+    uint32_t flush_sum_us;              /**< Sum of `flush_us` in the window*/
+    uint32_t area_sum_px;               /**< Sum of `area_px` in the window*/
+    uint32_t render_max_us;             /**< Slowest render since the last reset*/
+    uint32_t flush_max_us;              /**< Slowest flush since the last reset*/
+    uint32_t draw_cnt[_LV_PERF_STATS_DRAW_LAST];    /**< Draw calls in the window*/
+    uint32_t culled_cnt;                /**< Objects skipped by the occlusion culling in the window*/
+    lv_perf_stats_hist_t render_hist;   /**< Histogram of `render_us` in the window*/
+    lv_perf_stats_hist_t flush_hist;    /**< Histogram of `flush_us` in the window*/
+    lv_perf_stats_hist_t area_hist;     /**< Histogram of `area_px` in the window*/
+} lv_perf_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+#if LV_USE_PERF_STATS
+
+/**
+ * Initialize the performance statistics. Called by `lv_init()`.
+ */
+void _lv_perf_stats_init(void);
+
+/**
+ * Get the current statistics
+ * @return pointer to the statistics. Valid until the next refresh.
+ */
+const lv_perf_stats_t * lv_perf_stats_get(void);
+
+/**
+ * Clear the rolling window and the counters
+ */
+void lv_perf_stats_reset(void);
+
+/**
+ * Get an approximate percentile from a histogram
+ * @param hist      pointer to a histogram, e.g. `&lv_perf_stats_get()->render_hist`
+ * @param pct       the percentile to get [0..100]
+ * @return          the upper limit of the bucket containing the percentile
+ */
+uint32_t lv_perf_stats_hist_percentile(const lv_perf_stats_hist_t * hist, uint8_t pct);
+
+/**
+ * Get the name of draw primitive, e.g. "rect"
+ * @param type      a draw primitive
+ * @return          a constant string
+ */
+const char * lv_perf_stats_draw_name(lv_perf_stats_draw_t type);
+
+/**
+ * Write the statistics into a buffer as a JSON object
+ * @param buf       buffer for the result
+ * @param buf_size  size of `buf`
+ * @return          length of the JSON string. If `>= buf_size` the output was truncated.
+ */
+uint32_t lv_perf_stats_to_json(char * buf, uint32_t buf_size);
+
+/**
+ * Write a short human readable summary of the statistics into a buffer
+ * @param buf       buffer for the result
+ * @param buf_size  size of `buf`
+ * @return          length of the text. If `>= buf_size` the output was truncated.
+ */
+uint32_t lv_perf_stats_to_text(char * buf, uint32_t buf_size);
+
+/**
+ * Show or hide the statistics overlay on the system layer of the default display.
+ * The overlay is hidden by default.
+ * @param en        true: show the overlay; false: hide it
+ */
+void lv_perf_stats_set_overlay(bool en);
+
+/**
+ * Tell whether the statistics overlay is shown
+ * @return true: the overlay is visible
+ */
+bool lv_perf_stats_get_overlay(void);
+
+/*=====================
+ * Internal hooks
+ *====================*/
+
+/**
+ * Get the current time in microseconds from the configured time source
+ * @return time in [us]
+ */
+uint32_t _lv_perf_stats_time_us(void);
+
+/**
+ * Mark the start of a refresh
+ */
+void _lv_perf_stats_frame_begin(void);
+
+/**
+ * Mark the end of a refresh.
+ * @param area_px       number of redrawn pixels
+ * @param area_cnt      number of drawn areas
+ * @param joined_cnt    number of joined areas
+ */
+void _lv_perf_stats_frame_end(uint32_t area_px, uint16_t area_cnt, uint16_t joined_cnt);
+
+/**
+ * Drop the frame in progress (e.g. nothing was redrawn)
+ */
+void _lv_perf_stats_frame_cancel(void);
+
+/**
+ * Add time spent with flushing to the frame in progress
+ * @param us            the elapsed time in [us]
+ */
+void _lv_perf_stats_add_flush_time(uint32_t us);
+
+/**
+ * Count a draw call in the frame in progress
+ * @param type          the draw primitive
+ */
+void _lv_perf_stats_add_draw(lv_perf_stats_draw_t type);
+
+/**
+ * Count an object skipped because it was covered by its siblings
+ */
+void _lv_perf_stats_add_culled(void);
+
+/**
+ * Update the overlay if it's shown. Called at the end of the refresh.
+ */
+void _lv_perf_stats_overlay_refr(void);
+
+#endif /*LV_USE_PERF_STATS*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#if LV_USE_PERF_STATS
+#  define LV_PERF_STATS_DRAW(type)  _lv_perf_stats_add_draw(type)
+#  define LV_PERF_STATS_CULLED()    _lv_perf_stats_add_culled()
+#else
+#  define LV_PERF_STATS_DRAW(type)
+#  define LV_PERF_STATS_CULLED()
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_PERF_STATS_H*/
@@ -16,8 +16,10 @@
 #include "../misc/lv_math.h"
 #include "../misc/lv_gc.h"
 #include "../draw/lv_draw.h"
+#include "../draw/sw/lv_draw_sw.h"
 #include "../font/lv_font_fmt_txt.h"
 #include "../extra/others/snapshot/lv_snapshot.h"
+#include "../extra/others/snapshot/lv_snapshot_cache.h"
 
 #if LV_USE_PERF_MONITOR || LV_USE_MEM_MONITOR
     #include "../widgets/lv_label.h"
@@ -26,10 +28,19 @@
 /*********************
  *      DEFINES
  *********************/
+/*Max. number of covering children to remember while refreshing the children of an object*/
+#define OCCLUSION_COVER_MAX     8
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_USE_OCCLUSION_CULLING
+typedef struct {
+    lv_area_t area;     /*The area covered by the child on the current clip area*/
+    uint32_t idx;       /*Index of the covering child*/
+} occlusion_cover_t;
+#endif
+
 typedef struct {
     uint32_t    perf_last_time;
     uint32_t    elaps_sum;
@@ -59,9 +70,17 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj);
 static void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
+static void refr_children_from(lv_draw_ctx_t * draw_ctx, lv_obj_t * parent, uint32_t start);
+#if LV_USE_OCCLUSION_CULLING
+    static uint32_t occlusion_get_covers(lv_draw_ctx_t * draw_ctx, lv_obj_t * parent, uint32_t start,
+                                         occlusion_cover_t covers[]);
+    static bool occlusion_is_covered(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj, uint32_t idx,
+                                     const occlusion_cover_t covers[], uint32_t cover_cnt);
+#endif
 static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h);
 static void draw_buf_flush(lv_disp_t * disp);
 static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
+static void wait_for_flushing(lv_disp_drv_t * drv);
 
 #if LV_USE_PERF_MONITOR
     static void perf_monitor_init(perf_monitor_t * perf_monitor);
@@ -108,6 +127,9 @@ void _lv_refr_init(void)
 #if LV_USE_MEM_MONITOR
     mem_monitor_init(&mem_monitor);
 #endif
+#if LV_USE_PERF_STATS
+    _lv_perf_stats_init();
+#endif
 }
 
 void lv_refr_now(lv_disp_t * disp)
@@ -175,12 +197,7 @@ void lv_obj_redraw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
 
     if(refr_children) {
         draw_ctx->clip_area = &clip_coords_for_children;
-        uint32_t i;
-        uint32_t child_cnt = lv_obj_get_child_cnt(obj);
-        for(i = 0; i < child_cnt; i++) {
-            lv_obj_t * child = obj->spec_attr->children[i];
-            refr_obj(draw_ctx, child);
-        }
+        refr_children_from(draw_ctx, obj, 0);
     }
 
     /*If the object was visible on the clip area call the post draw events too*/
@@ -305,6 +322,10 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
         disp_refr = lv_disp_get_default();
     }
 
+#if LV_USE_PERF_STATS
+    _lv_perf_stats_frame_begin();
+#endif
+
     /*Refresh the screen's layout if required*/
     lv_obj_update_layout(disp_refr->act_scr);
     if(disp_refr->prev_scr) lv_obj_update_layout(disp_refr->prev_scr);
@@ -315,6 +336,9 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     /*Do nothing if there is no active screen*/
     if(disp_refr->act_scr == NULL) {
         disp_refr->inv_p = 0;
+#if LV_USE_PERF_STATS
+        _lv_perf_stats_frame_cancel();
+#endif
         LV_LOG_WARN("there is no active screen");
         REFR_TRACE("finished");
         return;
@@ -340,6 +364,15 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
             }
         }
 
+#if LV_USE_PERF_STATS
+        uint16_t joined_cnt = 0;
+        uint16_t a;
+        for(a = 0; a < disp_refr->inv_p; a++) {
+            if(disp_refr->inv_area_joined[a]) joined_cnt++;
+        }
+        _lv_perf_stats_frame_end(px_num, disp_refr->inv_p - joined_cnt, joined_cnt);
+#endif
+
         /*Clean up*/
         lv_memset_00(disp_refr->inv_areas, sizeof(disp_refr->inv_areas));
         lv_memset_00(disp_refr->inv_area_joined, sizeof(disp_refr->inv_area_joined));
@@ -352,6 +385,11 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
             disp_refr->driver->monitor_cb(disp_refr->driver, elaps, px_num);
         }
     }
+#if LV_USE_PERF_STATS
+    else {
+        _lv_perf_stats_frame_cancel();
+    }
+#endif
 
     lv_mem_buf_free_all();
     _lv_font_clean_up_fmt_txt();
@@ -448,6 +486,10 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     }
 #endif
 
+#if LV_USE_PERF_STATS
+    _lv_perf_stats_overlay_refr();
+#endif
+
     REFR_TRACE("finished");
 }
 
@@ -608,6 +650,9 @@ static void refr_invalid_areas(void)
     disp_refr->driver->draw_buf->last_area = 0;
     disp_refr->driver->draw_buf->last_part = 0;
     disp_refr->rendering_in_progress = true;
+#if LV_DRAW_ARENA_SIZE
+    _lv_draw_arena_begin();
+#endif
 
     for(i = 0; i < disp_refr->inv_p; i++) {
         /*Refresh the unjoined areas*/
@@ -621,6 +666,10 @@ static void refr_invalid_areas(void)
         }
     }
 
+#if LV_DRAW_ARENA_SIZE
+    /*The layers and temporary buffers of this refresh are not used anymore*/
+    _lv_draw_arena_end();
+#endif
     disp_refr->rendering_in_progress = false;
 }
 
@@ -708,9 +757,7 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
     bool full_sized = draw_buf->size == (uint32_t)disp_refr->driver->hor_res * disp_refr->driver->ver_res;
     if((draw_buf->buf1 && !draw_buf->buf2) ||
        (draw_buf->buf1 && draw_buf->buf2 && full_sized)) {
-        while(draw_buf->flushing) {
-            if(disp_refr->driver->wait_cb) disp_refr->driver->wait_cb(disp_refr->driver);
-        }
+        wait_for_flushing(disp_refr->driver);
 
         /*If the screen is transparent initialize it when the flushing is ready*/
 #if LV_COLOR_SCREEN_TRANSP
@@ -863,19 +910,7 @@ static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj)
 
     /*Do until not reach the screen*/
     while(parent != NULL) {
-        bool go = false;
-        uint32_t i;
-        uint32_t child_cnt = lv_obj_get_child_cnt(parent);
-        for(i = 0; i < child_cnt; i++) {
-            lv_obj_t * child = parent->spec_attr->children[i];
-            if(!go) {
-                if(child == border_p) go = true;
-            }
-            else {
-                /*Refresh the objects*/
-                refr_obj(draw_ctx, child);
-            }
-        }
+        refr_children_from(draw_ctx, parent, lv_obj_get_index(border_p) + 1);
 
         /*Call the post draw draw function of the parents of the to object*/
         lv_event_send(parent, LV_EVENT_DRAW_POST_BEGIN, (void *)draw_ctx);
@@ -971,6 +1006,9 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
     lv_layer_type_t layer_type = _lv_obj_get_layer_type(obj);
     if(layer_type == LV_LAYER_TYPE_NONE) {
+#if LV_USE_SNAPSHOT && LV_USE_SNAPSHOT_CACHE
+        if(lv_obj_has_flag(obj, LV_OBJ_FLAG_CACHE_LAYER) && _lv_snapshot_cache_draw(draw_ctx, obj) == LV_RES_OK) return;
+#endif
         lv_obj_redraw(draw_ctx, obj);
     }
     else {
@@ -1050,6 +1088,139 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
     }
 }
 
+/**
+ * Refresh the children of an object starting from a given index.
+ * With `LV_USE_OCCLUSION_CULLING` the children fully covered by younger siblings are skipped.
+ * @param draw_ctx  pointer to the draw context. Its `clip_area` is the area to refresh
+ * @param parent    pointer to an object whose children should be refreshed
+ * @param start     index of the first child to refresh
+ */
+static void refr_children_from(lv_draw_ctx_t * draw_ctx, lv_obj_t * parent, uint32_t start)
+{
+    uint32_t child_cnt = lv_obj_get_child_cnt(parent);
+    if(start >= child_cnt) return;
+
+#if LV_USE_OCCLUSION_CULLING
+    /*At least 2 children are required to hide one*/
+    occlusion_cover_t covers[OCCLUSION_COVER_MAX];
+    uint32_t cover_cnt = child_cnt - start >= 2 ? occlusion_get_covers(draw_ctx, parent, start, covers) : 0;
+#endif
+
+    uint32_t i;
+    for(i = start; i < child_cnt; i++) {
+        lv_obj_t * child = parent->spec_attr->children[i];
+#if LV_USE_OCCLUSION_CULLING
+        if(cover_cnt && occlusion_is_covered(draw_ctx, child, i, covers, cover_cnt)) {
+            LV_PERF_STATS_CULLED();
+            continue;
+        }
+#endif
+        refr_obj(draw_ctx, child);
+    }
+}
+
+#if LV_USE_OCCLUSION_CULLING
+
+/**
+ * Get the area of an object which can be affected by drawing the object and its children
+ * @param obj       pointer to an object
+ * @param area      store the area here
+ * @return          false: the area can't be determined (e.g. the children can overflow)
+ */
+static bool occlusion_get_draw_area(lv_obj_t * obj, lv_area_t * area)
+{
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) return false;
+
+    lv_coord_t ext_draw_size = _lv_obj_get_ext_draw_size(obj);
+    lv_obj_get_coords(obj, area);
+    lv_area_increase(area, ext_draw_size, ext_draw_size);
+    if(_lv_obj_get_layer_type(obj) == LV_LAYER_TYPE_TRANSFORM) {
+        lv_obj_get_transformed_area(obj, area, false, false);
+    }
+
+    return true;
+}
+
+/**
+ * Collect the areas covered by the children of an object on the current clip area, front to back.
+ * A child covers an area if it's opaque, not transformed and is not covered by a younger sibling.
+ * @param draw_ctx  pointer to the draw context
+ * @param parent    pointer to an object
+ * @param start     index of the first child to refresh. This child can't cover anything.
+ * @param covers    array with `OCCLUSION_COVER_MAX` elements to store the covering areas
+ * @return          number of areas stored in `covers`
+ */
+static uint32_t occlusion_get_covers(lv_draw_ctx_t * draw_ctx, lv_obj_t * parent, uint32_t start,
+                                     occlusion_cover_t covers[])
+{
+    const lv_area_t * clip_area = draw_ctx->clip_area;
+    uint32_t cover_cnt = 0;
+    uint32_t i;
+    for(i = lv_obj_get_child_cnt(parent) - 1; i > start && cover_cnt < OCCLUSION_COVER_MAX; i--) {
+        lv_obj_t * child = parent->spec_attr->children[i];
+        if(lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN)) continue;
+        if(_lv_obj_get_layer_type(child) != LV_LAYER_TYPE_NONE) continue;
+        if(lv_obj_get_style_blend_mode(child, LV_PART_MAIN) != LV_BLEND_MODE_NORMAL) continue;
+
+        /*The rounded corners are not covered so check only the inner part*/
+        lv_area_t area;
+        lv_coord_t r = lv_obj_get_style_radius(child, LV_PART_MAIN);
+        lv_coord_t short_side = LV_MIN(lv_obj_get_width(child), lv_obj_get_height(child));
+        if(r > short_side / 2) r = short_side / 2;
+        lv_area_copy(&area, &child->coords);
+        lv_area_increase(&area, -r, -r);
+        if(!_lv_area_intersect(&area, &area, clip_area)) continue;
+
+        /*If already covered it can't cover more than the younger siblings*/
+        uint32_t k;
+        for(k = 0; k < cover_cnt; k++) {
+            if(_lv_area_is_in(&area, &covers[k].area, 0)) break;
+        }
+        if(k < cover_cnt) continue;
+
+        lv_cover_check_info_t info;
+        info.res = LV_COVER_RES_COVER;
+        info.area = &area;
+        lv_event_send(child, LV_EVENT_COVER_CHECK, &info);
+        if(info.res != LV_COVER_RES_COVER) continue;
+
+        covers[cover_cnt].area = area;
+        covers[cover_cnt].idx = i;
+        cover_cnt++;
+    }
+
+    return cover_cnt;
+}
+
+/**
+ * Check if an object is fully covered by a younger sibling on the current clip area
+ * @param draw_ctx  pointer to the draw context
+ * @param obj       pointer to an object
+ * @param idx       index of `obj` in its parent
+ * @param covers    the covering areas found by `occlusion_get_covers()`
+ * @param cover_cnt number of elements in `covers`
+ * @return          true: `obj` doesn't need to be drawn
+ */
+static bool occlusion_is_covered(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj, uint32_t idx,
+                                 const occlusion_cover_t covers[], uint32_t cover_cnt)
+{
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return false;
+
+    lv_area_t area;
+    if(!occlusion_get_draw_area(obj, &area)) return false;
+    /*Not drawn anyway*/
+    if(!_lv_area_intersect(&area, &area, draw_ctx->clip_area)) return false;
+
+    uint32_t k;
+    for(k = 0; k < cover_cnt; k++) {
+        if(covers[k].idx > idx && _lv_area_is_in(&area, &covers[k].area, 0)) return true;
+    }
+
+    return false;
+}
+
+#endif /*LV_USE_OCCLUSION_CULLING*/
+
 
 static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h)
 {
@@ -1113,26 +1284,6 @@ static void draw_buf_rotate_180(lv_disp_drv_t * drv, lv_area_t * area, lv_color_
     area->x1 = drv->hor_res - tmp_coord - 1;
 }
 
-static void LV_ATTRIBUTE_FAST_MEM draw_buf_rotate_90(bool invert_i, lv_coord_t area_w, lv_coord_t area_h,
-                                                     lv_color_t * orig_color_p, lv_color_t * rot_buf)
-{
-
-    uint32_t invert = (area_w * area_h) - 1;
-    uint32_t initial_i = ((area_w - 1) * area_h);
-    for(lv_coord_t y = 0; y < area_h; y++) {
-        uint32_t i = initial_i + y;
-        if(invert_i)
-            i = invert - i;
-        for(lv_coord_t x = 0; x < area_w; x++) {
-            rot_buf[i] = *(orig_color_p++);
-            if(invert_i)
-                i += area_h;
-            else
-                i -= area_h;
-        }
-    }
-}
-
 /**
  * Helper function for draw_buf_rotate_90_sqr. Given a list of four numbers, rotate the entire list to the left.
  */
@@ -1231,7 +1382,7 @@ static void draw_buf_rotate(lv_area_t * area, lv_color_t * color_p)
             else {
                 /*Rotate other areas using a maximum buffer size*/
                 if(rot_buf == NULL) rot_buf = lv_mem_buf_get(LV_DISP_ROT_MAX_BUF);
-                draw_buf_rotate_90(drv->rotated == LV_DISP_ROT_270, area_w, height, color_p, rot_buf);
+                lv_draw_sw_rotate(color_p, rot_buf, area_w, height, area_w, height, drv->rotated);
 
                 if(drv->rotated == LV_DISP_ROT_90) {
                     area->x1 = init_y_off + row;
@@ -1255,9 +1406,7 @@ static void draw_buf_rotate(lv_area_t * area, lv_color_t * color_p)
             /*Flush the completed area to the display*/
             call_flush_cb(drv, area, rot_buf == NULL ? color_p : rot_buf);
             /*FIXME: Rotation forces legacy behavior where rendering and flushing are done serially*/
-            while(draw_buf->flushing) {
-                if(drv->wait_cb) drv->wait_cb(drv);
-            }
+            wait_for_flushing(drv);
             color_p += area_w * height;
             row += height;
         }
@@ -1281,9 +1430,7 @@ static void draw_buf_flush(lv_disp_t * disp)
      * and driver is ready to receive the new buffer */
     bool full_sized = draw_buf->size == (uint32_t)disp_refr->driver->hor_res * disp_refr->driver->ver_res;
     if(draw_buf->buf1 && draw_buf->buf2 && !full_sized) {
-        while(draw_buf->flushing) {
-            if(disp_refr->driver->wait_cb) disp_refr->driver->wait_cb(disp_refr->driver);
-        }
+        wait_for_flushing(disp_refr->driver);
     }
 
     draw_buf->flushing = 1;
@@ -1324,7 +1471,37 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
         .y2 = area->y2 + drv->offset_y
     };
 
+#if LV_USE_PERF_STATS
+    uint32_t t_start = _lv_perf_stats_time_us();
+#endif
+
     drv->flush_cb(drv, &offset_area, color_p);
+
+#if LV_USE_PERF_STATS
+    _lv_perf_stats_add_flush_time(_lv_perf_stats_time_us() - t_start);
+#endif
+}
+
+/**
+ * Wait until the driver reports that the flushing is ready
+ * @param drv pointer to a display driver
+ */
+static void wait_for_flushing(lv_disp_drv_t * drv)
+{
+    lv_disp_draw_buf_t * draw_buf = drv->draw_buf;
+    if(!draw_buf->flushing) return;
+
+#if LV_USE_PERF_STATS
+    uint32_t t_start = _lv_perf_stats_time_us();
+#endif
+
+    while(draw_buf->flushing) {
+        if(drv->wait_cb) drv->wait_cb(drv);
+    }
+
+#if LV_USE_PERF_STATS
+    _lv_perf_stats_add_flush_time(_lv_perf_stats_time_us() - t_start);
+#endif
 }
 
 #if LV_USE_PERF_MONITOR
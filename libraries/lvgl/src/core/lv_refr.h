@@ -14,6 +14,7 @@ extern "C" {
  *      INCLUDES
  *********************/
 #include "lv_obj.h"
+#include "lv_perf_stats.h"
 #include <stdbool.h>
 
 /*********************
@@ -8,6 +8,7 @@
  *********************/
 #include "lv_draw.h"
 #include "lv_draw_arc.h"
+#include "../core/lv_perf_stats.h"
 
 /*********************
  *      DEFINES
@@ -48,6 +49,7 @@ void lv_draw_arc(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, const
     if(dsc->width == 0) return;
     if(start_angle == end_angle) return;
 
+    LV_PERF_STATS_DRAW(LV_PERF_STATS_DRAW_ARC);
     draw_ctx->draw_arc(draw_ctx, dsc, center, radius, start_angle, end_angle);
 
     //    const lv_draw_backend_t * backend = lv_draw_backend_get();
@@ -0,0 +1,156 @@
+/**
+ * @file lv_draw_arena.c
+ *
+ * An arena for the short living allocations of a refresh (layers, temporary buffers).
+ * The memories are taken from it one after the other and all are given back at once
+ * when the refresh ends, so they don't fragment the heap.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_arena.h"
+#if LV_DRAW_ARENA_SIZE
+
+#include "../misc/lv_assert.h"
+#include "../misc/lv_math.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define ARENA_ALIGN(x)  (((x) + 7) & ~(size_t)7)
+#define ARENA_NONE      UINT32_MAX
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*Stored before each allocation*/
+typedef struct {
+    uint32_t prev;      /*Offset of the header of the previous allocation*/
+    uint32_t released;
+} arena_header_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static LV_ATTRIBUTE_LARGE_RAM_ARRAY uint64_t arena_mem[ARENA_ALIGN(LV_DRAW_ARENA_SIZE) / sizeof(uint64_t)];
+static uint32_t top;                    /*Offset of the first unused byte*/
+static uint32_t last = ARENA_NONE;      /*Offset of the header of the last allocation*/
+static bool active;
+static lv_draw_arena_frame_stats_t frame;
+static lv_draw_arena_stats_t stats;
+
+/**********************
+ *      MACROS
+ **********************/
+#define ARENA_BASE      ((uint8_t *)arena_mem)
+#define HEADER_AT(ofs)  ((arena_header_t *)(ARENA_BASE + (ofs)))
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_arena_get_stats(lv_draw_arena_stats_t * stats_out)
+{
+    *stats_out = stats;
+    stats_out->size = sizeof(arena_mem);
+}
+
+void lv_draw_arena_reset_stats(void)
+{
+    lv_memset_00(&stats, sizeof(stats));
+}
+
+void _lv_draw_arena_begin(void)
+{
+    active = true;
+}
+
+void _lv_draw_arena_end(void)
+{
+    active = false;
+    top = 0;
+    last = ARENA_NONE;
+
+    stats.last = frame;
+    stats.max.alloc_cnt = LV_MAX(stats.max.alloc_cnt, frame.alloc_cnt);
+    stats.max.alloc_size = LV_MAX(stats.max.alloc_size, frame.alloc_size);
+    stats.max.peak_size = LV_MAX(stats.max.peak_size, frame.peak_size);
+    stats.max.fallback_cnt = LV_MAX(stats.max.fallback_cnt, frame.fallback_cnt);
+    stats.max.fallback_size = LV_MAX(stats.max.fallback_size, frame.fallback_size);
+    stats.frame_cnt++;
+    lv_memset_00(&frame, sizeof(frame));
+}
+
+void * _lv_draw_arena_get(size_t size)
+{
+    if(!active || size == 0) return NULL;
+
+    size_t req = sizeof(arena_header_t) + ARENA_ALIGN(size);
+    if(req > sizeof(arena_mem) - top) {
+        frame.fallback_cnt++;
+        frame.fallback_size += size;
+        return NULL;
+    }
+
+    arena_header_t * header = HEADER_AT(top);
+    header->prev = last;
+    header->released = 0;
+    last = top;
+    top += req;
+
+    frame.alloc_cnt++;
+    frame.alloc_size += size;
+    frame.peak_size = LV_MAX(frame.peak_size, top);
+    return header + 1;
+}
+
+void _lv_draw_arena_release(void * p)
+{
+    LV_ASSERT(_lv_draw_arena_is_in(p));
+
+    /*Everything was given back already at the end of the refresh*/
+    if(!active) return;
+
+    arena_header_t * header = (arena_header_t *)p - 1;
+    header->released = 1;
+
+    /*Reuse the end of the arena if the last allocations are released*/
+    while(last != ARENA_NONE && HEADER_AT(last)->released) {
+        top = last;
+        last = HEADER_AT(last)->prev;
+    }
+}
+
+bool _lv_draw_arena_is_in(const void * p)
+{
+    const uint8_t * p8 = p;
+    return p8 >= ARENA_BASE && p8 < ARENA_BASE + sizeof(arena_mem);
+}
+
+void * _lv_draw_arena_alloc(size_t size)
+{
+    void * p = _lv_draw_arena_get(size);
+    if(p) return p;
+
+    return lv_mem_alloc(size);
+}
+
+void _lv_draw_arena_free(void * p)
+{
+    if(p == NULL) return;
+
+    if(_lv_draw_arena_is_in(p)) _lv_draw_arena_release(p);
+    else lv_mem_free(p);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#endif /*LV_DRAW_ARENA_SIZE*/
@@ -0,0 +1,122 @@
+/**
+ * @file lv_draw_arena.h
+ *
+ */
+
+#ifndef LV_DRAW_ARENA_H
+#define LV_DRAW_ARENA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "../misc/lv_mem.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if LV_DRAW_ARENA_SIZE
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint32_t alloc_cnt;         /**< Allocations served by the arena*/
+    uint32_t alloc_size;        /**< Bytes requested from the arena*/
+    uint32_t peak_size;         /**< Max. bytes of the arena in use at the same time, including the headers*/
+    uint32_t fallback_cnt;      /**< Allocations which didn't fit into the arena*/
+    uint32_t fallback_size;     /**< Bytes requested by the allocations which didn't fit*/
+} lv_draw_arena_frame_stats_t;
+
+typedef struct {
+    lv_draw_arena_frame_stats_t last;   /**< The last refresh*/
+    lv_draw_arena_frame_stats_t max;    /**< The max. of each counter since the last reset*/
+    uint32_t frame_cnt;                 /**< Refreshes since the last reset*/
+    uint32_t size;                      /**< Size of the arena (`LV_DRAW_ARENA_SIZE`)*/
+} lv_draw_arena_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Get how the arena was used in the last refresh and at most in one refresh.
+ * @param stats     store the counters here
+ */
+void lv_draw_arena_get_stats(lv_draw_arena_stats_t * stats);
+
+/**
+ * Clear the counters of `lv_draw_arena_get_stats()`.
+ */
+void lv_draw_arena_reset_stats(void);
+
+/**
+ * Let the allocations use the arena. Called by the display refresh before drawing.
+ */
+void _lv_draw_arena_begin(void);
+
+/**
+ * Give back all the memory of the arena and stop using it. Called by the display refresh after drawing.
+ */
+void _lv_draw_arena_end(void);
+
+/**
+ * Allocate memory from the arena.
+ * @param size      the size in bytes
+ * @return          pointer to the memory or NULL if the arena is not used now or the memory doesn't fit into it
+ */
+void * _lv_draw_arena_get(size_t size);
+
+/**
+ * Give memory back to the arena. It can be reused in the same refresh
+ * only if it and all the memories allocated after it are released.
+ * @param p         pointer to a memory allocated with `_lv_draw_arena_get()`
+ */
+void _lv_draw_arena_release(void * p);
+
+/**
+ * Check whether a memory is in the arena.
+ * @param p         pointer to a memory
+ * @return          true: it was allocated from the arena
+ */
+bool _lv_draw_arena_is_in(const void * p);
+
+/**
+ * Allocate memory from the arena or with `lv_mem_alloc()` if it doesn't fit.
+ * It should be freed with `_lv_draw_arena_free()` in the same refresh.
+ * @param size      the size in bytes
+ * @return          pointer to the allocated memory or NULL on error
+ */
+void * _lv_draw_arena_alloc(size_t size);
+
+/**
+ * Free a memory allocated with `_lv_draw_arena_alloc()`.
+ * @param p         pointer to the memory
+ */
+void _lv_draw_arena_free(void * p);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#else /*LV_DRAW_ARENA_SIZE*/
+
+#define _lv_draw_arena_alloc(size)  lv_mem_alloc(size)
+#define _lv_draw_arena_free(p)      lv_mem_free(p)
+
+#endif /*LV_DRAW_ARENA_SIZE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_ARENA_H*/
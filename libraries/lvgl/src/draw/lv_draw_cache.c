@@ -0,0 +1,261 @@
+/**
+ * @file lv_draw_cache.c
+ *
+ * One memory budget and LRU order for the image, gradient, shadow, circle and layer snapshot caches.
+ * The caches store their items themselves and link them into one list with an embedded
+ * `lv_draw_cache_entry_t`. When a new item doesn't fit, the least recently used items are
+ * dropped regardless of their type.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_cache.h"
+#if LV_DRAW_CACHE_BUDGET
+
+#include "../misc/lv_assert.h"
+#include "../misc/lv_gc.h"
+#include "../misc/lv_mem.h"
+
+#if LV_DRAW_CACHE_MEM_CUSTOM
+    #include LV_DRAW_CACHE_MEM_CUSTOM_INCLUDE
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void unlink_entry(lv_draw_cache_entry_t * entry);
+static void link_entry(lv_draw_cache_entry_t * entry);
+static bool make_room(size_t size, const lv_draw_cache_entry_t * skip);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static size_t budget = LV_DRAW_CACHE_BUDGET;
+static size_t used_size;
+static lv_draw_cache_entry_t * mru;     /*The other end of the list, `_lv_draw_cache_lru` is the least recently used*/
+static lv_draw_cache_stats_t stats[_LV_DRAW_CACHE_TYPE_NUM];
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_cache_set_budget(size_t new_budget)
+{
+    budget = new_budget;
+    if(used_size > budget) make_room(0, NULL);
+}
+
+size_t lv_draw_cache_get_budget(void)
+{
+    return budget;
+}
+
+size_t lv_draw_cache_get_size(void)
+{
+    return used_size;
+}
+
+void lv_draw_cache_get_stats(lv_draw_cache_type_t type, lv_draw_cache_stats_t * stats_out)
+{
+    if(type < _LV_DRAW_CACHE_TYPE_NUM) {
+        *stats_out = stats[type];
+        return;
+    }
+
+    lv_memset_00(stats_out, sizeof(lv_draw_cache_stats_t));
+    uint32_t i;
+    for(i = 0; i < _LV_DRAW_CACHE_TYPE_NUM; i++) {
+        stats_out->hit += stats[i].hit;
+        stats_out->miss += stats[i].miss;
+        stats_out->evict += stats[i].evict;
+        stats_out->entry_cnt += stats[i].entry_cnt;
+        stats_out->size += stats[i].size;
+    }
+}
+
+void lv_draw_cache_reset_stats(void)
+{
+    uint32_t i;
+    for(i = 0; i < _LV_DRAW_CACHE_TYPE_NUM; i++) {
+        stats[i].hit = 0;
+        stats[i].miss = 0;
+        stats[i].evict = 0;
+    }
+}
+
+void lv_draw_cache_drop_all(void)
+{
+    lv_draw_cache_entry_t * entry = LV_GC_ROOT(_lv_draw_cache_lru);
+    while(entry) {
+        lv_draw_cache_entry_t * next = entry->next;
+        if(entry->used_cnt == 0) _lv_draw_cache_evict(entry);
+        entry = next;
+    }
+}
+
+void _lv_draw_cache_init(void)
+{
+    budget = LV_DRAW_CACHE_BUDGET;
+    used_size = 0;
+    mru = NULL;
+    LV_GC_ROOT(_lv_draw_cache_lru) = NULL;
+    lv_memset_00(stats, sizeof(stats));
+}
+
+void _lv_draw_cache_deinit(void)
+{
+    /*The items might be out of LVGL's heap (`LV_DRAW_CACHE_MEM_CUSTOM`) so free them*/
+    lv_draw_cache_drop_all();
+    _lv_draw_cache_init();
+}
+
+void * _lv_draw_cache_alloc(size_t size)
+{
+#if LV_DRAW_CACHE_MEM_CUSTOM
+    void * p = LV_DRAW_CACHE_MEM_CUSTOM_ALLOC(size);
+#else
+    void * p = lv_mem_alloc(size);
+#endif
+    LV_ASSERT_MALLOC(p);
+    return p;
+}
+
+void _lv_draw_cache_free(void * p)
+{
+    if(p == NULL) return;
+#if LV_DRAW_CACHE_MEM_CUSTOM
+    LV_DRAW_CACHE_MEM_CUSTOM_FREE(p);
+#else
+    lv_mem_free(p);
+#endif
+}
+
+bool _lv_draw_cache_add(lv_draw_cache_entry_t * entry, lv_draw_cache_type_t type, size_t size,
+                        lv_draw_cache_evict_cb_t evict_cb)
+{
+    LV_ASSERT(entry->linked == 0);
+
+    if(size > budget) return false;
+    if(!make_room(size, entry)) return false;
+
+    entry->type = type;
+    entry->size = size;
+    entry->evict_cb = evict_cb;
+    link_entry(entry);
+
+    used_size += size;
+    stats[type].size += size;
+    stats[type].entry_cnt++;
+    return true;
+}
+
+void _lv_draw_cache_remove(lv_draw_cache_entry_t * entry)
+{
+    if(!entry->linked) return;
+
+    unlink_entry(entry);
+    used_size -= entry->size;
+    stats[entry->type].size -= entry->size;
+    stats[entry->type].entry_cnt--;
+}
+
+void _lv_draw_cache_evict(lv_draw_cache_entry_t * entry)
+{
+    LV_ASSERT(entry->used_cnt == 0);
+
+    /*Remove it first as `evict_cb` might free the entry too*/
+    stats[entry->type].evict++;
+    _lv_draw_cache_remove(entry);
+    entry->evict_cb(entry);
+}
+
+lv_draw_cache_entry_t * _lv_draw_cache_find(lv_draw_cache_type_t type, uint32_t key,
+                                            lv_draw_cache_match_cb_t match_cb, const void * ctx)
+{
+    /*The recently used items are the most likely to be used again*/
+    lv_draw_cache_entry_t * entry = mru;
+    while(entry) {
+        if(entry->key == key && entry->type == type && (match_cb == NULL || match_cb(entry, ctx))) {
+            _lv_draw_cache_hit(entry);
+            return entry;
+        }
+        entry = entry->prev;
+    }
+
+    stats[type].miss++;
+    return NULL;
+}
+
+void _lv_draw_cache_hit(lv_draw_cache_entry_t * entry)
+{
+    stats[entry->type].hit++;
+    if(entry->linked && entry != mru) {
+        unlink_entry(entry);
+        link_entry(entry);
+    }
+}
+
+void _lv_draw_cache_miss(lv_draw_cache_type_t type)
+{
+    stats[type].miss++;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void unlink_entry(lv_draw_cache_entry_t * entry)
+{
+    if(entry->prev) entry->prev->next = entry->next;
+    else LV_GC_ROOT(_lv_draw_cache_lru) = entry->next;
+
+    if(entry->next) entry->next->prev = entry->prev;
+    else mru = entry->prev;
+
+    entry->prev = NULL;
+    entry->next = NULL;
+    entry->linked = 0;
+}
+
+static void link_entry(lv_draw_cache_entry_t * entry)
+{
+    entry->prev = mru;
+    entry->next = NULL;
+    if(mru) mru->next = entry;
+    else LV_GC_ROOT(_lv_draw_cache_lru) = entry;
+    mru = entry;
+    entry->linked = 1;
+}
+
+/**
+ * Drop the least recently used items until `size` more bytes fit into the budget.
+ * @param size      the bytes to free
+ * @param skip      don't drop this entry
+ * @return          true: there is enough room
+ */
+static bool make_room(size_t size, const lv_draw_cache_entry_t * skip)
+{
+    lv_draw_cache_entry_t * entry = LV_GC_ROOT(_lv_draw_cache_lru);
+    while(entry && used_size + size > budget) {
+        lv_draw_cache_entry_t * next = entry->next;
+        if(entry != skip && entry->used_cnt == 0) _lv_draw_cache_evict(entry);
+        entry = next;
+    }
+
+    return used_size + size <= budget;
+}
+
+#endif /*LV_DRAW_CACHE_BUDGET*/
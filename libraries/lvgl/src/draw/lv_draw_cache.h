@@ -0,0 +1,199 @@
+/**
+ * @file lv_draw_cache.h
+ *
+ */
+
+#ifndef LV_DRAW_CACHE_H
+#define LV_DRAW_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if LV_DRAW_CACHE_BUDGET
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    LV_DRAW_CACHE_TYPE_IMG,
+    LV_DRAW_CACHE_TYPE_GRAD,
+    LV_DRAW_CACHE_TYPE_SHADOW,
+    LV_DRAW_CACHE_TYPE_CIRCLE,
+    LV_DRAW_CACHE_TYPE_LAYER,       /**< Snapshots of the objects with `LV_OBJ_FLAG_CACHE_LAYER`*/
+    _LV_DRAW_CACHE_TYPE_NUM
+} lv_draw_cache_type_t;
+
+struct _lv_draw_cache_entry_t;
+
+/**
+ * Free a cached item. The entry is already removed from the cache.
+ * @param entry     the entry of the item
+ */
+typedef void (*lv_draw_cache_evict_cb_t)(struct _lv_draw_cache_entry_t * entry);
+
+/**
+ * Check whether a cached item is the searched one.
+ * @param entry     the entry of the item
+ * @param ctx       the `ctx` parameter of `_lv_draw_cache_find()`
+ * @return          true: it's the searched item
+ */
+typedef bool (*lv_draw_cache_match_cb_t)(const struct _lv_draw_cache_entry_t * entry, const void * ctx);
+
+/**
+ * Embedded into the items of the caches to link them into the shared LRU list.
+ */
+typedef struct _lv_draw_cache_entry_t {
+    struct _lv_draw_cache_entry_t * prev;   /**< The less recently used entry*/
+    struct _lv_draw_cache_entry_t * next;   /**< The more recently used entry*/
+    lv_draw_cache_evict_cb_t evict_cb;
+    size_t size;                            /**< Bytes accounted to the budget*/
+    uint32_t key;                           /**< Hash of the item to speed up the search*/
+    uint16_t used_cnt;                      /**< The item is not evicted while it's in use*/
+    uint8_t type;                           /**< An `lv_draw_cache_type_t`*/
+    uint8_t linked : 1;                     /**< It's in the cache*/
+} lv_draw_cache_entry_t;
+
+typedef struct {
+    uint32_t hit;
+    uint32_t miss;
+    uint32_t evict;         /**< Items dropped to make room for other items*/
+    uint32_t entry_cnt;     /**< Items in the cache*/
+    size_t size;            /**< Bytes used by the items in the cache*/
+} lv_draw_cache_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Set the memory budget of the image, gradient, shadow, circle and layer snapshot caches.
+ * The least recently used items are dropped until the cached items fit into it.
+ * @param budget    the new budget in bytes, 0 to cache nothing
+ */
+void lv_draw_cache_set_budget(size_t budget);
+
+/**
+ * Get the memory budget of the caches.
+ * @return          the budget in bytes
+ */
+size_t lv_draw_cache_get_budget(void);
+
+/**
+ * Get the number of bytes used by all the cached items.
+ * @return          the used bytes
+ */
+size_t lv_draw_cache_get_size(void);
+
+/**
+ * Get the counters of a cache.
+ * @param type      the type of the cache or `_LV_DRAW_CACHE_TYPE_NUM` to get the sum of all caches
+ * @param stats     store the counters here
+ */
+void lv_draw_cache_get_stats(lv_draw_cache_type_t type, lv_draw_cache_stats_t * stats);
+
+/**
+ * Clear the hit, miss and evict counters of all caches.
+ */
+void lv_draw_cache_reset_stats(void);
+
+/**
+ * Drop all the items which are not in use, e.g. to free memory or to start a measurement from an empty cache.
+ */
+void lv_draw_cache_drop_all(void);
+
+/**
+ * Reset the budget, the list and the counters. Called by `lv_init()`.
+ */
+void _lv_draw_cache_init(void);
+
+/**
+ * Drop all the items and reset the list and the counters. Called by `lv_deinit()`.
+ */
+void _lv_draw_cache_deinit(void);
+
+/**
+ * Allocate memory for a cached item with `LV_DRAW_CACHE_MEM_CUSTOM_ALLOC` or `lv_mem_alloc()`.
+ * @param size      the size in bytes
+ * @return          pointer to the allocated memory or NULL on error
+ */
+void * _lv_draw_cache_alloc(size_t size);
+
+/**
+ * Free memory allocated with `_lv_draw_cache_alloc()`.
+ * @param p         pointer to the memory
+ */
+void _lv_draw_cache_free(void * p);
+
+/**
+ * Add an item to the cache as the most recently used. Drop the least recently used items
+ * until it fits into the budget. Can be called before allocating the item to free memory first.
+ * @param entry     the entry of the item, `key` should be set already
+ * @param type      the type of the cache
+ * @param size      the size of the item in bytes
+ * @param evict_cb  called when the item is dropped
+ * @return          true: added; false: the item doesn't fit into the budget, it's not added
+ */
+bool _lv_draw_cache_add(lv_draw_cache_entry_t * entry, lv_draw_cache_type_t type, size_t size,
+                        lv_draw_cache_evict_cb_t evict_cb);
+
+/**
+ * Remove an item from the cache without calling its `evict_cb`, e.g. when it's invalidated.
+ * @param entry     the entry of the item. Nothing happens if it's not added.
+ */
+void _lv_draw_cache_remove(lv_draw_cache_entry_t * entry);
+
+/**
+ * Remove an item from the cache and call its `evict_cb` to free it. It's counted as an eviction.
+ * @param entry     the entry of the item, it shouldn't be in use
+ */
+void _lv_draw_cache_evict(lv_draw_cache_entry_t * entry);
+
+/**
+ * Search an item of a cache. A found item is counted as a hit and becomes the most recently used.
+ * Otherwise a miss is counted.
+ * @param type      the type of the cache
+ * @param key       the hash of the item
+ * @param match_cb  compare the items with matching `key` to the searched one. NULL if `key` is enough.
+ * @param ctx       passed to `match_cb`
+ * @return          the entry of the found item or NULL
+ */
+lv_draw_cache_entry_t * _lv_draw_cache_find(lv_draw_cache_type_t type, uint32_t key,
+                                            lv_draw_cache_match_cb_t match_cb, const void * ctx);
+
+/**
+ * Count a hit for an item found by the cache itself and make it the most recently used.
+ * @param entry     the entry of the item
+ */
+void _lv_draw_cache_hit(lv_draw_cache_entry_t * entry);
+
+/**
+ * Count a miss for a cache which searches its items itself.
+ * @param type      the type of the cache
+ */
+void _lv_draw_cache_miss(lv_draw_cache_type_t type);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_DRAW_CACHE_BUDGET*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_CACHE_H*/
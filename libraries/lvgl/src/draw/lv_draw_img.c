@@ -70,6 +70,8 @@ void lv_draw_img(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc, const
 
     if(dsc->opa <= LV_OPA_MIN) return;
 
+    LV_PERF_STATS_DRAW(LV_PERF_STATS_DRAW_IMG);
+
     lv_res_t res = LV_RES_INV;
 
     if(draw_ctx->draw_img) {
@@ -247,6 +249,11 @@ static lv_res_t LV_ATTRIBUTE_FAST_MEM decode_and_draw(lv_draw_ctx_t * draw_ctx,
 
     if(cdsc == NULL) return LV_RES_INV;
 
+#if LV_DRAW_CACHE_BUDGET && LV_IMG_CACHE_DEF_SIZE
+    /*Don't let the other caches drop it while drawing*/
+    cdsc->cache.used_cnt++;
+#endif
+
     lv_img_cf_t cf;
     if(lv_img_cf_is_chroma_keyed(cdsc->dec_dsc.header.cf)) cf = LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED;
     else if(LV_IMG_CF_ALPHA_8BIT == cdsc->dec_dsc.header.cf) cf = LV_IMG_CF_ALPHA_8BIT;
@@ -369,6 +376,12 @@ static void draw_cleanup(_lv_img_cache_entry_t * cache)
     /*Automatically close images with no caching*/
 #if LV_IMG_CACHE_DEF_SIZE == 0
     lv_img_decoder_close(&cache->dec_dsc);
+#elif LV_DRAW_CACHE_BUDGET
+    cache->cache.used_cnt--;
+    if(cache->not_cached) {
+        lv_img_decoder_close(&cache->dec_dsc);
+        lv_memset_00(cache, sizeof(_lv_img_cache_entry_t));
+    }
 #else
     LV_UNUSED(cache);
 #endif
@@ -35,6 +35,10 @@ typedef uint8_t cmd_state_t;
  **********************/
 
 static uint8_t hex_char_to_num(char hex);
+static inline uint32_t get_line_end(const lv_draw_label_dsc_t * dsc, const char * txt, uint32_t line_idx,
+                                    uint32_t line_start, lv_coord_t max_w);
+static inline lv_coord_t get_line_width(const lv_draw_label_dsc_t * dsc, const char * txt, uint32_t line_idx,
+                                        uint32_t line_start, uint32_t line_end);
 
 /**********************
  *  STATIC VARIABLES
@@ -101,13 +105,15 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
     bool clip_ok = _lv_area_intersect(&clipped_area, coords, draw_ctx->clip_area);
     if(!clip_ok) return;
 
+    LV_PERF_STATS_DRAW(LV_PERF_STATS_DRAW_LABEL);
+
     lv_text_align_t align = dsc->align;
     lv_base_dir_t base_dir = dsc->bidi_dir;
 
     lv_bidi_calculate_align(&align, &base_dir, txt);
 
-    if((dsc->flag & LV_TEXT_FLAG_EXPAND) == 0) {
-        /*Normally use the label's width as width*/
+    if((dsc->flag & LV_TEXT_FLAG_EXPAND) == 0 || dsc->lines) {
+        /*Normally use the label's width as width. The measured lines need no width at all.*/
         w = lv_area_get_width(coords);
     }
     else {
@@ -134,8 +140,12 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
     pos.y += y_ofs;
 
     uint32_t line_start     = 0;
+    uint32_t line_idx       = 0;
     int32_t last_line_start = -1;
 
+    /*With measured lines it's fast to skip the invisible lines, the hint is not required*/
+    if(dsc->lines) hint = NULL;
+
     /*Check the hint to use the cached info*/
     if(hint && y_ofs == 0 && coords->y1 < 0) {
         /*If the label changed too much recalculate the hint.*/
@@ -151,13 +161,14 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
         pos.y += hint->y;
     }
 
-    uint32_t line_end = line_start + _lv_txt_get_next_line(&txt[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+    uint32_t line_end = get_line_end(dsc, txt, line_idx, line_start, w);
 
     /*Go the first visible line*/
     while(pos.y + line_height_font < draw_ctx->clip_area->y1) {
         /*Go to next line*/
         line_start = line_end;
-        line_end += _lv_txt_get_next_line(&txt[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line_idx++;
+        line_end = get_line_end(dsc, txt, line_idx, line_start, w);
         pos.y += line_height;
 
         /*Save at the threshold coordinate*/
@@ -172,14 +183,14 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
 
     /*Align to middle*/
     if(align == LV_TEXT_ALIGN_CENTER) {
-        line_width = lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+        line_width = get_line_width(dsc, txt, line_idx, line_start, line_end);
 
         pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
     }
     /*Align to the right*/
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        line_width = lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+        line_width = get_line_width(dsc, txt, line_idx, line_start, line_end);
         pos.x += lv_area_get_width(coords) - line_width;
     }
     uint32_t sel_start = dsc->sel_start;
@@ -334,21 +345,20 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
 #endif
         /*Go to next line*/
         line_start = line_end;
-        line_end += _lv_txt_get_next_line(&txt[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line_idx++;
+        line_end = get_line_end(dsc, txt, line_idx, line_start, w);
 
         pos.x = coords->x1;
         /*Align to middle*/
         if(align == LV_TEXT_ALIGN_CENTER) {
-            line_width =
-                lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+            line_width = get_line_width(dsc, txt, line_idx, line_start, line_end);
 
             pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
         }
         /*Align to the right*/
         else if(align == LV_TEXT_ALIGN_RIGHT) {
-            line_width =
-                lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+            line_width = get_line_width(dsc, txt, line_idx, line_start, line_end);
             pos.x += lv_area_get_width(coords) - line_width;
         }
 
@@ -415,3 +425,39 @@ static uint8_t hex_char_to_num(char hex)
     return result;
 }
 
+/**
+ * Get where a line ends from the measured lines or by breaking the text
+ * @param dsc           pointer to the draw descriptor
+ * @param txt           the text
+ * @param line_idx      index of the line
+ * @param line_start    byte index of the first character of the line
+ * @param max_w         max. width of the line if it's not measured
+ * @return              byte index of the first character of the next line
+ */
+static inline uint32_t get_line_end(const lv_draw_label_dsc_t * dsc, const char * txt, uint32_t line_idx,
+                                    uint32_t line_start, lv_coord_t max_w)
+{
+    if(dsc->lines == NULL) {
+        return line_start + _lv_txt_get_next_line(&txt[line_start], dsc->font, dsc->letter_space, max_w, NULL, dsc->flag);
+    }
+
+    if(line_idx >= dsc->line_cnt) return line_start;
+    return dsc->lines[line_idx + 1].start;
+}
+
+/**
+ * Get the width of a line from the measured lines or by measuring it
+ * @param dsc           pointer to the draw descriptor
+ * @param txt           the text
+ * @param line_idx      index of the line
+ * @param line_start    byte index of the first character of the line
+ * @param line_end      byte index of the first character of the next line
+ * @return              width of the line
+ */
+static inline lv_coord_t get_line_width(const lv_draw_label_dsc_t * dsc, const char * txt, uint32_t line_idx,
+                                        uint32_t line_start, uint32_t line_end)
+{
+    if(dsc->lines && line_idx < dsc->line_cnt) return dsc->lines[line_idx].w;
+
+    return lv_txt_get_width(&txt[line_start], line_end - line_start, dsc->font, dsc->letter_space, dsc->flag);
+}
@@ -27,8 +27,18 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/** A line of a text measured in advance. See `lines` in `lv_draw_label_dsc_t`*/
+typedef struct {
+    uint32_t start;     /**< Byte index of the first character of the line*/
+    lv_coord_t w;       /**< Width of the line*/
+} lv_draw_label_line_t;
+
 typedef struct {
     const lv_font_t * font;
+    /*Optional line breaks of the text measured with the same font, letter space, width and flags.
+     *`line_cnt + 1` elements, the last one is the end of the text. NULL: measure the lines while drawing*/
+    const lv_draw_label_line_t * lines;
+    uint32_t line_cnt;
     uint32_t sel_start;
     uint32_t sel_end;
     lv_color_t color;
@@ -39,7 +39,7 @@ lv_draw_layer_ctx_t * lv_draw_layer_create(lv_draw_ctx_t * draw_ctx, const lv_ar
 {
     if(draw_ctx->layer_init == NULL) return NULL;
 
-    lv_draw_layer_ctx_t * layer_ctx = lv_mem_alloc(draw_ctx->layer_instance_size);
+    lv_draw_layer_ctx_t * layer_ctx = _lv_draw_arena_alloc(draw_ctx->layer_instance_size);
     LV_ASSERT_MALLOC(layer_ctx);
     if(layer_ctx == NULL) {
         LV_LOG_WARN("Couldn't allocate a new layer context");
@@ -48,6 +48,8 @@ lv_draw_layer_ctx_t * lv_draw_layer_create(lv_draw_ctx_t * draw_ctx, const lv_ar
 
     lv_memset_00(layer_ctx, draw_ctx->layer_instance_size);
 
+    LV_PERF_STATS_DRAW(LV_PERF_STATS_DRAW_LAYER);
+
     lv_disp_t * disp_refr = _lv_refr_get_disp_refreshing();
     layer_ctx->original.buf = draw_ctx->buf;
     layer_ctx->original.buf_area = draw_ctx->buf_area;
@@ -57,7 +59,7 @@ lv_draw_layer_ctx_t * lv_draw_layer_create(lv_draw_ctx_t * draw_ctx, const lv_ar
 
     lv_draw_layer_ctx_t * init_layer_ctx =  draw_ctx->layer_init(draw_ctx, layer_ctx, flags);
     if(NULL == init_layer_ctx) {
-        lv_mem_free(layer_ctx);
+        _lv_draw_arena_free(layer_ctx);
     }
     return init_layer_ctx;
 }
@@ -85,7 +87,7 @@ void lv_draw_layer_destroy(lv_draw_ctx_t * draw_ctx, lv_draw_layer_ctx_t * layer
     disp_refr->driver->screen_transp = layer_ctx->original.screen_transp;
 
     if(draw_ctx->layer_destroy) draw_ctx->layer_destroy(draw_ctx, layer_ctx);
-    lv_mem_free(layer_ctx);
+    _lv_draw_arena_free(layer_ctx);
 }
 
 /**********************
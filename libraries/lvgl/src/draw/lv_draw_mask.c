@@ -56,6 +56,9 @@ static void circ_init(lv_point_t * c, lv_coord_t * tmp, lv_coord_t radius);
 static bool circ_cont(lv_point_t * c);
 static void circ_next(lv_point_t * c, lv_coord_t * tmp);
 static void circ_calc_aa4(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t radius);
+#if LV_DRAW_CACHE_BUDGET
+    static void circle_evict_cb(lv_draw_cache_entry_t * entry);
+#endif
 static lv_opa_t * get_next_line(_lv_draw_mask_radius_circle_dsc_t * c, lv_coord_t y, lv_coord_t * len,
                                 lv_coord_t * x_start);
 static inline lv_opa_t /* LV_ATTRIBUTE_FAST_MEM */ mask_mix(lv_opa_t mask_act, lv_opa_t mask_new);
@@ -220,6 +223,9 @@ void lv_draw_mask_free_param(void * p)
             }
             else {
                 radius_p->circle->used_cnt--;
+#if LV_DRAW_CACHE_BUDGET
+                radius_p->circle->cache.used_cnt--;
+#endif
             }
         }
     }
@@ -233,6 +239,10 @@ void _lv_draw_mask_cleanup(void)
 {
     uint8_t i;
     for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
+#if LV_DRAW_CACHE_BUDGET
+        /*Keep the cached circles for the next frames*/
+        if(LV_GC_ROOT(_lv_circle_cache[i]).cache.linked) continue;
+#endif
         if(LV_GC_ROOT(_lv_circle_cache[i]).buf) {
             lv_mem_free(LV_GC_ROOT(_lv_circle_cache[i]).buf);
         }
@@ -499,10 +509,18 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
             LV_GC_ROOT(_lv_circle_cache[i]).used_cnt++;
             CIRCLE_CACHE_AGING(LV_GC_ROOT(_lv_circle_cache[i]).life, radius);
             param->circle = &LV_GC_ROOT(_lv_circle_cache[i]);
+#if LV_DRAW_CACHE_BUDGET
+            param->circle->cache.used_cnt++;
+            _lv_draw_cache_hit(&param->circle->cache);
+#endif
             return;
         }
     }
 
+#if LV_DRAW_CACHE_BUDGET
+    _lv_draw_cache_miss(LV_DRAW_CACHE_TYPE_CIRCLE);
+#endif
+
     /*If not found find a free entry with lowest life*/
     _lv_draw_mask_radius_circle_dsc_t * entry = NULL;
     for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
@@ -519,6 +537,14 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
         entry->life = -1;
     }
     else {
+#if LV_DRAW_CACHE_BUDGET
+        /*Replace a circle of an other radius*/
+        if(entry->cache.linked) _lv_draw_cache_evict(&entry->cache);
+
+        /*If it doesn't fit into the budget, it's freed at the end of the frame*/
+        _lv_draw_cache_add(&entry->cache, LV_DRAW_CACHE_TYPE_CIRCLE, radius * 6 + 6, circle_evict_cb);
+        entry->cache.used_cnt++;
+#endif
         entry->used_cnt++;
         entry->life = 0;
         CIRCLE_CACHE_AGING(entry->life, radius);
@@ -1528,4 +1554,14 @@ static inline lv_opa_t LV_ATTRIBUTE_FAST_MEM mask_mix(lv_opa_t mask_act, lv_opa_
 }
 
 
+#if LV_DRAW_CACHE_BUDGET
+static void circle_evict_cb(lv_draw_cache_entry_t * entry)
+{
+    _lv_draw_mask_radius_circle_dsc_t * c = (_lv_draw_mask_radius_circle_dsc_t *)entry;
+    lv_mem_free(c->buf);
+    lv_memset_00(c, sizeof(_lv_draw_mask_radius_circle_dsc_t));
+}
+#endif
+
+
 #endif /*LV_DRAW_COMPLEX*/
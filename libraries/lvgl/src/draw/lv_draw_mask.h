@@ -18,6 +18,7 @@ extern "C" {
 #include "../misc/lv_area.h"
 #include "../misc/lv_color.h"
 #include "../misc/lv_math.h"
+#include "lv_draw_cache.h"
 
 /*********************
  *      DEFINES
@@ -154,6 +155,9 @@ typedef struct {
 } lv_draw_mask_angle_param_t;
 
 typedef struct  {
+#if LV_DRAW_CACHE_BUDGET
+    lv_draw_cache_entry_t cache;    /*Must be the first*/
+#endif
     uint8_t * buf;
     lv_opa_t * cir_opa;         /*Opacity of values on the circumference of an 1/4 circle*/
     uint16_t * x_start_on_y;        /*The x coordinate of the circle for each y value*/
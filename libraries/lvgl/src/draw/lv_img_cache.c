@@ -36,6 +36,10 @@
 #if LV_IMG_CACHE_DEF_SIZE
     static bool lv_img_cache_match(const void * src1, const void * src2);
 #endif
+#if LV_DRAW_CACHE_BUDGET && LV_IMG_CACHE_DEF_SIZE
+    static size_t get_decoded_size(const _lv_img_cache_entry_t * entry);
+    static void img_evict_cb(lv_draw_cache_entry_t * entry);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -91,6 +95,9 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
             cached_src = &cache[i];
             cached_src->life += cached_src->dec_dsc.time_to_open * LV_IMG_CACHE_LIFE_GAIN;
             if(cached_src->life > LV_IMG_CACHE_LIFE_LIMIT) cached_src->life = LV_IMG_CACHE_LIFE_LIMIT;
+#if LV_DRAW_CACHE_BUDGET
+            _lv_draw_cache_hit(&cached_src->cache);
+#endif
             LV_LOG_TRACE("image source found in the cache");
             break;
         }
@@ -107,6 +114,12 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
         }
     }
 
+#if LV_DRAW_CACHE_BUDGET
+    /*Evicting an entry closes its decoder too*/
+    _lv_draw_cache_miss(LV_DRAW_CACHE_TYPE_IMG);
+    if(cached_src->cache.linked) _lv_draw_cache_evict(&cached_src->cache);
+#endif
+
     /*Close the decoder to reuse if it was opened (has a valid source)*/
     if(cached_src->dec_dsc.src) {
         lv_img_decoder_close(&cached_src->dec_dsc);
@@ -137,6 +150,16 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
 
     if(cached_src->dec_dsc.time_to_open == 0) cached_src->dec_dsc.time_to_open = 1;
 
+#if LV_DRAW_CACHE_BUDGET && LV_IMG_CACHE_DEF_SIZE
+    /*Only the images decoded to RAM use memory, the others are only in the array*/
+    size_t size = get_decoded_size(cached_src);
+    cached_src->not_cached = false;
+    if(size) {
+        cached_src->cache.key = (uint32_t)(lv_uintptr_t)cached_src;
+        cached_src->not_cached = !_lv_draw_cache_add(&cached_src->cache, LV_DRAW_CACHE_TYPE_IMG, size, img_evict_cb);
+    }
+#endif
+
     return cached_src;
 }
 
@@ -186,6 +209,9 @@ void lv_img_cache_invalidate_src(const void * src)
     uint16_t i;
     for(i = 0; i < entry_cnt; i++) {
         if(src == NULL || lv_img_cache_match(src, cache[i].dec_dsc.src)) {
+#if LV_DRAW_CACHE_BUDGET
+            _lv_draw_cache_remove(&cache[i].cache);
+#endif
             if(cache[i].dec_dsc.src != NULL) {
                 lv_img_decoder_close(&cache[i].dec_dsc);
             }
@@ -213,3 +239,23 @@ static bool lv_img_cache_match(const void * src1, const void * src2)
     return strcmp(src1, src2) == 0;
 }
 #endif
+
+#if LV_DRAW_CACHE_BUDGET && LV_IMG_CACHE_DEF_SIZE
+static size_t get_decoded_size(const _lv_img_cache_entry_t * entry)
+{
+    const lv_img_decoder_dsc_t * dsc = &entry->dec_dsc;
+    if(dsc->img_data == NULL) return 0;
+
+    /*The built-in decoder returns the pixels of the variable, e.g. from the flash*/
+    if(dsc->src_type == LV_IMG_SRC_VARIABLE && dsc->img_data == ((const lv_img_dsc_t *)dsc->src)->data) return 0;
+
+    return lv_img_buf_get_img_size(dsc->header.w, dsc->header.h, dsc->header.cf);
+}
+
+static void img_evict_cb(lv_draw_cache_entry_t * entry)
+{
+    _lv_img_cache_entry_t * cached_src = (_lv_img_cache_entry_t *)entry;
+    lv_img_decoder_close(&cached_src->dec_dsc);
+    lv_memset_00(cached_src, sizeof(_lv_img_cache_entry_t));
+}
+#endif
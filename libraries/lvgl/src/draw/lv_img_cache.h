@@ -14,6 +14,7 @@ extern "C" {
  *      INCLUDES
  *********************/
 #include "lv_img_decoder.h"
+#include "lv_draw_cache.h"
 
 /*********************
  *      DEFINES
@@ -29,6 +30,10 @@ extern "C" {
  * To avoid repeating this heavy load images can be cached.
  */
 typedef struct {
+#if LV_DRAW_CACHE_BUDGET && LV_IMG_CACHE_DEF_SIZE
+    lv_draw_cache_entry_t cache;  /**< Link to the shared draw cache, must be the first*/
+    bool not_cached;              /**< The decoded image doesn't fit into the budget, close it after drawing*/
+#endif
     lv_img_decoder_dsc_t dec_dsc; /**< Image information*/
 
     /** Count the cache entries's life. Add `time_to_open` to `life` when the entry is used.
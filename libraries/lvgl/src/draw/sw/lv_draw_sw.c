@@ -12,6 +12,9 @@
 /*********************
  *      DEFINES
  *********************/
+/*Side of the square blocks rotated at once. A block's source rows and destination rows are a few
+ *cache lines long, so both sides stay in the cache while the block is transposed.*/
+#define ROTATE_TILE_SIZE    32
 
 /**********************
  *      TYPEDEFS
@@ -103,6 +106,65 @@ void lv_draw_sw_buffer_copy(lv_draw_ctx_t * draw_ctx,
     }
 }
 
+void lv_draw_sw_rotate(const lv_color_t * src_buf, lv_color_t * dest_buf, lv_coord_t src_w, lv_coord_t src_h,
+                      lv_coord_t src_stride, lv_coord_t dest_stride, lv_disp_rot_t rotation)
+{
+    lv_coord_t x;
+    lv_coord_t y;
+
+    if(rotation == LV_DISP_ROT_NONE) {
+        for(y = 0; y < src_h; y++) {
+            lv_memcpy(dest_buf, src_buf, src_w * sizeof(lv_color_t));
+            src_buf += src_stride;
+            dest_buf += dest_stride;
+        }
+        return;
+    }
+
+    if(rotation == LV_DISP_ROT_180) {
+        dest_buf += (src_h - 1) * dest_stride + src_w - 1;
+        for(y = 0; y < src_h; y++) {
+            for(x = 0; x < src_w; x++) {
+                *(dest_buf - x) = src_buf[x];
+            }
+            src_buf += src_stride;
+            dest_buf -= dest_stride;
+        }
+        return;
+    }
+
+    /*90: (x;y) goes to (y;src_w - 1 - x), 270: (x;y) goes to (src_h - 1 - y;x).
+     *Walk the source in tiles and write each destination row of a tile in one run.*/
+    bool is_270 = rotation == LV_DISP_ROT_270;
+    lv_coord_t tile_y;
+    for(tile_y = 0; tile_y < src_h; tile_y += ROTATE_TILE_SIZE) {
+        lv_coord_t tile_h = LV_MIN(ROTATE_TILE_SIZE, src_h - tile_y);
+        lv_coord_t tile_x;
+        for(tile_x = 0; tile_x < src_w; tile_x += ROTATE_TILE_SIZE) {
+            lv_coord_t tile_x_end = LV_MIN(tile_x + ROTATE_TILE_SIZE, src_w);
+            for(x = tile_x; x < tile_x_end; x++) {
+                const lv_color_t * src_px = src_buf + tile_y * src_stride + x;
+                if(is_270) {
+                    lv_color_t * dest_px = dest_buf + x * dest_stride + (src_h - 1 - tile_y);
+                    for(y = 0; y < tile_h; y++) {
+                        *dest_px = *src_px;
+                        dest_px--;
+                        src_px += src_stride;
+                    }
+                }
+                else {
+                    lv_color_t * dest_px = dest_buf + (src_w - 1 - x) * dest_stride + tile_y;
+                    for(y = 0; y < tile_h; y++) {
+                        *dest_px = *src_px;
+                        dest_px++;
+                        src_px += src_stride;
+                    }
+                }
+            }
+        }
+    }
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -76,6 +76,19 @@ void lv_draw_sw_buffer_copy(lv_draw_ctx_t * draw_ctx,
                             void * dest_buf, lv_coord_t dest_stride, const lv_area_t * dest_area,
                             void * src_buf, lv_coord_t src_stride, const lv_area_t * src_area);
 
+/**
+ * Rotate a buffer to an other buffer. Used to rotate the rendered areas to the display's orientation.
+ * @param src_buf       the buffer to rotate
+ * @param dest_buf      the rotated pixels are written here, it can be e.g. a frame buffer with a larger stride
+ * @param src_w         width of the area in `src_buf`
+ * @param src_h         height of the area in `src_buf`
+ * @param src_stride    width of `src_buf` in pixels
+ * @param dest_stride   width of `dest_buf` in pixels
+ * @param rotation      rotation to apply. With 90 and 270 degrees the destination area is `src_h` wide and `src_w` tall.
+ */
+void lv_draw_sw_rotate(const lv_color_t * src_buf, lv_color_t * dest_buf, lv_coord_t src_w, lv_coord_t src_h,
+                      lv_coord_t src_stride, lv_coord_t dest_stride, lv_disp_rot_t rotation);
+
 void lv_draw_sw_transform(lv_draw_ctx_t * draw_ctx, const lv_area_t * dest_area, const void * src_buf,
                           lv_coord_t src_w, lv_coord_t src_h, lv_coord_t src_stride,
                           const lv_draw_img_dsc_t * draw_dsc, lv_img_cf_t cf, lv_color_t * cbuf, lv_opa_t * abuf);
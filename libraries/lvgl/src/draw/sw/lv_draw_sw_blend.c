@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include "lv_draw_sw.h"
+#include "lv_draw_sw_blend_rgb565.h"
 #include "../../misc/lv_math.h"
 #include "../../hal/lv_hal_disp.h"
 #include "../../core/lv_refr.h"
@@ -251,7 +252,9 @@ static LV_ATTRIBUTE_FAST_MEM void fill_normal(lv_color_t * dest_buf, const lv_ar
     int32_t w = lv_area_get_width(dest_area);
     int32_t h = lv_area_get_height(dest_area);
 
+#if _LV_DRAW_SW_BLEND_RGB565 == 0
     int32_t x;
+#endif
     int32_t y;
 
     /*No mask*/
@@ -264,6 +267,12 @@ static LV_ATTRIBUTE_FAST_MEM void fill_normal(lv_color_t * dest_buf, const lv_ar
         }
         /*Has opacity*/
         else {
+#if _LV_DRAW_SW_BLEND_RGB565
+            for(y = 0; y < h; y++) {
+                _lv_draw_sw_blend_rgb565_fill((uint16_t *)dest_buf, w, color.full, opa);
+                dest_buf += dest_stride;
+            }
+#else
             lv_color_t last_dest_color = lv_color_black();
             lv_color_t last_res_color = lv_color_mix(color, last_dest_color, opa);
 
@@ -289,10 +298,18 @@ static LV_ATTRIBUTE_FAST_MEM void fill_normal(lv_color_t * dest_buf, const lv_ar
                 }
                 dest_buf += dest_stride;
             }
+#endif
         }
     }
     /*Masked*/
     else {
+#if _LV_DRAW_SW_BLEND_RGB565
+        for(y = 0; y < h; y++) {
+            _lv_draw_sw_blend_rgb565_fill_mask((uint16_t *)dest_buf, w, color.full, opa, mask);
+            dest_buf += dest_stride;
+            mask += mask_stride;
+        }
+#else
 #if LV_COLOR_DEPTH == 16
         uint32_t c32 = color.full + ((uint32_t)color.full << 16);
 #endif
@@ -376,6 +393,7 @@ static LV_ATTRIBUTE_FAST_MEM void fill_normal(lv_color_t * dest_buf, const lv_ar
                 mask += (mask_stride - w);
             }
         }
+#endif /*_LV_DRAW_SW_BLEND_RGB565*/
     }
 }
 
@@ -652,7 +670,9 @@ static void LV_ATTRIBUTE_FAST_MEM map_normal(lv_color_t * dest_buf, const lv_are
     int32_t w = lv_area_get_width(dest_area);
     int32_t h = lv_area_get_height(dest_area);
 
+#if _LV_DRAW_SW_BLEND_RGB565 == 0
     int32_t x;
+#endif
     int32_t y;
 
     /*Simple fill (maybe with opacity), no masking*/
@@ -666,9 +686,13 @@ static void LV_ATTRIBUTE_FAST_MEM map_normal(lv_color_t * dest_buf, const lv_are
         }
         else {
             for(y = 0; y < h; y++) {
+#if _LV_DRAW_SW_BLEND_RGB565
+                _lv_draw_sw_blend_rgb565_map((uint16_t *)dest_buf, (const uint16_t *)src_buf, w, opa);
+#else
                 for(x = 0; x < w; x++) {
                     dest_buf[x] = lv_color_mix(src_buf[x], dest_buf[x], opa);
                 }
+#endif
                 dest_buf += dest_stride;
                 src_buf += src_stride;
             }
@@ -676,6 +700,14 @@ static void LV_ATTRIBUTE_FAST_MEM map_normal(lv_color_t * dest_buf, const lv_are
     }
     /*Masked*/
     else {
+#if _LV_DRAW_SW_BLEND_RGB565
+        for(y = 0; y < h; y++) {
+            _lv_draw_sw_blend_rgb565_map_mask((uint16_t *)dest_buf, (const uint16_t *)src_buf, w, opa, mask);
+            dest_buf += dest_stride;
+            src_buf += src_stride;
+            mask += mask_stride;
+        }
+#else
         /*Only the mask matters*/
         if(opa > LV_OPA_MAX) {
             int32_t x_end4 = w - 4;
@@ -735,6 +767,7 @@ static void LV_ATTRIBUTE_FAST_MEM map_normal(lv_color_t * dest_buf, const lv_are
                 mask += mask_stride;
             }
         }
+#endif /*_LV_DRAW_SW_BLEND_RGB565*/
     }
 }
 
@@ -0,0 +1,194 @@
+/**
+ * @file lv_draw_sw_blend_rgb565.c
+ *
+ * RGB565 blending with the "spread" trick of `lv_color_mix()`: the 5-6-5 channels of a pixel are moved
+ * apart in a 32 bit word (`0b00000GGGGGG00000RRRRR000000BBBBB`) so the three of them can be multiplied
+ * with the 5 bit mix ratio at once. It's one multiplication per pixel, while the dual 16 bit SIMD
+ * multiplications (e.g. `__SMLAD`) would need three for two pixels.
+ * The difference of the channels may be negative, but the borrows are shifted out or masked away
+ * after `>> 5`, so the result is the same as `lv_color_mix()`.
+ * The loops have no data dependent branches per pixel, so they are unrolled by the compiler
+ * and auto-vectorized where SIMD units are available (SSE2, NEON).
+ * Masks are checked 8 pixels at once to skip the transparent and copy the opaque runs.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw_blend_rgb565.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SPREAD_MASK     0x07E0F81FUL
+#define BLOCK_SIZE      8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static inline uint32_t spread(uint16_t c);
+static inline uint16_t mix_spread(uint32_t fg_spread, uint16_t bg, uint32_t mix);
+static inline uint32_t mix_ratio(lv_opa_t opa);
+static inline uint32_t fill_mask_opa(lv_opa_t opa, lv_opa_t mask);
+static inline uint32_t map_mask_opa(lv_opa_t opa, lv_opa_t mask);
+static inline bool block_is(const lv_opa_t * mask, uint32_t value);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void _lv_draw_sw_blend_rgb565_fill(uint16_t * dest, int32_t len, uint16_t color, lv_opa_t opa)
+{
+    uint32_t fg = spread(color);
+    uint32_t mix = mix_ratio(opa);
+
+    int32_t i = 0;
+    for(; i + BLOCK_SIZE <= len; i += BLOCK_SIZE) {
+        int32_t j;
+        for(j = 0; j < BLOCK_SIZE; j++) dest[i + j] = mix_spread(fg, dest[i + j], mix);
+    }
+
+    for(; i < len; i++) {
+        dest[i] = mix_spread(fg, dest[i], mix);
+    }
+}
+
+void _lv_draw_sw_blend_rgb565_fill_mask(uint16_t * dest, int32_t len, uint16_t color, lv_opa_t opa,
+                                        const lv_opa_t * mask)
+{
+    uint32_t fg = spread(color);
+    bool mask_only = opa >= LV_OPA_MAX;
+
+    int32_t i = 0;
+    for(; i < len && ((lv_uintptr_t)(mask + i) & 0x3); i++) {
+        dest[i] = mix_spread(fg, dest[i], mix_ratio(fill_mask_opa(opa, mask[i])));
+    }
+
+    for(; i + BLOCK_SIZE <= len; i += BLOCK_SIZE) {
+        if(block_is(mask + i, 0)) continue;
+
+        if(mask_only && block_is(mask + i, 0xFFFFFFFF)) {
+            int32_t j;
+            for(j = 0; j < BLOCK_SIZE; j++) dest[i + j] = color;
+            continue;
+        }
+
+        uint8_t mix[BLOCK_SIZE];
+        int32_t j;
+        for(j = 0; j < BLOCK_SIZE; j++) mix[j] = (uint8_t)mix_ratio(fill_mask_opa(opa, mask[i + j]));
+        for(j = 0; j < BLOCK_SIZE; j++) dest[i + j] = mix_spread(fg, dest[i + j], mix[j]);
+    }
+
+    for(; i < len; i++) {
+        dest[i] = mix_spread(fg, dest[i], mix_ratio(fill_mask_opa(opa, mask[i])));
+    }
+}
+
+void _lv_draw_sw_blend_rgb565_map(uint16_t * dest, const uint16_t * src, int32_t len, lv_opa_t opa)
+{
+    uint32_t mix = mix_ratio(opa);
+
+    int32_t i = 0;
+    for(; i + BLOCK_SIZE <= len; i += BLOCK_SIZE) {
+        /*Read the whole block first, the compiler can't know whether `dest` and `src` overlap*/
+        uint16_t res[BLOCK_SIZE];
+        int32_t j;
+        for(j = 0; j < BLOCK_SIZE; j++) res[j] = mix_spread(spread(src[i + j]), dest[i + j], mix);
+        for(j = 0; j < BLOCK_SIZE; j++) dest[i + j] = res[j];
+    }
+
+    for(; i < len; i++) {
+        dest[i] = mix_spread(spread(src[i]), dest[i], mix);
+    }
+}
+
+void _lv_draw_sw_blend_rgb565_map_mask(uint16_t * dest, const uint16_t * src, int32_t len, lv_opa_t opa,
+                                       const lv_opa_t * mask)
+{
+    bool mask_only = opa > LV_OPA_MAX;
+
+    int32_t i = 0;
+    for(; i < len && ((lv_uintptr_t)(mask + i) & 0x3); i++) {
+        dest[i] = mix_spread(spread(src[i]), dest[i], mix_ratio(map_mask_opa(opa, mask[i])));
+    }
+
+    for(; i + BLOCK_SIZE <= len; i += BLOCK_SIZE) {
+        if(block_is(mask + i, 0)) continue;
+
+        if(mask_only && block_is(mask + i, 0xFFFFFFFF)) {
+            int32_t j;
+            for(j = 0; j < BLOCK_SIZE; j++) dest[i + j] = src[i + j];
+            continue;
+        }
+
+        uint8_t mix[BLOCK_SIZE];
+        int32_t j;
+        for(j = 0; j < BLOCK_SIZE; j++) mix[j] = (uint8_t)mix_ratio(map_mask_opa(opa, mask[i + j]));
+        for(j = 0; j < BLOCK_SIZE; j++) dest[i + j] = mix_spread(spread(src[i + j]), dest[i + j], mix[j]);
+    }
+
+    for(; i < len; i++) {
+        dest[i] = mix_spread(spread(src[i]), dest[i], mix_ratio(map_mask_opa(opa, mask[i])));
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static inline uint32_t spread(uint16_t c)
+{
+    return ((uint32_t)c | ((uint32_t)c << 16)) & SPREAD_MASK;
+}
+
+/**
+ * Same as `lv_color_mix()` of RGB565: `bg + (fg - bg) * mix / 32` for each channel.
+ * With `mix` = 0 it's `bg` and with 32 it's `fg`, so it can be used for transparent and opaque pixels too.
+ */
+static inline uint16_t mix_spread(uint32_t fg_spread, uint16_t bg, uint32_t mix)
+{
+    uint32_t bg_spread = spread(bg);
+    uint32_t res = ((((fg_spread - bg_spread) * mix) >> 5) + bg_spread) & SPREAD_MASK;
+    return (uint16_t)(res | (res >> 16));
+}
+
+/*Convert an opacity to the 0..32 ratio used by `lv_color_mix()`*/
+static inline uint32_t mix_ratio(lv_opa_t opa)
+{
+    return ((uint32_t)opa + 4) >> 3;
+}
+
+/*The opacity of a masked pixel in `fill_normal()`*/
+static inline uint32_t fill_mask_opa(lv_opa_t opa, lv_opa_t mask)
+{
+    if(opa >= LV_OPA_MAX) return mask;
+    if(mask == LV_OPA_COVER) return opa;
+    return ((uint32_t)mask * opa) >> 8;
+}
+
+/*The opacity of a masked pixel in `map_normal()`*/
+static inline uint32_t map_mask_opa(lv_opa_t opa, lv_opa_t mask)
+{
+    if(opa > LV_OPA_MAX) return mask;
+    if(mask >= LV_OPA_MAX) return opa;
+    return ((uint32_t)mask * opa) >> 8;
+}
+
+/*Check whether all the mask values of a block are the same. `mask` has to be 4 byte aligned.*/
+static inline bool block_is(const lv_opa_t * mask, uint32_t value)
+{
+    const uint32_t * mask32 = (const uint32_t *)mask;
+    return mask32[0] == value && mask32[1] == value;
+}
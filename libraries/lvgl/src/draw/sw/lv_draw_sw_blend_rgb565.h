@@ -0,0 +1,89 @@
+/**
+ * @file lv_draw_sw_blend_rgb565.h
+ *
+ */
+
+#ifndef LV_DRAW_SW_BLEND_RGB565_H
+#define LV_DRAW_SW_BLEND_RGB565_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../misc/lv_color.h"
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+/*The kernels give the same result as `lv_color_mix()` of this color format, so they replace
+ *the per-pixel loops of the normal blend mode only with it*/
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0 && LV_COLOR_MIX_ROUND_OFS == 0
+#define _LV_DRAW_SW_BLEND_RGB565 1
+#else
+#define _LV_DRAW_SW_BLEND_RGB565 0
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/*The functions below blend one line of RGB565 pixels. They don't depend on `LV_COLOR_DEPTH`
+ *to make them testable with any configuration.*/
+
+/**
+ * Mix a color to the pixels with an opacity.
+ * @param dest      pointer to the first pixel
+ * @param len       number of pixels
+ * @param color     the color to mix
+ * @param opa       opacity of `color`
+ */
+void _lv_draw_sw_blend_rgb565_fill(uint16_t * dest, int32_t len, uint16_t color, lv_opa_t opa);
+
+/**
+ * Mix a color to the pixels with an opacity and a mask.
+ * @param dest      pointer to the first pixel
+ * @param len       number of pixels
+ * @param color     the color to mix
+ * @param opa       opacity of `color`, with `LV_OPA_MAX` or more only the mask is used
+ * @param mask      opacity of each pixel
+ */
+void _lv_draw_sw_blend_rgb565_fill_mask(uint16_t * dest, int32_t len, uint16_t color, lv_opa_t opa,
+                                        const lv_opa_t * mask);
+
+/**
+ * Mix an image line to the pixels with an opacity.
+ * @param dest      pointer to the first pixel
+ * @param src       pointer to the first pixel of the image line
+ * @param len       number of pixels
+ * @param opa       opacity of the image
+ */
+void _lv_draw_sw_blend_rgb565_map(uint16_t * dest, const uint16_t * src, int32_t len, lv_opa_t opa);
+
+/**
+ * Mix an image line to the pixels with an opacity and a mask.
+ * @param dest      pointer to the first pixel
+ * @param src       pointer to the first pixel of the image line
+ * @param len       number of pixels
+ * @param opa       opacity of the image, above `LV_OPA_MAX` only the mask is used
+ * @param mask      opacity of each pixel
+ */
+void _lv_draw_sw_blend_rgb565_map_mask(uint16_t * dest, const uint16_t * src, int32_t len, lv_opa_t opa,
+                                       const lv_opa_t * mask);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_SW_BLEND_RGB565_H*/
@@ -9,6 +9,7 @@
 #include "lv_draw_sw_gradient.h"
 #include "../../misc/lv_gc.h"
 #include "../../misc/lv_types.h"
+#include "../lv_draw_arena.h"
 
 /*********************
  *      DEFINES
@@ -35,6 +36,7 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if LV_DRAW_CACHE_BUDGET == 0
 static lv_grad_t * next_in_cache(lv_grad_t * item);
 
 typedef lv_res_t (*op_cache_t)(lv_grad_t * c, void * ctx);
@@ -46,6 +48,18 @@ static lv_res_t kill_oldest_item(lv_grad_t * c, void * ctx);
 static lv_res_t find_item(lv_grad_t * c, void * ctx);
 static void free_item(lv_grad_t * c);
 static  uint32_t compute_key(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h);
+#else
+    static lv_grad_t * allocate_budget_item(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h);
+    static uint32_t compute_dsc_key(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h);
+    static bool match_item(const lv_draw_cache_entry_t * entry, const void * ctx);
+    static void evict_item(lv_draw_cache_entry_t * entry);
+
+    typedef struct {
+        const lv_grad_dsc_t * g;
+        lv_coord_t w;
+        lv_coord_t h;
+    } grad_req_t;
+#endif
 
 
 /**********************
@@ -57,6 +71,7 @@ static uint8_t * grad_cache_end = 0;
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+#if LV_DRAW_CACHE_BUDGET == 0
 union void_cast {
     const void * ptr;
     const uint32_t value;
@@ -188,8 +203,8 @@ static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord
             item->not_cached = 0;
         }
         else {
-            /*The cache is too small. Allocate the item manually and free it later.*/
-            item = lv_mem_alloc(req_size);
+            /*The cache is too small. Allocate the item manually and free it after the drawing.*/
+            item = _lv_draw_arena_alloc(req_size);
             LV_ASSERT_MALLOC(item);
             if(item == NULL) return NULL;
             item->not_cached = 1;
@@ -228,6 +243,86 @@ static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord
     return item;
 }
 
+#else
+/*Allocate the item separately and add it to the shared draw cache*/
+static lv_grad_t * allocate_budget_item(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h)
+{
+    lv_coord_t size = g->dir == LV_GRAD_DIR_HOR ? w : h;
+    lv_coord_t map_size = LV_MAX(w, h);
+
+    size_t req_size = ALIGN(sizeof(lv_grad_t)) + ALIGN(map_size * sizeof(lv_color_t));
+#if _DITHER_GRADIENT
+    req_size += ALIGN(size * sizeof(lv_color32_t));
+#if LV_DITHER_ERROR_DIFFUSION == 1
+    req_size += ALIGN(w * sizeof(lv_scolor24_t));
+#endif
+#endif
+
+    lv_grad_t * item = _lv_draw_cache_alloc(req_size);
+    if(item == NULL) return NULL;
+    lv_memset_00(item, sizeof(lv_grad_t));
+
+    item->dsc = *g;
+    item->req_w = w;
+    item->req_h = h;
+    item->cache.key = compute_dsc_key(g, w, h);
+    /*Use it only for this drawing if it doesn't fit into the budget*/
+    item->not_cached = _lv_draw_cache_add(&item->cache, LV_DRAW_CACHE_TYPE_GRAD, req_size, evict_item) ? 0 : 1;
+    item->cache.used_cnt = 1;
+
+    item->key = item->cache.key;
+    item->life = 1;
+    item->alloc_size = map_size;
+    item->size = size;
+    uint8_t * p = (uint8_t *)item;
+    item->map = (lv_color_t *)(p + ALIGN(sizeof(*item)));
+#if _DITHER_GRADIENT
+    item->hmap = (lv_color32_t *)(p + ALIGN(sizeof(*item)) + ALIGN(map_size * sizeof(lv_color_t)));
+#if LV_DITHER_ERROR_DIFFUSION == 1
+    item->error_acc = (lv_scolor24_t *)(p + ALIGN(sizeof(*item)) + ALIGN(size * sizeof(lv_grad_color_t)) +
+                                        ALIGN(map_size * sizeof(lv_color_t)));
+    item->w = w;
+#endif
+#endif
+    return item;
+}
+
+/*Hash the content of the gradient, the descriptors are usually temporary variables*/
+static uint32_t compute_dsc_key(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h)
+{
+    uint32_t key = 2166136261UL;
+    key = (key ^ (uint32_t)w) * 16777619UL;
+    key = (key ^ (uint32_t)h) * 16777619UL;
+    key = (key ^ ((uint32_t)g->dir | ((uint32_t)g->dither << 4) | ((uint32_t)g->stops_count << 8))) * 16777619UL;
+    uint8_t i;
+    for(i = 0; i < g->stops_count; i++) {
+        key = (key ^ lv_color_to32(g->stops[i].color)) * 16777619UL;
+        key = (key ^ g->stops[i].frac) * 16777619UL;
+    }
+    return key;
+}
+
+static bool match_item(const lv_draw_cache_entry_t * entry, const void * ctx)
+{
+    const lv_grad_t * item = (const lv_grad_t *)entry;
+    const grad_req_t * req = ctx;
+    if(item->req_w != req->w || item->req_h != req->h) return false;
+    if(item->dsc.dir != req->g->dir || item->dsc.dither != req->g->dither) return false;
+    if(item->dsc.stops_count != req->g->stops_count) return false;
+
+    uint8_t i;
+    for(i = 0; i < req->g->stops_count; i++) {
+        if(item->dsc.stops[i].color.full != req->g->stops[i].color.full) return false;
+        if(item->dsc.stops[i].frac != req->g->stops[i].frac) return false;
+    }
+    return true;
+}
+
+static void evict_item(lv_draw_cache_entry_t * entry)
+{
+    _lv_draw_cache_free(entry);
+}
+#endif
 
 /**********************
  *     FUNCTIONS
@@ -253,6 +348,21 @@ lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h)
     /* No gradient, no cache */
     if(g->dir == LV_GRAD_DIR_NONE) return NULL;
 
+#if LV_DRAW_CACHE_BUDGET
+    grad_req_t req = {g, w, h};
+    lv_draw_cache_entry_t * entry = _lv_draw_cache_find(LV_DRAW_CACHE_TYPE_GRAD, compute_dsc_key(g, w, h), match_item,
+                                                        &req);
+    if(entry) {
+        entry->used_cnt++;
+        return (lv_grad_t *)entry;
+    }
+
+    lv_grad_t * item = allocate_budget_item(g, w, h);
+    if(item == NULL) {
+        LV_LOG_WARN("Faild to allcoate item for teh gradient");
+        return item;
+    }
+#else
     /* Step 0: Check if the cache exist (else create it) */
     static bool inited = false;
     if(!inited) {
@@ -275,6 +385,7 @@ lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h)
         LV_LOG_WARN("Faild to allcoate item for teh gradient");
         return item;
     }
+#endif
 
     /* Step 3: Fill it with the gradient, as expected */
 #if _DITHER_GRADIENT
@@ -340,7 +451,14 @@ lv_grad_color_t LV_ATTRIBUTE_FAST_MEM lv_gradient_calculate(const lv_grad_dsc_t
 
 void lv_gradient_cleanup(lv_grad_t * grad)
 {
+#if LV_DRAW_CACHE_BUDGET
+    grad->cache.used_cnt--;
+    if(grad->not_cached) {
+        _lv_draw_cache_free(grad);
+    }
+#else
     if(grad->not_cached) {
-        lv_mem_free(grad);
+        _lv_draw_arena_free(grad);
     }
+#endif
 }
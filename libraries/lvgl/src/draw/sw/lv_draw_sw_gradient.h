@@ -16,6 +16,7 @@ extern "C" {
 #include "../../misc/lv_color.h"
 #include "../../misc/lv_style.h"
 #include "lv_draw_sw_dither.h"
+#include "../lv_draw_cache.h"
 
 /*********************
  *      DEFINES
@@ -38,6 +39,12 @@ typedef lv_color_t lv_grad_color_t;
  *  it's possible to cache the computation in this structure instance.
  *  Whenever possible, this structure is reused instead of recomputing the gradient map */
 typedef struct _lv_gradient_cache_t {
+#if LV_DRAW_CACHE_BUDGET
+    lv_draw_cache_entry_t cache;  /**< Link to the shared draw cache, must be the first*/
+    lv_grad_dsc_t   dsc;          /**< The gradient the maps were computed for*/
+    lv_coord_t      req_w;        /**< The width the maps were computed for*/
+    lv_coord_t      req_h;        /**< The height the maps were computed for*/
+#endif
     uint32_t        key;          /**< A discriminating key that's built from the drawing operation.
                                    * If the key does not match, the cache item is not used */
     uint32_t        life : 30;    /**< A life counter that's incremented on usage. Higher counter is
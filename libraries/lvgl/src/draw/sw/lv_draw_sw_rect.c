@@ -24,6 +24,12 @@
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_DRAW_CACHE_BUDGET && LV_SHADOW_CACHE_SIZE
+/*A shadow corner in the shared draw cache, the opacity map follows it*/
+typedef struct {
+    lv_draw_cache_entry_t cache;    /*Must be the first*/
+} sh_cache_item_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -40,6 +46,9 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ draw_shadow(lv_draw_ctx_t * draw_ctx, co
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_draw_corner_buf(const lv_area_t * coords, uint16_t * sh_buf,
                                                                lv_coord_t s, lv_coord_t r);
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(lv_coord_t size, lv_coord_t sw, uint16_t * sh_ups_buf);
+#if LV_DRAW_CACHE_BUDGET && LV_SHADOW_CACHE_SIZE
+    static void sh_cache_evict_cb(lv_draw_cache_entry_t * entry);
+#endif
 #endif
 
 void draw_border_generic(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area, const lv_area_t * inner_area,
@@ -52,7 +61,7 @@ static void draw_border_simple(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer
 /**********************
  *  STATIC VARIABLES
  **********************/
-#if defined(LV_SHADOW_CACHE_SIZE) && LV_SHADOW_CACHE_SIZE > 0
+#if LV_DRAW_CACHE_BUDGET == 0 && defined(LV_SHADOW_CACHE_SIZE) && LV_SHADOW_CACHE_SIZE > 0
     static uint8_t sh_cache[LV_SHADOW_CACHE_SIZE * LV_SHADOW_CACHE_SIZE];
     static int32_t sh_cache_size = -1;
     static int32_t sh_cache_r = -1;
@@ -485,7 +494,32 @@ static void LV_ATTRIBUTE_FAST_MEM draw_shadow(lv_draw_ctx_t * draw_ctx, const lv
 
     lv_opa_t * sh_buf;
 
-#if LV_SHADOW_CACHE_SIZE
+#if LV_DRAW_CACHE_BUDGET && LV_SHADOW_CACHE_SIZE
+    uint32_t sh_key = ((uint32_t)corner_size << 16) | (uint32_t)r_sh;
+    sh_cache_item_t * sh_item = (sh_cache_item_t *)_lv_draw_cache_find(LV_DRAW_CACHE_TYPE_SHADOW, sh_key, NULL, NULL);
+    if(sh_item) {
+        sh_buf = lv_mem_buf_get(corner_size * corner_size);
+        lv_memcpy(sh_buf, sh_item + 1, corner_size * corner_size);
+    }
+    else {
+        sh_buf = lv_mem_buf_get(corner_size * corner_size * sizeof(uint16_t));
+        shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->shadow_width, r_sh);
+
+        /*Cache the corners which are not too large*/
+        if(corner_size <= LV_SHADOW_CACHE_SIZE) {
+            size_t sh_size = sizeof(sh_cache_item_t) + corner_size * corner_size;
+            sh_item = _lv_draw_cache_alloc(sh_size);
+            if(sh_item) {
+                lv_memset_00(sh_item, sizeof(sh_cache_item_t));
+                sh_item->cache.key = sh_key;
+                lv_memcpy(sh_item + 1, sh_buf, corner_size * corner_size);
+                if(!_lv_draw_cache_add(&sh_item->cache, LV_DRAW_CACHE_TYPE_SHADOW, sh_size, sh_cache_evict_cb)) {
+                    _lv_draw_cache_free(sh_item);
+                }
+            }
+        }
+    }
+#elif LV_SHADOW_CACHE_SIZE
     if(sh_cache_size == corner_size && sh_cache_r == r_sh) {
         /*Use the cache if available*/
         sh_buf = lv_mem_buf_get(corner_size * corner_size);
@@ -1109,6 +1143,13 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_blur_corner(lv_coord_t size, lv_coord_t
 
     lv_mem_buf_release(sh_ups_blur_buf);
 }
+
+#if LV_DRAW_CACHE_BUDGET && LV_SHADOW_CACHE_SIZE
+static void sh_cache_evict_cb(lv_draw_cache_entry_t * entry)
+{
+    _lv_draw_cache_free(entry);
+}
+#endif
 #endif
 
 static void draw_outline(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords)
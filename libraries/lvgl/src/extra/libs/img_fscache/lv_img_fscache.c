@@ -0,0 +1,470 @@
+/**
+ * @file lv_img_fscache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../lvgl.h"
+#if LV_USE_IMG_FSCACHE
+
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
+    #define FSCACHE_COLOR_DEPTH     (LV_COLOR_DEPTH | 0x80)
+#else
+    #define FSCACHE_COLOR_DEPTH     LV_COLOR_DEPTH
+#endif
+
+#define FNV_OFFSET      0xcbf29ce484222325ULL
+#define FNV_PRIME       0x100000001b3ULL
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*What is known about a cache file*/
+typedef struct {
+    uint64_t hash;
+    uint32_t size;          /*Size of the file, 0: empty*/
+    uint32_t stamp;         /*When it was written or used last*/
+    uint8_t valid : 1;      /*0: it was made with other settings, it can be only overwritten*/
+} slot_t;
+
+/*Decoding session which doesn't have all the pixels in RAM*/
+typedef struct {
+    lv_img_decoder_dsc_t inner;     /*Not cached, passed through from an other decoder*/
+    lv_fs_file_t f;                 /*Read the lines from the cache file*/
+    uint8_t px_size;
+} fscache_dsc_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_res_t decoder_info(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header);
+static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
+static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc,
+                                  lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t * buf);
+static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
+static lv_res_t hash_file(const char * path, uint64_t * hash);
+static void get_slot_path(char * path, uint32_t id);
+static void load_slots(void);
+static lv_res_t open_cached(lv_img_decoder_dsc_t * dsc, uint32_t id, uint64_t hash);
+static lv_res_t decode_and_store(lv_img_decoder_dsc_t * dsc, uint64_t hash);
+static void store(uint64_t hash, lv_img_cf_t cf, lv_coord_t w, lv_coord_t h, const uint8_t * data, uint32_t size);
+static void evict(uint32_t id);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const char * cache_dir = LV_IMG_FSCACHE_DIR;
+static slot_t slots[LV_IMG_FSCACHE_SLOTS];
+static bool slots_loaded;
+static uint32_t stamp_cnt;
+static bool bypass;     /*Set while the other decoders are asked*/
+static lv_img_fscache_stats_t stats;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_img_fscache_init(void)
+{
+    /*Created last so it's asked before the other decoders*/
+    lv_img_decoder_t * dec = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(dec, decoder_info);
+    lv_img_decoder_set_open_cb(dec, decoder_open);
+    lv_img_decoder_set_read_line_cb(dec, decoder_read_line);
+    lv_img_decoder_set_close_cb(dec, decoder_close);
+
+    lv_memset_00(&stats, sizeof(stats));
+}
+
+void lv_img_fscache_set_dir(const char * dir)
+{
+    cache_dir = dir;
+    slots_loaded = false;
+}
+
+const lv_img_fscache_stats_t * lv_img_fscache_get_stats(void)
+{
+    return &stats;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Get info about an image file with the other decoders
+ * @param src can be file name or pointer to a C array
+ * @param header store the info here
+ * @return LV_RES_OK: no error; LV_RES_INV: can't get the info
+ */
+static lv_res_t decoder_info(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header)
+{
+    LV_UNUSED(decoder);
+
+    if(bypass || cache_dir == NULL || cache_dir[0] == '\0') return LV_RES_INV;
+    if(lv_img_src_get_type(src) != LV_IMG_SRC_FILE) return LV_RES_INV;
+
+    /*LVGL's binary images are not decoded anyway*/
+    if(strcmp(lv_fs_get_ext(src), "bin") == 0) return LV_RES_INV;
+
+    bypass = true;
+    lv_res_t res = lv_img_decoder_get_info(src, header);
+    bypass = false;
+    return res;
+}
+
+/**
+ * Open an image file from the cache, or decode it with the other decoders and save the result.
+ * @param decoder pointer to the decoder
+ * @param dsc pointer to the decoder descriptor
+ * @return LV_RES_OK: opened; LV_RES_INV: can't be opened, the next decoder will try
+ */
+static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+
+    uint64_t hash;
+    if(hash_file(dsc->src, &hash) != LV_RES_OK) return LV_RES_INV;
+
+    if(!slots_loaded) load_slots();
+
+    uint32_t i;
+    for(i = 0; i < LV_IMG_FSCACHE_SLOTS; i++) {
+        if(slots[i].size == 0 || !slots[i].valid || slots[i].hash != hash) continue;
+
+        if(open_cached(dsc, i, hash) == LV_RES_OK) {
+            stats.hit_cnt++;
+            slots[i].stamp = ++stamp_cnt;
+            return LV_RES_OK;
+        }
+
+        LV_LOG_WARN("cache file %d is corrupted", (int)i);
+        slots[i].valid = 0;
+        break;
+    }
+
+    stats.miss_cnt++;
+    return decode_and_store(dsc, hash);
+}
+
+static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc,
+                                  lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t * buf)
+{
+    LV_UNUSED(decoder);
+
+    fscache_dsc_t * c = dsc->user_data;
+    if(c == NULL) return LV_RES_INV;
+
+    if(c->inner.decoder) return lv_img_decoder_read_line(&c->inner, x, y, len, buf);
+
+    uint32_t pos = sizeof(lv_img_fscache_header_t) + ((uint32_t)y * dsc->header.w + x) * c->px_size;
+    uint32_t btr = len * c->px_size;
+    uint32_t br = 0;
+    if(lv_fs_seek(&c->f, pos, LV_FS_SEEK_SET) != LV_FS_RES_OK) return LV_RES_INV;
+    if(lv_fs_read(&c->f, buf, btr, &br) != LV_FS_RES_OK || br != btr) return LV_RES_INV;
+    return LV_RES_OK;
+}
+
+static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+
+    fscache_dsc_t * c = dsc->user_data;
+    if(c) {
+        if(c->inner.decoder) lv_img_decoder_close(&c->inner);
+        else lv_fs_close(&c->f);
+        lv_mem_free(c);
+        dsc->user_data = NULL;
+    }
+    else if(dsc->img_data) {
+        lv_mem_free((void *)dsc->img_data);
+    }
+    dsc->img_data = NULL;
+}
+
+/*FNV-1a hash of the content of a file*/
+static lv_res_t hash_file(const char * path, uint64_t * hash)
+{
+    lv_fs_file_t f;
+    if(lv_fs_open(&f, path, LV_FS_MODE_RD) != LV_FS_RES_OK) return LV_RES_INV;
+
+    uint8_t buf[256];
+    uint64_t h = FNV_OFFSET;
+    uint32_t br;
+    lv_fs_res_t res;
+    do {
+        res = lv_fs_read(&f, buf, sizeof(buf), &br);
+        uint32_t i;
+        for(i = 0; i < br; i++) {
+            h ^= buf[i];
+            h *= FNV_PRIME;
+        }
+    } while(res == LV_FS_RES_OK && br == sizeof(buf));
+    lv_fs_close(&f);
+
+    *hash = h;
+    return res == LV_FS_RES_OK ? LV_RES_OK : LV_RES_INV;
+}
+
+static void get_slot_path(char * path, uint32_t id)
+{
+    size_t len = strlen(cache_dir);
+    char last = cache_dir[len - 1];
+    lv_snprintf(path, LV_FS_MAX_PATH_LENGTH, "%s%simgcache_%02d.bin", cache_dir,
+                last == ':' || last == '/' ? "" : "/", (int)id);
+}
+
+/*Read the headers of the cache files*/
+static void load_slots(void)
+{
+    char path[LV_FS_MAX_PATH_LENGTH];
+    lv_memset_00(slots, sizeof(slots));
+    stamp_cnt = 0;
+
+    uint32_t i;
+    for(i = 0; i < LV_IMG_FSCACHE_SLOTS; i++) {
+        get_slot_path(path, i);
+        lv_fs_file_t f;
+        if(lv_fs_open(&f, path, LV_FS_MODE_RD) != LV_FS_RES_OK) continue;
+
+        lv_img_fscache_header_t header;
+        uint32_t br = 0;
+        lv_fs_res_t res = lv_fs_read(&f, &header, sizeof(header), &br);
+        lv_fs_close(&f);
+        if(res != LV_FS_RES_OK || br != sizeof(header)) continue;
+
+        slots[i].hash = header.hash;
+        slots[i].size = sizeof(header) + header.data_size;
+        slots[i].stamp = header.stamp;
+        slots[i].valid = memcmp(header.magic, LV_IMG_FSCACHE_MAGIC, 4) == 0 &&
+                         header.version == LV_IMG_FSCACHE_VERSION && header.color_depth == FSCACHE_COLOR_DEPTH;
+        stamp_cnt = LV_MAX(stamp_cnt, header.stamp);
+    }
+
+    slots_loaded = true;
+}
+
+/*Read the pixels from a cache file to RAM, or read them line by line if they don't fit*/
+static lv_res_t open_cached(lv_img_decoder_dsc_t * dsc, uint32_t id, uint64_t hash)
+{
+    char path[LV_FS_MAX_PATH_LENGTH];
+    get_slot_path(path, id);
+    lv_fs_file_t f;
+    if(lv_fs_open(&f, path, LV_FS_MODE_RD) != LV_FS_RES_OK) return LV_RES_INV;
+
+    lv_img_fscache_header_t header;
+    uint32_t br = 0;
+    if(lv_fs_read(&f, &header, sizeof(header), &br) != LV_FS_RES_OK || br != sizeof(header)) {
+        lv_fs_close(&f);
+        return LV_RES_INV;
+    }
+
+    uint8_t px_size = 0;
+    if(header.cf == LV_IMG_CF_TRUE_COLOR) px_size = sizeof(lv_color_t);
+    else if(header.cf == LV_IMG_CF_TRUE_COLOR_ALPHA) px_size = LV_IMG_PX_SIZE_ALPHA_BYTE;
+
+    if(px_size == 0 || header.hash != hash || header.w != dsc->header.w || header.h != dsc->header.h ||
+       header.data_size != (uint32_t)header.w * header.h * px_size) {
+        lv_fs_close(&f);
+        return LV_RES_INV;
+    }
+
+    uint8_t * buf = lv_mem_alloc(header.data_size);
+    if(buf) {
+        lv_fs_res_t res = lv_fs_read(&f, buf, header.data_size, &br);
+        lv_fs_close(&f);
+        if(res != LV_FS_RES_OK || br != header.data_size) {
+            lv_mem_free(buf);
+            return LV_RES_INV;
+        }
+        dsc->img_data = buf;
+        dsc->user_data = NULL;
+    }
+    else {
+        fscache_dsc_t * c = lv_mem_alloc(sizeof(fscache_dsc_t));
+        if(c == NULL) {
+            lv_fs_close(&f);
+            return LV_RES_INV;
+        }
+        lv_memset_00(c, sizeof(fscache_dsc_t));
+        c->f = f;
+        c->px_size = px_size;
+        dsc->img_data = NULL;
+        dsc->user_data = c;
+    }
+
+    dsc->header.cf = header.cf;
+    return LV_RES_OK;
+}
+
+/*Decode the image with the other decoders and save the pixels if they are all in RAM*/
+static lv_res_t decode_and_store(lv_img_decoder_dsc_t * dsc, uint64_t hash)
+{
+    fscache_dsc_t * c = lv_mem_alloc(sizeof(fscache_dsc_t));
+    LV_ASSERT_MALLOC(c);
+    if(c == NULL) return LV_RES_INV;
+    lv_memset_00(c, sizeof(fscache_dsc_t));
+
+    bypass = true;
+    lv_res_t res = lv_img_decoder_open(&c->inner, dsc->src, dsc->color, dsc->frame_id);
+    bypass = false;
+    if(res != LV_RES_OK) {
+        lv_mem_free(c);
+        return LV_RES_INV;
+    }
+
+    lv_img_header_t * header = &c->inner.header;
+    uint8_t px_size = 0;
+    if(header->cf == LV_IMG_CF_TRUE_COLOR) px_size = sizeof(lv_color_t);
+    else if(header->cf == LV_IMG_CF_TRUE_COLOR_ALPHA) px_size = LV_IMG_PX_SIZE_ALPHA_BYTE;
+
+    uint32_t px_cnt = (uint32_t)header->w * header->h;
+    uint8_t * buf = px_size ? lv_mem_alloc(px_cnt * px_size) : NULL;
+
+    /*Read the lines if the decoder didn't decode the whole image*/
+    if(buf && c->inner.img_data == NULL) {
+        lv_coord_t y;
+        for(y = 0; y < header->h; y++) {
+            if(lv_img_decoder_read_line(&c->inner, 0, y, header->w, buf + y * header->w * px_size) != LV_RES_OK) {
+                lv_mem_free(buf);
+                buf = NULL;
+                break;
+            }
+        }
+    }
+    else if(buf) {
+        lv_memcpy(buf, c->inner.img_data, px_cnt * px_size);
+    }
+
+    /*Other color formats, or not enough RAM: use the pixels of the other decoder*/
+    if(buf == NULL) {
+        dsc->header = *header;
+        dsc->img_data = c->inner.img_data;
+        dsc->user_data = c;
+        return LV_RES_OK;
+    }
+
+    lv_img_cf_t cf = header->cf;
+    lv_coord_t w = header->w;
+    lv_coord_t h = header->h;
+    lv_img_decoder_close(&c->inner);
+    lv_mem_free(c);
+
+    /*Drop the alpha channel if all pixels are opaque*/
+    if(cf == LV_IMG_CF_TRUE_COLOR_ALPHA) {
+        uint32_t i;
+        for(i = 0; i < px_cnt; i++) {
+            if(buf[i * px_size + px_size - 1] != LV_OPA_COVER) break;
+        }
+        if(i == px_cnt) {
+            for(i = 0; i < px_cnt; i++) lv_memcpy(&buf[i * sizeof(lv_color_t)], &buf[i * px_size], sizeof(lv_color_t));
+            px_size = sizeof(lv_color_t);
+            cf = LV_IMG_CF_TRUE_COLOR;
+            uint8_t * buf_smaller = lv_mem_realloc(buf, px_cnt * px_size);
+            if(buf_smaller) buf = buf_smaller;
+        }
+    }
+
+    store(hash, cf, w, h, buf, px_cnt * px_size);
+
+    dsc->header.cf = cf;
+    dsc->img_data = buf;
+    dsc->user_data = NULL;
+    return LV_RES_OK;
+}
+
+/*Write a cache file in place of an empty or the least recently used one*/
+static void store(uint64_t hash, lv_img_cf_t cf, lv_coord_t w, lv_coord_t h, const uint8_t * data, uint32_t size)
+{
+    uint32_t need = sizeof(lv_img_fscache_header_t) + size;
+    if(need > LV_IMG_FSCACHE_MAX_SIZE) return;
+
+    uint32_t id = 0;
+    uint32_t i;
+    for(i = 0; i < LV_IMG_FSCACHE_SLOTS; i++) {
+        if(slots[i].size == 0 || !slots[i].valid) {
+            id = i;
+            break;
+        }
+        if(slots[i].stamp < slots[id].stamp) id = i;
+    }
+
+    /*Empty the least recently used files until it fits*/
+    while(1) {
+        uint32_t used = 0;
+        uint32_t lru = LV_IMG_FSCACHE_SLOTS;
+        for(i = 0; i < LV_IMG_FSCACHE_SLOTS; i++) {
+            if(i == id || slots[i].size == 0) continue;
+            used += slots[i].size;
+            if(lru == LV_IMG_FSCACHE_SLOTS || slots[i].stamp < slots[lru].stamp) lru = i;
+        }
+        if(used + need <= LV_IMG_FSCACHE_MAX_SIZE || lru == LV_IMG_FSCACHE_SLOTS) break;
+        evict(lru);
+    }
+
+    if(slots[id].size) stats.evict_cnt++;
+
+    lv_img_fscache_header_t header;
+    lv_memset_00(&header, sizeof(header));
+    lv_memcpy(header.magic, LV_IMG_FSCACHE_MAGIC, 4);
+    header.version = LV_IMG_FSCACHE_VERSION;
+    header.color_depth = FSCACHE_COLOR_DEPTH;
+    header.cf = cf;
+    header.w = w;
+    header.h = h;
+    header.stamp = ++stamp_cnt;
+    header.hash = hash;
+    header.data_size = size;
+
+    char path[LV_FS_MAX_PATH_LENGTH];
+    get_slot_path(path, id);
+    lv_fs_file_t f;
+    slots[id].size = 0;
+    if(lv_fs_open(&f, path, LV_FS_MODE_WR) != LV_FS_RES_OK) {
+        LV_LOG_WARN("can't write %s", path);
+        return;
+    }
+
+    uint32_t bw1 = 0;
+    uint32_t bw2 = 0;
+    lv_fs_res_t res = lv_fs_write(&f, &header, sizeof(header), &bw1);
+    if(res == LV_FS_RES_OK) res = lv_fs_write(&f, data, size, &bw2);
+    lv_fs_close(&f);
+    if(res != LV_FS_RES_OK || bw1 != sizeof(header) || bw2 != size) {
+        LV_LOG_WARN("can't write %s", path);
+        evict(id);
+        return;
+    }
+
+    slots[id].hash = hash;
+    slots[id].size = need;
+    slots[id].stamp = header.stamp;
+    slots[id].valid = 1;
+    stats.write_cnt++;
+}
+
+/*Empty a cache file. lv_fs can't delete files but opening for writing truncates them.*/
+static void evict(uint32_t id)
+{
+    char path[LV_FS_MAX_PATH_LENGTH];
+    get_slot_path(path, id);
+    lv_fs_file_t f;
+    if(lv_fs_open(&f, path, LV_FS_MODE_WR) == LV_FS_RES_OK) lv_fs_close(&f);
+
+    if(slots[id].size) stats.evict_cnt++;
+    slots[id].size = 0;
+}
+
+#endif /*LV_USE_IMG_FSCACHE*/
@@ -0,0 +1,91 @@
+/**
+ * @file lv_img_fscache.h
+ *
+ */
+
+#ifndef LV_IMG_FSCACHE_H
+#define LV_IMG_FSCACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../lv_conf_internal.h"
+#if LV_USE_IMG_FSCACHE
+
+#include <stdint.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LV_IMG_FSCACHE_MAGIC    "LVIC"
+#define LV_IMG_FSCACHE_VERSION  1
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Header of a cache file. It's followed by `data_size` bytes of pixels in the format of
+ * `cf` with `LV_COLOR_DEPTH`. All values are little endian.
+ */
+typedef struct {
+    uint8_t magic[4];           /*LV_IMG_FSCACHE_MAGIC*/
+    uint8_t version;            /*LV_IMG_FSCACHE_VERSION*/
+    uint8_t color_depth;        /*LV_COLOR_DEPTH, bit 7 is set with LV_COLOR_16_SWAP*/
+    uint8_t cf;                 /*LV_IMG_CF_TRUE_COLOR or LV_IMG_CF_TRUE_COLOR_ALPHA*/
+    uint8_t reserved;
+    uint16_t w;
+    uint16_t h;
+    uint32_t stamp;             /*Larger in the files written later*/
+    uint64_t hash;              /*FNV-1a hash of the content of the source file*/
+    uint32_t data_size;
+    uint32_t reserved2;
+} lv_img_fscache_header_t;
+
+typedef struct {
+    uint32_t hit_cnt;           /*Images read from the cache*/
+    uint32_t miss_cnt;          /*Images decoded by the other decoders*/
+    uint32_t write_cnt;         /*Cache files written*/
+    uint32_t evict_cnt;         /*Cache files emptied to make room*/
+} lv_img_fscache_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Register the decoder which keeps the decoded pixels of image files (e.g. PNG and JPG) in files,
+ * so that they are decoded only once, also across restarts.
+ * It's active only if a directory is set with `LV_IMG_FSCACHE_DIR` or `lv_img_fscache_set_dir()`.
+ */
+void lv_img_fscache_init(void);
+
+/**
+ * Set where to keep the cache files. The file system needs to be ready, e.g. LittleFS mounted.
+ * The cache files are read again from here when they are needed first.
+ * @param dir   a directory with drive letter, e.g. "S:" or "S:/imgcache". It needs to exist.
+ *              The string is not copied. NULL or "": don't use the cache.
+ */
+void lv_img_fscache_set_dir(const char * dir);
+
+/**
+ * Get the number of hits, misses, writes and evictions since `lv_img_fscache_init()`
+ * @return pointer to the counters
+ */
+const lv_img_fscache_stats_t * lv_img_fscache_get_stats(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_IMG_FSCACHE*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_IMG_FSCACHE_H*/
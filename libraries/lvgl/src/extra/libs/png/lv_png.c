@@ -16,22 +16,123 @@
 /*********************
  *      DEFINES
  *********************/
+#define PNG_IN_BUF_SIZE     1024
+#define PNG_WINDOW_MAX      (32 * 1024)
+#define PNG_MAX_BITS        15
+#define PNG_FAST_BITS       9
+#define PNG_MAX_OVERRUN     4
+
+#define PNG_GRAY            0
+#define PNG_RGB             2
+#define PNG_PALETTE         3
+#define PNG_GRAY_ALPHA      4
+#define PNG_RGBA            6
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/*Canonical Huffman code with a lookup table for the codes of at most `PNG_FAST_BITS` bits*/
+typedef struct {
+    uint16_t count[PNG_MAX_BITS + 1];   /*Number of codes of each length*/
+    uint16_t symbol[288];               /*Symbols ordered by their codes*/
+    uint16_t fast[1 << PNG_FAST_BITS];  /*symbol << 4 | length, 0: longer code*/
+} png_huff_t;
+
+typedef enum {
+    INFL_BLOCK_HEADER,
+    INFL_STORED,
+    INFL_CODES,
+    INFL_DONE,
+} png_infl_state_t;
+
+/*A PNG image which is inflated and unfiltered row by row*/
+typedef struct {
+    /*Source*/
+    lv_fs_file_t f;
+    bool file_opened;
+    const uint8_t * src_data;       /*The PNG in a C array or NULL*/
+    uint32_t src_size;
+    uint32_t src_pos;               /*Next byte to read*/
+    uint32_t idat_pos;              /*Start of the data of the first IDAT chunk*/
+    uint32_t idat_len;              /*Length of the first IDAT chunk*/
+    uint32_t idat_left;             /*Bytes left from the current IDAT chunk*/
+    bool idat_end;
+    uint8_t in_buf[PNG_IN_BUF_SIZE];
+    uint16_t in_pos;
+    uint16_t in_len;
+    uint8_t overrun;                /*Zero bytes used after the end of the data*/
+
+    /*Image*/
+    uint32_t w;
+    uint32_t h;
+    uint8_t depth;
+    uint8_t color_type;
+    uint8_t interlace;
+    uint8_t bpp;                    /*Bytes per pixel for the filters, at least 1*/
+    uint32_t row_bytes;             /*Without the filter type*/
+    uint8_t palette[256][4];        /*RGBA*/
+    uint16_t palette_size;
+    bool has_trns;
+    uint16_t trns[3];               /*Transparent gray or RGB value*/
+
+    /*Inflate*/
+    png_infl_state_t state;
+    bool last_block;
+    uint32_t bit_buf;
+    uint8_t bit_cnt;
+    uint8_t * window;
+    uint32_t win_mask;
+    uint32_t out_cnt;               /*Number of inflated bytes*/
+    uint32_t copy_len;              /*Bytes left from a stored block or a match*/
+    uint32_t copy_dist;
+    png_huff_t lit;
+    png_huff_t dist;
+
+    /*Rows*/
+    uint8_t * row;                  /*Filter type + the row being inflated*/
+    uint8_t * prev_row;             /*Filter type + the last unfiltered row*/
+    uint32_t next_y;                /*The next row to inflate*/
+    uint8_t * line;                 /*A row in LVGL's format for `decoder_read_line`*/
+    int32_t line_y;
+} png_stream_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static lv_res_t decoder_info(struct _lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header);
 static lv_res_t decoder_open(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc);
+static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
+                                  lv_coord_t len, uint8_t * buf);
 static void decoder_close(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc);
+static lv_res_t decode_interlaced(lv_img_decoder_dsc_t * dsc);
 static void convert_color_depth(uint8_t * img, uint32_t px_cnt);
+static lv_res_t stream_open(png_stream_t * s, const lv_img_decoder_dsc_t * dsc);
+static lv_res_t stream_rewind(png_stream_t * s);
+static void stream_free(png_stream_t * s);
+static lv_res_t row_next(png_stream_t * s);
+static void row_convert(const png_stream_t * s, const uint8_t * in, uint8_t * out);
+static lv_res_t inflate_read(png_stream_t * s, uint8_t * out, uint32_t len);
+static inline uint32_t bits_get(png_stream_t * s, uint8_t n);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+static uint32_t whole_max = LV_PNG_WHOLE_MAX;
+
+static const uint16_t len_base[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const uint8_t len_extra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const uint16_t dist_base[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073,
+    4097, 6145, 8193, 12289, 16385, 24577
+};
+static const uint8_t dist_extra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
 
 /**********************
  *      MACROS
@@ -49,9 +150,15 @@ void lv_png_init(void)
     lv_img_decoder_t * dec = lv_img_decoder_create();
     lv_img_decoder_set_info_cb(dec, decoder_info);
     lv_img_decoder_set_open_cb(dec, decoder_open);
+    lv_img_decoder_set_read_line_cb(dec, decoder_read_line);
     lv_img_decoder_set_close_cb(dec, decoder_close);
 }
 
+void lv_png_set_whole_max(uint32_t size)
+{
+    whole_max = size;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -138,79 +245,106 @@ static lv_res_t decoder_info(struct _lv_img_decoder_t * decoder, const void * sr
 
 
 /**
- * Open a PNG image and return the decided image
- * @param src can be file name or pointer to a C array
- * @param style style of the image object (unused now but certain formats might use it)
- * @return pointer to the decoded image or `LV_IMG_DECODER_OPEN_FAIL` if failed
+ * Open a PNG image. Images which need at most `whole_max` bytes are decoded at once,
+ * the others row by row in `decoder_read_line`.
+ * @param decoder pointer to the decoder
+ * @param dsc pointer to the decoder descriptor
+ * @return LV_RES_OK: opened; LV_RES_INV: not a PNG image or an error
  */
 static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
 {
+    LV_UNUSED(decoder);
 
-    (void) decoder; /*Unused*/
-    uint32_t error;                 /*For the return values of PNG decoder functions*/
-
-    uint8_t * img_data = NULL;
-
-    /*If it's a PNG file...*/
     if(dsc->src_type == LV_IMG_SRC_FILE) {
-        const char * fn = dsc->src;
-        if(strcmp(lv_fs_get_ext(fn), "png") == 0) {              /*Check the extension*/
+        if(strcmp(lv_fs_get_ext(dsc->src), "png") != 0) return LV_RES_INV;
+    }
+    else if(dsc->src_type != LV_IMG_SRC_VARIABLE) {
+        return LV_RES_INV;
+    }
 
-            /*Load the PNG file into buffer. It's still compressed (not decoded)*/
-            unsigned char * png_data;      /*Pointer to the loaded data. Same as the original file just loaded into the RAM*/
-            size_t png_data_size;          /*Size of `png_data` in bytes*/
+    png_stream_t * s = lv_mem_alloc(sizeof(png_stream_t));
+    LV_ASSERT_MALLOC(s);
+    if(s == NULL) return LV_RES_INV;
+    lv_memset_00(s, sizeof(png_stream_t));
 
-            error = lodepng_load_file(&png_data, &png_data_size, fn);   /*Load the file*/
-            if(error) {
-                LV_LOG_WARN("error %" LV_PRIu32 ": %s\n", error, lodepng_error_text(error));
-                return LV_RES_INV;
-            }
+    if(stream_open(s, dsc) != LV_RES_OK) goto error;
 
-            /*Decode the PNG image*/
-            unsigned png_width;             /*Will be the width of the decoded image*/
-            unsigned png_height;            /*Will be the width of the decoded image*/
+    /*Interlaced rows are spread over 7 passes so they can't be streamed*/
+    if(s->interlace) {
+        stream_free(s);
+        return decode_interlaced(dsc);
+    }
 
-            /*Decode the loaded image in ARGB8888 */
-            error = lodepng_decode32(&img_data, &png_width, &png_height, png_data, png_data_size);
-            lv_mem_free(png_data); /*Free the loaded file*/
-            if(error) {
-                if(img_data != NULL) {
-                    lv_mem_free(img_data);
-                }
-                LV_LOG_WARN("error %" LV_PRIu32 ": %s\n", error, lodepng_error_text(error));
-                return LV_RES_INV;
-            }
+    if(stream_rewind(s) != LV_RES_OK) goto error;
 
-            /*Convert the image to the system's color depth*/
-            convert_color_depth(img_data,  png_width * png_height);
-            dsc->img_data = img_data;
-            return LV_RES_OK;     /*The image is fully decoded. Return with its pointer*/
+    /*Decode the whole image directly in LVGL's format if there is enough RAM for it*/
+    uint32_t stride = s->w * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    uint8_t * img = NULL;
+    if(stride * s->h <= whole_max) img = lv_mem_alloc(stride * s->h);
+    if(img) {
+        uint32_t y;
+        for(y = 0; y < s->h; y++) {
+            if(row_next(s) != LV_RES_OK) {
+                lv_mem_free(img);
+                goto error;
+            }
+            row_convert(s, s->prev_row + 1, img + y * stride);
         }
+        stream_free(s);
+        dsc->img_data = img;
+        dsc->user_data = NULL;
+        return LV_RES_OK;
     }
-    /*If it's a PNG file in a  C array...*/
-    else if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
-        const lv_img_dsc_t * img_dsc = dsc->src;
-        unsigned png_width;             /*No used, just required by he decoder*/
-        unsigned png_height;            /*No used, just required by he decoder*/
 
-        /*Decode the image in ARGB8888 */
-        error = lodepng_decode32(&img_data, &png_width, &png_height, img_dsc->data, img_dsc->data_size);
+    s->line = lv_mem_alloc(stride);
+    if(s->line == NULL) goto error;
+    s->line_y = -1;
 
-        if(error) {
-            if(img_data != NULL) {
-                lv_mem_free(img_data);
-            }
-            return LV_RES_INV;
-        }
+    dsc->img_data = NULL;
+    dsc->user_data = s;
+    return LV_RES_OK;
+
+error:
+    LV_LOG_WARN("can't decode the PNG image");
+    stream_free(s);
+    return LV_RES_INV;
+}
+
+/**
+ * Decode `len` pixels starting from the given `x`, `y` coordinates and store them in `buf`.
+ * The rows are inflated forward, so reading an earlier row starts again from the first row.
+ * @param decoder pointer to the decoder
+ * @param dsc pointer to the decoder descriptor
+ * @param x start x coordinate
+ * @param y start y coordinate
+ * @param len number of pixels to decode
+ * @param buf a buffer to store the decoded pixels
+ * @return LV_RES_OK: ok; LV_RES_INV: failed
+ */
+static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
+                                  lv_coord_t len, uint8_t * buf)
+{
+    LV_UNUSED(decoder);
 
-        /*Convert the image to the system's color depth*/
-        convert_color_depth(img_data,  png_width * png_height);
+    png_stream_t * s = dsc->user_data;
+    if(s == NULL || x < 0 || y < 0 || x + len > (int32_t)s->w || y >= (int32_t)s->h) return LV_RES_INV;
 
-        dsc->img_data = img_data;
-        return LV_RES_OK;     /*Return with its pointer*/
+    if(y != s->line_y) {
+        if((uint32_t)y < s->next_y && stream_rewind(s) != LV_RES_OK) return LV_RES_INV;
+        while(s->next_y <= (uint32_t)y) {
+            if(row_next(s) != LV_RES_OK) {
+                /*Start again next time*/
+                s->next_y = UINT32_MAX;
+                s->line_y = -1;
+                return LV_RES_INV;
+            }
+        }
+        row_convert(s, s->prev_row + 1, s->line);
+        s->line_y = y;
     }
 
-    return LV_RES_INV;    /*If not returned earlier then it failed*/
+    lv_memcpy(buf, s->line + x * LV_IMG_PX_SIZE_ALPHA_BYTE, len * LV_IMG_PX_SIZE_ALPHA_BYTE);
+    return LV_RES_OK;
 }
 
 /**
@@ -219,12 +353,62 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
 static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
 {
     LV_UNUSED(decoder); /*Unused*/
+    if(dsc->user_data) {
+        stream_free(dsc->user_data);
+        dsc->user_data = NULL;
+    }
     if(dsc->img_data) {
         lv_mem_free((uint8_t *)dsc->img_data);
         dsc->img_data = NULL;
     }
 }
 
+/**
+ * Decode an interlaced PNG image at once with LodePNG
+ * @param dsc pointer to the decoder descriptor
+ * @return LV_RES_OK: decoded; LV_RES_INV: error
+ */
+static lv_res_t decode_interlaced(lv_img_decoder_dsc_t * dsc)
+{
+    uint32_t error;                 /*For the return values of PNG decoder functions*/
+    uint8_t * img_data = NULL;
+    unsigned png_width;
+    unsigned png_height;
+
+    if(dsc->src_type == LV_IMG_SRC_FILE) {
+        /*Load the PNG file into buffer. It's still compressed (not decoded)*/
+        unsigned char * png_data;      /*Pointer to the loaded data. Same as the original file just loaded into the RAM*/
+        size_t png_data_size;          /*Size of `png_data` in bytes*/
+
+        error = lodepng_load_file(&png_data, &png_data_size, dsc->src);   /*Load the file*/
+        if(error) {
+            LV_LOG_WARN("error %" LV_PRIu32 ": %s\n", error, lodepng_error_text(error));
+            return LV_RES_INV;
+        }
+
+        /*Decode the loaded image in ARGB8888 */
+        error = lodepng_decode32(&img_data, &png_width, &png_height, png_data, png_data_size);
+        lv_mem_free(png_data); /*Free the loaded file*/
+    }
+    else {
+        const lv_img_dsc_t * img_dsc = dsc->src;
+        error = lodepng_decode32(&img_data, &png_width, &png_height, img_dsc->data, img_dsc->data_size);
+    }
+
+    if(error) {
+        if(img_data != NULL) {
+            lv_mem_free(img_data);
+        }
+        LV_LOG_WARN("error %" LV_PRIu32 ": %s\n", error, lodepng_error_text(error));
+        return LV_RES_INV;
+    }
+
+    /*Convert the image to the system's color depth*/
+    convert_color_depth(img_data,  png_width * png_height);
+    dsc->img_data = img_data;
+    return LV_RES_OK;
+}
+
 /**
  * If the display is not in 32 bit format (ARGB888) then covert the image to the current color depth
  * @param img the ARGB888 image
@@ -257,7 +441,7 @@ static void convert_color_depth(uint8_t * img, uint32_t px_cnt)
     lv_color_t c;
     uint32_t i;
     for(i = 0; i < px_cnt; i++) {
-        c = lv_color_make(img_argb[i].ch.red, img_argb[i].ch.green, img_argb[i].ch.blue);
+        c = lv_color_make(img_argb[i].ch.blue, img_argb[i].ch.green, img_argb[i].ch.red);
         img[i * 2 + 1] = img_argb[i].ch.alpha;
         img[i * 2 + 0] = c.full;
     }
@@ -273,6 +457,671 @@ static void convert_color_depth(uint8_t * img, uint32_t px_cnt)
 #endif
 }
 
+static inline uint16_t get_be16(const uint8_t * p)
+{
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static inline uint32_t get_be32(const uint8_t * p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static bool src_read(png_stream_t * s, void * buf, uint32_t len)
+{
+    if(s->src_data) {
+        if(s->src_pos > s->src_size || len > s->src_size - s->src_pos) return false;
+        lv_memcpy(buf, s->src_data + s->src_pos, len);
+    }
+    else {
+        uint32_t rn;
+        if(lv_fs_read(&s->f, buf, len, &rn) != LV_FS_RES_OK || rn != len) return false;
+    }
+    s->src_pos += len;
+    return true;
+}
+
+static bool src_seek(png_stream_t * s, uint32_t pos)
+{
+    if(s->src_data) {
+        if(pos > s->src_size) return false;
+    }
+    else if(lv_fs_seek(&s->f, pos, LV_FS_SEEK_SET) != LV_FS_RES_OK) {
+        return false;
+    }
+    s->src_pos = pos;
+    return true;
+}
+
+/**
+ * Read the header of the next chunk
+ * @param s pointer to a stream
+ * @param len store the length of the chunk's data here
+ * @param type store the type of the chunk here
+ * @return true: ok; false: no more chunks
+ */
+static bool chunk_next(png_stream_t * s, uint32_t * len, uint8_t * type)
+{
+    uint8_t b[8];
+    if(!src_read(s, b, 8)) return false;
+    *len = get_be32(b);
+    lv_memcpy(type, b + 4, 4);
+    return *len <= 0x7FFFFFFF;
+}
+
+/**
+ * Read the header, the palette and the transparency of a PNG image and find its first IDAT chunk
+ * @param s pointer to a zeroed stream
+ * @param dsc the decoder descriptor with the source
+ * @return LV_RES_OK: ok; LV_RES_INV: not a valid PNG image
+ */
+static lv_res_t stream_open(png_stream_t * s, const lv_img_decoder_dsc_t * dsc)
+{
+    if(dsc->src_type == LV_IMG_SRC_FILE) {
+        if(lv_fs_open(&s->f, dsc->src, LV_FS_MODE_RD) != LV_FS_RES_OK) return LV_RES_INV;
+        s->file_opened = true;
+    }
+    else {
+        s->src_data = ((const lv_img_dsc_t *)dsc->src)->data;
+        s->src_size = ((const lv_img_dsc_t *)dsc->src)->data_size;
+    }
+
+    static const uint8_t magic[] = {0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a};
+    uint8_t b[13];
+    if(!src_read(s, b, sizeof(magic)) || memcmp(b, magic, sizeof(magic))) return LV_RES_INV;
+
+    uint32_t len;
+    uint8_t type[4];
+    if(!chunk_next(s, &len, type) || memcmp(type, "IHDR", 4) || len != 13 || !src_read(s, b, 13)) return LV_RES_INV;
+    s->w = get_be32(b);
+    s->h = get_be32(b + 4);
+    s->depth = b[8];
+    s->color_type = b[9];
+    s->interlace = b[12];
+    if(s->w == 0 || s->h == 0 || s->w > LV_COORD_MAX || s->h > LV_COORD_MAX) return LV_RES_INV;
+    if(b[10] != 0 || b[11] != 0 || s->interlace > 1) return LV_RES_INV;
+
+    uint32_t channels;
+    bool depth_ok;
+    uint8_t d = s->depth;
+    switch(s->color_type) {
+        case PNG_GRAY:
+            channels = 1;
+            depth_ok = d == 1 || d == 2 || d == 4 || d == 8 || d == 16;
+            break;
+        case PNG_PALETTE:
+            channels = 1;
+            depth_ok = d == 1 || d == 2 || d == 4 || d == 8;
+            break;
+        case PNG_RGB:
+            channels = 3;
+            depth_ok = d == 8 || d == 16;
+            break;
+        case PNG_GRAY_ALPHA:
+            channels = 2;
+            depth_ok = d == 8 || d == 16;
+            break;
+        case PNG_RGBA:
+            channels = 4;
+            depth_ok = d == 8 || d == 16;
+            break;
+        default:
+            return LV_RES_INV;
+    }
+    if(!depth_ok) return LV_RES_INV;
+    s->row_bytes = (s->w * channels * d + 7) / 8;
+    s->bpp = LV_MAX(channels * d / 8, 1);
+
+    /*Invalid palette indices are black*/
+    uint32_t i;
+    for(i = 0; i < 256; i++) {
+        s->palette[i][0] = 0;
+        s->palette[i][1] = 0;
+        s->palette[i][2] = 0;
+        s->palette[i][3] = 0xFF;
+    }
+
+    /*Skip the CRCs and the unused chunks until the first IDAT*/
+    while(true) {
+        if(!src_seek(s, s->src_pos + 4) || !chunk_next(s, &len, type)) return LV_RES_INV;
+
+        if(memcmp(type, "IDAT", 4) == 0) break;
+        if(memcmp(type, "IEND", 4) == 0) return LV_RES_INV;
+
+        if(memcmp(type, "PLTE", 4) == 0) {
+            if(len % 3 || len > 256 * 3 || !src_read(s, s->in_buf, len)) return LV_RES_INV;
+            s->palette_size = len / 3;
+            for(i = 0; i < s->palette_size; i++) lv_memcpy(s->palette[i], &s->in_buf[i * 3], 3);
+        }
+        else if(memcmp(type, "tRNS", 4) == 0) {
+            if(len > 256 || !src_read(s, s->in_buf, len)) return LV_RES_INV;
+            if(s->color_type == PNG_PALETTE) {
+                if(len > s->palette_size) return LV_RES_INV;
+                for(i = 0; i < len; i++) s->palette[i][3] = s->in_buf[i];
+            }
+            else if(s->color_type == PNG_GRAY || s->color_type == PNG_RGB) {
+                if(len != (s->color_type == PNG_GRAY ? 2 : 6)) return LV_RES_INV;
+                for(i = 0; i < len / 2; i++) s->trns[i] = (s->in_buf[i * 2] << 8) | s->in_buf[i * 2 + 1];
+                s->has_trns = true;
+            }
+        }
+        else if(!src_seek(s, s->src_pos + len)) {
+            return LV_RES_INV;
+        }
+    }
+
+    if(s->color_type == PNG_PALETTE && s->palette_size == 0) return LV_RES_INV;
+
+    s->idat_pos = s->src_pos;
+    s->idat_len = len;
+    return LV_RES_OK;
+}
+
+/**
+ * Start inflating from the first row. The buffers are allocated at the first call.
+ * @param s pointer to an opened stream
+ * @return LV_RES_OK: ok; LV_RES_INV: error
+ */
+static lv_res_t stream_rewind(png_stream_t * s)
+{
+    if(s->window == NULL) {
+        /*Matches can't reach back further than the size of the whole inflated data*/
+        uint32_t size = (s->row_bytes + 1) * s->h;
+        uint32_t win_size = 256;
+        while(win_size < size && win_size < PNG_WINDOW_MAX) win_size <<= 1;
+        s->window = lv_mem_alloc(win_size);
+        s->row = lv_mem_alloc(s->row_bytes + 1);
+        s->prev_row = lv_mem_alloc(s->row_bytes + 1);
+        if(s->window == NULL || s->row == NULL || s->prev_row == NULL) return LV_RES_INV;
+        s->win_mask = win_size - 1;
+    }
+
+    if(!src_seek(s, s->idat_pos)) return LV_RES_INV;
+    s->idat_left = s->idat_len;
+    s->idat_end = false;
+    s->in_pos = 0;
+    s->in_len = 0;
+    s->overrun = 0;
+    s->bit_buf = 0;
+    s->bit_cnt = 0;
+    s->state = INFL_BLOCK_HEADER;
+    s->last_block = false;
+    s->out_cnt = 0;
+    s->copy_len = 0;
+    s->next_y = 0;
+    s->line_y = -1;
+    lv_memset_00(s->prev_row, s->row_bytes + 1);
+
+    /*zlib header: deflate, no preset dictionary. The window size is ignored as LodePNG does*/
+    uint32_t cmf = bits_get(s, 8);
+    uint32_t flg = bits_get(s, 8);
+    if(s->overrun || (cmf & 0x0F) != 8 || ((cmf << 8) | flg) % 31 || (flg & 0x20)) return LV_RES_INV;
+
+    return LV_RES_OK;
+}
+
+static void stream_free(png_stream_t * s)
+{
+    if(s->file_opened) lv_fs_close(&s->f);
+    lv_mem_free(s->window);
+    lv_mem_free(s->row);
+    lv_mem_free(s->prev_row);
+    lv_mem_free(s->line);
+    lv_mem_free(s);
+}
+
+/**
+ * Fill `in_buf` from the IDAT chunks
+ */
+static void in_refill(png_stream_t * s)
+{
+    s->in_pos = 0;
+    s->in_len = 0;
+    if(s->idat_end) return;
+
+    while(s->idat_left == 0) {
+        /*Skip the CRC, the next chunk needs to be an IDAT too*/
+        uint32_t len;
+        uint8_t type[4];
+        if(!src_seek(s, s->src_pos + 4) || !chunk_next(s, &len, type) || memcmp(type, "IDAT", 4)) {
+            s->idat_end = true;
+            return;
+        }
+        s->idat_left = len;
+    }
+
+    uint32_t n = LV_MIN(s->idat_left, PNG_IN_BUF_SIZE);
+    if(!src_read(s, s->in_buf, n)) {
+        s->idat_end = true;
+        return;
+    }
+    s->idat_left -= n;
+    s->in_len = n;
+}
+
+/**
+ * Make sure that `bit_buf` has at least `n` (max. 24) bits.
+ * After the end of the data zeros are added and counted in `overrun`.
+ */
+static inline void bits_need(png_stream_t * s, uint8_t n)
+{
+    while(s->bit_cnt < n) {
+        if(s->in_pos == s->in_len) in_refill(s);
+        if(s->in_pos < s->in_len) s->bit_buf |= (uint32_t)s->in_buf[s->in_pos++] << s->bit_cnt;
+        else s->overrun++;
+        s->bit_cnt += 8;
+    }
+}
+
+static inline uint32_t bits_get(png_stream_t * s, uint8_t n)
+{
+    bits_need(s, n);
+    uint32_t v = s->bit_buf & ((1UL << n) - 1);
+    s->bit_buf >>= n;
+    s->bit_cnt -= n;
+    return v;
+}
+
+/**
+ * Build a canonical Huffman code from code lengths
+ * @param h store the code here
+ * @param lens code length of each symbol, 0: unused
+ * @param n number of symbols
+ * @return true: ok; false: over-subscribed code
+ */
+static bool huff_build(png_huff_t * h, const uint8_t * lens, uint32_t n)
+{
+    uint16_t offs[PNG_MAX_BITS + 1];
+    uint32_t i;
+
+    lv_memset_00(h->count, sizeof(h->count));
+    for(i = 0; i < n; i++) h->count[lens[i]]++;
+    h->count[0] = 0;
+
+    int32_t left = 1;
+    for(i = 1; i <= PNG_MAX_BITS; i++) {
+        left = (left << 1) - h->count[i];
+        if(left < 0) return false;
+    }
+
+    offs[1] = 0;
+    for(i = 1; i < PNG_MAX_BITS; i++) offs[i + 1] = offs[i] + h->count[i];
+    for(i = 0; i < n; i++) {
+        if(lens[i]) h->symbol[offs[lens[i]]++] = i;
+    }
+
+    /*Deflate sends the codes from the MSB, so index the table with the reversed codes*/
+    lv_memset_00(h->fast, sizeof(h->fast));
+    uint32_t code = 0;
+    uint32_t idx = 0;
+    uint32_t len;
+    for(len = 1; len <= PNG_FAST_BITS; len++) {
+        uint32_t k;
+        for(k = 0; k < h->count[len]; k++) {
+            uint32_t rev = 0;
+            uint32_t b;
+            for(b = 0; b < len; b++) rev |= ((code >> b) & 1) << (len - 1 - b);
+            uint16_t e = (h->symbol[idx] << 4) | len;
+            for(; rev < (1 << PNG_FAST_BITS); rev += 1 << len) h->fast[rev] = e;
+            code++;
+            idx++;
+        }
+        code <<= 1;
+    }
+
+    return true;
+}
+
+/**
+ * Decode a symbol
+ * @return the symbol or -1 on invalid code
+ */
+static inline int32_t huff_decode(png_stream_t * s, const png_huff_t * h)
+{
+    bits_need(s, PNG_MAX_BITS);
+    uint16_t e = h->fast[s->bit_buf & ((1 << PNG_FAST_BITS) - 1)];
+    if(e) {
+        s->bit_buf >>= e & 0x0F;
+        s->bit_cnt -= e & 0x0F;
+        return e >> 4;
+    }
+
+    /*Longer codes bit by bit*/
+    int32_t code = 0;
+    int32_t first = 0;
+    int32_t index = 0;
+    uint32_t bits = s->bit_buf;
+    uint32_t len;
+    for(len = 1; len <= PNG_MAX_BITS; len++) {
+        code |= bits & 1;
+        bits >>= 1;
+        int32_t count = h->count[len];
+        if(code - count < first) {
+            s->bit_buf >>= len;
+            s->bit_cnt -= len;
+            return h->symbol[index + (code - first)];
+        }
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+    return -1;
+}
+
+static void read_fixed_codes(png_stream_t * s)
+{
+    uint8_t lens[288];
+    lv_memset(lens, 8, 144);
+    lv_memset(lens + 144, 9, 112);
+    lv_memset(lens + 256, 7, 24);
+    lv_memset(lens + 280, 8, 8);
+    huff_build(&s->lit, lens, 288);
+    lv_memset(lens, 5, 30);
+    huff_build(&s->dist, lens, 30);
+}
+
+static lv_res_t read_dynamic_codes(png_stream_t * s)
+{
+    static const uint8_t order[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+    uint8_t lens[286 + 30];
+
+    uint32_t nlen = bits_get(s, 5) + 257;
+    uint32_t ndist = bits_get(s, 5) + 1;
+    uint32_t ncode = bits_get(s, 4) + 4;
+    if(nlen > 286 || ndist > 30) return LV_RES_INV;
+
+    /*The code lengths are coded too. Use `dist` for their code temporarily*/
+    uint32_t i;
+    lv_memset_00(lens, 19);
+    for(i = 0; i < ncode; i++) lens[order[i]] = bits_get(s, 3);
+    if(!huff_build(&s->dist, lens, 19)) return LV_RES_INV;
+
+    i = 0;
+    while(i < nlen + ndist) {
+        int32_t sym = huff_decode(s, &s->dist);
+        if(sym < 0) return LV_RES_INV;
+        if(sym < 16) {
+            lens[i++] = sym;
+            continue;
+        }
+
+        uint8_t v = 0;
+        uint32_t rep;
+        if(sym == 16) {
+            if(i == 0) return LV_RES_INV;
+            v = lens[i - 1];
+            rep = 3 + bits_get(s, 2);
+        }
+        else if(sym == 17) {
+            rep = 3 + bits_get(s, 3);
+        }
+        else {
+            rep = 11 + bits_get(s, 7);
+        }
+        if(i + rep > nlen + ndist) return LV_RES_INV;
+        lv_memset(&lens[i], v, rep);
+        i += rep;
+    }
+
+    if(lens[256] == 0) return LV_RES_INV;
+    if(!huff_build(&s->lit, lens, nlen)) return LV_RES_INV;
+    if(!huff_build(&s->dist, lens + nlen, ndist)) return LV_RES_INV;
+    return LV_RES_OK;
+}
+
+/**
+ * Inflate exactly `len` bytes. The state is kept between the calls.
+ * @param s pointer to a stream
+ * @param out store the bytes here
+ * @param len number of bytes to inflate
+ * @return LV_RES_OK: ok; LV_RES_INV: corrupted or too short data
+ */
+static lv_res_t inflate_read(png_stream_t * s, uint8_t * out, uint32_t len)
+{
+    uint8_t * win = s->window;
+    uint32_t mask = s->win_mask;
+
+    while(len) {
+        if(s->overrun > PNG_MAX_OVERRUN) return LV_RES_INV;
+
+        if(s->copy_len) {
+            uint32_t n = LV_MIN(s->copy_len, len);
+            s->copy_len -= n;
+            len -= n;
+            if(s->state == INFL_STORED) {
+                while(n--) {
+                    uint8_t b = bits_get(s, 8);
+                    *out++ = b;
+                    win[s->out_cnt++ & mask] = b;
+                }
+            }
+            else {
+                uint32_t d = s->copy_dist;
+                while(n--) {
+                    uint8_t b = win[(s->out_cnt - d) & mask];
+                    *out++ = b;
+                    win[s->out_cnt++ & mask] = b;
+                }
+            }
+            continue;
+        }
+
+        if(s->state == INFL_CODES) {
+            int32_t sym = huff_decode(s, &s->lit);
+            if(sym < 0) return LV_RES_INV;
+            if(sym < 256) {
+                *out++ = sym;
+                win[s->out_cnt++ & mask] = sym;
+                len--;
+            }
+            else if(sym == 256) {
+                s->state = s->last_block ? INFL_DONE : INFL_BLOCK_HEADER;
+            }
+            else {
+                sym -= 257;
+                if(sym >= 29) return LV_RES_INV;
+                uint32_t l = len_base[sym] + bits_get(s, len_extra[sym]);
+                sym = huff_decode(s, &s->dist);
+                if(sym < 0 || sym >= 30) return LV_RES_INV;
+                uint32_t d = dist_base[sym] + bits_get(s, dist_extra[sym]);
+                if(d > s->out_cnt || d > mask + 1) return LV_RES_INV;
+                s->copy_len = l;
+                s->copy_dist = d;
+            }
+        }
+        else if(s->state == INFL_BLOCK_HEADER) {
+            s->last_block = bits_get(s, 1);
+            uint32_t type = bits_get(s, 2);
+            if(type == 0) {
+                /*Stored block from the next byte boundary*/
+                bits_get(s, s->bit_cnt & 7);
+                uint32_t l = bits_get(s, 16);
+                uint32_t nl = bits_get(s, 16);
+                if(l != (~nl & 0xFFFF)) return LV_RES_INV;
+                s->copy_len = l;
+                s->state = INFL_STORED;
+            }
+            else if(type == 1) {
+                read_fixed_codes(s);
+                s->state = INFL_CODES;
+            }
+            else if(type == 2) {
+                if(read_dynamic_codes(s) != LV_RES_OK) return LV_RES_INV;
+                s->state = INFL_CODES;
+            }
+            else {
+                return LV_RES_INV;
+            }
+        }
+        else if(s->state == INFL_STORED) {
+            s->state = s->last_block ? INFL_DONE : INFL_BLOCK_HEADER;
+        }
+        else {
+            return LV_RES_INV;  /*The image needs more data*/
+        }
+    }
+
+    return LV_RES_OK;
+}
+
+static inline uint8_t paeth(uint8_t a, uint8_t b, uint8_t c)
+{
+    int16_t pa = LV_ABS(b - c);
+    int16_t pb = LV_ABS(a - c);
+    int16_t pc = LV_ABS(a + b - 2 * c);
+    if(pa <= pb && pa <= pc) return a;
+    if(pb <= pc) return b;
+    return c;
+}
+
+/**
+ * Inflate and unfilter the next row. It will be in `prev_row`.
+ * @param s pointer to a stream
+ * @return LV_RES_OK: ok; LV_RES_INV: corrupted data
+ */
+static lv_res_t row_next(png_stream_t * s)
+{
+    if(s->next_y >= s->h) return LV_RES_INV;
+    if(inflate_read(s, s->row, s->row_bytes + 1) != LV_RES_OK) return LV_RES_INV;
+
+    uint8_t * cur = s->row + 1;
+    const uint8_t * prev = s->prev_row + 1;
+    uint32_t n = s->row_bytes;
+    uint32_t bpp = s->bpp;
+    uint32_t i;
+    switch(s->row[0]) {
+        case 0:
+            break;
+        case 1:
+            for(i = bpp; i < n; i++) cur[i] += cur[i - bpp];
+            break;
+        case 2:
+            for(i = 0; i < n; i++) cur[i] += prev[i];
+            break;
+        case 3:
+            for(i = 0; i < bpp; i++) cur[i] += prev[i] >> 1;
+            for(i = bpp; i < n; i++) cur[i] += (cur[i - bpp] + prev[i]) >> 1;
+            break;
+        case 4:
+            for(i = 0; i < bpp; i++) cur[i] += prev[i];
+            for(i = bpp; i < n; i++) cur[i] += paeth(cur[i - bpp], prev[i], prev[i - bpp]);
+            break;
+        default:
+            return LV_RES_INV;
+    }
+
+    uint8_t * tmp = s->prev_row;
+    s->prev_row = s->row;
+    s->row = tmp;
+    s->next_y++;
+    return LV_RES_OK;
+}
+
+static inline void px_store(uint8_t * dst, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+{
+#if LV_COLOR_DEPTH == 32
+    dst[0] = b;
+    dst[1] = g;
+    dst[2] = r;
+    dst[3] = a;
+#elif LV_COLOR_DEPTH == 16
+    lv_color_t c = lv_color_make(r, g, b);
+    dst[0] = c.full & 0xFF;
+    dst[1] = c.full >> 8;
+    dst[2] = a;
+#elif LV_COLOR_DEPTH == 8
+    lv_color_t c = lv_color_make(r, g, b);
+    dst[0] = c.full;
+    dst[1] = a;
+#elif LV_COLOR_DEPTH == 1
+    dst[0] = (r | g | b) > 128 ? 1 : 0;
+    dst[1] = a;
+#endif
+}
+
+/**
+ * Convert an unfiltered row to LVGL's `LV_IMG_CF_TRUE_COLOR_ALPHA` format.
+ * 16 bit channels are reduced to their upper byte, as LodePNG does.
+ * @param s pointer to a stream
+ * @param in the unfiltered row
+ * @param out store the pixels here
+ */
+static void row_convert(const png_stream_t * s, const uint8_t * in, uint8_t * out)
+{
+    const uint32_t px_size = LV_IMG_PX_SIZE_ALPHA_BYTE;
+    uint32_t x;
+    uint8_t a;
+
+    if(s->depth == 8) {
+        switch(s->color_type) {
+            case PNG_RGBA:
+                for(x = 0; x < s->w; x++, in += 4, out += px_size) px_store(out, in[0], in[1], in[2], in[3]);
+                break;
+            case PNG_RGB:
+                for(x = 0; x < s->w; x++, in += 3, out += px_size) {
+                    a = s->has_trns && in[0] == s->trns[0] && in[1] == s->trns[1] && in[2] == s->trns[2] ? 0 : 0xFF;
+                    px_store(out, in[0], in[1], in[2], a);
+                }
+                break;
+            case PNG_PALETTE:
+                for(x = 0; x < s->w; x++, out += px_size) {
+                    const uint8_t * p = s->palette[in[x]];
+                    px_store(out, p[0], p[1], p[2], p[3]);
+                }
+                break;
+            case PNG_GRAY:
+                for(x = 0; x < s->w; x++, out += px_size) {
+                    a = s->has_trns && in[x] == s->trns[0] ? 0 : 0xFF;
+                    px_store(out, in[x], in[x], in[x], a);
+                }
+                break;
+            case PNG_GRAY_ALPHA:
+                for(x = 0; x < s->w; x++, in += 2, out += px_size) px_store(out, in[0], in[0], in[0], in[1]);
+                break;
+        }
+    }
+    else if(s->depth == 16) {
+        switch(s->color_type) {
+            case PNG_RGBA:
+                for(x = 0; x < s->w; x++, in += 8, out += px_size) px_store(out, in[0], in[2], in[4], in[6]);
+                break;
+            case PNG_RGB:
+                for(x = 0; x < s->w; x++, in += 6, out += px_size) {
+                    a = s->has_trns && get_be16(in) == s->trns[0] && get_be16(in + 2) == s->trns[1] &&
+                        get_be16(in + 4) == s->trns[2] ? 0 : 0xFF;
+                    px_store(out, in[0], in[2], in[4], a);
+                }
+                break;
+            case PNG_GRAY:
+                for(x = 0; x < s->w; x++, in += 2, out += px_size) {
+                    a = s->has_trns && get_be16(in) == s->trns[0] ? 0 : 0xFF;
+                    px_store(out, in[0], in[0], in[0], a);
+                }
+                break;
+            case PNG_GRAY_ALPHA:
+                for(x = 0; x < s->w; x++, in += 4, out += px_size) px_store(out, in[0], in[0], in[0], in[2]);
+                break;
+        }
+    }
+    else {
+        /*1, 2 or 4 bit gray or palette indices from the MSB*/
+        uint32_t mask = (1 << s->depth) - 1;
+        for(x = 0; x < s->w; x++, out += px_size) {
+            uint32_t bit = x * s->depth;
+            uint32_t v = (in[bit >> 3] >> (8 - s->depth - (bit & 7))) & mask;
+            if(s->color_type == PNG_PALETTE) {
+                const uint8_t * p = s->palette[v];
+                px_store(out, p[0], p[1], p[2], p[3]);
+            }
+            else {
+                uint8_t g = v * 255 / mask;
+                a = s->has_trns && v == s->trns[0] ? 0 : 0xFF;
+                px_store(out, g, g, g, a);
+            }
+        }
+    }
+}
+
 #endif /*LV_USE_PNG*/
 
 
@@ -33,6 +33,14 @@ extern "C" {
  */
 void lv_png_init(void);
 
+/**
+ * Set how much RAM the PNG images opened from now on can use.
+ * Images which need more are decoded row by row while they are drawn.
+ * @param size      decode the whole image when it's opened if it needs at most this many bytes.
+ *                  0: always decode row by row
+ */
+void lv_png_set_whole_max(uint32_t size);
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,598 @@
+/**
+ * @file lv_timg.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../lvgl.h"
+#if LV_USE_TIMG
+
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
+    #define TIMG_COLOR_DEPTH    (LV_COLOR_DEPTH | LV_TIMG_16_SWAP)
+#else
+    #define TIMG_COLOR_DEPTH    LV_COLOR_DEPTH
+#endif
+
+/*The width and height are 11 bits in lv_img_header_t*/
+#define IMG_DIM_MAX     2047
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_timg_header_t header;
+    const uint8_t * tile_data;      /*Tile data of a C array, NULL if it's read from a file*/
+    lv_fs_file_t f;
+    uint32_t tile_data_pos;         /*Position of the tile data in the file*/
+    uint32_t * offsets;             /*Start of the tiles in the tile data and the end of the last*/
+    uint8_t * palette;              /*The colors of the palette as pixels, 256 entries*/
+    uint8_t * buf;                  /*The whole image or the cached tiles*/
+    int32_t * slot_tile;            /*Tile in each cache slot, -1: empty*/
+    uint32_t * slot_used;           /*When the cache slots were used last*/
+    uint8_t * read_buf;             /*A tile read from the file*/
+    uint8_t * unpack_buf;           /*A tile decompressed but not yet in its place*/
+    uint32_t use_cnt;
+    uint32_t tile_cnt;
+    uint16_t tiles_x;
+    uint16_t slot_cnt;
+    uint16_t last_slot;
+    uint8_t px_size;
+    uint8_t file_opened : 1;
+} timg_dsc_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_res_t decoder_info(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header);
+static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
+static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc,
+                                  lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t * buf);
+static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
+static void timg_free(timg_dsc_t * t);
+static lv_res_t read_header(const void * src, lv_timg_header_t * header, lv_fs_file_t * f);
+static lv_res_t read_data(timg_dsc_t * t, const uint8_t * src_data, uint32_t pos, void * buf, uint32_t size);
+static lv_res_t decode_tile(timg_dsc_t * t, uint32_t id, uint8_t * dst, uint32_t dst_stride);
+static const uint8_t * get_tile(timg_dsc_t * t, uint32_t id);
+static bool rle_decode(const uint8_t * in, uint32_t in_size, uint8_t * out, uint32_t out_size, uint8_t unit);
+static bool lz4_decode(const uint8_t * in, uint32_t in_size, uint8_t * out, uint32_t out_size);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint32_t whole_max = LV_TIMG_WHOLE_MAX;
+static uint32_t tile_cache = LV_TIMG_TILE_CACHE_SIZE;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_timg_init(void)
+{
+    lv_img_decoder_t * dec = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(dec, decoder_info);
+    lv_img_decoder_set_open_cb(dec, decoder_open);
+    lv_img_decoder_set_read_line_cb(dec, decoder_read_line);
+    lv_img_decoder_set_close_cb(dec, decoder_close);
+}
+
+void lv_timg_set_cache(uint32_t whole_max_size, uint32_t tile_cache_size)
+{
+    whole_max = whole_max_size;
+    tile_cache = tile_cache_size;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Get info about a tiled image
+ * @param src can be file name or pointer to a C array
+ * @param header store the info here
+ * @return LV_RES_OK: no error; LV_RES_INV: can't get the info
+ */
+static lv_res_t decoder_info(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header)
+{
+    LV_UNUSED(decoder);
+
+    lv_timg_header_t h;
+    if(read_header(src, &h, NULL) != LV_RES_OK) return LV_RES_INV;
+
+    header->always_zero = 0;
+    header->w = h.w;
+    header->h = h.h;
+    header->cf = h.cf;
+    return LV_RES_OK;
+}
+
+/**
+ * Open a tiled image. Small images are decoded at once, the tiles of the others
+ * are decoded on demand in `decoder_read_line`.
+ * @param decoder pointer to the decoder
+ * @param dsc pointer to the decoder descriptor
+ * @return LV_RES_OK: opened; LV_RES_INV: not a tiled image or an error
+ */
+static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+
+    timg_dsc_t * t = lv_mem_alloc(sizeof(timg_dsc_t));
+    LV_ASSERT_MALLOC(t);
+    if(t == NULL) return LV_RES_INV;
+    lv_memset_00(t, sizeof(timg_dsc_t));
+
+    if(read_header(dsc->src, &t->header, dsc->src_type == LV_IMG_SRC_FILE ? &t->f : NULL) != LV_RES_OK) {
+        lv_mem_free(t);
+        return LV_RES_INV;
+    }
+    t->file_opened = dsc->src_type == LV_IMG_SRC_FILE;
+
+    const lv_timg_header_t * h = &t->header;
+    t->tiles_x = (h->w + h->tile_w - 1) / h->tile_w;
+    t->tile_cnt = (uint32_t)t->tiles_x * ((h->h + h->tile_h - 1) / h->tile_h);
+    t->px_size = h->cf == LV_IMG_CF_TRUE_COLOR_ALPHA ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+
+    const uint8_t * src_data = NULL;
+    uint32_t src_size = 0;
+    if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
+        src_data = ((const lv_img_dsc_t *)dsc->src)->data;
+        src_size = ((const lv_img_dsc_t *)dsc->src)->data_size;
+        uint32_t tables = sizeof(lv_timg_header_t) + h->palette_size * 4 + (t->tile_cnt + 1) * sizeof(uint32_t);
+        if(tables > src_size) goto error;
+    }
+
+    uint32_t pos = sizeof(lv_timg_header_t);
+    uint32_t tile_size = (uint32_t)h->tile_w * h->tile_h;
+    uint32_t decoded_size = (uint32_t)h->w * h->h * t->px_size;
+    bool whole = decoded_size <= whole_max;
+
+    /*Convert the palette to pixels. Unused indices are black*/
+    if(h->palette_size) {
+        t->palette = lv_mem_alloc(256 * t->px_size);
+        uint8_t * colors = lv_mem_alloc(h->palette_size * 4);
+        if(t->palette == NULL || colors == NULL ||
+           read_data(t, src_data, pos, colors, h->palette_size * 4) != LV_RES_OK) {
+            lv_mem_free(colors);
+            goto error;
+        }
+        lv_memset_00(t->palette, 256 * t->px_size);
+        uint32_t i;
+        for(i = 0; i < h->palette_size; i++) {
+            const uint8_t * c32 = &colors[i * 4];
+            lv_color_t c = lv_color_make(c32[2], c32[1], c32[0]);
+            lv_memcpy(&t->palette[i * t->px_size], &c, sizeof(lv_color_t));
+            if(h->cf == LV_IMG_CF_TRUE_COLOR_ALPHA) t->palette[(i + 1) * t->px_size - 1] = c32[3];
+        }
+        lv_mem_free(colors);
+        pos += h->palette_size * 4;
+    }
+
+    t->offsets = lv_mem_alloc((t->tile_cnt + 1) * sizeof(uint32_t));
+    if(t->offsets == NULL ||
+       read_data(t, src_data, pos, t->offsets, (t->tile_cnt + 1) * sizeof(uint32_t)) != LV_RES_OK) goto error;
+    pos += (t->tile_cnt + 1) * sizeof(uint32_t);
+
+    uint32_t max_tile = 0;
+    uint32_t i;
+    for(i = 0; i < t->tile_cnt; i++) {
+        if(t->offsets[i + 1] < t->offsets[i]) goto error;
+        max_tile = LV_MAX(max_tile, t->offsets[i + 1] - t->offsets[i]);
+    }
+
+    if(src_data) {
+        if(pos > src_size || t->offsets[t->tile_cnt] > src_size - pos) goto error;
+        t->tile_data = src_data + pos;
+    }
+    else {
+        t->tile_data_pos = pos;
+        t->read_buf = lv_mem_alloc(LV_MAX(max_tile, 1));
+        if(t->read_buf == NULL) goto error;
+    }
+
+    /*Palette indices or tiles of the whole image need a place to be unpacked*/
+    if(h->palette_size || whole) {
+        t->unpack_buf = lv_mem_alloc(tile_size * (h->palette_size ? 1 : t->px_size));
+        if(t->unpack_buf == NULL) goto error;
+    }
+
+    if(whole) {
+        t->buf = lv_mem_alloc(decoded_size);
+        if(t->buf == NULL) goto error;
+
+        uint32_t stride = (uint32_t)h->w * t->px_size;
+        for(i = 0; i < t->tile_cnt; i++) {
+            uint32_t tx = i % t->tiles_x;
+            uint32_t ty = i / t->tiles_x;
+            uint8_t * dst = t->buf + ty * h->tile_h * stride + tx * h->tile_w * t->px_size;
+            if(decode_tile(t, i, dst, stride) != LV_RES_OK) {
+                dsc->error_msg = "Corrupted tile";
+                goto error;
+            }
+        }
+
+        /*Only the pixels are needed from now*/
+        uint8_t * img = t->buf;
+        t->buf = NULL;
+        timg_free(t);
+        dsc->img_data = img;
+        dsc->user_data = NULL;
+        return LV_RES_OK;
+    }
+
+    /*Cache at least one row of tiles so that the lines of a row decode each tile once*/
+    uint32_t tile_bytes = tile_size * t->px_size;
+    uint32_t slot_cnt = tile_cache / tile_bytes;
+    slot_cnt = LV_CLAMP(t->tiles_x, slot_cnt, LV_MIN(t->tile_cnt, 0xFFFF));
+    t->slot_cnt = slot_cnt;
+    t->buf = lv_mem_alloc(slot_cnt * tile_bytes);
+    t->slot_tile = lv_mem_alloc(slot_cnt * sizeof(int32_t));
+    t->slot_used = lv_mem_alloc(slot_cnt * sizeof(uint32_t));
+    if(t->buf == NULL || t->slot_tile == NULL || t->slot_used == NULL) goto error;
+    for(i = 0; i < slot_cnt; i++) {
+        t->slot_tile[i] = -1;
+        t->slot_used[i] = 0;
+    }
+
+    dsc->img_data = NULL;
+    dsc->user_data = t;
+    return LV_RES_OK;
+
+error:
+    LV_LOG_WARN("can't open the tiled image");
+    timg_free(t);
+    return LV_RES_INV;
+}
+
+/**
+ * Decode `len` pixels starting from the given `x`, `y` coordinates and store them in `buf`.
+ * Decodes the tiles which are not in the cache.
+ * @param decoder pointer to the decoder the function associated with
+ * @param dsc pointer to decoder descriptor
+ * @param x start x coordinate
+ * @param y start y coordinate
+ * @param len number of pixels to decode
+ * @param buf a buffer to store the decoded pixels
+ * @return LV_RES_OK: ok; LV_RES_INV: failed
+ */
+static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc,
+                                  lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t * buf)
+{
+    LV_UNUSED(decoder);
+
+    timg_dsc_t * t = dsc->user_data;
+    if(t == NULL) return LV_RES_INV;
+
+    const lv_timg_header_t * h = &t->header;
+    if(x < 0 || y < 0 || len < 0 || x + len > h->w || y >= h->h) return LV_RES_INV;
+
+    uint32_t ty = y / h->tile_h;
+    uint32_t row = y - ty * h->tile_h;
+
+    while(len > 0) {
+        uint32_t tx = x / h->tile_w;
+        const uint8_t * tile = get_tile(t, ty * t->tiles_x + tx);
+        if(tile == NULL) return LV_RES_INV;
+
+        uint32_t tile_w = LV_MIN(h->tile_w, h->w - tx * h->tile_w);
+        uint32_t col = x - tx * h->tile_w;
+        uint32_t n = LV_MIN((uint32_t)len, tile_w - col);
+        lv_memcpy(buf, tile + (row * tile_w + col) * t->px_size, n * t->px_size);
+        buf += n * t->px_size;
+        x += n;
+        len -= n;
+    }
+
+    return LV_RES_OK;
+}
+
+/**
+ * Free the allocated resources
+ */
+static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+
+    if(dsc->user_data) {
+        timg_free(dsc->user_data);
+        dsc->user_data = NULL;
+    }
+    else if(dsc->img_data) {
+        lv_mem_free((void *)dsc->img_data);
+    }
+    dsc->img_data = NULL;
+}
+
+static void timg_free(timg_dsc_t * t)
+{
+    if(t->file_opened) lv_fs_close(&t->f);
+    lv_mem_free(t->offsets);
+    lv_mem_free(t->palette);
+    lv_mem_free(t->buf);
+    lv_mem_free(t->slot_tile);
+    lv_mem_free(t->slot_used);
+    lv_mem_free(t->read_buf);
+    lv_mem_free(t->unpack_buf);
+    lv_mem_free(t);
+}
+
+/**
+ * Read and check the header of a tiled image
+ * @param src   the image source
+ * @param header store the header here
+ * @param f     keep the file open in this if the source is a file, NULL to close it
+ * @return LV_RES_OK: it's a tiled image which can be shown
+ */
+static lv_res_t read_header(const void * src, lv_timg_header_t * header, lv_fs_file_t * f)
+{
+    lv_img_src_t src_type = lv_img_src_get_type(src);
+
+    if(src_type == LV_IMG_SRC_VARIABLE) {
+        const lv_img_dsc_t * img = src;
+        if(img->header.cf != LV_IMG_CF_RAW && img->header.cf != LV_IMG_CF_RAW_ALPHA) return LV_RES_INV;
+        if(img->data == NULL || img->data_size < sizeof(lv_timg_header_t)) return LV_RES_INV;
+        lv_memcpy(header, img->data, sizeof(lv_timg_header_t));
+    }
+    else if(src_type == LV_IMG_SRC_FILE) {
+        if(strcmp(lv_fs_get_ext(src), "timg") != 0) return LV_RES_INV;
+
+        lv_fs_file_t file;
+        if(lv_fs_open(&file, src, LV_FS_MODE_RD) != LV_FS_RES_OK) return LV_RES_INV;
+        uint32_t rn = 0;
+        lv_fs_res_t res = lv_fs_read(&file, header, sizeof(lv_timg_header_t), &rn);
+        if(res != LV_FS_RES_OK || rn != sizeof(lv_timg_header_t) || f == NULL) lv_fs_close(&file);
+        else *f = file;
+        if(res != LV_FS_RES_OK || rn != sizeof(lv_timg_header_t)) return LV_RES_INV;
+    }
+    else {
+        return LV_RES_INV;
+    }
+
+    bool ok = memcmp(header->magic, LV_TIMG_MAGIC, 4) == 0 && header->version == LV_TIMG_VERSION &&
+              (header->cf == LV_IMG_CF_TRUE_COLOR || header->cf == LV_IMG_CF_TRUE_COLOR_ALPHA) &&
+              header->compress <= LV_TIMG_COMPRESS_LZ4 && header->palette_size <= 256 &&
+              header->w > 0 && header->h > 0 && header->tile_w > 0 && header->tile_h > 0 &&
+              header->w <= IMG_DIM_MAX && header->h <= IMG_DIM_MAX;
+
+    if(ok && header->palette_size == 0 && header->color_depth != TIMG_COLOR_DEPTH) {
+        LV_LOG_WARN("the pixels are for color depth %d but LV_COLOR_DEPTH is %d (with swap: 0x%x)",
+                    header->color_depth, LV_COLOR_DEPTH, TIMG_COLOR_DEPTH);
+        ok = false;
+    }
+
+    if(!ok && src_type == LV_IMG_SRC_FILE && f) lv_fs_close(f);
+    return ok ? LV_RES_OK : LV_RES_INV;
+}
+
+static lv_res_t read_data(timg_dsc_t * t, const uint8_t * src_data, uint32_t pos, void * buf, uint32_t size)
+{
+    if(src_data) {
+        lv_memcpy(buf, src_data + pos, size);
+        return LV_RES_OK;
+    }
+
+    uint32_t rn = 0;
+    if(lv_fs_seek(&t->f, pos, LV_FS_SEEK_SET) != LV_FS_RES_OK) return LV_RES_INV;
+    if(lv_fs_read(&t->f, buf, size, &rn) != LV_FS_RES_OK || rn != size) return LV_RES_INV;
+    return LV_RES_OK;
+}
+
+/**
+ * Decode a tile
+ * @param t         the image
+ * @param id        index of the tile
+ * @param dst       store the top left pixel of the tile here
+ * @param dst_stride bytes between the rows in `dst`
+ * @return LV_RES_OK: ok; LV_RES_INV: the tile can't be read or it's corrupted
+ */
+static lv_res_t decode_tile(timg_dsc_t * t, uint32_t id, uint8_t * dst, uint32_t dst_stride)
+{
+    const lv_timg_header_t * h = &t->header;
+    uint32_t tx = id % t->tiles_x;
+    uint32_t ty = id / t->tiles_x;
+    uint32_t w = LV_MIN(h->tile_w, h->w - tx * h->tile_w);
+    uint32_t rows = LV_MIN(h->tile_h, h->h - ty * h->tile_h);
+
+    uint32_t size = t->offsets[id + 1] - t->offsets[id];
+    const uint8_t * src;
+    if(t->tile_data) {
+        src = t->tile_data + t->offsets[id];
+    }
+    else {
+        if(read_data(t, NULL, t->tile_data_pos + t->offsets[id], t->read_buf, size) != LV_RES_OK) return LV_RES_INV;
+        src = t->read_buf;
+    }
+
+    /*Decompress straight to the destination if it's not the whole image*/
+    uint8_t unit = h->palette_size ? 1 : t->px_size;
+    uint32_t row_size = w * t->px_size;
+    uint8_t * out = h->palette_size || dst_stride != row_size ? t->unpack_buf : dst;
+    uint32_t out_size = w * rows * unit;
+
+    bool ok;
+    switch(h->compress) {
+        case LV_TIMG_COMPRESS_RLE:
+            ok = rle_decode(src, size, out, out_size, unit);
+            break;
+        case LV_TIMG_COMPRESS_LZ4:
+            ok = lz4_decode(src, size, out, out_size);
+            break;
+        default:
+            ok = size == out_size;
+            if(ok) lv_memcpy(out, src, size);
+            break;
+    }
+    if(!ok) return LV_RES_INV;
+
+    if(out == dst) return LV_RES_OK;
+
+    uint32_t y;
+    for(y = 0; y < rows; y++) {
+        if(h->palette_size) {
+            const uint8_t * idx = &out[y * w];
+            uint8_t * d = dst;
+            uint32_t x;
+            for(x = 0; x < w; x++) {
+                lv_memcpy(d, &t->palette[idx[x] * t->px_size], t->px_size);
+                d += t->px_size;
+            }
+        }
+        else {
+            lv_memcpy(dst, &out[y * row_size], row_size);
+        }
+        dst += dst_stride;
+    }
+
+    return LV_RES_OK;
+}
+
+/**
+ * Get a decoded tile from the cache or decode it in place of the least recently used one
+ * @return the pixels of the tile, with the width of the tile as stride, or NULL on error
+ */
+static const uint8_t * get_tile(timg_dsc_t * t, uint32_t id)
+{
+    uint32_t tile_bytes = (uint32_t)t->header.tile_w * t->header.tile_h * t->px_size;
+    uint32_t slot = t->last_slot;
+
+    if(t->slot_tile[slot] != (int32_t)id) {
+        uint32_t lru = 0;
+        for(slot = 0; slot < t->slot_cnt; slot++) {
+            if(t->slot_tile[slot] == (int32_t)id) break;
+            if(t->slot_used[slot] < t->slot_used[lru]) lru = slot;
+        }
+
+        if(slot == t->slot_cnt) {
+            slot = lru;
+            uint8_t * dst = t->buf + slot * tile_bytes;
+            uint32_t tx = id % t->tiles_x;
+            uint32_t w = LV_MIN(t->header.tile_w, t->header.w - tx * t->header.tile_w);
+            if(decode_tile(t, id, dst, w * t->px_size) != LV_RES_OK) {
+                t->slot_tile[slot] = -1;
+                t->slot_used[slot] = 0;
+                return NULL;
+            }
+            t->slot_tile[slot] = id;
+        }
+        t->last_slot = slot;
+    }
+
+    t->use_cnt++;
+    t->slot_used[slot] = t->use_cnt;
+    return t->buf + slot * tile_bytes;
+}
+
+/**
+ * Decode RLE data. A control byte with bit 7 set is followed by a unit repeated
+ * `(control & 0x7F) + 1` times, else by `control + 1` literal units.
+ * @return true: `out` is filled exactly
+ */
+static bool rle_decode(const uint8_t * in, uint32_t in_size, uint8_t * out, uint32_t out_size, uint8_t unit)
+{
+    const uint8_t * in_end = in + in_size;
+    uint8_t * out_end = out + out_size;
+
+    while(out < out_end) {
+        if(in >= in_end) return false;
+        uint8_t ctrl = *in++;
+        uint32_t n = ((ctrl & 0x7F) + 1) * (uint32_t)unit;
+        if(n > (uint32_t)(out_end - out)) return false;
+
+        if(ctrl & 0x80) {
+            if((uint32_t)(in_end - in) < unit) return false;
+            if(unit == 1) {
+                lv_memset(out, *in, n);
+            }
+            else {
+                uint8_t * end = out + n;
+                for(; out < end; out += unit) lv_memcpy(out, in, unit);
+                out -= n;
+            }
+            in += unit;
+        }
+        else {
+            if((uint32_t)(in_end - in) < n) return false;
+            lv_memcpy(out, in, n);
+            in += n;
+        }
+        out += n;
+    }
+
+    return in == in_end;
+}
+
+/**
+ * Decode an LZ4 block
+ * @return true: `out` is filled exactly
+ */
+static bool lz4_decode(const uint8_t * in, uint32_t in_size, uint8_t * out, uint32_t out_size)
+{
+    const uint8_t * in_end = in + in_size;
+    uint8_t * op = out;
+    uint8_t * out_end = out + out_size;
+
+    while(in < in_end) {
+        uint8_t token = *in++;
+
+        /*Literals*/
+        uint32_t len = token >> 4;
+        if(len == 15) {
+            uint8_t b;
+            do {
+                if(in >= in_end) return false;
+                b = *in++;
+                len += b;
+            } while(b == 255);
+        }
+        if(len > (uint32_t)(in_end - in) || len > (uint32_t)(out_end - op)) return false;
+        lv_memcpy(op, in, len);
+        op += len;
+        in += len;
+
+        /*The last sequence has only literals*/
+        if(in == in_end) break;
+
+        /*Match*/
+        if(in_end - in < 2) return false;
+        uint32_t offset = in[0] | ((uint32_t)in[1] << 8);
+        in += 2;
+        if(offset == 0 || offset > (uint32_t)(op - out)) return false;
+
+        len = token & 0x0F;
+        if(len == 15) {
+            uint8_t b;
+            do {
+                if(in >= in_end) return false;
+                b = *in++;
+                len += b;
+            } while(b == 255);
+        }
+        len += 4;
+        if(len > (uint32_t)(out_end - op)) return false;
+
+        /*The match can overlap with the bytes written now*/
+        const uint8_t * match = op - offset;
+        if(offset >= len) {
+            lv_memcpy(op, match, len);
+            op += len;
+        }
+        else {
+            while(len--) *op++ = *match++;
+        }
+    }
+
+    return op == out_end;
+}
+
+#endif /*LV_USE_TIMG*/
@@ -0,0 +1,91 @@
+/**
+ * @file lv_timg.h
+ *
+ */
+
+#ifndef LV_TIMG_H
+#define LV_TIMG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../lv_conf_internal.h"
+#if LV_USE_TIMG
+
+#include <stdint.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LV_TIMG_MAGIC       "LVTI"
+#define LV_TIMG_VERSION     1
+
+/*Set in `color_depth` of the header if the pixels are for `LV_COLOR_16_SWAP 1`*/
+#define LV_TIMG_16_SWAP     0x80
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+enum {
+    LV_TIMG_COMPRESS_NONE,
+    LV_TIMG_COMPRESS_RLE,   /*Runs and literals of pixels*/
+    LV_TIMG_COMPRESS_LZ4,   /*LZ4 block format*/
+};
+typedef uint8_t lv_timg_compress_t;
+
+/**
+ * Header of a tiled image. It's followed by `palette_size` lv_color32_t colors,
+ * the `tile count + 1` uint32_t start offsets of the tiles in the tile data, and the tile data.
+ * The tiles are in row-major order, and the tiles in the last column and row can be smaller.
+ * All values are little endian.
+ */
+typedef struct {
+    uint8_t magic[4];           /*LV_TIMG_MAGIC*/
+    uint8_t version;            /*LV_TIMG_VERSION*/
+    uint8_t cf;                 /*LV_IMG_CF_TRUE_COLOR or LV_IMG_CF_TRUE_COLOR_ALPHA*/
+    uint8_t compress;           /*lv_timg_compress_t*/
+    uint8_t color_depth;        /*LV_COLOR_DEPTH of the pixels, with LV_TIMG_16_SWAP. 0 with palette*/
+    uint16_t w;
+    uint16_t h;
+    uint16_t tile_w;
+    uint16_t tile_h;
+    uint16_t palette_size;      /*0: the tiles store pixels, else 1 byte palette indices*/
+    uint16_t reserved;
+} lv_timg_header_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Register the decoder of the tiled images made with `scripts/img_to_timg.py`.
+ * The images can be C arrays (`lv_img_dsc_t` with `LV_IMG_CF_RAW` or `LV_IMG_CF_RAW_ALPHA`)
+ * or files with `.timg` extension.
+ */
+void lv_timg_init(void);
+
+/**
+ * Set how much RAM the images opened from now on can use.
+ * @param whole_max     decode the whole image when it's opened if it needs at most this many bytes.
+ *                      0: always decode the tiles on demand
+ * @param tile_cache    RAM for the decoded tiles of an image which is decoded on demand.
+ *                      At least one row of tiles is always kept.
+ */
+void lv_timg_set_cache(uint32_t whole_max, uint32_t tile_cache);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_TIMG*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_TIMG_H*/
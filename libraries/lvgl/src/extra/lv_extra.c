@@ -78,10 +78,18 @@ void lv_extra_init(void)
     lv_split_jpeg_init();
 #endif
 
+#if LV_USE_TIMG
+    lv_timg_init();
+#endif
+
 #if LV_USE_BMP
     lv_bmp_init();
 #endif
 
+#if LV_USE_IMG_FSCACHE
+    lv_img_fscache_init();
+#endif
+
 #if LV_USE_FREETYPE
     /*Init freetype library*/
 #  if LV_FREETYPE_CACHE_SIZE >= 0
@@ -14,6 +14,7 @@ extern "C" {
  *      INCLUDES
  *********************/
 #include "snapshot/lv_snapshot.h"
+#include "snapshot/lv_snapshot_cache.h"
 #include "monkey/lv_monkey.h"
 #include "gridnav/lv_gridnav.h"
 #include "fragment/lv_fragment.h"
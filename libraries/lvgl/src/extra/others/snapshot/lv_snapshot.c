@@ -87,6 +87,37 @@ lv_res_t lv_snapshot_take_to_buf(lv_obj_t * obj, lv_img_cf_t cf, lv_img_dsc_t *
     LV_ASSERT_NULL(dsc);
     LV_ASSERT_NULL(buf);
 
+    if(lv_snapshot_buf_size_needed(obj, cf) > buff_size)
+        return LV_RES_INV;
+
+    lv_area_t snapshot_area;
+    lv_coord_t ext_size = _lv_obj_get_ext_draw_size(obj);
+    lv_obj_get_coords(obj, &snapshot_area);
+    lv_area_increase(&snapshot_area, ext_size, ext_size);
+
+    return lv_snapshot_take_area_to_buf(obj, &snapshot_area, cf, dsc, buf, buff_size);
+}
+
+/** Take snapshot of an area of an object with its children, save image info to provided buffer.
+ * The layout of the object should be up to date.
+ *
+ * @param obj    The object to generate snapshot.
+ * @param area   the area to save in absolute coordinates, e.g. a part of the object
+ * @param cf     color format for generated image.
+ * @param dsc    image descriptor to store the image result.
+ * @param buf    the buffer to store image data.
+ * @param buff_size provided buffer size in bytes.
+ *
+ * @return LV_RES_OK on success, LV_RES_INV on error.
+ */
+lv_res_t lv_snapshot_take_area_to_buf(lv_obj_t * obj, const lv_area_t * area, lv_img_cf_t cf, lv_img_dsc_t * dsc,
+                                      void * buf, uint32_t buff_size)
+{
+    LV_ASSERT_NULL(obj);
+    LV_ASSERT_NULL(area);
+    LV_ASSERT_NULL(dsc);
+    LV_ASSERT_NULL(buf);
+
     switch(cf) {
         case LV_IMG_CF_TRUE_COLOR:
         case LV_IMG_CF_TRUE_COLOR_ALPHA:
@@ -99,19 +130,15 @@ lv_res_t lv_snapshot_take_to_buf(lv_obj_t * obj, lv_img_cf_t cf, lv_img_dsc_t *
             return LV_RES_INV;
     }
 
-    if(lv_snapshot_buf_size_needed(obj, cf) > buff_size)
-        return LV_RES_INV;
-
     /*Width and height determine snapshot image size.*/
-    lv_coord_t w = lv_obj_get_width(obj);
-    lv_coord_t h = lv_obj_get_height(obj);
-    lv_coord_t ext_size = _lv_obj_get_ext_draw_size(obj);
-    w += ext_size * 2;
-    h += ext_size * 2;
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t h = lv_area_get_height(area);
+    uint8_t px_size = lv_img_cf_get_px_size(cf);
+    if(w <= 0 || h <= 0 || (uint32_t)w * h * ((px_size + 7) >> 3) > buff_size)
+        return LV_RES_INV;
 
     lv_area_t snapshot_area;
-    lv_obj_get_coords(obj, &snapshot_area);
-    lv_area_increase(&snapshot_area, ext_size, ext_size);
+    lv_area_copy(&snapshot_area, area);
 
     lv_memset(buf, 0x00, buff_size);
     lv_memset_00(dsc, sizeof(lv_img_dsc_t));
@@ -121,7 +148,7 @@ lv_res_t lv_snapshot_take_to_buf(lv_obj_t * obj, lv_img_cf_t cf, lv_img_dsc_t *
     lv_disp_drv_init(&driver);
     /*In lack of a better idea use the resolution of the object's display*/
     driver.hor_res = lv_disp_get_hor_res(obj_disp);
-    driver.ver_res = lv_disp_get_hor_res(obj_disp);
+    driver.ver_res = lv_disp_get_ver_res(obj_disp);
     lv_disp_drv_use_generic_set_px_cb(&driver, cf);
 
     lv_disp_t fake_disp;
@@ -143,6 +170,9 @@ lv_res_t lv_snapshot_take_to_buf(lv_obj_t * obj, lv_img_cf_t cf, lv_img_dsc_t *
 
     lv_obj_redraw(draw_ctx, obj);
 
+    /*The image might be used right away, e.g. by the snapshot cache*/
+    if(draw_ctx->wait_for_finish) draw_ctx->wait_for_finish(draw_ctx);
+
     _lv_refr_set_disp_refreshing(refr_ori);
     obj_disp->driver->draw_ctx_deinit(fake_disp.driver, draw_ctx);
     lv_mem_free(draw_ctx);
@@ -71,6 +71,21 @@ uint32_t lv_snapshot_buf_size_needed(lv_obj_t * obj, lv_img_cf_t cf);
  */
 lv_res_t lv_snapshot_take_to_buf(lv_obj_t * obj, lv_img_cf_t cf, lv_img_dsc_t * dsc, void * buf, uint32_t buff_size);
 
+/** Take snapshot of an area of an object with its children, save image info to provided buffer.
+ * The layout of the object should be up to date.
+ *
+ * @param obj    The object to generate snapshot.
+ * @param area   the area to save in absolute coordinates, e.g. a part of the object
+ * @param cf     color format for generated image.
+ * @param dsc    image descriptor to store the image result.
+ * @param buff   the buffer to store image data.
+ * @param buff_size provided buffer size in bytes.
+ *
+ * @return LV_RES_OK on success, LV_RES_INV on error.
+ */
+lv_res_t lv_snapshot_take_area_to_buf(lv_obj_t * obj, const lv_area_t * area, lv_img_cf_t cf, lv_img_dsc_t * dsc,
+                                      void * buf, uint32_t buff_size);
+
 
 /**********************
  *      MACROS
@@ -0,0 +1,347 @@
+/**
+ * @file lv_snapshot_cache.c
+ *
+ * Draw the objects with `LV_OBJ_FLAG_CACHE_LAYER` from a snapshot of them and their children.
+ * Only the opaque middle of the object is cached, without alpha channel, so it can be simply
+ * copied. The edges (rounded corners, shadow, outline) are drawn normally.
+ * When a child is invalidated, its area is redrawn on the snapshot. When the object itself is
+ * invalidated, e.g. its style, size or position is changed, a new snapshot is taken.
+ * The snapshots are kept in the shared budget of `lv_draw_cache`.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_snapshot_cache.h"
+#if LV_USE_SNAPSHOT && LV_USE_SNAPSHOT_CACHE
+
+#include "../../../core/lv_refr.h"
+#include "../../../misc/lv_assert.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct _snapshot_t {
+    lv_draw_cache_entry_t cache;    /*Must be the first*/
+    struct _snapshot_t * next;
+    const lv_obj_t * obj;
+    lv_img_dsc_t img;
+    lv_area_t area;                 /*Absolute coordinates of the snapshot when it was taken*/
+    lv_area_t dirty;                /*Absolute coordinates of the area to redraw on the snapshot*/
+    uint8_t has_dirty : 1;
+    uint8_t stale : 1;              /*Dropped while it was drawn, free it when it's not used anymore*/
+} snapshot_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static snapshot_t * find_snapshot(const lv_obj_t * obj);
+static snapshot_t * take_snapshot(lv_obj_t * obj, const lv_area_t * area);
+static bool update_snapshot(snapshot_t * s, lv_obj_t * obj);
+static void add_dirty_area(snapshot_t * s, const lv_area_t * area);
+static void drop_snapshot(snapshot_t * s);
+static void free_snapshot(snapshot_t * s);
+static void snapshot_evict_cb(lv_draw_cache_entry_t * entry);
+static bool get_cached_area(lv_obj_t * obj, lv_area_t * area);
+static void redraw_around(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj, const lv_area_t * area);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static snapshot_t * snapshot_ll;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_res_t _lv_snapshot_cache_draw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
+{
+    /*The children out of the object wouldn't be on the snapshot*/
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) return LV_RES_INV;
+
+    lv_area_t area;
+    if(!get_cached_area(obj, &area)) return LV_RES_INV;
+
+    snapshot_t * s = find_snapshot(obj);
+    if(s && !_lv_area_is_equal(&s->area, &area)) {
+        /*Moved by scrolling the parent: the same pixels are just at other coordinates*/
+        if(!s->has_dirty && lv_area_get_width(&s->area) == lv_area_get_width(&area) &&
+           lv_area_get_height(&s->area) == lv_area_get_height(&area)) {
+            s->area = area;
+        }
+        else {
+            drop_snapshot(s);
+            s = NULL;
+        }
+    }
+
+    lv_area_t clip_area;
+    if(_lv_area_intersect(&clip_area, &area, draw_ctx->clip_area)) {
+        if(s) {
+            _lv_draw_cache_hit(&s->cache);
+            if(s->has_dirty && !update_snapshot(s, obj)) s = NULL;
+        }
+        else {
+            _lv_draw_cache_miss(LV_DRAW_CACHE_TYPE_LAYER);
+        }
+
+        if(s == NULL) s = take_snapshot(obj, &area);
+        if(s == NULL) return LV_RES_INV;
+
+        lv_draw_img_dsc_t draw_dsc;
+        lv_draw_img_dsc_init(&draw_dsc);
+
+        /*Like `lv_draw_img()`, draw only on the image*/
+        const lv_area_t * clip_area_ori = draw_ctx->clip_area;
+        draw_ctx->clip_area = &clip_area;
+        s->cache.used_cnt++;
+        lv_draw_img_decoded(draw_ctx, &draw_dsc, &area, s->img.data, s->img.header.cf);
+        s->cache.used_cnt--;
+        draw_ctx->clip_area = clip_area_ori;
+
+        if(s->stale) drop_snapshot(s);
+    }
+
+    redraw_around(draw_ctx, obj, &area);
+
+    return LV_RES_OK;
+}
+
+void _lv_snapshot_cache_invalidate(const lv_obj_t * obj, const lv_area_t * area)
+{
+    /*Nothing to do in the usual case*/
+    if(snapshot_ll == NULL) return;
+
+    while(obj) {
+        snapshot_t * s = find_snapshot(obj);
+        if(s) add_dirty_area(s, area);
+        obj = lv_obj_get_parent(obj);
+    }
+}
+
+void _lv_snapshot_cache_drop(const lv_obj_t * obj)
+{
+    snapshot_t * s = find_snapshot(obj);
+    if(s) drop_snapshot(s);
+}
+
+void _lv_snapshot_cache_deinit(void)
+{
+    /*Nothing is drawn now, so none of them is in use*/
+    while(snapshot_ll) {
+        _lv_draw_cache_remove(&snapshot_ll->cache);
+        free_snapshot(snapshot_ll);
+    }
+}
+
+bool lv_snapshot_cache_is_cached(const lv_obj_t * obj)
+{
+    snapshot_t * s = find_snapshot(obj);
+    return s && !s->stale;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static snapshot_t * find_snapshot(const lv_obj_t * obj)
+{
+    snapshot_t * s = snapshot_ll;
+    while(s && s->obj != obj) s = s->next;
+    return s;
+}
+
+/**
+ * Take a new snapshot of an object.
+ * @param obj   pointer to an object
+ * @param area  the area to save, see `get_cached_area()`
+ * @return      the new snapshot or NULL if the area is not opaque or there is no room for it
+ */
+static snapshot_t * take_snapshot(lv_obj_t * obj, const lv_area_t * area)
+{
+    /*Without alpha channel only the opaque pixels can be saved*/
+    lv_cover_check_info_t info;
+    info.res = LV_COVER_RES_COVER;
+    info.area = area;
+    lv_event_send(obj, LV_EVENT_COVER_CHECK, &info);
+    if(info.res != LV_COVER_RES_COVER) return NULL;
+
+    uint32_t buf_size = lv_area_get_size(area) * sizeof(lv_color_t);
+
+    snapshot_t * s = lv_mem_alloc(sizeof(snapshot_t));
+    LV_ASSERT_MALLOC(s);
+    if(s == NULL) return NULL;
+    lv_memset_00(s, sizeof(snapshot_t));
+    s->obj = obj;
+    s->area = *area;
+    s->cache.key = (uint32_t)(lv_uintptr_t)obj;
+
+    /*Add it first to drop the least recently used items before allocating the buffer*/
+    if(!_lv_draw_cache_add(&s->cache, LV_DRAW_CACHE_TYPE_LAYER, sizeof(snapshot_t) + buf_size, snapshot_evict_cb)) {
+        LV_LOG_INFO("the snapshot of %p doesn't fit into the budget", (void *)obj);
+        lv_mem_free(s);
+        return NULL;
+    }
+    s->next = snapshot_ll;
+    snapshot_ll = s;
+
+    /*The children might have snapshots too which are taken meanwhile*/
+    s->cache.used_cnt++;
+    void * buf = _lv_draw_cache_alloc(buf_size);
+    lv_res_t res = LV_RES_INV;
+    if(buf) res = lv_snapshot_take_area_to_buf(obj, area, LV_IMG_CF_TRUE_COLOR, &s->img, buf, buf_size);
+    s->cache.used_cnt--;
+
+    if(res != LV_RES_OK) {
+        _lv_draw_cache_free(buf);
+        s->img.data = NULL;
+        drop_snapshot(s);
+        return NULL;
+    }
+
+    return s;
+}
+
+/**
+ * Redraw the dirty area of a snapshot.
+ * @param s     pointer to a snapshot with dirty area
+ * @param obj   the object of the snapshot
+ * @return      true: updated; false: failed and the snapshot is dropped
+ */
+static bool update_snapshot(snapshot_t * s, lv_obj_t * obj)
+{
+    s->has_dirty = 0;
+
+    /*The children might have snapshots too which are taken meanwhile*/
+    s->cache.used_cnt++;
+    uint32_t buf_size = lv_area_get_size(&s->dirty) * sizeof(lv_color_t);
+    lv_color_t * buf = lv_mem_alloc(buf_size);
+    LV_ASSERT_MALLOC(buf);
+    lv_img_dsc_t dsc;
+    if(buf == NULL || lv_snapshot_take_area_to_buf(obj, &s->dirty, LV_IMG_CF_TRUE_COLOR, &dsc, buf, buf_size) != LV_RES_OK) {
+        lv_mem_free(buf);
+        s->cache.used_cnt--;
+        drop_snapshot(s);
+        return false;
+    }
+
+    lv_coord_t snapshot_w = lv_area_get_width(&s->area);
+    lv_coord_t dirty_w = lv_area_get_width(&s->dirty);
+    lv_color_t * dest = (lv_color_t *)s->img.data;
+    dest += (s->dirty.y1 - s->area.y1) * snapshot_w + (s->dirty.x1 - s->area.x1);
+    const lv_color_t * src = buf;
+    lv_coord_t y;
+    for(y = s->dirty.y1; y <= s->dirty.y2; y++) {
+        lv_memcpy(dest, src, dirty_w * sizeof(lv_color_t));
+        dest += snapshot_w;
+        src += dirty_w;
+    }
+
+    lv_mem_free(buf);
+    s->cache.used_cnt--;
+    return true;
+}
+
+static void add_dirty_area(snapshot_t * s, const lv_area_t * area)
+{
+    lv_area_t dirty;
+    if(!_lv_area_intersect(&dirty, area, &s->area)) return;
+
+    if(s->has_dirty) _lv_area_join(&s->dirty, &s->dirty, &dirty);
+    else s->dirty = dirty;
+    s->has_dirty = 1;
+
+    /*E.g. the style of the object is changed. Redrawing it is the same as taking a new snapshot.*/
+    if(_lv_area_is_equal(&s->dirty, &s->area)) drop_snapshot(s);
+}
+
+/**
+ * Remove a snapshot from the cache and free it, or only mark it as stale if it's being drawn.
+ * @param s     pointer to a snapshot
+ */
+static void drop_snapshot(snapshot_t * s)
+{
+    if(s->cache.used_cnt > 0) {
+        s->stale = 1;
+        return;
+    }
+
+    _lv_draw_cache_remove(&s->cache);
+    free_snapshot(s);
+}
+
+static void free_snapshot(snapshot_t * s)
+{
+    snapshot_t ** prev = &snapshot_ll;
+    while(*prev != s) prev = &(*prev)->next;
+    *prev = s->next;
+
+    _lv_draw_cache_free((void *)s->img.data);
+    lv_mem_free(s);
+}
+
+static void snapshot_evict_cb(lv_draw_cache_entry_t * entry)
+{
+    free_snapshot((snapshot_t *)entry);
+}
+
+/**
+ * Get the area of an object which is cached: its coordinates without the rounded corners.
+ * @param obj   pointer to an object
+ * @param area  store the area here in absolute coordinates
+ * @return      false: the object is too small
+ */
+static bool get_cached_area(lv_obj_t * obj, lv_area_t * area)
+{
+    lv_coord_t r = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+    lv_coord_t short_side = LV_MIN(lv_obj_get_width(obj), lv_obj_get_height(obj));
+    if(r > short_side >> 1) r = short_side >> 1;
+
+    lv_obj_get_coords(obj, area);
+    lv_area_increase(area, -r, -r);
+    return area->x1 <= area->x2 && area->y1 <= area->y2;
+}
+
+/**
+ * Draw the object normally on the parts of the clip area out of its snapshot.
+ * @param draw_ctx  pointer to the draw context
+ * @param obj       pointer to an object
+ * @param area      the area of the snapshot
+ */
+static void redraw_around(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj, const lv_area_t * area)
+{
+    const lv_area_t * clip_area_ori = draw_ctx->clip_area;
+    lv_area_t parts[4];
+
+    /*Above, below, left and right*/
+    parts[0] = *clip_area_ori;
+    parts[0].y2 = LV_MIN(clip_area_ori->y2, area->y1 - 1);
+    parts[1] = *clip_area_ori;
+    parts[1].y1 = LV_MAX(clip_area_ori->y1, area->y2 + 1);
+    parts[2] = *clip_area_ori;
+    parts[2].y1 = LV_MAX(clip_area_ori->y1, area->y1);
+    parts[2].y2 = LV_MIN(clip_area_ori->y2, area->y2);
+    parts[3] = parts[2];
+    parts[2].x2 = LV_MIN(clip_area_ori->x2, area->x1 - 1);
+    parts[3].x1 = LV_MAX(clip_area_ori->x1, area->x2 + 1);
+
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        if(parts[i].x1 > parts[i].x2 || parts[i].y1 > parts[i].y2) continue;
+        draw_ctx->clip_area = &parts[i];
+        lv_obj_redraw(draw_ctx, obj);
+    }
+
+    draw_ctx->clip_area = clip_area_ori;
+}
+
+#endif /*LV_USE_SNAPSHOT && LV_USE_SNAPSHOT_CACHE*/
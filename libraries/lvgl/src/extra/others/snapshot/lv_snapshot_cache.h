@@ -0,0 +1,84 @@
+/**
+ * @file lv_snapshot_cache.h
+ *
+ */
+
+#ifndef LV_SNAPSHOT_CACHE_H
+#define LV_SNAPSHOT_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_snapshot.h"
+#include "../../../draw/lv_draw_cache.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#if LV_USE_SNAPSHOT && LV_USE_SNAPSHOT_CACHE
+
+#if LV_DRAW_CACHE_BUDGET == 0
+#error "LV_USE_SNAPSHOT_CACHE requires LV_DRAW_CACHE_BUDGET"
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Draw an object with `LV_OBJ_FLAG_CACHE_LAYER` and its children from a snapshot.
+ * Only the opaque middle of the object is cached, the rest is drawn normally.
+ * If there is no snapshot yet, take it first. A hit or miss is counted for `LV_DRAW_CACHE_TYPE_LAYER`.
+ * @param draw_ctx  pointer to the draw context of the refresh
+ * @param obj       pointer to the object to draw
+ * @return          LV_RES_OK: drawn; LV_RES_INV: it can't be cached, draw the object normally
+ */
+lv_res_t _lv_snapshot_cache_draw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
+
+/**
+ * Mark an area as changed on the snapshots of an object and its parents. It's redrawn on the snapshots
+ * before they are drawn next time. If the whole snapshot is changed, e.g. the style of the object,
+ * the snapshot is dropped. Called when an area of the object is invalidated.
+ * @param obj       pointer to an object
+ * @param area      the changed area in absolute coordinates
+ */
+void _lv_snapshot_cache_invalidate(const lv_obj_t * obj, const lv_area_t * area);
+
+/**
+ * Drop the snapshot of an object, e.g. because it's deleted.
+ * @param obj       pointer to an object
+ */
+void _lv_snapshot_cache_drop(const lv_obj_t * obj);
+
+/**
+ * Free all the snapshots. Called by `lv_deinit()`.
+ */
+void _lv_snapshot_cache_deinit(void);
+
+/**
+ * Check whether an object's snapshot is cached.
+ * @param obj       pointer to an object
+ * @return          true: the object is drawn from a snapshot on the next refresh
+ */
+bool lv_snapshot_cache_is_cached(const lv_obj_t * obj);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_SNAPSHOT && LV_USE_SNAPSHOT_CACHE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_SNAPSHOT_CACHE_H*/
@@ -148,6 +148,10 @@ typedef struct {
 #if LV_USE_LED
     lv_style_t led;
 #endif
+
+#if LV_USE_VLIST
+    lv_style_t vlist_row;
+#endif
 } my_theme_styles_t;
 
 typedef struct {
@@ -628,6 +632,14 @@ static void style_init(void)
     lv_style_set_transform_width(&styles->list_item_grow, PAD_DEF);
 #endif
 
+#if LV_USE_VLIST
+    style_init_reset(&styles->vlist_row);
+    lv_style_set_border_width(&styles->vlist_row, lv_disp_dpx(theme.disp, 1));
+    lv_style_set_border_color(&styles->vlist_row, color_grey);
+    lv_style_set_border_side(&styles->vlist_row, LV_BORDER_SIDE_BOTTOM);
+    lv_style_set_pad_hor(&styles->vlist_row, PAD_DEF);
+    lv_style_set_pad_column(&styles->vlist_row, PAD_SMALL);
+#endif
 
 #if LV_USE_LED
     style_init_reset(&styles->led);
@@ -1148,6 +1160,21 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj)
     }
 #endif
 
+#if LV_USE_VLIST
+    else if(lv_obj_check_type(obj, &lv_vlist_class)) {
+        lv_obj_add_style(obj, &styles->card, 0);
+        lv_obj_add_style(obj, &styles->pad_zero, 0);
+        lv_obj_add_style(obj, &styles->clip_corner, 0);
+        lv_obj_add_style(obj, &styles->outline_primary, LV_STATE_FOCUS_KEY);
+        lv_obj_add_style(obj, &styles->scrollbar, LV_PART_SCROLLBAR);
+        lv_obj_add_style(obj, &styles->scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_PRESSED);
+    }
+    else if(lv_obj_check_type(obj, &lv_vlist_row_class)) {
+        lv_obj_add_style(obj, &styles->vlist_row, 0);
+        lv_obj_add_style(obj, &styles->bg_color_primary, LV_STATE_CHECKED);
+    }
+#endif
+
 #if LV_USE_COLORWHEEL
     else if(lv_obj_check_type(obj, &lv_colorwheel_class)) {
         lv_obj_add_style(obj, &styles->colorwheel_main, 0);
@@ -28,6 +28,7 @@ extern "C" {
 #include "tabview/lv_tabview.h"
 #include "tileview/lv_tileview.h"
 #include "win/lv_win.h"
+#include "vlist/lv_vlist.h"
 #include "colorwheel/lv_colorwheel.h"
 #include "led/lv_led.h"
 #include "imgbtn/lv_imgbtn.h"
@@ -0,0 +1,687 @@
+/**
+ * @file lv_vlist.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_vlist.h"
+#if LV_USE_VLIST
+
+#include "../../../misc/lv_assert.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MY_CLASS    &lv_vlist_class
+
+#define SCROLLBAR_MIN_SIZE      (LV_DPX(10))
+#define SCROLL_ANIM_TIME_MIN    200    /*ms*/
+#define SCROLL_ANIM_TIME_MAX    400    /*ms*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void lv_vlist_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_vlist_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_vlist_event(const lv_obj_class_t * class_p, lv_event_t * e);
+static void create_row_objs(lv_obj_t * obj);
+static void refr_row_objs(lv_obj_t * obj, bool force);
+static void fill_row_obj(lv_obj_t * obj, uint16_t slot, uint32_t row);
+static void set_scroll_y(lv_obj_t * obj, uint32_t y);
+static uint32_t get_max_scroll(lv_obj_t * obj);
+static void scroll_to_show_row(lv_obj_t * obj, uint32_t row);
+static void scroll_anim_cb(void * obj, int32_t v);
+static bool get_scrollbar_area(lv_obj_t * obj, lv_area_t * area);
+static void draw_scrollbar(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+const lv_obj_class_t lv_vlist_class = {
+    .constructor_cb = lv_vlist_constructor,
+    .destructor_cb = lv_vlist_destructor,
+    .event_cb = lv_vlist_event,
+    .width_def = (LV_DPI_DEF * 3) / 2,
+    .height_def = LV_DPI_DEF * 2,
+    .instance_size = sizeof(lv_vlist_t),
+    .editable = LV_OBJ_CLASS_EDITABLE_TRUE,
+    .group_def = LV_OBJ_CLASS_GROUP_DEF_TRUE,
+    .base_class = &lv_obj_class
+};
+
+const lv_obj_class_t lv_vlist_row_class = {
+    .base_class = &lv_obj_class,
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_obj_t * lv_vlist_create(lv_obj_t * parent)
+{
+    LV_LOG_INFO("begin");
+    lv_obj_t * obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+    return obj;
+}
+
+/*=====================
+ * Setter functions
+ *====================*/
+
+void lv_vlist_set_cell_cb(lv_obj_t * obj, lv_vlist_cell_cb_t cell_cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    vlist->cell_cb = cell_cb;
+    refr_row_objs(obj, true);
+}
+
+void lv_vlist_set_row_cnt(lv_obj_t * obj, uint32_t row_cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    vlist->row_cnt = row_cnt;
+    if(vlist->sel_row != LV_VLIST_NONE && vlist->sel_row >= row_cnt) vlist->sel_row = LV_VLIST_NONE;
+
+    uint32_t max = get_max_scroll(obj);
+    if(vlist->scroll_y > max) vlist->scroll_y = max;
+
+    /*The rows which are still visible are not filled again. Use `lv_vlist_refresh()` if they have changed too.*/
+    refr_row_objs(obj, false);
+}
+
+void lv_vlist_set_row_height(lv_obj_t * obj, lv_coord_t h)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(vlist->row_h == h) return;
+    vlist->row_h = h;
+
+    uint32_t max = get_max_scroll(obj);
+    if(vlist->scroll_y > max) vlist->scroll_y = max;
+
+    create_row_objs(obj);
+}
+
+void lv_vlist_set_col_cnt(lv_obj_t * obj, uint16_t col_cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(col_cnt == 0) col_cnt = 1;
+    if(vlist->col_cnt == col_cnt) return;
+
+    lv_coord_t * new_col_w = lv_mem_realloc(vlist->col_w, col_cnt * sizeof(lv_coord_t));
+    LV_ASSERT_MALLOC(new_col_w);
+    if(new_col_w == NULL) return;
+
+    uint16_t i;
+    for(i = vlist->col_cnt; i < col_cnt; i++) new_col_w[i] = 0;
+    vlist->col_w = new_col_w;
+    vlist->col_cnt = col_cnt;
+
+    create_row_objs(obj);
+}
+
+void lv_vlist_set_col_width(lv_obj_t * obj, uint16_t col_id, lv_coord_t w)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(col_id >= vlist->col_cnt) return;
+    if(vlist->col_w[col_id] == w) return;
+
+    vlist->col_w[col_id] = w;
+    create_row_objs(obj);
+}
+
+void lv_vlist_set_selected_row(lv_obj_t * obj, uint32_t row)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(row != LV_VLIST_NONE && row >= vlist->row_cnt) row = LV_VLIST_NONE;
+    vlist->sel_row = row;
+
+    uint16_t i;
+    for(i = 0; i < vlist->row_obj_cnt; i++) {
+        if(vlist->row_obj_ids[i] == row) lv_obj_add_state(vlist->row_objs[i], LV_STATE_CHECKED);
+        else lv_obj_clear_state(vlist->row_objs[i], LV_STATE_CHECKED);
+    }
+}
+
+/*=====================
+ * Getter functions
+ *====================*/
+
+uint32_t lv_vlist_get_row_cnt(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+    return vlist->row_cnt;
+}
+
+lv_coord_t lv_vlist_get_row_height(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+    return vlist->row_h;
+}
+
+uint16_t lv_vlist_get_col_cnt(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+    return vlist->col_cnt;
+}
+
+uint32_t lv_vlist_get_selected_row(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+    return vlist->sel_row;
+}
+
+uint32_t lv_vlist_get_first_visible_row(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(vlist->row_cnt == 0 || vlist->row_h <= 0) return LV_VLIST_NONE;
+    return vlist->scroll_y / vlist->row_h;
+}
+
+uint32_t lv_vlist_get_scroll_y(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+    return vlist->scroll_y;
+}
+
+lv_obj_t * lv_vlist_get_row_obj(lv_obj_t * obj, uint32_t row)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(vlist->row_obj_cnt == 0 || row == LV_VLIST_NONE) return NULL;
+
+    uint16_t slot = row % vlist->row_obj_cnt;
+    if(vlist->row_obj_ids[slot] != row) return NULL;
+    return vlist->row_objs[slot];
+}
+
+uint16_t lv_vlist_get_row_obj_cnt(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+    return vlist->row_obj_cnt;
+}
+
+/*=====================
+ * Other functions
+ *====================*/
+
+void lv_vlist_scroll_to_row(lv_obj_t * obj, uint32_t row, lv_anim_enable_t anim_en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(vlist->row_h <= 0) return;
+    if(row > UINT32_MAX / vlist->row_h) row = UINT32_MAX / vlist->row_h;
+    lv_vlist_scroll_to_y(obj, row * vlist->row_h, anim_en);
+}
+
+void lv_vlist_scroll_to_y(lv_obj_t * obj, uint32_t y, lv_anim_enable_t anim_en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    uint32_t max = get_max_scroll(obj);
+    if(y > max) y = max;
+
+    lv_anim_del(obj, scroll_anim_cb);
+    if(anim_en == LV_ANIM_OFF || y == vlist->scroll_y) {
+        set_scroll_y(obj, y);
+        return;
+    }
+
+    /*The same speed as the normal scrolling*/
+    int32_t d = LV_ABS((int32_t)y - (int32_t)vlist->scroll_y);
+    uint32_t t = lv_anim_speed_to_time((lv_disp_get_ver_res(lv_obj_get_disp(obj)) * 2) >> 2, 0, d);
+    if(t < SCROLL_ANIM_TIME_MIN) t = SCROLL_ANIM_TIME_MIN;
+    if(t > SCROLL_ANIM_TIME_MAX) t = SCROLL_ANIM_TIME_MAX;
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, obj);
+    lv_anim_set_exec_cb(&a, scroll_anim_cb);
+    lv_anim_set_values(&a, vlist->scroll_y, y);
+    lv_anim_set_time(&a, t);
+    lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+    lv_anim_start(&a);
+}
+
+void lv_vlist_refresh(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    refr_row_objs(obj, true);
+}
+
+void lv_vlist_refresh_row(lv_obj_t * obj, uint32_t row)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(lv_vlist_get_row_obj(obj, row) == NULL) return;
+    fill_row_obj(obj, row % vlist->row_obj_cnt, row);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void lv_vlist_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    LV_TRACE_OBJ_CREATE("begin");
+
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    vlist->row_h = LV_DPX(40);
+    vlist->sel_row = LV_VLIST_NONE;
+    vlist->col_cnt = 1;
+    vlist->col_w = lv_mem_alloc(sizeof(lv_coord_t));
+    LV_ASSERT_MALLOC(vlist->col_w);
+    if(vlist->col_w) vlist->col_w[0] = 0;
+
+    /*The rows are scrolled by the list itself, without LVGL's scrolling,
+     *because the height of all the rows can be larger than the max. coordinate*/
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_SCROLL_CHAIN_VER);
+
+    LV_TRACE_OBJ_CREATE("finished");
+}
+
+static void lv_vlist_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    /*The row objects are already deleted as children*/
+    lv_anim_del(obj, scroll_anim_cb);
+    lv_mem_free(vlist->row_objs);
+    lv_mem_free(vlist->row_obj_ids);
+    lv_mem_free(vlist->col_w);
+    vlist->row_objs = NULL;
+    vlist->row_obj_ids = NULL;
+    vlist->col_w = NULL;
+    vlist->row_obj_cnt = 0;
+}
+
+static void lv_vlist_event(const lv_obj_class_t * class_p, lv_event_t * e)
+{
+    LV_UNUSED(class_p);
+
+    lv_res_t res;
+
+    /*Call the ancestor's event handler*/
+    res = lv_obj_event_base(MY_CLASS, e);
+    if(res != LV_RES_OK) return;
+
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_target(e);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(code == LV_EVENT_SIZE_CHANGED || code == LV_EVENT_STYLE_CHANGED) {
+        /*Create the row objects again only if the content size has changed*/
+        if(vlist->row_objs_w != lv_obj_get_content_width(obj) || vlist->row_objs_h != lv_obj_get_content_height(obj)) {
+            uint32_t max = get_max_scroll(obj);
+            if(vlist->scroll_y > max) vlist->scroll_y = max;
+            create_row_objs(obj);
+        }
+    }
+    else if(code == LV_EVENT_PRESSED) {
+        lv_anim_del(obj, scroll_anim_cb);
+        vlist->dragged = 0;
+        vlist->drag_sum = 0;
+        vlist->throw_v = 0;
+    }
+    else if(code == LV_EVENT_PRESSING) {
+        lv_indev_t * indev = lv_indev_get_act();
+        if(indev == NULL || lv_indev_get_type(indev) != LV_INDEV_TYPE_POINTER) return;
+
+        lv_point_t vect;
+        lv_indev_get_vect(indev, &vect);
+        if(vect.y == 0) return;
+
+        /*Start scrolling only after the scroll limit as the normal scrolling does*/
+        if(!vlist->dragged) {
+            vlist->drag_sum += vect.y;
+            if(LV_ABS(vlist->drag_sum) < indev->driver->scroll_limit) return;
+            vlist->dragged = 1;
+            vect.y = vlist->drag_sum;
+        }
+
+        vlist->throw_v = vect.y;
+        int32_t y = (int32_t)vlist->scroll_y - vect.y;
+        set_scroll_y(obj, y < 0 ? 0 : y);
+    }
+    else if(code == LV_EVENT_RELEASED || code == LV_EVENT_PRESS_LOST) {
+        /*Continue the scrolling in the direction of the last move and slow it down*/
+        lv_indev_t * indev = lv_indev_get_act();
+        if(vlist->dragged && vlist->throw_v && indev && lv_obj_has_flag(obj, LV_OBJ_FLAG_SCROLL_MOMENTUM)) {
+            int32_t v = vlist->throw_v;
+            int32_t d = 0;
+            while(v) {
+                d += v;
+                v = v * (100 - indev->driver->scroll_throw) / 100;
+            }
+            int32_t y = (int32_t)vlist->scroll_y - d;
+            lv_vlist_scroll_to_y(obj, y < 0 ? 0 : y, LV_ANIM_ON);
+        }
+
+        if(lv_obj_get_scrollbar_mode(obj) == LV_SCROLLBAR_MODE_ACTIVE) lv_obj_invalidate(obj);
+    }
+    else if(code == LV_EVENT_CLICKED) {
+        if(vlist->dragged || vlist->row_h <= 0) return;
+
+        lv_indev_t * indev = lv_indev_get_act();
+        if(indev == NULL || lv_indev_get_type(indev) != LV_INDEV_TYPE_POINTER) return;
+
+        lv_point_t p;
+        lv_indev_get_point(indev, &p);
+        lv_area_t content;
+        lv_obj_get_content_coords(obj, &content);
+        if(p.y < content.y1 || p.y > content.y2) return;
+
+        uint32_t row = (vlist->scroll_y + (p.y - content.y1)) / vlist->row_h;
+        if(row >= vlist->row_cnt) return;
+
+        lv_vlist_set_selected_row(obj, row);
+        res = lv_event_send(obj, LV_EVENT_VALUE_CHANGED, NULL);
+        if(res != LV_RES_OK) return;
+    }
+    else if(code == LV_EVENT_KEY) {
+        if(vlist->row_cnt == 0) return;
+
+        uint32_t c = *((uint32_t *)lv_event_get_param(e));
+        uint32_t sel = vlist->sel_row;
+        if(c == LV_KEY_DOWN || c == LV_KEY_RIGHT) {
+            if(sel == LV_VLIST_NONE) sel = lv_vlist_get_first_visible_row(obj);
+            else if(sel + 1 < vlist->row_cnt) sel++;
+        }
+        else if(c == LV_KEY_UP || c == LV_KEY_LEFT) {
+            if(sel == LV_VLIST_NONE) sel = lv_vlist_get_first_visible_row(obj);
+            else if(sel > 0) sel--;
+        }
+        else {
+            return;
+        }
+
+        if(sel != vlist->sel_row) {
+            lv_vlist_set_selected_row(obj, sel);
+            scroll_to_show_row(obj, sel);
+            res = lv_event_send(obj, LV_EVENT_VALUE_CHANGED, NULL);
+            if(res != LV_RES_OK) return;
+        }
+    }
+    else if(code == LV_EVENT_DRAW_POST) {
+        draw_scrollbar(obj, lv_event_get_draw_ctx(e));
+    }
+}
+
+/**
+ * Create enough row objects to cover the content area of the list, plus the overscan
+ * @param obj       pointer to a virtual list object
+ */
+static void create_row_objs(lv_obj_t * obj)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    uint16_t i;
+    for(i = 0; i < vlist->row_obj_cnt; i++) {
+        lv_obj_del(vlist->row_objs[i]);
+    }
+    lv_mem_free(vlist->row_objs);
+    lv_mem_free(vlist->row_obj_ids);
+    vlist->row_objs = NULL;
+    vlist->row_obj_ids = NULL;
+    vlist->row_obj_cnt = 0;
+
+    lv_coord_t content_w = lv_obj_get_content_width(obj);
+    lv_coord_t content_h = lv_obj_get_content_height(obj);
+    vlist->row_objs_w = content_w;
+    vlist->row_objs_h = content_h;
+    if(content_h <= 0 || vlist->row_h <= 0 || vlist->col_w == NULL) return;
+
+    /*A partially visible row at the top and at the bottom*/
+    uint32_t cnt = (content_h + vlist->row_h - 1) / vlist->row_h + 1 + 2 * LV_VLIST_OVERSCAN;
+    vlist->row_objs = lv_mem_alloc(cnt * sizeof(lv_obj_t *));
+    vlist->row_obj_ids = lv_mem_alloc(cnt * sizeof(uint32_t));
+    LV_ASSERT_MALLOC(vlist->row_objs);
+    LV_ASSERT_MALLOC(vlist->row_obj_ids);
+    if(vlist->row_objs == NULL || vlist->row_obj_ids == NULL) {
+        lv_mem_free(vlist->row_objs);
+        lv_mem_free(vlist->row_obj_ids);
+        vlist->row_objs = NULL;
+        vlist->row_obj_ids = NULL;
+        return;
+    }
+
+    lv_coord_t * col_x = lv_mem_buf_get(vlist->col_cnt * sizeof(lv_coord_t) * 2);
+    lv_coord_t * col_w = col_x + vlist->col_cnt;
+
+    for(i = 0; i < cnt; i++) {
+        lv_obj_t * row_obj = lv_obj_class_create_obj(&lv_vlist_row_class, obj);
+        lv_obj_class_init_obj(row_obj);
+        lv_obj_clear_flag(row_obj, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_CLICK_FOCUSABLE | LV_OBJ_FLAG_SCROLLABLE);
+        lv_obj_add_flag(row_obj, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_set_size(row_obj, content_w, vlist->row_h);
+
+        /*All the rows have the same style so calculate the columns with the first*/
+        if(i == 0) {
+            lv_coord_t row_w = content_w - lv_obj_get_style_pad_left(row_obj, LV_PART_MAIN) -
+                               lv_obj_get_style_pad_right(row_obj, LV_PART_MAIN) -
+                               2 * lv_obj_get_style_border_width(row_obj, LV_PART_MAIN);
+            lv_coord_t gap = lv_obj_get_style_pad_column(row_obj, LV_PART_MAIN);
+            lv_coord_t rem_w = row_w - gap * (vlist->col_cnt - 1);
+            uint16_t share_cnt = 0;
+            uint16_t c;
+            for(c = 0; c < vlist->col_cnt; c++) {
+                if(vlist->col_w[c]) rem_w -= vlist->col_w[c];
+                else share_cnt++;
+            }
+
+            lv_coord_t x = 0;
+            for(c = 0; c < vlist->col_cnt; c++) {
+                col_w[c] = vlist->col_w[c] ? vlist->col_w[c] : LV_MAX(rem_w / share_cnt, 0);
+                col_x[c] = x;
+                x += col_w[c] + gap;
+            }
+        }
+
+        uint16_t c;
+        for(c = 0; c < vlist->col_cnt; c++) {
+            lv_obj_t * label = lv_label_create(row_obj);
+            lv_label_set_long_mode(label, LV_LABEL_LONG_CLIP);
+            lv_label_set_text_static(label, "");
+            lv_obj_set_width(label, col_w[c]);
+            lv_obj_align(label, LV_ALIGN_LEFT_MID, col_x[c], 0);
+        }
+
+        vlist->row_objs[i] = row_obj;
+        vlist->row_obj_ids[i] = LV_VLIST_NONE;
+    }
+
+    lv_mem_buf_release(col_x);
+    vlist->row_obj_cnt = cnt;
+
+    refr_row_objs(obj, true);
+}
+
+/**
+ * Show the visible rows with the row objects and position them.
+ * A row object shows always the same rows (row index % row object count) so
+ * only the rows which became visible need to be filled.
+ * @param obj       pointer to a virtual list object
+ * @param force     true: fill all the visible rows, even if they are shown already
+ */
+static void refr_row_objs(lv_obj_t * obj, bool force)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+    if(vlist->row_obj_cnt == 0) return;
+
+    uint32_t first = vlist->scroll_y / vlist->row_h;
+    first = first > LV_VLIST_OVERSCAN ? first - LV_VLIST_OVERSCAN : 0;
+
+    uint16_t i;
+    for(i = 0; i < vlist->row_obj_cnt; i++) {
+        uint32_t row = first + i;
+        uint16_t slot = row % vlist->row_obj_cnt;
+        lv_obj_t * row_obj = vlist->row_objs[slot];
+
+        if(row >= vlist->row_cnt) {
+            if(vlist->row_obj_ids[slot] != LV_VLIST_NONE) {
+                lv_obj_add_flag(row_obj, LV_OBJ_FLAG_HIDDEN);
+                vlist->row_obj_ids[slot] = LV_VLIST_NONE;
+            }
+            continue;
+        }
+
+        if(force || vlist->row_obj_ids[slot] != row) fill_row_obj(obj, slot, row);
+
+        lv_obj_set_y(row_obj, (lv_coord_t)((int32_t)(row * vlist->row_h) - (int32_t)vlist->scroll_y));
+    }
+
+    lv_obj_invalidate(obj);
+}
+
+/**
+ * Get the text of a row into a row object
+ * @param obj       pointer to a virtual list object
+ * @param slot      index of the row object
+ * @param row       index of the row
+ */
+static void fill_row_obj(lv_obj_t * obj, uint16_t slot, uint32_t row)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+    lv_obj_t * row_obj = vlist->row_objs[slot];
+
+    char buf[LV_VLIST_CELL_BUF_SIZE];
+    uint16_t c;
+    for(c = 0; c < vlist->col_cnt; c++) {
+        buf[0] = '\0';
+        if(vlist->cell_cb) vlist->cell_cb(obj, row, c, buf, sizeof(buf));
+        lv_label_set_text(lv_obj_get_child(row_obj, c), buf);
+    }
+
+    vlist->row_obj_ids[slot] = row;
+    lv_obj_clear_flag(row_obj, LV_OBJ_FLAG_HIDDEN);
+    if(row == vlist->sel_row) lv_obj_add_state(row_obj, LV_STATE_CHECKED);
+    else lv_obj_clear_state(row_obj, LV_STATE_CHECKED);
+}
+
+static void set_scroll_y(lv_obj_t * obj, uint32_t y)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    uint32_t max = get_max_scroll(obj);
+    if(y > max) y = max;
+    if(y == vlist->scroll_y) return;
+
+    vlist->scroll_y = y;
+    refr_row_objs(obj, false);
+    lv_event_send(obj, LV_EVENT_SCROLL, NULL);
+}
+
+static uint32_t get_max_scroll(lv_obj_t * obj)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+    if(vlist->row_h <= 0) return 0;
+
+    uint32_t total_h = vlist->row_cnt > UINT32_MAX / vlist->row_h ? UINT32_MAX : vlist->row_cnt * vlist->row_h;
+    lv_coord_t content_h = lv_obj_get_content_height(obj);
+    if(content_h <= 0) return total_h;
+
+    return total_h > (uint32_t)content_h ? total_h - content_h : 0;
+}
+
+static void scroll_to_show_row(lv_obj_t * obj, uint32_t row)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    uint32_t row_y = row * vlist->row_h;
+    lv_coord_t content_h = lv_obj_get_content_height(obj);
+    if(row_y < vlist->scroll_y) {
+        lv_vlist_scroll_to_y(obj, row_y, LV_ANIM_ON);
+    }
+    else if(row_y + vlist->row_h > vlist->scroll_y + content_h) {
+        lv_vlist_scroll_to_y(obj, row_y + vlist->row_h - content_h, LV_ANIM_ON);
+    }
+}
+
+static void scroll_anim_cb(void * obj, int32_t v)
+{
+    set_scroll_y(obj, v);
+}
+
+static bool get_scrollbar_area(lv_obj_t * obj, lv_area_t * area)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    lv_scrollbar_mode_t mode = lv_obj_get_scrollbar_mode(obj);
+    if(mode == LV_SCROLLBAR_MODE_OFF) return false;
+    if(mode == LV_SCROLLBAR_MODE_ACTIVE && !lv_obj_has_state(obj, LV_STATE_PRESSED) &&
+       lv_anim_get(obj, scroll_anim_cb) == NULL) return false;
+
+    uint32_t max = get_max_scroll(obj);
+    if(max == 0) return false;
+
+    lv_coord_t sb_w = lv_obj_get_style_width(obj, LV_PART_SCROLLBAR);
+    if(sb_w <= 0) return false;
+
+    lv_coord_t pad_top = lv_obj_get_style_pad_top(obj, LV_PART_SCROLLBAR);
+    lv_coord_t pad_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_SCROLLBAR);
+    lv_coord_t pad_right = lv_obj_get_style_pad_right(obj, LV_PART_SCROLLBAR);
+    lv_coord_t track_h = lv_obj_get_height(obj) - pad_top - pad_bottom;
+    if(track_h <= 0) return false;
+
+    /*The size is proportional to the visible part but not too small to see it with many rows*/
+    uint32_t content_h = lv_obj_get_content_height(obj);
+    lv_coord_t sb_h = (lv_coord_t)(((uint64_t)track_h * content_h) / (max + content_h));
+    sb_h = LV_MAX(sb_h, SCROLLBAR_MIN_SIZE);
+    sb_h = LV_MIN(sb_h, track_h);
+    lv_coord_t sb_y = (lv_coord_t)(((uint64_t)(track_h - sb_h) * vlist->scroll_y) / max);
+
+    area->x2 = obj->coords.x2 - pad_right;
+    area->x1 = area->x2 - sb_w + 1;
+    area->y1 = obj->coords.y1 + pad_top + sb_y;
+    area->y2 = area->y1 + sb_h - 1;
+    return true;
+}
+
+static void draw_scrollbar(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
+{
+    lv_area_t area;
+    if(!get_scrollbar_area(obj, &area)) return;
+
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    lv_obj_init_draw_rect_dsc(obj, LV_PART_SCROLLBAR, &dsc);
+    lv_draw_rect(draw_ctx, &dsc, &area);
+}
+
+#endif /*LV_USE_VLIST*/
@@ -0,0 +1,237 @@
+/**
+ * @file lv_vlist.h
+ *
+ */
+
+#ifndef LV_VLIST_H
+#define LV_VLIST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../lvgl.h"
+
+#if LV_USE_VLIST
+
+/*Testing of dependencies*/
+#if LV_USE_LABEL == 0
+#error "lv_vlist: lv_label is required. Enable it in lv_conf.h (LV_USE_LABEL 1)"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LV_VLIST_NONE           0xFFFFFFFF
+
+/*Size of the buffer where the text of a cell is written*/
+#define LV_VLIST_CELL_BUF_SIZE  128
+
+/*Rows created above and below the visible ones*/
+#define LV_VLIST_OVERSCAN       1
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Get the text of a cell when its row becomes visible.
+ * @param obj       pointer to the virtual list
+ * @param row       index of the row
+ * @param col       index of the column
+ * @param buf       write the text here
+ * @param buf_size  size of `buf` including the closing `'\0'`
+ */
+typedef void (*lv_vlist_cell_cb_t)(lv_obj_t * obj, uint32_t row, uint16_t col, char * buf, uint32_t buf_size);
+
+/*Data of virtual list*/
+typedef struct {
+    lv_obj_t obj;
+    lv_vlist_cell_cb_t cell_cb;
+    lv_obj_t ** row_objs;       /*The row objects which are reused for the visible rows*/
+    uint32_t * row_obj_ids;     /*The row shown by each row object, `LV_VLIST_NONE` if not used*/
+    lv_coord_t * col_w;         /*Width of the columns, 0: share the remaining width*/
+    uint32_t row_cnt;
+    uint32_t scroll_y;          /*Scroll position from the top of the first row*/
+    uint32_t sel_row;
+    lv_coord_t row_h;
+    lv_coord_t throw_v;         /*Last vertical move while dragging*/
+    lv_coord_t drag_sum;
+    lv_coord_t row_objs_w;      /*Content size of the list when the row objects were created*/
+    lv_coord_t row_objs_h;
+    uint16_t row_obj_cnt;
+    uint16_t col_cnt;
+    uint8_t dragged : 1;
+} lv_vlist_t;
+
+extern const lv_obj_class_t lv_vlist_class;
+extern const lv_obj_class_t lv_vlist_row_class;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create a virtual list object. It creates objects only for the visible rows and
+ * reuses them while scrolling so it can show any number of rows.
+ * @param parent    pointer to an object, it will be the parent of the new virtual list
+ * @return          pointer to the created virtual list
+ */
+lv_obj_t * lv_vlist_create(lv_obj_t * parent);
+
+/*=====================
+ * Setter functions
+ *====================*/
+
+/**
+ * Set the function which gives the text of the cells
+ * @param obj       pointer to a virtual list object
+ * @param cell_cb   the callback
+ */
+void lv_vlist_set_cell_cb(lv_obj_t * obj, lv_vlist_cell_cb_t cell_cb);
+
+/**
+ * Set the number of rows. The scroll position is kept if possible.
+ * @param obj       pointer to a virtual list object
+ * @param row_cnt   number of rows
+ */
+void lv_vlist_set_row_cnt(lv_obj_t * obj, uint32_t row_cnt);
+
+/**
+ * Set the height of the rows. All the rows have the same height.
+ * @param obj       pointer to a virtual list object
+ * @param h         height of a row in pixels
+ */
+void lv_vlist_set_row_height(lv_obj_t * obj, lv_coord_t h);
+
+/**
+ * Set the number of columns
+ * @param obj       pointer to a virtual list object
+ * @param col_cnt   number of columns
+ */
+void lv_vlist_set_col_cnt(lv_obj_t * obj, uint16_t col_cnt);
+
+/**
+ * Set the width of a column
+ * @param obj       pointer to a virtual list object
+ * @param col_id    index of the column
+ * @param w         width of the column, 0: share the remaining width with the other such columns
+ */
+void lv_vlist_set_col_width(lv_obj_t * obj, uint16_t col_id, lv_coord_t w);
+
+/**
+ * Select a row. It gets the `LV_STATE_CHECKED` state while it's visible.
+ * @param obj       pointer to a virtual list object
+ * @param row       index of the row or `LV_VLIST_NONE`
+ */
+void lv_vlist_set_selected_row(lv_obj_t * obj, uint32_t row);
+
+/*=====================
+ * Getter functions
+ *====================*/
+
+/**
+ * Get the number of rows
+ * @param obj       pointer to a virtual list object
+ * @return          number of rows
+ */
+uint32_t lv_vlist_get_row_cnt(lv_obj_t * obj);
+
+/**
+ * Get the height of the rows
+ * @param obj       pointer to a virtual list object
+ * @return          height of a row
+ */
+lv_coord_t lv_vlist_get_row_height(lv_obj_t * obj);
+
+/**
+ * Get the number of columns
+ * @param obj       pointer to a virtual list object
+ * @return          number of columns
+ */
+uint16_t lv_vlist_get_col_cnt(lv_obj_t * obj);
+
+/**
+ * Get the selected row
+ * @param obj       pointer to a virtual list object
+ * @return          index of the selected row or `LV_VLIST_NONE`
+ */
+uint32_t lv_vlist_get_selected_row(lv_obj_t * obj);
+
+/**
+ * Get the first row which is at least partially visible
+ * @param obj       pointer to a virtual list object
+ * @return          index of the row or `LV_VLIST_NONE` if there are no rows
+ */
+uint32_t lv_vlist_get_first_visible_row(lv_obj_t * obj);
+
+/**
+ * Get the scroll position
+ * @param obj       pointer to a virtual list object
+ * @return          the scroll position from the top of the first row
+ */
+uint32_t lv_vlist_get_scroll_y(lv_obj_t * obj);
+
+/**
+ * Get the object showing a row
+ * @param obj       pointer to a virtual list object
+ * @param row       index of the row
+ * @return          the object of the row or NULL if the row is not visible now.
+ *                  The object will show an other row later so don't save it.
+ */
+lv_obj_t * lv_vlist_get_row_obj(lv_obj_t * obj, uint32_t row);
+
+/**
+ * Get the number of row objects. It depends only on the height of the list and the rows.
+ * @param obj       pointer to a virtual list object
+ * @return          number of row objects
+ */
+uint16_t lv_vlist_get_row_obj_cnt(lv_obj_t * obj);
+
+/*=====================
+ * Other functions
+ *====================*/
+
+/**
+ * Scroll to a row
+ * @param obj       pointer to a virtual list object
+ * @param row       index of the row to show at the top
+ * @param anim_en   LV_ANIM_ON: scroll with animation
+ */
+void lv_vlist_scroll_to_row(lv_obj_t * obj, uint32_t row, lv_anim_enable_t anim_en);
+
+/**
+ * Scroll to a position
+ * @param obj       pointer to a virtual list object
+ * @param y         the new scroll position from the top of the first row
+ * @param anim_en   LV_ANIM_ON: scroll with animation
+ */
+void lv_vlist_scroll_to_y(lv_obj_t * obj, uint32_t y, lv_anim_enable_t anim_en);
+
+/**
+ * Get the text of the visible rows again, e.g. after the data has changed
+ * @param obj       pointer to a virtual list object
+ */
+void lv_vlist_refresh(lv_obj_t * obj);
+
+/**
+ * Get the text of a row again if it's visible
+ * @param obj       pointer to a virtual list object
+ * @param row       index of the row
+ */
+void lv_vlist_refresh_row(lv_obj_t * obj, uint32_t row);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_VLIST*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_VLIST_H*/
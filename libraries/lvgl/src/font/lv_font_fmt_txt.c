@@ -14,6 +14,8 @@
 #include "../misc/lv_log.h"
 #include "../misc/lv_utils.h"
 #include "../misc/lv_mem.h"
+#include "../misc/lv_math.h"
+#include "../misc/lv_printf.h"
 
 /*********************
  *      DEFINES
@@ -32,11 +34,18 @@ typedef enum {
  *  STATIC PROTOTYPES
  **********************/
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+static uint32_t find_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter);
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
+static int8_t find_kern_value(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid_left, uint32_t gid_right);
 static int32_t unicode_list_compare(const void * ref, const void * element);
 static int32_t kern_pair_8_compare(const void * ref, const void * element);
 static int32_t kern_pair_16_compare(const void * ref, const void * element);
 
+#if LV_USE_FONT_ATLAS
+    static const uint8_t * get_atlas_bitmap(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter);
+    static void unpack_a8(const uint8_t * in, uint8_t * out, uint32_t px_num, uint8_t bpp);
+#endif /*LV_USE_FONT_ATLAS*/
+
 #if LV_USE_FONT_COMPRESSED
     static void decompress(const uint8_t * in, uint8_t * out, lv_coord_t w, lv_coord_t h, uint8_t bpp, bool prefilter);
     static inline void decompress_line(uint8_t * out, lv_coord_t w);
@@ -81,12 +90,19 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t unic
     if(unicode_letter == '\t') unicode_letter = ' ';
 
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+
+#if LV_USE_FONT_ATLAS
+    const uint8_t * atlas_bitmap = get_atlas_bitmap(fdsc, unicode_letter);
+    if(atlas_bitmap) return atlas_bitmap;
+#endif
+
     uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
     if(!gid) return NULL;
 
     const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
 
     if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) {
+        if(fdsc->get_bitmap_cb) return fdsc->get_bitmap_cb(font, gid);
         return &fdsc->glyph_bitmap[gdsc->bitmap_index];
     }
     /*Handle compressed bitmap*/
@@ -98,6 +114,10 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t unic
         uint32_t gsize = gdsc->box_w * gdsc->box_h;
         if(gsize == 0) return NULL;
 
+        const uint8_t * compressed = fdsc->get_bitmap_cb ? fdsc->get_bitmap_cb(font, gid) :
+                                     &fdsc->glyph_bitmap[gdsc->bitmap_index];
+        if(compressed == NULL) return NULL;
+
         uint32_t buf_size = gsize;
         /*Compute memory size needed to hold decompressed glyph, rounding up*/
         switch(fdsc->bpp) {
@@ -124,7 +144,7 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t unic
         }
 
         bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED ? true : false;
-        decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], LV_GC_ROOT(_lv_font_decompr_buf), gdsc->box_w, gdsc->box_h,
+        decompress(compressed, LV_GC_ROOT(_lv_font_decompr_buf), gdsc->box_w, gdsc->box_h,
                    (uint8_t)fdsc->bpp, prefilter);
         return LV_GC_ROOT(_lv_font_decompr_buf);
 #else /*!LV_USE_FONT_COMPRESSED*/
@@ -184,6 +204,10 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
     dsc_out->bpp   = (uint8_t)fdsc->bpp;
     dsc_out->is_placeholder = false;
 
+#if LV_USE_FONT_ATLAS
+    if(get_atlas_bitmap(fdsc, unicode_letter)) dsc_out->bpp = 8;
+#endif
+
     if(is_tab) dsc_out->box_w = dsc_out->box_w * 2;
 
     return true;
@@ -202,6 +226,139 @@ void _lv_font_clean_up_fmt_txt(void)
 #endif
 }
 
+#if LV_FONT_FMT_TXT_CACHE_SIZE || LV_FONT_FMT_TXT_KERN_CACHE_SIZE
+lv_res_t lv_font_fmt_txt_cache_create(const lv_font_t * font)
+{
+    LV_ASSERT_NULL(font);
+
+    if(font->get_glyph_bitmap != lv_font_get_bitmap_fmt_txt) {
+        LV_LOG_WARN("not an lv_font_fmt_txt font");
+        return LV_RES_INV;
+    }
+
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    if(fdsc->cache == NULL) {
+        LV_LOG_WARN("the font has no glyph cache to store the tables");
+        return LV_RES_INV;
+    }
+
+    if(fdsc->cache->tables) return LV_RES_OK;
+
+    /*Zeroed entries are empty*/
+    lv_font_fmt_txt_cache_tables_t * tables = lv_mem_alloc(sizeof(lv_font_fmt_txt_cache_tables_t));
+    LV_ASSERT_MALLOC(tables);
+    if(tables == NULL) return LV_RES_INV;
+    lv_memset_00(tables, sizeof(lv_font_fmt_txt_cache_tables_t));
+
+    fdsc->cache->tables = tables;
+    return LV_RES_OK;
+}
+
+void lv_font_fmt_txt_cache_delete(const lv_font_t * font)
+{
+    LV_ASSERT_NULL(font);
+
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    if(fdsc == NULL || fdsc->cache == NULL || fdsc->cache->tables == NULL) return;
+
+    lv_mem_free(fdsc->cache->tables);
+    fdsc->cache->tables = NULL;
+}
+#endif
+
+#if LV_USE_FONT_ATLAS
+lv_res_t lv_font_fmt_txt_atlas_create(const lv_font_t * font, uint32_t letter_start, uint32_t letter_end)
+{
+    LV_ASSERT_NULL(font);
+
+    if(font->get_glyph_bitmap != lv_font_get_bitmap_fmt_txt) {
+        LV_LOG_WARN("not an lv_font_fmt_txt font");
+        return LV_RES_INV;
+    }
+
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    if(fdsc->cache == NULL) {
+        LV_LOG_WARN("the font has no glyph cache to store the atlas");
+        return LV_RES_INV;
+    }
+
+    if(letter_end < letter_start) return LV_RES_INV;
+
+    lv_font_fmt_txt_atlas_delete(font);
+
+    lv_font_fmt_txt_atlas_t * atlas = lv_mem_alloc(sizeof(lv_font_fmt_txt_atlas_t));
+    LV_ASSERT_MALLOC(atlas);
+    if(atlas == NULL) return LV_RES_INV;
+
+    atlas->range_start = letter_start;
+    atlas->range_length = letter_end - letter_start + 1;
+    atlas->bitmap_index = lv_mem_alloc(atlas->range_length * sizeof(uint32_t));
+    LV_ASSERT_MALLOC(atlas->bitmap_index);
+    if(atlas->bitmap_index == NULL) {
+        lv_mem_free(atlas);
+        return LV_RES_INV;
+    }
+
+    /*Place the glyphs after each other. Missing and empty glyphs are drawn as usual.*/
+    uint32_t bitmap_size = 0;
+    uint32_t i;
+    for(i = 0; i < atlas->range_length; i++) {
+        uint32_t gid = get_glyph_dsc_id(font, letter_start + i);
+        const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+        uint32_t px_num = (uint32_t)gdsc->box_w * gdsc->box_h;
+        if(gid == 0 || px_num == 0) {
+            atlas->bitmap_index[i] = LV_FONT_FMT_TXT_ATLAS_NONE;
+        }
+        else {
+            atlas->bitmap_index[i] = bitmap_size;
+            bitmap_size += px_num;
+        }
+    }
+
+    atlas->bitmap = lv_mem_alloc(LV_MAX(bitmap_size, 1));
+    LV_ASSERT_MALLOC(atlas->bitmap);
+    if(atlas->bitmap == NULL) {
+        lv_mem_free(atlas->bitmap_index);
+        lv_mem_free(atlas);
+        return LV_RES_INV;
+    }
+
+    for(i = 0; i < atlas->range_length; i++) {
+        if(atlas->bitmap_index[i] == LV_FONT_FMT_TXT_ATLAS_NONE) continue;
+
+        /*Compressed glyphs are decompressed to a shared buffer*/
+        const uint8_t * src = lv_font_get_bitmap_fmt_txt(font, letter_start + i);
+        if(src == NULL) {
+            atlas->bitmap_index[i] = LV_FONT_FMT_TXT_ATLAS_NONE;
+            continue;
+        }
+
+        const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[get_glyph_dsc_id(font, letter_start + i)];
+        unpack_a8(src, &atlas->bitmap[atlas->bitmap_index[i]], (uint32_t)gdsc->box_w * gdsc->box_h,
+                  (uint8_t)fdsc->bpp);
+    }
+
+    fdsc->cache->atlas = atlas;
+
+    LV_LOG_INFO("%" LV_PRIu32 " letters, %" LV_PRIu32 " bytes", atlas->range_length, bitmap_size);
+    return LV_RES_OK;
+}
+
+void lv_font_fmt_txt_atlas_delete(const lv_font_t * font)
+{
+    LV_ASSERT_NULL(font);
+
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    if(fdsc == NULL || fdsc->cache == NULL || fdsc->cache->atlas == NULL) return;
+
+    lv_font_fmt_txt_atlas_t * atlas = fdsc->cache->atlas;
+    fdsc->cache->atlas = NULL;
+    lv_mem_free(atlas->bitmap);
+    lv_mem_free(atlas->bitmap_index);
+    lv_mem_free(atlas);
+}
+#endif /*LV_USE_FONT_ATLAS*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -211,10 +368,31 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
     if(letter == '\0') return 0;
 
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    lv_font_fmt_txt_glyph_cache_t * cache = fdsc->cache;
+    if(cache == NULL) return find_glyph_dsc_id(fdsc, letter);
+
+    /*Letter 0 is never looked up, so the zero initialized entries are empty*/
+#if LV_FONT_FMT_TXT_CACHE_SIZE
+    if(cache->tables) {
+        lv_font_fmt_txt_glyph_cache_entry_t * entry =
+            &cache->tables->glyphs[letter & (LV_FONT_FMT_TXT_CACHE_SIZE - 1)];
+        if(entry->letter != letter) {
+            entry->letter = letter;
+            entry->glyph_id = find_glyph_dsc_id(fdsc, letter);
+        }
+        return entry->glyph_id;
+    }
+#endif
 
-    /*Check the cache first*/
-    if(fdsc->cache && letter == fdsc->cache->last_letter) return fdsc->cache->last_glyph_id;
+    if(cache->last_letter != letter) {
+        cache->last_letter = letter;
+        cache->last_glyph_id = find_glyph_dsc_id(fdsc, letter);
+    }
+    return cache->last_glyph_id;
+}
 
+static uint32_t find_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter)
+{
     uint16_t i;
     for(i = 0; i < fdsc->cmap_num; i++) {
 
@@ -251,18 +429,9 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
             }
         }
 
-        /*Update the cache*/
-        if(fdsc->cache) {
-            fdsc->cache->last_letter = letter;
-            fdsc->cache->last_glyph_id = glyph_id;
-        }
         return glyph_id;
     }
 
-    if(fdsc->cache) {
-        fdsc->cache->last_letter = letter;
-        fdsc->cache->last_glyph_id = 0;
-    }
     return 0;
 
 }
@@ -271,6 +440,26 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
 {
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
 
+#if LV_FONT_FMT_TXT_KERN_CACHE_SIZE
+    /*Kern classes are simple look-ups, only the binary search of kern pairs is worth caching.
+     *`gid_left` is never 0, so the zero initialized entries are empty.*/
+    if(fdsc->cache && fdsc->cache->tables && fdsc->kern_classes == 0 && gid_left <= 0xFFFF && gid_right <= 0xFFFF) {
+        uint32_t glyph_ids = (gid_left << 16) + gid_right;
+        lv_font_fmt_txt_kern_cache_entry_t * entry =
+            &fdsc->cache->tables->kerns[(gid_left * 31 + gid_right) & (LV_FONT_FMT_TXT_KERN_CACHE_SIZE - 1)];
+        if(entry->glyph_ids != glyph_ids) {
+            entry->glyph_ids = glyph_ids;
+            entry->value = find_kern_value(fdsc, gid_left, gid_right);
+        }
+        return entry->value;
+    }
+#endif
+
+    return find_kern_value(fdsc, gid_left, gid_right);
+}
+
+static int8_t find_kern_value(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid_left, uint32_t gid_right)
+{
     int8_t value = 0;
 
     if(fdsc->kern_classes == 0) {
@@ -344,6 +533,46 @@ static int32_t kern_pair_16_compare(const void * ref, const void * element)
     else return (int32_t) ref16_p[1] - element16_p[1];
 }
 
+#if LV_USE_FONT_ATLAS
+static const uint8_t * get_atlas_bitmap(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter)
+{
+    if(fdsc->cache == NULL || fdsc->cache->atlas == NULL) return NULL;
+
+    const lv_font_fmt_txt_atlas_t * atlas = fdsc->cache->atlas;
+    uint32_t i = letter - atlas->range_start;
+    if(i >= atlas->range_length || atlas->bitmap_index[i] == LV_FONT_FMT_TXT_ATLAS_NONE) return NULL;
+
+    return &atlas->bitmap[atlas->bitmap_index[i]];
+}
+
+/**
+ * Convert a glyph's bitmap to 1 byte per pixel with the same opacities `lv_draw_sw_letter` uses
+ * @param in the glyph's bitmap
+ * @param out buffer to store the result
+ * @param px_num number of pixels in the glyph (width * height)
+ * @param bpp bit per pixel of `in`
+ */
+static void unpack_a8(const uint8_t * in, uint8_t * out, uint32_t px_num, uint8_t bpp)
+{
+    /*3 bpp bitmaps are drawn as 4 bpp*/
+    if(bpp == 3) bpp = 4;
+
+    if(bpp == 8) {
+        lv_memcpy(out, in, px_num);
+        return;
+    }
+
+    uint32_t max = (1 << bpp) - 1;
+    uint32_t bit_pos = 0;
+    uint32_t i;
+    for(i = 0; i < px_num; i++) {
+        uint32_t v = (in[bit_pos >> 3] >> (8 - (bit_pos & 0x7) - bpp)) & max;
+        out[i] = (uint8_t)(v * 255 / max);
+        bit_pos += bpp;
+    }
+}
+#endif /*LV_USE_FONT_ATLAS*/
+
 #if LV_USE_FONT_COMPRESSED
 /**
  * The compress a glyph's bitmap
@@ -17,10 +17,12 @@ extern "C" {
 #include <stddef.h>
 #include <stdbool.h>
 #include "lv_font.h"
+#include "../misc/lv_types.h"
 
 /*********************
  *      DEFINES
  *********************/
+#define LV_FONT_FMT_TXT_ATLAS_NONE  0xFFFFFFFF
 
 /**********************
  *      TYPEDEFS
@@ -151,9 +153,52 @@ typedef enum {
     LV_FONT_FMT_TXT_COMPRESSED_NO_PREFILTER = 1,
 } lv_font_fmt_txt_bitmap_format_t;
 
+#if LV_FONT_FMT_TXT_CACHE_SIZE
+typedef struct {
+    uint32_t letter;
+    uint32_t glyph_id;
+} lv_font_fmt_txt_glyph_cache_entry_t;
+#endif
+
+#if LV_FONT_FMT_TXT_KERN_CACHE_SIZE
+typedef struct {
+    uint32_t glyph_ids;     /*`(left_id << 16) + right_id`, 0: empty entry*/
+    int8_t value;
+} lv_font_fmt_txt_kern_cache_entry_t;
+#endif
+
+#if LV_USE_FONT_ATLAS
+/*8 bpp bitmaps of a range of letters*/
+typedef struct {
+    uint32_t range_start;
+    uint32_t range_length;
+    uint32_t * bitmap_index;    /*Index of each letter's bitmap in `bitmap` or `LV_FONT_FMT_TXT_ATLAS_NONE`*/
+    uint8_t * bitmap;
+} lv_font_fmt_txt_atlas_t;
+#endif
+
+#if LV_FONT_FMT_TXT_CACHE_SIZE || LV_FONT_FMT_TXT_KERN_CACHE_SIZE
+/*Allocated by `lv_font_fmt_txt_cache_create()` only for the fonts which need it*/
+typedef struct {
+#if LV_FONT_FMT_TXT_CACHE_SIZE
+    lv_font_fmt_txt_glyph_cache_entry_t glyphs[LV_FONT_FMT_TXT_CACHE_SIZE];
+#endif
+#if LV_FONT_FMT_TXT_KERN_CACHE_SIZE
+    lv_font_fmt_txt_kern_cache_entry_t kerns[LV_FONT_FMT_TXT_KERN_CACHE_SIZE];
+#endif
+} lv_font_fmt_txt_cache_tables_t;
+#endif
+
+/*Zero initialized by the fonts, so an all zero struct has to be an empty cache*/
 typedef struct {
     uint32_t last_letter;
     uint32_t last_glyph_id;
+#if LV_FONT_FMT_TXT_CACHE_SIZE || LV_FONT_FMT_TXT_KERN_CACHE_SIZE
+    lv_font_fmt_txt_cache_tables_t * tables;
+#endif
+#if LV_USE_FONT_ATLAS
+    lv_font_fmt_txt_atlas_t * atlas;
+#endif
 } lv_font_fmt_txt_glyph_cache_t;
 
 /*Describe store additional data for fonts*/
@@ -193,8 +238,12 @@ typedef struct {
      */
     uint16_t bitmap_format  : 2;
 
-    /*Cache the last letter and is glyph id*/
+    /*Cache the glyph ids and kerning values of the recent letters*/
     lv_font_fmt_txt_glyph_cache_t * cache;
+
+    /*If set, it's called instead of reading `glyph_bitmap`, e.g. to read the bitmaps from a file on demand.
+     *It returns the bitmap of a glyph ID in `bitmap_format`, valid until the next call, or NULL on error.*/
+    const uint8_t * (*get_bitmap_cb)(const lv_font_t * font, uint32_t glyph_id);
 } lv_font_fmt_txt_dsc_t;
 
 /**********************
@@ -225,6 +274,40 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
  */
 void _lv_font_clean_up_fmt_txt(void);
 
+#if LV_FONT_FMT_TXT_CACHE_SIZE || LV_FONT_FMT_TXT_KERN_CACHE_SIZE
+/**
+ * Allocate the tables caching the glyph IDs and kerning values of the recently used letters of a font.
+ * Without them only the last letter's glyph ID is remembered.
+ * @param font          a font using the `lv_font_fmt_txt` callbacks and having a glyph cache
+ * @return LV_RES_OK: the tables are allocated; LV_RES_INV: the font is not supported or out of memory
+ */
+lv_res_t lv_font_fmt_txt_cache_create(const lv_font_t * font);
+
+/**
+ * Free the cache tables of a font. `lv_font_free()` frees them too.
+ * @param font          pointer to a font
+ */
+void lv_font_fmt_txt_cache_delete(const lv_font_t * font);
+#endif
+
+#if LV_USE_FONT_ATLAS
+/**
+ * Pre-render the glyphs of a range of letters to 8 bpp bitmaps. These glyphs are drawn
+ * without decompressing and unpacking their bitmaps. An existing atlas of the font is replaced.
+ * @param font          a font using the `lv_font_fmt_txt` callbacks and having a glyph cache
+ * @param letter_start  the first letter of the range, e.g. ' '
+ * @param letter_end    the last letter of the range, e.g. '~'
+ * @return LV_RES_OK: the atlas is created; LV_RES_INV: the font is not supported or out of memory
+ */
+lv_res_t lv_font_fmt_txt_atlas_create(const lv_font_t * font, uint32_t letter_start, uint32_t letter_end);
+
+/**
+ * Free the atlas of a font. `lv_font_free()` frees it too.
+ * @param font          pointer to a font
+ */
+void lv_font_fmt_txt_atlas_delete(const lv_font_t * font);
+#endif /*LV_USE_FONT_ATLAS*/
+
 /**********************
  *      MACROS
  **********************/
@@ -14,6 +14,11 @@
 #include "../misc/lv_fs.h"
 #include "lv_font_loader.h"
 
+/*********************
+ *      DEFINES
+ *********************/
+#define PAGE_NONE   0xFFFFFFFF
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -60,14 +65,42 @@ typedef struct cmap_table_bin {
     uint8_t padding;
 } cmap_table_bin_t;
 
+/*A part of the glyph table of a lazily loaded font*/
+typedef struct {
+    uint32_t index;                 /*The page's position in the glyph table / LV_FONT_LOADER_PAGE_SIZE*/
+    uint32_t last_used;             /*Value of `use_cnt` when the page was used last*/
+    uint8_t * data;                 /*NULL if the page was never used*/
+} font_page_t;
+
+/*The glyph descriptors, cmaps and kerning are loaded as usual, but the bitmaps stay in the file*/
+typedef struct {
+    lv_font_fmt_txt_dsc_t dsc;      /*Has to be the first member. `bitmap_index` is the position in the glyph table*/
+    lv_fs_file_t file;
+    uint32_t glyph_start;           /*Position of the glyph table in the file*/
+    uint32_t glyph_length;
+    uint32_t glyph_cnt;
+    uint32_t max_bitmap_size;
+    uint8_t header_bits;            /*Bits before the bitmap of each glyph*/
+    uint8_t file_open;
+    font_page_t * pages;
+    uint32_t page_cnt;
+    uint32_t use_cnt;
+    uint8_t * glyph_buf;            /*Bitmaps which are not in one page or not byte aligned are copied here*/
+    lv_font_loader_stats_t stats;
+} lazy_font_dsc_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp);
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font);
+static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font, bool lazy);
+static bool lazy_init(lv_font_t * font, lv_fs_file_t * fp, uint32_t cache_size);
+static const uint8_t * lazy_get_bitmap(const lv_font_t * font, uint32_t glyph_id);
+static const uint8_t * lazy_get_page(lazy_font_dsc_t * lazy, uint32_t index);
 int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start);
 
 static int read_bits_signed(bit_iterator_t * it, int n_bits, lv_fs_res_t * res);
+static lv_fs_res_t read_exact(lv_fs_file_t * fp, void * buf, uint32_t btr);
 static unsigned int read_bits(bit_iterator_t * it, int n_bits, lv_fs_res_t * res);
 
 /**********************
@@ -93,7 +126,7 @@ lv_font_t * lv_font_load(const char * font_name)
     lv_font_t * font = lv_mem_alloc(sizeof(lv_font_t));
     if(font) {
         memset(font, 0, sizeof(lv_font_t));
-        if(!lvgl_load_font(&file, font)) {
+        if(!lvgl_load_font(&file, font, false)) {
             LV_LOG_WARN("Error loading font file: %s\n", font_name);
             /*
             * When `lvgl_load_font` fails it can leak some pointers.
@@ -110,6 +143,55 @@ lv_font_t * lv_font_load(const char * font_name)
     return font;
 }
 
+/**
+ * Loads a `lv_font_t` object from a binary font file, but keep the glyph bitmaps in the file.
+ * They are read in pages when drawn, and the recently used pages are kept in RAM.
+ * @param font_name filename where the font file is located. The file stays open until `lv_font_free()`.
+ * @param cache_size RAM budget of the pages in bytes, 0: `LV_FONT_LOADER_CACHE_SIZE`
+ * @return a pointer to the font or NULL in case of error
+ */
+lv_font_t * lv_font_load_lazy(const char * font_name, uint32_t cache_size)
+{
+    lv_fs_file_t file;
+    lv_fs_res_t res = lv_fs_open(&file, font_name, LV_FS_MODE_RD);
+    if(res != LV_FS_RES_OK)
+        return NULL;
+
+    lv_font_t * font = lv_mem_alloc(sizeof(lv_font_t));
+    if(font) {
+        memset(font, 0, sizeof(lv_font_t));
+        if(!lvgl_load_font(&file, font, true) || !lazy_init(font, &file, cache_size)) {
+            LV_LOG_WARN("Error loading font file: %s\n", font_name);
+            lv_font_free(font);
+            font = NULL;
+        }
+        else {
+            /*The font reads the file from now on*/
+            return font;
+        }
+    }
+
+    lv_fs_close(&file);
+
+    return font;
+}
+
+/**
+ * Get the counters of the page cache of a font loaded by `lv_font_load_lazy()`
+ * @param font pointer to a font
+ * @param stats store the counters here. They are zeroed if the font is not loaded lazily.
+ */
+void lv_font_get_lazy_stats(const lv_font_t * font, lv_font_loader_stats_t * stats)
+{
+    lv_font_fmt_txt_dsc_t * dsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    if(dsc && dsc->get_bitmap_cb == lazy_get_bitmap) {
+        *stats = ((lazy_font_dsc_t *)dsc)->stats;
+    }
+    else {
+        memset(stats, 0, sizeof(lv_font_loader_stats_t));
+    }
+}
+
 /**
  * Frees the memory allocated by the `lv_font_load()` function
  * @param font lv_font_t object created by the lv_font_load function
@@ -121,6 +203,21 @@ void lv_font_free(lv_font_t * font)
 
         if(NULL != dsc) {
 
+            if(dsc->get_bitmap_cb == lazy_get_bitmap) {
+                lazy_font_dsc_t * lazy = (lazy_font_dsc_t *)dsc;
+                if(NULL != lazy->pages) {
+                    for(uint32_t i = 0; i < lazy->page_cnt; i++) {
+                        if(NULL != lazy->pages[i].data)
+                            lv_mem_free(lazy->pages[i].data);
+                    }
+                    lv_mem_free(lazy->pages);
+                }
+                if(NULL != lazy->glyph_buf)
+                    lv_mem_free(lazy->glyph_buf);
+                if(lazy->file_open)
+                    lv_fs_close(&lazy->file);
+            }
+
             if(dsc->kern_classes == 0) {
                 lv_font_fmt_txt_kern_pair_t * kern_dsc =
                     (lv_font_fmt_txt_kern_pair_t *)dsc->kern_dsc;
@@ -172,6 +269,15 @@ void lv_font_free(lv_font_t * font)
             if(NULL != dsc->glyph_dsc) {
                 lv_mem_free((void *)dsc->glyph_dsc);
             }
+            if(NULL != dsc->cache) {
+#if LV_FONT_FMT_TXT_CACHE_SIZE || LV_FONT_FMT_TXT_KERN_CACHE_SIZE
+                lv_font_fmt_txt_cache_delete(font);
+#endif
+#if LV_USE_FONT_ATLAS
+                lv_font_fmt_txt_atlas_delete(font);
+#endif
+                lv_mem_free(dsc->cache);
+            }
             lv_mem_free(dsc);
         }
         lv_mem_free(font);
@@ -182,6 +288,15 @@ void lv_font_free(lv_font_t * font)
  *   STATIC FUNCTIONS
  **********************/
 
+/*A short read means a truncated file*/
+static lv_fs_res_t read_exact(lv_fs_file_t * fp, void * buf, uint32_t btr)
+{
+    uint32_t br = 0;
+    lv_fs_res_t res = lv_fs_read(fp, buf, btr, &br);
+    if(res == LV_FS_RES_OK && br != btr) res = LV_FS_RES_UNKNOWN;
+    return res;
+}
+
 static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp)
 {
     bit_iterator_t it;
@@ -200,7 +315,7 @@ static unsigned int read_bits(bit_iterator_t * it, int n_bits, lv_fs_res_t * res
 
         if(it->bit_pos < 0) {
             it->bit_pos = 7;
-            *res = lv_fs_read(it->fp, &(it->byte_value), 1, NULL);
+            *res = read_exact(it->fp, &(it->byte_value), 1);
             if(*res != LV_FS_RES_OK) {
                 return 0;
             }
@@ -229,8 +344,8 @@ static int read_label(lv_fs_file_t * fp, int start, const char * label)
     uint32_t length;
     char buf[4];
 
-    if(lv_fs_read(fp, &length, 4, NULL) != LV_FS_RES_OK
-       || lv_fs_read(fp, buf, 4, NULL) != LV_FS_RES_OK
+    if(read_exact(fp, &length, 4) != LV_FS_RES_OK
+       || read_exact(fp, buf, 4) != LV_FS_RES_OK
        || memcmp(label, buf, 4) != 0) {
         LV_LOG_WARN("Error reading '%s' label.", label);
         return -1;
@@ -242,7 +357,7 @@ static int read_label(lv_fs_file_t * fp, int start, const char * label)
 static bool load_cmaps_tables(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
                               uint32_t cmaps_start, cmap_table_bin_t * cmap_table)
 {
-    if(lv_fs_read(fp, cmap_table, font_dsc->cmap_num * sizeof(cmap_table_bin_t), NULL) != LV_FS_RES_OK) {
+    if(read_exact(fp, cmap_table, font_dsc->cmap_num * sizeof(cmap_table_bin_t)) != LV_FS_RES_OK) {
         return false;
     }
 
@@ -266,7 +381,7 @@ static bool load_cmaps_tables(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_ds
 
                     cmap->glyph_id_ofs_list = glyph_id_ofs_list;
 
-                    if(lv_fs_read(fp, glyph_id_ofs_list, ids_size, NULL) != LV_FS_RES_OK) {
+                    if(read_exact(fp, glyph_id_ofs_list, ids_size) != LV_FS_RES_OK) {
                         return false;
                     }
 
@@ -283,7 +398,7 @@ static bool load_cmaps_tables(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_ds
                     cmap->unicode_list = unicode_list;
                     cmap->list_length = cmap_table[i].data_entries_count;
 
-                    if(lv_fs_read(fp, unicode_list, list_size, NULL) != LV_FS_RES_OK) {
+                    if(read_exact(fp, unicode_list, list_size) != LV_FS_RES_OK) {
                         return false;
                     }
 
@@ -292,7 +407,7 @@ static bool load_cmaps_tables(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_ds
 
                         cmap->glyph_id_ofs_list = buf;
 
-                        if(lv_fs_read(fp, buf, sizeof(uint16_t) * cmap->list_length, NULL) != LV_FS_RES_OK) {
+                        if(read_exact(fp, buf, sizeof(uint16_t) * cmap->list_length) != LV_FS_RES_OK) {
                             return false;
                         }
                     }
@@ -314,7 +429,7 @@ static int32_t load_cmaps(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, u
     }
 
     uint32_t cmaps_subtables_count;
-    if(lv_fs_read(fp, &cmaps_subtables_count, sizeof(uint32_t), NULL) != LV_FS_RES_OK) {
+    if(read_exact(fp, &cmaps_subtables_count, sizeof(uint32_t)) != LV_FS_RES_OK) {
         return -1;
     }
 
@@ -335,8 +450,13 @@ static int32_t load_cmaps(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, u
     return success ? cmaps_length : -1;
 }
 
+/*
+ * Loads the glyph descriptors and bitmaps. If `lazy` is not NULL only the positions
+ * of the bitmaps are stored, relative to `start`.
+ */
 static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
-                          uint32_t start, uint32_t * glyph_offset, uint32_t loca_count, font_header_bin_t * header)
+                          uint32_t start, uint32_t * glyph_offset, uint32_t loca_count, font_header_bin_t * header,
+                          lazy_font_dsc_t * lazy)
 {
     int32_t glyph_length = read_label(fp, start, "glyf");
     if(glyph_length < 0) {
@@ -408,12 +528,32 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
             gdsc->ofs_y = 0;
         }
 
+        if(lazy) {
+            gdsc->bitmap_index = glyph_offset[i] + nbits / 8;
+            if(gdsc->bitmap_index != glyph_offset[i] + nbits / 8) {
+                LV_LOG_WARN("The glyph table is too large. Enable LV_FONT_FMT_TXT_LARGE.");
+                return -1;
+            }
+            if(bmp_size > 0 && (uint32_t)bmp_size > lazy->max_bitmap_size) {
+                lazy->max_bitmap_size = bmp_size;
+            }
+            continue;
+        }
+
         gdsc->bitmap_index = cur_bmp_size;
         if(gdsc->box_w * gdsc->box_h != 0) {
             cur_bmp_size += bmp_size;
         }
     }
 
+    if(lazy) {
+        lazy->glyph_start = start;
+        lazy->glyph_length = glyph_length;
+        lazy->glyph_cnt = loca_count;
+        lazy->header_bits = header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
+        return glyph_length;
+    }
+
     uint8_t * glyph_bmp = (uint8_t *)lv_mem_alloc(sizeof(uint8_t) * cur_bmp_size);
 
     font_dsc->glyph_bitmap = glyph_bmp;
@@ -442,7 +582,7 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
         int bmp_size = next_offset - glyph_offset[i] - nbits / 8;
 
         if(nbits % 8 == 0) {  /*Fast path*/
-            if(lv_fs_read(fp, &glyph_bmp[cur_bmp_size], bmp_size, NULL) != LV_FS_RES_OK) {
+            if(read_exact(fp, &glyph_bmp[cur_bmp_size], bmp_size) != LV_FS_RES_OK) {
                 return -1;
             }
         }
@@ -479,16 +619,31 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
  *
  * `lv_font_free` will assume that all non-null pointers are allocated and
  * should be freed.
+ *
+ * With `lazy` the descriptor is a `lazy_font_dsc_t` and the bitmaps are not loaded.
  */
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
+static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font, bool lazy)
 {
-    lv_font_fmt_txt_dsc_t * font_dsc = (lv_font_fmt_txt_dsc_t *)
-                                       lv_mem_alloc(sizeof(lv_font_fmt_txt_dsc_t));
+    size_t dsc_size = lazy ? sizeof(lazy_font_dsc_t) : sizeof(lv_font_fmt_txt_dsc_t);
+    lv_font_fmt_txt_dsc_t * font_dsc = (lv_font_fmt_txt_dsc_t *)lv_mem_alloc(dsc_size);
+    if(font_dsc == NULL) {
+        return false;
+    }
 
-    memset(font_dsc, 0, sizeof(lv_font_fmt_txt_dsc_t));
+    memset(font_dsc, 0, dsc_size);
 
     font->dsc = font_dsc;
 
+    if(lazy) {
+        font_dsc->get_bitmap_cb = lazy_get_bitmap;
+    }
+
+    font_dsc->cache = lv_mem_alloc(sizeof(lv_font_fmt_txt_glyph_cache_t));
+    if(font_dsc->cache == NULL) {
+        return false;
+    }
+    memset(font_dsc->cache, 0, sizeof(lv_font_fmt_txt_glyph_cache_t));
+
     /*header*/
     int32_t header_length = read_label(fp, 0, "head");
     if(header_length < 0) {
@@ -496,7 +651,7 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
     }
 
     font_header_bin_t font_header;
-    if(lv_fs_read(fp, &font_header, sizeof(font_header_bin_t), NULL) != LV_FS_RES_OK) {
+    if(read_exact(fp, &font_header, sizeof(font_header_bin_t)) != LV_FS_RES_OK) {
         return false;
     }
 
@@ -527,7 +682,7 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
     }
 
     uint32_t loca_count;
-    if(lv_fs_read(fp, &loca_count, sizeof(uint32_t), NULL) != LV_FS_RES_OK) {
+    if(read_exact(fp, &loca_count, sizeof(uint32_t)) != LV_FS_RES_OK) {
         return false;
     }
 
@@ -537,7 +692,7 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
     if(font_header.index_to_loc_format == 0) {
         for(unsigned int i = 0; i < loca_count; ++i) {
             uint16_t offset;
-            if(lv_fs_read(fp, &offset, sizeof(uint16_t), NULL) != LV_FS_RES_OK) {
+            if(read_exact(fp, &offset, sizeof(uint16_t)) != LV_FS_RES_OK) {
                 failed = true;
                 break;
             }
@@ -545,7 +700,7 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
         }
     }
     else if(font_header.index_to_loc_format == 1) {
-        if(lv_fs_read(fp, glyph_offset, loca_count * sizeof(uint32_t), NULL) != LV_FS_RES_OK) {
+        if(read_exact(fp, glyph_offset, loca_count * sizeof(uint32_t)) != LV_FS_RES_OK) {
             failed = true;
         }
     }
@@ -561,8 +716,8 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
 
     /*glyph*/
     uint32_t glyph_start = loca_start + loca_length;
-    int32_t glyph_length = load_glyph(
-                               fp, font_dsc, glyph_start, glyph_offset, loca_count, &font_header);
+    int32_t glyph_length = load_glyph(fp, font_dsc, glyph_start, glyph_offset, loca_count, &font_header,
+                                      lazy ? (lazy_font_dsc_t *)font_dsc : NULL);
 
     lv_mem_free(glyph_offset);
 
@@ -584,6 +739,128 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
     return kern_length >= 0;
 }
 
+/*
+ * Allocates the page cache of a font loaded with `lazy` and takes over the file.
+ */
+static bool lazy_init(lv_font_t * font, lv_fs_file_t * fp, uint32_t cache_size)
+{
+    lazy_font_dsc_t * lazy = (lazy_font_dsc_t *)font->dsc;
+
+    if(cache_size == 0) cache_size = LV_FONT_LOADER_CACHE_SIZE;
+    lazy->page_cnt = LV_MAX(cache_size / LV_FONT_LOADER_PAGE_SIZE, 1);
+
+    /*The pages are allocated when they are used first*/
+    lazy->pages = lv_mem_alloc(lazy->page_cnt * sizeof(font_page_t));
+    lazy->glyph_buf = lv_mem_alloc(LV_MAX(lazy->max_bitmap_size, 1));
+    if(lazy->pages == NULL || lazy->glyph_buf == NULL) {
+        return false;
+    }
+
+    for(uint32_t i = 0; i < lazy->page_cnt; i++) {
+        lazy->pages[i].index = PAGE_NONE;
+        lazy->pages[i].last_used = 0;
+        lazy->pages[i].data = NULL;
+    }
+
+    lazy->file = *fp;
+    lazy->file_open = 1;
+    return true;
+}
+
+/*
+ * The `get_bitmap_cb` of lazily loaded fonts.
+ * The bitmap is returned from the page if possible, else it's copied to `glyph_buf`.
+ */
+static const uint8_t * lazy_get_bitmap(const lv_font_t * font, uint32_t glyph_id)
+{
+    static const uint8_t empty_bitmap = 0;
+    lazy_font_dsc_t * lazy = (lazy_font_dsc_t *)font->dsc;
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &lazy->dsc.glyph_dsc[glyph_id];
+
+    uint32_t start = gdsc->bitmap_index;
+    uint32_t end;
+    if(glyph_id + 1 < lazy->glyph_cnt) end = lazy->dsc.glyph_dsc[glyph_id + 1].bitmap_index - lazy->header_bits / 8;
+    else end = lazy->glyph_length;
+
+    if(glyph_id == 0 || end <= start) return &empty_bitmap;
+    if(end > lazy->glyph_length) return NULL;
+
+    uint32_t shift = lazy->header_bits % 8;
+    if(shift == 0 && start / LV_FONT_LOADER_PAGE_SIZE == (end - 1) / LV_FONT_LOADER_PAGE_SIZE) {
+        const uint8_t * page = lazy_get_page(lazy, start / LV_FONT_LOADER_PAGE_SIZE);
+        return page ? &page[start % LV_FONT_LOADER_PAGE_SIZE] : NULL;
+    }
+
+    uint8_t * buf = lazy->glyph_buf;
+    uint32_t size = end - start;
+    uint32_t pos = start;
+    while(pos < end) {
+        const uint8_t * page = lazy_get_page(lazy, pos / LV_FONT_LOADER_PAGE_SIZE);
+        if(page == NULL) return NULL;
+        uint32_t n = LV_MIN(end - pos, LV_FONT_LOADER_PAGE_SIZE - pos % LV_FONT_LOADER_PAGE_SIZE);
+        lv_memcpy(&buf[pos - start], &page[pos % LV_FONT_LOADER_PAGE_SIZE], n);
+        pos += n;
+    }
+
+    /*The bitmap starts after the bits of the header, shift it to the MSB as `load_glyph` does*/
+    if(shift) {
+        for(uint32_t k = 0; k < size - 1; k++) {
+            buf[k] = (buf[k] << shift) | (buf[k + 1] >> (8 - shift));
+        }
+        buf[size - 1] = buf[size - 1] << shift;
+    }
+
+    return buf;
+}
+
+/*
+ * Get a page of the glyph table from the cache or read it to the least recently used page.
+ */
+static const uint8_t * lazy_get_page(lazy_font_dsc_t * lazy, uint32_t index)
+{
+    lazy->use_cnt++;
+
+    /*The unused pages have `last_used == 0`, so they are taken first*/
+    font_page_t * lru = &lazy->pages[0];
+    for(uint32_t i = 0; i < lazy->page_cnt; i++) {
+        font_page_t * page = &lazy->pages[i];
+        if(page->index == index) {
+            page->last_used = lazy->use_cnt;
+            lazy->stats.hit_cnt++;
+            return page->data;
+        }
+        if(page->last_used < lru->last_used) lru = page;
+    }
+
+    lazy->stats.miss_cnt++;
+
+    if(lru->data == NULL) {
+        lru->data = lv_mem_alloc(LV_FONT_LOADER_PAGE_SIZE);
+        LV_ASSERT_MALLOC(lru->data);
+        if(lru->data == NULL) return NULL;
+        lazy->stats.page_cnt++;
+    }
+    else if(lru->index != PAGE_NONE) {
+        lazy->stats.evict_cnt++;
+    }
+
+    /*Keep the page unused until it's read successfully*/
+    lru->index = PAGE_NONE;
+    lru->last_used = 0;
+
+    uint32_t ofs = index * LV_FONT_LOADER_PAGE_SIZE;
+    uint32_t size = LV_MIN(LV_FONT_LOADER_PAGE_SIZE, lazy->glyph_length - ofs);
+    if(lv_fs_seek(&lazy->file, lazy->glyph_start + ofs, LV_FS_SEEK_SET) != LV_FS_RES_OK ||
+       read_exact(&lazy->file, lru->data, size) != LV_FS_RES_OK) {
+        LV_LOG_WARN("Couldn't read the glyph bitmaps");
+        return NULL;
+    }
+
+    lru->index = index;
+    lru->last_used = lazy->use_cnt;
+    return lru->data;
+}
+
 int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start)
 {
     int32_t kern_length = read_label(fp, start, "kern");
@@ -593,8 +870,8 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
 
     uint8_t kern_format_type;
     int32_t padding;
-    if(lv_fs_read(fp, &kern_format_type, sizeof(uint8_t), NULL) != LV_FS_RES_OK ||
-       lv_fs_read(fp, &padding, 3 * sizeof(uint8_t), NULL) != LV_FS_RES_OK) {
+    if(read_exact(fp, &kern_format_type, sizeof(uint8_t)) != LV_FS_RES_OK ||
+       read_exact(fp, &padding, 3 * sizeof(uint8_t)) != LV_FS_RES_OK) {
         return -1;
     }
 
@@ -607,7 +884,7 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
         font_dsc->kern_classes = 0;
 
         uint32_t glyph_entries;
-        if(lv_fs_read(fp, &glyph_entries, sizeof(uint32_t), NULL) != LV_FS_RES_OK) {
+        if(read_exact(fp, &glyph_entries, sizeof(uint32_t)) != LV_FS_RES_OK) {
             return -1;
         }
 
@@ -627,11 +904,11 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
         kern_pair->glyph_ids = glyph_ids;
         kern_pair->values = values;
 
-        if(lv_fs_read(fp, glyph_ids, ids_size, NULL) != LV_FS_RES_OK) {
+        if(read_exact(fp, glyph_ids, ids_size) != LV_FS_RES_OK) {
             return -1;
         }
 
-        if(lv_fs_read(fp, values, glyph_entries, NULL) != LV_FS_RES_OK) {
+        if(read_exact(fp, values, glyph_entries) != LV_FS_RES_OK) {
             return -1;
         }
     }
@@ -648,9 +925,9 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
         uint8_t kern_table_rows;
         uint8_t kern_table_cols;
 
-        if(lv_fs_read(fp, &kern_class_mapping_length, sizeof(uint16_t), NULL) != LV_FS_RES_OK ||
-           lv_fs_read(fp, &kern_table_rows, sizeof(uint8_t), NULL) != LV_FS_RES_OK ||
-           lv_fs_read(fp, &kern_table_cols, sizeof(uint8_t), NULL) != LV_FS_RES_OK) {
+        if(read_exact(fp, &kern_class_mapping_length, sizeof(uint16_t)) != LV_FS_RES_OK ||
+           read_exact(fp, &kern_table_rows, sizeof(uint8_t)) != LV_FS_RES_OK ||
+           read_exact(fp, &kern_table_cols, sizeof(uint8_t)) != LV_FS_RES_OK) {
             return -1;
         }
 
@@ -666,9 +943,9 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
         kern_classes->right_class_cnt = kern_table_cols;
         kern_classes->class_pair_values = kern_values;
 
-        if(lv_fs_read(fp, kern_left, kern_class_mapping_length, NULL) != LV_FS_RES_OK ||
-           lv_fs_read(fp, kern_right, kern_class_mapping_length, NULL) != LV_FS_RES_OK ||
-           lv_fs_read(fp, kern_values, kern_values_length, NULL) != LV_FS_RES_OK) {
+        if(read_exact(fp, kern_left, kern_class_mapping_length) != LV_FS_RES_OK ||
+           read_exact(fp, kern_right, kern_class_mapping_length) != LV_FS_RES_OK ||
+           read_exact(fp, kern_values, kern_values_length) != LV_FS_RES_OK) {
             return -1;
         }
     }
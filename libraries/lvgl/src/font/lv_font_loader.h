@@ -22,11 +22,21 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/*Counters of the page cache of a font loaded with `lv_font_load_lazy()`*/
+typedef struct {
+    uint32_t hit_cnt;       /*Pages found in RAM*/
+    uint32_t miss_cnt;      /*Pages read from the file*/
+    uint32_t evict_cnt;     /*Pages replaced by other pages*/
+    uint32_t page_cnt;      /*Pages allocated, `LV_FONT_LOADER_PAGE_SIZE` bytes each*/
+} lv_font_loader_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
 lv_font_t * lv_font_load(const char * fontName);
+lv_font_t * lv_font_load_lazy(const char * fontName, uint32_t cache_size);
+void lv_font_get_lazy_stats(const lv_font_t * font, lv_font_loader_stats_t * stats);
 void lv_font_free(lv_font_t * font);
 
 /**********************
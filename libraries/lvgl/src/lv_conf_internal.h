@@ -157,6 +157,16 @@
         #endif
     #endif
 
+    /*Reserve this many bytes of the pool for fixed size blocks of the small allocations (objects, style lists,
+     *short strings, etc.). They are grouped by size in pages which reduces the fragmentation of the pool. 0: unused*/
+    #ifndef LV_MEM_SLAB_SIZE
+        #ifdef CONFIG_LV_MEM_SLAB_SIZE
+            #define LV_MEM_SLAB_SIZE CONFIG_LV_MEM_SLAB_SIZE
+        #else
+            #define LV_MEM_SLAB_SIZE 0
+        #endif
+    #endif
+
 #else       /*LV_MEM_CUSTOM*/
     #ifndef LV_MEM_CUSTOM_INCLUDE
         #ifdef CONFIG_LV_MEM_CUSTOM_INCLUDE
@@ -229,6 +239,16 @@
     #endif
 #endif
 
+/*Keep the timers in a heap ordered by their next run instead of checking all of them in every `lv_timer_handler()` call.
+ *The next timer to run and the time until it are known without walking the list.*/
+#ifndef LV_TIMER_HEAP
+    #ifdef CONFIG_LV_TIMER_HEAP
+        #define LV_TIMER_HEAP CONFIG_LV_TIMER_HEAP
+    #else
+        #define LV_TIMER_HEAP 0
+    #endif
+#endif
+
 /*Use a custom tick source that tells the elapsed time in milliseconds.
  *It removes the need to manually update the tick with `lv_tick_inc()`)*/
 #ifndef LV_TICK_CUSTOM
@@ -343,6 +363,18 @@
     #endif
 #endif
 
+/*Size of an arena in bytes for the short living allocations of a refresh (layers, temporary draw buffers).
+ *They are taken from it one after the other and all are given back at once when the refresh ends.
+ *Larger requests and the requests out of a refresh use `lv_mem_alloc()`.
+ *See `lv_draw_arena_get_stats()` for the usage per refresh. 0: not used*/
+#ifndef LV_DRAW_ARENA_SIZE
+    #ifdef CONFIG_LV_DRAW_ARENA_SIZE
+        #define LV_DRAW_ARENA_SIZE CONFIG_LV_DRAW_ARENA_SIZE
+    #else
+        #define LV_DRAW_ARENA_SIZE 0
+    #endif
+#endif
+
 /*Default image cache size. Image caching keeps the images opened.
  *If only the built-in image formats are used there is no real advantage of caching. (I.e. if no new image decoder is added)
  *With complex image decoders (e.g. PNG or JPG) caching can save the continuous open/decode of images.
@@ -402,6 +434,52 @@
     #endif
 #endif
 
+/*Shared memory budget of the image, gradient, shadow and circle caches in bytes.
+ *When a new item doesn't fit, the least recently used items of any of these caches are dropped.
+ *With a budget the gradients and shadows are cached one by one: `LV_GRAD_CACHE_DEF_SIZE` is not used,
+ *`LV_SHADOW_CACHE_SIZE` limits only the size of one shadow and the circles are kept between the frames.
+ *Can be changed with `lv_draw_cache_set_budget()`. 0: no shared budget*/
+#ifndef LV_DRAW_CACHE_BUDGET
+    #ifdef CONFIG_LV_DRAW_CACHE_BUDGET
+        #define LV_DRAW_CACHE_BUDGET CONFIG_LV_DRAW_CACHE_BUDGET
+    #else
+        #define LV_DRAW_CACHE_BUDGET 0
+    #endif
+#endif
+#if LV_DRAW_CACHE_BUDGET
+    /*1: Allocate the cached gradients and shadows with a custom function, e.g. in external RAM*/
+    #ifndef LV_DRAW_CACHE_MEM_CUSTOM
+        #ifdef CONFIG_LV_DRAW_CACHE_MEM_CUSTOM
+            #define LV_DRAW_CACHE_MEM_CUSTOM CONFIG_LV_DRAW_CACHE_MEM_CUSTOM
+        #else
+            #define LV_DRAW_CACHE_MEM_CUSTOM 0
+        #endif
+    #endif
+    #if LV_DRAW_CACHE_MEM_CUSTOM
+        #ifndef LV_DRAW_CACHE_MEM_CUSTOM_INCLUDE
+            #ifdef CONFIG_LV_DRAW_CACHE_MEM_CUSTOM_INCLUDE
+                #define LV_DRAW_CACHE_MEM_CUSTOM_INCLUDE CONFIG_LV_DRAW_CACHE_MEM_CUSTOM_INCLUDE
+            #else
+                #define LV_DRAW_CACHE_MEM_CUSTOM_INCLUDE <stdlib.h>
+            #endif
+        #endif
+        #ifndef LV_DRAW_CACHE_MEM_CUSTOM_ALLOC
+            #ifdef CONFIG_LV_DRAW_CACHE_MEM_CUSTOM_ALLOC
+                #define LV_DRAW_CACHE_MEM_CUSTOM_ALLOC CONFIG_LV_DRAW_CACHE_MEM_CUSTOM_ALLOC
+            #else
+                #define LV_DRAW_CACHE_MEM_CUSTOM_ALLOC   malloc
+            #endif
+        #endif
+        #ifndef LV_DRAW_CACHE_MEM_CUSTOM_FREE
+            #ifdef CONFIG_LV_DRAW_CACHE_MEM_CUSTOM_FREE
+                #define LV_DRAW_CACHE_MEM_CUSTOM_FREE CONFIG_LV_DRAW_CACHE_MEM_CUSTOM_FREE
+            #else
+                #define LV_DRAW_CACHE_MEM_CUSTOM_FREE    free
+            #endif
+        #endif
+    #endif
+#endif
+
 /*Maximum buffer size to allocate for rotation.
  *Only used if software rotation is enabled in the display driver.*/
 #ifndef LV_DISP_ROT_MAX_BUF
@@ -443,6 +521,34 @@
             #define LV_GPU_DMA2D_CMSIS_INCLUDE
         #endif
     #endif
+
+    /*1: Other code uses the DMA2D too, e.g. the display driver's flush.
+     *Before touching the DMA2D registers LVGL waits until the transfer of the other code is finished
+     *and its interrupt is handled, else the interrupt enable bit and flags of that transfer were cleared*/
+    #ifndef LV_GPU_DMA2D_SHARED
+        #ifdef CONFIG_LV_GPU_DMA2D_SHARED
+            #define LV_GPU_DMA2D_SHARED CONFIG_LV_GPU_DMA2D_SHARED
+        #else
+            #define LV_GPU_DMA2D_SHARED 0
+        #endif
+    #endif
+    #if LV_GPU_DMA2D_SHARED
+        /*Header of the wait function and the expression waiting for the other code's transfer*/
+        #ifndef LV_GPU_DMA2D_SHARED_INCLUDE
+            #ifdef CONFIG_LV_GPU_DMA2D_SHARED_INCLUDE
+                #define LV_GPU_DMA2D_SHARED_INCLUDE CONFIG_LV_GPU_DMA2D_SHARED_INCLUDE
+            #else
+                #define LV_GPU_DMA2D_SHARED_INCLUDE "dsi_transfer.h"   /*E.g. Arduino GIGA Display*/
+            #endif
+        #endif
+        #ifndef LV_GPU_DMA2D_SHARED_WAIT_EXPR
+            #ifdef CONFIG_LV_GPU_DMA2D_SHARED_WAIT_EXPR
+                #define LV_GPU_DMA2D_SHARED_WAIT_EXPR CONFIG_LV_GPU_DMA2D_SHARED_WAIT_EXPR
+            #else
+                #define LV_GPU_DMA2D_SHARED_WAIT_EXPR dsi_waitTransfer()
+            #endif
+        #endif
+    #endif
 #endif
 
 /*Enable RA6M3 G2D GPU*/
@@ -787,6 +893,58 @@
     #endif
 #endif
 
+/*1: Collect per-frame render/flush times, redrawn area and draw call counts.
+ *Read them with `lv_perf_stats_get()`, `lv_perf_stats_to_json()` or show them with `lv_perf_stats_set_overlay(true)`*/
+#ifndef LV_USE_PERF_STATS
+    #ifdef CONFIG_LV_USE_PERF_STATS
+        #define LV_USE_PERF_STATS CONFIG_LV_USE_PERF_STATS
+    #else
+        #define LV_USE_PERF_STATS 0
+    #endif
+#endif
+#if LV_USE_PERF_STATS
+    /*Number of frames in the rolling window of the averages and histograms*/
+    #ifndef LV_PERF_STATS_HISTORY
+        #ifdef CONFIG_LV_PERF_STATS_HISTORY
+            #define LV_PERF_STATS_HISTORY CONFIG_LV_PERF_STATS_HISTORY
+        #else
+            #define LV_PERF_STATS_HISTORY 64
+        #endif
+    #endif
+    #ifndef LV_PERF_STATS_OVERLAY_POS
+        #ifdef CONFIG_LV_PERF_STATS_OVERLAY_POS
+            #define LV_PERF_STATS_OVERLAY_POS CONFIG_LV_PERF_STATS_OVERLAY_POS
+        #else
+            #define LV_PERF_STATS_OVERLAY_POS LV_ALIGN_TOP_LEFT
+        #endif
+    #endif
+
+    /*Use a custom microsecond time source. If 0 `lv_tick_get()` is used with 1 ms resolution*/
+    #ifndef LV_PERF_STATS_TIME_CUSTOM
+        #ifdef CONFIG_LV_PERF_STATS_TIME_CUSTOM
+            #define LV_PERF_STATS_TIME_CUSTOM CONFIG_LV_PERF_STATS_TIME_CUSTOM
+        #else
+            #define LV_PERF_STATS_TIME_CUSTOM 0
+        #endif
+    #endif
+    #if LV_PERF_STATS_TIME_CUSTOM
+        #ifndef LV_PERF_STATS_TIME_CUSTOM_INCLUDE
+            #ifdef CONFIG_LV_PERF_STATS_TIME_CUSTOM_INCLUDE
+                #define LV_PERF_STATS_TIME_CUSTOM_INCLUDE CONFIG_LV_PERF_STATS_TIME_CUSTOM_INCLUDE
+            #else
+                #define LV_PERF_STATS_TIME_CUSTOM_INCLUDE "Arduino.h"         /*Header for the system time function*/
+            #endif
+        #endif
+        #ifndef LV_PERF_STATS_TIME_CUSTOM_US_EXPR
+            #ifdef CONFIG_LV_PERF_STATS_TIME_CUSTOM_US_EXPR
+                #define LV_PERF_STATS_TIME_CUSTOM_US_EXPR CONFIG_LV_PERF_STATS_TIME_CUSTOM_US_EXPR
+            #else
+                #define LV_PERF_STATS_TIME_CUSTOM_US_EXPR (micros())    /*Expression evaluating to current system time in us*/
+            #endif
+        #endif
+    #endif
+#endif
+
 /*1: Draw random colored rectangles over the redrawn areas*/
 #ifndef LV_USE_REFR_DEBUG
     #ifdef CONFIG_LV_USE_REFR_DEBUG
@@ -796,6 +954,37 @@
     #endif
 #endif
 
+/*1: Skip drawing the objects which are fully covered by opaque, not transformed younger siblings on the redrawn area.
+ *The number of skipped objects is shown in the perf. stats*/
+#ifndef LV_USE_OCCLUSION_CULLING
+    #ifdef CONFIG_LV_USE_OCCLUSION_CULLING
+        #define LV_USE_OCCLUSION_CULLING CONFIG_LV_USE_OCCLUSION_CULLING
+    #else
+        #define LV_USE_OCCLUSION_CULLING 0
+    #endif
+#endif
+
+/*Number of style properties to cache with the object, part and state they were resolved for.
+ *It saves walking the styles of the object and its parents in `lv_obj_get_style_...()`.
+ *Every entry needs 20 bytes (on 32 bit systems). 0: to disable caching*/
+#ifndef LV_OBJ_STYLE_CACHE_SIZE
+    #ifdef CONFIG_LV_OBJ_STYLE_CACHE_SIZE
+        #define LV_OBJ_STYLE_CACHE_SIZE CONFIG_LV_OBJ_STYLE_CACHE_SIZE
+    #else
+        #define LV_OBJ_STYLE_CACHE_SIZE 0
+    #endif
+#endif
+#if LV_OBJ_STYLE_CACHE_SIZE
+    /*1: Compare the cached values with the styles in every look-up and assert if they differ. (Slow, for debugging)*/
+    #ifndef LV_OBJ_STYLE_CACHE_CHECK
+        #ifdef CONFIG_LV_OBJ_STYLE_CACHE_CHECK
+            #define LV_OBJ_STYLE_CACHE_CHECK CONFIG_LV_OBJ_STYLE_CACHE_CHECK
+        #else
+            #define LV_OBJ_STYLE_CACHE_CHECK 0
+        #endif
+    #endif
+#endif
+
 /*Change the built in (v)snprintf functions*/
 #ifndef LV_SPRINTF_CUSTOM
     #ifdef CONFIG_LV_SPRINTF_CUSTOM
@@ -1261,6 +1450,53 @@
     #endif
 #endif
 
+/*Number of letters whose glyph ID is cached in a direct-mapped table (8 bytes each) per font
+ *enabled by `lv_font_fmt_txt_cache_create()`. Other fonts remember only the last letter. Must be a power of 2.*/
+#ifndef LV_FONT_FMT_TXT_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_CACHE_SIZE
+        #define LV_FONT_FMT_TXT_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_CACHE_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_CACHE_SIZE 64
+    #endif
+#endif
+
+/*Number of kerning pairs cached per enabled font (8 bytes each). Must be a power of 2. 0: disable*/
+#ifndef LV_FONT_FMT_TXT_KERN_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_KERN_CACHE_SIZE
+        #define LV_FONT_FMT_TXT_KERN_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_KERN_CACHE_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_KERN_CACHE_SIZE 32
+    #endif
+#endif
+
+/*Allow pre-rendering a range of letters of a font to 8 bpp bitmaps with `lv_font_fmt_txt_atlas_create()`.
+ *The glyphs of the atlas are drawn without decompressing and unpacking them.*/
+#ifndef LV_USE_FONT_ATLAS
+    #ifdef CONFIG_LV_USE_FONT_ATLAS
+        #define LV_USE_FONT_ATLAS CONFIG_LV_USE_FONT_ATLAS
+    #else
+        #define LV_USE_FONT_ATLAS 0
+    #endif
+#endif
+
+/*`lv_font_load_lazy()` reads the glyph bitmaps of binary fonts in pages of this many bytes when they are drawn*/
+#ifndef LV_FONT_LOADER_PAGE_SIZE
+    #ifdef CONFIG_LV_FONT_LOADER_PAGE_SIZE
+        #define LV_FONT_LOADER_PAGE_SIZE CONFIG_LV_FONT_LOADER_PAGE_SIZE
+    #else
+        #define LV_FONT_LOADER_PAGE_SIZE 512
+    #endif
+#endif
+
+/*Default RAM budget of the pages of a font loaded with `lv_font_load_lazy()`, in bytes*/
+#ifndef LV_FONT_LOADER_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_LOADER_CACHE_SIZE
+        #define LV_FONT_LOADER_CACHE_SIZE CONFIG_LV_FONT_LOADER_CACHE_SIZE
+    #else
+        #define LV_FONT_LOADER_CACHE_SIZE (8 * 1024)
+    #endif
+#endif
+
 /*=================
  *  TEXT SETTINGS
  *=================*/
@@ -1497,6 +1733,13 @@
             #define LV_LABEL_LONG_TXT_HINT 1  /*Store some extra info in labels to speed up drawing of very long texts*/
         #endif
     #endif
+    #ifndef LV_LABEL_LAYOUT_CACHE
+        #ifdef CONFIG_LV_LABEL_LAYOUT_CACHE
+            #define LV_LABEL_LAYOUT_CACHE CONFIG_LV_LABEL_LAYOUT_CACHE
+        #else
+            #define LV_LABEL_LAYOUT_CACHE 0   /*Store the line breaks of the text in labels to measure it only when the text, font or width changes*/
+        #endif
+    #endif
 #endif
 
 #ifndef LV_USE_LINE
@@ -1866,6 +2109,18 @@
     #endif
 #endif
 
+#ifndef LV_USE_VLIST
+    #ifdef _LV_KCONFIG_PRESENT
+        #ifdef CONFIG_LV_USE_VLIST
+            #define LV_USE_VLIST CONFIG_LV_USE_VLIST
+        #else
+            #define LV_USE_VLIST 0
+        #endif
+    #else
+        #define LV_USE_VLIST      1
+    #endif
+#endif
+
 /*-----------
  * Themes
  *----------*/
@@ -2132,6 +2387,16 @@
         #define LV_USE_PNG 0
     #endif
 #endif
+#if LV_USE_PNG
+    /*Decode the whole image when it's opened if it needs at most this many bytes, else row by row [bytes]*/
+    #ifndef LV_PNG_WHOLE_MAX
+        #ifdef CONFIG_LV_PNG_WHOLE_MAX
+            #define LV_PNG_WHOLE_MAX CONFIG_LV_PNG_WHOLE_MAX
+        #else
+            #define LV_PNG_WHOLE_MAX (256 * 1024)
+        #endif
+    #endif
+#endif
 
 /*BMP decoder library*/
 #ifndef LV_USE_BMP
@@ -2152,6 +2417,70 @@
     #endif
 #endif
 
+/*Tiled images compressed with RLE or LZ4, made with scripts/img_to_timg.py.
+ *The tiles are decoded on demand from C arrays in flash or from files.*/
+#ifndef LV_USE_TIMG
+    #ifdef CONFIG_LV_USE_TIMG
+        #define LV_USE_TIMG CONFIG_LV_USE_TIMG
+    #else
+        #define LV_USE_TIMG 0
+    #endif
+#endif
+#if LV_USE_TIMG
+    /*Decode the whole image when it's opened if it needs at most this many bytes [bytes]*/
+    #ifndef LV_TIMG_WHOLE_MAX
+        #ifdef CONFIG_LV_TIMG_WHOLE_MAX
+            #define LV_TIMG_WHOLE_MAX CONFIG_LV_TIMG_WHOLE_MAX
+        #else
+            #define LV_TIMG_WHOLE_MAX (128 * 1024)
+        #endif
+    #endif
+    /*RAM for the decoded tiles of a larger image [bytes]*/
+    #ifndef LV_TIMG_TILE_CACHE_SIZE
+        #ifdef CONFIG_LV_TIMG_TILE_CACHE_SIZE
+            #define LV_TIMG_TILE_CACHE_SIZE CONFIG_LV_TIMG_TILE_CACHE_SIZE
+        #else
+            #define LV_TIMG_TILE_CACHE_SIZE (16 * 1024)
+        #endif
+    #endif
+#endif
+
+/*Keep the decoded pixels of image files (e.g. PNG and JPG) in files, e.g. on LittleFS,
+ *so that they are decoded only once, also across restarts*/
+#ifndef LV_USE_IMG_FSCACHE
+    #ifdef CONFIG_LV_USE_IMG_FSCACHE
+        #define LV_USE_IMG_FSCACHE CONFIG_LV_USE_IMG_FSCACHE
+    #else
+        #define LV_USE_IMG_FSCACHE 0
+    #endif
+#endif
+#if LV_USE_IMG_FSCACHE
+    /*Directory of the cache files with drive letter, e.g. "S:/imgcache". "": set it later with `lv_img_fscache_set_dir()`*/
+    #ifndef LV_IMG_FSCACHE_DIR
+        #ifdef CONFIG_LV_IMG_FSCACHE_DIR
+            #define LV_IMG_FSCACHE_DIR CONFIG_LV_IMG_FSCACHE_DIR
+        #else
+            #define LV_IMG_FSCACHE_DIR ""
+        #endif
+    #endif
+    /*Max. number of cache files*/
+    #ifndef LV_IMG_FSCACHE_SLOTS
+        #ifdef CONFIG_LV_IMG_FSCACHE_SLOTS
+            #define LV_IMG_FSCACHE_SLOTS CONFIG_LV_IMG_FSCACHE_SLOTS
+        #else
+            #define LV_IMG_FSCACHE_SLOTS 16
+        #endif
+    #endif
+    /*Max. total size of the cache files [bytes]*/
+    #ifndef LV_IMG_FSCACHE_MAX_SIZE
+        #ifdef CONFIG_LV_IMG_FSCACHE_MAX_SIZE
+            #define LV_IMG_FSCACHE_MAX_SIZE CONFIG_LV_IMG_FSCACHE_MAX_SIZE
+        #else
+            #define LV_IMG_FSCACHE_MAX_SIZE (4 * 1024 * 1024)
+        #endif
+    #endif
+#endif
+
 /*GIF decoder library*/
 #ifndef LV_USE_GIF
     #ifdef CONFIG_LV_USE_GIF
@@ -2277,6 +2606,17 @@
         #define LV_USE_SNAPSHOT 0
     #endif
 #endif
+#if LV_USE_SNAPSHOT
+    /*1: Draw the objects with `LV_OBJ_FLAG_CACHE_LAYER` and their children from a snapshot until one of them changes.
+     *The snapshots are kept in the budget of `LV_DRAW_CACHE_BUDGET` so it's required too*/
+    #ifndef LV_USE_SNAPSHOT_CACHE
+        #ifdef CONFIG_LV_USE_SNAPSHOT_CACHE
+            #define LV_USE_SNAPSHOT_CACHE CONFIG_LV_USE_SNAPSHOT_CACHE
+        #else
+            #define LV_USE_SNAPSHOT_CACHE 0
+        #endif
+    #endif
+#endif
 
 /*1: Enable Monkey test*/
 #ifndef LV_USE_MONKEY
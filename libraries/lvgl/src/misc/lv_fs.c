@@ -157,6 +157,10 @@ static lv_fs_res_t lv_fs_read_cached(lv_fs_file_t * file_p, char * buf, uint32_t
                 /*If remaining data chuck is bigger than buffer size, then do not use cache, instead read it directly from FS*/
                 res = file_p->drv->read_cb(file_p->drv, file_p->file_d, (void *)(buf + buffer_remaining_length),
                                            btr - buffer_remaining_length, &bytes_read_to_buffer);
+
+                /*The FS position is not at the end of the cache anymore*/
+                file_p->cache->start = UINT32_MAX;
+                file_p->cache->end = UINT32_MAX - 1;
             }
             else {
                 /*If remaining data chunk is smaller than buffer size, then read into cache buffer*/
@@ -175,6 +179,10 @@ static lv_fs_res_t lv_fs_read_cached(lv_fs_file_t * file_p, char * buf, uint32_t
         if(btr > buffer_size) {
             /*If bigger data is requested, then do not use cache, instead read it directly*/
             res = file_p->drv->read_cb(file_p->drv, file_p->file_d, (void *)buf, btr, br);
+
+            /*The FS position is not at the end of the cache anymore*/
+            file_p->cache->start = UINT32_MAX;
+            file_p->cache->end = UINT32_MAX - 1;
         }
         else {
             /*If small data is requested, then read from FS into cache buffer*/
@@ -278,6 +286,8 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whenc
             case LV_FS_SEEK_END: {
                     /*Because we don't know the file size, we do a little trick: do a FS seek, then get new file position from FS*/
                     res = file_p->drv->seek_cb(file_p->drv, file_p->file_d, pos, whence);
+                    file_p->cache->start = UINT32_MAX;
+                    file_p->cache->end = UINT32_MAX - 1;
                     if(res == LV_FS_RES_OK) {
                         uint32_t tmp_position;
                         res = file_p->drv->tell_cb(file_p->drv, file_p->file_d, &tmp_position);
@@ -12,6 +12,7 @@
 #include "lv_gc.h"
 #include "lv_assert.h"
 #include "lv_log.h"
+#include "../draw/lv_draw_arena.h"
 
 #if LV_MEM_CUSTOM != 0
     #include LV_MEM_CUSTOM_INCLUDE
@@ -39,9 +40,30 @@
 
 #define ZERO_MEM_SENTINEL  0xa1b2c3d4
 
+#if LV_MEM_CUSTOM == 0 && LV_MEM_SLAB_SIZE
+    #define SLAB_PAGE_SIZE      1024
+    #define SLAB_PAGE_CNT       (LV_MEM_SLAB_SIZE / SLAB_PAGE_SIZE)
+    #define SLAB_MAX_SIZE       128
+    #define SLAB_NONE           0xFFFF
+
+    #if SLAB_PAGE_CNT < 1 || SLAB_PAGE_CNT >= SLAB_NONE
+        #error "LV_MEM_SLAB_SIZE should be at least 1 kB and less than 64 MB"
+    #endif
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_MEM_CUSTOM == 0 && LV_MEM_SLAB_SIZE
+/*A page of the slab memory. It's divided to the blocks of one size class.*/
+typedef struct {
+    void * free_list;   /*The free blocks of the page, the first bytes of a free block point to the next*/
+    uint16_t prev;      /*Neighbors in the list of the pages with free blocks of the class or in the free pages*/
+    uint16_t next;
+    uint16_t used_cnt;
+    uint8_t cls;
+} slab_page_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -49,6 +71,14 @@
 #if LV_MEM_CUSTOM == 0
     static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
 #endif
+#if LV_MEM_CUSTOM == 0 && LV_MEM_SLAB_SIZE
+    static void slab_init(void);
+    static void * slab_alloc(size_t size);
+    static size_t slab_free(void * data);
+    static size_t slab_get_block_size(const void * data);
+    static void slab_page_link(uint16_t * head, uint16_t idx);
+    static void slab_page_unlink(uint16_t * head, uint16_t idx);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -59,6 +89,22 @@
     static uint32_t max_used;
 #endif
 
+#if LV_MEM_CUSTOM == 0 && LV_MEM_SLAB_SIZE
+    static const uint8_t slab_class_size[LV_MEM_SLAB_CLASS_NUM] = {8, 16, 24, 32, 48, 64, 96, 128};
+    /*Class of the sizes rounded up to 8: class = slab_class_of[(size + 7) / 8]*/
+    static const uint8_t slab_class_of[SLAB_MAX_SIZE / 8 + 1] = {0, 0, 1, 2, 3, 4, 4, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7};
+    static uint8_t * slab_mem;
+    static slab_page_t slab_pages[SLAB_PAGE_CNT];
+    static uint16_t slab_partial[LV_MEM_SLAB_CLASS_NUM];  /*Pages with free blocks*/
+    static uint16_t slab_free_pages;
+    static uint32_t slab_used_cnt[LV_MEM_SLAB_CLASS_NUM];
+    static uint32_t slab_max_used_cnt[LV_MEM_SLAB_CLASS_NUM];
+    static uint32_t slab_page_cnt[LV_MEM_SLAB_CLASS_NUM];
+    static uint32_t slab_used_page_cnt;
+    static uint32_t slab_max_used_page_cnt;
+    static uint32_t slab_fallback_cnt;
+#endif
+
 static uint32_t zero_mem = ZERO_MEM_SENTINEL; /*Give the address of this variable if 0 byte should be allocated*/
 
 /**********************
@@ -98,6 +144,10 @@ void lv_mem_init(void)
 #else
     tlsf = lv_tlsf_create_with_pool((void *)LV_MEM_ADR, LV_MEM_SIZE);
 #endif
+
+#if LV_MEM_SLAB_SIZE
+    slab_init();
+#endif
 #endif
 
 #if LV_MEM_ADD_JUNK
@@ -130,7 +180,11 @@ void * lv_mem_alloc(size_t size)
         return &zero_mem;
     }
 
-#if LV_MEM_CUSTOM == 0
+#if LV_MEM_CUSTOM == 0 && LV_MEM_SLAB_SIZE
+    /*Small allocations go to the pages of their size class to keep them out of the pool*/
+    void * alloc = slab_alloc(size);
+    if(alloc == NULL) alloc = lv_tlsf_malloc(tlsf, size);
+#elif LV_MEM_CUSTOM == 0
     void * alloc = lv_tlsf_malloc(tlsf, size);
 #else
     void * alloc = LV_MEM_CUSTOM_ALLOC(size);
@@ -173,10 +227,16 @@ void lv_mem_free(void * data)
     if(data == NULL) return;
 
 #if LV_MEM_CUSTOM == 0
+    size_t size = 0;
+#  if LV_MEM_SLAB_SIZE
+    size = slab_free(data);
+#  endif
+    if(size == 0) {
 #  if LV_MEM_ADD_JUNK
-    lv_memset(data, 0xbb, lv_tlsf_block_size(data));
+        lv_memset(data, 0xbb, lv_tlsf_block_size(data));
 #  endif
-    size_t size = lv_tlsf_free(tlsf, data);
+        size = lv_tlsf_free(tlsf, data);
+    }
     if(cur_used > size) cur_used -= size;
     else cur_used = 0;
 #else
@@ -203,6 +263,25 @@ void * lv_mem_realloc(void * data_p, size_t new_size)
     if(data_p == &zero_mem) return lv_mem_alloc(new_size);
 
 #if LV_MEM_CUSTOM == 0
+#  if LV_MEM_SLAB_SIZE
+    /*Let the new small blocks go to the slab too*/
+    if(data_p == NULL) return lv_mem_alloc(new_size);
+
+    size_t block_size = slab_get_block_size(data_p);
+    if(block_size) {
+        /*Keep the block if the new size still fits into it*/
+        if(new_size <= block_size) return data_p;
+
+        void * slab_new_p = lv_mem_alloc(new_size);
+        if(slab_new_p == NULL) {
+            LV_LOG_ERROR("couldn't allocate memory");
+            return NULL;
+        }
+        lv_memcpy(slab_new_p, data_p, block_size);
+        lv_mem_free(data_p);
+        return slab_new_p;
+    }
+#  endif
     void * new_p = lv_tlsf_realloc(tlsf, data_p, new_size);
 #else
     void * new_p = LV_MEM_CUSTOM_REALLOC(data_p, new_size);
@@ -253,7 +332,6 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
     lv_tlsf_walk_pool(lv_tlsf_get_pool(tlsf), lv_mem_walker, mon_p);
 
     mon_p->total_size = LV_MEM_SIZE;
-    mon_p->used_pct = 100 - (100U * mon_p->free_size) / mon_p->total_size;
     if(mon_p->free_size > 0) {
         mon_p->frag_pct = mon_p->free_biggest_size * 100U / mon_p->free_size;
         mon_p->frag_pct = 100 - mon_p->frag_pct;
@@ -262,6 +340,20 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
         mon_p->frag_pct = 0; /*no fragmentation if all the RAM is used*/
     }
 
+#if LV_MEM_SLAB_SIZE
+    /*The slab memory is one used block of the pool but its free blocks are still available.
+     *They are not counted in the fragmentation as only small allocations can use them.*/
+    if(slab_mem) {
+        mon_p->free_size += (SLAB_PAGE_CNT - slab_used_page_cnt) * SLAB_PAGE_SIZE;
+        uint32_t i;
+        for(i = 0; i < LV_MEM_SLAB_CLASS_NUM; i++) {
+            uint32_t block_cnt = slab_page_cnt[i] * (SLAB_PAGE_SIZE / slab_class_size[i]);
+            mon_p->free_size += (block_cnt - slab_used_cnt[i]) * slab_class_size[i];
+        }
+    }
+#endif
+
+    mon_p->used_pct = 100 - (100U * mon_p->free_size) / mon_p->total_size;
     mon_p->max_used = max_used;
 
     MEM_TRACE("finished");
@@ -269,6 +361,38 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
 }
 
 
+/**
+ * Give information about the fixed size blocks of the small allocations
+ * @param mon_p pointer to a lv_mem_slab_monitor_t variable,
+ *              the result of the analysis will be stored here
+ */
+void lv_mem_slab_monitor(lv_mem_slab_monitor_t * mon_p)
+{
+    lv_memset_00(mon_p, sizeof(lv_mem_slab_monitor_t));
+#if LV_MEM_CUSTOM == 0 && LV_MEM_SLAB_SIZE
+    if(slab_mem == NULL) return;
+
+    uint32_t used_size = 0;
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_NUM; i++) {
+        mon_p->classes[i].block_size = slab_class_size[i];
+        mon_p->classes[i].used_cnt = slab_used_cnt[i];
+        mon_p->classes[i].max_used_cnt = slab_max_used_cnt[i];
+        mon_p->classes[i].page_cnt = slab_page_cnt[i];
+        used_size += slab_used_cnt[i] * slab_class_size[i];
+    }
+
+    mon_p->total_size = SLAB_PAGE_CNT * SLAB_PAGE_SIZE;
+    mon_p->page_size = SLAB_PAGE_SIZE;
+    mon_p->free_page_cnt = SLAB_PAGE_CNT - slab_used_page_cnt;
+    mon_p->max_used_page_cnt = slab_max_used_page_cnt;
+    mon_p->fallback_cnt = slab_fallback_cnt;
+    if(slab_used_page_cnt) {
+        mon_p->frag_pct = 100 - (uint64_t)used_size * 100 / (slab_used_page_cnt * SLAB_PAGE_SIZE);
+    }
+#endif
+}
+
 /**
  * Get a temporal buffer with the given size.
  * @param size the required size
@@ -304,6 +428,15 @@ void * lv_mem_buf_get(uint32_t size)
         return LV_GC_ROOT(lv_mem_buf[i_guess]).p;
     }
 
+#if LV_DRAW_ARENA_SIZE
+    /*While refreshing take it from the arena instead of resizing a buffer*/
+    void * arena_buf = _lv_draw_arena_get(size);
+    if(arena_buf) {
+        MEM_TRACE("returning a buffer of the draw arena (address: %p)", arena_buf);
+        return arena_buf;
+    }
+#endif
+
     /*Reallocate a free buffer*/
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
         if(LV_GC_ROOT(lv_mem_buf[i]).used == 0) {
@@ -333,6 +466,13 @@ void lv_mem_buf_release(void * p)
 {
     MEM_TRACE("begin (address: %p)", p);
 
+#if LV_DRAW_ARENA_SIZE
+    if(_lv_draw_arena_is_in(p)) {
+        _lv_draw_arena_release(p);
+        return;
+    }
+#endif
+
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
         if(LV_GC_ROOT(lv_mem_buf[i]).p == p) {
             LV_GC_ROOT(lv_mem_buf[i]).used = 0;
@@ -564,3 +704,136 @@ static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
     }
 }
 #endif
+
+#if LV_MEM_CUSTOM == 0 && LV_MEM_SLAB_SIZE
+static void slab_init(void)
+{
+    lv_memset_00(slab_used_cnt, sizeof(slab_used_cnt));
+    lv_memset_00(slab_max_used_cnt, sizeof(slab_max_used_cnt));
+    lv_memset_00(slab_page_cnt, sizeof(slab_page_cnt));
+    slab_used_page_cnt = 0;
+    slab_max_used_page_cnt = 0;
+    slab_fallback_cnt = 0;
+
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_NUM; i++) slab_partial[i] = SLAB_NONE;
+
+    slab_free_pages = SLAB_NONE;
+    slab_mem = lv_tlsf_malloc(tlsf, SLAB_PAGE_CNT * SLAB_PAGE_SIZE);
+    if(slab_mem == NULL) {
+        LV_LOG_WARN("couldn't allocate the slab memory, LV_MEM_SIZE is too small");
+        return;
+    }
+
+    /*Add the pages in reverse order to give the lower addresses first*/
+    for(i = SLAB_PAGE_CNT; i > 0; i--) {
+        slab_page_link(&slab_free_pages, i - 1);
+    }
+}
+
+static void * slab_alloc(size_t size)
+{
+    if(slab_mem == NULL || size > SLAB_MAX_SIZE) return NULL;
+
+    uint8_t cls = slab_class_of[(size + 7) >> 3];
+    uint16_t idx = slab_partial[cls];
+    slab_page_t * page;
+    if(idx == SLAB_NONE) {
+        idx = slab_free_pages;
+        if(idx == SLAB_NONE) {
+            slab_fallback_cnt++;
+            return NULL;
+        }
+
+        /*Divide a free page to blocks of this class*/
+        slab_page_unlink(&slab_free_pages, idx);
+        page = &slab_pages[idx];
+        page->cls = cls;
+        page->used_cnt = 0;
+        page->free_list = NULL;
+        uint8_t * page_mem = slab_mem + (uint32_t)idx * SLAB_PAGE_SIZE;
+        uint32_t block_size = slab_class_size[cls];
+        uint32_t b;
+        for(b = SLAB_PAGE_SIZE / block_size; b > 0; b--) {
+            void ** block = (void **)(page_mem + (b - 1) * block_size);
+            *block = page->free_list;
+            page->free_list = block;
+        }
+        slab_page_link(&slab_partial[cls], idx);
+
+        slab_page_cnt[cls]++;
+        slab_used_page_cnt++;
+        slab_max_used_page_cnt = LV_MAX(slab_max_used_page_cnt, slab_used_page_cnt);
+    }
+
+    page = &slab_pages[idx];
+    void ** block = page->free_list;
+    page->free_list = *block;
+    page->used_cnt++;
+    if(page->free_list == NULL) slab_page_unlink(&slab_partial[cls], idx);
+
+    slab_used_cnt[cls]++;
+    slab_max_used_cnt[cls] = LV_MAX(slab_max_used_cnt[cls], slab_used_cnt[cls]);
+    return block;
+}
+
+/**
+ * Give a block back to its page.
+ * @param data      pointer to the block
+ * @return          the size of the block or 0 if `data` is not in the slab memory
+ */
+static size_t slab_free(void * data)
+{
+    size_t block_size = slab_get_block_size(data);
+    if(block_size == 0) return 0;
+
+#if LV_MEM_ADD_JUNK
+    lv_memset(data, 0xbb, block_size);
+#endif
+
+    uint16_t idx = (uint16_t)(((uint8_t *)data - slab_mem) / SLAB_PAGE_SIZE);
+    slab_page_t * page = &slab_pages[idx];
+    bool was_full = page->free_list == NULL;
+    *(void **)data = page->free_list;
+    page->free_list = data;
+    page->used_cnt--;
+    slab_used_cnt[page->cls]--;
+
+    if(page->used_cnt == 0) {
+        /*Let the other classes use the empty page*/
+        if(!was_full) slab_page_unlink(&slab_partial[page->cls], idx);
+        slab_page_link(&slab_free_pages, idx);
+        slab_page_cnt[page->cls]--;
+        slab_used_page_cnt--;
+    }
+    else if(was_full) {
+        slab_page_link(&slab_partial[page->cls], idx);
+    }
+
+    return block_size;
+}
+
+static size_t slab_get_block_size(const void * data)
+{
+    const uint8_t * p = data;
+    if(slab_mem == NULL || p < slab_mem || p >= slab_mem + SLAB_PAGE_CNT * SLAB_PAGE_SIZE) return 0;
+
+    return slab_class_size[slab_pages[(p - slab_mem) / SLAB_PAGE_SIZE].cls];
+}
+
+static void slab_page_link(uint16_t * head, uint16_t idx)
+{
+    slab_pages[idx].prev = SLAB_NONE;
+    slab_pages[idx].next = *head;
+    if(*head != SLAB_NONE) slab_pages[*head].prev = idx;
+    *head = idx;
+}
+
+static void slab_page_unlink(uint16_t * head, uint16_t idx)
+{
+    slab_page_t * page = &slab_pages[idx];
+    if(page->prev != SLAB_NONE) slab_pages[page->prev].next = page->next;
+    else *head = page->next;
+    if(page->next != SLAB_NONE) slab_pages[page->next].prev = page->prev;
+}
+#endif
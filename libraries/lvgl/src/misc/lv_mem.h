@@ -24,6 +24,8 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+/*Number of the block sizes of `LV_MEM_SLAB_SIZE`*/
+#define LV_MEM_SLAB_CLASS_NUM   8
 
 /**********************
  *      TYPEDEFS
@@ -43,6 +45,29 @@ typedef struct {
     uint8_t frag_pct; /**< Amount of fragmentation*/
 } lv_mem_monitor_t;
 
+/**
+ * Information about the blocks of one size in the slab memory.
+ */
+typedef struct {
+    uint32_t block_size;
+    uint32_t used_cnt;      /**< Blocks in use*/
+    uint32_t max_used_cnt;  /**< Max number of blocks in use at the same time*/
+    uint32_t page_cnt;      /**< Pages given to this block size*/
+} lv_mem_slab_class_monitor_t;
+
+/**
+ * Slab memory information structure.
+ */
+typedef struct {
+    lv_mem_slab_class_monitor_t classes[LV_MEM_SLAB_CLASS_NUM];
+    uint32_t total_size;        /**< Size of the slab memory*/
+    uint32_t page_size;
+    uint32_t free_page_cnt;
+    uint32_t max_used_page_cnt; /**< Max number of pages in use at the same time*/
+    uint32_t fallback_cnt;      /**< Small allocations served by the pool because there was no free page*/
+    uint8_t frag_pct;           /**< Unused part of the pages in use*/
+} lv_mem_slab_monitor_t;
+
 typedef struct {
     void * p;
     uint16_t size;
@@ -101,6 +126,14 @@ lv_res_t lv_mem_test(void);
  */
 void lv_mem_monitor(lv_mem_monitor_t * mon_p);
 
+/**
+ * Give information about the fixed size blocks of the small allocations
+ * @param mon_p pointer to a lv_mem_slab_monitor_t variable,
+ *              the result of the analysis will be stored here
+ * @note It works only if `LV_MEM_CUSTOM == 0` and `LV_MEM_SLAB_SIZE > 0`
+ */
+void lv_mem_slab_monitor(lv_mem_slab_monitor_t * mon_p);
+
 
 /**
  * Get a temporal buffer with the given size.
@@ -139,6 +139,7 @@ uint32_t _lv_style_custom_prop_flag_lookup_table_size = 0;
 
 static uint16_t last_custom_prop_id = (uint16_t)_LV_STYLE_LAST_BUILT_IN_PROP;
 static const lv_style_value_t null_style_value = { .num = 0 };
+static uint32_t change_cnt = 0;     /*Incremented on every change of any style*/
 
 /**********************
  *      MACROS
@@ -160,6 +161,7 @@ void lv_style_init(lv_style_t * style)
 #if LV_USE_ASSERT_STYLE
     style->sentinel = LV_STYLE_SENTINEL_VALUE;
 #endif
+    change_cnt++;
 }
 
 void lv_style_reset(lv_style_t * style)
@@ -176,6 +178,7 @@ void lv_style_reset(lv_style_t * style)
 #if LV_USE_ASSERT_STYLE
     style->sentinel = LV_STYLE_SENTINEL_VALUE;
 #endif
+    change_cnt++;
 }
 
 lv_style_prop_t lv_style_register_prop(uint8_t flag)
@@ -230,6 +233,8 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
 
     if(style->prop_cnt == 0)  return false;
 
+    change_cnt++;
+
     if(style->prop_cnt == 1) {
         if(LV_STYLE_PROP_ID_MASK(style->prop1) == prop) {
             style->prop1 = LV_STYLE_PROP_INV;
@@ -313,6 +318,8 @@ void lv_style_transition_dsc_init(lv_style_transition_dsc_t * tr, const lv_style
 lv_style_value_t lv_style_prop_get_default(lv_style_prop_t prop)
 {
     lv_style_value_t value;
+    /*Clear the unused bytes of the union to make the values comparable*/
+    lv_memset_00(&value, sizeof(value));
     switch(prop) {
         case LV_STYLE_TRANSFORM_ZOOM:
             value.num = LV_IMG_ZOOM_NONE;
@@ -378,6 +385,11 @@ uint8_t _lv_style_get_prop_group(lv_style_prop_t prop)
     return (uint8_t)group;
 }
 
+uint32_t _lv_style_get_change_cnt(void)
+{
+    return change_cnt;
+}
+
 uint8_t _lv_style_prop_lookup_flags(lv_style_prop_t prop)
 {
     extern const uint8_t _lv_style_builtin_prop_flag_lookup_table[];
@@ -424,6 +436,8 @@ static void lv_style_set_prop_internal(lv_style_t * style, lv_style_prop_t prop_
 
     lv_style_prop_t prop_id = LV_STYLE_PROP_ID_MASK(prop_and_meta);
 
+    change_cnt++;
+
     if(style->prop_cnt > 1) {
         uint8_t * tmp = style->v_p.values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
         uint16_t * props = (uint16_t *)tmp;
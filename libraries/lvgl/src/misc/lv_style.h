@@ -511,6 +511,13 @@ bool lv_style_is_empty(const lv_style_t * style);
  */
 uint8_t _lv_style_get_prop_group(lv_style_prop_t prop);
 
+/**
+ * Get a counter which is incremented when any style is initialized, reset or its properties are changed.
+ * It tells if the values resolved from the styles might be changed.
+ * @return the number of style changes so far
+ */
+uint32_t _lv_style_get_change_cnt(void);
+
 /**
  * Get the flags of a built-in or custom property.
  *
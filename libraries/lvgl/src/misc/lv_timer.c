@@ -17,6 +17,8 @@
  *********************/
 #define IDLE_MEAS_PERIOD 500 /*[ms]*/
 #define DEF_PERIOD 500
+#define HEAP_NONE UINT32_MAX
+#define HEAP_MIN_SIZE 8
 
 /**********************
  *      TYPEDEFS
@@ -27,6 +29,14 @@
  **********************/
 static bool lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
+#if LV_TIMER_HEAP
+    static bool heap_resize(uint32_t new_size);
+    static void heap_insert(lv_timer_t * timer);
+    static void heap_remove(lv_timer_t * timer);
+    static void heap_update(lv_timer_t * timer);
+    static void heap_set(uint32_t index, lv_timer_t * timer);
+    static bool heap_less(lv_timer_t * a, lv_timer_t * b, uint32_t now);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -35,6 +45,12 @@ static bool lv_timer_run = false;
 static uint8_t idle_last = 0;
 static bool timer_deleted;
 static bool timer_created;
+#if LV_TIMER_HEAP
+    static uint32_t heap_cnt;       /*Timers in the heap (the not paused ones)*/
+    static uint32_t heap_size;      /*Capacity of the heap, enough for all the timers*/
+    static uint32_t timer_cnt;
+    static uint32_t handler_cnt;
+#endif
 
 /**********************
  *      MACROS
@@ -55,6 +71,12 @@ static bool timer_created;
 void _lv_timer_core_init(void)
 {
     _lv_ll_init(&LV_GC_ROOT(_lv_timer_ll), sizeof(lv_timer_t));
+#if LV_TIMER_HEAP
+    LV_GC_ROOT(_lv_timer_heap) = NULL;
+    heap_cnt = 0;
+    heap_size = 0;
+    timer_cnt = 0;
+#endif
 
     /*Initially enable the lv_timer handling*/
     lv_timer_enable(true);
@@ -95,6 +117,26 @@ uint32_t LV_ATTRIBUTE_TIMER_HANDLER lv_timer_handler(void)
         }
     }
 
+#if LV_TIMER_HEAP
+    /*Run the timers from the top of the heap while they are ready.
+     *Running a timer moves it down in the heap below the ready timers which haven't run yet,
+     *so if the top one has already run in this call (e.g. `period == 0`) all the ready ones have run*/
+    handler_cnt++;
+    while(heap_cnt > 0) {
+        lv_timer_t * timer = LV_GC_ROOT(_lv_timer_heap)[0];
+        if(timer->handler_cnt == handler_cnt) break;
+        if(lv_timer_time_remaining(timer) != 0) break;
+
+        timer->handler_cnt = handler_cnt;
+        timer_deleted = false;
+        LV_GC_ROOT(_lv_timer_act) = timer;
+        lv_timer_exec(timer);
+    }
+    LV_GC_ROOT(_lv_timer_act) = NULL;
+
+    uint32_t time_till_next = LV_NO_TIMER_READY;
+    if(heap_cnt > 0) time_till_next = lv_timer_time_remaining(LV_GC_ROOT(_lv_timer_heap)[0]);
+#else
     /*Run all timer from the list*/
     lv_timer_t * next;
     do {
@@ -129,6 +171,7 @@ uint32_t LV_ATTRIBUTE_TIMER_HANDLER lv_timer_handler(void)
 
         next = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), next); /*Find the next timer*/
     }
+#endif
 
     busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(idle_period_start);
@@ -168,6 +211,13 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
 {
     lv_timer_t * new_timer = NULL;
 
+#if LV_TIMER_HEAP
+    /*Keep place for all the timers so resuming a timer can't fail*/
+    if(timer_cnt >= heap_size) {
+        if(!heap_resize(heap_size ? heap_size * 2 : HEAP_MIN_SIZE)) return NULL;
+    }
+#endif
+
     new_timer = _lv_ll_ins_head(&LV_GC_ROOT(_lv_timer_ll));
     LV_ASSERT_MALLOC(new_timer);
     if(new_timer == NULL) return NULL;
@@ -179,6 +229,12 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
 
+#if LV_TIMER_HEAP
+    new_timer->handler_cnt = handler_cnt - 1;
+    timer_cnt++;
+    heap_insert(new_timer);
+#endif
+
     timer_created = true;
 
     return new_timer;
@@ -203,6 +259,12 @@ void lv_timer_del(lv_timer_t * timer)
     _lv_ll_remove(&LV_GC_ROOT(_lv_timer_ll), timer);
     timer_deleted = true;
 
+#if LV_TIMER_HEAP
+    heap_remove(timer);
+    timer_cnt--;
+    if(heap_size > HEAP_MIN_SIZE && timer_cnt <= heap_size / 4) heap_resize(heap_size / 2);
+#endif
+
     lv_mem_free(timer);
 }
 
@@ -213,11 +275,17 @@ void lv_timer_del(lv_timer_t * timer)
 void lv_timer_pause(lv_timer_t * timer)
 {
     timer->paused = true;
+#if LV_TIMER_HEAP
+    heap_remove(timer);
+#endif
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     timer->paused = false;
+#if LV_TIMER_HEAP
+    if(timer->heap_index == HEAP_NONE) heap_insert(timer);
+#endif
 }
 
 /**
@@ -228,6 +296,9 @@ void lv_timer_resume(lv_timer_t * timer)
 void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     timer->period = period;
+#if LV_TIMER_HEAP
+    heap_update(timer);
+#endif
 }
 
 /**
@@ -237,6 +308,9 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 void lv_timer_ready(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get() - timer->period - 1;
+#if LV_TIMER_HEAP
+    heap_update(timer);
+#endif
 }
 
 /**
@@ -247,6 +321,10 @@ void lv_timer_ready(lv_timer_t * timer)
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     timer->repeat_count = repeat_count;
+#if LV_TIMER_HEAP
+    /*Delete it in the next `lv_timer_handler()` as without the heap*/
+    if(repeat_count == 0) lv_timer_ready(timer);
+#endif
 }
 
 /**
@@ -257,6 +335,9 @@ void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 void lv_timer_reset(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get();
+#if LV_TIMER_HEAP
+    heap_update(timer);
+#endif
 }
 
 /**
@@ -309,6 +390,9 @@ static bool lv_timer_exec(lv_timer_t * timer)
         int32_t original_repeat_count = timer->repeat_count;
         if(timer->repeat_count > 0) timer->repeat_count--;
         timer->last_run = lv_tick_get();
+#if LV_TIMER_HEAP
+        heap_update(timer);
+#endif
         TIMER_TRACE("calling timer callback: %p", *((void **)&timer->timer_cb));
         if(timer->timer_cb && original_repeat_count != 0) timer->timer_cb(timer);
         TIMER_TRACE("timer callback %p finished", *((void **)&timer->timer_cb));
@@ -339,3 +423,114 @@ static uint32_t lv_timer_time_remaining(lv_timer_t * timer)
         return 0;
     return timer->period - elp;
 }
+
+#if LV_TIMER_HEAP
+
+/**
+ * Reallocate the heap. It's kept large enough for all the timers, even the paused ones.
+ * @param new_size the new capacity
+ * @return true: success; false: out of memory
+ */
+static bool heap_resize(uint32_t new_size)
+{
+    lv_timer_t ** new_heap = lv_mem_realloc(LV_GC_ROOT(_lv_timer_heap), new_size * sizeof(lv_timer_t *));
+    LV_ASSERT_MALLOC(new_heap);
+    if(new_heap == NULL) return false;
+
+    LV_GC_ROOT(_lv_timer_heap) = new_heap;
+    heap_size = new_size;
+    return true;
+}
+
+/**
+ * Add a timer to the heap
+ * @param timer pointer to an lv_timer
+ */
+static void heap_insert(lv_timer_t * timer)
+{
+    LV_ASSERT(heap_cnt < heap_size);
+
+    heap_set(heap_cnt, timer);
+    heap_cnt++;
+    heap_update(timer);
+}
+
+/**
+ * Remove a timer from the heap. Does nothing if it's not in the heap (paused)
+ * @param timer pointer to an lv_timer
+ */
+static void heap_remove(lv_timer_t * timer)
+{
+    uint32_t index = timer->heap_index;
+    if(index == HEAP_NONE) return;
+
+    timer->heap_index = HEAP_NONE;
+    heap_cnt--;
+    if(index == heap_cnt) return;
+
+    /*Move the last timer to the place of the removed one*/
+    lv_timer_t * last = LV_GC_ROOT(_lv_timer_heap)[heap_cnt];
+    heap_set(index, last);
+    heap_update(last);
+}
+
+/**
+ * Move a timer up or down in the heap after its next run has changed
+ * @param timer pointer to an lv_timer
+ */
+static void heap_update(lv_timer_t * timer)
+{
+    uint32_t index = timer->heap_index;
+    if(index == HEAP_NONE) return;
+
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    uint32_t now = lv_tick_get();
+
+    /*Move up while it should run earlier than its parent*/
+    while(index > 0) {
+        uint32_t parent = (index - 1) / 2;
+        if(!heap_less(timer, heap[parent], now)) break;
+        heap_set(index, heap[parent]);
+        index = parent;
+    }
+
+    /*Move down while a child should run earlier*/
+    while(1) {
+        uint32_t child = index * 2 + 1;
+        if(child >= heap_cnt) break;
+        if(child + 1 < heap_cnt && heap_less(heap[child + 1], heap[child], now)) child++;
+        if(!heap_less(heap[child], timer, now)) break;
+        heap_set(index, heap[child]);
+        index = child;
+    }
+
+    heap_set(index, timer);
+}
+
+static void heap_set(uint32_t index, lv_timer_t * timer)
+{
+    LV_GC_ROOT(_lv_timer_heap)[index] = timer;
+    timer->heap_index = index;
+}
+
+/**
+ * Tell which timer should run first.
+ * The time remaining is used instead of `last_run + period` to order them correctly when the tick overflows.
+ * Of the ready timers the ones which have already run in this `lv_timer_handler()` call go after the others,
+ * else a timer with `period == 0` would stay on the top and the other ready timers would never run.
+ * @param a pointer to an lv_timer
+ * @param b pointer to an other lv_timer
+ * @param now the current tick
+ * @return true: `a` should run before `b`
+ */
+static bool heap_less(lv_timer_t * a, lv_timer_t * b, uint32_t now)
+{
+    uint32_t elp_a = now - a->last_run;
+    uint32_t elp_b = now - b->last_run;
+    uint32_t rem_a = elp_a >= a->period ? 0 : a->period - elp_a;
+    uint32_t rem_b = elp_b >= b->period ? 0 : b->period - elp_b;
+    if(rem_a == 0 && rem_b == 0) return a->handler_cnt != handler_cnt && b->handler_cnt == handler_cnt;
+    return rem_a < rem_b;
+}
+
+#endif /*LV_TIMER_HEAP*/
@@ -48,6 +48,10 @@ typedef struct _lv_timer_t {
     void * user_data; /**< Custom user data*/
     int32_t repeat_count; /**< 1: One time;  -1 : infinity;  n>0: residual times*/
     uint32_t paused : 1;
+#if LV_TIMER_HEAP
+    uint32_t heap_index; /**< Position in the heap of the timers, internal*/
+    uint32_t handler_cnt; /**< The `lv_timer_handler()` call in which the timer ran last, internal*/
+#endif
 } lv_timer_t;
 
 /**********************
@@ -49,6 +49,15 @@ static void lv_label_dot_tmp_free(lv_obj_t * label);
 static void set_ofs_x_anim(void * obj, int32_t v);
 static void set_ofs_y_anim(void * obj, int32_t v);
 
+#if LV_LABEL_LAYOUT_CACHE
+static void layout_key_init(lv_label_layout_key_t * key, const char * text, const lv_font_t * font,
+                            lv_coord_t letter_space, lv_coord_t line_space, lv_coord_t max_w, lv_text_flag_t flag);
+static bool layout_key_eq(const lv_label_layout_key_t * k1, const lv_label_layout_key_t * k2);
+static bool layout_measure(lv_obj_t * obj, const lv_label_layout_key_t * key);
+static void layout_free(lv_obj_t * obj);
+static uint32_t get_text_hash(const char * txt);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -713,6 +722,13 @@ static void lv_label_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     label->dot.tmp_ptr   = NULL;
     label->dot_tmp_alloc = 0;
 
+#if LV_LABEL_LAYOUT_CACHE
+    label->layout_key.text    = NULL;
+    label->layout_lines       = NULL;
+    label->layout_line_cnt    = 0;
+    label->self_size_key.text = NULL;
+#endif
+
     lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE);
     lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
     lv_label_set_text(obj, "Text");
@@ -729,6 +745,10 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_label_dot_tmp_free(obj);
     if(!label->static_txt) lv_mem_free(label->text);
     label->text = NULL;
+
+#if LV_LABEL_LAYOUT_CACHE
+    layout_free(obj);
+#endif
 }
 
 static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -776,7 +796,24 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
         if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) w = LV_COORD_MAX;
         else w = lv_obj_get_content_width(obj);
 
+#if LV_LABEL_LAYOUT_CACHE
+        /*Content sized labels are measured without wrapping here, so it's usually not the key of the layout*/
+        lv_label_layout_key_t key;
+        layout_key_init(&key, label->text, font, letter_space, line_space, w, flag);
+        if(layout_key_eq(&key, &label->layout_key)) {
+            size = label->layout_size;
+        }
+        else if(layout_key_eq(&key, &label->self_size_key)) {
+            size = label->self_size;
+        }
+        else {
+            lv_txt_get_size(&size, label->text, font, letter_space, line_space, w, flag);
+            label->self_size_key = key;
+            label->self_size = size;
+        }
+#else
         lv_txt_get_size(&size, label->text, font, letter_space, line_space, w, flag);
+#endif
 
         lv_point_t * self_size = lv_event_get_param(e);
         self_size->x = LV_MAX(self_size->x, size.x);
@@ -844,6 +881,17 @@ static void draw_main(lv_event_t * e)
     bool is_common = _lv_area_intersect(&txt_clip, &txt_coords, draw_ctx->clip_area);
     if(!is_common) return;
 
+#if LV_LABEL_LAYOUT_CACHE
+    /*Draw with the measured lines instead of breaking the text again in every refresh*/
+    lv_label_layout_key_t key;
+    layout_key_init(&key, label->text, label_draw_dsc.font, label_draw_dsc.letter_space, label_draw_dsc.line_space,
+                    lv_area_get_width(&txt_coords), label_draw_dsc.flag);
+    if(layout_measure(obj, &key)) {
+        label_draw_dsc.lines = label->layout_lines;
+        label_draw_dsc.line_cnt = label->layout_line_cnt;
+    }
+#endif
+
     if(label->long_mode == LV_LABEL_LONG_WRAP) {
         lv_coord_t s = lv_obj_get_scroll_top(obj);
         lv_area_move(&txt_coords, 0, -s);
@@ -914,7 +962,15 @@ static void lv_label_refr_text(lv_obj_t * obj)
     if(label->expand != 0) flag |= LV_TEXT_FLAG_EXPAND;
     if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) flag |= LV_TEXT_FLAG_FIT;
 
+#if LV_LABEL_LAYOUT_CACHE
+    /*Measure the lines once and reuse them until the text, font, spacing or width changes*/
+    lv_label_layout_key_t key;
+    layout_key_init(&key, label->text, font, letter_space, line_space, max_w, flag);
+    if(layout_measure(obj, &key)) size = label->layout_size;
+    else lv_txt_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+#else
     lv_txt_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+#endif
 
     lv_obj_refresh_self_size(obj);
 
@@ -1270,5 +1326,155 @@ static void set_ofs_y_anim(void * obj, int32_t v)
     lv_obj_invalidate(obj);
 }
 
+#if LV_LABEL_LAYOUT_CACHE
+
+/**
+ * Initialize the key of a measurement
+ * @param key           pointer to the key to initialize
+ * @param text          the text to measure
+ * @param font          font of the text
+ * @param letter_space  letter space
+ * @param line_space    line space
+ * @param max_w         max. width of the lines
+ * @param flag          settings for the text from `lv_text_flag_t`
+ */
+static void layout_key_init(lv_label_layout_key_t * key, const char * text, const lv_font_t * font,
+                            lv_coord_t letter_space, lv_coord_t line_space, lv_coord_t max_w, lv_text_flag_t flag)
+{
+    /*With `LV_TEXT_FLAG_EXPAND` and `LV_TEXT_FLAG_FIT` the lines are broken only at the new line characters,
+     *so the width doesn't matter*/
+    if(flag & (LV_TEXT_FLAG_EXPAND | LV_TEXT_FLAG_FIT)) {
+        max_w = LV_COORD_MAX;
+        flag = (flag & ~LV_TEXT_FLAG_EXPAND) | LV_TEXT_FLAG_FIT;
+    }
+
+    key->text = text;
+    key->text_hash = text ? get_text_hash(text) : 0;
+    key->font = font;
+    key->max_w = max_w;
+    key->letter_space = letter_space;
+    key->line_space = line_space;
+    key->flag = flag;
+}
+
+static bool layout_key_eq(const lv_label_layout_key_t * k1, const lv_label_layout_key_t * k2)
+{
+    if(k1->text == NULL || k2->text == NULL) return false;
+
+    return k1->text == k2->text && k1->text_hash == k2->text_hash && k1->font == k2->font &&
+           k1->max_w == k2->max_w && k1->letter_space == k2->letter_space && k1->line_space == k2->line_space &&
+           k1->flag == k2->flag;
+}
+
+/**
+ * Break the text to lines and measure them the same way as `lv_txt_get_size()` does,
+ * unless it's already measured with the same parameters.
+ * @param obj       pointer to a label object
+ * @param key       the text and the parameters to measure with
+ * @return          true: `layout_lines` and `layout_size` are valid; false: out of memory
+ */
+static bool layout_measure(lv_obj_t * obj, const lv_label_layout_key_t * key)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+
+    if(layout_key_eq(key, &label->layout_key)) return true;
+    if(key->text == NULL || key->font == NULL) return false;
+
+    label->layout_key.text = NULL;  /*Invalid until it's measured*/
+
+    const char * txt = key->text;
+    lv_coord_t letter_height = lv_font_get_line_height(key->font);
+    lv_point_t size = {0, 0};
+    bool overflow = false;
+
+    /*The lines have `line_cnt + 1` elements, so initially there is space for the old line count*/
+    uint32_t line_cap = label->layout_lines ? label->layout_line_cnt + 1 : 0;
+    uint32_t line_cnt = 0;
+    uint32_t line_start = 0;
+    while(txt[line_start] != '\0') {
+        uint32_t line_end = line_start + _lv_txt_get_next_line(&txt[line_start], key->font, key->letter_space, key->max_w,
+                                                               NULL, key->flag);
+
+        if((unsigned long)size.y + (unsigned long)letter_height + (unsigned long)key->line_space >
+           LV_MAX_OF(lv_coord_t)) {
+            LV_LOG_WARN("integer overflow while calculating text height");
+            overflow = true;
+            break;
+        }
+        size.y += letter_height + key->line_space;
+
+        if(line_cnt + 2 > line_cap) {
+            line_cap = line_cap ? line_cap * 2 : 4;
+            lv_draw_label_line_t * lines = lv_mem_realloc(label->layout_lines, line_cap * sizeof(lv_draw_label_line_t));
+            LV_ASSERT_MALLOC(lines);
+            if(lines == NULL) {
+                layout_free(obj);
+                return false;
+            }
+            label->layout_lines = lines;
+        }
+
+        label->layout_lines[line_cnt].start = line_start;
+        label->layout_lines[line_cnt].w = lv_txt_get_width(&txt[line_start], line_end - line_start, key->font,
+                                                           key->letter_space, key->flag);
+        size.x = LV_MAX(size.x, label->layout_lines[line_cnt].w);
+        line_cnt++;
+        line_start = line_end;
+    }
+
+    if(!overflow) {
+        /*Make the text one line taller if the last character is '\n' or '\r'*/
+        if((line_start != 0) && (txt[line_start - 1] == '\n' || txt[line_start - 1] == '\r')) {
+            size.y += letter_height + key->line_space;
+        }
+
+        /*Correction with the last line space or set the height manually if the text is empty*/
+        if(size.y == 0) size.y = letter_height;
+        else size.y -= key->line_space;
+    }
+
+    /*Shrink to the final size. The last element is the end of the text.*/
+    if(line_cap != line_cnt + 1) {
+        lv_draw_label_line_t * lines = lv_mem_realloc(label->layout_lines, (line_cnt + 1) * sizeof(lv_draw_label_line_t));
+        LV_ASSERT_MALLOC(lines);
+        if(lines == NULL) {
+            layout_free(obj);
+            return false;
+        }
+        label->layout_lines = lines;
+    }
+    label->layout_lines[line_cnt].start = line_start;
+    label->layout_lines[line_cnt].w = 0;
+
+    label->layout_line_cnt = line_cnt;
+    label->layout_size = size;
+    label->layout_key = *key;
+
+    return true;
+}
+
+static void layout_free(lv_obj_t * obj)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+
+    lv_mem_free(label->layout_lines);
+    label->layout_lines = NULL;
+    label->layout_line_cnt = 0;
+    label->layout_key.text = NULL;
+}
+
+/*FNV-1a hash of a text*/
+static uint32_t get_text_hash(const char * txt)
+{
+    uint32_t hash = 2166136261UL;
+    while(*txt != '\0') {
+        hash = (hash ^ (uint8_t)*txt) * 16777619UL;
+        txt++;
+    }
+
+    return hash;
+}
+
+#endif /*LV_LABEL_LAYOUT_CACHE*/
 
 #endif
@@ -50,6 +50,19 @@ enum {
 };
 typedef uint8_t lv_label_long_mode_t;
 
+#if LV_LABEL_LAYOUT_CACHE
+/** The parameters a text was measured with*/
+typedef struct {
+    const char * text;          /**< NULL if nothing is measured*/
+    uint32_t text_hash;         /**< To detect if the text was modified in place*/
+    const lv_font_t * font;
+    lv_coord_t max_w;           /**< `LV_COORD_MAX` if the lines are not wrapped*/
+    lv_coord_t letter_space;
+    lv_coord_t line_space;
+    lv_text_flag_t flag;
+} lv_label_layout_key_t;
+#endif
+
 typedef struct {
     lv_obj_t obj;
     char * text;
@@ -68,6 +81,15 @@ typedef struct {
     uint32_t sel_end;
 #endif
 
+#if LV_LABEL_LAYOUT_CACHE
+    lv_label_layout_key_t layout_key;       /*The text was measured with these parameters*/
+    lv_draw_label_line_t * layout_lines;    /*Start and width of the lines and the end of the text*/
+    uint32_t layout_line_cnt;
+    lv_point_t layout_size;                 /*Size of the measured text*/
+    lv_label_layout_key_t self_size_key;    /*Self size with other parameters than the layout (e.g. content width)*/
+    lv_point_t self_size;
+#endif
+
     lv_point_t offset; /*Text draw position offset*/
     lv_label_long_mode_t long_mode : 3; /*Determine what to do with the long texts*/
     uint8_t static_txt : 1;             /*Flag to indicate the text is static*/
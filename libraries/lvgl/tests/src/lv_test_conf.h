@@ -22,6 +22,15 @@ extern "C" {
 
 #define LV_USE_TINY_TTF 1
 
+/*The DMA2D GPU driver is tested with a host model of the peripheral*/
+#if defined(LV_USE_GPU_STM32_DMA2D) && LV_USE_GPU_STM32_DMA2D
+#define LV_GPU_DMA2D_CMSIS_INCLUDE "lv_test_dma2d.h"
+/*The model has a display driver flush transfer too*/
+#define LV_GPU_DMA2D_SHARED 1
+#define LV_GPU_DMA2D_SHARED_INCLUDE "lv_test_dma2d.h"
+#define LV_GPU_DMA2D_SHARED_WAIT_EXPR lv_test_dma2d_flush_wait()
+#endif
+
 void lv_test_assert_fail(void);
 #define LV_ASSERT_HANDLER lv_test_assert_fail();
 
@@ -0,0 +1,529 @@
+/**
+ * @file lv_test_dma2d.c
+ * Host model of the STM32 DMA2D peripheral.
+ *
+ * It executes the transfers on the host memory like the DMA2D does (pixel format conversion,
+ * alpha modes and the blending formula of the reference manual) and checks how the driver uses it:
+ * - a transfer runs "in the background" until the driver polls `DMA2D_CR_START` again,
+ *   so a missing wait shows up as wrong pixels
+ * - registers modified while a transfer is running are counted
+ * - the lines read and written by a transfer have to be cleaned/invalidated before it starts
+ *   and the written lines have to be invalidated after it's finished
+ * - the transfers of the display driver's flush have to be left to its interrupt handler
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_test_dma2d.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define CM_ARGB8888     0x0
+#define CM_RGB888       0x1
+#define CM_RGB565       0x2
+#define CM_ARGB1555     0x3
+#define CM_ARGB4444     0x4
+#define CM_A8           0x9
+
+#define MODE_M2M                0
+#define MODE_M2M_PFC            1
+#define MODE_M2M_BLEND          2
+#define MODE_R2M                3
+#define MODE_M2M_BLEND_FIXED_FG 4
+#define MODE_M2M_BLEND_FIXED_BG 5
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum {
+    CACHE_CLEAN,
+    CACHE_CLEAN_INVALIDATE,
+    CACHE_INVALIDATE,
+} cache_op_t;
+
+typedef struct {
+    uintptr_t start;
+    uintptr_t end;
+    cache_op_t op;
+} cache_range_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void transfer_begin(void);
+static void transfer_execute(void);
+static bool regs_changed(void);
+static uint32_t cm_px_size(uint32_t cm);
+static uint32_t read_px(uint32_t cm, uintptr_t addr, uint32_t color_reg);
+static void write_px(uint32_t cm, uintptr_t addr, uint32_t argb);
+static uint32_t apply_alpha_mode(uint32_t argb, uint32_t pfccr);
+static uint32_t blend(uint32_t fg, uint32_t bg);
+static void cache_record(cache_op_t op, uintptr_t start, uintptr_t end);
+static bool cache_covered(uintptr_t start, uintptr_t end, bool need_invalidate, uint32_t from);
+static void cache_check_lines(uintptr_t addr, uint32_t px_size, uint32_t offset, uint32_t nlr, bool need_invalidate,
+                              uint32_t from);
+static void cache_check_prev_output(void);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+RCC_TypeDef lv_test_dma2d_rcc;
+SCB_Type lv_test_dma2d_scb = {SCB_CCR_DC_Msk};
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static DMA2D_TypeDef regs;
+static DMA2D_TypeDef regs_started;
+static bool running;
+static lv_test_dma2d_stats_t stats;
+
+/*Cache maintenance recorded since the last transfer was started*/
+static cache_range_t * cache_ranges;
+static uint32_t cache_range_cnt;
+static uint32_t cache_range_size;
+static bool cache_all_cleaned;
+
+/*The output of the last transfer. It has to be invalidated after the transfer (recorded from `prev_output_from`)*/
+static DMA2D_TypeDef prev_output;
+static bool prev_output_valid;
+static uint32_t prev_output_from;
+
+/*The transfer of the display driver's flush which is signaled by the interrupt*/
+static bool flush_busy;
+static bool flush_irq_pending;
+static lv_test_dma2d_flush_cb_t flush_ready_cb;
+static uintptr_t flush_output;
+static uint32_t flush_output_size;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+DMA2D_TypeDef * lv_test_dma2d_regs(void)
+{
+    if(regs.IFCR) {
+        regs.ISR &= ~regs.IFCR;
+        regs.IFCR = 0;
+    }
+
+    if(running) {
+        if(regs_changed()) stats.busy_write_cnt++;
+        transfer_execute();
+    }
+    else if(regs.CR & DMA2D_CR_START) {
+        transfer_begin();
+    }
+
+    return &regs;
+}
+
+const lv_test_dma2d_stats_t * lv_test_dma2d_get_stats(void)
+{
+    cache_check_prev_output();
+    return &stats;
+}
+
+void lv_test_dma2d_reset_stats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void lv_test_dma2d_flush_start(void * dest, const void * src, uint32_t w, uint32_t h, uint32_t px_size,
+                               lv_test_dma2d_flush_cb_t ready_cb)
+{
+    lv_test_dma2d_flush_wait();
+
+    uint32_t cm = px_size == 4 ? CM_ARGB8888 : CM_RGB565;
+    SCB_CleanDCache_by_Addr((uint32_t *)src, w * h * px_size);
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t *)dest, w * h * px_size);
+
+    DMA2D_TypeDef * r = lv_test_dma2d_regs();
+    r->CR = (MODE_M2M << DMA2D_CR_MODE_Pos) | DMA2D_CR_TCIE;
+    r->FGPFCCR = cm;
+    r->FGMAR = (uintptr_t)src;
+    r->FGOR = 0;
+    r->OPFCCR = cm;
+    r->OMAR = (uintptr_t)dest;
+    r->OOR = 0;
+    r->NLR = (w << DMA2D_NLR_PL_Pos) | (h << DMA2D_NLR_NL_Pos);
+    flush_output = (uintptr_t)dest;
+    flush_output_size = w * h * px_size;
+    flush_ready_cb = ready_cb;
+    flush_busy = true;
+    r->CR |= DMA2D_CR_START;
+
+    /*Start it*/
+    lv_test_dma2d_regs();
+}
+
+void lv_test_dma2d_irq(void)
+{
+    if(!flush_irq_pending) return;
+    flush_irq_pending = false;
+
+    /*Like `HAL_DMA2D_IRQHandler()`: only a transfer complete flag with enabled interrupt is reported*/
+    DMA2D_TypeDef * r = lv_test_dma2d_regs();
+    if((r->ISR & DMA2D_ISR_TCIF) && (r->CR & DMA2D_CR_TCIE)) {
+        r->IFCR = DMA2D_ISR_TCIF;
+        r->CR &= ~DMA2D_CR_TCIE;
+    }
+    else {
+        /*On the target the flush would never be ready*/
+        stats.lost_irq_cnt++;
+    }
+
+    SCB_InvalidateDCache_by_Addr((uint32_t *)flush_output, flush_output_size);
+
+    flush_busy = false;
+    if(flush_ready_cb) flush_ready_cb();
+}
+
+void lv_test_dma2d_flush_wait(void)
+{
+    while(flush_busy) {
+        /*The interrupt is taken while waiting*/
+        lv_test_dma2d_regs();
+        lv_test_dma2d_irq();
+    }
+}
+
+void SCB_CleanDCache(void)
+{
+    cache_all_cleaned = true;
+}
+
+void SCB_CleanInvalidateDCache(void)
+{
+    /*Everything is written back and dropped: it covers any range*/
+    cache_record(CACHE_CLEAN_INVALIDATE, 0, UINTPTR_MAX);
+}
+
+void SCB_CleanDCache_by_Addr(uint32_t * addr, int32_t dsize)
+{
+    cache_record(CACHE_CLEAN, (uintptr_t)addr, (uintptr_t)addr + dsize);
+}
+
+void SCB_CleanInvalidateDCache_by_Addr(uint32_t * addr, int32_t dsize)
+{
+    cache_record(CACHE_CLEAN_INVALIDATE, (uintptr_t)addr, (uintptr_t)addr + dsize);
+}
+
+void SCB_InvalidateDCache_by_Addr(uint32_t * addr, int32_t dsize)
+{
+    cache_record(CACHE_INVALIDATE, (uintptr_t)addr, (uintptr_t)addr + dsize);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void transfer_begin(void)
+{
+    uint32_t mode = (regs.CR & DMA2D_CR_MODE_Msk) >> DMA2D_CR_MODE_Pos;
+    uint32_t fg_cm = regs.FGPFCCR & DMA2D_FGPFCCR_CM_Msk;
+    uint32_t bg_cm = regs.BGPFCCR & DMA2D_BGPFCCR_CM_Msk;
+    uint32_t out_cm = regs.OPFCCR & DMA2D_OPFCCR_CM_Msk;
+    uint32_t pl = (regs.NLR & DMA2D_NLR_PL_Msk) >> DMA2D_NLR_PL_Pos;
+    uint32_t nl = (regs.NLR & DMA2D_NLR_NL_Msk) >> DMA2D_NLR_NL_Pos;
+
+    bool fg_fetch = mode == MODE_M2M || mode == MODE_M2M_PFC || mode == MODE_M2M_BLEND || mode == MODE_M2M_BLEND_FIXED_BG;
+    bool bg_fetch = mode == MODE_M2M_BLEND || mode == MODE_M2M_BLEND_FIXED_FG;
+
+    bool err = false;
+    if(mode > MODE_M2M_BLEND_FIXED_BG || pl == 0 || nl == 0 || regs.OMAR == 0) err = true;
+    if(out_cm > CM_ARGB4444) err = true;
+    if(fg_fetch && (cm_px_size(fg_cm) == 0 || regs.FGMAR == 0)) err = true;
+    if(bg_fetch && (cm_px_size(bg_cm) == 0 || regs.BGMAR == 0)) err = true;
+    /*No pixel format conversion in memory-to-memory mode*/
+    if(mode == MODE_M2M && cm_px_size(fg_cm) != cm_px_size(out_cm)) err = true;
+
+    if(err) {
+        stats.config_err_cnt++;
+        regs.CR &= ~DMA2D_CR_START;
+        regs.ISR |= DMA2D_ISR_CEIF;
+        return;
+    }
+
+    cache_check_prev_output();
+
+    /*The FG pixels are not used in A8 format if their alpha is replaced*/
+    bool fg_used = !(fg_cm == CM_A8 && ((regs.FGPFCCR >> DMA2D_FGPFCCR_AM_Pos) & 0x3) == 1);
+    if(fg_fetch && fg_used) cache_check_lines(regs.FGMAR, cm_px_size(fg_cm), regs.FGOR, regs.NLR, false, 0);
+    if(bg_fetch) cache_check_lines(regs.BGMAR, cm_px_size(bg_cm), regs.BGOR, regs.NLR, false, 0);
+    cache_check_lines(regs.OMAR, cm_px_size(out_cm), regs.OOR, regs.NLR, true, 0);
+
+    cache_range_cnt = 0;
+    cache_all_cleaned = false;
+
+    regs_started = regs;
+    running = true;
+}
+
+static void transfer_execute(void)
+{
+    uint32_t mode = (regs_started.CR & DMA2D_CR_MODE_Msk) >> DMA2D_CR_MODE_Pos;
+    uint32_t fg_cm = regs_started.FGPFCCR & DMA2D_FGPFCCR_CM_Msk;
+    uint32_t bg_cm = regs_started.BGPFCCR & DMA2D_BGPFCCR_CM_Msk;
+    uint32_t out_cm = regs_started.OPFCCR & DMA2D_OPFCCR_CM_Msk;
+    uint32_t pl = (regs_started.NLR & DMA2D_NLR_PL_Msk) >> DMA2D_NLR_PL_Pos;
+    uint32_t nl = (regs_started.NLR & DMA2D_NLR_NL_Msk) >> DMA2D_NLR_NL_Pos;
+    uint32_t fg_px_size = cm_px_size(fg_cm);
+    uint32_t bg_px_size = cm_px_size(bg_cm);
+    uint32_t out_px_size = cm_px_size(out_cm);
+
+    uint32_t y;
+    for(y = 0; y < nl; y++) {
+        uintptr_t fg_line = regs_started.FGMAR + y * (pl + regs_started.FGOR) * fg_px_size;
+        uintptr_t bg_line = regs_started.BGMAR + y * (pl + regs_started.BGOR) * bg_px_size;
+        uintptr_t out_line = regs_started.OMAR + y * (pl + regs_started.OOR) * out_px_size;
+        uint32_t x;
+        for(x = 0; x < pl; x++) {
+            uintptr_t out = out_line + x * out_px_size;
+            if(mode == MODE_R2M) {
+                if(out_px_size == 4) memcpy((void *)out, (const void *)&regs_started.OCOLR, 4);
+                else if(out_px_size == 3) memcpy((void *)out, (const void *)&regs_started.OCOLR, 3);
+                else {
+                    uint16_t c16 = (uint16_t)regs_started.OCOLR;
+                    memcpy((void *)out, &c16, 2);
+                }
+                continue;
+            }
+
+            if(mode == MODE_M2M) {
+                memcpy((void *)out, (const void *)(fg_line + x * fg_px_size), out_px_size);
+                continue;
+            }
+
+            uint32_t fg;
+            if(mode == MODE_M2M_BLEND_FIXED_FG) fg = 0xFF000000 | (regs_started.FGCOLR & 0xFFFFFF);
+            else fg = read_px(fg_cm, fg_line + x * fg_px_size, regs_started.FGCOLR);
+            fg = apply_alpha_mode(fg, regs_started.FGPFCCR);
+
+            if(mode == MODE_M2M_PFC) {
+                write_px(out_cm, out, fg);
+                continue;
+            }
+
+            uint32_t bg;
+            if(mode == MODE_M2M_BLEND_FIXED_BG) bg = 0xFF000000 | (regs_started.BGCOLR & 0xFFFFFF);
+            else bg = read_px(bg_cm, bg_line + x * bg_px_size, regs_started.BGCOLR);
+            bg = apply_alpha_mode(bg, regs_started.BGPFCCR);
+
+            write_px(out_cm, out, blend(fg, bg));
+        }
+    }
+
+    stats.transfer_cnt++;
+    stats.mode_cnt[mode]++;
+    stats.px_cnt += pl * nl;
+
+    regs.CR &= ~DMA2D_CR_START;
+    regs.ISR |= DMA2D_ISR_TCIF;
+    running = false;
+    if(regs_started.CR & DMA2D_CR_TCIE) flush_irq_pending = true;
+
+    prev_output = regs_started;
+    prev_output_valid = true;
+    prev_output_from = cache_range_cnt;
+}
+
+/*The status registers (ISR, IFCR) are not compared, they are modified by the transfer itself*/
+static bool regs_changed(void)
+{
+    const DMA2D_TypeDef * a = &regs;
+    const DMA2D_TypeDef * s = &regs_started;
+    return a->CR != s->CR || a->FGMAR != s->FGMAR || a->FGOR != s->FGOR || a->BGMAR != s->BGMAR ||
+           a->BGOR != s->BGOR || a->FGPFCCR != s->FGPFCCR || a->FGCOLR != s->FGCOLR || a->BGPFCCR != s->BGPFCCR ||
+           a->BGCOLR != s->BGCOLR || a->OPFCCR != s->OPFCCR || a->OCOLR != s->OCOLR || a->OMAR != s->OMAR ||
+           a->OOR != s->OOR || a->NLR != s->NLR;
+}
+
+static uint32_t cm_px_size(uint32_t cm)
+{
+    switch(cm) {
+        case CM_ARGB8888:
+            return 4;
+        case CM_RGB888:
+            return 3;
+        case CM_RGB565:
+        case CM_ARGB1555:
+        case CM_ARGB4444:
+            return 2;
+        case CM_A8:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+/*Convert a pixel to ARGB8888. The expansion of the shorter channels copies the MSBs into the LSBs.*/
+static uint32_t read_px(uint32_t cm, uintptr_t addr, uint32_t color_reg)
+{
+    const uint8_t * p = (const uint8_t *)addr;
+    uint32_t a = 0xFF, r, g, b;
+    uint16_t c16 = 0;
+    if(cm_px_size(cm) == 2) c16 = (uint16_t)(p[0] | (p[1] << 8));
+
+    switch(cm) {
+        case CM_ARGB8888:
+            return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+        case CM_RGB888:
+            return 0xFF000000 | p[0] | (p[1] << 8) | (p[2] << 16);
+        case CM_RGB565:
+            r = (c16 >> 11) & 0x1F;
+            g = (c16 >> 5) & 0x3F;
+            b = c16 & 0x1F;
+            r = (r << 3) | (r >> 2);
+            g = (g << 2) | (g >> 4);
+            b = (b << 3) | (b >> 2);
+            break;
+        case CM_ARGB1555:
+            a = (c16 & 0x8000) ? 0xFF : 0;
+            r = (c16 >> 10) & 0x1F;
+            g = (c16 >> 5) & 0x1F;
+            b = c16 & 0x1F;
+            r = (r << 3) | (r >> 2);
+            g = (g << 3) | (g >> 2);
+            b = (b << 3) | (b >> 2);
+            break;
+        case CM_ARGB4444:
+            a = ((c16 >> 12) & 0xF) * 0x11;
+            r = ((c16 >> 8) & 0xF) * 0x11;
+            g = ((c16 >> 4) & 0xF) * 0x11;
+            b = (c16 & 0xF) * 0x11;
+            break;
+        case CM_A8:
+            return ((uint32_t)p[0] << 24) | (color_reg & 0xFFFFFF);
+        default:
+            return 0;
+    }
+
+    return (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+/*Convert an ARGB8888 pixel to the output format by dropping the LSBs*/
+static void write_px(uint32_t cm, uintptr_t addr, uint32_t argb)
+{
+    uint8_t * p = (uint8_t *)addr;
+    uint32_t a = argb >> 24;
+    uint32_t r = (argb >> 16) & 0xFF;
+    uint32_t g = (argb >> 8) & 0xFF;
+    uint32_t b = argb & 0xFF;
+    uint16_t c16;
+
+    switch(cm) {
+        case CM_ARGB8888:
+            memcpy(p, &argb, 4);
+            return;
+        case CM_RGB888:
+            memcpy(p, &argb, 3);
+            return;
+        case CM_RGB565:
+            c16 = (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+            break;
+        case CM_ARGB1555:
+            c16 = (uint16_t)(((a >> 7) << 15) | ((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3));
+            break;
+        case CM_ARGB4444:
+            c16 = (uint16_t)(((a >> 4) << 12) | ((r >> 4) << 8) | ((g >> 4) << 4) | (b >> 4));
+            break;
+        default:
+            return;
+    }
+
+    memcpy(p, &c16, 2);
+}
+
+static uint32_t apply_alpha_mode(uint32_t argb, uint32_t pfccr)
+{
+    uint32_t am = (pfccr >> DMA2D_FGPFCCR_AM_Pos) & 0x3;
+    uint32_t alpha = pfccr >> DMA2D_FGPFCCR_ALPHA_Pos;
+    uint32_t a = argb >> 24;
+
+    if(am == 1) a = alpha;
+    else if(am == 2) a = a * alpha / 255;
+
+    return (a << 24) | (argb & 0xFFFFFF);
+}
+
+/*The blending formula of the reference manual*/
+static uint32_t blend(uint32_t fg, uint32_t bg)
+{
+    uint32_t a_fg = fg >> 24;
+    uint32_t a_bg = bg >> 24;
+    uint32_t a_mult = a_fg * a_bg / 255;
+    uint32_t a_out = a_fg + a_bg - a_mult;
+    if(a_out == 0) return 0;
+
+    uint32_t res = a_out << 24;
+    uint32_t shift;
+    for(shift = 0; shift < 24; shift += 8) {
+        uint32_t c_fg = (fg >> shift) & 0xFF;
+        uint32_t c_bg = (bg >> shift) & 0xFF;
+        uint32_t c = (c_fg * a_fg + c_bg * a_bg - c_bg * a_mult) / a_out;
+        res |= c << shift;
+    }
+
+    return res;
+}
+
+static void cache_record(cache_op_t op, uintptr_t start, uintptr_t end)
+{
+    if(cache_range_cnt == cache_range_size) {
+        cache_range_size = cache_range_size ? cache_range_size * 2 : 256;
+        cache_ranges = realloc(cache_ranges, cache_range_size * sizeof(cache_range_t));
+    }
+
+    cache_ranges[cache_range_cnt].start = start;
+    cache_ranges[cache_range_cnt].end = end;
+    cache_ranges[cache_range_cnt].op = op;
+    cache_range_cnt++;
+}
+
+static bool cache_covered(uintptr_t start, uintptr_t end, bool need_invalidate, uint32_t from)
+{
+    if(!need_invalidate && cache_all_cleaned) return true;
+
+    uint32_t i;
+    for(i = from; i < cache_range_cnt; i++) {
+        const cache_range_t * r = &cache_ranges[i];
+        if(r->start > start || r->end < end) continue;
+        if(need_invalidate && r->op == CACHE_CLEAN) continue;
+        if(!need_invalidate && r->op == CACHE_INVALIDATE) continue;
+        return true;
+    }
+
+    return false;
+}
+
+/*Check the lines of an area of a transfer*/
+static void cache_check_lines(uintptr_t addr, uint32_t px_size, uint32_t offset, uint32_t nlr, bool need_invalidate,
+                              uint32_t from)
+{
+    uint32_t pl = (nlr & DMA2D_NLR_PL_Msk) >> DMA2D_NLR_PL_Pos;
+    uint32_t nl = (nlr & DMA2D_NLR_NL_Msk) >> DMA2D_NLR_NL_Pos;
+    uint32_t y;
+    for(y = 0; y < nl; y++) {
+        uintptr_t start = addr + y * (pl + offset) * px_size;
+        if(!cache_covered(start, start + pl * px_size, need_invalidate, from)) {
+            stats.cache_err_cnt++;
+            return;
+        }
+    }
+}
+
+/*The CPU may have loaded lines of the output while the last transfer was running, they have to be invalidated*/
+static void cache_check_prev_output(void)
+{
+    if(!prev_output_valid || running) return;
+    prev_output_valid = false;
+
+    /*Only the maintenance after the transfer counts*/
+    uint32_t out_px_size = cm_px_size(prev_output.OPFCCR & DMA2D_OPFCCR_CM_Msk);
+    cache_check_lines(prev_output.OMAR, out_px_size, prev_output.OOR, prev_output.NLR, true, prev_output_from);
+}
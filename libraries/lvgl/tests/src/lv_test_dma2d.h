@@ -0,0 +1,151 @@
+/**
+ * @file lv_test_dma2d.h
+ * Host model of the STM32 DMA2D peripheral and the Cortex-M7 D-cache maintenance functions.
+ * Used as `LV_GPU_DMA2D_CMSIS_INCLUDE` by the `OPTIONS_TEST_DMA2D` build.
+ */
+
+#ifndef LV_TEST_DMA2D_H
+#define LV_TEST_DMA2D_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef STM32H7
+#define STM32H7
+#endif
+
+#define __DCACHE_PRESENT            1U
+#define __IO                        volatile
+
+#define __DSB()
+#define __ISB()
+
+#define RCC_AHB3ENR_DMA2DEN         (1UL << 4)
+
+#define SCB_CCR_DC_Msk              (1UL << 16)
+
+#define DMA2D_CR_START              (1UL << 0)
+#define DMA2D_CR_TCIE               (1UL << 9)
+#define DMA2D_CR_MODE_Pos           16
+#define DMA2D_CR_MODE_Msk           (0x7UL << DMA2D_CR_MODE_Pos)
+#define DMA2D_CR_MODE_2             (0x4UL << DMA2D_CR_MODE_Pos)
+
+#define DMA2D_ISR_TEIF              (1UL << 0)
+#define DMA2D_ISR_TCIF              (1UL << 1)
+#define DMA2D_ISR_CEIF              (1UL << 5)
+
+#define DMA2D_FGPFCCR_CM_Msk        0xFUL
+#define DMA2D_FGPFCCR_AM_Pos        16
+#define DMA2D_FGPFCCR_ALPHA_Pos     24
+#define DMA2D_BGPFCCR_CM_Msk        0xFUL
+#define DMA2D_BGPFCCR_AM_Pos        16
+#define DMA2D_BGPFCCR_ALPHA_Pos     24
+#define DMA2D_OPFCCR_CM_Msk         0x7UL
+
+#define DMA2D_NLR_NL_Pos            0
+#define DMA2D_NLR_NL_Msk            (0xFFFFUL << DMA2D_NLR_NL_Pos)
+#define DMA2D_NLR_PL_Pos            16
+#define DMA2D_NLR_PL_Msk            (0x3FFFUL << DMA2D_NLR_PL_Pos)
+
+/*The address registers are 32 bit on the target, here they have to hold host pointers*/
+typedef struct {
+    __IO uint32_t CR;
+    __IO uint32_t ISR;
+    __IO uint32_t IFCR;
+    __IO uintptr_t FGMAR;
+    __IO uint32_t FGOR;
+    __IO uintptr_t BGMAR;
+    __IO uint32_t BGOR;
+    __IO uint32_t FGPFCCR;
+    __IO uint32_t FGCOLR;
+    __IO uint32_t BGPFCCR;
+    __IO uint32_t BGCOLR;
+    __IO uint32_t OPFCCR;
+    __IO uint32_t OCOLR;
+    __IO uintptr_t OMAR;
+    __IO uint32_t OOR;
+    __IO uint32_t NLR;
+    __IO uint32_t AMTCR;
+} DMA2D_TypeDef;
+
+typedef struct {
+    __IO uint32_t AHB3ENR;
+} RCC_TypeDef;
+
+typedef struct {
+    __IO uint32_t CCR;
+} SCB_Type;
+
+/*Every access of `DMA2D` lets the model advance: a started transfer is executed on the second access after
+ *setting `DMA2D_CR_START`. Until then `DMA2D_CR_START` reads as set, like on the hardware.*/
+#define DMA2D           (lv_test_dma2d_regs())
+#define RCC             (&lv_test_dma2d_rcc)
+#define SCB             (&lv_test_dma2d_scb)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint32_t transfer_cnt;      /**< Executed transfers*/
+    uint32_t mode_cnt[6];       /**< Executed transfers per `DMA2D_CR_MODE` value*/
+    uint32_t px_cnt;            /**< Written pixels*/
+    uint32_t config_err_cnt;    /**< Transfers rejected because of invalid settings*/
+    uint32_t busy_write_cnt;    /**< Registers modified while a transfer was running*/
+    uint32_t cache_err_cnt;     /**< Lines read or written by a transfer without the required cache maintenance*/
+    uint32_t lost_irq_cnt;      /**< Interrupts which found their TC flag or TCIE bit cleared by someone else*/
+} lv_test_dma2d_stats_t;
+
+typedef void (*lv_test_dma2d_flush_cb_t)(void);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+extern RCC_TypeDef lv_test_dma2d_rcc;
+extern SCB_Type lv_test_dma2d_scb;
+
+DMA2D_TypeDef * lv_test_dma2d_regs(void);
+
+const lv_test_dma2d_stats_t * lv_test_dma2d_get_stats(void);
+
+void lv_test_dma2d_reset_stats(void);
+
+/*A transfer of the display driver like `dsi_lcdDrawImageAsync()`: it copies `src` to `dest` and its end is signaled
+ *by the DMA2D interrupt which calls `ready_cb`. The interrupt is handled only in `lv_test_dma2d_irq()`
+ *and `lv_test_dma2d_flush_wait()`, as if it were delayed by higher priority code.*/
+void lv_test_dma2d_flush_start(void * dest, const void * src, uint32_t w, uint32_t h, uint32_t px_size,
+                               lv_test_dma2d_flush_cb_t ready_cb);
+
+/*Run the interrupt handler of the DMA2D if the flush transfer is finished*/
+void lv_test_dma2d_irq(void);
+
+/*Wait until the interrupt of the flush transfer is handled, like `dsi_waitTransfer()`*/
+void lv_test_dma2d_flush_wait(void);
+
+/*Cache maintenance. They only record the maintained address ranges to check the cache policy of the transfers.*/
+void SCB_CleanDCache(void);
+void SCB_CleanInvalidateDCache(void);
+void SCB_CleanDCache_by_Addr(uint32_t * addr, int32_t dsize);
+void SCB_CleanInvalidateDCache_by_Addr(uint32_t * addr, int32_t dsize);
+void SCB_InvalidateDCache_by_Addr(uint32_t * addr, int32_t dsize);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_TEST_DMA2D_H*/
@@ -1,6 +1,8 @@
 #ifndef LV_TEST_HELPERS_H
 #define LV_TEST_HELPERS_H
 
+#include <time.h>
+
 #ifdef LVGL_CI_USING_SYS_HEAP
 /* Skip checking heap as we don't have the info available */
 #define LV_HEAP_CHECK(x) do {} while(0)
@@ -17,6 +19,14 @@ static inline uint32_t lv_test_get_free_mem(void)
 }
 #endif /* LVGL_CI_USING_SYS_HEAP */
 
+/* Monotonic time in microseconds for the benchmarks */
+static inline uint32_t lv_test_get_time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
 
 #endif /*LV_TEST_HELPERS_H*/
 
@@ -0,0 +1,279 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+/*Emulates a display driver whose flush_cb only starts a DMA transfer and signals
+ *`lv_disp_flush_ready()` later from the "transfer complete interrupt".
+ *The transfer completes when LVGL waits for it in `wait_cb`, so the result is wrong
+ *if LVGL touches a buffer which is still being transferred.
+ *A virtual clock models rendering and DMA as running in parallel to compare the frame times.*/
+
+#define EMU_HOR_RES         240
+#define EMU_VER_RES         160
+#define EMU_PART_SIZE       (EMU_HOR_RES * EMU_VER_RES / 10)
+
+#define RENDER_COST_PER_PX  1
+#define DMA_COST_PER_PX     1
+
+typedef enum {
+    EMU_MODE_REFERENCE,     /*Full sized buffer, synchronous flush*/
+    EMU_MODE_PARTIAL,       /*One partial buffer*/
+    EMU_MODE_DOUBLE_PARTIAL,/*Two partial buffers*/
+    EMU_MODE_DIRECT,        /*Two full sized buffers in direct mode, "swapped" on the last flush*/
+} emu_mode_t;
+
+typedef struct {
+    lv_disp_drv_t drv;
+    lv_disp_draw_buf_t draw_buf;
+    lv_disp_t * disp;
+    emu_mode_t mode;
+
+    /*The transfer in progress*/
+    bool pending;
+    bool pending_swap;
+    lv_area_t pending_area;
+    const lv_color_t * pending_src;
+
+    /*Virtual clock*/
+    uint32_t cpu_time;
+    uint32_t dma_end;
+    bool render_accounted;
+
+    uint32_t flush_cnt;
+    uint32_t overlap_cnt;
+    uint32_t stall_cnt;
+} emu_disp_t;
+
+static lv_color_t buf_a[EMU_HOR_RES * EMU_VER_RES];
+static lv_color_t buf_b[EMU_HOR_RES * EMU_VER_RES];
+static lv_color_t ref_fb[EMU_HOR_RES * EMU_VER_RES];
+static lv_color_t emu_fb[EMU_HOR_RES * EMU_VER_RES];
+static emu_disp_t emu;
+
+static void copy_area(lv_color_t * fb, const lv_area_t * area, const lv_color_t * src, lv_coord_t src_stride)
+{
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(&fb[y * EMU_HOR_RES + area->x1], src, w * sizeof(lv_color_t));
+        src += src_stride;
+    }
+}
+
+/*The "transfer complete interrupt"*/
+static void emu_complete(emu_disp_t * e)
+{
+    if(!e->pending) return;
+
+    if(e->pending_swap) lv_memcpy(emu_fb, e->pending_src, sizeof(emu_fb));
+    else copy_area(emu_fb, &e->pending_area, e->pending_src, lv_area_get_width(&e->pending_area));
+
+    e->pending = false;
+    if(e->dma_end > e->cpu_time) e->cpu_time = e->dma_end;
+    lv_disp_flush_ready(&e->drv);
+}
+
+static void emu_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    emu_disp_t * e = (emu_disp_t *)drv;    /*`drv` is the first member*/
+
+    /*There is only one DMA channel: LVGL has to wait for the previous transfer*/
+    TEST_ASSERT_FALSE(e->pending);
+
+    uint32_t px = lv_area_get_size(area);
+    if(!e->render_accounted) e->cpu_time += px * RENDER_COST_PER_PX;
+    e->render_accounted = false;
+    e->flush_cnt++;
+
+    if(e->mode == EMU_MODE_REFERENCE) {
+        copy_area(ref_fb, area, color_p, lv_area_get_width(area));
+        lv_disp_flush_ready(drv);
+        return;
+    }
+
+    if(e->mode == EMU_MODE_DIRECT) {
+        /*The areas are already in the buffer, show it after the last one*/
+        if(!lv_disp_flush_is_last(drv)) {
+            lv_disp_flush_ready(drv);
+            return;
+        }
+        e->pending_swap = true;
+    }
+    else {
+        e->pending_swap = false;
+    }
+
+    e->pending = true;
+    e->pending_area = *area;
+    e->pending_src = color_p;
+    e->dma_end = e->cpu_time + px * DMA_COST_PER_PX;
+}
+
+static void emu_wait_cb(lv_disp_drv_t * drv)
+{
+    emu_disp_t * e = (emu_disp_t *)drv;    /*`drv` is the first member*/
+    if(!e->pending) return;
+
+    /*If LVGL waits with an other buffer than the one in transfer,
+     *the part in that buffer was rendered while the DMA was working*/
+    if(drv->draw_buf->buf_act != e->pending_src) {
+        e->overlap_cnt++;
+        e->cpu_time += lv_area_get_size(drv->draw_ctx->buf_area) * RENDER_COST_PER_PX;
+        e->render_accounted = true;
+    }
+    else {
+        e->stall_cnt++;
+    }
+
+    emu_complete(e);
+}
+
+static void emu_create(emu_disp_t * e, emu_mode_t mode)
+{
+    lv_memset_00(e, sizeof(emu_disp_t));
+    e->mode = mode;
+
+    switch(mode) {
+        case EMU_MODE_REFERENCE:
+            lv_disp_draw_buf_init(&e->draw_buf, buf_a, NULL, EMU_HOR_RES * EMU_VER_RES);
+            break;
+        case EMU_MODE_PARTIAL:
+            lv_disp_draw_buf_init(&e->draw_buf, buf_a, NULL, EMU_PART_SIZE);
+            break;
+        case EMU_MODE_DOUBLE_PARTIAL:
+            lv_disp_draw_buf_init(&e->draw_buf, buf_a, buf_b, EMU_PART_SIZE);
+            break;
+        case EMU_MODE_DIRECT:
+            lv_disp_draw_buf_init(&e->draw_buf, buf_a, buf_b, EMU_HOR_RES * EMU_VER_RES);
+            break;
+    }
+
+    lv_disp_drv_init(&e->drv);
+    e->drv.draw_buf = &e->draw_buf;
+    e->drv.flush_cb = emu_flush_cb;
+    e->drv.wait_cb = emu_wait_cb;
+    e->drv.hor_res = EMU_HOR_RES;
+    e->drv.ver_res = EMU_VER_RES;
+    e->drv.direct_mode = mode == EMU_MODE_DIRECT ? 1 : 0;
+    e->disp = lv_disp_drv_register(&e->drv);
+}
+
+static void emu_delete(emu_disp_t * e)
+{
+    emu_complete(e);
+    lv_disp_remove(e->disp);
+
+    /*`lv_disp_remove()` leaves the draw context to the driver*/
+    e->drv.draw_ctx_deinit(&e->drv, e->drv.draw_ctx);
+    lv_mem_free(e->drv.draw_ctx);
+}
+
+/*Refresh and let the last transfer finish. Return the virtual frame time.*/
+static uint32_t emu_refresh(emu_disp_t * e)
+{
+    e->cpu_time = 0;
+    e->dma_end = 0;
+    lv_refr_now(e->disp);
+    emu_complete(e);
+    return e->cpu_time;
+}
+
+static lv_obj_t * create_ui(lv_disp_t * disp)
+{
+    lv_obj_t * scr = lv_disp_get_scr_act(disp);
+    lv_obj_set_style_bg_color(scr, lv_palette_lighten(LV_PALETTE_GREY, 3), 0);
+
+    lv_obj_t * obj = lv_obj_create(scr);
+    lv_obj_set_size(obj, 120, 80);
+    lv_obj_set_pos(obj, 10, 10);
+    lv_obj_set_style_bg_grad_color(obj, lv_palette_main(LV_PALETTE_BLUE), 0);
+    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, 0);
+
+    lv_obj_t * label = lv_label_create(scr);
+    lv_label_set_text(label, "Async flush");
+    lv_obj_align(label, LV_ALIGN_BOTTOM_RIGHT, -10, -10);
+
+    return obj;
+}
+
+/*Render the UI, change it and render again. Return the virtual time of the first frame.*/
+static uint32_t render_frames(emu_disp_t * e)
+{
+    lv_obj_t * obj = create_ui(e->disp);
+    uint32_t t = emu_refresh(e);
+
+    lv_obj_set_pos(obj, 100, 60);
+    emu_refresh(e);
+
+    return t;
+}
+
+static void render_reference(void)
+{
+    emu_disp_t ref;
+    emu_create(&ref, EMU_MODE_REFERENCE);
+    render_frames(&ref);
+    emu_delete(&ref);
+}
+
+void setUp(void)
+{
+    lv_memset_00(ref_fb, sizeof(ref_fb));
+    lv_memset_00(emu_fb, sizeof(emu_fb));
+}
+
+void tearDown(void)
+{
+}
+
+void test_async_flush_partial_should_stall_on_every_part(void)
+{
+    render_reference();
+
+    emu_create(&emu, EMU_MODE_PARTIAL);
+    render_frames(&emu);
+    emu_delete(&emu);
+
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, emu_fb, sizeof(ref_fb));
+    TEST_ASSERT_GREATER_THAN_UINT32(2, emu.flush_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, emu.overlap_cnt);
+}
+
+void test_async_flush_double_partial_should_overlap_rendering(void)
+{
+    render_reference();
+
+    emu_create(&emu, EMU_MODE_PARTIAL);
+    uint32_t t_single = render_frames(&emu);
+    emu_delete(&emu);
+
+    emu_create(&emu, EMU_MODE_DOUBLE_PARTIAL);
+    uint32_t t_double = render_frames(&emu);
+    emu_delete(&emu);
+
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, emu_fb, sizeof(ref_fb));
+    TEST_ASSERT_GREATER_THAN_UINT32(0, emu.overlap_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, emu.stall_cnt);
+
+    /*A full screen redraw: rendering and DMA cost the same, so overlapping should save ~half of the time
+     *and it can't be faster than rendering alone*/
+    uint32_t render_time = EMU_HOR_RES * EMU_VER_RES * RENDER_COST_PER_PX;
+    TEST_ASSERT_LESS_THAN_UINT32(t_single, t_double);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(render_time + EMU_PART_SIZE * DMA_COST_PER_PX, t_double);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(render_time, t_double);
+}
+
+void test_async_flush_direct_mode_should_match_reference(void)
+{
+    render_reference();
+
+    emu_create(&emu, EMU_MODE_DIRECT);
+    render_frames(&emu);
+    emu_delete(&emu);
+
+    /*The second frame has to sync the areas of the first one between the two buffers*/
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, emu_fb, sizeof(ref_fb));
+}
+
+#endif
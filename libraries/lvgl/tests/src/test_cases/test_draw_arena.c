@@ -0,0 +1,251 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_DRAW_ARENA_SIZE
+
+#include "lv_test_helpers.h"
+
+#define PANEL_CNT       12
+#define BENCH_LOOPS     20
+#define BENCH_ALLOC_CNT 10000
+
+static lv_obj_t * active_screen = NULL;
+static bool full_layer;
+
+/*Draw the object into a layer the way the widgets with opacity or transformation are drawn*/
+static void draw_layer_event_cb(lv_event_t * e)
+{
+    lv_obj_t * obj = lv_event_get_target(e);
+    lv_draw_ctx_t * draw_ctx = lv_event_get_draw_ctx(e);
+    lv_draw_layer_flags_t flags = full_layer ? 0 : LV_DRAW_LAYER_FLAG_CAN_SUBDIVIDE;
+    lv_draw_layer_ctx_t * layer_ctx = lv_draw_layer_create(draw_ctx, &obj->coords, flags);
+    TEST_ASSERT_NOT_NULL(layer_ctx);
+    lv_draw_layer_destroy(draw_ctx, layer_ctx);
+}
+
+/*Panels with labels, each drawing a layer*/
+static void create_panels(void)
+{
+    uint32_t i;
+    for(i = 0; i < PANEL_CNT; i++) {
+        lv_obj_t * panel = lv_obj_create(active_screen);
+        lv_obj_set_size(panel, 160, 100);
+        lv_obj_set_pos(panel, 20 + (i % 4) * 190, 20 + (i / 4) * 150);
+        lv_obj_add_event_cb(panel, draw_layer_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+        lv_obj_t * label = lv_label_create(panel);
+        lv_label_set_text_fmt(label, "Panel %d", (int)i);
+        lv_obj_center(label);
+    }
+}
+
+void setUp(void)
+{
+    active_screen = lv_scr_act();
+    full_layer = false;
+    lv_draw_arena_reset_stats();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+}
+
+void test_draw_arena_should_be_used_only_while_refreshing(void)
+{
+    TEST_ASSERT_NULL(_lv_draw_arena_get(16));
+
+    /*Falls back to the heap*/
+    void * p = _lv_draw_arena_alloc(16);
+    TEST_ASSERT_NOT_NULL(p);
+    TEST_ASSERT_FALSE(_lv_draw_arena_is_in(p));
+    _lv_draw_arena_free(p);
+
+    _lv_draw_arena_begin();
+    p = _lv_draw_arena_alloc(16);
+    TEST_ASSERT_TRUE(_lv_draw_arena_is_in(p));
+    _lv_draw_arena_free(p);
+    _lv_draw_arena_end();
+
+    lv_draw_arena_stats_t stats;
+    lv_draw_arena_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.frame_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.last.alloc_cnt);
+    TEST_ASSERT_EQUAL_UINT32(16, stats.last.alloc_size);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.last.fallback_cnt);
+}
+
+void test_draw_arena_should_reuse_the_released_end(void)
+{
+    _lv_draw_arena_begin();
+
+    uint8_t * a = _lv_draw_arena_get(100);
+    uint8_t * b = _lv_draw_arena_get(50);
+    TEST_ASSERT_NOT_NULL(a);
+    TEST_ASSERT_TRUE(b > a);
+    TEST_ASSERT_EQUAL(0, (lv_uintptr_t)a % 8);
+    TEST_ASSERT_EQUAL(0, (lv_uintptr_t)b % 8);
+
+    /*The last one can be reused*/
+    _lv_draw_arena_release(b);
+    TEST_ASSERT_EQUAL_PTR(b, _lv_draw_arena_get(50));
+
+    /*Not the last one: it's reused only when the ones after it are released too*/
+    _lv_draw_arena_release(a);
+    uint8_t * c = _lv_draw_arena_get(20);
+    TEST_ASSERT_TRUE(c > b);
+    _lv_draw_arena_release(c);
+    _lv_draw_arena_release(b);
+    TEST_ASSERT_EQUAL_PTR(a, _lv_draw_arena_get(20));
+
+    _lv_draw_arena_end();
+
+    /*Everything is given back at the end*/
+    _lv_draw_arena_begin();
+    TEST_ASSERT_EQUAL_PTR(a, _lv_draw_arena_get(LV_DRAW_ARENA_SIZE / 2));
+    _lv_draw_arena_end();
+}
+
+void test_draw_arena_should_fall_back_when_full(void)
+{
+    _lv_draw_arena_begin();
+
+    TEST_ASSERT_NULL(_lv_draw_arena_get(LV_DRAW_ARENA_SIZE));
+    void * p = _lv_draw_arena_alloc(LV_DRAW_ARENA_SIZE);
+    TEST_ASSERT_NOT_NULL(p);
+    TEST_ASSERT_FALSE(_lv_draw_arena_is_in(p));
+    _lv_draw_arena_free(p);
+
+    /*The temporary buffers come from the arena if no kept buffer is large enough*/
+    lv_mem_buf_free_all();
+    void * buf = lv_mem_buf_get(200);
+    TEST_ASSERT_TRUE(_lv_draw_arena_is_in(buf));
+    lv_mem_buf_release(buf);
+
+    _lv_draw_arena_end();
+
+    lv_draw_arena_stats_t stats;
+    lv_draw_arena_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.last.fallback_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2 * LV_DRAW_ARENA_SIZE, stats.last.fallback_size);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.last.alloc_cnt);
+}
+
+void test_draw_arena_should_serve_the_layers(void)
+{
+    lv_obj_t * obj = lv_obj_create(active_screen);
+    lv_obj_set_size(obj, 300, 200);
+    lv_obj_add_event_cb(obj, draw_layer_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_invalidate(active_screen);
+    lv_refr_now(NULL);
+
+    lv_draw_arena_stats_t stats;
+    lv_draw_arena_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.frame_cnt);
+    /*The layer context and the layer buffer*/
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(2, stats.last.alloc_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(LV_LAYER_SIMPLE_BUF_SIZE, stats.last.alloc_size);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_DRAW_ARENA_SIZE, stats.last.peak_size);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.last.fallback_cnt);
+
+    /*Nothing is kept from the arena: the next refresh starts from an empty one*/
+    lv_obj_invalidate(active_screen);
+    lv_refr_now(NULL);
+    lv_draw_arena_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.frame_cnt);
+    TEST_ASSERT_EQUAL_UINT32(stats.max.peak_size, stats.last.peak_size);
+
+    /*A layer which can't be subdivided doesn't fit*/
+    full_layer = true;
+    lv_obj_invalidate(active_screen);
+    lv_refr_now(NULL);
+    lv_draw_arena_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.last.fallback_cnt);
+    TEST_ASSERT_EQUAL_UINT32(300 * 200 * sizeof(lv_color_t), stats.last.fallback_size);
+}
+
+/*Allocations served per frame while redrawing the panels and the cost of one allocation*/
+void test_draw_arena_benchmark(void)
+{
+    create_panels();
+
+    uint32_t t = lv_test_get_time_us();
+    uint32_t i;
+    for(i = 0; i < BENCH_LOOPS; i++) {
+        lv_obj_invalidate(active_screen);
+        lv_refr_now(NULL);
+    }
+    uint32_t refr_us = lv_test_get_time_us() - t;
+
+    lv_draw_arena_stats_t stats;
+    lv_draw_arena_get_stats(&stats);
+
+    /*Pairs of a layer context and a layer buffer like the drawing does*/
+    uint32_t alloc_us[2];
+    uint32_t a;
+    for(a = 0; a < 2; a++) {
+        if(a == 1) _lv_draw_arena_begin();
+        t = lv_test_get_time_us();
+        for(i = 0; i < BENCH_ALLOC_CNT; i++) {
+            void * ctx = _lv_draw_arena_alloc(64);
+            void * buf = _lv_draw_arena_alloc(LV_LAYER_SIMPLE_BUF_SIZE);
+            _lv_draw_arena_free(buf);
+            _lv_draw_arena_free(ctx);
+        }
+        alloc_us[a] = lv_test_get_time_us() - t;
+        if(a == 1) _lv_draw_arena_end();
+    }
+
+    char msg[160];
+    lv_snprintf(msg, sizeof(msg), "per frame: %" LV_PRIu32 " allocs, %" LV_PRIu32 " B, peak %" LV_PRIu32 " B of %"
+                LV_PRIu32 " B, %" LV_PRIu32 " fallbacks, %" LV_PRIu32 " us/frame",
+                stats.last.alloc_cnt, stats.last.alloc_size, stats.last.peak_size, stats.size,
+                stats.last.fallback_cnt, refr_us / BENCH_LOOPS);
+    TEST_MESSAGE(msg);
+    lv_snprintf(msg, sizeof(msg), "%d layer alloc/free pairs: %" LV_PRIu32 " us with lv_mem, %" LV_PRIu32
+                " us with the arena", BENCH_ALLOC_CNT, alloc_us[0], alloc_us[1]);
+    TEST_MESSAGE(msg);
+}
+
+#else
+
+void setUp(void)
+{
+
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_draw_arena_should_be_used_only_while_refreshing(void)
+{
+
+}
+
+void test_draw_arena_should_reuse_the_released_end(void)
+{
+
+}
+
+void test_draw_arena_should_fall_back_when_full(void)
+{
+
+}
+
+void test_draw_arena_should_serve_the_layers(void)
+{
+
+}
+
+void test_draw_arena_benchmark(void)
+{
+
+}
+
+#endif
+
+#endif
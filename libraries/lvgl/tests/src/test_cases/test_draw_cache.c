@@ -0,0 +1,394 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_DRAW_CACHE_BUDGET && LV_IMG_CACHE_DEF_SIZE && LV_SHADOW_CACHE_SIZE
+
+#include "lv_test_helpers.h"
+#include "lv_test_init.h"
+
+#define IMG_SIZE        32
+#define PANEL_CNT       12
+#define BENCH_LOOPS     10
+
+typedef struct {
+    lv_draw_cache_entry_t cache;
+    uint32_t id;
+} test_item_t;
+
+static lv_obj_t * active_screen = NULL;
+static lv_img_decoder_t * decoder;
+static uint32_t open_cnt;
+static uint32_t evicted_id;
+static lv_img_dsc_t imgs[PANEL_CNT];
+
+static void item_evict_cb(lv_draw_cache_entry_t * entry)
+{
+    evicted_id = ((test_item_t *)entry)->id;
+}
+
+static void item_init(test_item_t * item, uint32_t id)
+{
+    lv_memset_00(item, sizeof(test_item_t));
+    item->id = id;
+    item->cache.key = id;
+}
+
+/*Decode the images to RAM to make the cache useful, like PNG decoders do*/
+static lv_res_t decoder_info(lv_img_decoder_t * dec, const void * src, lv_img_header_t * header)
+{
+    LV_UNUSED(dec);
+    if(lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) return LV_RES_INV;
+    const lv_img_dsc_t * img = src;
+    if(img->header.cf != LV_IMG_CF_USER_ENCODED_0) return LV_RES_INV;
+
+    *header = img->header;
+    header->cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    return LV_RES_OK;
+}
+
+static lv_res_t decoder_open(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(dec);
+    uint32_t px_cnt = dsc->header.w * dsc->header.h;
+    uint8_t * buf = lv_mem_alloc(px_cnt * LV_IMG_PX_SIZE_ALPHA_BYTE);
+    if(buf == NULL) return LV_RES_INV;
+
+    const lv_img_dsc_t * img = dsc->src;
+    lv_color_t color = lv_color_hex((uint32_t)(lv_uintptr_t)img->data);
+    uint32_t i;
+    for(i = 0; i < px_cnt; i++) {
+        lv_memcpy(&buf[i * LV_IMG_PX_SIZE_ALPHA_BYTE], &color, sizeof(lv_color_t));
+        buf[i * LV_IMG_PX_SIZE_ALPHA_BYTE + LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = (uint8_t)i;
+    }
+
+    dsc->img_data = buf;
+    open_cnt++;
+    return LV_RES_OK;
+}
+
+static void decoder_close(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(dec);
+    lv_mem_free((void *)dsc->img_data);
+    dsc->img_data = NULL;
+}
+
+static lv_obj_t * create_panel(lv_obj_t * parent, uint32_t i)
+{
+    lv_obj_t * panel = lv_obj_create(parent);
+    lv_obj_remove_style_all(panel);
+    lv_obj_set_size(panel, 180, 100);
+    lv_obj_set_pos(panel, 20 + (i % 4) * 195, 20 + (i / 4) * 150);
+    lv_obj_set_style_radius(panel, 12 + (i % 3) * 4, 0);
+    lv_obj_set_style_bg_opa(panel, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(panel, lv_palette_main(LV_PALETTE_BLUE + (i % 4)), 0);
+    lv_obj_set_style_bg_grad_color(panel, lv_palette_darken(LV_PALETTE_BLUE + (i % 4), 3), 0);
+    lv_obj_set_style_bg_grad_dir(panel, i % 2 ? LV_GRAD_DIR_HOR : LV_GRAD_DIR_VER, 0);
+    lv_obj_set_style_shadow_width(panel, 16 + (i % 3) * 8, 0);
+    lv_obj_set_style_shadow_ofs_y(panel, 6, 0);
+
+    lv_obj_t * img = lv_img_create(panel);
+    lv_img_set_src(img, &imgs[i]);
+    lv_obj_align(img, LV_ALIGN_LEFT_MID, 12, 0);
+
+    lv_obj_t * label = lv_label_create(panel);
+    lv_label_set_text_fmt(label, "Panel %" LV_PRIu32, i);
+    lv_obj_align(label, LV_ALIGN_RIGHT_MID, -12, 0);
+    return panel;
+}
+
+static void refr(void)
+{
+    lv_obj_invalidate(active_screen);
+    lv_refr_now(NULL);
+}
+
+void setUp(void)
+{
+    active_screen = lv_scr_act();
+
+    decoder = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(decoder, decoder_info);
+    lv_img_decoder_set_open_cb(decoder, decoder_open);
+    lv_img_decoder_set_close_cb(decoder, decoder_close);
+
+    uint32_t i;
+    for(i = 0; i < PANEL_CNT; i++) {
+        lv_memset_00(&imgs[i], sizeof(lv_img_dsc_t));
+        imgs[i].header.always_zero = 0;
+        imgs[i].header.w = IMG_SIZE;
+        imgs[i].header.h = IMG_SIZE;
+        imgs[i].header.cf = LV_IMG_CF_USER_ENCODED_0;
+        imgs[i].data = (const uint8_t *)(lv_uintptr_t)(0x102030 * (i + 1));
+    }
+
+    open_cnt = 0;
+    evicted_id = 0;
+    lv_draw_cache_set_budget(LV_DRAW_CACHE_BUDGET);
+    lv_draw_cache_drop_all();
+    lv_draw_cache_reset_stats();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+    lv_img_cache_invalidate_src(NULL);
+    lv_draw_cache_drop_all();
+    lv_draw_cache_set_budget(LV_DRAW_CACHE_BUDGET);
+    lv_img_decoder_delete(decoder);
+}
+
+void test_draw_cache_should_drop_the_least_recently_used(void)
+{
+    test_item_t items[3];
+    item_init(&items[0], 1);
+    item_init(&items[1], 2);
+    item_init(&items[2], 3);
+
+    lv_draw_cache_set_budget(250);
+    TEST_ASSERT_TRUE(_lv_draw_cache_add(&items[0].cache, LV_DRAW_CACHE_TYPE_IMG, 100, item_evict_cb));
+    TEST_ASSERT_TRUE(_lv_draw_cache_add(&items[1].cache, LV_DRAW_CACHE_TYPE_SHADOW, 100, item_evict_cb));
+    TEST_ASSERT_EQUAL(200, lv_draw_cache_get_size());
+
+    /*The first item is used again so the second is the oldest*/
+    TEST_ASSERT_EQUAL_PTR(&items[0].cache, _lv_draw_cache_find(LV_DRAW_CACHE_TYPE_IMG, 1, NULL, NULL));
+    TEST_ASSERT_NULL(_lv_draw_cache_find(LV_DRAW_CACHE_TYPE_SHADOW, 1, NULL, NULL));
+
+    /*The type doesn't matter, the least recently used item is dropped*/
+    TEST_ASSERT_TRUE(_lv_draw_cache_add(&items[2].cache, LV_DRAW_CACHE_TYPE_GRAD, 100, item_evict_cb));
+    TEST_ASSERT_EQUAL(2, evicted_id);
+    TEST_ASSERT_FALSE(items[1].cache.linked);
+    TEST_ASSERT_EQUAL(200, lv_draw_cache_get_size());
+
+    lv_draw_cache_stats_t stats;
+    lv_draw_cache_get_stats(LV_DRAW_CACHE_TYPE_SHADOW, &stats);
+    TEST_ASSERT_EQUAL(1, stats.evict);
+    TEST_ASSERT_EQUAL(1, stats.miss);
+    TEST_ASSERT_EQUAL(0, stats.entry_cnt);
+    TEST_ASSERT_EQUAL(0, stats.size);
+
+    lv_draw_cache_get_stats(_LV_DRAW_CACHE_TYPE_NUM, &stats);
+    TEST_ASSERT_EQUAL(1, stats.hit);
+    TEST_ASSERT_EQUAL(2, stats.entry_cnt);
+    TEST_ASSERT_EQUAL(200, stats.size);
+
+    lv_draw_cache_drop_all();
+    TEST_ASSERT_EQUAL(0, lv_draw_cache_get_size());
+}
+
+void test_draw_cache_should_keep_the_used_items(void)
+{
+    test_item_t items[3];
+    item_init(&items[0], 1);
+    item_init(&items[1], 2);
+    item_init(&items[2], 3);
+
+    lv_draw_cache_set_budget(200);
+    TEST_ASSERT_TRUE(_lv_draw_cache_add(&items[0].cache, LV_DRAW_CACHE_TYPE_IMG, 100, item_evict_cb));
+    TEST_ASSERT_TRUE(_lv_draw_cache_add(&items[1].cache, LV_DRAW_CACHE_TYPE_IMG, 100, item_evict_cb));
+
+    items[0].cache.used_cnt = 1;
+    TEST_ASSERT_TRUE(_lv_draw_cache_add(&items[2].cache, LV_DRAW_CACHE_TYPE_IMG, 100, item_evict_cb));
+    TEST_ASSERT_EQUAL(2, evicted_id);
+
+    /*Doesn't fit without dropping a used item*/
+    items[2].cache.used_cnt = 1;
+    TEST_ASSERT_FALSE(_lv_draw_cache_add(&items[1].cache, LV_DRAW_CACHE_TYPE_IMG, 100, item_evict_cb));
+    TEST_ASSERT_FALSE(_lv_draw_cache_add(&items[1].cache, LV_DRAW_CACHE_TYPE_IMG, 300, item_evict_cb));
+    TEST_ASSERT_FALSE(items[1].cache.linked);
+
+    items[0].cache.used_cnt = 0;
+    items[2].cache.used_cnt = 0;
+    lv_draw_cache_drop_all();
+}
+
+void test_draw_cache_should_shrink_to_the_new_budget(void)
+{
+    test_item_t items[3];
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        item_init(&items[i], i + 1);
+        TEST_ASSERT_TRUE(_lv_draw_cache_add(&items[i].cache, LV_DRAW_CACHE_TYPE_CIRCLE, 100, item_evict_cb));
+    }
+    TEST_ASSERT_EQUAL(300, lv_draw_cache_get_size());
+
+    lv_draw_cache_set_budget(150);
+    TEST_ASSERT_EQUAL(150, lv_draw_cache_get_budget());
+    TEST_ASSERT_EQUAL(100, lv_draw_cache_get_size());
+    TEST_ASSERT_TRUE(items[2].cache.linked);
+
+    lv_draw_cache_set_budget(0);
+    TEST_ASSERT_EQUAL(0, lv_draw_cache_get_size());
+    TEST_ASSERT_FALSE(_lv_draw_cache_add(&items[0].cache, LV_DRAW_CACHE_TYPE_CIRCLE, 1, item_evict_cb));
+}
+
+void test_draw_cache_should_keep_the_decoded_images(void)
+{
+    uint32_t i;
+    for(i = 0; i < PANEL_CNT; i++) create_panel(active_screen, i);
+
+    refr();
+    TEST_ASSERT_EQUAL(PANEL_CNT, open_cnt);
+    refr();
+    TEST_ASSERT_EQUAL(PANEL_CNT, open_cnt);
+
+    lv_draw_cache_stats_t stats;
+    lv_draw_cache_get_stats(LV_DRAW_CACHE_TYPE_IMG, &stats);
+    TEST_ASSERT_EQUAL(PANEL_CNT, stats.entry_cnt);
+    TEST_ASSERT_EQUAL(PANEL_CNT * lv_img_buf_get_img_size(IMG_SIZE, IMG_SIZE, LV_IMG_CF_TRUE_COLOR_ALPHA), stats.size);
+
+    /*Only half of the images fit, the rest is decoded again*/
+    lv_draw_cache_set_budget(stats.size / 2);
+    open_cnt = 0;
+    refr();
+    TEST_ASSERT_GREATER_THAN(0, open_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL(lv_draw_cache_get_budget(), lv_draw_cache_get_size());
+
+    /*The images are still drawn and closed without a budget*/
+    lv_draw_cache_set_budget(0);
+    open_cnt = 0;
+    refr();
+    TEST_ASSERT_EQUAL(PANEL_CNT, open_cnt);
+    TEST_ASSERT_EQUAL(0, lv_draw_cache_get_size());
+}
+
+void test_draw_cache_should_find_the_same_gradient_and_shadow(void)
+{
+    /*Same look, different objects: the descriptors of the drawing are different*/
+    create_panel(active_screen, 0);
+    lv_obj_t * panel2 = create_panel(active_screen, 0);
+    lv_obj_set_pos(panel2, 400, 200);
+
+    refr();
+    lv_draw_cache_stats_t grad_stats;
+    lv_draw_cache_stats_t sh_stats;
+    lv_draw_cache_get_stats(LV_DRAW_CACHE_TYPE_GRAD, &grad_stats);
+    lv_draw_cache_get_stats(LV_DRAW_CACHE_TYPE_SHADOW, &sh_stats);
+    TEST_ASSERT_EQUAL(1, grad_stats.entry_cnt);
+    TEST_ASSERT_EQUAL(1, sh_stats.entry_cnt);
+    TEST_ASSERT_GREATER_THAN(0, grad_stats.hit);
+    TEST_ASSERT_GREATER_THAN(0, sh_stats.hit);
+
+    /*A new color is a new gradient*/
+    lv_obj_set_style_bg_grad_color(panel2, lv_color_hex(0x123456), 0);
+    refr();
+    lv_draw_cache_get_stats(LV_DRAW_CACHE_TYPE_GRAD, &grad_stats);
+    TEST_ASSERT_EQUAL(2, grad_stats.entry_cnt);
+}
+
+/*Frame time and memory use of a dashboard-like screen with different budgets*/
+void test_draw_cache_benchmark(void)
+{
+    static const size_t budgets[] = {0, 4 * 1024, 16 * 1024, 64 * 1024, 256 * 1024, 1024 * 1024};
+
+    uint32_t i;
+    for(i = 0; i < PANEL_CNT; i++) create_panel(active_screen, i);
+
+    for(i = 0; i < sizeof(budgets) / sizeof(budgets[0]); i++) {
+        lv_draw_cache_set_budget(budgets[i]);
+        lv_draw_cache_drop_all();
+        refr();
+        lv_draw_cache_reset_stats();
+        open_cnt = 0;
+
+        uint32_t t = lv_test_get_time_us();
+        uint32_t j;
+        for(j = 0; j < BENCH_LOOPS; j++) refr();
+        t = lv_test_get_time_us() - t;
+
+        lv_draw_cache_stats_t stats;
+        lv_draw_cache_get_stats(_LV_DRAW_CACHE_TYPE_NUM, &stats);
+        TEST_ASSERT_LESS_OR_EQUAL(budgets[i], stats.size);
+
+        char msg[160];
+        lv_snprintf(msg, sizeof(msg), "budget %7" LV_PRIu32 " B: %6" LV_PRIu32 " us/frame, %7" LV_PRIu32
+                    " B used, hit %5" LV_PRIu32 " miss %5" LV_PRIu32 " evict %5" LV_PRIu32 ", %" LV_PRIu32 " decodes",
+                    (uint32_t)budgets[i], t / BENCH_LOOPS, (uint32_t)stats.size, stats.hit, stats.miss, stats.evict, open_cnt);
+        TEST_MESSAGE(msg);
+    }
+}
+
+void test_draw_cache_should_be_empty_after_reinit(void)
+{
+#if LV_ENABLE_GC || !LV_MEM_CUSTOM
+    lv_obj_t * panel = create_panel(active_screen, 0);
+    refr();
+    TEST_ASSERT_GREATER_THAN(0, lv_draw_cache_get_size());
+    lv_draw_cache_set_budget(LV_DRAW_CACHE_BUDGET / 2);
+
+    /*The decoder and the objects are freed with the heap*/
+    lv_obj_del(panel);
+    lv_img_decoder_delete(decoder);
+    lv_deinit();
+    lv_test_init();
+
+    lv_draw_cache_stats_t stats;
+    lv_draw_cache_get_stats(_LV_DRAW_CACHE_TYPE_NUM, &stats);
+    TEST_ASSERT_EQUAL(0, lv_draw_cache_get_size());
+    TEST_ASSERT_EQUAL(LV_DRAW_CACHE_BUDGET, lv_draw_cache_get_budget());
+    TEST_ASSERT_EQUAL(0, stats.entry_cnt);
+    TEST_ASSERT_EQUAL(0, stats.miss);
+
+    /*The cache works with the new heap*/
+    setUp();
+    create_panel(active_screen, 0);
+    refr();
+    refr();
+    lv_draw_cache_get_stats(LV_DRAW_CACHE_TYPE_IMG, &stats);
+    TEST_ASSERT_EQUAL(1, stats.entry_cnt);
+    TEST_ASSERT_EQUAL(1, open_cnt);
+#endif
+}
+
+#else
+
+void setUp(void)
+{
+
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_draw_cache_should_drop_the_least_recently_used(void)
+{
+
+}
+
+void test_draw_cache_should_keep_the_used_items(void)
+{
+
+}
+
+void test_draw_cache_should_shrink_to_the_new_budget(void)
+{
+
+}
+
+void test_draw_cache_should_keep_the_decoded_images(void)
+{
+
+}
+
+void test_draw_cache_should_find_the_same_gradient_and_shadow(void)
+{
+
+}
+
+void test_draw_cache_benchmark(void)
+{
+
+}
+
+void test_draw_cache_should_be_empty_after_reinit(void)
+{
+
+}
+
+#endif
+
+#endif
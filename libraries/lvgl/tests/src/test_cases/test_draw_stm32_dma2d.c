@@ -0,0 +1,266 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_GPU_STM32_DMA2D
+
+#include "../../src/draw/sw/lv_draw_sw.h"
+#include "lv_test_dma2d.h"
+
+/*Every scene is rendered twice: with the DMA2D draw context of the test display and with the
+ *software renderer. The DMA2D model truncates in the blending formula while LVGL rounds,
+ *so translucent pixels may differ a little.*/
+
+#define HOR_RES     800
+#define VER_RES     480
+#define IMG_SIZE    40
+
+extern lv_color_t test_fb[];
+
+static lv_color_t dma2d_fb[HOR_RES * VER_RES];
+static lv_color32_t img_argb_map[IMG_SIZE * IMG_SIZE];
+static lv_color32_t img_xrgb_map[IMG_SIZE * IMG_SIZE];
+static lv_img_dsc_t img_argb;
+static lv_img_dsc_t img_xrgb;
+static lv_obj_t * active_screen = NULL;
+static uint32_t flush_ready_cnt;
+
+static void init_img(lv_img_dsc_t * dsc, lv_color32_t * map, lv_img_cf_t cf, bool alpha)
+{
+    uint32_t x, y;
+    for(y = 0; y < IMG_SIZE; y++) {
+        for(x = 0; x < IMG_SIZE; x++) {
+            lv_color32_t * c = &map[y * IMG_SIZE + x];
+            c->ch.red = (uint8_t)(x * 255 / (IMG_SIZE - 1));
+            c->ch.green = (uint8_t)(y * 255 / (IMG_SIZE - 1));
+            c->ch.blue = 0x80;
+            /*Random garbage in the alpha byte if it's not used*/
+            c->ch.alpha = alpha ? (uint8_t)((x + y) * 255 / (2 * IMG_SIZE - 2)) : (uint8_t)(x * 37 + y);
+        }
+    }
+
+    lv_memset_00(dsc, sizeof(lv_img_dsc_t));
+    dsc->header.cf = cf;
+    dsc->header.w = IMG_SIZE;
+    dsc->header.h = IMG_SIZE;
+    dsc->data_size = sizeof(lv_color32_t) * IMG_SIZE * IMG_SIZE;
+    dsc->data = (const uint8_t *)map;
+}
+
+/*Render the active screen with the DMA2D to `dma2d_fb` and with the software renderer to `test_fb`*/
+static void render_both(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_disp_drv_t * drv = disp->driver;
+
+    lv_obj_invalidate(active_screen);
+    lv_test_dma2d_reset_stats();
+    lv_refr_now(disp);
+    lv_memcpy(dma2d_fb, test_fb, sizeof(dma2d_fb));
+
+    lv_draw_ctx_t * dma2d_ctx = drv->draw_ctx;
+    lv_draw_sw_ctx_t sw_ctx;
+    lv_draw_sw_init_ctx(drv, &sw_ctx.base_draw);
+    drv->draw_ctx = &sw_ctx.base_draw;
+
+    lv_obj_invalidate(active_screen);
+    lv_refr_now(disp);
+
+    lv_draw_sw_deinit_ctx(drv, &sw_ctx.base_draw);
+    drv->draw_ctx = dma2d_ctx;
+}
+
+static void assert_fb_similar(uint8_t tolerance)
+{
+    uint32_t i;
+    for(i = 0; i < HOR_RES * VER_RES; i++) {
+        lv_color32_t a = dma2d_fb[i];
+        lv_color32_t b = test_fb[i];
+        if(LV_ABS(a.ch.red - b.ch.red) > tolerance || LV_ABS(a.ch.green - b.ch.green) > tolerance ||
+           LV_ABS(a.ch.blue - b.ch.blue) > tolerance) {
+            char msg[64];
+            lv_snprintf(msg, sizeof(msg), "Pixel mismatch at x=%d y=%d", (int)(i % HOR_RES), (int)(i / HOR_RES));
+            TEST_FAIL_MESSAGE(msg);
+        }
+    }
+}
+
+static void assert_stats_clean(void)
+{
+    const lv_test_dma2d_stats_t * stats = lv_test_dma2d_get_stats();
+    TEST_ASSERT_EQUAL_UINT32(0, stats->config_err_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats->busy_write_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats->cache_err_cnt);
+}
+
+static void flush_ready_cb(void)
+{
+    flush_ready_cnt++;
+}
+
+static lv_obj_t * create_img(const lv_img_dsc_t * src, lv_coord_t x, lv_coord_t y)
+{
+    lv_obj_t * img = lv_img_create(active_screen);
+    lv_img_set_src(img, src);
+    lv_obj_set_pos(img, x, y);
+    return img;
+}
+
+void setUp(void)
+{
+    active_screen = lv_scr_act();
+    init_img(&img_argb, img_argb_map, LV_IMG_CF_TRUE_COLOR_ALPHA, true);
+    init_img(&img_xrgb, img_xrgb_map, LV_IMG_CF_TRUE_COLOR, false);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+    lv_refr_now(NULL);
+}
+
+void test_draw_stm32_dma2d_fill(void)
+{
+    lv_obj_t * opaque = lv_obj_create(active_screen);
+    lv_obj_remove_style_all(opaque);
+    lv_obj_set_style_bg_opa(opaque, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(opaque, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_obj_set_size(opaque, 200, 100);
+    lv_obj_set_pos(opaque, 10, 10);
+
+    lv_obj_t * translucent = lv_obj_create(active_screen);
+    lv_obj_remove_style_all(translucent);
+    lv_obj_set_style_bg_opa(translucent, LV_OPA_40, 0);
+    lv_obj_set_style_bg_color(translucent, lv_palette_main(LV_PALETTE_BLUE), 0);
+    lv_obj_set_size(translucent, 200, 100);
+    lv_obj_set_pos(translucent, 110, 60);
+
+    render_both();
+
+    const lv_test_dma2d_stats_t * stats = lv_test_dma2d_get_stats();
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats->mode_cnt[3]);     /*Register to memory fill*/
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats->mode_cnt[4]);     /*Blending with a fixed foreground color*/
+    assert_stats_clean();
+    assert_fb_similar(2);
+}
+
+void test_draw_stm32_dma2d_img(void)
+{
+    create_img(&img_xrgb, 20, 20);
+    create_img(&img_argb, 80, 20);
+
+    lv_obj_t * translucent = create_img(&img_xrgb, 140, 20);
+    lv_obj_set_style_img_opa(translucent, LV_OPA_50, 0);
+
+    /*Partially out of the screen, so the source has to be clipped*/
+    create_img(&img_argb, -15, 200);
+    create_img(&img_xrgb, HOR_RES - 25, VER_RES - 10);
+
+    render_both();
+
+    const lv_test_dma2d_stats_t * stats = lv_test_dma2d_get_stats();
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats->mode_cnt[2]);     /*Memory to memory with blending*/
+    assert_stats_clean();
+    assert_fb_similar(2);
+}
+
+void test_draw_stm32_dma2d_label(void)
+{
+    lv_obj_t * label = lv_label_create(active_screen);
+    lv_label_set_text(label, "DMA2D renders the A8 glyphs");
+    lv_obj_set_style_text_color(label, lv_palette_main(LV_PALETTE_GREEN), 0);
+    lv_obj_set_pos(label, 30, 30);
+
+    render_both();
+
+    const lv_test_dma2d_stats_t * stats = lv_test_dma2d_get_stats();
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats->mode_cnt[2]);
+    assert_stats_clean();
+    assert_fb_similar(2);
+}
+
+void test_draw_stm32_dma2d_should_fall_back(void)
+{
+    /*The DMA2D can't do additive blending. If it blended normally the result would be much darker.*/
+    lv_obj_t * obj = lv_obj_create(active_screen);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x404040), 0);
+    lv_obj_set_style_blend_mode(obj, LV_BLEND_MODE_ADDITIVE, 0);
+    lv_obj_set_size(obj, 100, 100);
+
+    create_img(&img_argb, 50, 50);
+
+    render_both();
+    assert_stats_clean();
+    assert_fb_similar(2);
+}
+
+void test_draw_stm32_dma2d_should_wait_for_the_flush(void)
+{
+    static lv_color_t flush_src[100 * 50];
+    static lv_color_t flush_dest[100 * 50];
+    lv_color_fill(flush_src, lv_palette_main(LV_PALETTE_ORANGE), 100 * 50);
+
+    lv_obj_t * obj = lv_obj_create(active_screen);
+    lv_obj_set_style_bg_color(obj, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_obj_set_size(obj, 200, 100);
+
+    /*The display driver is still copying the previous buffer when LVGL starts drawing.
+     *Its interrupt comes only after the DMA2D was used for drawing.*/
+    lv_obj_invalidate(active_screen);
+    lv_test_dma2d_reset_stats();
+    flush_ready_cnt = 0;
+    lv_test_dma2d_flush_start(flush_dest, flush_src, 100, 50, sizeof(lv_color_t), flush_ready_cb);
+    lv_refr_now(NULL);
+    lv_test_dma2d_irq();
+
+    const lv_test_dma2d_stats_t * stats = lv_test_dma2d_get_stats();
+    TEST_ASSERT_GREATER_THAN_UINT32(1, stats->transfer_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats->lost_irq_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, flush_ready_cnt);
+    TEST_ASSERT_EQUAL_MEMORY(flush_src, flush_dest, sizeof(flush_dest));
+    assert_stats_clean();
+}
+
+#else /*LV_USE_GPU_STM32_DMA2D*/
+
+void setUp(void)
+{
+
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_draw_stm32_dma2d_fill(void)
+{
+
+}
+
+void test_draw_stm32_dma2d_img(void)
+{
+
+}
+
+void test_draw_stm32_dma2d_label(void)
+{
+
+}
+
+void test_draw_stm32_dma2d_should_fall_back(void)
+{
+
+}
+
+void test_draw_stm32_dma2d_should_wait_for_the_flush(void)
+{
+
+}
+
+#endif /*LV_USE_GPU_STM32_DMA2D*/
+
+#endif
@@ -0,0 +1,231 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../src/draw/sw/lv_draw_sw_blend_rgb565.h"
+
+#include "unity/unity.h"
+#include <stdlib.h>
+#include "lv_test_helpers.h"
+
+/*The kernels are compared to the per-pixel loops of `lv_draw_sw_blend.c` they replace with 16 bit color depth.
+ *They work on raw RGB565 values, so they can be tested in the 32 bit test build too.*/
+
+#define LINE_LEN    800
+#define BENCH_LINES 480
+
+static uint16_t dest_buf[LINE_LEN + 8];
+static uint16_t ref_buf[LINE_LEN + 8];
+static uint16_t src_buf[LINE_LEN + 8];
+static lv_opa_t mask_buf[LINE_LEN + 8];
+
+/*Not a constant, so the compiler can't optimize the per pixel reference loops for it*/
+static lv_opa_t bench_opa = 200;
+
+static const lv_opa_t opa_values[] = {0, 1, 7, 64, 127, 128, 200, 252, LV_OPA_MAX, 254, LV_OPA_COVER};
+
+/*`lv_color_mix()` with `LV_COLOR_DEPTH 16` and `LV_COLOR_MIX_ROUND_OFS 0`*/
+static uint16_t ref_mix(uint16_t c1, uint16_t c2, uint8_t mix)
+{
+    mix = (uint32_t)((uint32_t)mix + 4) >> 3;
+    uint32_t bg = (uint32_t)((uint32_t)c2 | ((uint32_t)c2 << 16)) & 0x7E0F81F;
+    uint32_t fg = (uint32_t)((uint32_t)c1 | ((uint32_t)c1 << 16)) & 0x7E0F81F;
+    uint32_t result = ((((fg - bg) * mix) >> 5) + bg) & 0x7E0F81F;
+    return (uint16_t)((result >> 16) | result);
+}
+
+static void ref_fill(uint16_t * dest, int32_t len, uint16_t color, lv_opa_t opa)
+{
+    int32_t x;
+    for(x = 0; x < len; x++) dest[x] = ref_mix(color, dest[x], opa);
+}
+
+static void ref_fill_mask(uint16_t * dest, int32_t len, uint16_t color, lv_opa_t opa, const lv_opa_t * mask)
+{
+    int32_t x;
+    for(x = 0; x < len; x++) {
+        if(opa >= LV_OPA_MAX) {
+            if(mask[x] == LV_OPA_COVER) dest[x] = color;
+            else dest[x] = ref_mix(color, dest[x], mask[x]);
+        }
+        else if(mask[x]) {
+            lv_opa_t opa_tmp = mask[x] == LV_OPA_COVER ? opa : (uint32_t)((uint32_t)(mask[x]) * opa) >> 8;
+            dest[x] = ref_mix(color, dest[x], opa_tmp);
+        }
+    }
+}
+
+static void ref_map(uint16_t * dest, const uint16_t * src, int32_t len, lv_opa_t opa)
+{
+    int32_t x;
+    for(x = 0; x < len; x++) dest[x] = ref_mix(src[x], dest[x], opa);
+}
+
+static void ref_map_mask(uint16_t * dest, const uint16_t * src, int32_t len, lv_opa_t opa, const lv_opa_t * mask)
+{
+    int32_t x;
+    for(x = 0; x < len; x++) {
+        if(mask[x] == 0) continue;
+        if(opa > LV_OPA_MAX) {
+            if(mask[x] == LV_OPA_COVER) dest[x] = src[x];
+            else dest[x] = ref_mix(src[x], dest[x], mask[x]);
+        }
+        else {
+            lv_opa_t opa_tmp = mask[x] >= LV_OPA_MAX ? opa : ((opa * mask[x]) >> 8);
+            dest[x] = ref_mix(src[x], dest[x], opa_tmp);
+        }
+    }
+}
+
+/*Random pixels and a mask with transparent and opaque runs like an anti-aliased shape*/
+static void fill_random(void)
+{
+    uint32_t i;
+    for(i = 0; i < LINE_LEN + 8; i++) {
+        dest_buf[i] = (uint16_t)rand();
+        src_buf[i] = (uint16_t)rand();
+        uint32_t r = (uint32_t)rand() % 8;
+        if(i > 0 && r < 5) mask_buf[i] = mask_buf[i - 1];
+        else if(r == 5) mask_buf[i] = LV_OPA_TRANSP;
+        else if(r == 6) mask_buf[i] = LV_OPA_COVER;
+        else mask_buf[i] = (lv_opa_t)rand();
+    }
+    lv_memcpy(ref_buf, dest_buf, sizeof(ref_buf));
+}
+
+/*A line of an anti-aliased rounded rectangle: transparent, a short edge, opaque, edge, transparent*/
+static void fill_shape_mask(void)
+{
+    uint32_t i;
+    for(i = 0; i < LINE_LEN; i++) {
+        if(i < 100 || i >= LINE_LEN - 100) mask_buf[i] = LV_OPA_TRANSP;
+        else if(i < 104) mask_buf[i] = (lv_opa_t)((i - 99) * 50);
+        else if(i >= LINE_LEN - 104) mask_buf[i] = (lv_opa_t)((LINE_LEN - 100 - i) * 50);
+        else mask_buf[i] = LV_OPA_COVER;
+    }
+}
+
+static uint32_t mpx_per_s(uint32_t t_us)
+{
+    if(t_us == 0) t_us = 1;
+    return (LINE_LEN * BENCH_LINES) / t_us;
+}
+
+static void report(const char * name, uint32_t ref_us, uint32_t kernel_us)
+{
+    char msg[128];
+    lv_snprintf(msg, sizeof(msg), "%s: per pixel %" LV_PRIu32 " Mpx/s, kernel %" LV_PRIu32 " Mpx/s", name,
+                mpx_per_s(ref_us), mpx_per_s(kernel_us));
+    TEST_MESSAGE(msg);
+}
+
+void setUp(void)
+{
+    srand(1234);
+}
+
+void tearDown(void)
+{
+}
+
+void test_draw_sw_blend_rgb565_fill(void)
+{
+    uint32_t o, i;
+    for(o = 0; o < sizeof(opa_values); o++) {
+        for(i = 0; i < 20; i++) {
+            fill_random();
+            int32_t len = rand() % LINE_LEN;
+            uint32_t ofs = rand() % 8;
+            uint16_t color = (uint16_t)rand();
+            ref_fill(ref_buf + ofs, len, color, opa_values[o]);
+            _lv_draw_sw_blend_rgb565_fill(dest_buf + ofs, len, color, opa_values[o]);
+            TEST_ASSERT_EQUAL_HEX16_ARRAY(ref_buf, dest_buf, LINE_LEN + 8);
+        }
+    }
+}
+
+void test_draw_sw_blend_rgb565_fill_mask(void)
+{
+    uint32_t o, i;
+    for(o = 0; o < sizeof(opa_values); o++) {
+        for(i = 0; i < 20; i++) {
+            fill_random();
+            int32_t len = rand() % LINE_LEN;
+            uint32_t ofs = rand() % 8;
+            uint16_t color = (uint16_t)rand();
+            ref_fill_mask(ref_buf + ofs, len, color, opa_values[o], mask_buf + ofs);
+            _lv_draw_sw_blend_rgb565_fill_mask(dest_buf + ofs, len, color, opa_values[o], mask_buf + ofs);
+            TEST_ASSERT_EQUAL_HEX16_ARRAY(ref_buf, dest_buf, LINE_LEN + 8);
+        }
+    }
+}
+
+void test_draw_sw_blend_rgb565_map(void)
+{
+    uint32_t o, i;
+    for(o = 0; o < sizeof(opa_values); o++) {
+        for(i = 0; i < 20; i++) {
+            fill_random();
+            int32_t len = rand() % LINE_LEN;
+            uint32_t ofs = rand() % 8;
+            ref_map(ref_buf + ofs, src_buf + ofs, len, opa_values[o]);
+            _lv_draw_sw_blend_rgb565_map(dest_buf + ofs, src_buf + ofs, len, opa_values[o]);
+            TEST_ASSERT_EQUAL_HEX16_ARRAY(ref_buf, dest_buf, LINE_LEN + 8);
+        }
+    }
+}
+
+void test_draw_sw_blend_rgb565_map_mask(void)
+{
+    uint32_t o, i;
+    for(o = 0; o < sizeof(opa_values); o++) {
+        for(i = 0; i < 20; i++) {
+            fill_random();
+            int32_t len = rand() % LINE_LEN;
+            uint32_t ofs = rand() % 8;
+            ref_map_mask(ref_buf + ofs, src_buf + ofs, len, opa_values[o], mask_buf + ofs);
+            _lv_draw_sw_blend_rgb565_map_mask(dest_buf + ofs, src_buf + ofs, len, opa_values[o], mask_buf + ofs);
+            TEST_ASSERT_EQUAL_HEX16_ARRAY(ref_buf, dest_buf, LINE_LEN + 8);
+        }
+    }
+}
+
+void test_draw_sw_blend_rgb565_benchmark(void)
+{
+    uint32_t y, t, ref_us;
+    fill_random();
+    fill_shape_mask();
+
+    t = lv_test_get_time_us();
+    for(y = 0; y < BENCH_LINES; y++) ref_fill(ref_buf, LINE_LEN, 0x1234, bench_opa);
+    ref_us = lv_test_get_time_us() - t;
+    t = lv_test_get_time_us();
+    for(y = 0; y < BENCH_LINES; y++) _lv_draw_sw_blend_rgb565_fill(dest_buf, LINE_LEN, 0x1234, bench_opa);
+    report("fill with opacity", ref_us, lv_test_get_time_us() - t);
+
+    t = lv_test_get_time_us();
+    for(y = 0; y < BENCH_LINES; y++) ref_fill_mask(ref_buf, LINE_LEN, 0x1234, LV_OPA_COVER, mask_buf);
+    ref_us = lv_test_get_time_us() - t;
+    t = lv_test_get_time_us();
+    for(y = 0; y < BENCH_LINES; y++) _lv_draw_sw_blend_rgb565_fill_mask(dest_buf, LINE_LEN, 0x1234, LV_OPA_COVER,
+                                                                            mask_buf);
+    report("fill with mask", ref_us, lv_test_get_time_us() - t);
+
+    t = lv_test_get_time_us();
+    for(y = 0; y < BENCH_LINES; y++) ref_map(ref_buf, src_buf, LINE_LEN, bench_opa);
+    ref_us = lv_test_get_time_us() - t;
+    t = lv_test_get_time_us();
+    for(y = 0; y < BENCH_LINES; y++) _lv_draw_sw_blend_rgb565_map(dest_buf, src_buf, LINE_LEN, bench_opa);
+    report("image with opacity", ref_us, lv_test_get_time_us() - t);
+
+    t = lv_test_get_time_us();
+    for(y = 0; y < BENCH_LINES; y++) ref_map_mask(ref_buf, src_buf, LINE_LEN, LV_OPA_COVER, mask_buf);
+    ref_us = lv_test_get_time_us() - t;
+    t = lv_test_get_time_us();
+    for(y = 0; y < BENCH_LINES; y++) _lv_draw_sw_blend_rgb565_map_mask(dest_buf, src_buf, LINE_LEN, LV_OPA_COVER,
+                                                                           mask_buf);
+    report("image with mask", ref_us, lv_test_get_time_us() - t);
+
+    /*Same input, same blending*/
+    TEST_ASSERT_EQUAL_HEX16_ARRAY(ref_buf, dest_buf, LINE_LEN + 8);
+}
+
+#endif
@@ -0,0 +1,149 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../src/draw/sw/lv_draw_sw.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+
+/*The display of the GIGA Display Shield in landscape orientation*/
+#define HOR_RES     800
+#define VER_RES     480
+#define BENCH_LOOPS 20
+
+static lv_color_t src_buf[HOR_RES * VER_RES];
+static lv_color_t dest_buf[HOR_RES * VER_RES];
+static lv_color_t ref_buf[HOR_RES * VER_RES];
+
+/*The former pixel by pixel rotation of `lv_refr.c`, used as reference and as the baseline of the benchmark*/
+static void rotate_90_ref(bool invert_i, lv_coord_t area_w, lv_coord_t area_h, const lv_color_t * orig_color_p,
+                          lv_color_t * rot_buf)
+{
+    uint32_t invert = (area_w * area_h) - 1;
+    uint32_t initial_i = ((area_w - 1) * area_h);
+    for(lv_coord_t y = 0; y < area_h; y++) {
+        uint32_t i = initial_i + y;
+        if(invert_i)
+            i = invert - i;
+        for(lv_coord_t x = 0; x < area_w; x++) {
+            rot_buf[i] = *(orig_color_p++);
+            if(invert_i)
+                i += area_h;
+            else
+                i -= area_h;
+        }
+    }
+}
+
+static void fill_src(lv_coord_t w, lv_coord_t h)
+{
+    lv_coord_t x, y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            src_buf[y * w + x] = lv_color_make((uint8_t)x, (uint8_t)y, (uint8_t)(x ^ (y << 2)));
+        }
+    }
+}
+
+static void assert_rotation(lv_coord_t w, lv_coord_t h, lv_disp_rot_t rotation)
+{
+    fill_src(w, h);
+    lv_draw_sw_rotate(src_buf, dest_buf, w, h, w, h, rotation);
+    rotate_90_ref(rotation == LV_DISP_ROT_270, w, h, src_buf, ref_buf);
+    TEST_ASSERT_EQUAL_MEMORY(ref_buf, dest_buf, w * h * sizeof(lv_color_t));
+}
+
+static void bench(const char * name, lv_coord_t w, lv_coord_t h)
+{
+    fill_src(w, h);
+
+    uint32_t i;
+    uint32_t t = lv_test_get_time_us();
+    for(i = 0; i < BENCH_LOOPS; i++) rotate_90_ref(true, w, h, src_buf, ref_buf);
+    uint32_t ref_us = (lv_test_get_time_us() - t) / BENCH_LOOPS;
+
+    t = lv_test_get_time_us();
+    for(i = 0; i < BENCH_LOOPS; i++) lv_draw_sw_rotate(src_buf, dest_buf, w, h, w, h, LV_DISP_ROT_270);
+    uint32_t tiled_us = (lv_test_get_time_us() - t) / BENCH_LOOPS;
+
+    char msg[128];
+    lv_snprintf(msg, sizeof(msg), "rotate %s (%dx%d): per pixel %" LV_PRIu32 " us, tiled %" LV_PRIu32 " us",
+                name, (int)w, (int)h, ref_us, tiled_us);
+    TEST_MESSAGE(msg);
+
+    TEST_ASSERT_EQUAL_MEMORY(ref_buf, dest_buf, w * h * sizeof(lv_color_t));
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_draw_sw_rotate_90_270(void)
+{
+    /*Sizes which are not multiples of the tile size*/
+    assert_rotation(1, 1, LV_DISP_ROT_90);
+    assert_rotation(37, 5, LV_DISP_ROT_90);
+    assert_rotation(5, 37, LV_DISP_ROT_90);
+    assert_rotation(100, 67, LV_DISP_ROT_90);
+    assert_rotation(1, 1, LV_DISP_ROT_270);
+    assert_rotation(37, 5, LV_DISP_ROT_270);
+    assert_rotation(5, 37, LV_DISP_ROT_270);
+    assert_rotation(100, 67, LV_DISP_ROT_270);
+}
+
+void test_draw_sw_rotate_should_use_strides(void)
+{
+    /*Rotate the middle of a 64x40 buffer into the middle of a 50x80 "frame buffer"*/
+    lv_coord_t src_stride = 64;
+    lv_coord_t dest_stride = 50;
+    lv_coord_t w = 30;
+    lv_coord_t h = 20;
+    fill_src(src_stride, 40);
+    lv_memset_00(dest_buf, sizeof(dest_buf));
+
+    const lv_color_t * src = &src_buf[5 * src_stride + 7];
+    lv_color_t * dest = &dest_buf[10 * dest_stride + 3];
+    lv_draw_sw_rotate(src, dest, w, h, src_stride, dest_stride, LV_DISP_ROT_270);
+
+    lv_coord_t x, y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            TEST_ASSERT_EQUAL_COLOR(src[y * src_stride + x], dest[x * dest_stride + (h - 1 - y)]);
+        }
+    }
+
+    /*Nothing is written outside of the destination area*/
+    TEST_ASSERT_EQUAL_UINT32(0, lv_color_to32(dest_buf[10 * dest_stride + 2]));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_color_to32(dest_buf[10 * dest_stride + 3 + h]));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_color_to32(dest_buf[9 * dest_stride + 3]));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_color_to32(dest_buf[(10 + w) * dest_stride + 3]));
+}
+
+void test_draw_sw_rotate_0_180(void)
+{
+    lv_coord_t w = 37;
+    lv_coord_t h = 11;
+    fill_src(w, h);
+
+    lv_draw_sw_rotate(src_buf, dest_buf, w, h, w, w, LV_DISP_ROT_NONE);
+    TEST_ASSERT_EQUAL_MEMORY(src_buf, dest_buf, w * h * sizeof(lv_color_t));
+
+    lv_draw_sw_rotate(src_buf, dest_buf, w, h, w, w, LV_DISP_ROT_180);
+    lv_coord_t x, y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            TEST_ASSERT_EQUAL_COLOR(src_buf[y * w + x], dest_buf[(h - 1 - y) * w + (w - 1 - x)]);
+        }
+    }
+}
+
+void test_draw_sw_rotate_benchmark(void)
+{
+    bench("1/10 screen", HOR_RES, VER_RES / 10);
+    bench("full screen", HOR_RES, VER_RES);
+}
+
+#endif
@@ -0,0 +1,335 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+/*The fonts of the test configurations*/
+#if LV_USE_FONT_ATLAS && LV_FONT_MONTSERRAT_24 && LV_FONT_MONTSERRAT_48 && LV_FONT_MONTSERRAT_28_COMPRESSED && \
+    LV_FONT_MONTSERRAT_12_SUBPX && LV_FONT_DEJAVU_16_PERSIAN_HEBREW && LV_FONT_SIMSUN_16_CJK
+
+#include "lv_test_helpers.h"
+
+/*Every font is compared to a copy of itself without glyph cache. Such a copy does the cmap and kerning
+ *look-ups every time and decodes the glyphs on every draw, as the fonts did with the single letter cache.*/
+
+#define HOR_RES     800
+#define VER_RES     480
+#define BENCH_LOOPS 20
+
+typedef struct {
+    lv_font_t font;
+    lv_font_fmt_txt_dsc_t dsc;
+    lv_font_fmt_txt_glyph_cache_t cache;
+} font_copy_t;
+
+extern lv_font_t font_3;    /*Kern pairs and compressed bitmaps*/
+extern lv_color_t test_fb[];
+
+static lv_color_t ref_fb[HOR_RES * VER_RES];
+static font_copy_t ref_font;
+static font_copy_t cached_font;
+static lv_obj_t * active_screen = NULL;
+
+static void font_copy_init(font_copy_t * copy, const lv_font_t * font, bool cached)
+{
+    lv_memset_00(copy, sizeof(font_copy_t));
+    copy->font = *font;
+    copy->dsc = *(const lv_font_fmt_txt_dsc_t *)font->dsc;
+    copy->dsc.cache = cached ? &copy->cache : NULL;
+    copy->font.dsc = &copy->dsc;
+    if(cached) TEST_ASSERT_EQUAL(LV_RES_OK, lv_font_fmt_txt_cache_create(&copy->font));
+}
+
+static void font_copy_deinit(font_copy_t * copy)
+{
+    lv_font_fmt_txt_atlas_delete(&copy->font);
+    lv_font_fmt_txt_cache_delete(&copy->font);
+}
+
+static void assert_same_glyphs(const lv_font_t * font, const uint32_t * letters, uint32_t letter_cnt)
+{
+    font_copy_init(&ref_font, font, false);
+    font_copy_init(&cached_font, font, true);
+
+    /*Twice to compare the cache hits too*/
+    uint32_t round;
+    for(round = 0; round < 2; round++) {
+        uint32_t i, j;
+        for(i = 0; i < letter_cnt; i++) {
+            for(j = 0; j < letter_cnt; j++) {
+                lv_font_glyph_dsc_t ref_dsc;
+                lv_font_glyph_dsc_t cached_dsc;
+                bool ref_found = lv_font_get_glyph_dsc(&ref_font.font, &ref_dsc, letters[i], letters[j]);
+                bool cached_found = lv_font_get_glyph_dsc(&cached_font.font, &cached_dsc, letters[i], letters[j]);
+                TEST_ASSERT_EQUAL(ref_found, cached_found);
+                if(!ref_found) continue;
+
+                /*`resolved_font` is the copy itself*/
+                TEST_ASSERT_EQUAL(ref_dsc.adv_w, cached_dsc.adv_w);
+                TEST_ASSERT_EQUAL(ref_dsc.box_w, cached_dsc.box_w);
+                TEST_ASSERT_EQUAL(ref_dsc.box_h, cached_dsc.box_h);
+                TEST_ASSERT_EQUAL(ref_dsc.ofs_x, cached_dsc.ofs_x);
+                TEST_ASSERT_EQUAL(ref_dsc.ofs_y, cached_dsc.ofs_y);
+                TEST_ASSERT_EQUAL(ref_dsc.bpp, cached_dsc.bpp);
+                TEST_ASSERT_EQUAL(ref_dsc.is_placeholder, cached_dsc.is_placeholder);
+            }
+        }
+    }
+
+    font_copy_deinit(&cached_font);
+}
+
+/*ASCII, some letters of other scripts and some which are missing from all fonts*/
+static uint32_t fill_letters(uint32_t * letters)
+{
+    uint32_t cnt = 0;
+    uint32_t i;
+    for(i = 0x20; i < 0x7F; i++) letters[cnt++] = i;
+    letters[cnt++] = 0xB0;      /*Degree sign*/
+    letters[cnt++] = 0x5D0;     /*Hebrew*/
+    letters[cnt++] = 0x628;     /*Arabic*/
+    letters[cnt++] = 0x4E2D;    /*CJK*/
+    letters[cnt++] = 0x6587;
+    letters[cnt++] = 0xF001;    /*Symbol*/
+    letters[cnt++] = 0x1F600;   /*Missing*/
+    letters[cnt++] = '\t';
+    return cnt;
+}
+
+static lv_obj_t * create_label(const lv_font_t * font, const char * txt, lv_coord_t y)
+{
+    lv_obj_t * label = lv_label_create(active_screen);
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_label_set_text(label, txt);
+    lv_obj_set_pos(label, 10, y);
+    return label;
+}
+
+static void render(void)
+{
+    lv_obj_invalidate(active_screen);
+    lv_refr_now(NULL);
+}
+
+/*Labels like on the main screen of the controller*/
+static void create_bench_labels(const lv_font_t * large_font, const lv_font_t * small_font)
+{
+    lv_obj_clean(active_screen);
+    create_label(large_font, "23.5\xC2\xB0" "C", 10);
+    create_label(large_font, "12:34 PM", 70);
+    create_label(small_font, "Vent: Stage 2 opening", 130);
+    create_label(small_font, "Heater: OFF   Shade: Closed", 170);
+    create_label(small_font, "WiFi: Connected 192.168.1.42", 210);
+    create_label(small_font, "Setpoint 24.0\xC2\xB0" "C  Hysteresis 0.5\xC2\xB0" "C", 250);
+    create_label(small_font, "Last reboot 06:15  Power-on reset", 290);
+}
+
+static uint32_t bench_render(void)
+{
+    uint32_t i;
+    uint32_t t = lv_test_get_time_us();
+    for(i = 0; i < BENCH_LOOPS; i++) render();
+    return (lv_test_get_time_us() - t) / BENCH_LOOPS;
+}
+
+static uint32_t bench_layout(const lv_font_t * font)
+{
+    const char * txt = "Greenhouse temperature 23.5\xC2\xB0" "C, vent stage 2, heater off, shade closed. "
+                       "Typical AVAWAY kerning pairs: To, Ty, Vo, Wa, Ye, LT, PA.";
+    lv_point_t size;
+    uint32_t i;
+    uint32_t t = lv_test_get_time_us();
+    for(i = 0; i < BENCH_LOOPS * 10; i++) {
+        lv_txt_get_size(&size, txt, font, 0, 0, 300, LV_TEXT_FLAG_NONE);
+    }
+    return (lv_test_get_time_us() - t) / (BENCH_LOOPS * 10);
+}
+
+void setUp(void)
+{
+    active_screen = lv_scr_act();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+    lv_refr_now(NULL);
+    lv_font_fmt_txt_atlas_delete(&lv_font_montserrat_24);
+    lv_font_fmt_txt_atlas_delete(&lv_font_montserrat_28_compressed);
+    lv_font_fmt_txt_atlas_delete(&lv_font_montserrat_12_subpx);
+}
+
+void test_font_fmt_txt_cache_should_give_the_same_glyphs(void)
+{
+    static uint32_t letters[128];
+    uint32_t cnt = fill_letters(letters);
+
+    assert_same_glyphs(&lv_font_montserrat_24, letters, cnt);               /*Kern classes*/
+    assert_same_glyphs(&font_3, letters, cnt);                              /*Kern pairs*/
+    assert_same_glyphs(&lv_font_dejavu_16_persian_hebrew, letters, cnt);    /*Sparse cmaps*/
+    assert_same_glyphs(&lv_font_simsun_16_cjk, letters, cnt);
+}
+
+void test_font_fmt_txt_atlas_should_render_the_same(void)
+{
+    font_copy_init(&cached_font, &font_3, true);
+
+    const char * txt = "The quick brown fox jumps over the lazy dog. 0123456789 {}[]()!?";
+    create_label(&lv_font_montserrat_24, txt, 10);                  /*4 bpp*/
+    create_label(&lv_font_montserrat_28_compressed, txt, 60);       /*3 bpp, compressed*/
+    create_label(&lv_font_montserrat_12_subpx, txt, 110);           /*Subpixel*/
+    create_label(&cached_font.font, txt, 140);                      /*4 bpp, compressed*/
+
+    lv_obj_t * translucent = create_label(&lv_font_montserrat_24, txt, 180);
+    lv_obj_set_style_text_opa(translucent, LV_OPA_50, 0);
+
+    render();
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_font_fmt_txt_atlas_create(&lv_font_montserrat_24, 0x20, 0x7E));
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_font_fmt_txt_atlas_create(&lv_font_montserrat_28_compressed, 0x20, 0x7E));
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_font_fmt_txt_atlas_create(&lv_font_montserrat_12_subpx, 0x20, 0x7E));
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_font_fmt_txt_atlas_create(&cached_font.font, 0x20, 0x7E));
+
+    lv_font_glyph_dsc_t dsc;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&lv_font_montserrat_28_compressed, &dsc, 'A', 0));
+    TEST_ASSERT_EQUAL(8, dsc.bpp);
+
+    render();
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+
+    lv_obj_clean(active_screen);
+    font_copy_deinit(&cached_font);
+}
+
+void test_font_fmt_txt_atlas_should_cover_only_its_range(void)
+{
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_font_fmt_txt_atlas_create(&lv_font_montserrat_24, '0', '9'));
+
+    lv_font_glyph_dsc_t dsc;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&lv_font_montserrat_24, &dsc, '5', 0));
+    TEST_ASSERT_EQUAL(8, dsc.bpp);
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&lv_font_montserrat_24, &dsc, 'A', 0));
+    TEST_ASSERT_EQUAL(4, dsc.bpp);
+
+    /*Replacing and deleting*/
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_font_fmt_txt_atlas_create(&lv_font_montserrat_24, 'A', 'Z'));
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&lv_font_montserrat_24, &dsc, '5', 0));
+    TEST_ASSERT_EQUAL(4, dsc.bpp);
+    lv_font_fmt_txt_atlas_delete(&lv_font_montserrat_24);
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&lv_font_montserrat_24, &dsc, 'A', 0));
+    TEST_ASSERT_EQUAL(4, dsc.bpp);
+
+    /*Fonts without cache can't store an atlas*/
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_font_fmt_txt_atlas_create(&font_3, 0x20, 0x7E));
+}
+
+void test_font_fmt_txt_cache_should_be_allocated_on_request(void)
+{
+    const lv_font_fmt_txt_dsc_t * fdsc = lv_font_montserrat_24.dsc;
+    TEST_ASSERT_NULL(fdsc->cache->tables);
+
+    uint32_t free_mem = lv_test_get_free_mem();
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_font_fmt_txt_cache_create(&lv_font_montserrat_24));
+    TEST_ASSERT_NOT_NULL(fdsc->cache->tables);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_font_fmt_txt_cache_create(&lv_font_montserrat_24));
+
+    lv_font_glyph_dsc_t dsc;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&lv_font_montserrat_24, &dsc, 'A', 'V'));
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&lv_font_montserrat_24, &dsc, 'A', 'V'));
+
+    lv_font_fmt_txt_cache_delete(&lv_font_montserrat_24);
+    TEST_ASSERT_NULL(fdsc->cache->tables);
+    TEST_ASSERT_EQUAL(free_mem, lv_test_get_free_mem());
+
+    /*Fonts without cache can't store the tables*/
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_font_fmt_txt_cache_create(&font_3));
+}
+
+void test_font_fmt_txt_cache_benchmark(void)
+{
+    char msg[128];
+
+    font_copy_t * ref_large = lv_mem_alloc(sizeof(font_copy_t));
+    font_copy_t * ref_small = lv_mem_alloc(sizeof(font_copy_t));
+    font_copy_t * cached_large = lv_mem_alloc(sizeof(font_copy_t));
+    font_copy_t * cached_small = lv_mem_alloc(sizeof(font_copy_t));
+    font_copy_init(ref_large, &lv_font_montserrat_48, false);
+    font_copy_init(ref_small, &lv_font_montserrat_28_compressed, false);
+    font_copy_init(cached_large, &lv_font_montserrat_48, true);
+    font_copy_init(cached_small, &lv_font_montserrat_28_compressed, true);
+
+    uint32_t ref_layout_us = bench_layout(&font_3);
+    font_copy_init(&cached_font, &font_3, true);
+    uint32_t cached_layout_us = bench_layout(&cached_font.font);
+    font_copy_deinit(&cached_font);
+    lv_snprintf(msg, sizeof(msg), "text layout: no cache %" LV_PRIu32 " us, cached %" LV_PRIu32 " us",
+                ref_layout_us, cached_layout_us);
+    TEST_MESSAGE(msg);
+
+    create_bench_labels(&ref_large->font, &ref_small->font);
+    uint32_t ref_us = bench_render();
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    create_bench_labels(&cached_large->font, &cached_small->font);
+    uint32_t cached_us = bench_render();
+
+    lv_font_fmt_txt_atlas_create(&cached_large->font, 0x20, 0x7E);
+    lv_font_fmt_txt_atlas_create(&cached_small->font, 0x20, 0x7E);
+    uint32_t atlas_us = bench_render();
+
+    lv_snprintf(msg, sizeof(msg), "render labels: no cache %" LV_PRIu32 " us, cached %" LV_PRIu32 " us, "
+                "with atlas %" LV_PRIu32 " us", ref_us, cached_us, atlas_us);
+    TEST_MESSAGE(msg);
+
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+
+    lv_obj_clean(active_screen);
+    font_copy_deinit(cached_large);
+    font_copy_deinit(cached_small);
+    lv_mem_free(ref_large);
+    lv_mem_free(ref_small);
+    lv_mem_free(cached_large);
+    lv_mem_free(cached_small);
+}
+
+#else
+
+void setUp(void)
+{
+
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_font_fmt_txt_cache_should_give_the_same_glyphs(void)
+{
+
+}
+
+void test_font_fmt_txt_atlas_should_render_the_same(void)
+{
+
+}
+
+void test_font_fmt_txt_atlas_should_cover_only_its_range(void)
+{
+
+}
+
+void test_font_fmt_txt_cache_should_be_allocated_on_request(void)
+{
+
+}
+
+void test_font_fmt_txt_cache_benchmark(void)
+{
+
+}
+
+#endif
+
+#endif
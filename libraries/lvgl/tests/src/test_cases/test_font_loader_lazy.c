@@ -0,0 +1,413 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_COLOR_DEPTH == 32
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lv_test_helpers.h"
+
+#define FONT_DIR        "src/test_fonts/"
+#define CJK_FONT        "../examples/assets/font/lv_font_simsun_16_cjk.fnt"
+#define LATIN_FONT      "../examples/assets/font/montserrat-22.fnt"
+#define BROKEN_FONT     "/tmp/lv_font_loader_lazy_broken.fnt"
+#define MAX_LETTERS     2048
+#define BENCH_LOADS     5
+#define HOR_RES         800
+#define VER_RES         480
+
+extern lv_color_t test_fb[];
+
+static const char * fonts[] = {
+    FONT_DIR "font_1.fnt", FONT_DIR "font_2.fnt", FONT_DIR "font_3.fnt", CJK_FONT, LATIN_FONT
+};
+
+static lv_color_t ref_fb[HOR_RES * VER_RES];
+static uint32_t letters[MAX_LETTERS];
+static char text[MAX_LETTERS * 4 + 1];
+
+/*Collect the letters of a font from its cmaps*/
+static uint32_t get_letters(const lv_font_t * font)
+{
+    const lv_font_fmt_txt_dsc_t * dsc = font->dsc;
+    uint32_t cnt = 0;
+    uint32_t i;
+    for(i = 0; i < dsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &dsc->cmaps[i];
+        uint32_t n = cmap->unicode_list ? cmap->list_length : cmap->range_length;
+        uint32_t j;
+        for(j = 0; j < n && cnt < MAX_LETTERS; j++) {
+            letters[cnt++] = cmap->range_start + (cmap->unicode_list ? cmap->unicode_list[j] : j);
+        }
+    }
+    return cnt;
+}
+
+/*Make an UTF-8 text of `cnt` letters of `letters` from `first`, skipping the control characters*/
+static const char * make_text(uint32_t first, uint32_t cnt)
+{
+    char * p = text;
+    uint32_t i;
+    for(i = first; i < first + cnt; i++) {
+        uint32_t c = letters[i];
+        if(c < 0x20 || (c >= 0x7F && c < 0xA0)) continue;
+        if(c < 0x80) {
+            *p++ = (char)c;
+        }
+        else if(c < 0x800) {
+            *p++ = (char)(0xC0 | (c >> 6));
+            *p++ = (char)(0x80 | (c & 0x3F));
+        }
+        else {
+            *p++ = (char)(0xE0 | (c >> 12));
+            *p++ = (char)(0x80 | ((c >> 6) & 0x3F));
+            *p++ = (char)(0x80 | (c & 0x3F));
+        }
+    }
+    *p = '\0';
+    return text;
+}
+
+static void draw_text(const lv_font_t * font, const char * txt)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_obj_t * label = lv_label_create(lv_scr_act());
+    lv_obj_set_width(label, HOR_RES - 20);
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_label_set_text(label, txt);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+static void copy_file(const char * src, const char * dst, long len)
+{
+    FILE * in = fopen(src, "rb");
+    FILE * out = fopen(dst, "wb");
+    TEST_ASSERT_NOT_NULL(in);
+    TEST_ASSERT_NOT_NULL(out);
+    while(len-- > 0) {
+        int c = fgetc(in);
+        if(c == EOF) break;
+        fputc(c, out);
+    }
+    fclose(in);
+    fclose(out);
+}
+
+static long file_size(const char * path)
+{
+    FILE * f = fopen(path, "rb");
+    TEST_ASSERT_NOT_NULL(f);
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fclose(f);
+    return size;
+}
+
+#if LV_MEM_CUSTOM && defined(__SANITIZE_ADDRESS__)
+/*Count the heap usage with the allocator hooks of ASan*/
+#define MEASURE_HEAP    1
+
+/*From <sanitizer/allocator_interface.h>, which is not always installed*/
+int __sanitizer_install_malloc_and_free_hooks(void (*malloc_hook)(const volatile void *, size_t),
+                                              void (*free_hook)(const volatile void *));
+size_t __sanitizer_get_allocated_size(const volatile void * p);
+
+static size_t heap_cur;
+static size_t heap_peak;
+
+static void malloc_hook(const volatile void * p, size_t size)
+{
+    LV_UNUSED(p);
+    heap_cur += size;
+    if(heap_cur > heap_peak) heap_peak = heap_cur;
+}
+
+static void free_hook(const volatile void * p)
+{
+    heap_cur -= __sanitizer_get_allocated_size(p);
+}
+#else
+#define MEASURE_HEAP    0
+#endif
+
+typedef struct {
+    uint32_t load_us;
+    uint32_t render_us;     /*The first frame with the font*/
+    uint32_t kept;          /*Heap used by the font after the first frame*/
+    uint32_t peak;          /*Peak heap of loading and drawing*/
+} bench_res_t;
+
+/*Load a font and draw a text with it. `cache_size` 0: use `lv_font_load()`*/
+static void bench(const char * path, uint32_t cache_size, const char * txt, bench_res_t * res)
+{
+    lv_memset_00(res, sizeof(bench_res_t));
+    uint32_t i;
+    for(i = 0; i < BENCH_LOADS; i++) {
+        lv_obj_clean(lv_scr_act());
+        lv_refr_now(NULL);
+#if MEASURE_HEAP
+        static bool hooks_installed;
+        if(!hooks_installed) __sanitizer_install_malloc_and_free_hooks(malloc_hook, free_hook);
+        hooks_installed = true;
+        size_t heap_start = heap_cur;
+        heap_peak = heap_cur;
+#endif
+        uint32_t t = lv_test_get_time_us();
+        lv_font_t * font = cache_size ? lv_font_load_lazy(path, cache_size) : lv_font_load(path);
+        res->load_us += lv_test_get_time_us() - t;
+        TEST_ASSERT_NOT_NULL(font);
+
+        t = lv_test_get_time_us();
+        draw_text(font, txt);
+        res->render_us += lv_test_get_time_us() - t;
+
+        /*The label is not counted*/
+        lv_obj_clean(lv_scr_act());
+#if MEASURE_HEAP
+        res->kept = heap_cur - heap_start;
+        res->peak = heap_peak - heap_start;
+#endif
+        lv_font_free(font);
+    }
+    res->load_us /= BENCH_LOADS;
+    res->render_us /= BENCH_LOADS;
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    remove(BROKEN_FONT);
+}
+
+void test_font_loader_lazy_should_get_the_same_glyphs(void)
+{
+    uint32_t f;
+    for(f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++) {
+        char path[128];
+        lv_snprintf(path, sizeof(path), "A:%s", fonts[f]);
+        lv_font_t * font = lv_font_load(path);
+        /*One page only, so that almost every glyph is read again*/
+        lv_snprintf(path, sizeof(path), "B:%s", fonts[f]);
+        lv_font_t * lazy = lv_font_load_lazy(path, 1);
+        TEST_ASSERT_NOT_NULL(font);
+        TEST_ASSERT_NOT_NULL(lazy);
+        TEST_ASSERT_EQUAL(font->line_height, lazy->line_height);
+        TEST_ASSERT_EQUAL(font->base_line, lazy->base_line);
+
+        const lv_font_fmt_txt_dsc_t * dsc = font->dsc;
+        uint32_t cnt = get_letters(font);
+        uint32_t i;
+        for(i = 0; i < cnt; i++) {
+            lv_font_glyph_dsc_t g1;
+            lv_font_glyph_dsc_t g2;
+            uint32_t next = letters[(i + 1) % cnt];
+            TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g1, letters[i], next));
+            TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(lazy, &g2, letters[i], next));
+            TEST_ASSERT_EQUAL(g1.adv_w, g2.adv_w);
+            TEST_ASSERT_EQUAL(g1.box_w, g2.box_w);
+            TEST_ASSERT_EQUAL(g1.box_h, g2.box_h);
+            TEST_ASSERT_EQUAL(g1.ofs_x, g2.ofs_x);
+            TEST_ASSERT_EQUAL(g1.ofs_y, g2.ofs_y);
+            TEST_ASSERT_EQUAL(g1.bpp, g2.bpp);
+
+            uint32_t size = ((uint32_t)g1.box_w * g1.box_h * dsc->bpp + 7) / 8;
+            if(size == 0) continue;
+
+            /*Compressed bitmaps are decompressed to the same buffer, so copy the first*/
+            static uint8_t ref[256 * 256];
+            TEST_ASSERT_LESS_OR_EQUAL(sizeof(ref), size);
+            const uint8_t * bmp = lv_font_get_glyph_bitmap(font, letters[i]);
+            TEST_ASSERT_NOT_NULL(bmp);
+            lv_memcpy(ref, bmp, size);
+            bmp = lv_font_get_glyph_bitmap(lazy, letters[i]);
+            TEST_ASSERT_NOT_NULL(bmp);
+            TEST_ASSERT_EQUAL_MEMORY(ref, bmp, size);
+        }
+
+        lv_font_loader_stats_t stats;
+        lv_font_get_lazy_stats(lazy, &stats);
+        TEST_ASSERT_EQUAL_UINT32(1, stats.page_cnt);
+        TEST_ASSERT_GREATER_THAN(0, stats.miss_cnt);
+        TEST_ASSERT_EQUAL_UINT32(stats.miss_cnt - 1, stats.evict_cnt);
+
+        /*Fonts loaded at once have no page cache*/
+        lv_font_get_lazy_stats(font, &stats);
+        TEST_ASSERT_EQUAL_UINT32(0, stats.miss_cnt);
+
+        lv_font_free(font);
+        lv_font_free(lazy);
+    }
+}
+
+void test_font_loader_lazy_should_draw_the_same(void)
+{
+    uint32_t f;
+    for(f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++) {
+        char path[128];
+        lv_snprintf(path, sizeof(path), "A:%s", fonts[f]);
+        lv_font_t * font = lv_font_load(path);
+        lv_font_t * lazy = lv_font_load_lazy(path, 2048);
+        TEST_ASSERT_NOT_NULL(font);
+        TEST_ASSERT_NOT_NULL(lazy);
+
+        const char * txt = make_text(0, LV_MIN(get_letters(font), 600));
+        draw_text(font, txt);
+        lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+        /*The text is there*/
+        uint32_t diff_cnt = 0;
+        uint32_t i;
+        for(i = 0; i < HOR_RES * VER_RES; i++) diff_cnt += ref_fb[i].full != ref_fb[0].full;
+        TEST_ASSERT_GREATER_THAN(1000, diff_cnt);
+
+        draw_text(lazy, txt);
+        TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+
+#if LV_USE_FONT_ATLAS
+        /*The atlas reads the bitmaps the same way*/
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_font_fmt_txt_atlas_create(lazy, ' ', '~'));
+        draw_text(lazy, txt);
+        TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+#endif
+
+        lv_obj_clean(lv_scr_act());
+        lv_font_free(font);
+        lv_font_free(lazy);
+    }
+}
+
+void test_font_loader_lazy_should_stay_in_the_budget(void)
+{
+    lv_font_t * lazy = lv_font_load_lazy("B:" CJK_FONT, 4096);
+    TEST_ASSERT_NOT_NULL(lazy);
+
+    uint32_t cnt = get_letters(lazy);
+    TEST_ASSERT_GREATER_THAN(1000, cnt);
+
+    /*Draw all letters, a screen at a time*/
+    uint32_t i;
+    for(i = 0; i < cnt; i += 500) draw_text(lazy, make_text(i, LV_MIN(cnt - i, 500)));
+
+    lv_font_loader_stats_t stats;
+    lv_font_get_lazy_stats(lazy, &stats);
+    TEST_ASSERT_EQUAL_UINT32(4096 / LV_FONT_LOADER_PAGE_SIZE, stats.page_cnt);
+    TEST_ASSERT_GREATER_THAN(0, stats.evict_cnt);
+    TEST_ASSERT_GREATER_THAN(0, stats.hit_cnt);
+
+    /*The default budget*/
+    lv_obj_clean(lv_scr_act());
+    lv_font_free(lazy);
+    lazy = lv_font_load_lazy("B:" CJK_FONT, 0);
+    TEST_ASSERT_NOT_NULL(lazy);
+    draw_text(lazy, make_text(0, LV_MIN(get_letters(lazy), 500)));
+    lv_font_get_lazy_stats(lazy, &stats);
+    TEST_ASSERT_EQUAL_UINT32(LV_FONT_LOADER_CACHE_SIZE / LV_FONT_LOADER_PAGE_SIZE, stats.page_cnt);
+
+    lv_obj_clean(lv_scr_act());
+    lv_font_free(lazy);
+}
+
+void test_font_loader_lazy_should_reject_broken_files(void)
+{
+    TEST_ASSERT_NULL(lv_font_load_lazy("B:" FONT_DIR "no_such_font.fnt", 0));
+
+    /*Cut the file anywhere: it's either rejected or the missing bitmaps are not found*/
+    long size = file_size(FONT_DIR "font_1.fnt");
+    long len;
+    for(len = 0; len < size; len += 97) {
+        copy_file(FONT_DIR "font_1.fnt", BROKEN_FONT, len);
+        lv_font_t * font = lv_font_load_lazy("B:" BROKEN_FONT, 1024);
+        TEST_ASSERT_NULL(font);
+    }
+
+    /*Cut the file after loading it*/
+    copy_file(FONT_DIR "font_3.fnt", BROKEN_FONT, file_size(FONT_DIR "font_3.fnt"));
+    lv_font_t * font = lv_font_load_lazy("B:" BROKEN_FONT, 1024);
+    TEST_ASSERT_NOT_NULL(font);
+    copy_file(FONT_DIR "font_3.fnt", BROKEN_FONT, 1000);
+    uint32_t cnt = get_letters(font);
+    uint32_t null_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_font_glyph_dsc_t g;
+        if(!lv_font_get_glyph_dsc(font, &g, letters[i], 0) || g.box_w == 0) continue;
+        if(lv_font_get_glyph_bitmap(font, letters[i]) == NULL) null_cnt++;
+    }
+    TEST_ASSERT_GREATER_THAN(0, null_cnt);
+    draw_text(font, make_text(0, cnt));
+    lv_obj_clean(lv_scr_act());
+    lv_font_free(font);
+}
+
+void test_font_loader_lazy_benchmark(void)
+{
+    static const char * paths[] = {"A:" CJK_FONT, "A:" LATIN_FONT};
+    static const char * names[] = {"SimSun 16 CJK", "Montserrat 22"};
+    uint32_t f;
+    for(f = 0; f < 2; f++) {
+        lv_font_t * font = lv_font_load(paths[f]);
+        TEST_ASSERT_NOT_NULL(font);
+        /*A screen of text*/
+        char * txt = lv_mem_alloc(sizeof(text));
+        strcpy(txt, make_text(0, LV_MIN(get_letters(font), 300)));
+        lv_font_free(font);
+
+        bench_res_t all;
+        bench_res_t lazy;
+        bench(paths[f], 0, txt, &all);
+        bench(paths[f], LV_FONT_LOADER_CACHE_SIZE, txt, &lazy);
+        lv_mem_free(txt);
+
+        char msg[256];
+        lv_snprintf(msg, sizeof(msg), "%s: lv_font_load %" LV_PRIu32 " us + first frame %" LV_PRIu32 " us, %" LV_PRIu32
+                    " B kept, %" LV_PRIu32 " B peak; lazy %" LV_PRIu32 " us + %" LV_PRIu32 " us, %" LV_PRIu32 " B kept, %"
+                    LV_PRIu32 " B peak", names[f], all.load_us, all.render_us, all.kept, all.peak,
+                    lazy.load_us, lazy.render_us, lazy.kept, lazy.peak);
+        TEST_MESSAGE(msg);
+#if MEASURE_HEAP
+        TEST_ASSERT_LESS_THAN(all.kept, lazy.kept);
+#endif
+    }
+}
+
+#else /*LV_COLOR_DEPTH == 32*/
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_font_loader_lazy_should_get_the_same_glyphs(void)
+{
+}
+
+void test_font_loader_lazy_should_draw_the_same(void)
+{
+}
+
+void test_font_loader_lazy_should_stay_in_the_budget(void)
+{
+}
+
+void test_font_loader_lazy_should_reject_broken_files(void)
+{
+}
+
+void test_font_loader_lazy_benchmark(void)
+{
+}
+
+#endif /*LV_COLOR_DEPTH == 32*/
+
+#endif
@@ -0,0 +1,275 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_IMG_FSCACHE && LV_USE_PNG && LV_COLOR_DEPTH == 32
+
+#include <stdio.h>
+#include <sys/stat.h>
+#include "lv_test_helpers.h"
+#include <unistd.h>
+
+/*The cache files are written with the POSIX driver*/
+#define CACHE_DIR       "B:/tmp/lv_img_fscache_test"
+#define CACHE_DIR_FS    "/tmp/lv_img_fscache_test"
+#define PNG_SRC         "src/test_files/timg/cgflogo.png"
+#define BENCH_LOADS     10
+#define HOR_RES         800
+#define VER_RES         480
+
+extern lv_color_t test_fb[];
+
+static lv_color_t ref_fb[HOR_RES * VER_RES];
+static lv_obj_t * active_screen = NULL;
+static lv_obj_t * img;
+
+/*Make a copy of the PNG with `extra` bytes after it, so that the image is the same but the hash is not*/
+static void make_png(const char * name, uint32_t extra)
+{
+    char path[128];
+    lv_snprintf(path, sizeof(path), CACHE_DIR_FS "/%s", name);
+    FILE * in = fopen(PNG_SRC, "rb");
+    FILE * out = fopen(path, "wb");
+    TEST_ASSERT_NOT_NULL(in);
+    TEST_ASSERT_NOT_NULL(out);
+
+    uint8_t buf[1024];
+    size_t n;
+    while((n = fread(buf, 1, sizeof(buf), in)) > 0) fwrite(buf, 1, n, out);
+    while(extra--) fputc(0, out);
+    fclose(in);
+    fclose(out);
+}
+
+static void truncate_slot(uint32_t id)
+{
+    char path[128];
+    lv_snprintf(path, sizeof(path), CACHE_DIR_FS "/imgcache_%02d.bin", (int)id);
+    TEST_ASSERT_EQUAL(0, truncate(path, 1000));
+}
+
+/*Draw an image with empty image cache, like after a restart*/
+static void draw(const char * src)
+{
+    lv_img_cache_invalidate_src(NULL);
+    lv_img_set_src(img, src);
+    lv_obj_invalidate(active_screen);
+    lv_refr_now(NULL);
+}
+
+static const lv_img_fscache_stats_t * stats_diff(void)
+{
+    static lv_img_fscache_stats_t last;
+    static lv_img_fscache_stats_t diff;
+    const lv_img_fscache_stats_t * s = lv_img_fscache_get_stats();
+    diff.hit_cnt = s->hit_cnt - last.hit_cnt;
+    diff.miss_cnt = s->miss_cnt - last.miss_cnt;
+    diff.write_cnt = s->write_cnt - last.write_cnt;
+    diff.evict_cnt = s->evict_cnt - last.evict_cnt;
+    last = *s;
+    return &diff;
+}
+
+void setUp(void)
+{
+    /*Start with an empty cache*/
+    mkdir(CACHE_DIR_FS, 0755);
+    uint32_t i;
+    for(i = 0; i < LV_IMG_FSCACHE_SLOTS; i++) {
+        char path[128];
+        lv_snprintf(path, sizeof(path), CACHE_DIR_FS "/imgcache_%02d.bin", (int)i);
+        unlink(path);
+    }
+
+    active_screen = lv_scr_act();
+    img = lv_img_create(active_screen);
+    lv_obj_center(img);
+
+    lv_img_fscache_set_dir(NULL);
+    draw("A:" PNG_SRC);
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    lv_img_fscache_set_dir(CACHE_DIR);
+    stats_diff();
+}
+
+void tearDown(void)
+{
+    lv_img_fscache_set_dir(NULL);
+    lv_obj_clean(active_screen);
+    lv_img_cache_invalidate_src(NULL);
+}
+
+void test_img_fscache_should_decode_once(void)
+{
+    /*Cold: decoded and saved*/
+    draw("A:" PNG_SRC);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+    const lv_img_fscache_stats_t * s = stats_diff();
+    TEST_ASSERT_EQUAL_UINT32(0, s->hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, s->miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, s->write_cnt);
+
+    /*Warm*/
+    draw("A:" PNG_SRC);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+    s = stats_diff();
+    TEST_ASSERT_EQUAL_UINT32(1, s->hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, s->miss_cnt);
+
+    /*Also after a restart, and with an other path to the same content*/
+    lv_img_fscache_set_dir(CACHE_DIR);
+    make_png("copy.png", 0);
+    draw("B:" CACHE_DIR_FS "/copy.png");
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+    s = stats_diff();
+    TEST_ASSERT_EQUAL_UINT32(1, s->hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, s->miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, s->write_cnt);
+
+    /*The opaque image is saved without alpha channel*/
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, "A:" PNG_SRC, lv_color_white(), 0));
+    TEST_ASSERT_EQUAL(LV_IMG_CF_TRUE_COLOR, dsc.header.cf);
+    TEST_ASSERT_NOT_NULL(dsc.img_data);
+    lv_img_decoder_close(&dsc);
+}
+
+void test_img_fscache_should_notice_changed_files(void)
+{
+    make_png("a.png", 0);
+    draw("B:" CACHE_DIR_FS "/a.png");
+    draw("B:" CACHE_DIR_FS "/a.png");
+    const lv_img_fscache_stats_t * s = stats_diff();
+    TEST_ASSERT_EQUAL_UINT32(1, s->hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, s->miss_cnt);
+
+    /*Same path, other content*/
+    make_png("a.png", 1);
+    draw("B:" CACHE_DIR_FS "/a.png");
+    s = stats_diff();
+    TEST_ASSERT_EQUAL_UINT32(0, s->hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, s->miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, s->write_cnt);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+}
+
+/*LV_IMG_FSCACHE_MAX_SIZE is set to keep 3 images in the tests*/
+void test_img_fscache_should_evict_the_least_recently_used(void)
+{
+    make_png("a.png", 0);
+    make_png("b.png", 1);
+    make_png("c.png", 2);
+    make_png("d.png", 3);
+
+    draw("B:" CACHE_DIR_FS "/a.png");
+    draw("B:" CACHE_DIR_FS "/b.png");
+    draw("B:" CACHE_DIR_FS "/c.png");
+    draw("B:" CACHE_DIR_FS "/a.png");
+    const lv_img_fscache_stats_t * s = stats_diff();
+    TEST_ASSERT_EQUAL_UINT32(1, s->hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, s->write_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, s->evict_cnt);
+
+    /*"b" is the least recently used*/
+    draw("B:" CACHE_DIR_FS "/d.png");
+    s = stats_diff();
+    TEST_ASSERT_EQUAL_UINT32(1, s->write_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, s->evict_cnt);
+
+    draw("B:" CACHE_DIR_FS "/a.png");
+    draw("B:" CACHE_DIR_FS "/c.png");
+    draw("B:" CACHE_DIR_FS "/d.png");
+    s = stats_diff();
+    TEST_ASSERT_EQUAL_UINT32(3, s->hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, s->miss_cnt);
+
+    draw("B:" CACHE_DIR_FS "/b.png");
+    s = stats_diff();
+    TEST_ASSERT_EQUAL_UINT32(1, s->miss_cnt);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+}
+
+void test_img_fscache_should_replace_broken_files(void)
+{
+    draw("A:" PNG_SRC);
+    truncate_slot(0);
+
+    lv_img_fscache_set_dir(CACHE_DIR);
+    stats_diff();
+    draw("A:" PNG_SRC);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+    const lv_img_fscache_stats_t * s = stats_diff();
+    TEST_ASSERT_EQUAL_UINT32(0, s->hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, s->miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, s->write_cnt);
+
+    draw("A:" PNG_SRC);
+    TEST_ASSERT_EQUAL_UINT32(1, stats_diff()->hit_cnt);
+}
+
+void test_img_fscache_benchmark(void)
+{
+    uint32_t i;
+
+    lv_img_fscache_set_dir(NULL);
+    uint32_t t = lv_test_get_time_us();
+    for(i = 0; i < BENCH_LOADS; i++) draw("A:" PNG_SRC);
+    uint32_t no_cache_us = (lv_test_get_time_us() - t) / BENCH_LOADS;
+
+    uint32_t cold_us = 0;
+    for(i = 0; i < BENCH_LOADS; i++) {
+        char path[128];
+        lv_snprintf(path, sizeof(path), CACHE_DIR_FS "/imgcache_%02d.bin", 0);
+        unlink(path);
+        lv_img_fscache_set_dir(CACHE_DIR);
+        t = lv_test_get_time_us();
+        draw("A:" PNG_SRC);
+        cold_us += lv_test_get_time_us() - t;
+    }
+    cold_us /= BENCH_LOADS;
+
+    t = lv_test_get_time_us();
+    for(i = 0; i < BENCH_LOADS; i++) draw("A:" PNG_SRC);
+    uint32_t warm_us = (lv_test_get_time_us() - t) / BENCH_LOADS;
+
+    char msg[160];
+    lv_snprintf(msg, sizeof(msg), "PNG 300x173 load + draw: no cache %" LV_PRIu32 " us, cold %" LV_PRIu32 " us, warm %"
+                LV_PRIu32 " us", no_cache_us, cold_us, warm_us);
+    TEST_MESSAGE(msg);
+}
+
+#else /*LV_USE_IMG_FSCACHE && LV_USE_PNG && LV_COLOR_DEPTH == 32*/
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_img_fscache_should_decode_once(void)
+{
+}
+
+void test_img_fscache_should_notice_changed_files(void)
+{
+}
+
+void test_img_fscache_should_evict_the_least_recently_used(void)
+{
+}
+
+void test_img_fscache_should_replace_broken_files(void)
+{
+}
+
+void test_img_fscache_benchmark(void)
+{
+}
+
+#endif /*LV_USE_IMG_FSCACHE && LV_USE_PNG && LV_COLOR_DEPTH == 32*/
+
+#endif
@@ -0,0 +1,309 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_LABEL_LAYOUT_CACHE && LV_FONT_MONTSERRAT_14 && LV_FONT_MONTSERRAT_18 && LV_FONT_MONTSERRAT_24 && \
+    LV_FONT_MONTSERRAT_48
+
+#include "lv_test_helpers.h"
+
+#define BENCH_LOOPS 100
+
+static lv_obj_t * active_screen = NULL;
+
+static lv_obj_t * create_label(lv_obj_t * parent, const lv_font_t * font, const char * txt, lv_coord_t x,
+                               lv_coord_t y)
+{
+    lv_obj_t * label = lv_label_create(parent);
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_label_set_text(label, txt);
+    lv_obj_set_pos(label, x, y);
+    return label;
+}
+
+/*The measured lines have to be the same as the ones `lv_draw_label()` would find*/
+static void assert_layout(lv_obj_t * obj)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    lv_coord_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
+    lv_coord_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
+    lv_coord_t max_w = lv_obj_get_content_width(obj);
+    lv_text_flag_t flag = LV_TEXT_FLAG_NONE;
+    if(label->recolor) flag |= LV_TEXT_FLAG_RECOLOR;
+    if(label->expand) flag |= LV_TEXT_FLAG_EXPAND;
+    if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT) flag |= LV_TEXT_FLAG_FIT;
+
+    /*Measured with the current parameters*/
+    TEST_ASSERT_NOT_NULL(label->layout_lines);
+    TEST_ASSERT_EQUAL_PTR(label->text, label->layout_key.text);
+    TEST_ASSERT_EQUAL_PTR(font, label->layout_key.font);
+    TEST_ASSERT_EQUAL(letter_space, label->layout_key.letter_space);
+    TEST_ASSERT_EQUAL(line_space, label->layout_key.line_space);
+    if((flag & (LV_TEXT_FLAG_FIT | LV_TEXT_FLAG_EXPAND)) == 0) TEST_ASSERT_EQUAL(max_w, label->layout_key.max_w);
+
+    const char * txt = label->text;
+    uint32_t line_start = 0;
+    uint32_t i = 0;
+    while(txt[line_start] != '\0') {
+        uint32_t line_end = line_start + _lv_txt_get_next_line(&txt[line_start], font, letter_space, max_w, NULL, flag);
+        TEST_ASSERT_LESS_THAN_UINT32(label->layout_line_cnt, i);
+        TEST_ASSERT_EQUAL_UINT32(line_start, label->layout_lines[i].start);
+        TEST_ASSERT_EQUAL(lv_txt_get_width(&txt[line_start], line_end - line_start, font, letter_space, flag),
+                          label->layout_lines[i].w);
+        line_start = line_end;
+        i++;
+    }
+    TEST_ASSERT_EQUAL_UINT32(i, label->layout_line_cnt);
+    TEST_ASSERT_EQUAL_UINT32(strlen(txt), label->layout_lines[i].start);
+
+    lv_point_t size;
+    lv_txt_get_size(&size, txt, font, letter_space, line_space, max_w, flag);
+    TEST_ASSERT_EQUAL(size.x, label->layout_size.x);
+    TEST_ASSERT_EQUAL(size.y, label->layout_size.y);
+}
+
+/*The labels of `ui_MainScreen` of the controller: content sized labels on three panels*/
+static void create_main_screen(lv_obj_t ** labels, uint32_t * label_cnt)
+{
+    static const char * status_txts[] = {"Wifi", "Vent", "Heat", "Shade", "Status", "status", "status", "status"};
+    static const char * setting_txts[] = {"Vent", "Heat", "Settings", "Shade", "Boost", "25%:", "50%:", "100%:",
+                                          "Day: ", "Night:", "Start:", "Open:", "Close:", "Temp:", "Dur:"
+                                         };
+    static const char * value_txts[] = {"25.0", "25.0", "25.0", "25.0", "25.0", "7:00", "17:00", "7:00", "17:30",
+                                        "12:00", "26.5", "30"
+                                       };
+    uint32_t cnt = 0;
+    uint32_t i;
+
+    lv_obj_t * panel1 = lv_obj_create(active_screen);
+    lv_obj_set_size(panel1, 351, 238);
+    lv_obj_set_pos(panel1, 0, 0);
+    labels[cnt++] = create_label(panel1, &lv_font_montserrat_48, "25.0\xC2\xB0" "C", 180, 60);
+    labels[cnt++] = create_label(panel1, &lv_font_montserrat_24, "Current Temp:", 10, 70);
+
+    lv_obj_t * panel2 = lv_obj_create(active_screen);
+    lv_obj_set_size(panel2, 230, 240);
+    lv_obj_set_pos(panel2, 0, 240);
+    for(i = 0; i < sizeof(status_txts) / sizeof(status_txts[0]); i++) {
+        labels[cnt++] = create_label(panel2, i < 5 ? &lv_font_montserrat_24 : &lv_font_montserrat_18, status_txts[i],
+                                     i < 5 ? 0 : 100, (i % 5) * 40);
+    }
+
+    lv_obj_t * panel3 = lv_obj_create(active_screen);
+    lv_obj_set_size(panel3, 420, 480);
+    lv_obj_set_pos(panel3, 360, 0);
+    for(i = 0; i < sizeof(setting_txts) / sizeof(setting_txts[0]); i++) {
+        labels[cnt++] = create_label(panel3, i == 2 ? &lv_font_montserrat_24 : &lv_font_montserrat_18, setting_txts[i],
+                                     0, i * 28);
+    }
+    for(i = 0; i < sizeof(value_txts) / sizeof(value_txts[0]); i++) {
+        labels[cnt++] = create_label(panel3, &lv_font_montserrat_14, value_txts[i], 200, i * 34);
+    }
+
+    *label_cnt = cnt;
+}
+
+void setUp(void)
+{
+    active_screen = lv_scr_act();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+}
+
+void test_label_layout_cache_should_match_the_measured_text(void)
+{
+    const char * long_txt = "The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs.";
+
+    lv_obj_t * labels[10];
+    labels[0] = create_label(active_screen, &lv_font_montserrat_24, long_txt, 10, 10);
+    lv_obj_set_width(labels[0], 300);
+    labels[1] = create_label(active_screen, &lv_font_montserrat_18, "Content\nsized\r\nlabel\n", 10, 200);
+    labels[2] = create_label(active_screen, &lv_font_montserrat_14, "", 10, 300);
+    labels[3] = create_label(active_screen, &lv_font_montserrat_18, "#ff0000 Re-colored# text #00ff00 in# a label",
+                             400, 10);
+    lv_label_set_recolor(labels[3], true);
+    lv_obj_set_width(labels[3], 150);
+    labels[4] = create_label(active_screen, &lv_font_montserrat_18, long_txt, 400, 150);
+    lv_obj_set_width(labels[4], 200);
+    lv_obj_set_style_text_letter_space(labels[4], 3, 0);
+    lv_obj_set_style_text_line_space(labels[4], 5, 0);
+    labels[5] = create_label(active_screen, &lv_font_montserrat_14, "Averyveryverylongwordwithoutanyspaces", 400, 350);
+    lv_obj_set_width(labels[5], 100);
+    labels[6] = create_label(active_screen, &lv_font_montserrat_18, long_txt, 400, 420);
+    lv_obj_set_width(labels[6], 200);
+    lv_label_set_long_mode(labels[6], LV_LABEL_LONG_SCROLL_CIRCULAR);
+
+    lv_refr_now(NULL);
+
+    uint32_t i;
+    for(i = 0; i < 7; i++) assert_layout(labels[i]);
+}
+
+void test_label_layout_cache_should_be_invalidated(void)
+{
+    static char static_txt[] = "Static text";
+
+    lv_obj_t * label = create_label(active_screen, &lv_font_montserrat_18, "Short", 10, 10);
+    lv_refr_now(NULL);
+    assert_layout(label);
+    TEST_ASSERT_EQUAL_UINT32(1, ((lv_label_t *)label)->layout_line_cnt);
+
+    lv_label_set_text(label, "Two\nlines");
+    lv_refr_now(NULL);
+    assert_layout(label);
+    TEST_ASSERT_EQUAL_UINT32(2, ((lv_label_t *)label)->layout_line_cnt);
+
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_48, 0);
+    lv_refr_now(NULL);
+    assert_layout(label);
+
+    lv_obj_set_style_text_letter_space(label, 4, 0);
+    lv_refr_now(NULL);
+    assert_layout(label);
+
+    lv_label_set_text(label, "A text which is wrapped to a few lines");
+    lv_obj_set_width(label, 200);
+    lv_refr_now(NULL);
+    assert_layout(label);
+    uint32_t line_cnt = ((lv_label_t *)label)->layout_line_cnt;
+
+    lv_obj_set_width(label, 400);
+    lv_refr_now(NULL);
+    assert_layout(label);
+    TEST_ASSERT_LESS_THAN_UINT32(line_cnt, ((lv_label_t *)label)->layout_line_cnt);
+
+    /*The same pointer with other content*/
+    lv_label_set_text_static(label, static_txt);
+    lv_refr_now(NULL);
+    assert_layout(label);
+    strcpy(static_txt, "Static\ntext");
+    lv_label_set_text_static(label, static_txt);
+    lv_refr_now(NULL);
+    assert_layout(label);
+    TEST_ASSERT_EQUAL_UINT32(2, ((lv_label_t *)label)->layout_line_cnt);
+
+    /*The dots are written into the text*/
+    lv_label_set_text(label, "A text which is too long for the label");
+    lv_label_set_long_mode(label, LV_LABEL_LONG_DOT);
+    lv_obj_set_height(label, 60);
+    lv_refr_now(NULL);
+    assert_layout(label);
+}
+
+void test_label_layout_cache_should_draw_the_same(void)
+{
+    const char * txt = "Line breaks are measured once\nand reused while the text, the font and the width don't change.";
+
+    lv_obj_t * label = create_label(active_screen, &lv_font_montserrat_24, txt, 10, 10);
+    lv_obj_set_width(label, 350);
+    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, 0);
+
+    label = create_label(active_screen, &lv_font_montserrat_18, txt, 420, 10);
+    lv_obj_set_width(label, 350);
+    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_RIGHT, 0);
+    lv_obj_set_style_text_letter_space(label, 2, 0);
+    lv_obj_set_style_text_line_space(label, 6, 0);
+
+    label = create_label(active_screen, &lv_font_montserrat_18, "#ff0000 Re-colored# and\n#0000ff centered#", 10, 200);
+    lv_label_set_recolor(label, true);
+    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, 0);
+
+    label = create_label(active_screen, &lv_font_montserrat_24, txt, 420, 200);
+    lv_obj_set_size(label, 300, 60);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_DOT);
+
+    label = create_label(active_screen, &lv_font_montserrat_18, txt, 10, 320);
+    lv_obj_set_width(label, 300);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_CLIP);
+
+    label = create_label(active_screen, &lv_font_montserrat_48, "25.0\xC2\xB0" "C", 420, 320);
+    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_RIGHT, 0);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("label_layout_cache.png");
+}
+
+void test_label_layout_cache_benchmark(void)
+{
+    static lv_obj_t * labels[64];
+    uint32_t label_cnt;
+    create_main_screen(labels, &label_cnt);
+    lv_refr_now(NULL);
+
+    /*Without the cache every refresh of a label measured its text: a layout pass per label*/
+    uint32_t i, j;
+    uint32_t t = lv_test_get_time_us();
+    for(i = 0; i < BENCH_LOOPS; i++) {
+        for(j = 0; j < label_cnt; j++) {
+            lv_obj_t * obj = labels[j];
+            lv_point_t size;
+            lv_txt_get_size(&size, lv_label_get_text(obj), lv_obj_get_style_text_font(obj, LV_PART_MAIN),
+                            lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN),
+                            lv_obj_get_style_text_line_space(obj, LV_PART_MAIN), LV_COORD_MAX, LV_TEXT_FLAG_FIT);
+        }
+    }
+    uint32_t measure_us = lv_test_get_time_us() - t;
+
+    t = lv_test_get_time_us();
+    for(i = 0; i < BENCH_LOOPS; i++) {
+        for(j = 0; j < label_cnt; j++) lv_obj_refresh_self_size(labels[j]);
+    }
+    uint32_t cached_us = lv_test_get_time_us() - t;
+
+    char msg[128];
+    lv_snprintf(msg, sizeof(msg), "layout of %" LV_PRIu32 " labels x %d: measured %" LV_PRIu32 " us, cached %"
+                LV_PRIu32 " us", label_cnt, BENCH_LOOPS, measure_us, cached_us);
+    TEST_MESSAGE(msg);
+
+    /*Redraw the screen and update a value like the controller does*/
+    t = lv_test_get_time_us();
+    for(i = 0; i < BENCH_LOOPS; i++) {
+        lv_label_set_text_fmt(labels[0], "%d.%d\xC2\xB0" "C", 20 + (int)(i % 10), (int)(i % 7));
+        lv_obj_invalidate(active_screen);
+        lv_refr_now(NULL);
+    }
+    lv_snprintf(msg, sizeof(msg), "main screen refresh: %" LV_PRIu32 " us", (lv_test_get_time_us() - t) / BENCH_LOOPS);
+    TEST_MESSAGE(msg);
+
+    for(j = 0; j < label_cnt; j++) assert_layout(labels[j]);
+}
+
+#else
+
+void setUp(void)
+{
+
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_label_layout_cache_should_match_the_measured_text(void)
+{
+
+}
+
+void test_label_layout_cache_should_be_invalidated(void)
+{
+
+}
+
+void test_label_layout_cache_should_draw_the_same(void)
+{
+
+}
+
+void test_label_layout_cache_benchmark(void)
+{
+
+}
+
+#endif
+
+#endif
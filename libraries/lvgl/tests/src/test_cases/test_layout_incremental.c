@@ -0,0 +1,210 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_FLEX
+
+#include "lv_test_helpers.h"
+
+#define ROW_CNT         200
+#define CHANGED_ROW     100
+#define BENCH_LOOPS     100
+
+static lv_obj_t * active_screen = NULL;
+static lv_obj_t * list;
+static lv_obj_t * rows[ROW_CNT];
+static lv_obj_t * values[ROW_CNT];
+static uint32_t row_layout_cnt[ROW_CNT];
+static uint32_t list_layout_cnt;
+
+static void layout_changed_cb(lv_event_t * e)
+{
+    uint32_t * cnt = lv_event_get_user_data(e);
+    (*cnt)++;
+}
+
+/*A settings page: a column with content height and rows with a name and a value*/
+static void create_list(void)
+{
+    list = lv_obj_create(active_screen);
+    lv_obj_set_size(list, 400, LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(list, LV_FLEX_FLOW_COLUMN);
+    lv_obj_add_event_cb(list, layout_changed_cb, LV_EVENT_LAYOUT_CHANGED, &list_layout_cnt);
+
+    uint32_t i;
+    for(i = 0; i < ROW_CNT; i++) {
+        rows[i] = lv_obj_create(list);
+        lv_obj_set_size(rows[i], lv_pct(100), LV_SIZE_CONTENT);
+        lv_obj_set_flex_flow(rows[i], LV_FLEX_FLOW_ROW);
+        lv_obj_set_flex_align(rows[i], LV_FLEX_ALIGN_SPACE_BETWEEN, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+        lv_obj_add_event_cb(rows[i], layout_changed_cb, LV_EVENT_LAYOUT_CHANGED, &row_layout_cnt[i]);
+
+        lv_obj_t * name = lv_label_create(rows[i]);
+        lv_label_set_text_fmt(name, "Setting %d", (int)i);
+
+        values[i] = lv_label_create(rows[i]);
+        lv_label_set_text(values[i], "10");
+    }
+
+    lv_obj_update_layout(active_screen);
+}
+
+static void reset_counters(void)
+{
+    lv_memset_00(row_layout_cnt, sizeof(row_layout_cnt));
+    list_layout_cnt = 0;
+}
+
+static uint32_t get_relayouted_row_cnt(void)
+{
+    uint32_t cnt = 0;
+    uint32_t i;
+    for(i = 0; i < ROW_CNT; i++) {
+        if(row_layout_cnt[i]) cnt++;
+    }
+    return cnt;
+}
+
+static void assert_rows_stacked(void)
+{
+    lv_coord_t gap = lv_obj_get_style_pad_row(list, LV_PART_MAIN);
+    uint32_t i;
+    for(i = 1; i < ROW_CNT; i++) {
+        TEST_ASSERT_EQUAL(rows[i - 1]->coords.y2 + 1 + gap, rows[i]->coords.y1);
+    }
+    TEST_ASSERT_EQUAL(rows[ROW_CNT - 1]->coords.y2 + lv_obj_get_style_pad_bottom(list, LV_PART_MAIN) +
+                      lv_obj_get_style_border_width(list, LV_PART_MAIN), list->coords.y2);
+}
+
+void setUp(void)
+{
+    active_screen = lv_scr_act();
+    create_list();
+    reset_counters();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+}
+
+void test_layout_should_update_only_the_changed_row(void)
+{
+    /*The row keeps its size so the list is not updated*/
+    lv_label_set_text(values[CHANGED_ROW], "20");
+    lv_obj_update_layout(active_screen);
+
+    TEST_ASSERT_EQUAL_UINT32(1, row_layout_cnt[CHANGED_ROW]);
+    TEST_ASSERT_EQUAL_UINT32(1, get_relayouted_row_cnt());
+    TEST_ASSERT_EQUAL_UINT32(0, list_layout_cnt);
+}
+
+void test_layout_should_update_only_the_list_if_a_row_grows(void)
+{
+    lv_coord_t list_h = lv_obj_get_height(list);
+    lv_coord_t last_y = rows[ROW_CNT - 1]->coords.y1;
+    lv_coord_t first_y = rows[0]->coords.y1;
+
+    lv_label_set_text(values[CHANGED_ROW], "20\n30");
+    lv_obj_update_layout(active_screen);
+
+    lv_coord_t diff = lv_obj_get_height(list) - list_h;
+    TEST_ASSERT_GREATER_THAN(0, diff);
+    TEST_ASSERT_EQUAL(last_y + diff, rows[ROW_CNT - 1]->coords.y1);
+    TEST_ASSERT_EQUAL(first_y, rows[0]->coords.y1);
+    assert_rows_stacked();
+
+    /*The other rows are only moved, not updated*/
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1, list_layout_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, get_relayouted_row_cnt());
+}
+
+void test_layout_should_update_the_rows_depending_on_the_size(void)
+{
+    /*The rows have 100% width*/
+    lv_obj_set_width(list, 300);
+    lv_obj_update_layout(active_screen);
+
+    TEST_ASSERT_EQUAL_UINT32(ROW_CNT, get_relayouted_row_cnt());
+    TEST_ASSERT_EQUAL(lv_obj_get_content_width(list), lv_obj_get_width(rows[0]));
+    TEST_ASSERT_EQUAL(lv_obj_get_content_width(list), lv_obj_get_width(rows[ROW_CNT - 1]));
+    assert_rows_stacked();
+}
+
+/*Layout time when one row changes compared to updating all the rows*/
+void test_layout_benchmark(void)
+{
+    static const char * texts[] = {"20", "20\n30"};
+    uint32_t dirty_us[2];
+    uint32_t full_us[2];
+    uint32_t t;
+    uint32_t i;
+    uint32_t k;
+
+    for(k = 0; k < 2; k++) {
+        /*Change the value of one row*/
+        t = lv_test_get_time_us();
+        for(i = 0; i < BENCH_LOOPS; i++) {
+            lv_label_set_text(values[CHANGED_ROW], (i & 1) ? "10" : texts[k]);
+            lv_obj_update_layout(active_screen);
+        }
+        dirty_us[k] = lv_test_get_time_us() - t;
+
+        /*The same but update all the rows as if each was changed*/
+        t = lv_test_get_time_us();
+        for(i = 0; i < BENCH_LOOPS; i++) {
+            lv_label_set_text(values[CHANGED_ROW], (i & 1) ? "10" : texts[k]);
+            uint32_t r;
+            for(r = 0; r < ROW_CNT; r++) lv_obj_mark_layout_as_dirty(rows[r]);
+            lv_obj_update_layout(active_screen);
+        }
+        full_us[k] = lv_test_get_time_us() - t;
+    }
+
+    assert_rows_stacked();
+
+    char msg[160];
+    lv_snprintf(msg, sizeof(msg), "%d rows, one row changes: %" LV_PRIu32 " us/update, all rows updated: %" LV_PRIu32
+                " us/update", ROW_CNT, dirty_us[0] / BENCH_LOOPS, full_us[0] / BENCH_LOOPS);
+    TEST_MESSAGE(msg);
+    lv_snprintf(msg, sizeof(msg), "%d rows, one row grows: %" LV_PRIu32 " us/update, all rows updated: %" LV_PRIu32
+                " us/update", ROW_CNT, dirty_us[1] / BENCH_LOOPS, full_us[1] / BENCH_LOOPS);
+    TEST_MESSAGE(msg);
+}
+
+#else
+
+void setUp(void)
+{
+
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_layout_should_update_only_the_changed_row(void)
+{
+
+}
+
+void test_layout_should_update_only_the_list_if_a_row_grows(void)
+{
+
+}
+
+void test_layout_should_update_the_rows_depending_on_the_size(void)
+{
+
+}
+
+void test_layout_benchmark(void)
+{
+
+}
+
+#endif
+
+#endif
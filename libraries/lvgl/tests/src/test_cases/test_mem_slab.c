@@ -0,0 +1,378 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_MEM_CUSTOM == 0 && LV_MEM_SLAB_SIZE
+
+#include "../../src/misc/lv_tlsf.h"
+#include <stdlib.h>
+
+#define TRACE_SLOT_CNT      4096
+#define TRACE_OP_CNT        400000
+
+typedef enum {
+    TRACE_ALLOC,
+    TRACE_REALLOC,
+    TRACE_FREE,
+} trace_op_type_t;
+
+typedef struct {
+    uint32_t size;
+    uint16_t slot;
+    uint8_t op;
+} trace_op_t;
+
+typedef struct {
+    void * (*alloc)(size_t size);
+    void * (*realloc)(void * p, size_t size);
+    void (*free)(void * p);
+} trace_heap_t;
+
+typedef struct {
+    uint32_t free_size;
+    uint32_t free_biggest_size;
+    uint32_t free_cnt;
+} pool_walk_t;
+
+static trace_op_t * trace;
+static uint32_t trace_len;
+static void * slots[TRACE_SLOT_CNT];
+static uint32_t slot_size[TRACE_SLOT_CNT];
+static uint32_t rnd_state;
+
+static lv_tlsf_t ref_tlsf;
+static uint8_t * ref_pool;
+
+static uint32_t rnd(uint32_t max)
+{
+    /*xorshift32, the same trace on every run*/
+    rnd_state ^= rnd_state << 13;
+    rnd_state ^= rnd_state >> 17;
+    rnd_state ^= rnd_state << 5;
+    return rnd_state % max;
+}
+
+static void trace_add(trace_op_type_t op, uint16_t slot, uint32_t size)
+{
+    if(trace_len >= TRACE_OP_CNT) return;
+    trace[trace_len].op = op;
+    trace[trace_len].slot = slot;
+    trace[trace_len].size = size;
+    trace_len++;
+
+    slot_size[slot] = op == TRACE_FREE ? 0 : size;
+}
+
+/*Allocate to a free slot of the range*/
+static int32_t trace_alloc(uint16_t first, uint16_t cnt, uint32_t size)
+{
+    uint16_t i;
+    for(i = first; i < first + cnt; i++) {
+        if(slot_size[i] == 0) {
+            trace_add(TRACE_ALLOC, i, size);
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void trace_free_range(uint16_t first, uint16_t cnt)
+{
+    uint16_t i;
+    for(i = first; i < first + cnt; i++) {
+        if(slot_size[i]) trace_add(TRACE_FREE, i, 0);
+    }
+}
+
+/**
+ * Model the allocations of the controller's UI running for a long time:
+ * - a home screen which is never deleted with labels updated every second,
+ * - a chart whose point array grows, then is reallocated with the same size,
+ * - a settings screen which is opened and closed from time to time,
+ * - layers for the opacity/transform of the widgets allocated during drawing,
+ * - an event log which keeps growing and drops the oldest entries.
+ * The slots of the different lifetimes are interleaved in the heap which fragments a general allocator.
+ */
+static void trace_generate(void)
+{
+    lv_memset_00(slot_size, sizeof(slot_size));
+    trace_len = 0;
+    rnd_state = 0x12345678;
+
+    const uint32_t obj_size = sizeof(lv_obj_t);
+    const uint32_t label_size = sizeof(lv_label_t);
+    const uint32_t style_size = sizeof(_lv_obj_style_t);
+
+    /*Home screen: 0..599*/
+    uint16_t i;
+    for(i = 0; i < 100; i++) {
+        trace_alloc(0, 200, i % 3 ? label_size : obj_size);
+        trace_alloc(200, 200, style_size * (1 + rnd(3)));
+        trace_alloc(400, 200, 4 + rnd(24));
+    }
+
+    uint32_t chart_points = 10;
+    uint16_t chart_slot = (uint16_t)trace_alloc(600, 1, chart_points * sizeof(lv_coord_t));
+    uint16_t log_next = 0;
+    uint32_t sec = 0;
+    while(trace_len < TRACE_OP_CNT - TRACE_SLOT_CNT) {
+        sec++;
+
+        /*New label texts. Realloc like `lv_label_set_text()` does*/
+        for(i = 0; i < 10; i++) {
+            uint16_t s = (uint16_t)(400 + rnd(100));
+            trace_add(TRACE_REALLOC, s, 4 + rnd(24));
+        }
+
+        /*A new point of the chart in every minute*/
+        if(sec % 60 == 0) {
+            if(chart_points < 400) chart_points++;
+            trace_add(TRACE_REALLOC, chart_slot, chart_points * sizeof(lv_coord_t));
+        }
+
+        /*Draw layers*/
+        uint16_t layer = (uint16_t)trace_alloc(601, 8, 800 * (10 + rnd(40)) * 4);
+        trace_add(TRACE_FREE, layer, 0);
+
+        /*Event log: 700..1699*/
+        if(sec % 7 == 0) {
+            uint16_t s = (uint16_t)(700 + log_next);
+            if(slot_size[s]) trace_add(TRACE_FREE, s, 0);
+            trace_add(TRACE_ALLOC, s, 16 + rnd(80));
+            log_next = (log_next + 1) % 1000;
+        }
+
+        /*Settings screen: 2000..3999*/
+        if(sec % 300 == 0) {
+            uint32_t cnt = 150 + rnd(200);
+            uint32_t j;
+            for(j = 0; j < cnt; j++) {
+                trace_alloc(2000, 2000, j % 4 ? label_size : obj_size);
+                trace_alloc(2000, 2000, style_size * (1 + rnd(4)));
+                if(j % 2) trace_alloc(2000, 2000, 4 + rnd(40));
+                if(j % 50 == 0) trace_alloc(2000, 2000, 256 + rnd(2048));
+            }
+        }
+        if(sec % 300 == 120) trace_free_range(2000, 2000);
+    }
+
+    /*Delete everything*/
+    trace_free_range(0, TRACE_SLOT_CNT);
+}
+
+static void * ref_alloc(size_t size)
+{
+    return lv_tlsf_malloc(ref_tlsf, size);
+}
+
+static void * ref_realloc(void * p, size_t size)
+{
+    return lv_tlsf_realloc(ref_tlsf, p, size);
+}
+
+static void ref_free(void * p)
+{
+    lv_tlsf_free(ref_tlsf, p);
+}
+
+static void pool_walker(void * ptr, size_t size, int used, void * user)
+{
+    LV_UNUSED(ptr);
+    pool_walk_t * w = user;
+    if(used) return;
+    w->free_cnt++;
+    w->free_size += size;
+    if(size > w->free_biggest_size) w->free_biggest_size = size;
+}
+
+/**
+ * Replay the trace until `end`.
+ * @return the number of failed allocations
+ */
+static uint32_t trace_replay(const trace_heap_t * heap, uint32_t start, uint32_t end)
+{
+    uint32_t fail_cnt = 0;
+    uint32_t i;
+    for(i = start; i < end; i++) {
+        const trace_op_t * op = &trace[i];
+        void ** p = &slots[op->slot];
+        if(op->op == TRACE_ALLOC) {
+            *p = heap->alloc(op->size);
+            if(*p == NULL) fail_cnt++;
+        }
+        else if(op->op == TRACE_REALLOC) {
+            void * new_p = *p ? heap->realloc(*p, op->size) : heap->alloc(op->size);
+            if(new_p == NULL) fail_cnt++;
+            else *p = new_p;
+        }
+        else {
+            if(*p) heap->free(*p);
+            *p = NULL;
+        }
+    }
+    return fail_cnt;
+}
+
+void setUp(void)
+{
+    trace = malloc(TRACE_OP_CNT * sizeof(trace_op_t));
+    TEST_ASSERT_NOT_NULL(trace);
+    lv_memset_00(slots, sizeof(slots));
+}
+
+void tearDown(void)
+{
+    free(trace);
+}
+
+void test_mem_slab_should_group_the_small_allocations(void)
+{
+    lv_mem_slab_monitor_t mon_start;
+    lv_mem_slab_monitor(&mon_start);
+    TEST_ASSERT_EQUAL(LV_MEM_SLAB_SIZE, mon_start.total_size);
+
+    uint8_t * p1 = lv_mem_alloc(5);
+    uint8_t * p2 = lv_mem_alloc(8);
+    uint8_t * p3 = lv_mem_alloc(100);
+    uint8_t * big = lv_mem_alloc(LV_MEM_SIZE / 8);
+
+    lv_mem_slab_monitor_t mon;
+    lv_mem_slab_monitor(&mon);
+    TEST_ASSERT_EQUAL(mon_start.classes[0].used_cnt + 2, mon.classes[0].used_cnt);
+    TEST_ASSERT_EQUAL(128, mon.classes[7].block_size);
+    TEST_ASSERT_EQUAL(mon_start.classes[7].used_cnt + 1, mon.classes[7].used_cnt);
+
+    /*Grows in the block, then moves to a larger one*/
+    TEST_ASSERT_EQUAL_PTR(p3, lv_mem_realloc(p3, 120));
+    lv_memset(p1, 0x55, 5);
+    p1 = lv_mem_realloc(p1, 40);
+    TEST_ASSERT_EACH_EQUAL_HEX8(0x55, p1, 5);
+    lv_mem_slab_monitor(&mon);
+    TEST_ASSERT_EQUAL(mon_start.classes[0].used_cnt + 1, mon.classes[0].used_cnt);
+    TEST_ASSERT_EQUAL(mon_start.classes[4].used_cnt + 1, mon.classes[4].used_cnt);
+
+    lv_mem_free(p1);
+    lv_mem_free(p2);
+    lv_mem_free(p3);
+    lv_mem_free(big);
+
+    /*The empty pages are free again*/
+    lv_mem_slab_monitor(&mon);
+    TEST_ASSERT_EQUAL(mon_start.free_page_cnt, mon.free_page_cnt);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+}
+
+void test_mem_slab_should_fall_back_to_the_pool(void)
+{
+    lv_mem_slab_monitor_t mon;
+    lv_mem_slab_monitor(&mon);
+    uint32_t fallback_cnt = mon.fallback_cnt;
+
+    /*Use all the pages*/
+    uint32_t cnt = 0;
+    while(mon.fallback_cnt == fallback_cnt) {
+        TEST_ASSERT_LESS_THAN(TRACE_SLOT_CNT, cnt);
+        slots[cnt] = lv_mem_alloc(128);
+        TEST_ASSERT_NOT_NULL(slots[cnt]);
+        cnt++;
+        lv_mem_slab_monitor(&mon);
+    }
+
+    TEST_ASSERT_EQUAL(0, mon.free_page_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL(mon.max_used_page_cnt, mon.total_size / mon.page_size);
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) lv_mem_free(slots[i]);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+}
+
+/*Replay a long running allocation pattern with and without the slabs and compare the fragmentation*/
+void test_mem_slab_soak(void)
+{
+    trace_generate();
+
+    ref_pool = malloc(LV_MEM_SIZE);
+    TEST_ASSERT_NOT_NULL(ref_pool);
+    ref_tlsf = lv_tlsf_create_with_pool(ref_pool, LV_MEM_SIZE);
+
+    const trace_heap_t heap_ref = {ref_alloc, ref_realloc, ref_free};
+    const trace_heap_t heap_lv = {lv_mem_alloc, lv_mem_realloc, lv_mem_free};
+
+    /*Stop at the end of the run to see the fragmentation with the live allocations*/
+    uint32_t live_end = trace_len;
+    while(live_end > 0 && trace[live_end - 1].op == TRACE_FREE) live_end--;
+
+    lv_mem_monitor_t mon_start;
+    lv_mem_monitor(&mon_start);
+
+    TEST_ASSERT_EQUAL(0, trace_replay(&heap_ref, 0, live_end));
+    pool_walk_t ref_walk;
+    lv_memset_00(&ref_walk, sizeof(ref_walk));
+    lv_tlsf_walk_pool(lv_tlsf_get_pool(ref_tlsf), pool_walker, &ref_walk);
+    trace_replay(&heap_ref, live_end, trace_len);
+
+    lv_memset_00(slots, sizeof(slots));
+    TEST_ASSERT_EQUAL(0, trace_replay(&heap_lv, 0, live_end));
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    lv_mem_slab_monitor_t slab_mon;
+    lv_mem_slab_monitor(&slab_mon);
+    trace_replay(&heap_lv, live_end, trace_len);
+
+    /*Everything is given back*/
+    lv_mem_monitor_t mon_end;
+    lv_mem_monitor(&mon_end);
+    TEST_ASSERT_EQUAL(mon_start.free_size, mon_end.free_size);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+
+    lv_tlsf_destroy(ref_tlsf);
+    free(ref_pool);
+
+    uint32_t ref_frag = 100 - ref_walk.free_biggest_size * 100 / ref_walk.free_size;
+
+    char msg[160];
+    lv_snprintf(msg, sizeof(msg), "%" LV_PRIu32 " operations, %" LV_PRIu32 " slab fallbacks", trace_len,
+                slab_mon.fallback_cnt);
+    TEST_MESSAGE(msg);
+    lv_snprintf(msg, sizeof(msg), "TLSF only:   frag %3" LV_PRIu32 " %%, %5" LV_PRIu32 " free blocks", ref_frag,
+                ref_walk.free_cnt);
+    TEST_MESSAGE(msg);
+    lv_snprintf(msg, sizeof(msg), "TLSF + slab: frag %3d %%, %5" LV_PRIu32 " free blocks, slab pages %" LV_PRIu32
+                " (max %" LV_PRIu32 "), slab frag %d %%, max used %" LV_PRIu32 " B",
+                mon.frag_pct, mon.free_cnt, slab_mon.total_size / slab_mon.page_size - slab_mon.free_page_cnt,
+                slab_mon.max_used_page_cnt, slab_mon.frag_pct, mon.max_used);
+    TEST_MESSAGE(msg);
+}
+
+#else
+
+void setUp(void)
+{
+
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_mem_slab_should_group_the_small_allocations(void)
+{
+
+}
+
+void test_mem_slab_should_fall_back_to_the_pool(void)
+{
+
+}
+
+void test_mem_slab_soak(void)
+{
+
+}
+
+#endif
+
+#endif
@@ -0,0 +1,235 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../demos/lv_demos.h"
+
+#include "unity/unity.h"
+
+#if LV_OBJ_STYLE_CACHE_SIZE && LV_USE_DEMO_BENCHMARK
+
+#include "lv_test_helpers.h"
+
+#define BENCH_SCENE_CNT     40      /*Number of scenes in `lv_demo_benchmark`*/
+#define BENCH_REFR_LOOPS    5
+#define BENCH_DSC_LOOPS     20
+
+static lv_obj_t * active_screen = NULL;
+static lv_style_t style;
+
+/*Initialize the draw descriptors of all objects the way the drawing does*/
+static void init_draw_dscs(lv_obj_t * obj)
+{
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    lv_obj_init_draw_rect_dsc(obj, LV_PART_MAIN, &rect_dsc);
+
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+    lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &label_dsc);
+
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+        init_draw_dscs(lv_obj_get_child(obj, i));
+    }
+}
+
+void setUp(void)
+{
+    active_screen = lv_scr_act();
+    lv_style_init(&style);
+    lv_obj_enable_style_cache(true);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+    lv_style_reset(&style);
+    lv_obj_enable_style_cache(true);
+    lv_disp_get_default()->driver->monitor_cb = NULL;
+}
+
+void test_obj_style_cache_should_follow_the_state(void)
+{
+    lv_obj_t * obj = lv_obj_create(active_screen);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff0000), 0);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x00ff00), LV_STATE_PRESSED);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x0000ff), LV_PART_SCROLLBAR);
+
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_bg_color(obj, LV_PART_SCROLLBAR));
+
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_bg_color(obj, LV_PART_SCROLLBAR));
+
+    lv_obj_clear_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+}
+
+void test_obj_style_cache_should_follow_the_state_of_the_parent(void)
+{
+    lv_obj_t * parent = lv_obj_create(active_screen);
+    lv_obj_set_style_text_color(parent, lv_color_hex(0xff0000), 0);
+    lv_obj_set_style_text_color(parent, lv_color_hex(0x00ff00), LV_STATE_CHECKED);
+    lv_obj_t * label = lv_label_create(parent);
+
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+
+    /*The state of the label doesn't change, only the inherited value*/
+    lv_obj_add_state(parent, LV_STATE_CHECKED);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+}
+
+void test_obj_style_cache_should_follow_the_parent(void)
+{
+    lv_obj_t * parent1 = lv_obj_create(active_screen);
+    lv_obj_set_style_text_color(parent1, lv_color_hex(0xff0000), 0);
+    lv_obj_t * parent2 = lv_obj_create(active_screen);
+    lv_obj_set_style_text_color(parent2, lv_color_hex(0x00ff00), 0);
+    lv_obj_t * label = lv_label_create(parent1);
+
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+
+    lv_obj_set_parent(label, parent2);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_text_color(label, LV_PART_MAIN));
+}
+
+void test_obj_style_cache_should_follow_the_styles(void)
+{
+    lv_obj_t * obj = lv_obj_create(active_screen);
+    lv_obj_add_style(obj, &style, 0);
+    TEST_ASSERT_NOT_EQUAL(12, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+
+    /*Not reported with `lv_obj_report_style_change()`*/
+    lv_style_set_radius(&style, 12);
+    TEST_ASSERT_EQUAL(12, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+
+    lv_style_remove_prop(&style, LV_STYLE_RADIUS);
+    TEST_ASSERT_NOT_EQUAL(12, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+
+    lv_obj_set_style_radius(obj, 20, 0);
+    TEST_ASSERT_EQUAL(20, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+
+    lv_obj_remove_style_all(obj);
+    TEST_ASSERT_EQUAL(0, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+}
+
+void test_obj_style_cache_should_not_mix_the_objects(void)
+{
+    lv_obj_t * obj = lv_obj_create(active_screen);
+    lv_obj_set_style_radius(obj, 20, 0);
+    TEST_ASSERT_EQUAL(20, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+    lv_obj_del(obj);
+
+    /*Probably allocated to the same address*/
+    obj = lv_obj_create(active_screen);
+    lv_obj_remove_style_all(obj);
+    TEST_ASSERT_EQUAL(0, lv_obj_get_style_radius(obj, LV_PART_MAIN));
+}
+
+void test_obj_style_cache_should_give_the_same_values_as_the_styles(void)
+{
+    int_fast16_t scene;
+    for(scene = 0; scene < BENCH_SCENE_CNT * 2; scene++) {
+        lv_demo_benchmark_run_scene(scene);
+
+        lv_obj_enable_style_cache(false);
+        lv_obj_invalidate(active_screen);
+        lv_refr_now(NULL);
+        lv_obj_enable_style_cache(true);
+
+        /*With `LV_OBJ_STYLE_CACHE_CHECK` all cache hits are compared to the styles*/
+        lv_obj_invalidate(active_screen);
+        lv_refr_now(NULL);
+        lv_obj_invalidate(active_screen);
+        lv_refr_now(NULL);
+        lv_demo_benchmark_close();
+    }
+}
+
+/*Style lookups of the `lv_demo_benchmark` scenes with and without the cache*/
+void test_obj_style_cache_benchmark(void)
+{
+    uint32_t refr_us[2] = {0, 0};
+    uint32_t dsc_us[2] = {0, 0};
+    int_fast16_t scene;
+    for(scene = 0; scene < BENCH_SCENE_CNT * 2; scene += 2) {
+        lv_demo_benchmark_run_scene(scene);
+
+        uint32_t c;
+        for(c = 0; c < 2; c++) {
+            lv_obj_enable_style_cache(c == 1);
+            uint32_t i;
+            uint32_t t = lv_test_get_time_us();
+            for(i = 0; i < BENCH_REFR_LOOPS; i++) {
+                lv_obj_invalidate(active_screen);
+                lv_refr_now(NULL);
+            }
+            refr_us[c] += lv_test_get_time_us() - t;
+
+            t = lv_test_get_time_us();
+            for(i = 0; i < BENCH_DSC_LOOPS; i++) init_draw_dscs(active_screen);
+            dsc_us[c] += lv_test_get_time_us() - t;
+        }
+
+        lv_demo_benchmark_close();
+    }
+
+    char msg[128];
+    lv_snprintf(msg, sizeof(msg), "draw descriptors: %" LV_PRIu32 " us without cache, %" LV_PRIu32 " us with cache%s",
+                dsc_us[0], dsc_us[1], LV_OBJ_STYLE_CACHE_CHECK ? " (checked)" : "");
+    TEST_MESSAGE(msg);
+    lv_snprintf(msg, sizeof(msg), "refresh: %" LV_PRIu32 " us without cache, %" LV_PRIu32 " us with cache%s",
+                refr_us[0], refr_us[1], LV_OBJ_STYLE_CACHE_CHECK ? " (checked)" : "");
+    TEST_MESSAGE(msg);
+}
+
+#else
+
+void setUp(void)
+{
+
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_obj_style_cache_should_follow_the_state(void)
+{
+
+}
+
+void test_obj_style_cache_should_follow_the_state_of_the_parent(void)
+{
+
+}
+
+void test_obj_style_cache_should_follow_the_parent(void)
+{
+
+}
+
+void test_obj_style_cache_should_follow_the_styles(void)
+{
+
+}
+
+void test_obj_style_cache_should_not_mix_the_objects(void)
+{
+
+}
+
+void test_obj_style_cache_should_give_the_same_values_as_the_styles(void)
+{
+
+}
+
+void test_obj_style_cache_benchmark(void)
+{
+
+}
+
+#endif
+
+#endif
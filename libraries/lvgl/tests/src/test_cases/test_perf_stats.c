@@ -0,0 +1,183 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_PERF_STATS
+
+static lv_obj_t * active_screen = NULL;
+
+static uint32_t hist_total(const lv_perf_stats_hist_t * hist)
+{
+    uint32_t sum = 0;
+    uint32_t i;
+    for(i = 0; i < LV_PERF_STATS_HIST_BUCKETS; i++) sum += hist->bucket[i];
+    return sum;
+}
+
+void setUp(void)
+{
+    active_screen = lv_scr_act();
+    lv_refr_now(NULL);
+    lv_perf_stats_reset();
+}
+
+void tearDown(void)
+{
+    lv_perf_stats_set_overlay(false);
+    lv_obj_clean(active_screen);
+    lv_refr_now(NULL);
+}
+
+void test_perf_stats_should_ignore_refresh_without_invalidation(void)
+{
+#if LV_USE_PERF_MONITOR || LV_USE_MEM_MONITOR
+    TEST_IGNORE_MESSAGE("the monitors invalidate their labels on every refresh");
+#endif
+    lv_refr_now(NULL);
+
+    const lv_perf_stats_t * stats = lv_perf_stats_get();
+    TEST_ASSERT_EQUAL_UINT32(0, stats->frame_cnt);
+    TEST_ASSERT_EQUAL_UINT16(0, stats->window_cnt);
+}
+
+void test_perf_stats_should_record_a_frame(void)
+{
+    lv_obj_t * label = lv_label_create(active_screen);
+    lv_label_set_text(label, "Hello");
+    lv_obj_t * btn = lv_btn_create(active_screen);
+    lv_obj_set_pos(btn, 100, 100);
+    lv_obj_set_size(btn, 100, 50);
+    lv_refr_now(NULL);
+
+    const lv_perf_stats_t * stats = lv_perf_stats_get();
+    TEST_ASSERT_EQUAL_UINT32(1, stats->frame_cnt);
+    TEST_ASSERT_EQUAL_UINT16(1, stats->window_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats->last.area_px);
+    TEST_ASSERT_GREATER_THAN_UINT16(0, stats->last.area_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats->last.draw_cnt[LV_PERF_STATS_DRAW_RECT]);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats->last.draw_cnt[LV_PERF_STATS_DRAW_LABEL]);
+    TEST_ASSERT_EQUAL_UINT32(stats->last.area_px, stats->area_sum_px);
+    TEST_ASSERT_EQUAL_UINT32(1, hist_total(&stats->render_hist));
+}
+
+void test_perf_stats_window_should_stay_consistent(void)
+{
+    lv_obj_t * obj = lv_obj_create(active_screen);
+    lv_obj_set_size(obj, 40, 40);
+
+    uint32_t frames = LV_PERF_STATS_HISTORY + 10;
+    uint32_t i;
+    for(i = 0; i < frames; i++) {
+        lv_obj_set_x(obj, (lv_coord_t)(i % 200));
+        lv_refr_now(NULL);
+    }
+
+    const lv_perf_stats_t * stats = lv_perf_stats_get();
+    TEST_ASSERT_EQUAL_UINT32(frames, stats->frame_cnt);
+    TEST_ASSERT_EQUAL_UINT16(LV_PERF_STATS_HISTORY, stats->window_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_PERF_STATS_HISTORY, hist_total(&stats->render_hist));
+    TEST_ASSERT_EQUAL_UINT32(LV_PERF_STATS_HISTORY, hist_total(&stats->flush_hist));
+    TEST_ASSERT_EQUAL_UINT32(LV_PERF_STATS_HISTORY, hist_total(&stats->area_hist));
+
+    /*Every frame redraws the same sized area, so the window sum is known*/
+    TEST_ASSERT_EQUAL_UINT32(stats->last.area_px * LV_PERF_STATS_HISTORY, stats->area_sum_px);
+
+    lv_perf_stats_reset();
+    TEST_ASSERT_EQUAL_UINT32(0, stats->frame_cnt);
+    TEST_ASSERT_EQUAL_UINT16(0, stats->window_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, hist_total(&stats->area_hist));
+}
+
+void test_perf_stats_percentile_should_use_bucket_limits(void)
+{
+    lv_perf_stats_hist_t hist;
+    lv_memset_00(&hist, sizeof(hist));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_perf_stats_hist_percentile(&hist, 50));
+
+    hist.bucket[0] = 50;    /*Zeros*/
+    hist.bucket[4] = 45;    /*8..15*/
+    hist.bucket[10] = 5;    /*512..1023*/
+    TEST_ASSERT_EQUAL_UINT32(0, lv_perf_stats_hist_percentile(&hist, 50));
+    TEST_ASSERT_EQUAL_UINT32(15, lv_perf_stats_hist_percentile(&hist, 95));
+    TEST_ASSERT_EQUAL_UINT32(1023, lv_perf_stats_hist_percentile(&hist, 99));
+    TEST_ASSERT_EQUAL_UINT32(1023, lv_perf_stats_hist_percentile(&hist, 100));
+}
+
+void test_perf_stats_json_should_be_complete(void)
+{
+    lv_obj_t * label = lv_label_create(active_screen);
+    lv_label_set_text(label, "JSON");
+    lv_refr_now(NULL);
+
+    char buf[1024];
+    uint32_t len = lv_perf_stats_to_json(buf, sizeof(buf));
+    TEST_ASSERT_LESS_THAN_UINT32(sizeof(buf), len);
+    TEST_ASSERT_EQUAL_UINT32(len, strlen(buf));
+    TEST_ASSERT_EQUAL_CHAR('{', buf[0]);
+    TEST_ASSERT_EQUAL_CHAR('}', buf[len - 1]);
+    TEST_ASSERT_NOT_NULL(strstr(buf, "\"frames\":1,"));
+    TEST_ASSERT_NOT_NULL(strstr(buf, "\"render_us\":{"));
+    TEST_ASSERT_NOT_NULL(strstr(buf, "\"label\":"));
+
+    /*A truncated output still reports the full length*/
+    char small[16];
+    TEST_ASSERT_EQUAL_UINT32(len, lv_perf_stats_to_json(small, sizeof(small)));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(small) - 1, strlen(small));
+}
+
+void test_perf_stats_overlay_should_toggle(void)
+{
+    TEST_ASSERT_FALSE(lv_perf_stats_get_overlay());
+    lv_perf_stats_set_overlay(true);
+    TEST_ASSERT_TRUE(lv_perf_stats_get_overlay());
+    lv_refr_now(NULL);
+    lv_perf_stats_set_overlay(false);
+    TEST_ASSERT_FALSE(lv_perf_stats_get_overlay());
+}
+
+#else /*LV_USE_PERF_STATS*/
+
+void setUp(void)
+{
+
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_perf_stats_should_ignore_refresh_without_invalidation(void)
+{
+
+}
+
+void test_perf_stats_should_record_a_frame(void)
+{
+
+}
+
+void test_perf_stats_window_should_stay_consistent(void)
+{
+
+}
+
+void test_perf_stats_percentile_should_use_bucket_limits(void)
+{
+
+}
+
+void test_perf_stats_json_should_be_complete(void)
+{
+
+}
+
+void test_perf_stats_overlay_should_toggle(void)
+{
+
+}
+
+#endif /*LV_USE_PERF_STATS*/
+
+#endif
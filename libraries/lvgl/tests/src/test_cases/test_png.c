@@ -0,0 +1,404 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_PNG && LV_COLOR_DEPTH == 32
+
+#include "../../src/extra/libs/png/lodepng.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include "lv_test_helpers.h"
+
+#define PNG_DIR         "src/test_files/png/"
+#define LOGO_SRC        "src/test_files/timg/cgflogo.png"
+#define BG_SRC          PNG_DIR "background_480x800.png"
+#define BENCH_LOADS     5
+#define HOR_RES         800
+#define VER_RES         480
+
+extern lv_color_t test_fb[];
+
+static const char * formats[] = {
+    "gray1", "gray2", "gray4_trns", "gray8_trns", "gray16", "gray_alpha8", "gray_alpha16", "rgb8_trns", "rgb16_trns",
+    "pal1", "pal2", "pal4_trns", "pal8", "rgba8", "rgba16",
+};
+
+static lv_color_t ref_fb[HOR_RES * VER_RES];
+
+static uint8_t * read_file(const char * path, uint32_t * size)
+{
+    FILE * f = fopen(path, "rb");
+    TEST_ASSERT_NOT_NULL(f);
+    fseek(f, 0, SEEK_END);
+    *size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t * data = malloc(*size);
+    TEST_ASSERT_EQUAL(*size, fread(data, 1, *size, f));
+    fclose(f);
+    return data;
+}
+
+/*Decode with LodePNG and swap to LVGL's ARGB8888*/
+static uint8_t * decode_ref(const char * path, uint32_t * w, uint32_t * h)
+{
+    uint32_t size;
+    uint8_t * data = read_file(path, &size);
+    uint8_t * img = NULL;
+    unsigned png_w;
+    unsigned png_h;
+    TEST_ASSERT_EQUAL(0, lodepng_decode32(&img, &png_w, &png_h, data, size));
+    free(data);
+
+    uint32_t i;
+    for(i = 0; i < png_w * png_h; i++) {
+        uint8_t r = img[i * 4];
+        img[i * 4] = img[i * 4 + 2];
+        img[i * 4 + 2] = r;
+    }
+    *w = png_w;
+    *h = png_h;
+    return img;
+}
+
+/*Compare the whole image and the rows read one by one with the reference*/
+static void check_src(const void * src, const uint8_t * ref, uint32_t w, uint32_t h, const char * name)
+{
+    lv_img_decoder_dsc_t dsc;
+
+    lv_png_set_whole_max(UINT32_MAX);
+    TEST_ASSERT_EQUAL_MESSAGE(LV_RES_OK, lv_img_decoder_open(&dsc, src, lv_color_white(), 0), name);
+    TEST_ASSERT_EQUAL(w, dsc.header.w);
+    TEST_ASSERT_EQUAL(h, dsc.header.h);
+    TEST_ASSERT_NOT_NULL_MESSAGE(dsc.img_data, name);
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(ref, dsc.img_data, w * h * 4, name);
+    lv_img_decoder_close(&dsc);
+
+    lv_png_set_whole_max(0);
+    TEST_ASSERT_EQUAL_MESSAGE(LV_RES_OK, lv_img_decoder_open(&dsc, src, lv_color_white(), 0), name);
+    TEST_ASSERT_NULL_MESSAGE(dsc.img_data, name);
+    uint8_t * line = malloc(w * 4);
+    uint32_t y;
+    for(y = 0; y < h; y++) {
+        TEST_ASSERT_EQUAL_MESSAGE(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, y, w, line), name);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(ref + y * w * 4, line, w * 4, name);
+    }
+    free(line);
+    lv_img_decoder_close(&dsc);
+}
+
+static void draw_logo(void)
+{
+    lv_img_cache_invalidate_src(NULL);
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_img_set_src(img, "A:" LOGO_SRC);
+    lv_obj_center(img);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    lv_obj_del(img);
+}
+
+#if LV_MEM_CUSTOM && defined(__SANITIZE_ADDRESS__)
+/*Count the heap usage with the allocator hooks of ASan*/
+#define MEASURE_PEAK    1
+
+/*From <sanitizer/allocator_interface.h>, which is not always installed*/
+int __sanitizer_install_malloc_and_free_hooks(void (*malloc_hook)(const volatile void *, size_t),
+                                              void (*free_hook)(const volatile void *));
+size_t __sanitizer_get_allocated_size(const volatile void * p);
+
+static size_t heap_cur;
+static size_t heap_peak;
+
+static void malloc_hook(const volatile void * p, size_t size)
+{
+    LV_UNUSED(p);
+    heap_cur += size;
+    if(heap_cur > heap_peak) heap_peak = heap_cur;
+}
+
+static void free_hook(const volatile void * p)
+{
+    heap_cur -= __sanitizer_get_allocated_size(p);
+}
+#else
+#define MEASURE_PEAK    0
+#endif
+
+typedef enum {
+    BENCH_LODEPNG,
+    BENCH_WHOLE,
+    BENCH_ROWS,
+} bench_mode_t;
+
+/*Decode an image and return the time of one decode in us. 0: failed*/
+static uint32_t bench(const char * path, bench_mode_t mode, uint32_t * peak)
+{
+    uint8_t * line = malloc(LV_COORD_MAX * 4);
+    uint32_t t_sum = 0;
+    bool ok = true;
+    uint32_t i;
+#if MEASURE_PEAK
+    static bool hooks_installed;
+    if(!hooks_installed) __sanitizer_install_malloc_and_free_hooks(malloc_hook, free_hook);
+    hooks_installed = true;
+    heap_peak = heap_cur;
+    size_t heap_start = heap_cur;
+#endif
+    for(i = 0; i < BENCH_LOADS && ok; i++) {
+        uint32_t t = lv_test_get_time_us();
+        if(mode == BENCH_LODEPNG) {
+            /*What the decoder did before*/
+            uint8_t * data;
+            size_t size;
+            uint8_t * img = NULL;
+            unsigned w;
+            unsigned h;
+            ok = lodepng_load_file(&data, &size, path) == 0;
+            if(ok) {
+                ok = lodepng_decode32(&img, &w, &h, data, size) == 0;
+                lv_mem_free(data);
+            }
+            lv_mem_free(img);
+        }
+        else {
+            lv_img_decoder_dsc_t dsc;
+            lv_png_set_whole_max(mode == BENCH_WHOLE ? UINT32_MAX : 0);
+            ok = lv_img_decoder_open(&dsc, path, lv_color_white(), 0) == LV_RES_OK;
+            if(ok && mode == BENCH_ROWS) {
+                lv_coord_t y;
+                for(y = 0; y < dsc.header.h; y++) lv_img_decoder_read_line(&dsc, 0, y, dsc.header.w, line);
+            }
+            if(ok) lv_img_decoder_close(&dsc);
+        }
+        t_sum += lv_test_get_time_us() - t;
+    }
+    free(line);
+
+#if MEASURE_PEAK
+    *peak = heap_peak - heap_start;
+#else
+    *peak = 0;
+#endif
+    return ok ? t_sum / BENCH_LOADS : 0;
+}
+
+void setUp(void)
+{
+    lv_png_set_whole_max(LV_PNG_WHOLE_MAX);
+}
+
+void tearDown(void)
+{
+    lv_png_set_whole_max(LV_PNG_WHOLE_MAX);
+    lv_img_cache_invalidate_src(NULL);
+}
+
+void test_png_should_decode_all_formats(void)
+{
+    uint32_t i;
+    for(i = 0; i < sizeof(formats) / sizeof(formats[0]); i++) {
+        char path[64];
+        lv_snprintf(path, sizeof(path), PNG_DIR "%s.png", formats[i]);
+        uint32_t w;
+        uint32_t h;
+        uint8_t * ref = decode_ref(path, &w, &h);
+
+        char src[70];
+        lv_snprintf(src, sizeof(src), "A:%s", path);
+        check_src(src, ref, w, h, formats[i]);
+        lv_mem_free(ref);
+    }
+}
+
+void test_png_should_decode_c_arrays(void)
+{
+    uint32_t w;
+    uint32_t h;
+    uint8_t * ref = decode_ref(LOGO_SRC, &w, &h);
+
+    uint32_t size;
+    uint8_t * data = read_file(LOGO_SRC, &size);
+    lv_img_dsc_t img_dsc;
+    lv_memset_00(&img_dsc, sizeof(img_dsc));
+    img_dsc.data = data;
+    img_dsc.data_size = size;
+    check_src(&img_dsc, ref, w, h, "logo");
+
+    free(data);
+    lv_mem_free(ref);
+}
+
+void test_png_should_read_rows_in_any_order(void)
+{
+    uint32_t w;
+    uint32_t h;
+    uint8_t * ref = decode_ref(LOGO_SRC, &w, &h);
+
+    lv_png_set_whole_max(0);
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, "A:" LOGO_SRC, lv_color_white(), 0));
+
+    static const uint16_t rows[][3] = {{100, 0, 300}, {20, 10, 50}, {20, 200, 100}, {172, 299, 1}, {0, 0, 300}, {172, 0, 300}};
+    uint8_t line[300 * 4];
+    uint32_t i;
+    for(i = 0; i < sizeof(rows) / sizeof(rows[0]); i++) {
+        uint32_t y = rows[i][0];
+        uint32_t x = rows[i][1];
+        uint32_t len = rows[i][2];
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, x, y, len, line));
+        TEST_ASSERT_EQUAL_MEMORY(ref + (y * w + x) * 4, line, len * 4);
+    }
+
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_read_line(&dsc, 0, h, w, line));
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_read_line(&dsc, 1, 0, w, line));
+
+    lv_img_decoder_close(&dsc);
+    lv_mem_free(ref);
+}
+
+void test_png_should_decode_interlaced_images_at_once(void)
+{
+    uint32_t w;
+    uint32_t h;
+    uint8_t * ref = decode_ref(PNG_DIR "rgba8_interlaced.png", &w, &h);
+
+    lv_png_set_whole_max(0);
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, "A:" PNG_DIR "rgba8_interlaced.png", lv_color_white(), 0));
+    TEST_ASSERT_NOT_NULL(dsc.img_data);
+    TEST_ASSERT_EQUAL_MEMORY(ref, dsc.img_data, w * h * 4);
+    lv_img_decoder_close(&dsc);
+    lv_mem_free(ref);
+}
+
+void test_png_should_reject_broken_images(void)
+{
+    uint32_t size;
+    uint8_t * data = read_file(PNG_DIR "rgba16.png", &size);
+    uint8_t * broken = malloc(size);
+    lv_img_dsc_t img_dsc;
+    lv_memset_00(&img_dsc, sizeof(img_dsc));
+    img_dsc.data = broken;
+    lv_img_decoder_dsc_t dsc;
+    uint8_t line[37 * 4];
+
+    /*Truncated: the first rows can be read, the last ones not*/
+    lv_memcpy(broken, data, size);
+    img_dsc.data_size = size / 2;
+    lv_png_set_whole_max(UINT32_MAX);
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_open(&dsc, &img_dsc, lv_color_white(), 0));
+    lv_png_set_whole_max(0);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, &img_dsc, lv_color_white(), 0));
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, 0, 37, line));
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_read_line(&dsc, 0, 22, 37, line));
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, 1, 37, line));
+    lv_img_decoder_close(&dsc);
+
+    /*Bad zlib header (IDAT starts after the signature, IHDR, tEXt and the IDAT header)*/
+    img_dsc.data_size = size;
+    uint32_t idat = 8 + 25 + 12 + 18 + 8;
+    TEST_ASSERT_EQUAL_MEMORY("IDAT", &data[idat - 4], 4);
+    broken[idat] ^= 0x01;
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_open(&dsc, &img_dsc, lv_color_white(), 0));
+
+    /*Random errors in the compressed data: it only shouldn't crash*/
+    uint32_t i;
+    uint32_t seed = 1;
+    for(i = 0; i < 200; i++) {
+        lv_memcpy(broken, data, size);
+        uint32_t j;
+        for(j = 0; j < 1 + i % 4; j++) {
+            seed = seed * 1103515245 + 12345;
+            broken[idat + 2 + (seed >> 8) % (size - idat - 2 - 12)] ^= 1 << (seed % 8);
+        }
+        lv_png_set_whole_max(i % 2 ? 0 : UINT32_MAX);
+        if(lv_img_decoder_open(&dsc, &img_dsc, lv_color_white(), 0) == LV_RES_OK) {
+            uint32_t y;
+            for(y = 0; y < 23 && dsc.img_data == NULL; y++) lv_img_decoder_read_line(&dsc, 0, y, 37, line);
+            lv_img_decoder_close(&dsc);
+        }
+    }
+
+    free(broken);
+    free(data);
+}
+
+void test_png_should_draw_the_same_line_by_line(void)
+{
+    lv_png_set_whole_max(UINT32_MAX);
+    draw_logo();
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    /*The logo is there*/
+    uint32_t diff_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < HOR_RES * VER_RES; i++) diff_cnt += ref_fb[i].full != ref_fb[0].full;
+    TEST_ASSERT_GREATER_THAN(10000, diff_cnt);
+
+    lv_png_set_whole_max(0);
+    draw_logo();
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+}
+
+void test_png_benchmark(void)
+{
+    static const char * paths[] = {"A:" LOGO_SRC, "A:" BG_SRC};
+    static const char * names[] = {"logo 300x173 RGBA", "background 480x800 RGB"};
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        uint32_t t[3];
+        uint32_t peak[3];
+        bench_mode_t m;
+        for(m = BENCH_LODEPNG; m <= BENCH_ROWS; m++) t[m] = bench(paths[i], m, &peak[m]);
+
+        char msg[256];
+        lv_snprintf(msg, sizeof(msg), "%s: LodePNG %" LV_PRIu32 " us, %" LV_PRIu32 " B peak; whole %" LV_PRIu32 " us, %"
+                    LV_PRIu32 " B peak; rows %" LV_PRIu32 " us, %" LV_PRIu32 " B peak", names[i],
+                    t[BENCH_LODEPNG], peak[BENCH_LODEPNG], t[BENCH_WHOLE], peak[BENCH_WHOLE], t[BENCH_ROWS], peak[BENCH_ROWS]);
+        TEST_MESSAGE(msg);
+        TEST_ASSERT_NOT_EQUAL(0, t[BENCH_ROWS]);
+    }
+}
+
+#else /*LV_USE_PNG && LV_COLOR_DEPTH == 32*/
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_png_should_decode_all_formats(void)
+{
+}
+
+void test_png_should_decode_c_arrays(void)
+{
+}
+
+void test_png_should_read_rows_in_any_order(void)
+{
+}
+
+void test_png_should_decode_interlaced_images_at_once(void)
+{
+}
+
+void test_png_should_reject_broken_images(void)
+{
+}
+
+void test_png_should_draw_the_same_line_by_line(void)
+{
+}
+
+void test_png_benchmark(void)
+{
+}
+
+#endif /*LV_USE_PNG && LV_COLOR_DEPTH == 32*/
+
+#endif
@@ -0,0 +1,143 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#include "lv_test_helpers.h"
+
+#define BENCH_FRAMES    20
+
+static lv_obj_t * active_screen = NULL;
+static lv_obj_t * panel_covered;
+static lv_obj_t * panel_partly;
+static lv_obj_t * panel_top;
+static lv_obj_t * panel_transp;
+static uint32_t draw_cnt_covered;
+static uint32_t draw_cnt_partly;
+
+static void draw_main_cb(lv_event_t * e)
+{
+    uint32_t * cnt = lv_event_get_user_data(e);
+    (*cnt)++;
+}
+
+static lv_obj_t * create_panel(lv_obj_t * parent, lv_color_t color, lv_coord_t x, lv_coord_t y, lv_coord_t w,
+                               lv_coord_t h, const char * txt)
+{
+    lv_obj_t * panel = lv_obj_create(parent);
+    lv_obj_set_style_bg_color(panel, color, 0);
+    lv_obj_set_pos(panel, x, y);
+    lv_obj_set_size(panel, w, h);
+
+    lv_obj_t * label = lv_label_create(panel);
+    lv_label_set_text(label, txt);
+    lv_obj_center(label);
+    return panel;
+}
+
+/*Overlapping panels like on a typical main screen*/
+static void create_scene(void)
+{
+    lv_obj_t * bg_panel = create_panel(active_screen, lv_palette_lighten(LV_PALETTE_GREY, 3), 20, 20, 760, 440,
+                                       "Background panel");
+    lv_obj_clear_flag(bg_panel, LV_OBJ_FLAG_SCROLLABLE);
+
+    panel_covered = create_panel(bg_panel, lv_palette_main(LV_PALETTE_RED), 40, 40, 200, 150, "Covered");
+    panel_partly = create_panel(bg_panel, lv_palette_main(LV_PALETTE_GREEN), 300, 40, 200, 150, "Partly covered");
+    lv_obj_set_style_shadow_width(panel_partly, 20, 0);
+
+    /*Covers `panel_covered` fully, also its rounded corners and shadow, and the half of `panel_partly`*/
+    panel_top = create_panel(bg_panel, lv_palette_main(LV_PALETTE_BLUE), 0, 0, 400, 240, "Top");
+
+    /*Semi transparent, so it doesn't hide anything*/
+    panel_transp = create_panel(bg_panel, lv_palette_main(LV_PALETTE_ORANGE), 450, 200, 200, 150, "Transparent");
+    lv_obj_set_style_bg_opa(panel_transp, LV_OPA_50, 0);
+
+    /*Below the transparent panel*/
+    create_panel(bg_panel, lv_palette_main(LV_PALETTE_PURPLE), 500, 240, 100, 60, "Under");
+    lv_obj_move_to_index(panel_transp, -1);
+
+    lv_obj_add_event_cb(panel_covered, draw_main_cb, LV_EVENT_DRAW_MAIN, &draw_cnt_covered);
+    lv_obj_add_event_cb(panel_partly, draw_main_cb, LV_EVENT_DRAW_MAIN, &draw_cnt_partly);
+}
+
+void setUp(void)
+{
+    active_screen = lv_scr_act();
+    create_scene();
+    draw_cnt_covered = 0;
+    draw_cnt_partly = 0;
+#if LV_USE_PERF_STATS
+    lv_perf_stats_reset();
+#endif
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+}
+
+/*The covered objects are skipped but the result is the same*/
+void test_refr_occlusion_should_draw_the_same(void)
+{
+    TEST_ASSERT_EQUAL_SCREENSHOT("refr_occlusion.png");
+}
+
+void test_refr_occlusion_should_skip_the_covered_objects(void)
+{
+    lv_obj_invalidate(active_screen);
+    lv_refr_now(NULL);
+
+#if LV_USE_OCCLUSION_CULLING
+    TEST_ASSERT_EQUAL_UINT32(0, draw_cnt_covered);
+#else
+    TEST_ASSERT_NOT_EQUAL(0, draw_cnt_covered);
+#endif
+    TEST_ASSERT_NOT_EQUAL(0, draw_cnt_partly);
+
+#if LV_USE_OCCLUSION_CULLING && LV_USE_PERF_STATS
+    TEST_ASSERT_NOT_EQUAL(0, lv_perf_stats_get()->last.culled_cnt);
+
+    char buf[1024];
+    lv_perf_stats_to_json(buf, sizeof(buf));
+    TEST_ASSERT_NOT_NULL(strstr(buf, "\"culled\":"));
+#endif
+
+    /*Nothing is covered if the top panel is transparent*/
+    lv_obj_set_style_bg_opa(panel_top, LV_OPA_90, 0);
+    lv_obj_invalidate(active_screen);
+    draw_cnt_covered = 0;
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_EQUAL(0, draw_cnt_covered);
+
+    /*Or hidden*/
+    lv_obj_set_style_bg_opa(panel_top, LV_OPA_COVER, 0);
+    lv_obj_add_flag(panel_top, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_invalidate(active_screen);
+    draw_cnt_covered = 0;
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_EQUAL(0, draw_cnt_covered);
+}
+
+/*Time of redrawing the whole screen*/
+void test_refr_occlusion_benchmark(void)
+{
+    uint32_t t = lv_test_get_time_us();
+    uint32_t i;
+    for(i = 0; i < BENCH_FRAMES; i++) {
+        lv_obj_invalidate(active_screen);
+        lv_refr_now(NULL);
+    }
+    uint32_t frame_us = (lv_test_get_time_us() - t) / BENCH_FRAMES;
+
+    char msg[160];
+#if LV_USE_PERF_STATS
+    lv_snprintf(msg, sizeof(msg), "Overlapping panels: %" LV_PRIu32 " us/frame, %" LV_PRIu32 " objects culled/frame",
+                frame_us, lv_perf_stats_get()->last.culled_cnt);
+#else
+    lv_snprintf(msg, sizeof(msg), "Overlapping panels: %" LV_PRIu32 " us/frame", frame_us);
+#endif
+    TEST_MESSAGE(msg);
+}
+
+#endif
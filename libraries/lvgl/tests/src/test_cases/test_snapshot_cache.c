@@ -0,0 +1,375 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_SNAPSHOT && LV_USE_SNAPSHOT_CACHE && LV_USE_PNG
+
+#include "lv_test_helpers.h"
+#include "lv_test_init.h"
+
+#define BENCH_FRAMES    20
+#define HOR_RES         800
+#define VER_RES         480
+
+extern lv_color_t test_fb[];
+
+static lv_color_t ref_fb[HOR_RES * VER_RES];
+static lv_obj_t * active_screen = NULL;
+static lv_obj_t * panel_temp;
+static lv_obj_t * panel_settings;
+static lv_obj_t * temp_label;
+static lv_obj_t * setting_labels[10];
+static lv_obj_t * popup;
+static uint32_t temp_draw_cnt;
+
+static void draw_main_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    temp_draw_cnt++;
+}
+
+static lv_obj_t * create_panel(lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h)
+{
+    lv_obj_t * panel = lv_obj_create(active_screen);
+    lv_obj_set_pos(panel, x, y);
+    lv_obj_set_size(panel, w, h);
+    lv_obj_clear_flag(panel, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_style_shadow_width(panel, 15, 0);
+    return panel;
+}
+
+static lv_obj_t * create_label(lv_obj_t * parent, const char * txt, const lv_font_t * font, lv_coord_t x, lv_coord_t y)
+{
+    lv_obj_t * label = lv_label_create(parent);
+    lv_label_set_text(label, txt);
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_obj_set_pos(label, x, y);
+    return label;
+}
+
+/*The main screen of the greenhouse controller: temperature and logo, status, settings, chart and clock*/
+static void create_main_screen(void)
+{
+    static const char * settings[] = {"Vent", "25 %", "50 %", "100 %", "Heat", "Day", "Night", "Shade", "Open", "Close"};
+    uint32_t i;
+
+    panel_temp = create_panel(10, 10, 351, 238);
+    lv_obj_t * img = lv_img_create(panel_temp);
+    lv_img_set_src(img, "A:src/test_files/timg/cgflogo.png");
+    lv_obj_align(img, LV_ALIGN_TOP_MID, 0, -10);
+    create_label(panel_temp, "Current Temp:", &lv_font_montserrat_24, 0, 170);
+    temp_label = create_label(panel_temp, "25.0 °C", &lv_font_montserrat_24, 190, 170);
+    lv_obj_set_style_text_color(temp_label, lv_color_hex(0xEC0E0E), 0);
+    lv_obj_add_event_cb(temp_label, draw_main_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    lv_obj_t * panel_status = create_panel(10, 258, 351, 212);
+    create_label(panel_status, "WiFi: connected", &lv_font_montserrat_18, 0, 0);
+    create_label(panel_status, "Vents: 25 %", &lv_font_montserrat_18, 0, 40);
+    create_label(panel_status, "Heater: OFF", &lv_font_montserrat_18, 0, 80);
+    create_label(panel_status, "Shade: Open", &lv_font_montserrat_18, 0, 120);
+
+    panel_settings = create_panel(555, 10, 235, 460);
+    for(i = 0; i < sizeof(settings) / sizeof(settings[0]); i++) {
+        create_label(panel_settings, settings[i], &lv_font_montserrat_18, 0, i * 40);
+        setting_labels[i] = create_label(panel_settings, "21.5", &lv_font_montserrat_18, 140, i * 40);
+    }
+
+    lv_obj_t * chart = lv_chart_create(active_screen);
+    lv_obj_set_pos(chart, 371, 200);
+    lv_obj_set_size(chart, 174, 123);
+    lv_chart_series_t * ser = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_BLUE), LV_CHART_AXIS_PRIMARY_Y);
+    for(i = 0; i < 10; i++) lv_chart_set_next_value(chart, ser, (i * 37) % 100);
+
+    lv_obj_t * time_label = create_label(active_screen, "12:34:56", &lv_font_montserrat_24, 400, 20);
+    create_label(active_screen, "May 12, 2025", &lv_font_montserrat_18, 395, 60);
+    LV_UNUSED(time_label);
+
+    /*A message box like object which moves over the panels*/
+    popup = lv_obj_create(active_screen);
+    lv_obj_set_size(popup, 200, 120);
+    lv_obj_add_flag(popup, LV_OBJ_FLAG_HIDDEN);
+    create_label(popup, "Saved", &lv_font_montserrat_18, 0, 0);
+}
+
+static void set_cache(bool en)
+{
+    if(en) {
+        lv_obj_add_flag(panel_temp, LV_OBJ_FLAG_CACHE_LAYER);
+        lv_obj_add_flag(panel_settings, LV_OBJ_FLAG_CACHE_LAYER);
+    }
+    else {
+        lv_obj_clear_flag(panel_temp, LV_OBJ_FLAG_CACHE_LAYER);
+        lv_obj_clear_flag(panel_settings, LV_OBJ_FLAG_CACHE_LAYER);
+        lv_draw_cache_drop_all();
+    }
+}
+
+static void refr_all(void)
+{
+    lv_obj_invalidate(active_screen);
+    lv_refr_now(NULL);
+}
+
+static const lv_draw_cache_stats_t * layer_stats(void)
+{
+    static lv_draw_cache_stats_t stats;
+    lv_draw_cache_get_stats(LV_DRAW_CACHE_TYPE_LAYER, &stats);
+    return &stats;
+}
+
+void setUp(void)
+{
+    active_screen = lv_scr_act();
+    lv_draw_cache_set_budget(4 * 1024 * 1024);
+    create_main_screen();
+    refr_all();
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+    lv_draw_cache_reset_stats();
+    temp_draw_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+    lv_draw_cache_drop_all();
+    lv_draw_cache_set_budget(LV_DRAW_CACHE_BUDGET);
+    lv_img_cache_invalidate_src(NULL);
+}
+
+void test_snapshot_cache_should_draw_the_same(void)
+{
+    set_cache(true);
+
+    /*Taken*/
+    refr_all();
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+    TEST_ASSERT_EQUAL_UINT32(2, layer_stats()->miss);
+    TEST_ASSERT_TRUE(lv_snapshot_cache_is_cached(panel_temp));
+    TEST_ASSERT_TRUE(lv_snapshot_cache_is_cached(panel_settings));
+
+    /*Used*/
+    refr_all();
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+    TEST_ASSERT_EQUAL_UINT32(2, layer_stats()->miss);
+    TEST_ASSERT_EQUAL_UINT32(2, layer_stats()->hit);
+    TEST_ASSERT_EQUAL_UINT32(1, temp_draw_cnt);
+
+    /*Also when only a part of a panel is redrawn*/
+    lv_area_t a = {100, 100, 600, 140};
+    lv_obj_invalidate_area(active_screen, &a);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, layer_stats()->miss);
+    TEST_ASSERT_EQUAL_UINT32(1, temp_draw_cnt);
+}
+
+void test_snapshot_cache_should_be_used_below_other_objects(void)
+{
+    set_cache(true);
+    refr_all();
+    temp_draw_cnt = 0;
+
+    lv_obj_clear_flag(popup, LV_OBJ_FLAG_HIDDEN);
+    lv_coord_t x;
+    for(x = 0; x < 400; x += 40) {
+        lv_obj_set_pos(popup, x, 100);
+        lv_refr_now(NULL);
+    }
+
+    /*Only the popup is redrawn, the panel below it is copied from the snapshot*/
+    TEST_ASSERT_EQUAL_UINT32(0, temp_draw_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, layer_stats()->miss);
+    TEST_ASSERT_TRUE(lv_snapshot_cache_is_cached(panel_temp));
+
+    /*The test display copies only the refreshed areas so compare whole frames*/
+    lv_obj_add_flag(popup, LV_OBJ_FLAG_HIDDEN);
+    refr_all();
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+}
+
+void test_snapshot_cache_should_update_the_snapshot_when_a_child_changes(void)
+{
+    set_cache(true);
+    refr_all();
+    temp_draw_cnt = 0;
+
+    /*Only the label is redrawn on the snapshot*/
+    lv_label_set_text(temp_label, "26.5 °C");
+    TEST_ASSERT_TRUE(lv_snapshot_cache_is_cached(panel_temp));
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, layer_stats()->miss);
+    TEST_ASSERT_EQUAL_UINT32(1, temp_draw_cnt);
+
+    refr_all();
+    TEST_ASSERT_EQUAL_UINT32(1, temp_draw_cnt);
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    /*The new text is on the snapshot*/
+    set_cache(false);
+    refr_all();
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+
+    /*The whole snapshot is dropped if the style or position of the object changes*/
+    set_cache(true);
+    refr_all();
+    lv_obj_set_style_bg_color(panel_temp, lv_palette_main(LV_PALETTE_RED), 0);
+    TEST_ASSERT_FALSE(lv_snapshot_cache_is_cached(panel_temp));
+    refr_all();
+    lv_obj_set_x(panel_settings, 540);
+    TEST_ASSERT_FALSE(lv_snapshot_cache_is_cached(panel_settings));
+    refr_all();
+    lv_obj_add_flag(lv_obj_get_child(panel_settings, 0), LV_OBJ_FLAG_HIDDEN);
+    TEST_ASSERT_TRUE(lv_snapshot_cache_is_cached(panel_settings));
+    refr_all();
+    /*Taken again after enabling, then after the style and position changes*/
+    TEST_ASSERT_EQUAL_UINT32(6, layer_stats()->miss);
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+
+    set_cache(false);
+    refr_all();
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+}
+
+void test_snapshot_cache_should_stay_in_the_budget(void)
+{
+    set_cache(true);
+    refr_all();
+
+    /*Only the opaque middle is cached, without the rounded corners*/
+    lv_coord_t r = lv_obj_get_style_radius(panel_temp, LV_PART_MAIN);
+    size_t temp_size = (351 - 2 * r) * (238 - 2 * r) * sizeof(lv_color_t);
+    TEST_ASSERT_EQUAL_UINT32(2, layer_stats()->entry_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL(temp_size, layer_stats()->size);
+
+    /*The deleted objects' snapshots are freed*/
+    lv_obj_del(panel_settings);
+    TEST_ASSERT_EQUAL_UINT32(1, layer_stats()->entry_cnt);
+    lv_obj_clean(active_screen);
+    TEST_ASSERT_EQUAL_UINT32(0, layer_stats()->entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, layer_stats()->size);
+
+    /*Too small budget: drawn normally*/
+    create_main_screen();
+    set_cache(true);
+    lv_draw_cache_drop_all();
+    lv_draw_cache_set_budget(temp_size / 2);
+    refr_all();
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+    TEST_ASSERT_EQUAL_UINT32(0, layer_stats()->entry_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL(temp_size / 2, lv_draw_cache_get_size());
+}
+
+void test_snapshot_cache_benchmark(void)
+{
+    uint32_t frame_us[2][4];
+    uint32_t i;
+    uint32_t c;
+
+    for(c = 0; c < 2; c++) {
+        set_cache(c == 1);
+        refr_all();
+
+        /*The whole screen is redrawn, e.g. after closing a window*/
+        uint32_t t = lv_test_get_time_us();
+        for(i = 0; i < BENCH_FRAMES; i++) refr_all();
+        frame_us[c][0] = (lv_test_get_time_us() - t) / BENCH_FRAMES;
+
+        /*An object moves over the panels*/
+        lv_obj_clear_flag(popup, LV_OBJ_FLAG_HIDDEN);
+        t = lv_test_get_time_us();
+        for(i = 0; i < BENCH_FRAMES; i++) {
+            lv_obj_set_pos(popup, i * 20, 60);
+            lv_refr_now(NULL);
+        }
+        frame_us[c][1] = (lv_test_get_time_us() - t) / BENCH_FRAMES;
+        lv_obj_add_flag(popup, LV_OBJ_FLAG_HIDDEN);
+        lv_refr_now(NULL);
+
+        /*The worst case: a child changes in every frame*/
+        t = lv_test_get_time_us();
+        for(i = 0; i < BENCH_FRAMES; i++) {
+            lv_label_set_text_fmt(temp_label, "%d.5 °C", (int)(20 + i % 10));
+            lv_refr_now(NULL);
+        }
+        frame_us[c][2] = (lv_test_get_time_us() - t) / BENCH_FRAMES;
+
+        /*The data exchange of the controller: a new temperature and all the settings are set again*/
+        t = lv_test_get_time_us();
+        for(i = 0; i < BENCH_FRAMES; i++) {
+            uint32_t s;
+            lv_label_set_text_fmt(temp_label, "%d.5 °C", (int)(20 + i % 10));
+            for(s = 0; s < sizeof(setting_labels) / sizeof(setting_labels[0]); s++) {
+                lv_label_set_text(setting_labels[s], "21.5");
+            }
+            lv_refr_now(NULL);
+        }
+        frame_us[c][3] = (lv_test_get_time_us() - t) / BENCH_FRAMES;
+    }
+
+    char msg[256];
+    lv_snprintf(msg, sizeof(msg), "Main screen us/frame without/with snapshot cache: full redraw %" LV_PRIu32 "/%" LV_PRIu32
+                ", moving popup %" LV_PRIu32 "/%" LV_PRIu32 ", temperature label changes %" LV_PRIu32 "/%" LV_PRIu32
+                ", data exchange %" LV_PRIu32 "/%" LV_PRIu32,
+                frame_us[0][0], frame_us[1][0], frame_us[0][1], frame_us[1][1], frame_us[0][2], frame_us[1][2],
+                frame_us[0][3], frame_us[1][3]);
+    TEST_MESSAGE(msg);
+}
+
+void test_snapshot_cache_should_be_empty_after_reinit(void)
+{
+#if LV_ENABLE_GC || !LV_MEM_CUSTOM
+    set_cache(true);
+    refr_all();
+    TEST_ASSERT_TRUE(lv_snapshot_cache_is_cached(panel_temp));
+
+    /*The objects are freed with the heap*/
+    lv_deinit();
+    lv_test_init();
+    TEST_ASSERT_EQUAL(0, lv_draw_cache_get_size());
+
+    setUp();
+    set_cache(true);
+    refr_all();
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+    TEST_ASSERT_EQUAL_UINT32(2, layer_stats()->miss);
+    TEST_ASSERT_TRUE(lv_snapshot_cache_is_cached(panel_temp));
+#endif
+}
+
+#else /*LV_USE_SNAPSHOT && LV_USE_SNAPSHOT_CACHE && LV_USE_PNG*/
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_snapshot_cache_should_draw_the_same(void)
+{
+}
+
+void test_snapshot_cache_should_be_used_below_other_objects(void)
+{
+}
+
+void test_snapshot_cache_should_update_the_snapshot_when_a_child_changes(void)
+{
+}
+
+void test_snapshot_cache_should_stay_in_the_budget(void)
+{
+}
+
+void test_snapshot_cache_benchmark(void)
+{
+}
+
+void test_snapshot_cache_should_be_empty_after_reinit(void)
+{
+}
+
+#endif /*LV_USE_SNAPSHOT && LV_USE_SNAPSHOT_CACHE && LV_USE_PNG*/
+
+#endif
@@ -0,0 +1,300 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_TIMER_HEAP
+
+#include "lv_test_helpers.h"
+#include <string.h>
+
+#define SYS_TIMER_MAX   16
+#define BENCH_CALLS     1000
+
+static lv_timer_t * sys_timers[SYS_TIMER_MAX];
+static uint32_t sys_timer_cnt;
+static char run_order[16];
+static uint32_t run_cnt;
+
+static void record_cb(lv_timer_t * timer)
+{
+    if(run_cnt < sizeof(run_order) - 1) run_order[run_cnt] = (char)(lv_uintptr_t)timer->user_data;
+    run_cnt++;
+}
+
+static void del_other_cb(lv_timer_t * timer)
+{
+    record_cb(timer);
+    lv_timer_t * other = lv_timer_get_next(NULL);
+    while(other) {
+        if(other != timer && other->timer_cb == record_cb) {
+            lv_timer_del(other);
+            break;
+        }
+        other = lv_timer_get_next(other);
+    }
+}
+
+static void empty_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+}
+
+/*The time until the next timer checking all the timers like `lv_timer_handler()` does without the heap*/
+static uint32_t scan_time_till_next(void)
+{
+    uint32_t time_till_next = LV_NO_TIMER_READY;
+    lv_timer_t * timer = lv_timer_get_next(NULL);
+    while(timer) {
+        if(!timer->paused) {
+            uint32_t elp = lv_tick_elaps(timer->last_run);
+            uint32_t delay = elp >= timer->period ? 0 : timer->period - elp;
+            if(delay < time_till_next) time_till_next = delay;
+        }
+        timer = lv_timer_get_next(timer);
+    }
+    return time_till_next;
+}
+
+static bool is_test_timer(lv_timer_t * timer)
+{
+    return timer->timer_cb == record_cb || timer->timer_cb == del_other_cb || timer->timer_cb == empty_cb;
+}
+
+static uint32_t get_test_timer_cnt(void)
+{
+    uint32_t cnt = 0;
+    lv_timer_t * timer = lv_timer_get_next(NULL);
+    while(timer) {
+        if(is_test_timer(timer)) cnt++;
+        timer = lv_timer_get_next(timer);
+    }
+    return cnt;
+}
+
+static void del_test_timers(void)
+{
+    lv_timer_t * timer = lv_timer_get_next(NULL);
+    while(timer) {
+        lv_timer_t * next = lv_timer_get_next(timer);
+        if(is_test_timer(timer)) lv_timer_del(timer);
+        timer = next;
+    }
+}
+
+void setUp(void)
+{
+    /*Pause the timers of the display and input devices to have only the timers of the test*/
+    sys_timer_cnt = 0;
+    lv_timer_t * timer = lv_timer_get_next(NULL);
+    while(timer && sys_timer_cnt < SYS_TIMER_MAX) {
+        if(!timer->paused) {
+            lv_timer_pause(timer);
+            sys_timers[sys_timer_cnt++] = timer;
+        }
+        timer = lv_timer_get_next(timer);
+    }
+
+    lv_memset_00(run_order, sizeof(run_order));
+    run_cnt = 0;
+}
+
+void tearDown(void)
+{
+    del_test_timers();
+
+    uint32_t i;
+    for(i = 0; i < sys_timer_cnt; i++) lv_timer_resume(sys_timers[i]);
+}
+
+void test_timer_heap_should_run_the_timers_in_order(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_handler());
+
+    lv_timer_create(record_cb, 35, (void *)'c');
+    lv_timer_create(record_cb, 10, (void *)'a');
+    lv_timer_create(record_cb, 25, (void *)'b');
+    TEST_ASSERT_EQUAL_UINT32(10, lv_timer_handler());
+
+    uint32_t i;
+    for(i = 0; i < 40; i++) {
+        lv_tick_inc(1);
+        lv_timer_handler();
+    }
+
+    /*a: 10, 20, 30, 40; b: 25; c: 35*/
+    TEST_ASSERT_EQUAL_STRING("aabaca", run_order);
+    TEST_ASSERT_EQUAL_UINT32(6, run_cnt);
+    TEST_ASSERT_EQUAL_UINT32(10, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(scan_time_till_next(), lv_timer_handler());
+}
+
+void test_timer_heap_should_follow_the_changes(void)
+{
+    lv_timer_t * a = lv_timer_create(record_cb, 100, (void *)'a');
+    lv_timer_t * b = lv_timer_create(record_cb, 200, (void *)'b');
+    TEST_ASSERT_EQUAL_UINT32(100, lv_timer_handler());
+
+    lv_timer_pause(a);
+    TEST_ASSERT_EQUAL_UINT32(200, lv_timer_handler());
+
+    lv_timer_set_period(b, 50);
+    TEST_ASSERT_EQUAL_UINT32(50, lv_timer_handler());
+
+    lv_timer_resume(a);
+    lv_tick_inc(40);
+    TEST_ASSERT_EQUAL_UINT32(10, lv_timer_handler());
+
+    lv_timer_reset(b);
+    TEST_ASSERT_EQUAL_UINT32(50, lv_timer_handler());
+
+    lv_timer_ready(a);
+    TEST_ASSERT_EQUAL_UINT32(50, lv_timer_handler());
+    TEST_ASSERT_EQUAL_STRING("a", run_order);
+
+    lv_timer_del(b);
+    TEST_ASSERT_EQUAL_UINT32(100, lv_timer_handler());
+    lv_timer_del(a);
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_handler());
+}
+
+void test_timer_heap_should_handle_changes_in_the_callbacks(void)
+{
+    /*A timer with 0 period runs once in a call*/
+    lv_timer_t * z = lv_timer_create(record_cb, 0, (void *)'z');
+    TEST_ASSERT_EQUAL_UINT32(0, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt);
+    lv_timer_del(z);
+
+    /*Repeat count*/
+    run_cnt = 0;
+    lv_timer_t * r = lv_timer_create(record_cb, 10, (void *)'r');
+    lv_timer_set_repeat_count(r, 2);
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        lv_tick_inc(10);
+        lv_timer_handler();
+    }
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, get_test_timer_cnt());
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_handler());
+
+    /*Delete an other timer from a callback*/
+    run_cnt = 0;
+    lv_memset_00(run_order, sizeof(run_order));
+    lv_timer_create(del_other_cb, 10, (void *)'d');
+    lv_timer_create(record_cb, 20, (void *)'o');
+    lv_tick_inc(10);
+    TEST_ASSERT_EQUAL_UINT32(10, lv_timer_handler());
+    TEST_ASSERT_EQUAL_STRING("d", run_order);
+    TEST_ASSERT_EQUAL_UINT32(1, get_test_timer_cnt());
+    TEST_ASSERT_EQUAL_UINT32(scan_time_till_next(), lv_timer_handler());
+}
+
+void test_timer_heap_should_not_starve_the_timers_behind_a_0_period_one(void)
+{
+    lv_timer_t * z = lv_timer_create(record_cb, 0, (void *)'z');
+    lv_timer_handler();
+    lv_timer_create(record_cb, 10, (void *)'a');
+
+    /*Both run once in each call, no matter which is on the top of the heap*/
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        run_cnt = 0;
+        lv_memset_00(run_order, sizeof(run_order));
+        lv_tick_inc(10);
+        TEST_ASSERT_EQUAL_UINT32(0, lv_timer_handler());
+        TEST_ASSERT_EQUAL_UINT32(2, run_cnt);
+        TEST_ASSERT_NOT_NULL(strchr(run_order, 'a'));
+        TEST_ASSERT_NOT_NULL(strchr(run_order, 'z'));
+    }
+
+    /*Only the 0 period timer is ready*/
+    run_cnt = 0;
+    lv_tick_inc(5);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt);
+
+    lv_timer_del(z);
+    TEST_ASSERT_EQUAL_UINT32(5, lv_timer_handler());
+}
+
+/*Cost of `lv_timer_handler()` with many idle timers compared to checking all of them*/
+void test_timer_heap_benchmark(void)
+{
+    static const uint32_t timer_nums[] = {10, 100, 1000};
+    char msg[160];
+
+    uint32_t n;
+    for(n = 0; n < sizeof(timer_nums) / sizeof(timer_nums[0]); n++) {
+        uint32_t i;
+        for(i = 0; i < timer_nums[n]; i++) {
+            lv_timer_create(empty_cb, 500 + (i * 37) % 1000, NULL);
+        }
+
+        uint32_t t = lv_test_get_time_us();
+        uint32_t sum = 0;
+        for(i = 0; i < BENCH_CALLS; i++) {
+            lv_tick_inc(1);
+            sum += lv_timer_handler();
+        }
+        uint32_t heap_us = lv_test_get_time_us() - t;
+
+        t = lv_test_get_time_us();
+        uint32_t scan_sum = 0;
+        for(i = 0; i < BENCH_CALLS; i++) {
+            scan_sum += scan_time_till_next();
+        }
+        uint32_t scan_us = lv_test_get_time_us() - t;
+        TEST_ASSERT_NOT_EQUAL(0, sum + scan_sum);
+
+        lv_snprintf(msg, sizeof(msg), "%" LV_PRIu32 " timers: %" LV_PRIu32 " ns/handler call with the heap, %" LV_PRIu32
+                    " ns/call only to scan the list", timer_nums[n], heap_us * 1000 / BENCH_CALLS, scan_us * 1000 / BENCH_CALLS);
+        TEST_MESSAGE(msg);
+
+        del_test_timers();
+    }
+}
+
+#else
+
+void setUp(void)
+{
+
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_timer_heap_should_run_the_timers_in_order(void)
+{
+
+}
+
+void test_timer_heap_should_follow_the_changes(void)
+{
+
+}
+
+void test_timer_heap_should_handle_changes_in_the_callbacks(void)
+{
+
+}
+
+void test_timer_heap_should_not_starve_the_timers_behind_a_0_period_one(void)
+{
+
+}
+
+void test_timer_heap_benchmark(void)
+{
+
+}
+
+#endif
+
+#endif
@@ -0,0 +1,335 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_TIMG && LV_USE_PNG && LV_COLOR_DEPTH == 32
+
+#include <stdlib.h>
+#include "lv_test_helpers.h"
+
+/*The test images are made with
+ *  scripts/img_to_timg.py cgflogo.png --depth 32 --compress rle|lz4 -o cgflogo_rle|lz4.timg
+ *  scripts/img_to_timg.py cgflogo.png --depth 32 --colors 64 -o cgflogo_pal.timg*/
+#define PNG_PATH    "A:src/test_files/timg/cgflogo.png"
+#define RLE_PATH    "A:src/test_files/timg/cgflogo_rle.timg"
+#define LZ4_PATH    "B:src/test_files/timg/cgflogo_lz4.timg"
+#define PAL_PATH    "A:src/test_files/timg/cgflogo_pal.timg"
+#define IMG_W       300
+#define IMG_H       173
+#define HOR_RES     800
+#define VER_RES     480
+#define BENCH_FRAMES    20
+
+extern lv_color_t test_fb[];
+
+static lv_color_t ref_fb[HOR_RES * VER_RES];
+static lv_obj_t * active_screen = NULL;
+static lv_obj_t * img;
+
+/*Load a file to a C array like image*/
+static uint8_t * load_file(const char * path, lv_img_dsc_t * dsc)
+{
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, path, LV_FS_MODE_RD));
+    uint32_t size;
+    lv_fs_seek(&f, 0, LV_FS_SEEK_END);
+    lv_fs_tell(&f, &size);
+    lv_fs_seek(&f, 0, LV_FS_SEEK_SET);
+
+    uint8_t * data = lv_mem_alloc(size);
+    TEST_ASSERT_NOT_NULL(data);
+    uint32_t rn;
+    lv_fs_read(&f, data, size, &rn);
+    lv_fs_close(&f);
+    TEST_ASSERT_EQUAL_UINT32(size, rn);
+
+    lv_memset_00(dsc, sizeof(lv_img_dsc_t));
+    dsc->header.w = IMG_W;
+    dsc->header.h = IMG_H;
+    dsc->header.cf = LV_IMG_CF_RAW;
+    dsc->data_size = size;
+    dsc->data = data;
+    return data;
+}
+
+/*Draw the image from scratch*/
+static void draw(const void * src)
+{
+    lv_img_cache_invalidate_src(NULL);
+    lv_img_set_src(img, src);
+    lv_obj_invalidate(active_screen);
+    lv_refr_now(NULL);
+}
+
+void setUp(void)
+{
+    active_screen = lv_scr_act();
+    img = lv_img_create(active_screen);
+    lv_obj_center(img);
+
+    /*Decode the whole image by default*/
+    lv_timg_set_cache(IMG_W * IMG_H * sizeof(lv_color_t), LV_TIMG_TILE_CACHE_SIZE);
+
+    draw(PNG_PATH);
+    lv_memcpy(ref_fb, test_fb, sizeof(ref_fb));
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+    lv_img_cache_invalidate_src(NULL);
+}
+
+void test_timg_should_look_like_the_png(void)
+{
+    lv_img_header_t header;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_get_info(RLE_PATH, &header));
+    TEST_ASSERT_EQUAL(IMG_W, header.w);
+    TEST_ASSERT_EQUAL(IMG_H, header.h);
+    TEST_ASSERT_EQUAL(LV_IMG_CF_TRUE_COLOR, header.cf);
+
+    draw(RLE_PATH);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+
+    draw(LZ4_PATH);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+
+    /*From a C array*/
+    lv_img_dsc_t dsc;
+    uint8_t * data = load_file(LZ4_PATH, &dsc);
+    draw(&dsc);
+    TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+    lv_obj_clean(active_screen);
+    lv_img_cache_invalidate_src(NULL);
+    lv_mem_free(data);
+}
+
+/*Decoding the tiles on demand gives the same*/
+void test_timg_tiles_on_demand(void)
+{
+    lv_img_dsc_t dsc;
+    uint8_t * data = load_file(RLE_PATH, &dsc);
+
+    /*One row of tiles and a few rows*/
+    uint32_t caches[] = {0, 64 * 1024};
+    uint32_t i;
+    for(i = 0; i < sizeof(caches) / sizeof(caches[0]); i++) {
+        lv_timg_set_cache(0, caches[i]);
+
+        lv_img_decoder_dsc_t dec;
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dec, LZ4_PATH, lv_color_white(), 0));
+        TEST_ASSERT_NULL(dec.img_data);
+        lv_img_decoder_close(&dec);
+
+        draw(LZ4_PATH);
+        TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+
+        draw(&dsc);
+        TEST_ASSERT_EQUAL_MEMORY(ref_fb, test_fb, sizeof(ref_fb));
+    }
+
+    lv_obj_clean(active_screen);
+    lv_img_cache_invalidate_src(NULL);
+    lv_mem_free(data);
+}
+
+/*Read random parts of lines, also across tiles and backwards*/
+void test_timg_read_line(void)
+{
+    lv_img_decoder_dsc_t png;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&png, PNG_PATH, lv_color_white(), 0));
+    TEST_ASSERT_NOT_NULL(png.img_data);
+
+    lv_timg_set_cache(0, 0);
+    lv_img_decoder_dsc_t dec;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dec, RLE_PATH, lv_color_white(), 0));
+
+    uint8_t buf[IMG_W * sizeof(lv_color_t)];
+    srand(1);
+    uint32_t i;
+    for(i = 0; i < 2000; i++) {
+        lv_coord_t y = rand() % IMG_H;
+        lv_coord_t x = rand() % IMG_W;
+        lv_coord_t len = 1 + rand() % (IMG_W - x);
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dec, x, y, len, buf));
+        TEST_ASSERT_EQUAL_MEMORY(&png.img_data[(y * IMG_W + x) * sizeof(lv_color_t)], buf, len * sizeof(lv_color_t));
+    }
+
+    /*Out of the image*/
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_read_line(&dec, IMG_W - 10, 0, 11, buf));
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_read_line(&dec, 0, IMG_H, 1, buf));
+
+    lv_img_decoder_close(&dec);
+    lv_img_decoder_close(&png);
+}
+
+/*The palette has fewer colors, so the pixels are only close: less than 8 difference on average*/
+void test_timg_palette(void)
+{
+    draw(PAL_PATH);
+
+    uint32_t diff = 0;
+    uint32_t max_diff = 0;
+    uint32_t i;
+    for(i = 0; i < HOR_RES * VER_RES; i++) {
+        uint32_t d = LV_ABS(test_fb[i].ch.red - ref_fb[i].ch.red) + LV_ABS(test_fb[i].ch.green - ref_fb[i].ch.green) +
+                     LV_ABS(test_fb[i].ch.blue - ref_fb[i].ch.blue);
+        diff += d;
+        max_diff = LV_MAX(max_diff, d);
+    }
+
+    TEST_ASSERT_NOT_EQUAL(0, max_diff);
+    TEST_ASSERT_LESS_THAN_UINT32(8 * IMG_W * IMG_H, diff);
+}
+
+void test_timg_should_reject_corrupted_data(void)
+{
+    lv_img_dsc_t dsc;
+    uint8_t * data = load_file(LZ4_PATH, &dsc);
+    uint32_t size = dsc.data_size;
+    lv_img_header_t header;
+    lv_img_decoder_dsc_t dec;
+
+    /*Not a tiled image*/
+    data[0] = 'X';
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_get_info(&dsc, &header));
+    data[0] = 'L';
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_get_info(&dsc, &header));
+
+    /*Other color depth*/
+    data[7] = 16;
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_get_info(&dsc, &header));
+    data[7] = 32;
+
+    /*Truncated*/
+    dsc.data_size = size / 2;
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_open(&dec, &dsc, lv_color_white(), 0));
+    dsc.data_size = 30;
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_open(&dec, &dsc, lv_color_white(), 0));
+    dsc.data_size = size;
+
+    /*Garbage in the tiles is an error when the whole image is decoded and later if the tiles are decoded on demand*/
+    uint32_t i;
+    srand(2);
+    for(i = size / 2; i < size; i += 97) data[i] = rand();
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_open(&dec, &dsc, lv_color_white(), 0));
+
+    lv_timg_set_cache(0, 0);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dec, &dsc, lv_color_white(), 0));
+    uint8_t buf[IMG_W * sizeof(lv_color_t)];
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_read_line(&dec, 0, IMG_H - 1, IMG_W, buf));
+    lv_img_decoder_close(&dec);
+
+    /*It's still drawn without crash*/
+    draw(&dsc);
+    lv_obj_clean(active_screen);
+    lv_img_cache_invalidate_src(NULL);
+    lv_mem_free(data);
+}
+
+static void bench(const char * name, const void * src, uint32_t flash_size)
+{
+    uint32_t t = lv_test_get_time_us();
+    uint32_t i;
+    for(i = 0; i < BENCH_FRAMES; i++) draw(src);
+    uint32_t first_us = (lv_test_get_time_us() - t) / BENCH_FRAMES;
+
+    t = lv_test_get_time_us();
+    for(i = 0; i < BENCH_FRAMES; i++) {
+        lv_obj_invalidate(active_screen);
+        lv_refr_now(NULL);
+    }
+    uint32_t redraw_us = (lv_test_get_time_us() - t) / BENCH_FRAMES;
+
+    char msg[160];
+    lv_snprintf(msg, sizeof(msg), "%s: %" LV_PRIu32 " bytes, first frame %" LV_PRIu32 " us, redraw %" LV_PRIu32 " us",
+                name, flash_size, first_us, redraw_us);
+    TEST_MESSAGE(msg);
+}
+
+void test_timg_benchmark(void)
+{
+    /*The pixels of the PNG as a raw C array*/
+    lv_img_decoder_dsc_t png;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&png, PNG_PATH, lv_color_white(), 0));
+    lv_img_dsc_t raw;
+    lv_memset_00(&raw, sizeof(raw));
+    raw.header.w = IMG_W;
+    raw.header.h = IMG_H;
+    raw.header.cf = LV_IMG_CF_TRUE_COLOR;
+    raw.data_size = IMG_W * IMG_H * sizeof(lv_color_t);
+    uint8_t * raw_data = lv_mem_alloc(raw.data_size);
+    lv_memcpy(raw_data, png.img_data, raw.data_size);
+    raw.data = raw_data;
+    lv_img_decoder_close(&png);
+
+    lv_fs_file_t f;
+    uint32_t png_size;
+    lv_fs_open(&f, PNG_PATH, LV_FS_MODE_RD);
+    lv_fs_seek(&f, 0, LV_FS_SEEK_END);
+    lv_fs_tell(&f, &png_size);
+    lv_fs_close(&f);
+
+    lv_img_dsc_t rle;
+    lv_img_dsc_t lz4;
+    lv_img_dsc_t pal;
+    uint8_t * rle_data = load_file(RLE_PATH, &rle);
+    uint8_t * lz4_data = load_file(LZ4_PATH, &lz4);
+    uint8_t * pal_data = load_file(PAL_PATH, &pal);
+
+    bench("Raw C array", &raw, raw.data_size);
+    bench("PNG file", PNG_PATH, png_size);
+    bench("RLE C array", &rle, rle.data_size);
+    bench("LZ4 C array", &lz4, lz4.data_size);
+    bench("LZ4 file", LZ4_PATH, lz4.data_size);
+    bench("Palette C array", &pal, pal.data_size);
+
+    lv_timg_set_cache(0, LV_TIMG_TILE_CACHE_SIZE);
+    bench("LZ4 C array, tiles on demand", &lz4, lz4.data_size);
+
+    lv_obj_clean(active_screen);
+    lv_img_cache_invalidate_src(NULL);
+    lv_mem_free(raw_data);
+    lv_mem_free(rle_data);
+    lv_mem_free(lz4_data);
+    lv_mem_free(pal_data);
+}
+
+#else /*LV_USE_TIMG && LV_USE_PNG && LV_COLOR_DEPTH == 32*/
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_timg_should_look_like_the_png(void)
+{
+}
+
+void test_timg_tiles_on_demand(void)
+{
+}
+
+void test_timg_read_line(void)
+{
+}
+
+void test_timg_palette(void)
+{
+}
+
+void test_timg_should_reject_corrupted_data(void)
+{
+}
+
+void test_timg_benchmark(void)
+{
+}
+
+#endif /*LV_USE_TIMG && LV_USE_PNG && LV_COLOR_DEPTH == 32*/
+
+#endif
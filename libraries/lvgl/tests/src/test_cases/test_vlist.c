@@ -0,0 +1,308 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_VLIST
+
+#include "lv_test_helpers.h"
+
+#define ROW_H           30
+#define LIST_H          300
+#define BENCH_FRAMES    100
+
+static lv_obj_t * active_screen = NULL;
+static lv_obj_t * vlist;
+static uint32_t cell_cb_cnt;
+static uint32_t value_changed_cnt;
+
+static void cell_cb(lv_obj_t * obj, uint32_t row, uint16_t col, char * buf, uint32_t buf_size)
+{
+    LV_UNUSED(obj);
+    cell_cb_cnt++;
+    if(col == 0) lv_snprintf(buf, buf_size, "Row %" LV_PRIu32, row);
+    else lv_snprintf(buf, buf_size, "%" LV_PRIu32, row * 10);
+}
+
+static void value_changed_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    value_changed_cnt++;
+}
+
+static const char * get_row_text(uint32_t row, uint16_t col)
+{
+    lv_obj_t * row_obj = lv_vlist_get_row_obj(vlist, row);
+    TEST_ASSERT_NOT_NULL(row_obj);
+    return lv_label_get_text(lv_obj_get_child(row_obj, col));
+}
+
+static lv_obj_t * create_vlist(uint32_t row_cnt)
+{
+    lv_obj_t * obj = lv_vlist_create(active_screen);
+    lv_obj_set_size(obj, 300, LIST_H);
+    lv_vlist_set_row_height(obj, ROW_H);
+    lv_vlist_set_col_cnt(obj, 2);
+    lv_vlist_set_col_width(obj, 1, 80);
+    lv_vlist_set_cell_cb(obj, cell_cb);
+    lv_vlist_set_row_cnt(obj, row_cnt);
+    lv_obj_update_layout(obj);
+    return obj;
+}
+
+#if LV_MEM_CUSTOM == 0
+static void set_text_for_table(lv_obj_t * table, uint32_t row_cnt)
+{
+    char buf[32];
+    lv_table_set_col_cnt(table, 2);
+    lv_table_set_row_cnt(table, row_cnt);
+    uint32_t i;
+    for(i = 0; i < row_cnt; i++) {
+        cell_cb(table, i, 0, buf, sizeof(buf));
+        lv_table_set_cell_value(table, i, 0, buf);
+        cell_cb(table, i, 1, buf, sizeof(buf));
+        lv_table_set_cell_value(table, i, 1, buf);
+    }
+}
+#endif
+
+void setUp(void)
+{
+    active_screen = lv_scr_act();
+    cell_cb_cnt = 0;
+    value_changed_cnt = 0;
+    vlist = create_vlist(1000);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+}
+
+void test_vlist_should_create_objects_only_for_the_visible_rows(void)
+{
+    uint16_t cnt = lv_vlist_get_row_obj_cnt(vlist);
+    lv_coord_t content_h = lv_obj_get_content_height(vlist);
+    TEST_ASSERT_EQUAL_UINT16((content_h + ROW_H - 1) / ROW_H + 1 + 2 * LV_VLIST_OVERSCAN, cnt);
+    TEST_ASSERT_EQUAL_UINT32(cnt, lv_obj_get_child_cnt(vlist));
+
+    /*The number of objects doesn't depend on the number of rows*/
+    lv_vlist_set_row_cnt(vlist, 100000);
+    TEST_ASSERT_EQUAL_UINT16(cnt, lv_vlist_get_row_obj_cnt(vlist));
+    TEST_ASSERT_EQUAL_UINT32(cnt, lv_obj_get_child_cnt(vlist));
+
+    /*Fewer rows than objects*/
+    lv_vlist_set_row_cnt(vlist, 3);
+    TEST_ASSERT_EQUAL_UINT16(cnt, lv_vlist_get_row_obj_cnt(vlist));
+    TEST_ASSERT_NOT_NULL(lv_vlist_get_row_obj(vlist, 2));
+    TEST_ASSERT_NULL(lv_vlist_get_row_obj(vlist, 3));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_vlist_get_scroll_y(vlist));
+}
+
+void test_vlist_should_fill_and_position_the_rows(void)
+{
+    TEST_ASSERT_EQUAL_STRING("Row 0", get_row_text(0, 0));
+    TEST_ASSERT_EQUAL_STRING("50", get_row_text(5, 1));
+    TEST_ASSERT_NULL(lv_vlist_get_row_obj(vlist, 100));
+
+    lv_area_t content;
+    lv_obj_get_content_coords(vlist, &content);
+    lv_obj_t * row_obj = lv_vlist_get_row_obj(vlist, 3);
+    TEST_ASSERT_EQUAL(content.y1 + 3 * ROW_H, row_obj->coords.y1);
+    TEST_ASSERT_EQUAL(ROW_H, lv_obj_get_height(row_obj));
+
+    /*The fixed width column is at the end, the first column gets the rest*/
+    lv_obj_t * label1 = lv_obj_get_child(row_obj, 1);
+    TEST_ASSERT_EQUAL(80, lv_obj_get_width(label1));
+    TEST_ASSERT_EQUAL(lv_obj_get_content_width(row_obj), lv_obj_get_width(lv_obj_get_child(row_obj, 0)) +
+                      lv_obj_get_style_pad_column(row_obj, LV_PART_MAIN) + 80);
+}
+
+void test_vlist_should_scroll_with_reusing_the_rows(void)
+{
+    lv_area_t content;
+    lv_obj_get_content_coords(vlist, &content);
+    uint16_t obj_cnt = lv_vlist_get_row_obj_cnt(vlist);
+
+    /*The next row is already shown in the overscan*/
+    cell_cb_cnt = 0;
+    lv_vlist_scroll_to_y(vlist, ROW_H, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_UINT32(0, cell_cb_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_vlist_get_first_visible_row(vlist));
+
+    /*Scrolling by one more row fills only one row*/
+    lv_vlist_scroll_to_y(vlist, 2 * ROW_H, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_UINT32(2, cell_cb_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2, lv_vlist_get_first_visible_row(vlist));
+
+    /*Far away, all the rows are filled but only once*/
+    cell_cb_cnt = 0;
+    lv_vlist_scroll_to_row(vlist, 500, LV_ANIM_OFF);
+    lv_obj_update_layout(vlist);
+    TEST_ASSERT_EQUAL_UINT32(obj_cnt * 2, cell_cb_cnt);
+    TEST_ASSERT_EQUAL_UINT32(500 * ROW_H, lv_vlist_get_scroll_y(vlist));
+    TEST_ASSERT_EQUAL_STRING("Row 500", get_row_text(500, 0));
+    TEST_ASSERT_EQUAL(content.y1, lv_vlist_get_row_obj(vlist, 500)->coords.y1);
+    TEST_ASSERT_EQUAL(content.y1 - ROW_H, lv_vlist_get_row_obj(vlist, 499)->coords.y1);
+
+    /*Clamped to the last row*/
+    lv_vlist_scroll_to_row(vlist, 5000, LV_ANIM_OFF);
+    lv_obj_update_layout(vlist);
+    TEST_ASSERT_EQUAL_UINT32(1000 * ROW_H - lv_obj_get_content_height(vlist), lv_vlist_get_scroll_y(vlist));
+    TEST_ASSERT_EQUAL(content.y2, lv_vlist_get_row_obj(vlist, 999)->coords.y2);
+
+    /*Fewer rows keep the position in range*/
+    lv_vlist_set_row_cnt(vlist, 20);
+    TEST_ASSERT_EQUAL_UINT32(20 * ROW_H - lv_obj_get_content_height(vlist), lv_vlist_get_scroll_y(vlist));
+    TEST_ASSERT_EQUAL_STRING("Row 19", get_row_text(19, 0));
+
+    /*Beyond the 16 bit coordinates*/
+    lv_vlist_set_row_cnt(vlist, 100000);
+    lv_vlist_scroll_to_row(vlist, 99000, LV_ANIM_OFF);
+    lv_obj_update_layout(vlist);
+    TEST_ASSERT_EQUAL_STRING("Row 99000", get_row_text(99000, 0));
+    TEST_ASSERT_EQUAL(content.y1, lv_vlist_get_row_obj(vlist, 99000)->coords.y1);
+}
+
+void test_vlist_should_select_rows(void)
+{
+    lv_obj_add_event_cb(vlist, value_changed_cb, LV_EVENT_VALUE_CHANGED, NULL);
+    TEST_ASSERT_EQUAL_UINT32(LV_VLIST_NONE, lv_vlist_get_selected_row(vlist));
+
+    lv_vlist_set_selected_row(vlist, 2);
+    TEST_ASSERT_TRUE(lv_obj_has_state(lv_vlist_get_row_obj(vlist, 2), LV_STATE_CHECKED));
+
+    uint32_t key = LV_KEY_DOWN;
+    lv_event_send(vlist, LV_EVENT_KEY, &key);
+    TEST_ASSERT_EQUAL_UINT32(3, lv_vlist_get_selected_row(vlist));
+    TEST_ASSERT_FALSE(lv_obj_has_state(lv_vlist_get_row_obj(vlist, 2), LV_STATE_CHECKED));
+    TEST_ASSERT_TRUE(lv_obj_has_state(lv_vlist_get_row_obj(vlist, 3), LV_STATE_CHECKED));
+    TEST_ASSERT_EQUAL_UINT32(1, value_changed_cnt);
+
+    /*The selected row is scrolled into view*/
+    uint32_t i;
+    for(i = 0; i < 20; i++) lv_event_send(vlist, LV_EVENT_KEY, &key);
+    TEST_ASSERT_EQUAL_UINT32(23, lv_vlist_get_selected_row(vlist));
+    lv_anim_del(vlist, NULL);
+    lv_vlist_scroll_to_y(vlist, 24 * ROW_H - lv_obj_get_content_height(vlist), LV_ANIM_OFF);
+    TEST_ASSERT_TRUE(lv_obj_has_state(lv_vlist_get_row_obj(vlist, 23), LV_STATE_CHECKED));
+
+    /*The selection is kept for the rows which become visible again*/
+    lv_vlist_scroll_to_row(vlist, 600, LV_ANIM_OFF);
+    TEST_ASSERT_NULL(lv_vlist_get_row_obj(vlist, 23));
+    lv_vlist_scroll_to_row(vlist, 20, LV_ANIM_OFF);
+    TEST_ASSERT_TRUE(lv_obj_has_state(lv_vlist_get_row_obj(vlist, 23), LV_STATE_CHECKED));
+
+    /*Removed rows can't be selected*/
+    lv_vlist_set_row_cnt(vlist, 10);
+    TEST_ASSERT_EQUAL_UINT32(LV_VLIST_NONE, lv_vlist_get_selected_row(vlist));
+}
+
+/*Memory and frame time of scrolling with different number of rows*/
+void test_vlist_benchmark(void)
+{
+    static const uint32_t row_nums[] = {100, 10000, 100000};
+    char msg[200];
+
+    lv_obj_clean(active_screen);
+
+    uint32_t n;
+    for(n = 0; n < sizeof(row_nums) / sizeof(row_nums[0]); n++) {
+        uint32_t row_cnt = row_nums[n];
+
+#if LV_MEM_CUSTOM == 0
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+        uint32_t used_before = mon.total_size - mon.free_size;
+#endif
+        vlist = create_vlist(row_cnt);
+        lv_refr_now(NULL);
+
+#if LV_MEM_CUSTOM == 0
+        lv_mem_monitor(&mon);
+        uint32_t vlist_mem = mon.total_size - mon.free_size - used_before;
+
+        /*The same data in a table which stores all the cells*/
+        uint32_t table_mem = 0;
+        if(row_cnt <= 10000) {
+            lv_mem_monitor(&mon);
+            used_before = mon.total_size - mon.free_size;
+            lv_obj_t * table = lv_table_create(active_screen);
+            set_text_for_table(table, row_cnt);
+            lv_mem_monitor(&mon);
+            table_mem = mon.total_size - mon.free_size - used_before;
+            lv_obj_del(table);
+        }
+#endif
+
+        /*Scroll a row in each frame from the middle of the list*/
+        lv_vlist_scroll_to_row(vlist, row_cnt / 2, LV_ANIM_OFF);
+        lv_refr_now(NULL);
+        uint32_t t = lv_test_get_time_us();
+        uint32_t i;
+        for(i = 0; i < BENCH_FRAMES; i++) {
+            lv_vlist_scroll_to_y(vlist, lv_vlist_get_scroll_y(vlist) + ROW_H / 3, LV_ANIM_OFF);
+            lv_refr_now(NULL);
+        }
+        uint32_t frame_us = (lv_test_get_time_us() - t) / BENCH_FRAMES;
+        TEST_ASSERT_EQUAL_UINT32(row_cnt / 2 + (BENCH_FRAMES * (ROW_H / 3)) / ROW_H,
+                                 lv_vlist_get_first_visible_row(vlist));
+
+#if LV_MEM_CUSTOM == 0
+        if(table_mem) {
+            lv_snprintf(msg, sizeof(msg), "%" LV_PRIu32 " rows: %" LV_PRIu32 " bytes (table: %" LV_PRIu32 " bytes), %"
+                        LV_PRIu32 " us/frame while scrolling", row_cnt, vlist_mem, table_mem, frame_us);
+        }
+        else {
+            lv_snprintf(msg, sizeof(msg), "%" LV_PRIu32 " rows: %" LV_PRIu32 " bytes, %" LV_PRIu32 " us/frame while scrolling",
+                        row_cnt, vlist_mem, frame_us);
+        }
+#else
+        lv_snprintf(msg, sizeof(msg), "%" LV_PRIu32 " rows: %" LV_PRIu32 " us/frame while scrolling", row_cnt, frame_us);
+#endif
+        TEST_MESSAGE(msg);
+
+        lv_obj_del(vlist);
+    }
+}
+
+#else
+
+void setUp(void)
+{
+
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_vlist_should_create_objects_only_for_the_visible_rows(void)
+{
+
+}
+
+void test_vlist_should_fill_and_position_the_rows(void)
+{
+
+}
+
+void test_vlist_should_scroll_with_reusing_the_rows(void)
+{
+
+}
+
+void test_vlist_should_select_rows(void)
+{
+
+}
+
+void test_vlist_benchmark(void)
+{
+
+}
+
+#endif
+
+#endif
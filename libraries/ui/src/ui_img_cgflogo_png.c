@@ -1,834 +1,1157 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.5.1
-// LVGL version: 8.3.11
-// Project name: tempController_2_gui
+// Generated by lvgl/scripts/img_to_timg.py from cgfLogo.png
+// 300x173, 16 bit, 64x16 tiles, LZ4: 35588 bytes instead of 103800
 
-#include "ui.h"
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+#if !LV_USE_TIMG
+    #error "Enable LV_USE_TIMG in lv_conf.h to show ui_img_cgflogo_png"
+#endif
+
+#if LV_COLOR_DEPTH != 16 || LV_COLOR_16_SWAP != 0
+    #error "ui_img_cgflogo_png was converted for other color settings (LV_COLOR_DEPTH = 16, LV_COLOR_16_SWAP = 0)"
+#endif
 
 #ifndef LV_ATTRIBUTE_MEM_ALIGN
     #define LV_ATTRIBUTE_MEM_ALIGN
 #endif
 
-// IMAGE DATA: assets/cgfLogo.png
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_cgflogo_png_data[] = {
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xDE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x9D,0xF7,0x5C,0xEF,0x1B,0xE7,0xFB,0xE6,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xEF,0x83,0xAE,0x7B,0x8D,0x7B,0x8D,0x7B,0x8D,0x7B,0x6D,0x73,0x13,0xA5,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xF7,0x58,0xCE,0x71,0x94,0x8D,0x7B,0x6C,0x73,0x6C,0x73,0x6D,0x73,0xCE,0x83,0x13,0xAD,0xBA,0xDE,0xBE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xBE,0xFF,0xBE,0xFF,
-    0xDE,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x71,0x94,0xEB,0x62,0xA9,0x5A,0x89,0x5A,0x69,0x52,0x69,0x52,0x0B,0x6B,0xFB,0xE6,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x69,0x52,0x48,0x52,0x68,0x52,0x68,0x5A,0x48,0x52,0x48,0x52,0x50,0x8C,0x9D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xFB,0xE6,0x6C,0x73,0x68,0x52,0x48,0x52,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x48,0x52,0x69,0x52,0xEF,0x83,0x3C,0xEF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x7D,0xF7,0x3C,0xEF,0x9E,0xFF,0xBE,0xFF,0xBE,0xFF,0xDE,0xFF,0xDF,0xFF,0xDE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xDB,0xE6,0x58,0xD6,0x54,0xB5,0x30,0x8C,0x2C,0x73,0x0B,0x6B,0x8D,0x7B,0xD2,0x9C,0x17,0xC6,0xDA,0xE6,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xAE,0x7B,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x13,0xA5,0xDE,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xFB,0xE6,0x7D,0xF7,0x69,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xEF,0x83,0x9D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xF7,0xC5,0x69,0x5A,0x48,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xCA,0x62,0x17,0xCE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x34,0xAD,0x89,0x5A,0x89,0x5A,0xAA,0x62,0xEB,0x6A,0xAE,0x83,0xD2,0xA4,0x75,0xB5,0x17,0xCE,0x58,0xD6,0x99,0xD6,0x7D,0xF7,0xDF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x1B,0xE7,0x34,0xAD,0x4C,0x73,0x48,0x52,0x68,0x5A,0x48,0x52,0x48,0x52,0x48,0x52,0x68,0x52,0x68,0x52,0x48,0x52,0x4C,0x73,0x54,0xAD,0x7D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0x5C,0xEF,0xAD,0x7B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0xCF,0x83,0x3C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0xEF,0x83,0x99,0xDE,0x69,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0xCE,0x83,0x9D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x38,0xCE,0xCA,0x62,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xAA,0x62,0x17,0xC6,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0xBE,0xFF,0x10,0x8C,0x68,0x52,0x48,0x5A,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x68,0x5A,0x68,0x52,0x68,0x52,0xCA,0x62,0x30,0x8C,0x13,0xAD,0xBA,0xDE,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xDE,0xFF,0x1B,0xE7,0x79,0xD6,0xFB,0xDE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x3C,0xEF,0x6D,0x7B,0x89,0x5A,0x48,0x5A,0x48,0x5A,
-    0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x68,0x5A,0x48,0x52,0x68,0x52,0x69,0x5A,0x91,0x94,0x7D,0xEF,0xFF,0xFF,0xDF,0xFF,0xF7,0xC5,0x34,0xAD,0x8D,0x7B,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xCA,0x62,0x17,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xE7,0x4C,0x73,0x38,0xD6,0xAA,0x62,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0xAE,0x7B,0x9D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xE7,0xEF,0x83,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,
-    0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0xAD,0x7B,0x1B,0xE7,0xFF,0xFF,0xBE,0xFF,0x91,0x94,0xB6,0xBD,0xAE,0x7B,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0x48,0x52,0x68,0x5A,0x69,0x5A,0x0C,0x6B,0x50,0x94,0x3C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xF7,0xF7,0xC5,0xF3,0xA4,0xAE,0x7B,0xA9,0x5A,0x69,0x52,0x69,0x52,0xD2,0x9C,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xEA,0x62,0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x34,0xAD,0xDE,0xFF,0xFF,0xFF,0xD7,0xBD,0x10,0x8C,0x8D,0x7B,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,
-    0x68,0x5A,0x48,0x5A,0x68,0x52,0xD2,0xA4,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x4D,0x73,0xD6,0xC5,0xEA,0x6A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xAE,0x7B,0x7D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x7D,0xEF,0xB2,0x9C,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x75,0xB5,0xDE,0xFF,0xBE,0xFF,0x6D,0x73,0x54,0xAD,0xAD,0x7B,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,
-    0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x2C,0x6B,0xBA,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xD6,0xBD,0x0B,0x63,0x68,0x52,0x48,0x52,0x48,0x52,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x52,0x50,0x94,0x9D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x91,0x9C,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0xA9,0x5A,0x79,0xD6,0xFF,0xFF,0x38,0xCE,0x8D,0x7B,0x30,0x94,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x0B,0x6B,0x1B,0xE7,0xDF,0xFF,0xFF,0xFF,0xBE,0xFF,0x6D,0x73,0xB6,0xBD,0x0B,0x6B,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x8D,0x7B,0x7D,0xF7,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xB2,0x9C,0xB2,0x9C,0x68,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0xAD,0x83,0xB6,0xC5,0x13,0xAD,0xEA,0x6A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x50,0x94,0x7D,0xF7,0x9D,0xFF,0x0B,0x6B,0x75,0xB5,0x8D,0x7B,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x8D,0x7B,0xDA,0xDE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xFB,0xE6,0xF7,0xC5,0xCE,0x83,
-    0xEA,0x62,0x69,0x5A,0x68,0x52,0xAA,0x62,0x4C,0x73,0x30,0x8C,0x38,0xCE,0xFB,0xE6,0xDE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xF3,0xA4,0x48,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xEF,0x83,0x3C,0xEF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDA,0xE6,0x0B,0x6B,0x48,0x5A,
-    0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x50,0x94,0xDF,0xFF,0x79,0xD6,0x0C,0x6B,0x13,0xAD,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0xD6,0xBD,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x8D,0x7B,0x34,0xAD,0x2C,0x73,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x6D,0x73,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0xF3,0xA4,0xAD,0x7B,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,
-    0x2C,0x6B,0x2F,0x8C,0xDA,0xE6,0x95,0xBD,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xCA,0x62,0xFB,0xE6,0x7D,0xF7,0x0B,0x63,0x95,0xBD,0x8D,0x7B,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x71,0x94,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x58,0xD6,0x6D,0x73,0x68,0x52,0x68,0x52,0x48,0x5A,0x68,0x5A,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x52,0x48,0x52,0x2C,0x6B,0x54,0xAD,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBE,0xFF,0x9D,0xF7,0x38,0xCE,0x91,0x94,0xEF,0x83,0xD6,0xBD,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xF7,0xD2,0xA4,0x68,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x4C,0x73,0xDA,0xDE,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x13,0xA5,0x89,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x70,0x9C,0xF7,0xCD,0x17,0xCE,0x2C,0x73,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0xA9,0x5A,0x9D,0xF7,0x99,0xD6,0x0B,0x6B,0x95,0xBD,
-    0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x4C,0x6B,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xAE,0x83,0xB2,0xA4,0x6C,0x7B,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x6C,0x73,0x7D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x2C,0x6B,0x99,0xDE,0xEA,0x6A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x71,0x9C,0xEA,0x62,0x69,0x52,0x70,0x94,0x7C,0xF7,0x69,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0xDA,0xE6,0x5C,0xEF,0x2C,0x6B,0xF6,0xC5,0x6D,0x7B,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,
-    0x68,0x5A,0x68,0x5A,0x6C,0x7B,0x8D,0x7B,0x89,0x5A,0x68,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0xDA,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x79,0xD6,0x0B,0x6B,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x89,0x5A,0xCE,0x83,0x3C,0xEF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0xDA,0xDE,0xB2,0x9C,0x0B,0x6B,0xAA,0x5A,0x89,0x5A,0x68,0x52,0x48,0x52,0x8D,0x7B,0xBE,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0B,0x63,0x91,0x9C,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x38,0xCE,0xFF,0xFF,0xFF,0xFF,0xDA,0xDE,0x8D,0x7B,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xA9,0x62,0x2B,0x6B,0xEA,0x62,0x34,0xAD,0x98,0xDE,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x78,0xD6,0xBA,0xDE,0x0B,0x6B,0xD6,0xC5,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x5C,0xEF,0xFF,0xFF,0xFF,0xFF,0xEF,0x8B,0x0F,0x8C,0xEF,0x8B,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,
-    0x2C,0x6B,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x5C,0xEF,0xCA,0x5A,0x1B,0xE7,0xCA,0x62,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xFB,0xEE,0xDA,0xE6,0x8D,0x73,0x2C,0x6B,0x7C,0xF7,0x89,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x69,0x52,0xDA,0xDE,0x1B,0xE7,0x4C,0x73,0x17,0xCE,0x4C,0x73,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x88,0x5A,0x50,0x94,0xFB,0xEE,0x5C,0xF7,0x8D,0x7B,0x48,0x52,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x91,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xDA,0xDE,0x4C,0x73,
-    0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x8D,0x7B,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xE7,0xBA,0xDE,0x7D,0xEF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x34,0xAD,0x89,0x5A,0x68,0x52,0x48,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xAA,0x5A,0xB6,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xAA,0x5A,0x0F,0x8C,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xD6,0xC5,0xFF,0xFF,0xDE,0xFF,
-    0x17,0xC6,0x8C,0x7B,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0x0B,0x6B,0xA9,0x5A,0x48,0x52,0xB5,0xBD,0xAD,0x83,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x34,0xAD,0xDA,0xDE,0x4C,0x73,0x17,0xCE,0x68,0x5A,0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0xAD,0x7B,0xDF,0xFF,0xDE,0xFF,0x30,0x8C,0x6D,0x73,0x70,0x9C,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x2C,0x6B,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,0xBD,0x89,0x52,0xFB,0xEE,0xCA,0x62,0x48,0x5A,0x68,0x5A,0x48,0x5A,
-    0x68,0x5A,0x48,0x52,0x68,0x52,0x5C,0xEF,0xDE,0xFF,0x13,0xA5,0x2C,0x6B,0x3B,0xEF,0x89,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0xDA,0xE6,0x99,0xD6,0x8D,0x73,0xD6,0xC5,0x0B,0x6B,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x68,0x52,0x89,0x5A,0x95,0xBD,0x9D,0xFF,0xAE,0x83,0x48,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0xEA,0x62,0xDE,0xFF,0xFF,0xFF,0x9D,0xF7,0x95,0xB5,0xD2,0xA4,0x68,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x33,0xAD,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,
-    0xDF,0xFF,0x75,0xB5,0x8A,0x5A,0x69,0x52,0x2C,0x6B,0xF3,0xA4,0x58,0xD6,0x1B,0xE7,0x5C,0xEF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xFB,0xE6,0x17,0xC6,0x75,0xAD,0xD6,0xBD,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x58,0xCE,0x48,0x52,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x30,0x8C,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0xAA,0x5A,0x0F,0x8C,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x54,0xB5,0xDE,0xFF,0x5C,0xEF,0xF2,0xA4,0xCE,0x83,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x6C,0x73,0xDA,0xE6,0x13,0xAD,0x89,0x5A,0xAE,0x7B,0xB1,0xA4,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,
-    0x50,0x94,0x3C,0xEF,0xEE,0x83,0x38,0xD6,0x68,0x5A,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xAA,0x5A,0x1B,0xE7,0xDE,0xFF,0x91,0x94,0xEB,0x62,0x13,0xAD,0x68,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x0B,0x6B,0x5C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x54,0xAD,0x89,0x52,0xFB,0xE6,0xAA,0x62,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x68,0x52,0x7D,0xF7,0xDF,0xFF,0x54,0xAD,0x8D,0x7B,0xFB,0xEE,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x89,0x5A,0xDB,0xE6,0x17,0xC6,0x8D,0x7B,0x54,0xB5,0xCA,0x62,
-    0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0xCE,0x83,0xAA,0x62,0x69,0x52,0x37,0xCE,0x17,0xCE,0x89,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x69,0x52,0x9D,0xF7,0xDE,0xFF,0x95,0xB5,0x38,0xCE,0xCA,0x62,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xEB,0x6A,0x0B,0x6B,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0xAA,0x5A,0x3C,0xEF,0xDE,0xFF,0xBE,0xFF,0xB6,0xB5,0x3C,0xEF,0x13,0xA5,0x69,0x52,0x48,0x52,0x48,0x5A,0x48,0x52,0x69,0x52,0xEA,0x62,0x30,0x8C,0x5C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDE,0xFF,0xDA,0xDE,0xF2,0xA4,0x2F,0x8C,0x8D,0x7B,0xCA,0x62,0x69,0x52,0x6D,0x73,0x7D,0xF7,0xFF,0xFF,0xDE,0xFF,0xBA,0xDE,0x89,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,
-    0x68,0x5A,0x68,0x5A,0x48,0x5A,0xCA,0x62,0x58,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0xAA,0x5A,0x0F,0x8C,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xB1,0x9C,0xBE,0xFF,0xFB,0xE6,0x30,0x8C,0x0F,0x8C,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xAE,0x7B,0xDE,0xFF,0xBE,0xFF,0xAE,0x7B,0x4C,0x73,0x33,0xAD,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0xAE,0x7B,0x9D,0xF7,0x70,0x94,0x37,0xCE,0x89,0x5A,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x13,0xAD,0xDE,0xFF,0xD2,0x9C,0x69,0x52,0xB5,0xBD,0x48,0x52,
-    0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x0B,0x6B,0x5C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x54,0xAD,0xAA,0x5A,0xFA,0xE6,0xA9,0x62,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xBE,0xFF,0xDF,0xFF,0x54,0xAD,0xAE,0x7B,0xDA,0xE6,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xAA,0x5A,0xDB,0xE6,0x75,0xB5,0xCE,0x83,0x13,0xAD,0x89,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x0B,0x6B,0xBA,0xDE,0xB2,0x9C,0x89,0x5A,0x4C,0x73,0xBA,0xE6,0x4C,0x73,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x68,0x52,0x7D,0xF7,0x58,0xCE,
-    0x71,0x94,0x95,0xB5,0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0xA9,0x62,0x70,0x9C,0x37,0xD6,0xF3,0xAC,0xAA,0x62,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0x54,0xAD,0xFE,0xFF,0x99,0xD6,0x89,0x52,0x79,0xD6,0x30,0x8C,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0xCA,0x62,0x7D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x99,0xD6,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0xB2,0x9C,0x2B,0x6B,0xCA,0x62,0x69,0x52,0x48,0x52,0x48,0x52,0x68,0x5A,0x68,0x52,0x0B,0x6B,0x99,0xD6,0xDF,0xFF,0x6D,0x73,0x71,0x94,0xAD,0x7B,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x50,0x94,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0x89,0x5A,0xCE,0x83,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,
-    0x48,0x52,0x2C,0x6B,0x9D,0xF7,0xDB,0xE6,0xEF,0x83,0x30,0x8C,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xAD,0x7B,0xDE,0xFF,0xFF,0xFF,0x75,0xB5,0x2C,0x6B,0x54,0xB5,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x0B,0x6B,0xBD,0xFF,0xB1,0x9C,0x54,0xB5,0x89,0x5A,0x48,0x52,0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xCE,0x83,0x9D,0xFF,0xF3,0xA4,0x69,0x52,0x17,0xCE,0x68,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0xCA,0x62,0x5C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x54,0xAD,0x8A,0x5A,0xFA,0xE6,
-    0xA9,0x62,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0xDE,0xFF,0xDE,0xFF,0x33,0xA5,0x0F,0x8C,0x58,0xD6,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x6C,0x73,0x3C,0xEF,0xD2,0xA4,0xEF,0x83,0x13,0xAD,0x89,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x2B,0x6B,0x7D,0xF7,0x3C,0xEF,0x0B,0x6B,0xAA,0x62,0x1B,0xEF,0xAE,0x83,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x5C,0xEF,0x54,0xAD,0x96,0xBD,0x50,0x94,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x48,0x52,0x89,0x5A,0xAE,0x83,0x1B,0xEF,0xEF,0x8B,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,
-    0x50,0x94,0xDE,0xFF,0x34,0xAD,0x69,0x52,0x99,0xDE,0xEA,0x62,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xCE,0x83,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x58,0xCE,0xEB,0x62,0x0B,0x6B,0xAD,0x7B,0x58,0xCE,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xEF,0x69,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xA9,0x5A,0x75,0xB5,0xDE,0xFF,0x4C,0x6B,0x6D,0x73,0xF2,0xA4,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0xFB,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0xA9,0x5A,0xAD,0x83,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x7D,0xF7,0xDB,0xE6,0x6D,0x73,0x30,0x94,0x89,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x6C,0x73,0x7C,0xEF,0xDF,0xFF,0xBA,0xDE,0x2C,0x6B,0x33,0xAD,0x68,0x52,0x68,0x5A,
-    0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0xCA,0x62,0x9D,0xFF,0xF3,0xA4,0x30,0x8C,0x8D,0x7B,0x68,0x52,0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xEA,0x62,0x17,0xCE,0x34,0xAD,0x69,0x52,0x58,0xD6,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xCA,0x62,0x5C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x33,0xA5,0x69,0x52,0xDA,0xE6,0x89,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x69,0x52,0xFF,0xFF,0xDE,0xFF,0x13,0xA5,0x50,0x94,0xD6,0xC5,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x0F,0x8C,0x7C,0xF7,
-    0xEF,0x83,0x30,0x8C,0xF3,0xAC,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x4C,0x73,0xDE,0xFF,0xFF,0xFF,0xAE,0x7B,0xAA,0x62,0xFB,0xEE,0xAD,0x83,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0xBA,0xE6,0xAE,0x7B,0xF7,0xC5,0x4C,0x73,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x91,0x9C,0x54,0xB5,0xCA,0x62,0xCA,0x62,0xF6,0xC5,0x50,0x94,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x2F,0x8C,0xDE,0xFF,0x30,0x8C,0xEA,0x62,0x78,0xD6,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x95,0xBD,0xDE,0xFF,0x9E,0xF7,0xBA,0xDE,0xBE,0xFF,0x54,0xB5,0x68,0x52,0x48,0x52,
-    0x68,0x52,0x68,0x52,0x89,0x5A,0xEF,0x83,0x17,0xC6,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xEF,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x71,0x94,0x9D,0xFF,0x95,0xB5,0x0B,0x6B,0x13,0xAD,0x89,0x5A,
-    0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x30,0x8C,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0xA9,0x5A,0xAD,0x83,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x3C,0xEF,0x1B,0xE7,0x2C,0x6B,0x91,0x9C,0xAA,0x62,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x0B,0x6B,0x99,0xD6,0xDF,0xFF,0x7D,0xEF,0xEB,0x6A,0x70,0x94,0x89,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x7D,0xF7,0x13,0xAD,0x6D,0x73,0xB2,0xA4,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x69,0x52,0xF3,0xAC,
-    0x34,0xAD,0x69,0x52,0x58,0xD6,0x68,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xCA,0x62,0x5C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x13,0xA5,0x89,0x52,0xDA,0xE6,0x89,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xEA,0x62,0xFF,0xFF,0xDE,0xFF,0x13,0xA5,0xB1,0x9C,0x17,0xCE,0xCE,0x83,0x8D,0x7B,0x6C,0x7B,0x4C,0x73,0xEA,0x6A,0xAA,0x5A,0xD2,0x9C,0x9D,0xF7,0x4C,0x6B,0x70,0x94,0xF2,0xAC,0x68,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x8D,0x7B,0xFF,0xFF,0xFF,0xFF,0x0F,0x84,0xCA,0x62,0x99,0xDE,0x0B,0x6B,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,
-    0x48,0x5A,0x89,0x5A,0xB9,0xDE,0xCB,0x62,0xD6,0xC5,0xCA,0x62,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x13,0xAD,0xBE,0xFF,0x74,0xB5,0xCA,0x62,0xB5,0xBD,0x2F,0x8C,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x0F,0x8C,0x7C,0xF7,0x6C,0x73,0x74,0xB5,0xB6,0xC5,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0xFB,0xE6,0xFF,0xFF,0xF7,0xC5,0xEB,0x62,0x1B,0xEF,0xAE,0x7B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x48,0x4A,0x9D,0xF7,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xDE,0xFF,0x58,0xCE,0x55,0xAD,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xDE,0xF6,0xC5,0xCA,0x62,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0xCE,0x83,0x1C,0xEF,0xBE,0xFF,0xAA,0x5A,0x91,0x9C,0x0B,0x6B,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x69,0x5A,0xDA,0xDE,0xFF,0xFF,0xDF,0xFF,0x3C,0xEF,0x89,0x5A,0xAD,0x83,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,
-    0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x79,0xD6,0x3C,0xEF,0x6D,0x73,0xF3,0xAC,0x0B,0x6B,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x95,0xBD,0xDF,0xFF,0xDE,0xFF,0xEB,0x62,0x2F,0x8C,0x2B,0x73,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0xFB,0xEE,0x34,0xAD,0x0B,0x6B,0xB5,0xBD,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0xAD,0x83,0xF2,0xA4,0x69,0x52,0x58,0xD6,0x68,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0xCA,0x62,0x3C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xDF,0xFF,0x13,0xA5,0x89,0x5A,0xDA,0xE6,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x2C,0x6B,0xFF,0xFF,0xDE,0xFF,0xF3,0xA4,0xAE,0x7B,0xF2,0xA4,0xD2,0xA4,0xD2,0xA4,0x34,0xB5,0xD6,0xC5,0x17,0xCE,0xF7,0xC5,0xBA,0xDE,0xBE,0xFF,0xEB,0x62,0xD2,0xA4,0xB1,0xA4,0x68,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0xEE,0x83,0xFF,0xFF,0xFF,0xFF,0xEF,0x83,0xCA,0x62,0x17,0xCE,0x89,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x0B,0x6B,0x99,0xDE,0x4C,0x73,0xD6,0xC5,0xCA,0x62,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x89,0x5A,0x95,0xB5,0xFE,0xFF,0xFB,0xE6,0xEA,0x62,0x95,0xBD,0xAD,0x7B,0x48,0x52,0x68,0x5A,
-    0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x50,0x94,0x99,0xDE,0x0B,0x6B,0xBA,0xE6,0xCE,0x83,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x2B,0x6B,0xDE,0xFF,0xFF,0xFF,0xF3,0xA4,0x0B,0x6B,0x5C,0xF7,0xA9,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0xAE,0x7B,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xD6,0xAE,0x7B,0xD2,0xA4,0xF7,0xC5,0x9D,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBE,0xFF,0xB2,0x9C,0x6D,0x73,0xEA,0x62,0x89,0x5A,
-    0xBA,0xDE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xD6,0xBD,0x70,0x94,0x0A,0x6B,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0xAA,0x5A,0x58,0xD6,0xDE,0xFF,0x2B,0x6B,0x50,0x94,0xEE,0x83,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x0F,0x8C,0xDE,0xFF,0xFF,0xFF,0x1C,0xE7,0x89,0x5A,0xCE,0x83,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x71,0x94,0x9D,0xF7,0x51,0x94,0x13,0xAD,0x2C,0x73,0x48,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x69,0x5A,0x34,0xAD,0xDF,0xFF,0xDF,0xFF,
-    0x0B,0x6B,0x50,0x94,0x8D,0x7B,0x48,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x89,0x5A,0x78,0xD6,0x54,0xAD,0xAA,0x5A,0x37,0xCE,0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0x89,0x5A,0x50,0x94,0x68,0x52,0x58,0xD6,0x69,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0xAA,0x62,0x3C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x13,0xA5,0x69,0x52,0xDA,0xE6,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0xAD,0x7B,0xFF,0xFF,0xDE,0xFF,0xF3,0xA4,0x69,0x52,0x89,0x5A,0xCA,0x5A,0xAA,0x5A,0xCA,0x62,0x0B,0x6B,
-    0x17,0xC6,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xCA,0x5A,0x54,0xB5,0x71,0x9C,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xD2,0xA4,0xFF,0xFF,0xFF,0xFF,0xEF,0x83,0x2C,0x6B,0x74,0xB5,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x71,0x9C,0x17,0xCE,0xEF,0x8B,0xF6,0xC5,0xAA,0x62,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x0B,0x6B,0x78,0xCE,0xFE,0xFF,0x79,0xD6,0x2C,0x6B,0x95,0xBD,0x2B,0x6B,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xD2,0xA4,0xB6,0xBD,0xEA,0x62,0x9D,0xFF,0x89,0x5A,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x68,0x52,0x70,0x94,0xFF,0xFF,0xBE,0xFF,0x71,0x94,0xD2,0xA4,
-    0x37,0xD6,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x78,0xD6,0xDE,0xFF,0x7D,0xF7,0xDE,0xFF,0x2F,0x8C,0x48,0x52,0x68,0x52,0xAA,0x62,0x4C,0x73,0xEF,0x83,0xDA,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x7D,0xEF,0x38,0xCE,0x0C,0x6B,0x68,0x52,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x52,0x8D,0x7B,0x9D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x17,0xC6,0xCE,0x83,0x2B,0x73,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0xB5,0xBD,
-    0xDE,0xFF,0x34,0xAD,0x0F,0x8C,0x50,0x94,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x0B,0x6B,0xFB,0xE6,0xFF,0xFF,0x1C,0xE7,0x89,0x5A,0xAD,0x83,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x69,0x52,0x9D,0xFF,0x13,0xA5,0xD2,0xA4,0x4C,0x73,0x48,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x69,0x5A,0xF3,0xA4,0xFF,0xFF,0xFF,0xFF,0x6D,0x73,0x30,0x94,0xEF,0x8B,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x69,0x5A,0xF6,0xC5,0xB6,0xBD,0xCA,0x62,0x99,0xDE,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x69,0x5A,
-    0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x2C,0x73,0x68,0x5A,0xF7,0xCD,0x48,0x52,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x89,0x5A,0x3C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xA4,0x89,0x5A,0xDA,0xE6,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xEF,0x83,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x5C,0xEF,0x99,0xD6,0x75,0xB5,0x71,0x94,0x6D,0x73,0x2B,0x63,0x38,0xCE,0xFF,0xFF,0xFF,0xFF,0x9E,0xF7,0x89,0x52,0x95,0xBD,0x0F,0x8C,0x68,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x17,0xCE,0xFF,0xFF,0xDF,0xFF,0x8D,0x7B,0x95,0xBD,0x0B,0x6B,0x48,0x52,
-    0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x58,0xD6,0xD2,0xA4,0x91,0x9C,0x34,0xAD,0x89,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x8D,0x7B,0x3C,0xEF,0xFE,0xFF,0x54,0xB5,0x6C,0x73,0xB6,0xBD,0xA9,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x62,0xD6,0xC5,0xB1,0x9C,0xEF,0x83,0x9D,0xFF,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x69,0x5A,0x38,0xCE,0xFE,0xFF,0x99,0xD6,0x2C,0x6B,0x78,0xD6,0xEE,0x8B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x5D,0xF7,0xDA,0xDE,0x0B,0x6B,0x17,0xCE,0x2C,0x73,0x28,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x69,0x52,0x34,0xAD,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x13,0xA5,0xAA,0x5A,0x68,0x52,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x89,0x5A,0x34,0xAD,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xD6,0x2C,0x6B,0x6C,0x73,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x91,0x9C,0xBE,0xFF,0x99,0xD6,0x6D,0x73,0x50,0x94,0x89,0x62,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x91,0x9C,0xBE,0xFF,0x1C,0xE7,0xA9,0x5A,0xAD,0x83,
-    0x48,0x5A,0x48,0x5A,0x48,0x5A,0xCA,0x6A,0x2B,0x73,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0xBE,0xFF,0x95,0xB5,0x0F,0x8C,0xCE,0x83,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x68,0x5A,0xB2,0x9C,0xBE,0xFF,0xFF,0xFF,0x92,0x9C,0x70,0x94,0x0F,0x8C,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x69,0x52,0x34,0xAD,0x99,0xDE,0x2C,0x6B,0xFB,0xE6,0x68,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x62,0xEF,0x8B,0xAA,0x62,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x69,0x5A,0x68,0x5A,0xD6,0xC5,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x69,0x5A,0x3C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD2,0x9C,0x89,0x52,0xDA,0xE6,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x50,0x8C,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xDF,0xFF,0xDE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xEF,0xAA,0x5A,0xB5,0xBD,0x6D,0x7B,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0xFB,0xE6,0xFF,0xFF,0x3C,0xEF,0x8D,0x7B,0xF2,0xAC,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xEB,0x62,0x7D,0xF7,0x6D,0x73,0xB1,0x9C,0x50,0x94,0x68,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xCE,0x83,0x9D,0xFF,0xDE,0xFF,0x4C,0x6B,0x30,0x8C,
-    0x74,0xB5,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0xAA,0x62,0x3B,0xEF,0x30,0x8C,0x54,0xAD,0x33,0xAD,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xCA,0x62,0x5C,0xEF,0xFE,0xFF,0x37,0xC6,0xEB,0x62,0xB9,0xDE,0x89,0x62,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xEE,0x83,0x9D,0xFF,0x54,0xAD,0xCF,0x83,0x95,0xBD,0xCA,0x62,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x69,0x5A,0x34,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x8C,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,
-    0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0x4C,0x73,0xDA,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE6,0xCA,0x5A,0xAD,0x7B,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xCA,0x62,0x7D,0xF7,0x1B,0xE7,0x4C,0x73,0xF2,0xA4,0xEB,0x6A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x4C,0x73,0xDA,0xDE,0x1B,0xE7,0xA9,0x5A,0xAD,0x83,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x6C,0x7B,0x2F,0x94,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0x5C,0xEF,0xF7,0xC5,0x6C,0x73,0xF2,0xA4,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,
-    0x68,0x52,0x2F,0x8C,0x7D,0xF7,0xFF,0xFF,0xD6,0xBD,0x50,0x94,0x0F,0x8C,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x91,0x9C,0x3B,0xEF,0x6D,0x73,0x3B,0xEF,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x54,0xB5,0x2C,0x73,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xB5,0xC5,0x69,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x69,0x5A,0x3C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD2,0x9C,0x89,0x52,0xB9,0xDE,0x68,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x71,0x94,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE6,0x89,0x52,0xF6,0xC5,0x0B,0x6B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xF7,0xCD,0x58,0xD6,0xB2,0x9C,0x4C,0x73,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0xD2,0xA4,0xBE,0xFF,0x0B,0x6B,0xD2,0xA4,0x0F,0x8C,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x30,0x8C,0xDE,0xFF,0xDE,0xFF,0x89,0x52,0xD2,0xA4,0x91,0x9C,0x68,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xEB,0x6A,0xFB,0xE6,0xAD,0x7B,0x38,0xCE,0x6C,0x73,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0xAE,0x7B,0x7D,0xF7,
-    0xDE,0xFF,0x54,0xAD,0x2F,0x8C,0x37,0xCE,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x68,0x52,0x74,0xB5,0xBE,0xFF,0x0C,0x6B,0xB2,0x9C,0xD2,0xA4,0x69,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x89,0x5A,0x54,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x1C,0xE7,0xBE,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x78,0xD6,0x68,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x69,0x5A,0xB2,0x9C,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x9D,0xF7,0x89,0x5A,0xEF,0x8B,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,
-    0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x1B,0xE7,0x9D,0xF7,0x50,0x94,0x13,0xAD,0x4C,0x73,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x69,0x5A,0x95,0xB5,0xFB,0xE6,0xAA,0x5A,0xAD,0x83,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x4C,0x7B,0x50,0x94,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x38,0xCE,0x99,0xD6,0x4C,0x73,0x17,0xCE,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x8D,0x73,0xFB,0xE6,0xFF,0xFF,0x79,0xD6,0xCE,0x83,0xCE,0x83,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x30,0x8C,0x7D,0xF7,0x8D,0x7B,0x99,0xDE,0x48,0x52,0x48,0x52,0x68,0x5A,
-    0x68,0x5A,0x68,0x5A,0x68,0x52,0xD2,0xA4,0xB2,0xA4,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xB5,0xC5,0x89,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x1C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD2,0x9C,0x89,0x52,0xB9,0xDE,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x92,0x9C,0xDE,0xFF,0x9A,0xD6,0xF3,0x9C,0x54,0xAD,0xD6,0xC5,0x79,0xD6,0xDA,0xDE,0x3C,0xEF,0x9D,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xD6,0xAA,0x5A,0x17,0xCE,0xCA,0x6A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0xEA,0x6A,0xEA,0x6A,0x89,0x5A,
-    0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xEB,0x62,0x79,0xD6,0x9D,0xF7,0xEB,0x62,0x75,0xBD,0xCE,0x83,0x48,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x34,0xAD,0xDF,0xFF,0x5C,0xEF,0x89,0x52,0xB5,0xBD,0xCE,0x83,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x30,0x8C,0x38,0xD6,0x2C,0x73,0xBA,0xE6,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x34,0xAD,0xDE,0xFF,0x7D,0xF7,0xCE,0x83,0x54,0xAD,0x71,0x9C,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0xAA,0x62,0x58,0xD6,0xBD,0xFF,0xAA,0x5A,0x95,0xB5,0xEF,0x8B,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,
-    0x68,0x5A,0x68,0x52,0x89,0x5A,0x54,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xEF,0x8D,0x7B,0xEF,0x83,0xF6,0xC5,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x83,0x74,0xB5,0x2C,0x73,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x69,0x52,0xFB,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCA,0x5A,0x50,0x94,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x54,0xB5,0xDE,0xFF,0x55,0xB5,0x30,0x8C,0xAD,0x7B,0x48,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0x0A,0x6B,0xA9,0x62,0x48,0x52,0x48,0x5A,0x48,0x5A,
-    0x2C,0x6B,0x99,0xDE,0x89,0x5A,0xAD,0x83,0x68,0x5A,0x48,0x5A,0x68,0x5A,0xEA,0x6A,0x2F,0x94,0xCA,0x62,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x69,0x5A,0x50,0x94,0xFB,0xE6,0x8D,0x7B,0x78,0xD6,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xEB,0x62,0x9A,0xDE,0xDF,0xFF,0xDA,0xDE,0x2C,0x6B,0x30,0x8C,0x89,0x62,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xEF,0x83,0x9D,0xF7,0xAE,0x7B,0x54,0xB5,0xCA,0x62,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0xEB,0x6A,0xDA,0xE6,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x68,0x5A,0x54,0xB5,0xA9,0x62,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x3C,0xEF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB2,0x9C,0x89,0x52,0x99,0xDE,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0xD2,0xA4,0xDE,0xFF,0x95,0xBD,0x68,0x52,0x68,0x52,0x68,0x52,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x69,0x5A,0xEB,0x62,0x17,0xC6,0x95,0xB5,0xCA,0x5A,0x37,0xCE,0xAA,0x62,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x48,0x52,0xF3,0xA4,0xDE,0xFF,0xFB,0xE6,0x2C,0x6B,0x58,0xD6,0x6D,0x7B,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x89,0x5A,0x58,0xD6,
-    0xDF,0xFF,0xF7,0xC5,0x69,0x52,0xDA,0xE6,0x2B,0x73,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0xFB,0xEE,0xB6,0xBD,0xCE,0x83,0xD6,0xC5,0x69,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x69,0x5A,0x17,0xC6,0xDE,0xFF,0x5C,0xEF,0xEB,0x62,0x75,0xB5,0x6C,0x73,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xCE,0x83,0x1B,0xEF,0x50,0x8C,0x2C,0x6B,0x17,0xCE,0x0B,0x6B,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x69,0x5A,0x34,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x1B,0xE7,0xBE,0xFF,0xD6,0xC5,0x48,0x52,0x48,0x52,0x68,0x5A,0x89,0x5A,0xD2,0xA4,0x5C,0xEF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xEF,0x59,0xCE,0x54,0xAD,0x8D,0x7B,0x68,0x52,0x69,0x52,0xAA,0x5A,0x50,0x94,0xF7,0xC5,0x1C,0xE7,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0x8D,0x73,0x4C,0x73,
-    0xF2,0xAC,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x6D,0x73,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4C,0x6B,0xD2,0xA4,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x89,0x5A,0xDE,0xFF,0x17,0xCE,0x2C,0x6B,0x95,0xBD,0x68,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x88,0x5A,0x50,0x94,0x8D,0x7B,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x33,0xB5,0x89,0x5A,0xAD,0x83,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x89,0x5A,0xB1,0xA4,0x4C,0x73,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x8D,0x7B,0x7D,0xF7,0x2F,0x8C,0xF6,0xC5,0x68,0x52,
-    0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xA9,0x5A,0x79,0xD6,0xDF,0xFF,0xFB,0xE6,0xEB,0x62,0xB2,0xA4,0xAA,0x62,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0xAE,0x7B,0x9D,0xFF,0xAE,0x7B,0x71,0x94,0x8D,0x7B,0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x17,0xCE,0x6D,0x7B,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x6C,0x7B,0xAA,0x62,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0xFB,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x91,0x94,0x89,0x52,0x99,0xDE,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0xB1,0x9C,0x9D,0xFF,
-    0xF2,0xA4,0x68,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x48,0x52,0x0B,0x6B,0x78,0xD6,0xD2,0x9C,0x0B,0x6B,0x37,0xCE,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x69,0x5A,0x50,0x94,0x9D,0xF7,0xDF,0xFF,0xB6,0xBD,0x4C,0x6B,0xB6,0xC5,0xA9,0x62,0x48,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x89,0x5A,0x5C,0xEF,0xDE,0xFF,0x0F,0x84,0xEB,0x62,0x79,0xDE,0x68,0x5A,0x48,0x52,0x48,0x52,0x68,0x5A,0x48,0x5A,0x68,0x52,0x69,0x52,0xBE,0xFF,0xF3,0xA4,0xB2,0x9C,0xB2,0xA4,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,
-    0x68,0x52,0x0B,0x6B,0x79,0xD6,0xFF,0xFF,0x79,0xD6,0x8D,0x73,0x38,0xD6,0x0B,0x6B,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x91,0x9C,0x9D,0xF7,0xEB,0x62,0xEF,0x83,0x75,0xBD,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x69,0x5A,0x34,0xAD,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x17,0xC6,0x0B,0x63,0xFB,0xE6,0xAD,0x83,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x52,0x68,0x5A,0x89,0x52,0xD7,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x5C,0xEF,0x95,0xBD,0xEF,0x83,0x89,0x5A,0x68,0x52,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x52,0x68,0x52,0x68,0x52,0xAD,0x7B,0xD6,0xBD,0x9D,0xF7,0xDE,0xFF,0x38,0xCE,0xEB,0x62,0xF2,0xA4,0xCA,0x62,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x54,0xAD,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x83,0xD2,0xA4,0x68,0x5A,0x48,0x5A,
-    0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x69,0x52,0x5C,0xF7,0xDA,0xE6,0x8D,0x7B,0x38,0xD6,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xEE,0x8B,0x50,0x94,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0xEA,0x6A,0x89,0x5A,0xAD,0x83,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0xD2,0xA4,0x8D,0x7B,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x2C,0x73,0x9D,0xFF,0x91,0x94,0x70,0x94,0x2B,0x6B,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0x37,0xCE,0xFE,0xFF,0x1B,0xE7,0x0B,0x6B,0xF3,0xAC,0xCA,0x62,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x8D,0x7B,0x5C,0xF7,0xAE,0x7B,
-    0xCE,0x83,0x50,0x94,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xAE,0x83,0xBA,0xE6,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0xB9,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x91,0x94,0xEB,0x62,0x79,0xDE,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x48,0x52,0xEA,0x62,0x79,0xD6,0x30,0x94,0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x6D,0x7B,0xFB,0xE6,0x30,0x8C,0x6D,0x73,0xF7,0xC5,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,
-    0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xEA,0x62,0x13,0xAD,0x7D,0xEF,0xFF,0xFF,0xFE,0xFF,0x70,0x94,0x8D,0x73,0x74,0xB5,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x0B,0x6B,0xBE,0xFF,0xDE,0xFF,0xAE,0x7B,0xEF,0x8B,0x95,0xBD,0x68,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x0B,0x6B,0x9D,0xF7,0x8D,0x7B,0x75,0xB5,0xEF,0x8B,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x0F,0x8C,0x7D,0xF7,0xFF,0xFF,0x91,0x94,0x0F,0x8C,0x13,0xAD,0x89,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xA9,0x62,0x95,0xBD,0xBA,0xDE,0xAA,0x5A,0xD6,0xC5,0x70,0x9C,0x48,0x52,
-    0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x69,0x5A,0x34,0xAD,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x34,0xAD,0xCE,0x83,0x79,0xDE,0x69,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x79,0xD6,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x1B,0xE7,0xBE,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x1B,0xEF,0x0F,0x8C,0xAA,0x5A,0x68,0x52,0x68,0x52,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xCA,0x62,0x54,0xAD,0xBE,0xFF,0xDE,0xFF,0xEB,0x62,0x50,0x94,0xCE,0x83,0x68,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x0B,0x6B,0xBA,0xDE,0xFF,0xFF,0xFF,0xFF,0x51,0x94,0xB2,0x9C,0x69,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x54,0xB5,0x9D,0xF7,0x30,0x8C,0xD2,0xA4,0x0B,0x6B,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xCA,0x62,
-    0x95,0xBD,0xAA,0x62,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x89,0x62,0xAD,0x83,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x90,0x9C,0x6C,0x73,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x0B,0x6B,0x3B,0xEF,0x13,0xA5,0x4C,0x73,0x33,0xB5,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xB6,0xBD,0xFE,0xFF,0x5C,0xEF,0xEF,0x83,0x54,0xB5,0xCA,0x62,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x6C,0x7B,0x3B,0xEF,0xCE,0x83,0x6C,0x73,0xD1,0xA4,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x69,0x52,0x1B,0xEF,0x4C,0x7B,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,
-    0x68,0x52,0xB9,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x91,0x94,0x4C,0x73,0x78,0xD6,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x48,0x52,0x38,0xD6,0xAD,0x7B,0x68,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xAD,0x7B,0x3C,0xEF,0xCE,0x7B,0x0F,0x84,0xB5,0xBD,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x71,0x94,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0x6D,0x73,0x0F,0x8C,0x54,0xB5,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,
-    0x48,0x5A,0x48,0x5A,0xCE,0x83,0xDE,0xFF,0x7D,0xF7,0x8D,0x73,0xF6,0xC5,0xB2,0xA4,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0xD2,0xA4,0x7C,0xF7,0xEB,0x62,0x95,0xBD,0x4C,0x73,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xB2,0x9C,0xDF,0xFF,0xDF,0xFF,0x2C,0x6B,0xF2,0xA4,0xB1,0x9C,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x0B,0x6B,0xDA,0xDE,0xF3,0xA4,0x69,0x52,0xFA,0xE6,0xEB,0x6A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x69,0x5A,0x34,0xAD,0xFF,0xFF,0xFF,0xFF,0x3C,0xEF,0x4C,0x6B,0x95,0xBD,0xD2,0xA4,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,
-    0xCE,0x83,0x3C,0xEF,0xDF,0xFF,0xDF,0xFF,0x3C,0xEF,0x30,0x8C,0xCE,0x83,0x95,0xB5,0x7D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0x0B,0x6B,0x48,0x52,0x48,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,
-    0x89,0x5A,0x17,0xC6,0xDE,0xFF,0x75,0xB5,0xEF,0x83,0x50,0x94,0x68,0x5A,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0xB2,0x9C,0xDF,0xFF,0xDF,0xFF,0xD2,0x9C,0x50,0x94,0x89,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xEA,0x6A,0xA9,0x62,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x8D,0x7B,0xDE,0xFF,0xF3,0xA4,0x0B,0x6B,0xF6,0xC5,0x68,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x34,0xB5,0x0F,0x8C,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0xAD,0x83,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x4C,0x73,0x0F,0x8C,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xCA,0x62,
-    0x37,0xCE,0x95,0xB5,0xAA,0x5A,0x99,0xDE,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x13,0xAD,0xDE,0xFF,0x9D,0xFF,0xD2,0x9C,0x75,0xBD,0xCA,0x62,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x2C,0x73,0xB9,0xDE,0xB2,0x9C,0x0B,0x6B,0x13,0xAD,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x89,0x62,0x69,0x5A,0xEF,0x8B,0x54,0xB5,0x68,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x37,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x91,0x94,0x6C,0x73,0x58,0xD6,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,
-    0x68,0x5A,0x68,0x52,0x69,0x52,0x78,0xD6,0xCE,0x83,0x68,0x52,0x68,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0xCE,0x83,0x7C,0xF7,0x8D,0x73,0x71,0x94,0x33,0xAD,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xF3,0xAC,0x0F,0x8C,0xA9,0x62,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x91,0x9C,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xEA,0x62,0x34,0xAD,0xD2,0xA4,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x34,0xAD,0xDF,0xFF,0x99,0xDE,0x2C,0x6B,0x9D,0xFF,0x4C,0x73,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x58,0xCE,0xDA,0xDE,0x6D,0x73,0x74,0xB5,0xEA,0x6A,0x68,0x5A,
-    0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x74,0xB5,0xDE,0xFF,0xDA,0xDE,0xCA,0x5A,0xD6,0xC5,0xCE,0x83,0x48,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xAE,0x83,0xBD,0xFF,0x30,0x8C,0x0F,0x8C,0x78,0xDE,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0x34,0xAD,0xFF,0xFF,0xFF,0xFF,0x99,0xDE,0xEA,0x62,0xF6,0xC5,0xEB,0x6A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x69,0x5A,0x13,0xAD,0xDE,0xFF,0x30,0x8C,0xFB,0xE6,0xF7,0xC5,0xCA,0x62,0x48,0x52,0x68,0x5A,0xEA,0x62,0x13,0xAD,0x9D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0x6D,0x73,0x68,0x52,0x48,0x52,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x48,0x52,0x6D,0x7B,0x5C,0xEF,0xDA,0xDE,0x0C,0x6B,0xB2,0x9C,0xCA,0x62,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0xAA,0x62,0x18,0xCE,0xDE,0xFF,
-    0x13,0xA5,0xCE,0x83,0x89,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x70,0x9C,0x4C,0x73,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x0B,0x6B,0x5C,0xEF,0x38,0xCE,0xEA,0x62,0x1B,0xEF,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x2B,0x6B,0xB9,0xDE,0x89,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x0B,0x6B,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x89,0x5A,0x94,0xBD,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x54,0xB5,0x99,0xDE,0xEB,0x62,0x3C,0xF7,0x68,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x0F,0x8C,0xBE,0xFF,0xBE,0xFF,0x54,0xAD,0xD2,0xA4,0xEB,0x6A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,
-    0x48,0x52,0xEA,0x6A,0x17,0xCE,0xB6,0xBD,0xAA,0x5A,0x75,0xBD,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xCE,0x83,0xCA,0x62,0xAA,0x62,0xF7,0xCD,0xA9,0x62,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x17,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x71,0x94,0xCE,0x83,0x58,0xD6,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0x48,0x52,0xF6,0xC5,0xBA,0xDE,0xDA,0xE6,0x58,0xD6,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x0F,0x8C,0x9D,0xFF,0x4C,0x73,0x34,0xAD,0x91,0x9C,0x48,0x5A,0x48,0x5A,
-    0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xD2,0xA4,0x3B,0xEF,0x2F,0x94,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x30,0x8C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xEF,0xA9,0x5A,0x38,0xCE,0xCE,0x83,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xDA,0xE6,0xDE,0xFF,0x75,0xB5,0xCA,0x62,0x7D,0xF7,0x68,0x52,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x52,0x48,0x52,0x89,0x5A,0xDA,0xE6,0xD2,0x9C,0x2F,0x8C,0x74,0xB5,0x89,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x0B,0x6B,0x3C,0xEF,0xDF,0xFF,0x54,0xAD,0xEB,0x62,0xD6,0xC5,0xCA,0x62,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0xF3,0xAC,0x99,0xDE,0x2C,0x6B,
-    0xDA,0xE6,0x50,0x94,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x69,0x5A,0x34,0xAD,0xFF,0xFF,0xFF,0xFF,0x91,0x94,0x50,0x94,0xD6,0xC5,0xAA,0x62,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xEB,0x6A,0x38,0xCE,0xFB,0xE6,0x69,0x52,0x54,0xB5,0xB1,0x9C,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0x48,0x52,0xAA,0x5A,0x30,0x8C,0xDB,0xE6,0x7D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x95,0xB5,0x69,0x52,0x68,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x89,0x5A,0x48,0x52,0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x95,0xBD,0x7D,0xF7,0xEF,0x83,0xF3,0xA4,0x4C,0x73,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x30,0x8C,0x9D,0xFF,0x95,0xB5,0x6C,0x73,0xCA,0x62,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x70,0x9C,0x8D,0x7B,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xCA,0x62,0x17,0xC6,0x9D,0xF7,0x4C,0x6B,0x74,0xB5,0x0B,0x6B,0x68,0x5A,
-    0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xD6,0xC5,0xEE,0x8B,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0x17,0xCE,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0xB2,0x9C,0x5C,0xF7,0x0B,0x6B,0x78,0xD6,0x68,0x52,0x48,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x6C,0x73,0x9D,0xFF,0xDF,0xFF,0x95,0xB5,0xEF,0x83,0xAD,0x7B,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xA9,0x62,0x95,0xBD,0xBA,0xDE,0x89,0x5A,0xD6,0xC5,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x8D,0x83,0x2F,0x8C,0x89,0x5A,0x33,0xAD,0xEE,0x8B,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,
-    0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xF7,0xC5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x71,0x94,0x50,0x94,0x37,0xCE,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x89,0x5A,0x89,0x5A,0x89,0x5A,0x8D,0x7B,0x75,0xBD,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x0F,0x8C,0x9D,0xFF,0x4C,0x6B,0x17,0xCE,0xCE,0x83,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x99,0xDE,0xB1,0x9C,0x48,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x8D,0x7B,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xD6,0xA9,0x5A,0x78,0xD6,0xAA,0x5A,
-    0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0x9D,0xF7,0xDE,0xFF,0x13,0xA5,0x8D,0x7B,0xB9,0xDE,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x4C,0x73,0x3C,0xEF,0xAA,0x5A,0x71,0x94,0x91,0x9C,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x6D,0x73,0xDE,0xFF,0xDE,0xFF,0xAE,0x7B,0xEF,0x83,0xB6,0xBD,0x69,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x69,0x52,0xBA,0xE6,0xB6,0xC5,0x0B,0x6B,0x5C,0xF7,0x89,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x69,0x5A,0x54,0xB5,0xDF,0xFF,0x9E,0xF7,0xEB,0x62,0xF3,0xA4,0x50,0x94,0x68,0x5A,0x48,0x5A,0x48,0x5A,
-    0x48,0x5A,0x48,0x5A,0x48,0x52,0xCE,0x83,0x7D,0xFF,0x91,0x94,0xCA,0x5A,0xBA,0xDE,0x2C,0x73,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xA9,0x5A,0x70,0x94,0x58,0xD6,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xEF,0x83,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x2C,0x73,0x95,0xBD,0x17,0xCE,0x91,0x9C,0x68,0x52,
-    0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0xCA,0x62,0x9E,0xFF,0x75,0xB5,0x8D,0x7B,0xF2,0xA4,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x89,0x5A,0xB6,0xBD,0x38,0xCE,0xEB,0x6A,0xEA,0x6A,0x48,0x52,0x68,0x5A,0x48,0x5A,0x2B,0x73,0x91,0x9C,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x89,0x5A,0xD3,0xA4,0xDE,0xFF,0xCE,0x7B,0x4C,0x6B,0xB1,0x9C,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x2C,0x73,0xF7,0xCD,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0xCA,0x62,0x95,0xBD,0x89,0x5A,0x48,0x52,
-    0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x50,0x94,0x9D,0xFF,0x6C,0x73,0x30,0x94,0x2C,0x73,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xCA,0x62,0x7D,0xF7,0xDE,0xFF,0x95,0xB5,0x6D,0x73,0x91,0x9C,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0x74,0xB5,0x3C,0xEF,0x89,0x5A,0xD6,0xC5,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x2B,0x73,0x99,0xDE,0x69,0x52,0x0F,0x8C,0xF3,0xAC,0x69,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xB5,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x71,0x94,0x50,0x8C,0x37,0xCE,
-    0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x33,0xAD,0x38,0xCE,0x33,0xAD,0xCE,0x83,0x75,0xB5,0x69,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x2F,0x8C,0x9D,0xFF,0x4C,0x73,0xDA,0xE6,0x6D,0x7B,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0xF7,0xCD,0xF2,0xA4,0x68,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x0B,0x6B,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x75,0xB5,0xCA,0x62,0x99,0xDE,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xEB,0x6A,0xDE,0xFF,0xBE,0xFF,0xB2,0x9C,0x54,0xB5,0x95,0xBD,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x71,0x9C,0x3C,0xEF,0xAA,0x5A,
-    0x54,0xB5,0xEF,0x8B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x71,0x94,0xDE,0xFF,0x3C,0xEF,0xEB,0x62,0x95,0xB5,0x71,0x94,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x0B,0x6B,0x9D,0xFF,0xB2,0x9C,0x71,0x9C,0x58,0xD6,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x69,0x5A,0x54,0xB5,0xDF,0xFF,0xD6,0xBD,0x0B,0x6B,0x38,0xCE,0x8D,0x7B,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x54,0xB5,0x3C,0xEF,0x6D,0x73,0xD2,0x9C,0xB6,0xBD,0x68,0x5A,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x0B,0x6B,0x30,0x8C,
-    0x3C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xE7,0x6D,0x73,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0xA9,0x62,0x12,0xAD,0x30,0x94,0x50,0x94,0xDA,0xE6,0x50,0x94,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x69,0x5A,0x79,0xD6,0x79,0xDE,0x4C,0x73,0x58,0xD6,0x68,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0xCA,0x62,0x2C,0x73,0x68,0x5A,
-    0x48,0x5A,0x48,0x5A,0x48,0x5A,0xEB,0x6A,0xBA,0xE6,0x0B,0x6B,0x2C,0x73,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xF6,0xCD,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x2F,0x8C,0x7D,0xF7,0x75,0xB5,0xEA,0x62,0x95,0xBD,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xB6,0xC5,0x4C,0x73,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x62,0xEA,0x62,0xAE,0x83,0xEF,0x8B,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0xCE,0x83,0x5C,0xEF,0xCE,0x83,0x2C,0x73,0x91,0x9C,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x3C,0xEF,0xDF,0xFF,0xF6,0xBD,0x4C,0x73,0x13,0xAD,
-    0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x69,0x5A,0x33,0xAD,0x9D,0xF7,0x89,0x52,0x54,0xB5,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xCA,0x62,0x1B,0xEF,0x4C,0x6B,0x2C,0x6B,0x34,0xB5,0xEA,0x6A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x95,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x71,0x94,0xB2,0x9C,0x17,0xCE,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x99,0xD6,0xFE,0xFF,0x79,0xD6,0x30,0x8C,0x34,0xB5,0x89,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x2F,0x8C,0x1B,0xEF,0x4C,0x6B,
-    0x3B,0xEF,0xEB,0x6A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xA9,0x62,0x48,0x52,0x34,0xB5,0x34,0xAD,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x69,0x5A,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x91,0x94,0x6C,0x73,0x78,0xD6,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0xCE,0x83,0xDE,0xFF,0x3C,0xEF,0xCF,0x83,0x58,0xD6,0x0C,0x6B,0x68,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x54,0xB5,0x18,0xCE,0xCA,0x62,0x79,0xD6,0x2C,0x6B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0xBA,0xDE,0xFE,0xFF,0x38,0xCE,0xCA,0x5A,0xFB,0xE6,0x2C,0x6B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,
-    0xB2,0x9C,0x3C,0xEF,0x8E,0x7B,0xB6,0xBD,0x8D,0x7B,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x55,0xB5,0xDE,0xFF,0x6D,0x73,0x8D,0x7B,0x95,0xBD,0x89,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x5C,0xF7,0x75,0xB5,0xAA,0x62,0x9D,0xFF,0x8D,0x7B,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x2C,0x6B,0x17,0xCE,0xDE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,
-    0x7D,0xEF,0x5C,0xEF,0x5D,0xEF,0x9D,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x79,0xD6,0x0B,0x6B,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0x68,0x5A,0x48,0x52,0xEB,0x62,0xB6,0xC5,0xAA,0x62,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0xAE,0x83,0x7D,0xFF,0x30,0x8C,0x71,0x94,0xEE,0x83,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0xF2,0xAC,0xA9,0x62,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x2F,0x8C,0xAE,0x83,0xCE,0x83,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x33,0xB5,0xEA,0x6A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x4C,0x73,0xBA,0xDE,
-    0x5C,0xF7,0xAA,0x5A,0xD2,0xA4,0xCA,0x62,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0xAD,0x7B,0x34,0xB5,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x62,0x2C,0x6B,0xEA,0x62,0xD6,0xC5,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x4C,0x73,0x99,0xDE,0xB2,0x9C,0xAA,0x62,0x34,0xB5,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0x48,0x52,0xBA,0xDE,0xFF,0xFF,0x9A,0xD6,0x8D,0x73,0xB6,0xC5,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x13,0xA5,0xBE,0xFF,0x89,0x52,0xD2,0xA4,0xEA,0x62,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xAA,0x62,0x1B,0xE7,0xBA,0xDE,0x89,0x5A,0x54,0xB5,
-    0x8D,0x7B,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x54,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x70,0x8C,0x34,0xAD,0x75,0xBD,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x69,0x5A,0xBA,0xDE,0xDE,0xFF,0x79,0xD6,0x71,0x94,0xF3,0xAC,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x68,0x5A,0xB2,0x9C,0x58,0xCE,0x0B,0x6B,0x5C,0xF7,0xAA,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xCE,0x83,0x89,0x5A,0x70,0x94,0x75,0xB5,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x48,0x52,0xBE,0xFF,0xFF,0xFF,0xDF,0xFF,
-    0x0F,0x84,0xB2,0x9C,0x95,0xBD,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x48,0x52,0xB5,0xBD,0xFF,0xFF,0x9A,0xD6,0x0C,0x6B,0x79,0xD6,0x69,0x5A,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xA9,0x5A,0xF6,0xC5,0x2F,0x8C,0xEA,0x62,0xF6,0xC5,0x68,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x9D,0xF7,0xDE,0xFF,0x71,0x94,0x8D,0x7B,0xFB,0xE6,0x69,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x7D,0xF7,0x99,0xD6,0x4C,0x6B,0x58,0xD6,0xCA,0x62,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xCA,0x62,0xB6,0xBD,0xFB,0xE6,0xAA,0x5A,0xB6,0xBD,0xD2,0xA4,
-    0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x30,0x8C,0x9D,0xFF,0x71,0x94,0xEF,0x83,0xDA,0xE6,0x68,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0xCA,0x62,0xD6,0xBD,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xFB,0xE6,0xD6,0xBD,0xF2,0xA4,0xCE,0x83,0x2B,0x6B,0x4C,0x73,0x2F,0x8C,0x75,0xB5,0x38,0xCE,0xDE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xF7,0xC5,0xCA,0x62,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xCE,0x83,
-    0xF3,0xA4,0x50,0x8C,0x89,0x5A,0x2F,0x8C,0xEE,0x8B,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x0B,0x6B,0xFB,0xE6,0x75,0xB5,0xCA,0x62,0xDA,0xE6,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xEE,0x8B,0xD2,0xA4,0x68,0x5A,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xEE,0x83,0x0F,0x94,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xEB,0x6A,0x95,0xBD,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0xA9,0x5A,0xD6,0xC5,0xDE,0xFF,0xCA,0x5A,0xEF,0x8B,0xCE,0x83,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0xEB,0x6A,0x34,0xB5,0x0B,0x6B,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x62,
-    0x0F,0x8C,0x0B,0x6B,0xDA,0xE6,0x68,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xCA,0x62,0x17,0xCE,0x58,0xD6,0xAA,0x62,0x95,0xBD,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0xD6,0xC5,0xFF,0xFF,0x3C,0xEF,0xCE,0x7B,0x38,0xCE,0x68,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0xF3,0xA4,0xBE,0xFF,0x89,0x52,0x71,0x9C,0x2B,0x73,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x89,0x5A,0xFB,0xE6,0x9D,0xF7,0x0B,0x6B,0x50,0x94,0xD2,0xA4,0x68,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x13,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0x70,0x8C,0x34,0xAD,0x74,0xB5,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xAA,0x5A,0xBA,0xDE,0xFF,0xFF,0x58,0xD6,0x91,0x9C,0xB1,0x9C,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0x54,0xB5,0x95,0xBD,0x0B,0x6B,0x3C,0xEF,0x89,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0xD2,0xA4,0x89,0x5A,0xEE,0x83,0x95,0xBD,0x69,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x69,0x52,0x7D,0xF7,0xFF,0xFF,0x9E,0xF7,0xAE,0x7B,0xF7,0xC5,0x0F,0x8C,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x99,0xD6,0xFE,0xFF,0x58,0xCE,0x6D,0x73,0x58,0xD6,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,
-    0x4C,0x73,0x99,0xD6,0x8D,0x73,0x2F,0x8C,0x74,0xB5,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xAE,0x7B,0xDE,0xFF,0x9D,0xF7,0xEF,0x83,0x33,0xAD,0x13,0xAD,0x68,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xEA,0x62,0xBE,0xFF,0x54,0xAD,0x0F,0x8C,0x54,0xB5,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xAA,0x62,0xB6,0xBD,0x14,0xAD,0xCA,0x5A,0xBA,0xDE,0x0B,0x6B,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x69,0x5A,0xDA,0xE6,0xBA,0xDE,0x2C,0x6B,0x58,0xD6,0x2F,0x8C,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x68,0x5A,
-    0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0xCA,0x62,0x38,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x3C,0xEF,0xB2,0x9C,0x8D,0x7B,0x89,0x5A,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0xEA,0x62,0xF3,0xA4,0x3C,0xEF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xF7,0xC5,0x0B,0x6B,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x69,0x5A,0xB2,0xA4,0xDE,0xFF,0x9D,0xF7,0xB1,0x9C,0x6D,0x73,0x90,0x9C,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x89,0x5A,0x33,0xAD,0x1B,0xEF,0x0B,0x6B,0x13,0xAD,0x6D,0x7B,0x48,0x52,0x48,0x5A,0x68,0x5A,
-    0x48,0x5A,0x68,0x5A,0x89,0x5A,0x98,0xDE,0x0B,0x6B,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xAD,0x83,0xEF,0x8B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0xB9,0xE6,0x68,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x13,0xAD,0xBE,0xFF,0xD2,0xA4,0xCE,0x83,0x30,0x94,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xB1,0x9C,0x0F,0x8C,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0xF2,0xA4,0x8D,0x7B,0x58,0xD6,0x89,0x5A,0x68,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x89,0x5A,0x95,0xBD,0x5D,0xF7,0xA9,0x5A,0xF3,0xAC,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0xD2,0xA4,
-    0xFF,0xFF,0x9D,0xF7,0x0F,0x84,0xF7,0xC5,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x92,0x9C,0x9D,0xF7,0xAA,0x5A,0x30,0x94,0x8D,0x7B,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0xDA,0xDE,0xBE,0xFF,0xF3,0xA4,0x0B,0x6B,0x38,0xCE,0x89,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x13,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x8C,0xB6,0xBD,0x13,0xAD,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xCA,0x62,0xDB,0xDE,0xDE,0xFF,0xF7,0xC5,0xB2,0x9C,0x50,0x94,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,
-    0xA9,0x5A,0x17,0xCE,0x33,0xAD,0x0B,0x6B,0xFB,0xE6,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x54,0xB5,0xA9,0x5A,0xAE,0x7B,0xB6,0xC5,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x69,0x52,0x3C,0xEF,0xFF,0xFF,0x1C,0xE7,0x8D,0x73,0xDA,0xE6,0x0B,0x6B,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x69,0x52,0xDA,0xE6,0xDE,0xFF,0xD6,0xBD,0x71,0x94,0x95,0xBD,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0xEF,0x83,0xDA,0xDE,0x0B,0x6B,0x99,0xDE,0x0F,0x8C,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0xB5,0xBD,0xDE,0xFF,0xBA,0xDE,0x6D,0x73,0xBA,0xE6,0x6D,0x7B,0x48,0x5A,0x48,0x5A,0x48,0x5A,
-    0x48,0x5A,0x48,0x5A,0x48,0x52,0x13,0xAD,0xDE,0xFF,0xAE,0x7B,0x13,0xA5,0x50,0x94,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0xEA,0x62,0x96,0xBD,0xCE,0x83,0x92,0x9C,0xF7,0xCD,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x6C,0x73,0xDE,0xFF,0x95,0xB5,0xAE,0x7B,0x99,0xDE,0x68,0x5A,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xEA,0x6A,0x0F,0x8C,0x89,0x5A,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x0B,0x6B,0x7D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x38,0xCE,0x6D,0x73,
-    0x68,0x5A,0x48,0x52,0x68,0x5A,0x68,0x5A,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x68,0x52,0x89,0x5A,0x0F,0x8C,0x3C,0xEF,0xFF,0xFF,0x3C,0xEF,0xB5,0xBD,0x6C,0x73,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0xAE,0x7B,0x3C,0xEF,0xFF,0xFF,0x3C,0xEF,0x0B,0x6B,0xD2,0xA4,0x4C,0x73,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x0F,0x8C,0x7C,0xF7,0xEF,0x83,0xEA,0x62,0x54,0xB5,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0xAD,0x7B,0xF7,0xC5,0x68,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xCA,0x62,0xEB,0x6A,0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xB1,0xA4,0x8D,0x7B,0x48,0x5A,0x48,0x5A,
-    0x48,0x5A,0x48,0x5A,0x68,0x5A,0xCE,0x83,0x7D,0xF7,0x1B,0xE7,0x4C,0x73,0x2F,0x94,0x89,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x4C,0x7B,0x8D,0x7B,0x13,0xAD,0xAA,0x62,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x89,0x5A,0x54,0xB5,0xAE,0x7B,0x70,0x94,0xAD,0x7B,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x68,0x52,0x33,0xAD,0xBE,0xFF,0x89,0x5A,0x30,0x8C,0x0B,0x6B,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x48,0x5A,0x6D,0x7B,0xFF,0xFF,0xDE,0xFF,0x30,0x8C,0x13,0xAD,0x0B,0x6B,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xEF,0x8B,0x5C,0xEF,0x8D,0x7B,0xEE,0x83,0xCE,0x83,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,
-    0xBA,0xDE,0xFF,0xFF,0x17,0xCE,0x89,0x5A,0xB6,0xBD,0x8D,0x7B,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xD2,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x8C,0x38,0xCE,0xD2,0xA4,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x0B,0x6B,0xFB,0xE6,0xDE,0xFF,0x14,0xAD,0xD2,0xA4,0x2F,0x8C,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xAA,0x62,0x78,0xD6,0xF2,0xA4,0x4C,0x73,0x79,0xD6,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0xB5,0xBD,0xCA,0x62,0x8D,0x7B,0xD6,0xC5,0x89,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,
-    0x48,0x52,0xFB,0xE6,0xDF,0xFF,0x59,0xCE,0x4C,0x6B,0x3C,0xEF,0x89,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x2C,0x6B,0x1B,0xE7,0xDE,0xFF,0xD2,0x9C,0x13,0xA5,0xEE,0x83,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x71,0x94,0xD6,0xBD,0xCA,0x5A,0x7C,0xF7,0x89,0x5A,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x69,0x5A,0x1B,0xEF,0xDF,0xFF,0xB6,0xBD,0x4C,0x6B,0xDA,0xE6,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x69,0x5A,0x78,0xD6,0x3C,0xEF,0xEA,0x62,0x95,0xBD,0xAD,0x7B,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0xEB,0x6A,0x91,0x9C,
-    0x0B,0x6B,0xDA,0xE6,0x8D,0x7B,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xF6,0xC5,0xBD,0xFF,0x8E,0x7B,0xF3,0xA4,0x71,0x94,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0xEA,0x6A,0xD6,0xC5,0xBA,0xE6,0xAD,0x7B,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0xD2,0xA4,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x17,0xC6,0xCA,0x62,0x69,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x68,0x52,0x91,0x94,0xBE,0xFF,0x1B,0xE7,0x13,0xA5,0xAD,0x7B,0x68,0x5A,0x48,0x5A,0x48,0x5A,
-    0x68,0x5A,0x68,0x5A,0x68,0x5A,0x69,0x52,0x95,0xB5,0xDE,0xFF,0xBE,0xFF,0xB2,0x9C,0x91,0x9C,0xCE,0x83,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xEB,0x6A,0x58,0xD6,0xDA,0xE6,0xA9,0x5A,0x13,0xAD,0xAA,0x62,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xD6,0xC5,0xCE,0x83,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x88,0x5A,0x0B,0x6B,0x13,0xAD,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xAA,0x62,0xFB,0xE6,0x7D,0xF7,0xEB,0x62,0x71,0x9C,0xEA,0x6A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x0F,0x8C,0xA9,0x62,0x75,0xB5,0x0B,0x6B,0x48,0x5A,0x48,0x5A,
-    0x48,0x5A,0x68,0x5A,0x68,0x5A,0x69,0x5A,0x34,0xAD,0xEF,0x83,0x6C,0x73,0xB1,0xA4,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x91,0x9C,0x9D,0xFF,0xA9,0x5A,0xEF,0x8B,0xAD,0x83,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0xCA,0x62,0xDE,0xFF,0xDE,0xFF,0x30,0x8C,0x71,0x9C,0xAD,0x83,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0xEF,0x83,0x3C,0xEF,0xB2,0x9C,0x8D,0x7B,0xEF,0x8B,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x99,0xD6,0xDF,0xFF,0x3C,0xEF,0xCE,0x83,0xEF,0x8B,0x57,0xD6,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xD2,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x8C,0x17,0xC6,0x95,0xBD,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x79,0xD6,0xDE,0xFF,0x91,0x9C,0xB2,0xA4,0xCE,0x83,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xAA,0x62,0xB9,0xDE,0x91,0x9C,0xEF,0x83,0xD6,0xC5,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0xD6,0xC5,0xCA,0x62,0x6C,0x73,0x17,0xCE,0xAA,0x62,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xBA,0xDE,0xDE,0xFF,0x96,0xB5,0x6D,0x73,0xFA,0xE6,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x92,0x9C,0x9D,0xF7,0xBE,0xFF,0xAE,0x7B,0x54,0xAD,0x8D,0x7B,0x48,0x5A,0x48,0x5A,
-    0x48,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x34,0xAD,0xF3,0xA4,0x4C,0x6B,0x3B,0xEF,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x2C,0x6B,0x9E,0xFF,0xDE,0xFF,0x54,0xAD,0x50,0x94,0x74,0xB5,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x0B,0x6B,0xDA,0xE6,0xB6,0xBD,0x4C,0x73,0x95,0xBD,0xCA,0x62,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x89,0x62,0xEB,0x6A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0xEA,0x6A,0xAE,0x83,0x8D,0x7B,0x1B,0xEF,0x89,0x5A,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0xCA,0x62,0xFA,0xE6,0xBA,0xDE,0x0B,0x6B,0xF7,0xC5,0x8D,0x7B,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,
-    0x68,0x5A,0x89,0x5A,0x68,0x52,0x14,0xAD,0xDA,0xE6,0x6D,0x7B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x4C,0x73,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9A,0xDE,0xEA,0x62,0x68,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xB6,0xBD,0x7D,0xF7,0xB2,0x9C,0xD2,0xA4,0x89,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x50,0x8C,0x7D,0xF7,0xDF,0xFF,0x58,0xCE,0x2C,0x6B,0x74,0xB5,0x68,0x5A,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x69,0x5A,0x13,0xAD,0xBD,0xFF,0x0B,0x6B,
-    0x0F,0x8C,0x0F,0x8C,0x68,0x52,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x6C,0x73,0x75,0xBD,0xA9,0x62,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x0B,0x6B,0x89,0x5A,0x95,0xBD,0x89,0x5A,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x58,0xD6,0xBE,0xFF,0x50,0x94,0x91,0x9C,0x4C,0x73,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x0B,0x6B,0xAD,0x7B,0x50,0x94,0xB1,0x9C,0x68,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x69,0x5A,0x34,0xAD,0xD6,0xC5,0xCA,0x62,0x94,0xBD,0x68,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x8D,0x7B,0x5C,0xF7,0x91,0x94,0xCE,0x83,0x0F,0x8C,0x48,0x5A,0x48,0x5A,
-    0x68,0x5A,0x68,0x5A,0x48,0x5A,0x69,0x5A,0x5C,0xEF,0xDE,0xFF,0xB2,0x9C,0xEF,0x8B,0x6C,0x7B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x10,0x8C,0x5C,0xEF,0xB6,0xBD,0x4D,0x73,0x70,0x9C,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x58,0xD6,0xDF,0xFF,0xBE,0xFF,0xD2,0x9C,0x89,0x5A,0x3B,0xEF,0xCA,0x62,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xB2,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x8C,0xD2,0x9C,0x78,0xD6,0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x50,0x94,0x3B,0xEF,0x0F,0x8C,0xAD,0x7B,0xEA,0x6A,0x48,0x5A,
-    0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xCA,0x62,0x1B,0xEF,0xB1,0x9C,0xF2,0xA4,0x33,0xAD,0x68,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x89,0x5A,0x37,0xCE,0x2C,0x6B,0x4C,0x73,0x17,0xCE,0xEA,0x62,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0x59,0xD6,0xDE,0xFF,0x34,0xAD,0x10,0x8C,0xD6,0xC5,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x34,0xAD,0xDE,0xFF,0x7D,0xF7,0x4C,0x6B,0x95,0xBD,0x6C,0x73,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0xCA,0x62,0x37,0xCE,0x50,0x94,0x13,0xAD,0x95,0xBD,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x92,0x9C,0xBE,0xFF,0x5C,0xEF,0xEF,0x83,0xD6,0xBD,0xEF,0x8B,
-    0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xB1,0x9C,0x9D,0xFF,0x0B,0x6B,0x50,0x94,0x33,0xAD,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x13,0xAD,0x0B,0x6B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xA9,0x62,0x2C,0x73,0x54,0xB5,0xD2,0xA4,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0xF2,0xA4,0x9D,0xF7,0x30,0x8C,0xCF,0x83,0x95,0xBD,0xCA,0x62,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0xAE,0x83,0xB1,0x9C,0xAA,0x5A,0xAA,0x62,0xFA,0xE6,0x91,0x9C,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x4C,0x73,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,
-    0x6D,0x73,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x68,0x5A,0x48,0x52,0x48,0x52,0x68,0x5A,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xCA,0x62,0x3C,0xEF,0xF3,0xA4,0xF2,0xA4,0x4C,0x73,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x89,0x5A,0xB9,0xDE,0xDE,0xFF,0x3C,0xEF,0xEF,0x83,0x33,0xAD,0x6C,0x7B,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x8D,0x7B,0x5C,0xEF,0xD6,0xBD,0x6D,0x73,0x50,0x94,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0xA9,0x62,0x13,0xAD,0xCE,0x83,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xEB,0x6A,
-    0x69,0x5A,0x50,0x94,0x6C,0x7B,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x71,0x94,0xDE,0xFF,0x95,0xB5,0x2F,0x8C,0xCE,0x83,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x2B,0x73,0x33,0xAD,0xAA,0x5A,0x58,0xD6,0xAA,0x62,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xF3,0xA4,0x5C,0xEF,0x69,0x52,0x74,0xB5,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xCA,0x62,0x1B,0xEF,0x58,0xD6,0xCE,0x83,0x70,0x9C,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0xD2,0xA4,0xDE,0xFF,0xD6,0xC5,0x6D,0x7B,0x89,0x62,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xD2,0xA4,0xBE,0xFF,0x38,0xCE,0x2C,0x6B,0xD2,0xA4,0x48,0x52,
-    0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x17,0xCE,0xDE,0xFF,0xFF,0xFF,0x17,0xC6,0xEB,0x62,0x34,0xB5,0xF3,0xAC,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x91,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x8C,0x2C,0x6B,0xFB,0xE6,0xAA,0x62,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x68,0x5A,0xEE,0x83,0xEB,0x6A,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xCA,0x62,0x5C,0xF7,0xB1,0x9C,0xB6,0xBD,0x2F,0x8C,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x0B,0x6B,0x99,0xDE,0xAD,0x7B,0x2C,0x6B,0x38,0xCE,0x2B,0x6B,
-    0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x17,0xCE,0xDE,0xFF,0x13,0xA5,0x13,0xAD,0x91,0x9C,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0x55,0xB5,0xDE,0xFF,0xDB,0xE6,0x6D,0x73,0x75,0xB5,0xEB,0x6A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x2B,0x6B,0xBA,0xDE,0xAE,0x7B,0x99,0xDE,0x0B,0x6B,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0xF7,0xC5,0xDF,0xFF,0xFB,0xE6,0xEB,0x62,0xB6,0xBD,0xEB,0x6A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x68,0x5A,0x34,0xAD,0x3C,0xEF,0x89,0x5A,0xB5,0xBD,0xEE,0x83,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x69,0x52,0x5C,0xF7,0xEB,0x6A,0x68,0x5A,
-    0x48,0x5A,0x48,0x5A,0x48,0x5A,0xCA,0x62,0x17,0xCE,0x0B,0x6B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0xAA,0x62,0xD6,0xC5,0x5C,0xEF,0x8A,0x5A,0x34,0xAD,0xB1,0x9C,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x89,0x5A,0x34,0xAD,0x7D,0xF7,0x2C,0x73,0x89,0x5A,0xD6,0xBD,0xD2,0x9C,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x2C,0x73,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x58,0xCE,0x68,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x69,0x5A,0xCE,0x83,0x78,0xD6,0x58,0xD6,0x0F,0x8C,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x91,0x9C,0x75,0xB5,
-    0x2C,0x6B,0x17,0xCE,0x68,0x5A,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x91,0x9C,0xDE,0xFF,0xDF,0xFF,0x34,0xAD,0x0B,0x6B,0x37,0xCE,0x68,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x69,0x5A,0x99,0xDE,0x5C,0xEF,0xEA,0x62,0x91,0x9C,0x0B,0x6B,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x8D,0x7B,0x33,0xB5,0x89,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0xA9,0x62,0x0F,0x8C,0x8D,0x7B,0x70,0x9C,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x8A,0x5A,0xDE,0xFF,0x38,0xCE,0x8D,0x7B,0x70,0x94,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xCA,0x62,0x74,0xB5,
-    0x6D,0x73,0x13,0xAD,0x2F,0x8C,0x48,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x13,0xAD,0xBE,0xFF,0x69,0x52,0xB1,0x9C,0x0B,0x6B,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x69,0x5A,0xDA,0xDE,0x5C,0xEF,0x4C,0x73,0xB1,0x9C,0xAA,0x62,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xAA,0x62,0xCE,0x83,0xAD,0x83,0x69,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x34,0xAD,0xBE,0xFF,0xBA,0xDE,0x2C,0x73,0xB2,0xA4,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x75,0xB5,0xFF,0xFF,0xFF,0xFF,0x7D,0xF7,0x6D,0x73,0xCA,0x62,0x58,0xD6,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x71,0x94,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x71,0x94,0x69,0x52,0x3C,0xEF,0x71,0x9C,0x48,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0xEA,0x62,0x7D,0xF7,0x91,0x94,0x38,0xD6,0x4C,0x73,0x68,0x52,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x8D,0x7B,0xFB,0xE6,0xEE,0x83,0x2B,0x6B,0x58,0xD6,0x4C,0x73,0x68,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0xB6,0xBD,0x9D,0xFF,0x91,0x94,0xD6,0xBD,0xEF,0x83,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xCA,0x62,0xF7,0xC5,0xDF,0xFF,0xD6,0xC5,0xAE,0x83,
-    0x13,0xAD,0x69,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x8D,0x7B,0x38,0xD6,0x4C,0x73,0xDA,0xE6,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xCA,0x62,0x99,0xD6,0xDF,0xFF,0x38,0xCE,0xEF,0x83,0xB6,0xC5,0xAA,0x62,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x0B,0x6B,0x99,0xDE,0xF3,0xA4,0xCA,0x5A,0x99,0xDE,0xCA,0x62,0x68,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xCA,0x62,0x7C,0xF7,0x69,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x0F,0x8C,0xB6,0xBD,0x69,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xCE,0x83,0x3C,0xEF,0xD2,0x9C,0xCB,0x62,0x38,0xCE,0x0B,0x6B,0x68,0x5A,0x48,0x5A,0x68,0x5A,
-    0x68,0x5A,0x48,0x5A,0x48,0x52,0x0B,0x6B,0x3C,0xEF,0xDE,0xFF,0xAD,0x7B,0x89,0x5A,0x38,0xCE,0x50,0x94,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x4C,0x73,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x0F,0x8C,0x68,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xCE,0x83,0x38,0xCE,0x91,0x94,0x54,0xB5,0xBA,0xDE,0xEE,0x8B,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x8D,0x7B,0x9A,0xDE,0x6D,0x73,0xB6,0xBD,0x2C,0x73,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0xAA,0x5A,0x9D,0xF7,0xDE,0xFF,0xDB,0xE6,0x2C,0x6B,0x58,0xD6,0xCA,0x62,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,
-    0x68,0x5A,0x68,0x52,0x51,0x94,0xBE,0xFF,0xB2,0x9C,0x91,0x9C,0x6D,0x7B,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x95,0xBD,0x8D,0x7B,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x99,0xDE,0x2C,0x6B,0x91,0x9C,0x89,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x69,0x52,0x7D,0xF7,0xFB,0xE6,0xAE,0x7B,0x95,0xBD,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x89,0x5A,0xD2,0xA4,0x30,0x94,0xCA,0x62,0x99,0xDE,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0xF3,0xA4,0xBE,0xFF,0xEB,0x62,0x0F,0x8C,0xAD,0x83,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0x78,0xD6,0x7D,0xF7,
-    0xCA,0x62,0x33,0xAD,0x4C,0x73,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x0B,0x6B,0x58,0xCE,0xFF,0xFF,0x3C,0xEF,0x2C,0x6B,0x91,0x9C,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xB2,0x9C,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xB2,0x9C,0x69,0x52,0xF6,0xC5,0x4C,0x73,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x71,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x14,0xA5,0x89,0x52,0xD2,0xA4,0x38,0xD6,0xEB,0x6A,0x68,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,
-    0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x0B,0x6B,0x5C,0xEF,0xEF,0x83,0x79,0xD6,0xEA,0x62,0x68,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0xEF,0x83,0x5C,0xEF,0xD2,0xA4,0xEB,0x62,0x58,0xD6,0x8D,0x7B,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x54,0xB5,0xFB,0xE6,0x8D,0x73,0xF7,0xC5,0xEF,0x8B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x2C,0x73,0xBA,0xDE,0xDE,0xFF,0x10,0x8C,0x2F,0x8C,0xD2,0xA4,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x69,0x5A,0x91,0x9C,0xB6,0xBD,0xCE,0x83,0x58,0xD6,0x68,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0xCE,0x83,0x3C,0xEF,0xDF,0xFF,
-    0x10,0x8C,0x91,0x9C,0x71,0x9C,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0xAE,0x83,0x9D,0xF7,0xAE,0x7B,0xEF,0x83,0x95,0xBD,0x48,0x52,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x0B,0x6B,0x7C,0xF7,0x69,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xF3,0xAC,0x0F,0x8C,0x68,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x91,0x9C,0xBD,0xFF,0x4C,0x6B,0x51,0x94,0xB6,0xC5,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x30,0x8C,0xDE,0xFF,0xDE,0xFF,0x6D,0x73,0xCA,0x62,0x1B,0xEF,0xCE,0x83,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x4C,0x73,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x8D,0x7B,0x68,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0xCA,0x62,0x89,0x5A,0x69,0x5A,0x69,0x52,0xAE,0x83,0xF3,0xAC,0xAA,0x62,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x89,0x5A,0x54,0xB5,0xB1,0x9C,0xEB,0x6A,0xB5,0xBD,0x68,0x5A,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x54,0xB5,0xDE,0xFF,0xDE,0xFF,0x30,0x8C,0x4C,0x73,0x13,0xAD,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x89,0x5A,0x9D,0xFF,0xF7,0xC5,0x8D,0x7B,0xB1,0x9C,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x4C,0x73,0xD6,0xC5,0x89,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,
-    0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x5C,0xF7,0x2C,0x6B,0x50,0x94,0x0B,0x6B,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xD3,0xA4,0x9D,0xF7,0x50,0x8C,0x34,0xAD,0xCA,0x62,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x71,0x9C,0x17,0xCE,0xAA,0x5A,0x74,0xB5,0xAD,0x7B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xF3,0xA4,0xBE,0xFF,0x34,0xAD,0x6D,0x7B,0x50,0x94,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x54,0xB5,0x9D,0xF7,0x6D,0x73,0x91,0x9C,0xF3,0xAC,0x89,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x70,0x94,0xBE,0xFF,0xFF,0xFF,
-    0x9D,0xF7,0x0B,0x6B,0x70,0x94,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xEF,0x83,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0xDE,0x89,0x5A,0x0F,0x8C,0xD2,0xA4,0x68,0x5A,0x68,0x52,0x48,0x5A,0x68,0x52,0x68,0x52,0x30,0x8C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xE7,0xCA,0x62,0xEB,0x62,0x99,0xDE,0x74,0xB5,0xAA,0x62,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x2B,0x73,0x89,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x8D,0x7B,0xDA,0xDE,0x6D,0x73,0x99,0xDE,0x89,0x5A,0x68,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x30,0x8C,0x7D,0xF7,
-    0xB6,0xBD,0xEB,0x62,0xF7,0xCD,0xAE,0x7B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x91,0x9C,0xBA,0xDE,0x0B,0x63,0xF7,0xC5,0x71,0x94,0x48,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xCA,0x62,0x17,0xCE,0xBE,0xFF,0xEB,0x62,0x91,0x9C,0xEE,0x8B,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x69,0x52,0x99,0xDE,0x13,0xAD,0xD2,0xA4,0x70,0x94,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xB2,0x9C,0xBE,0xFF,0xDE,0xFF,0x0B,0x6B,0xF3,0xAC,0xEF,0x8B,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0xB2,0x9C,0xDB,0xE6,0x2C,0x6B,0xB9,0xDE,0x0F,0x8C,0x68,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,
-    0x0B,0x6B,0x7C,0xF7,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x52,0x0B,0x6B,0x95,0xBD,0x6C,0x7B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0xAA,0x62,0x99,0xDE,0xF7,0xC5,0xEB,0x62,0xDA,0xE6,0xAE,0x83,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x3C,0xEF,0xDF,0xFF,0x5D,0xEF,0x2C,0x6B,0x6C,0x73,0x38,0xD6,0xCA,0x62,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0xEF,0x83,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x4C,0x73,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0xEA,0x6A,0x91,0x9C,0x54,0xB5,0x71,0x94,0xAA,0x5A,0xD2,0xA4,0x4C,0x73,0x68,0x5A,0x68,0x5A,0x68,0x5A,
-    0x68,0x5A,0x48,0x52,0x68,0x52,0xEF,0x83,0x38,0xCE,0xCA,0x5A,0xF2,0xA4,0x8D,0x7B,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x0B,0x6B,0x7D,0xF7,0xDF,0xFF,0x99,0xD6,0x69,0x52,0x34,0xB5,0xEA,0x6A,0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x75,0xB5,0xFB,0xE6,0xAE,0x7B,0x75,0xB5,0x89,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x88,0x5A,0x89,0x5A,0x33,0xB5,0x50,0x94,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x79,0xDE,0x71,0x94,0x30,0x8C,0x8D,0x7B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x0B,0x6B,0xDE,0xFF,0x34,0xAD,0x0F,0x8C,0xEF,0x8B,0x68,0x5A,0x48,0x5A,
-    0x48,0x5A,0x68,0x5A,0x48,0x5A,0xEF,0x8B,0xFB,0xE6,0x6D,0x73,0x8D,0x7B,0x34,0xB5,0x69,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xD2,0xA4,0xBE,0xFF,0x99,0xDE,0x2C,0x73,0xB1,0xA4,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0xAE,0x7B,0xDE,0xFF,0x54,0xB5,0xEA,0x62,0x17,0xCE,0x50,0x94,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x2B,0x6B,0xFA,0xDE,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x0B,0x63,0x50,0x94,0xAA,0x62,0x48,0x52,0x48,0x52,0x48,0x5A,0x68,0x52,0x6D,0x73,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x2B,0x6B,0x6D,0x73,0x75,0xBD,0x4C,0x73,0x4C,0x73,0x4C,0x73,0x6D,0x7B,
-    0xAE,0x7B,0x13,0xA5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xD2,0xA4,0x69,0x52,0xCE,0x7B,0x99,0xDE,0x95,0xBD,0x6C,0x73,0x68,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x89,0x5A,0xAA,0x62,0x37,0xD6,0xAD,0x83,0x68,0x52,0x48,0x5A,0x68,0x5A,0x30,0x8C,0x99,0xD6,0x0C,0x6B,0x79,0xD6,0x48,0x52,0x68,0x52,0x48,0x5A,0x48,0x52,0x48,0x5A,0x68,0x5A,0x71,0x94,0xBE,0xFF,0xDA,0xDE,0xEA,0x62,0xD6,0xC5,0xCF,0x8B,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xEF,0x8B,0xBA,0xDE,0xEB,0x62,0x95,0xB5,0xF6,0xC5,0x68,0x52,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,
-    0x0F,0x8C,0x78,0xD6,0x89,0x5A,0x2F,0x94,0x89,0x62,0x48,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x69,0x52,0x3C,0xEF,0xEF,0x8B,0x95,0xBD,0x6D,0x7B,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x54,0xAD,0xFF,0xFF,0xFB,0xE6,0x2C,0x6B,0xB6,0xC5,0x4C,0x73,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x58,0xD6,0x75,0xB5,0xEB,0x62,0x5C,0xF7,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x2C,0x6B,0x7C,0xF7,0x68,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x6C,0x7B,0x33,0xB5,0xA9,0x62,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0xAE,0x83,0x9D,0xFF,0x91,0x9C,0xEF,0x83,0x99,0xDE,0x89,0x5A,
-    0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x30,0x8C,0xDE,0xFF,0xDF,0xFF,0x17,0xC6,0xCA,0x62,0x17,0xCE,0xF3,0xAC,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x68,0x5A,0x68,0x52,0xB6,0xBD,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xDE,0x2C,0x6B,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x6D,0x7B,0xDA,0xE6,0xDE,0xFF,0x9D,0xF7,0xF3,0xA4,0x2C,0x6B,0x95,0xBD,0x69,0x52,0x68,0x52,0x68,0x5A,0x68,0x5A,0x48,0x52,0x68,0x52,0xCE,0x83,0x1B,0xE7,0x50,0x8C,0x6D,0x73,0x13,0xAD,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x69,0x5A,0xB6,0xBD,0xFF,0xFF,0xDE,0xFF,0x0C,0x6B,0xCE,0x83,
-    0x4F,0x94,0x68,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xEB,0x6A,0xBE,0xFF,0x92,0x9C,0x50,0x94,0xCE,0x83,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x89,0x5A,0xAA,0x62,0x58,0xD6,0xCA,0x62,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xD2,0xA4,0xF6,0xC5,0xCE,0x83,0xEE,0x8B,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xAA,0x5A,0x7D,0xF7,0x38,0xCE,0x0B,0x6B,0x58,0xD6,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0xEB,0x6A,0x79,0xD6,0x75,0xB5,0xAA,0x5A,0x33,0xAD,0x0B,0x6B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xD2,0xA4,0xBE,0xFF,0x7D,0xF7,0xEB,0x6A,0x70,0x94,0xA9,0x62,0x48,0x5A,0x68,0x5A,
-    0x48,0x5A,0x48,0x5A,0xAA,0x62,0xDE,0xFF,0x99,0xDE,0x2C,0x6B,0x4C,0x73,0x3B,0xEF,0xB1,0x9C,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x2C,0x6B,0x54,0xAD,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x6D,0x73,0x91,0x9C,0xEF,0x83,0x0F,0x8C,0xD2,0xA4,0x75,0xB5,0x37,0xCE,0xBA,0xDE,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x54,0xAD,0xCA,0x62,0x54,0xB5,0x99,0xDE,0x58,0xD6,0x17,0xCE,0x38,0xCE,0xFB,0xE6,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xF7,0x8D,0x7B,0x69,0x52,0x2C,0x73,0x17,0xCE,0xFB,0xE6,
-    0x58,0xD6,0x74,0xB5,0x50,0x94,0x0F,0x8C,0xF3,0xAC,0xEE,0x83,0x89,0x5A,0x17,0xCE,0x78,0xD6,0x50,0x94,0xAE,0x7B,0x0B,0x6B,0x13,0xA5,0x58,0xCE,0xEB,0x62,0x38,0xCE,0x69,0x52,0x68,0x52,0x48,0x52,0x48,0x52,0x48,0x5A,0x68,0x5A,0xD2,0xA4,0xDE,0xFF,0xBD,0xFF,0xCA,0x62,0x96,0xBD,0x0F,0x8C,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x4C,0x73,0xDA,0xE6,0x2C,0x6B,0x71,0x94,0x7C,0xF7,0x89,0x5A,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x89,0x5A,0x0B,0x73,0x48,0x5A,0x89,0x62,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xD2,0xA4,0x1B,0xEF,0x6C,0x73,0xF6,0xC5,0x0B,0x6B,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,
-    0x0C,0x6B,0x9A,0xDE,0xDF,0xFF,0xD3,0x9C,0x6D,0x73,0x95,0xBD,0x89,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0xCA,0x62,0x5D,0xF7,0xD2,0xA4,0xB2,0x9C,0x17,0xCE,0x68,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x4C,0x73,0x7D,0xF7,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x6C,0x7B,0x91,0x9C,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0x68,0x52,0xD7,0xC5,0x9A,0xDE,0x4C,0x6B,0x37,0xCE,0xEF,0x8B,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x48,0x52,0xFB,0xE6,0xDE,0xFF,0xBE,0xFF,0xB2,0x9C,0xEB,0x62,0x7D,0xF7,0xCA,0x62,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,
-    0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x75,0xB5,0x6D,0x73,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xD6,0xC5,0xDF,0xFF,0xFF,0xFF,0xFB,0xE6,0x8D,0x7B,0xD6,0xC5,0xCA,0x62,0x48,0x52,0x68,0x52,0x68,0x52,0x2B,0x73,0x79,0xD6,0xDE,0xFF,0xDE,0xFF,0x5C,0xEF,0xCB,0x62,0x50,0x94,0x4C,0x73,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xCF,0x83,0xBE,0xFF,0xFF,0xFF,0x58,0xD6,0x0B,0x6B,0xD1,0xA4,0x89,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x89,0x5A,0x18,0xCE,0xF7,0xC5,0xCB,0x62,0xFB,0xEE,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x50,0x9C,0xAA,0x62,
-    0x50,0x94,0x13,0xAD,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xEF,0x83,0xDA,0xE6,0x6D,0x73,0x70,0x94,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x89,0x5A,0x54,0xB5,0x1B,0xE7,0x4C,0x6B,0x99,0xDE,0x68,0x5A,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x17,0xCE,0xBE,0xFF,0xAA,0x5A,0x50,0x94,0x70,0x9C,0x48,0x52,0x68,0x5A,0x48,0x52,0xD2,0x9C,0xBE,0xFF,0xDE,0xFF,0x6C,0x73,0x30,0x8C,0xEA,0x6A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x49,0x52,0xDE,0xFF,0xBE,0xFF,0xB2,0x9C,0x69,0x52,0x0B,0x6B,0x7D,0xF7,0x54,0xB5,0xA9,0x62,0x48,0x52,0x68,0x52,0x68,0x52,0x68,0x5A,0x68,0x52,0x68,0x5A,0x89,0x5A,0x70,0x94,0x0F,0x84,
-    0xBD,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xEF,0x83,0x34,0xAD,0xB9,0xDE,0x17,0xC6,0x54,0xB5,0x34,0xAD,0xDA,0xE6,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x69,0x52,0x69,0x52,0x69,0x52,0x68,0x52,0x69,0x52,0x0B,0x6B,0x99,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x3C,0xEF,0x8D,0x7B,0x69,0x52,0x69,0x52,0x69,0x52,0x2F,0x8C,0x54,0xAD,0x74,0xB5,0x50,0x8C,0xAA,0x5A,0x71,0x94,0x4C,0x73,0x2C,0x6B,0x34,0xAD,0xF7,0xC5,0x5C,0xEF,0xDE,0xFF,0xBE,0xFF,0x38,0xCE,0x4D,0x73,0xFA,0xE6,0xB9,0xDE,0x95,0xBD,0x91,0x9C,0xAE,0x7B,
-    0x0B,0x6B,0xCA,0x62,0x55,0xAD,0xDF,0xFF,0xDE,0xFF,0x89,0x5A,0x54,0xB5,0x30,0x8C,0x68,0x52,0x48,0x5A,0x48,0x5A,0x48,0x52,0x48,0x52,0xAA,0x62,0x5C,0xF7,0x30,0x8C,0xEB,0x62,0x9D,0xF7,0x0F,0x8C,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x68,0x52,0x3C,0xEF,0x99,0xD6,0x6D,0x73,0x37,0xCE,0x0B,0x6B,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0xAE,0x7B,0xBE,0xFF,0xDE,0xFF,0x0C,0x6B,0x30,0x8C,0x33,0xAD,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x2F,0x8C,0xFB,0xE6,0x6D,0x7B,0x58,0xD6,0x0B,0x6B,0x68,0x52,0x48,0x5A,0x48,0x5A,
-    0x48,0x5A,0x48,0x5A,0x89,0x62,0x89,0x5A,0x6C,0x73,0x7C,0xF7,0x48,0x52,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0xCA,0x62,0xBE,0xFF,0xF7,0xC5,0x0B,0x6B,0x99,0xDE,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x48,0x52,0x0F,0x8C,0xBD,0xF7,0xFF,0xFF,0xFB,0xE6,0x8D,0x7B,0xB6,0xBD,0x38,0xD6,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xAE,0x7B,0xDE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x54,0xAD,0x54,0xB5,0x68,0x5A,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0x8D,0x7B,0x9D,0xF7,0xFF,0xFF,0xDF,0xFF,0x13,0xA5,
-    0xCB,0x62,0x79,0xDE,0x0B,0x6B,0xCE,0x83,0x95,0xBD,0x58,0xD6,0xF2,0xA4,0xBA,0xDE,0xFF,0xFF,0xFF,0xFF,0x2F,0x8C,0x0F,0x8C,0x0F,0x8C,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x0B,0x6B,0x58,0xCE,0xDE,0xFF,0xBE,0xFF,0x4C,0x6B,0x70,0x94,0x4C,0x73,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x70,0x94,0x1C,0xEF,0x6D,0x73,0x75,0xBD,0x2B,0x73,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x6C,0x7B,0xCE,0x83,0xCA,0x62,0x54,0xB5,0x0B,0x6B,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x2C,0x6B,0x5C,0xF7,0x0F,0x8C,0x95,0xBD,0xCA,0x62,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x50,0x94,0xDE,0xFF,
-    0xEF,0x83,0xB1,0x9C,0x4C,0x73,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x75,0xB5,0xDE,0xFF,0xB2,0x9C,0x8D,0x7B,0xD2,0xA4,0xA9,0x62,0x68,0x5A,0x48,0x52,0x91,0x94,0x9D,0xF7,0xDE,0xFF,0x91,0x94,0x0F,0x8C,0x6C,0x7B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x68,0x52,0x7D,0xF7,0xFF,0xFF,0x1B,0xE7,0xCE,0x83,0x68,0x52,0x2C,0x6B,0x17,0xCE,0x78,0xDE,0x54,0xB5,0x70,0x94,0x2F,0x8C,0x30,0x8C,0x70,0x94,0x13,0xAD,0xB5,0xBD,0x0F,0x8C,0x58,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x71,0x94,0x69,0x52,0x89,0x5A,0xCA,0x62,0xEB,0x62,0x6D,0x73,0x58,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x71,0x94,0xEF,0x83,
-    0x2F,0x8C,0x70,0x94,0x91,0x94,0x13,0xA5,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xEF,0xF3,0xA4,0x6C,0x73,0x2B,0x6B,0x0B,0x63,0x0B,0x6B,0x4C,0x6B,0xCE,0x83,0x79,0xD6,0x9D,0xF7,0x50,0x8C,0x0B,0x63,0xEB,0x62,0xEB,0x62,0x37,0xC6,0xDF,0xFF,0xFF,0xFF,0x17,0xC6,0x8A,0x5A,0x2C,0x6B,0xCE,0x83,0x71,0x94,0x13,0xAD,0xB5,0xBD,0xBE,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xDE,0xFF,0xA9,0x5A,0x34,0xAD,0x34,0xAD,0x6D,0x73,0x2C,0x73,0x0B,0x6B,0xCA,0x62,0x69,0x5A,0x89,0x5A,0xBE,0xFF,0x13,0xAD,0x69,0x52,0x95,0xBD,0xDA,0xE6,0xEB,0x6A,
-    0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x89,0x5A,0x54,0xAD,0xBE,0xFF,0x18,0xCE,0x8D,0x7B,0x78,0xD6,0x0B,0x6B,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xAD,0x7B,0xDE,0xFF,0x1B,0xEF,0xAA,0x5A,0x17,0xCE,0xAE,0x83,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x69,0x5A,0x79,0xD6,0x58,0xD6,0x4C,0x73,0x38,0xD6,0x68,0x5A,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x4C,0x7B,0x4C,0x73,0xEF,0x83,0x7D,0xF7,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xD2,0xA4,0x7D,0xF7,0xEF,0x83,
-    0x33,0xAD,0xF2,0xA4,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0xD6,0xC5,0xFF,0xFF,0xFF,0xFF,0xB6,0xBD,0x2C,0x6B,0xBA,0xE6,0xAA,0x62,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x69,0x52,0x58,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x95,0xB5,0x13,0xAD,0x4C,0x73,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xB6,0xBD,0xDE,0xFF,0xDF,0xFF,0xFB,0xE6,0x0B,0x6B,0xD2,0xA4,0xB6,0xBD,0x34,0xAD,0xEF,0x83,0x69,0x52,0x0B,0x63,0x17,0xC6,0xFF,0xFF,0xFF,0xFF,0x99,0xD6,0x0B,0x6B,0xF2,0xA4,0xA9,0x62,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,
-    0xF3,0xA4,0xBE,0xFF,0xDE,0xFF,0x54,0xAD,0x0F,0x8C,0xEF,0x8B,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x6D,0x7B,0xFA,0xE6,0xB2,0x9C,0xEB,0x62,0x54,0xB5,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x89,0x5A,0xF6,0xC5,0xEA,0x62,0x50,0x94,0x70,0x9C,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0xAA,0x5A,0xBE,0xFF,0x54,0xAD,0x71,0x94,0x4C,0x73,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0xCE,0x83,0x5D,0xF7,0x34,0xAD,0xA9,0x5A,0x54,0xB5,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0xEF,0x83,0x7D,0xF7,0xDA,0xE6,0xCB,0x62,0x34,0xAD,0x4C,0x73,0x68,0x52,0x68,0x52,0x2F,0x8C,0x5C,0xEF,0xFF,0xFF,0x75,0xB5,
-    0x30,0x8C,0xCE,0x83,0x48,0x52,0x68,0x52,0x69,0x5A,0x0B,0x6B,0xEF,0x83,0xBA,0xDE,0xFF,0xFF,0xFF,0xFF,0xDA,0xDE,0x0F,0x8C,0x68,0x52,0xAA,0x5A,0xAE,0x7B,0xF3,0xA4,0x74,0xB5,0x74,0xB5,0x34,0xAD,0x91,0x94,0x8D,0x73,0x8D,0x73,0xF6,0xBD,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0xC6,0xF3,0xA4,0x75,0xB5,0xD6,0xC5,0x58,0xCE,0x99,0xD6,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFF,0xEF,0xFF,0xEF,0xFF,0xEF,0xFF,0xEF,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0xBA,0xDE,0x79,0xD6,0x79,0xD6,0xFB,0xE6,0xDE,0xFF,0xDF,0xFF,0xDF,0xFF,0x1B,0xE7,0x99,0xD6,0x58,0xCE,0x17,0xC6,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xBA,0xDE,0x71,0x94,0x30,0x8C,0x0F,0x84,0xAD,0x7B,0xEB,0x62,0x89,0x52,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x69,0x52,0xCE,0x83,0x54,0xB5,0x75,0xB5,0x34,0xAD,0x33,0xAD,0x95,0xBD,0x54,0xAD,0xD2,0x9C,0xDE,0xFF,0x38,0xCE,0xEB,0x62,0xCA,0x62,0x58,0xD6,0xD6,0xC5,0xEA,0x6A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x69,0x5A,0x50,0x8C,0x3B,0xE7,0xDF,0xFF,0x34,0xAD,0x8D,0x73,0x79,0xDE,0x2B,0x6B,0x68,0x5A,
-    0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x8D,0x7B,0x7D,0xFF,0x95,0xBD,0xEA,0x62,0xF7,0xC5,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xCA,0x62,0xBD,0xFF,0x54,0xAD,0x71,0x94,0x13,0xAD,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x89,0x5A,0x50,0x94,0x6D,0x73,0x50,0x94,0x7D,0xF7,0x68,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xAA,0x62,0xDA,0xE6,0xBA,0xE6,0x2C,0x73,0xD6,0xC5,0x4C,0x73,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x8D,0x7B,0xFB,0xE6,0xFF,0xFF,0x9D,0xF7,0x50,0x8C,0xB2,0x9C,0x95,0xBD,0x48,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,
-    0x68,0x5A,0x48,0x52,0x4C,0x73,0x9D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xDE,0xAE,0x7B,0x17,0xCE,0x68,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0xEB,0x62,0x9D,0xFF,0xFF,0xFF,0xFF,0xFF,0x13,0xAD,0x89,0x5A,0x8D,0x7B,0x89,0x5A,0xCA,0x62,0x75,0xB5,0x99,0xD6,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0x50,0x94,0x91,0x9C,0xAD,0x7B,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x4C,0x73,0xDB,0xE6,0xDF,0xFF,0xBA,0xDE,0x4D,0x73,0x34,0xAD,0xAA,0x62,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0xA9,0x5A,0xD6,0xC5,0xDB,0xE6,0x69,0x52,0x54,0xB5,0xA9,0x62,0x48,0x5A,0x48,0x52,
-    0x68,0x5A,0x68,0x52,0x68,0x52,0xF2,0xA4,0x33,0xAD,0xEA,0x62,0x33,0xAD,0x0B,0x6B,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x9D,0xFF,0x17,0xC6,0x2C,0x6B,0x17,0xCE,0x68,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x0B,0x6B,0x58,0xD6,0xDA,0xE6,0x69,0x52,0xF7,0xC5,0x69,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x0B,0x6B,0x5C,0xF7,0x7D,0xF7,0xEF,0x83,0x51,0x94,0x50,0x94,0x48,0x52,0x68,0x52,0xCE,0x83,0x3C,0xEF,0xFF,0xFF,0x58,0xCE,0xEF,0x83,0x54,0xAD,0x74,0xB5,0xB6,0xBD,0x17,0xCE,0x9A,0xDE,0x3C,0xEF,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xEF,0x95,0xB5,0x8D,0x73,0x68,0x52,0x48,0x52,0x69,0x52,0x89,0x52,0x69,0x52,0xEB,0x62,
-    0x75,0xB5,0xBA,0xDE,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xEF,0xFF,0xE7,0xFE,0xDF,0x9B,0xBF,0x15,0x8E,0x72,0x75,0x51,0x6D,0x51,0x6D,0x51,0x6D,0x93,0x7D,0xF9,0xAE,0xFE,0xD7,0xFE,0xE7,0xFF,0xEF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x9E,0xF7,0x5D,0xF7,
-    0x5C,0xEF,0x1B,0xE7,0x99,0xD6,0x58,0xCE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x69,0x52,0x69,0x52,0x69,0x52,0x89,0x5A,0xCA,0x62,0x2C,0x6B,0xF7,0xC5,0xFE,0xFF,0xDE,0xFF,0xFF,0xFF,0x9E,0xF7,0x30,0x8C,0x68,0x52,0x6D,0x73,0x58,0xD6,0x37,0xCE,0xEB,0x6A,0x68,0x52,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0x48,0x52,0x48,0x52,0x71,0x94,0x1B,0xE7,0xDE,0xFF,0xDF,0xFF,0x34,0xAD,0x2C,0x6B,0x78,0xD6,0x4C,0x73,0x48,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xA9,0x62,0xF3,0xAC,0xCE,0x83,0x50,0x94,0x4C,0x73,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x70,0x94,0xBE,0xFF,0xAE,0x7B,0x34,0xAD,0xCE,0x83,
-    0x68,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0xEA,0x6A,0xD6,0xC5,0x6C,0x73,0x92,0x9C,0x5C,0xF7,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x0F,0x8C,0x7D,0xF7,0xD2,0xA4,0xCE,0x83,0x54,0xB5,0xA9,0x62,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x69,0x5A,0xD3,0xA4,0xBE,0xF7,0xFF,0xFF,0xDB,0xDE,0x2C,0x6B,0xF6,0xC5,0x8D,0x7B,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x54,0xB5,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xF7,0x6D,0x73,0xD2,0xA4,0xEE,0x83,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,
-    0x89,0x5A,0x92,0x9C,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0x89,0x52,0x89,0x5A,0x34,0xAD,0x7D,0xF7,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x95,0xB5,0xEB,0x62,0xB5,0xBD,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0x68,0x52,0x79,0xD6,0xDF,0xFF,0x7D,0xF7,0x71,0x94,0x33,0xAD,0x0B,0x6B,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x50,0x94,0x5D,0xF7,0x2C,0x6B,0x8D,0x7B,0x70,0x9C,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x0B,0x6B,0x5C,0xEF,0x2B,0x6B,0x13,0xAD,0x0F,0x8C,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x99,0xDE,0x1B,0xEF,0x8D,0x7B,0xFA,0xE6,0x68,0x52,0x48,0x52,0x48,0x5A,
-    0x48,0x5A,0x68,0x5A,0x89,0x5A,0x95,0xBD,0xBE,0xFF,0xCA,0x5A,0x51,0x94,0xEB,0x62,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0x3B,0xEF,0xDE,0xFF,0xF7,0xC5,0xCA,0x5A,0x38,0xCE,0x48,0x52,0x69,0x52,0x8D,0x73,0xFB,0xE6,0xDE,0xFF,0xDA,0xDE,0xCE,0x7B,0x17,0xCE,0xEF,0x83,0xEB,0x62,0xCA,0x5A,0x4C,0x6B,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xDE,0xFF,0x9D,0xF7,0x7D,0xF7,0x1C,0xEF,0x3C,0xEF,0x5C,0xEF,0x7D,0xF7,0x9D,0xF7,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFE,0xDF,0xF5,0x95,0xAC,0x3B,0x8A,0x33,0x6A,0x2B,0x69,0x23,0x49,0x1B,0x69,0x1B,0x89,0x1B,0x69,0x1B,0x89,0x23,0x49,0x23,0x8A,0x2B,0x6A,0x33,0x11,0x6D,0xDD,0xD7,0xFF,0xE7,0xFF,0xEF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x9D,0xF7,0x7D,0xF7,0x5D,0xEF,0x3C,0xEF,0xB6,0xBD,0x8D,0x7B,0x75,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0x7D,0xF7,0xEB,0x62,0x68,0x52,0xCA,0x62,0x17,0xC6,0x9D,0xF7,0xB9,0xDE,0xEA,0x6A,0x68,0x52,0x68,0x52,0x68,0x5A,0x68,0x52,0x48,0x52,0xCA,0x62,0x3C,0xEF,0xBE,0xFF,0xDE,0xFF,0xDF,0xFF,0xFF,0xFF,0xD7,0xBD,0x89,0x5A,0xF6,0xC5,0x50,0x94,0x68,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x68,0x5A,0x69,0x5A,0x89,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0xB9,0xDE,0x5C,0xEF,0x4C,0x6B,0xD6,0xC5,0x4C,0x73,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x8D,0x7B,0x99,0xDE,0x4C,0x6B,0x54,0xB5,0x5C,0xF7,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x69,0x5A,
-    0xD6,0xC5,0xBE,0xFF,0x89,0x5A,0x54,0xB5,0xB1,0x9C,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xEB,0x6A,0x79,0xD6,0xFF,0xFF,0xDF,0xFF,0x91,0x94,0x0F,0x8C,0x75,0xB5,0x89,0x62,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xEA,0x62,0x99,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xD3,0x9C,0xA9,0x5A,0x95,0xBD,0x89,0x62,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x0B,0x6B,0x3C,0xEF,0xDF,0xFF,0xDF,0xFF,0x58,0xCE,0xDE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0xCE,0x7B,0x13,0xAD,0x8C,0x7B,0x68,0x52,
-    0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x4C,0x73,0xBE,0xFF,0xDF,0xFF,0xD6,0xBD,0x2B,0x6B,0x95,0xBD,0x48,0x52,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x2B,0x6B,0xDA,0xE6,0xF7,0xC5,0x6C,0x73,0xB2,0xA4,0x69,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x78,0xD6,0x95,0xB5,0x89,0x5A,0x17,0xCE,0xA9,0x62,0x48,0x52,0x48,0x5A,0x48,0x5A,0x69,0x5A,0x95,0xB5,0xDE,0xFF,0x71,0x94,0x50,0x94,0x8D,0x7B,0x68,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xB1,0x9C,0x9D,0xFF,0xEF,0x83,0x2C,0x6B,0x50,0x94,0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x52,0x69,0x52,0x74,0xB5,0xFF,0xFF,0xDA,0xDE,0x4C,0x73,0x74,0xB5,0xDA,0xE6,0x1B,0xE7,
-    0xDE,0xFF,0xDF,0xFF,0xDF,0xFF,0x1C,0xE7,0xAE,0x7B,0x89,0x52,0xAA,0x5A,0x0B,0x6B,0x6D,0x73,0xCF,0x7B,0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xDD,0xDF,0x39,0xB7,0x31,0x65,0x69,0x23,0x48,0x1B,0x68,0x13,0x68,0x13,0x68,0x13,0x68,0x13,0x68,0x0B,0x68,0x0B,0x68,0x0B,0x68,0x0B,0x68,0x0B,0x68,0x13,0x68,0x13,
-    0x68,0x13,0x48,0x13,0x49,0x1B,0xCB,0x33,0xB7,0x9E,0x9B,0xCF,0xFE,0xEF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0xAE,0x7B,0xCA,0x62,0x69,0x52,0x89,0x5A,0xB5,0xBD,0x79,0xDE,0xB9,0xDE,0x99,0xDE,0x37,0xCE,0x37,0xCE,0x13,0xAD,0xBA,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0xD6,
-    0x69,0x52,0xD2,0xA4,0x3C,0xEF,0xAA,0x62,0x68,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x0F,0x8C,0x5C,0xF7,0x75,0xB5,0xAE,0x7B,0x13,0xAD,0x69,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x89,0x5A,0xD6,0xC5,0x99,0xDE,0x2C,0x6B,0x95,0xB5,0x1B,0xEF,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x2C,0x73,0x99,0xDE,0x95,0xB5,0xEB,0x62,0xD6,0xC5,0x0B,0x6B,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xCE,0x83,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0xAA,0x5A,0x33,0xAD,0x50,0x94,0x68,0x5A,0x48,0x5A,
-    0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0xB1,0x9C,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xF7,0x0C,0x6B,0x0F,0x8C,0xEF,0x8B,0x69,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x89,0x5A,0xD3,0xA4,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x34,0xAD,0x2C,0x6B,0x95,0xBD,0x89,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x69,0x52,0xBA,0xDE,0xDE,0xFF,0x1B,0xE7,0xAD,0x7B,0xF6,0xC5,0xEA,0x62,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x68,0x52,0xB6,0xBD,0xBE,0xFF,
-    0x2C,0x6B,0x30,0x94,0x0B,0x6B,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x71,0x94,0xDA,0xE6,0x8D,0x7B,0x71,0x94,0x13,0xAD,0x68,0x52,0x48,0x5A,0x48,0x5A,0x48,0x52,0xF2,0xA4,0xDE,0xFF,0x75,0xB5,0x89,0x5A,0xD6,0xC5,0x48,0x52,0x48,0x52,0x68,0x5A,0x48,0x5A,0x68,0x52,0xAD,0x7B,0x3C,0xEF,0x58,0xCE,0x6D,0x73,0xD2,0xA4,0x69,0x5A,0xCA,0x62,0x2C,0x73,0x0F,0x8C,0xD2,0xA4,0x58,0xCE,0xFF,0xFF,0xDF,0xFF,0xB2,0x9C,0xEB,0x62,0xCE,0x7B,0xEF,0x83,0xDE,0xFF,0xFF,0xFF,0xDF,0xFF,0x9E,0xF7,0xD6,0xBD,0x34,0xAD,0xB6,0xBD,0xFB,0xE6,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFE,0xE7,0xB8,0xAE,0x10,0x65,0x49,0x23,0x48,0x13,0x68,0x13,0x68,0x13,0x68,0x13,0x68,0x13,0x69,0x1B,0xAA,0x23,0xCB,0x2B,0xEB,0x2B,0xEB,0x2B,0xEB,0x2B,0xCA,0x23,0x69,0x1B,0x48,0x13,0x68,0x13,0x68,0x13,0x48,0x0B,0x69,0x13,0x49,0x1B,0x4D,0x4C,0xF5,0x95,0xBD,0xD7,0xFF,0xEF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0xB6,0xBD,0x70,0x94,0x4C,0x73,0xCA,0x62,0xAA,0x5A,0xAA,0x5A,0xEB,0x62,0x4C,0x6B,0xB2,0x9C,0x99,0xD6,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xEF,0x2B,0x6B,0x0B,0x6B,0xBA,0xDE,0x34,0xAD,0x89,0x5A,0x48,0x52,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x0B,0x6B,0x58,0xD6,0xBE,0xFF,
-    0x4C,0x73,0x91,0x9C,0x91,0x9C,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x9D,0xFF,0x58,0xD6,0x0B,0x6B,0x17,0xC6,0xFA,0xE6,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0xB1,0x9C,0x7D,0xF7,0x6D,0x73,0x30,0x8C,0x74,0xB5,0x68,0x5A,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x69,0x52,0x18,0xCE,0xFF,0xFF,0xFF,0xFF,0xD2,0x9C,0x2C,0x6B,0xF6,0xC5,0x0B,0x6B,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0xCA,0x62,0x17,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,0xBD,0x0B,0x6B,0xB2,0xA4,0x0B,0x6B,
-    0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x6D,0x73,0xDA,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xEF,0x0B,0x63,0xF2,0xA4,0x6D,0x7B,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xCE,0x83,0xDE,0xFF,0xDE,0xFF,0xB2,0x9C,0x2C,0x6B,0x74,0xB5,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xAD,0x7B,0xDE,0xFF,0x13,0xA5,0x50,0x94,0xAD,0x83,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xEB,0x6A,0x5C,0xF7,0x34,0xAD,0xCA,0x5A,0x37,0xCE,0x2B,0x6B,0x48,0x5A,0x48,0x5A,0x48,0x52,0x50,0x94,0xDF,0xFF,0x5C,0xEF,
-    0xCA,0x62,0xB5,0xBD,0x89,0x5A,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x52,0xCA,0x62,0xBA,0xDE,0xBE,0xFF,0x0B,0x6B,0xD2,0xA4,0x75,0xBD,0xF7,0xC5,0x75,0xB5,0x34,0xAD,0xDA,0xE6,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0x38,0xCE,0x8D,0x73,0x0F,0x84,0x95,0xB5,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xFD,0xD7,0x72,0x75,0xEB,0x33,0x68,0x13,0x68,0x13,0x68,0x13,0x68,0x13,0x49,0x1B,0x0C,0x44,0x31,0x6D,0x36,0x9E,0x98,0xAE,0xD8,0xB6,0xF9,0xB6,0xF9,0xB6,0xD9,0xB6,0xB8,0xAE,0x77,0x9E,0xD4,0x85,0x8E,0x54,0x6A,0x2B,0x48,0x1B,0x68,0x13,0x68,0x13,0x68,0x13,0x69,0x1B,0xAF,0x54,0xD8,0xAE,0xFE,0xE7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0xDA,0xDE,0x58,0xCE,0x18,0xCE,0x17,0xC6,0x38,0xCE,0xBA,0xDE,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xF3,0xA4,0x69,0x52,0xCE,0x83,0x7D,0xF7,0xF3,0xA4,0x89,0x5A,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xA9,0x5A,0xB6,0xBD,0xBE,0xFF,0x3C,0xEF,0xAA,0x5A,0x95,0xBD,0x6D,0x7B,0x48,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x30,0x8C,0xDE,0xFF,0x58,0xD6,0xEB,0x62,0x38,0xCE,0xB9,0xDE,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,
-    0x48,0x5A,0x68,0x5A,0xCA,0x62,0x17,0xCE,0x58,0xD6,0xCA,0x62,0x78,0xD6,0xAD,0x7B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0x2C,0x6B,0xBE,0xFF,0xFF,0xFF,0x3C,0xEF,0xCA,0x62,0xF3,0xA4,0x13,0xAD,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0xAE,0x83,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0xCE,0x83,0xD2,0xA4,0x8D,0x7B,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x89,0x5A,0x74,0xB5,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xDE,0xFF,0xF3,0xA4,0xEB,0x62,0x34,0xB5,0x68,0x5A,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0xDA,0xE6,0xFE,0xFF,0xFB,0xE6,0xAA,0x5A,0xB5,0xBD,0xAA,0x62,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x69,0x52,0x3B,0xEF,0x79,0xD6,0x4C,0x6B,0x70,0x94,0x88,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0xA9,0x5A,0x17,0xCE,0x7D,0xF7,0x4C,0x73,0x8D,0x7B,0x74,0xB5,0x69,0x5A,0x48,0x52,0x48,0x52,0xAD,0x7B,0xDE,0xFF,0xDF,0xFF,0x2B,0x6B,0xAD,0x7B,0xCE,0x83,0x48,0x52,0x48,0x52,0x68,0x52,0x69,0x5A,0x6C,0x73,0xBA,0xDE,0xDE,0xFF,0x4D,0x73,0xAE,0x7B,0xEF,0x83,0xEB,0x6A,0xCA,0x62,0x8A,0x5A,0xF7,0xC5,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xDF,0xFF,0x7D,0xF7,0x9E,0xF7,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x9B,0xC7,0xEC,0x3B,0x69,0x1B,0x68,0x13,0x68,0x0B,0x68,0x13,0x69,0x1B,0xAF,0x54,0x19,0xAF,0xDC,0xCF,0xFE,0xE7,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,
-    0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFE,0xE7,0xFD,0xD7,0x9B,0xC7,0xF4,0x7D,0x69,0x23,0x48,0x13,0x68,0x13,0x68,0x13,0x48,0x13,0xAB,0x33,0x36,0x96,0xFE,0xE7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xDE,0x6D,0x73,0x49,0x52,0x8D,0x7B,0x3B,0xEF,0xB5,0xBD,0xCA,0x62,0x48,0x52,0x68,0x5A,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x48,0x52,0xAA,0x5A,0x78,0xCE,0xDE,0xFF,0xDF,0xFF,0x34,0xA5,0xEB,0x62,0x37,0xCE,0x89,0x5A,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0xFA,0xE6,0xDE,0xFF,0x38,0xCE,0xCA,0x62,0x58,0xCE,0x78,0xD6,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x4C,0x73,0x9D,0xF7,0x70,0x94,0xCE,0x83,0x99,0xDE,0x69,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x38,0xCE,0xDF,0xFF,0xDE,0xFF,0x13,0xA5,0x69,0x52,0xBA,0xE6,
-    0x0B,0x6B,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x58,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x38,0xCE,0xEB,0x62,0xB5,0xBD,0x89,0x62,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x4C,0x73,0x3C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xF7,0xCA,0x62,0x71,0x9C,0x2B,0x73,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x91,0x94,0xDE,0xFF,0xFF,0xFF,0x4C,0x73,0x4C,0x73,0x91,0x9C,0x48,0x52,0x48,0x5A,0x68,0x5A,
-    0x68,0x5A,0x48,0x52,0x68,0x52,0x54,0xB5,0x3B,0xEF,0xEE,0x83,0x54,0xB5,0xA9,0x62,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x0F,0x8C,0xDE,0xFF,0x54,0xAD,0x89,0x52,0x33,0xAD,0x4C,0x73,0x68,0x52,0x48,0x5A,0x4C,0x73,0x7D,0xF7,0xFF,0xFF,0x54,0xAD,0x2B,0x6B,0x33,0xAD,0xEA,0x62,0x8D,0x7B,0x95,0xBD,0x1B,0xEF,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0x96,0xBD,0x69,0x5A,0xCA,0x62,0xEB,0x62,0x8D,0x73,0x96,0xB5,0x7D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFE,0xEF,0x19,0xB7,0xEB,0x3B,0x68,0x13,0x88,0x13,0x68,0x13,0x89,0x23,0xEC,0x43,0x5A,0xBF,0xFE,0xE7,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xDD,0xD7,0x72,0x7D,0x8A,0x2B,0x48,0x13,0x68,0x13,0x68,0x13,0x48,0x1B,0x35,0x96,0xFE,0xDF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x38,0xCE,0x0B,0x6B,0x48,0x52,0x0B,0x6B,0xF6,0xC5,0x3B,0xEF,0x34,0xAD,0x2B,0x6B,0xEA,0x62,0xCA,0x62,0xA9,0x62,0xAA,0x62,0xAA,0x62,0x92,0x9C,0x7D,0xF7,
-    0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x8D,0x73,0x91,0x94,0x34,0xAD,0x68,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0xCA,0x62,0x7D,0xF7,0xFF,0xFF,0xF7,0xC5,0x8A,0x5A,0x79,0xD6,0x17,0xC6,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xF2,0xA4,0x1B,0xE7,0xAD,0x7B,0x17,0xCE,0x2F,0x8C,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xEB,0x6A,0xBE,0xFF,0xDE,0xFF,0x5D,0xEF,0xAE,0x7B,0x13,0xAD,0xF6,0xC5,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xEA,0x62,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xDF,0xFF,0x5C,0xEF,0x0F,0x8C,0x91,0x9C,0x30,0x94,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x75,0xB5,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xDE,0xFF,0xD2,0xA4,0xCE,0x83,0x50,0x94,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x2C,0x73,0x1C,0xEF,0xFF,0xFF,0x79,0xD6,0xEB,0x62,0xD2,0xA4,0x89,0x62,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xEB,0x6A,0xBE,0xFF,0x34,0xAD,0x30,0x8C,0xEE,0x8B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x8D,0x7B,0x1B,0xEF,0xBE,0xFF,0x2C,0x6B,0xCE,0x83,0xB2,0xA4,0x89,0x5A,
-    0x48,0x52,0x0B,0x6B,0xDA,0xDE,0xFF,0xFF,0xDE,0xFF,0xEA,0x62,0x95,0xBD,0xF6,0xC5,0x95,0xBD,0x50,0x94,0x6D,0x73,0x38,0xC6,0xFF,0xFF,0xFF,0xFF,0x1B,0xE7,0x14,0xA5,0x79,0xD6,0xDE,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x19,0xB7,0x2D,0x44,0x48,0x13,0x68,0x0B,0x68,0x13,0x0B,0x34,0x15,0x86,0xFE,0xDF,0xFF,0xEF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xF7,0xBB,0xEE,0x3D,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFE,0xEF,0xD8,0xAE,0xCF,0x54,0x48,0x1B,0x68,0x13,0x88,0x13,0x28,0x1B,0xF4,0x8D,0xFE,0xE7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xD6,0x0F,0x8C,0xEA,0x62,0x68,0x52,0x2C,0x6B,0xF3,0xA4,0xB5,0xBD,0x95,0xBD,0xD2,0xA4,0x2F,0x8C,0xD2,0xA4,0x38,0xCE,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xE7,0x2C,0x6B,0xB9,0xDE,0x6C,0x73,0x68,0x52,0x68,0x5A,0x48,0x5A,0x48,0x52,0x48,0x52,0x13,0xAD,0xDE,0xFF,0xFF,0xFF,0xF7,0xC5,0xA9,0x5A,0x99,0xDE,0x54,0xB5,0x68,0x52,0x68,0x5A,
-    0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x89,0x5A,0x5C,0xEF,0x95,0xB5,0x4C,0x73,0x99,0xDE,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x74,0xB5,0xDE,0xFF,0xDF,0xFF,0xD6,0xBD,0x2C,0x6B,0x3C,0xEF,0x0A,0x6B,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x69,0x52,0x99,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x17,0xC6,0x0B,0x6B,0xD6,0xC5,0x0B,0x6B,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xEA,0x62,0x9D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xBE,0xF7,0x58,0xCE,0x13,0xA5,0xFB,0xE6,0x4C,0x6B,0xD2,0xA4,0xEA,0x6A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xA9,0x62,0x75,0xB5,0xDE,0xFF,0xDE,0xFF,0x6D,0x73,0x0F,0x8C,0x8D,0x7B,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x68,0x52,0xDE,0xFF,0x58,0xCE,0x6C,0x73,0xD6,0xC5,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0xAA,0x62,0xD7,0xC5,0xFF,0xFF,0x17,0xCE,0xEB,0x62,0x13,0xAD,0x4C,0x73,0x6D,0x73,0xF3,0xA4,0x3C,0xEF,0xFF,0xFF,0xFF,0xFF,0x6D,0x73,0x0B,0x6B,0xCA,0x62,0x69,0x52,0x6D,0x73,0xB2,0x94,0xDA,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBC,0xCF,0x4D,0x44,0x68,0x13,0x68,0x13,0x68,0x13,0x4D,0x4C,0xF9,0xB6,0xFE,0xE7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x75,0xDD,0x4D,0x9B,0x31,0xB4,0x9E,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9C,0xD7,0x93,0x7D,0x49,0x1B,0x68,0x13,0x68,0x13,0x69,0x23,0xF4,0x8D,0xFE,0xE7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xF7,0x38,0xCE,0x34,0xA5,0x30,0x8C,0x4D,0x73,0x0B,0x63,0x4C,0x6B,0x30,0x8C,0x34,0xAD,0x99,0xD6,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x54,0xAD,0x2C,0x6B,0xDA,0xE6,0x89,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x89,0x5A,0x17,0xCE,0xFF,0xFF,0xFF,0xFF,0xD6,0xBD,0x89,0x5A,0xB9,0xDE,0x91,0x9C,0x68,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x30,0x94,0x5C,0xEF,0x30,0x8C,0x13,0xAD,0xB2,0xA4,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x0B,0x6B,0xDA,0xE6,0xDF,0xFF,0x7D,0xF7,
-    0x51,0x94,0xD2,0xA4,0x54,0xB5,0x48,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0xEF,0x83,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xAE,0x7B,0x2C,0x6B,0x74,0xB5,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x71,0x94,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0xD6,0xEE,0x83,0xEA,0x62,0x69,0x52,0x17,0xC6,0xB2,0x9C,0xB1,0x9C,0x8D,0x7B,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x0F,0x8C,0x5C,0xEF,0xDE,0xFF,0xF7,0xC5,
-    0x8D,0x7B,0x8D,0x83,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xDE,0xFF,0x9D,0xF7,0xCE,0x83,0x34,0xB5,0xEA,0x6A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x48,0x52,0x34,0xAD,0xBE,0xFF,0x9E,0xFF,0xCE,0x83,0x30,0x8C,0x99,0xDE,0xBA,0xDE,0x9E,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,0xBD,0x4C,0x73,0x54,0xB5,0x99,0xDE,0x3C,0xEF,0x9D,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFE,0xE7,0x0D,0x4C,0x48,0x13,0x88,0x13,0x48,0x13,0x2C,0x44,0x9B,0xCF,0xFF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x7A,0xFE,0xAB,0x92,0x09,0x82,0xBB,0xFE,0x9E,0xFF,0xBF,0xFF,0x9E,0xFF,0x5D,0xFF,0x1C,0xFF,0x7D,0xFF,0xDE,0xFF,0xFE,0xE7,0xF4,0x85,0x49,0x1B,0x68,0x13,0x88,0x13,
-    0xAA,0x33,0x76,0x9E,0xFF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x7D,0xF7,0x3C,0xEF,0x3C,0xEF,0x3C,0xEF,0x7D,0xEF,0xDE,0xFF,
-    0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD2,0x9C,0x14,0xAD,0x95,0xB5,0x68,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x8E,0x7B,0x1B,0xE7,0xFF,0xFF,0xFE,0xFF,0xB6,0xBD,0x89,0x5A,0xDA,0xE6,0x8D,0x7B,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x69,0x5A,0xB9,0xDE,0xDA,0xDE,0x0B,0x63,0xD6,0xC5,0x0B,0x6B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xB2,0x9C,0xBE,0xFF,0xDE,0xFF,0xBA,0xDE,0x6D,0x73,0x78,0xD6,0x0B,0x6B,0x68,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x58,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE6,0x8A,0x5A,0xB2,0xA4,0x6D,0x7B,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0xAA,0x5A,0x7D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xBA,0xDE,0x4C,0x73,0x48,0x52,0x48,0x52,0x68,0x5A,0x68,0x5A,0x6D,0x73,0x17,0xCE,0xCA,0x62,0xB5,0xBD,0x68,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xA9,0x5A,0xF6,0xC5,0xBE,0xFF,0x3C,0xEF,0x6C,0x73,0xCA,0x6A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x68,0x52,0xFE,0xFF,0xFF,0xFF,0x13,0xA5,0xEA,0x62,0x53,0xB5,0x48,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0xAA,0x5A,0x8E,0x73,0x3C,0xEF,
-    0xDF,0xFF,0x17,0xC6,0x89,0x5A,0xAA,0x5A,0x89,0x52,0xDB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,0xE7,0x11,0x6D,0x28,0x13,0x68,0x0B,0x48,0x13,0xEC,0x3B,0xFD,0xD7,0xFF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x7E,0xFF,0x4D,0xA3,0xC8,0x89,0x72,0xE4,0xDC,0xFE,0xBB,0xFE,0xCF,0xC3,0x4A,0x9A,0xE8,0x81,0x2D,0x9B,0x1C,0xF7,0xFE,0xF7,0xFE,0xE7,0x72,0x7D,0x69,0x1B,0x68,0x13,0x48,0x13,0x6D,0x4C,0x5B,0xCF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0xDE,0x4D,0x73,0xEF,0x83,0x5C,0xF7,0xDA,0xE6,0x13,0xAD,0x0B,0x6B,0xAA,0x5A,0x89,0x5A,0x91,0x94,0x9E,0xFF,0xFF,0xFF,0xDE,0xFF,0x95,0xBD,0x89,0x5A,
-    0xDA,0xE6,0xAA,0x5A,0x68,0x5A,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x8D,0x7B,0x9E,0xFF,0x54,0xB5,0x70,0x94,0x95,0xBD,0xAA,0x62,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0xAA,0x62,0xF7,0xC5,0xFF,0xFF,0xDE,0xFF,0xF3,0xA4,0x50,0x94,0xD2,0xA4,0x89,0x5A,0x48,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xEF,0x8B,0x5C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x50,0x94,0x2C,0x73,0xD2,0xA4,0xA9,0x62,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x71,0x9C,0xBE,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xE7,0x6D,0x73,0x48,0x52,0x48,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0xA9,0x62,0xD6,0xC5,0x0F,0x8C,0xF3,0xA4,0x8D,0x7B,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x2B,0x6B,0xD6,0xC5,0xD7,0xC5,0xEE,0x8B,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0xAE,0x7B,0xFF,0xFF,0xFF,0xFF,0x1B,0xE7,0xCA,0x5A,0x74,0xB5,0x89,0x5A,0x89,0x5A,0xAD,0x83,0x0F,0x8C,0xB6,0xBD,0xBE,0xFF,0xDF,0xFF,0xFF,0xFF,0x3C,0xEF,0xEF,0x83,0xAD,0x7B,0x0F,0x84,0x9A,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xD9,0xB6,0xCB,0x2B,0x88,0x13,0x68,0x13,0xEB,0x33,0x3A,0xBF,0xFF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0x9E,0xFF,0x5D,0xFF,0x56,0xF5,0xA7,0x99,0x4A,0xBA,0x0D,0xC3,0xC7,0x91,0xA7,0x99,0x49,0xAA,0x0D,0xBB,0x72,0xD4,0x59,0xEE,0xBE,0xFF,0xFF,0xF7,0xDD,0xD7,0xCF,0x5C,0x48,0x13,0x68,0x13,0x48,0x1B,0xB4,0x85,0xFE,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xDE,0xEF,0x83,0xEB,0x62,0x69,0x52,0xCA,0x62,0xF3,0xA4,0x38,0xCE,0x5C,0xEF,0x91,0x94,0x38,0xCE,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0x75,0xB5,0xAA,0x5A,0xFB,0xE6,0x89,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x95,0xBD,0x9D,0xFF,0xEB,0x62,0x13,0xAD,0xEF,0x8B,0x48,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0xCE,0x83,
-    0x7D,0xF7,0xDF,0xFF,0x3C,0xEF,0x0B,0x6B,0x75,0xB5,0xAD,0x7B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xAA,0x62,0xD6,0xC5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xEF,0x4D,0x73,0x71,0x9C,0x8D,0x7B,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x4C,0x73,0xBA,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xD2,0xA4,0x69,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x50,0x94,0x54,0xB5,0x0B,0x6B,0xF7,0xCD,0x89,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,
-    0x68,0x5A,0x48,0x5A,0x68,0x52,0x68,0x5A,0x68,0x5A,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x58,0xCE,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xCE,0x7B,0xCE,0x83,0x74,0xB5,0x34,0xB5,0xD6,0xC5,0xB2,0x9C,0x75,0xB5,0x9D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xDE,0x3C,0xEF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0xD7,0xD0,0x64,0x68,0x13,0x68,0x0B,0xAA,0x23,0x15,0x8E,0xFE,0xE7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBF,0xFF,0x5D,0xFF,0x9A,0xFE,0xD4,0xEC,0x8F,0xD3,0x87,0xA9,0x86,0xB1,0x87,0xA9,0x87,0xA9,0x87,0xA1,0xF0,0xEB,0x11,0xD4,0xD0,0xB3,0x92,0xBC,0xBE,0xFF,
-    0xFF,0xFF,0xFF,0xEF,0x5A,0xBF,0xAB,0x33,0x68,0x13,0x68,0x13,0xAB,0x33,0x9B,0xC7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xF7,0xD7,0xBD,0x54,0xAD,0x0F,0x84,0xAA,0x5A,0xEF,0x83,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x54,0xB5,0xCA,0x62,0x1B,0xEF,0x68,0x52,0x68,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x0B,0x6B,0xB9,0xDE,0xD6,0xBD,0x2B,0x6B,0xB5,0xBD,0x0B,0x6B,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x54,0xB5,0xDF,0xFF,0xDF,0xFF,0x30,0x8C,0xEF,0x83,0xF3,0xA4,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xEF,0x83,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x75,0xB5,0x8E,0x7B,0x71,0x9C,0x89,0x5A,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x69,0x5A,0x13,0xAD,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x99,0xDE,0xA9,0x62,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x2B,0x73,0x17,0xCE,0x6C,0x73,0xB2,0xA4,0x2F,0x8C,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x2C,0x6B,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x79,0xD6,0x0B,0x6B,0xD2,0xA4,0x6C,0x73,0x0B,0x6B,
-    0x69,0x52,0xAE,0x7B,0xDB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xB7,0xA6,0xAA,0x2B,0x68,0x13,0x68,0x13,0xAF,0x54,0xDD,0xD7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x7D,0xFF,0xDB,0xEE,0x9E,0xFF,0xBF,0xFF,0xBE,0xFF,0x5D,0xFF,0xF8,0xF5,0x6E,0xB3,0x8B,0xAA,0xE8,0xA1,0x87,0xA9,0x86,0xB1,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x87,0xA9,0x6B,0xBA,0x11,0xD4,0x56,0xED,0x14,0xD5,0x1C,0xFF,0xDF,0xFF,0xFF,0xF7,0xFF,0xEF,0xD8,0xA6,0x69,0x1B,0x68,0x13,0x48,0x1B,0x10,0x65,0xFF,0xE7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x7D,0xEF,0xDA,0xDE,0x3C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xDE,0xFF,0x13,0xA5,0x0B,0x6B,0x3B,0xEF,0x68,0x52,0x68,0x52,0x68,0x52,0x68,0x5A,0x48,0x52,0x68,0x5A,0x70,0x94,0x7D,0xF7,0x6C,0x73,0x50,0x94,0x54,0xB5,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0xCA,0x62,0x5C,0xF7,0xDF,0xFF,0x99,0xD6,0xCA,0x5A,0xD6,0xC5,0x0B,0x6B,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x89,0x5A,0x17,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xEF,0x8E,0x7B,0x75,0xB5,0xCA,0x62,0x48,0x5A,0x48,0x5A,0x48,0x5A,
-    0x68,0x5A,0x48,0x5A,0x48,0x5A,0x2C,0x73,0xFB,0xE6,0xDE,0xFF,0xBE,0xFF,0x13,0xA5,0xCE,0x83,0x91,0x9C,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x74,0xB5,0x54,0xAD,0xAA,0x5A,0xD6,0xC5,0x0B,0x6B,0x68,0x5A,0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x89,0x5A,0x30,0x8C,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xEB,0x62,0x69,0x52,0xA9,0x5A,0x0F,0x8C,0x99,0xD6,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFF,0xEF,0xFF,0xEF,0xFF,0xE7,0xFE,0xE7,0xFE,0xDF,0xFD,0xCF,0x92,0x6D,0x48,0x13,0x68,0x0B,0x69,0x1B,0x97,0xA6,0xFF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xDF,0xFF,0x9E,0xFF,0x14,0xCD,0x09,0x7A,0xB7,0xED,0x3D,0xFF,0x15,0xDD,0x4A,0xA2,0x87,0x99,0x87,0xA1,0x87,0xA9,0x86,0xB1,0x86,0xB1,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB1,0x29,0xBA,0xF1,0xDB,0x8A,0x92,0xEC,0x92,0xD7,0xE5,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFE,0xE7,0x4D,0x44,0x48,0x13,0x68,0x13,0x68,0x1B,0xDC,0xBF,0xFE,0xDF,0xFE,0xE7,0xFE,0xE7,0xFF,0xEF,0xFF,0xEF,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xD3,0xA4,0x0B,0x6B,0xDA,0xE6,0x38,0xD6,0xCE,0x83,0x89,0x5A,0x68,0x52,0x68,0x52,0x89,0x5A,0x54,0xB5,0x79,0xDE,0xA9,0x5A,0x58,0xD6,0x4C,0x73,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,
-    0x68,0x5A,0x68,0x52,0x8D,0x7B,0x3C,0xEF,0x7D,0xF7,0xAE,0x7B,0xB6,0xC5,0x0B,0x6B,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x8D,0x7B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x75,0xB5,0x4C,0x73,0xB6,0xC5,0x68,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x68,0x52,0x33,0xAD,0xFF,0xFF,0xFF,0xFF,0x9A,0xD6,0x4C,0x73,0xF7,0xCD,0xCA,0x62,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0xB1,0x9C,0x3C,0xEF,0xEB,0x62,0xEF,0x8B,
-    0x54,0xB5,0x0B,0x6B,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0xCA,0x62,0x50,0x94,0x75,0xB5,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x95,0xB5,0x75,0xB5,0x5C,0xEF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFE,0xEF,0xFE,0xE7,0x9C,0xD7,0x5B,0xCF,0x19,0xBF,0xD9,0xB6,0xD8,0xAE,0xB8,0xA6,0x15,0x8E,0x93,0x7D,0xF0,0x64,0x6E,0x54,0x0C,0x44,0xCA,0x2B,0x89,0x1B,0x68,0x0B,0x48,0x13,0x0C,0x3C,0xFE,0xE7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDB,0xFE,0x2D,0xAB,0xE8,0x89,0xB8,0xFD,0x7A,0xFE,0x4A,0x9A,0x87,0xA1,0x86,0xB1,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x87,0xB1,
-    0xEC,0xC2,0xD4,0xF4,0x35,0xF5,0x10,0xB4,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xF8,0xA6,0x49,0x1B,0x68,0x13,0x88,0x13,0xAA,0x23,0xEC,0x3B,0x2D,0x4C,0xB0,0x5C,0x52,0x75,0xD4,0x8D,0x77,0x9E,0xB8,0xAE,0xD9,0xB6,0xF9,0xBE,0x3A,0xC7,0x9C,0xD7,0xDD,0xDF,0xFE,0xE7,0xFF,0xEF,0xFF,0xEF,0xFF,0xEF,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x34,0xAD,0xAA,0x5A,0x69,0x52,0xEF,0x83,0xF7,0xC5,0x17,0xC6,0xB1,0x9C,0xAD,0x7B,0xEE,0x83,0x1C,0xEF,0x71,0x94,0x8D,0x7B,0x38,0xD6,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x68,0x52,0x89,0x5A,0xEB,0x6A,0xEA,0x62,0x68,0x5A,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xEB,0x62,0x9D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xEF,0xAE,0x7B,0xB2,0xA4,0x0F,0x8C,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xEA,0x62,0x5C,0xEF,0xFF,0xFF,0xBE,0xFF,0x92,0x9C,0x8D,0x7B,0xD2,0xA4,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x4C,0x73,0x3B,0xEF,0xB6,0xBD,0xCA,0x5A,0xB2,0x9C,0x95,0xBD,0xCE,0x83,0x68,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x48,0x52,0x89,0x5A,0xEF,0x8B,0xF3,0xA4,0x0F,0x8C,0x99,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xEF,0xFE,0xEF,0xFE,0xE7,0xFD,0xD7,0x5A,0xBF,0xB7,0xA6,0x15,0x8E,0xB3,0x7D,
-    0xB3,0x75,0x71,0x65,0xCF,0x54,0x2D,0x3C,0xAA,0x2B,0x69,0x1B,0x49,0x1B,0x48,0x1B,0x68,0x13,0x68,0x13,0x68,0x13,0x68,0x13,0x68,0x13,0x88,0x0B,0x88,0x03,0x68,0x0B,0x28,0x1B,0xD8,0xA6,0xFF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0x56,0xF5,0xC8,0x91,0xC8,0xA1,0x4E,0xDB,0xAF,0xE3,0x87,0xA1,0x86,0xB1,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x87,0xB9,0x6A,0xCA,0x6A,0xB2,0xC8,0x89,0xEC,0x92,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9B,0xCF,0x6D,0x4C,0x68,0x13,0x88,0x03,0x88,0x0B,0x68,0x0B,0x68,0x13,0x68,0x13,0x68,0x13,0x48,0x13,0x48,0x13,0x48,0x1B,
-    0x69,0x1B,0x89,0x23,0x0C,0x34,0x8E,0x4C,0x30,0x5D,0x92,0x6D,0xB3,0x75,0xD4,0x7D,0x76,0x96,0x19,0xB7,0xBC,0xCF,0xFE,0xDF,0xFE,0xE7,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xEF,0x96,0xB5,0xB2,0x9C,0x0B,0x6B,0x69,0x52,0x8D,0x73,0x1B,0xE7,0x9D,0xF7,0x9A,0xD6,0xFB,0xE6,0x8D,0x73,0x38,0xCE,0xEF,0x8B,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x89,0x5A,0xB6,0xBD,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x95,0xBD,
-    0xAA,0x5A,0xD6,0xC5,0xA9,0x62,0x68,0x52,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x91,0x9C,0xDF,0xFF,0xFF,0xFF,0xDA,0xE6,0xCA,0x5A,0xF2,0xA4,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x89,0x5A,0xDA,0xE6,0x9E,0xFF,0x91,0x9C,0xCA,0x5A,0x0F,0x8C,0xBA,0xE6,0xD6,0xC5,0xCE,0x83,0xAA,0x62,0x69,0x5A,0x89,0x5A,0x2B,0x73,0xB1,0x9C,0x17,0xCE,0x34,0xAD,0x6C,0x73,0xF3,0xA4,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFF,0xEF,0xFF,0xEF,0xFE,0xDF,0x7B,0xCF,0x98,0xAE,0x93,0x85,0xD0,0x64,0x6E,0x54,0x4D,0x4C,0x0C,0x3C,0xCB,0x2B,0x69,0x23,0x68,0x13,0x68,0x13,0x68,0x13,0x88,0x13,0x68,0x0B,0x88,0x0B,0x88,0x0B,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x68,0x0B,0x6A,0x2B,0xFE,0xDF,0xFF,0xF7,0xDF,0xFF,
-    0xBE,0xFF,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0x7E,0xFF,0xEC,0xA2,0xC8,0x99,0x29,0xA2,0xA7,0x99,0x87,0xA9,0x66,0xB1,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB1,0x86,0xB1,0x86,0xB1,0xA7,0xA9,0xF0,0xD3,0x59,0xFE,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFE,0xE7,0x93,0x7D,0x68,0x13,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0x68,0x0B,0x68,0x0B,0x68,0x13,0x48,0x13,0x48,0x1B,0xAA,0x23,0xEB,0x33,0x2D,0x44,0x4D,0x4C,0x8F,0x5C,0x52,0x75,0x36,0x96,0x3A,0xBF,0xDD,0xDF,0xFF,0xE7,0xFF,0xEF,0xFF,0xEF,
-    0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xDA,0xDE,0xD6,0xBD,0xF3,0xA4,0x5C,0xEF,0xDF,0xFF,0xDE,0xFF,0x95,0xB5,0x6D,0x73,0x5C,0xF7,0xCE,0x83,0x68,0x52,
-    0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x68,0x52,0x91,0x9C,0x9D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBE,0xFF,0x0B,0x6B,0x8D,0x7B,0xB2,0xA4,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x1B,0xEF,0xDF,0xFF,0xDE,0xFF,0x50,0x8C,0xEA,0x62,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,
-    0xAA,0x5A,0xFB,0xE6,0xDE,0xFF,0x1C,0xE7,0xEF,0x83,0x69,0x52,0x89,0x5A,0x54,0xB5,0x3C,0xF7,0x9D,0xFF,0x9D,0xFF,0xBE,0xFF,0x3C,0xF7,0x74,0xB5,0x0B,0x6B,0x69,0x52,0x0F,0x84,0x7D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFF,0xE7,0xFE,0xDF,0xDC,0xC7,0x76,0x96,0x52,0x6D,0x4D,0x44,0x8A,0x2B,0x69,0x23,0x48,0x1B,0x69,0x1B,0x68,0x13,0x68,0x13,0x68,0x0B,0x88,0x0B,0x88,0x0B,0x88,0x0B,0x88,0x0B,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x68,0x13,0x8F,0x5C,0xFF,0xE7,0xFF,0xFF,0x7E,0xFF,0x96,0xDD,0xFC,0xFE,0xBE,0xFF,0xDF,0xFF,0xDF,0xFF,0xBA,0xF6,0xE8,0x79,0x8F,0xBB,0x9B,0xFE,0x35,0xF5,0x87,0xA1,0x86,0xB1,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,
-    0x86,0xB9,0x86,0xB1,0x87,0xA9,0x87,0xA9,0x87,0xB1,0xA7,0xA1,0xF8,0xFD,0x7E,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xEF,0x15,0x96,0x89,0x1B,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0x88,0x0B,0x88,0x0B,0x88,0x13,0x68,0x0B,0x68,0x13,0x68,0x13,0x48,0x13,0x49,0x1B,0x69,0x23,0xEC,0x33,0xEF,0x5C,0xF4,0x85,0x7A,0xB7,0xFE,0xDF,0xFE,0xE7,0xFE,0xEF,0xFE,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0x91,0x94,0x89,0x5A,0xEF,0x83,0x79,0xD6,0xDA,0xE6,0x0F,0x8C,0x69,0x52,0x68,0x52,0x48,0x5A,0x48,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xCE,0x83,0x3B,0xE7,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDA,0xDE,0xEA,0x62,0xB2,0xA4,0xEB,0x6A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0x68,0x5A,0x6D,0x73,0xBA,0xDE,0x5C,0xEF,0x58,0xD6,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0xCE,0x83,0x5C,0xEF,0xFF,0xFF,0xDF,0xFF,0x5C,0xEF,0x30,0x8C,0xAA,0x62,0x48,0x52,0xA9,0x5A,0x2C,0x6B,0x8D,0x7B,0x2C,0x6B,0x89,0x5A,0x69,0x52,0x2C,0x6B,0xF3,0xA4,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFF,0xEF,0xDD,0xDF,0x5B,0xCF,0x3A,0xBF,0xD9,0xAE,0x32,0x75,0x4E,0x54,0xAA,0x33,0x49,0x23,0x28,0x13,0x68,0x13,0x68,0x13,0x88,0x0B,0x68,0x0B,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,
-    0x88,0x03,0x88,0x03,0x88,0x0B,0x88,0x0B,0x88,0x03,0x88,0x03,0x68,0x0B,0x68,0x13,0x68,0x13,0x48,0x13,0x68,0x13,0x48,0x13,0x89,0x1B,0xEA,0x23,0x2B,0x2C,0xA9,0x1B,0x88,0x03,0xA8,0x03,0xA8,0x03,0x68,0x13,0x77,0x9E,0xFF,0xEF,0xDF,0xFF,0x38,0xDE,0xAB,0x8A,0xAB,0x8A,0x9A,0xF6,0xBE,0xFF,0xBE,0xFF,0x3D,0xFF,0xAF,0xAB,0xB7,0xF5,0x5D,0xFF,0x96,0xF5,0x87,0xA1,0x66,0xB9,0x66,0xB9,0x86,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x86,0xB9,0x66,0xB9,0x86,0xB1,0x87,0xA9,0xEC,0xC2,0xD4,0xFC,0x87,0xA9,0x87,0xA1,0x31,0xDC,0x18,0xFE,0xDB,0xFE,0x9E,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0xF9,0xB6,0x0B,0x34,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,
-    0x88,0x03,0x88,0x0B,0x68,0x13,0x68,0x13,0x88,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x68,0x0B,0x68,0x13,0x48,0x1B,0x29,0x1B,0x6A,0x2B,0xEC,0x43,0xD0,0x64,0x56,0x9E,0x19,0xBF,0x3A,0xC7,0x9C,0xD7,0xFE,0xE7,0xFF,0xEF,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xB6,0xB5,0x8E,0x7B,0xEB,0x62,0x89,0x52,0xAD,0x7B,0xF6,0xC5,0x17,0xCE,0x91,0x9C,0x2C,0x73,0x89,0x5A,0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xAE,0x7B,0xFB,0xE6,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x51,0x94,0xCE,0x83,0x0F,0x8C,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x0B,0x6B,0xEE,0x8B,0xEA,0x62,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x33,0xAD,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xB6,0xBD,0x91,0x9C,0x8D,0x73,0x89,0x52,0x69,0x52,0x0B,0x6B,0x70,0x94,0x13,0xA5,0xFB,0xE6,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xEF,0xFE,0xE7,0xFE,0xDF,0x19,0xB7,0x15,0x8E,0x14,0x86,0x31,0x65,0xEC,0x33,0x8A,0x23,0x69,0x1B,0x68,0x13,0x68,0x13,0x68,0x0B,0x68,0x0B,0x88,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0x68,0x0B,0x68,0x13,0x68,0x13,0x48,0x1B,0x48,0x1B,0x48,0x13,0xA9,0x23,0xAE,0x4C,0x10,0x65,0x31,0x6D,0x31,0x6D,0x52,0x75,0x52,0x75,0x14,0x8E,0x18,0xA7,0x9A,0xB7,0xCF,0x54,0x88,0x0B,0xA8,0x03,0x88,0x03,0x48,0x13,
-    0xF9,0xB6,0xFF,0xF7,0xFF,0xFF,0x3C,0xFF,0xCF,0xB3,0xE8,0x81,0xEB,0xA2,0x59,0xFE,0x9E,0xFF,0x9E,0xFF,0x7E,0xFF,0x7E,0xFF,0x7D,0xFF,0x93,0xDC,0x87,0xA1,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x86,0xB1,0x87,0xA9,0xEC,0xC2,0x9A,0xFE,0xF8,0xFD,0xA7,0xA9,0x86,0xB1,0x87,0xA1,0xC8,0x99,0xEC,0xB2,0x96,0xED,0x7D,0xFF,0xDF,0xFF,0xFF,0xFF,0x9C,0xD7,0x6D,0x44,0x88,0x0B,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x0B,0xEA,0x23,0x10,0x65,0x71,0x6D,0x6C,0x3C,0x88,0x13,0x88,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x68,0x13,0x48,0x13,0x68,0x0B,0x88,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,
-    0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0x68,0x0B,0x68,0x0B,0x68,0x13,0x68,0x13,0x48,0x13,0x89,0x23,0xAB,0x2B,0x8E,0x4C,0xD3,0x7D,0x15,0x8E,0x56,0x9E,0xBC,0xCF,0xFE,0xE7,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0x9E,0xF7,0x38,0xCE,0xB2,0x9C,0x6D,0x73,0x68,0x52,0x0B,0x6B,0x33,0xAD,0x54,0xB5,0x13,0xAD,0x71,0x9C,0x2C,0x73,0x68,0x52,0x48,0x52,0x48,0x52,0x48,0x5A,0x48,0x52,0x68,0x52,0xEB,0x62,0x71,0x94,0x3C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xDE,0x4C,0x73,0xD2,0xA4,0xEA,0x6A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,
-    0x48,0x5A,0x68,0x5A,0x68,0x5A,0x0B,0x6B,0x58,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xFB,0xE6,0x37,0xCE,0x17,0xCE,0xBA,0xDE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFE,0xE7,0x9C,0xCF,
-    0x93,0x85,0xAF,0x5C,0xAF,0x54,0xEB,0x33,0x69,0x1B,0x68,0x13,0x68,0x13,0x88,0x0B,0x88,0x0B,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x0B,0x88,0x03,0x68,0x03,0x68,0x0B,0x68,0x13,0x68,0x13,0x69,0x1B,0x69,0x1B,0x89,0x23,0xEF,0x4C,0x75,0x86,0xB6,0x96,0xB7,0x96,0xEF,0x54,0x6D,0x4C,0xBB,0xBF,0xFD,0xCF,0xFC,0xC7,0x5A,0xBF,0xFE,0xE7,0x5B,0xCF,0x6F,0x64,0x35,0x96,0xFE,0xD7,0x31,0x65,0x88,0x13,0xA8,0x03,0x88,0x03,0x69,0x1B,0x3A,0xBF,0xFF,0xF7,0xFF,0xFF,0xBE,0xFF,0xBB,0xFE,0x0C,0xAB,0xC7,0x89,0x6E,0xC3,0x18,0xFE,0xD4,0xD4,0xF0,0xBB,0x55,0xED,0x7A,0xFE,0x0D,0xBB,0x87,0xA9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,
-    0x66,0xB9,0x86,0xB9,0x66,0xB9,0x86,0xA9,0xC7,0xA1,0x15,0xF5,0x1C,0xFF,0x4E,0xB3,0x87,0xA1,0x87,0xA9,0x87,0xA1,0xA7,0xA1,0x87,0x99,0x8A,0xA2,0x79,0xF6,0xDE,0xFF,0xFF,0xFF,0xDD,0xDF,0x8E,0x4C,0x88,0x0B,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x68,0x13,0xCF,0x54,0xFD,0xD7,0xFE,0xDF,0xB7,0x96,0x68,0x1B,0x88,0x0B,0xA8,0x03,0x88,0x03,0xCA,0x13,0xF2,0x65,0x54,0x7E,0xCF,0x54,0x69,0x23,0x69,0x1B,0x68,0x13,0x88,0x0B,0x68,0x03,0x88,0x0B,0x88,0x13,0x68,0x0B,0x88,0x0B,0xA8,0x0B,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0x88,0x0B,0x68,0x13,0x48,0x13,0x69,0x1B,0x8A,0x23,0x6D,0x4C,0xAF,0x5C,0xB0,0x64,0x5B,0xC7,0xFD,0xDF,
-    0xFE,0xE7,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xDB,0xE6,0xF6,0xC5,0x6D,0x73,0x89,0x5A,0xCA,0x62,0xCE,0x83,0xEF,0x83,0xD2,0xA4,0xB6,0xBD,0xD6,0xC5,0x54,0xB5,0x13,0xAD,0x91,0x9C,0x95,0xBD,0x99,0xD6,0xBE,0xFF,0xDF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x13,0xA5,0x0F,0x8C,0xB2,0xA4,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x0B,0x6B,0x38,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFE,0xE7,0xFC,0xCF,0x19,0xA7,0x6E,0x4C,0xAA,0x2B,0xAA,0x23,0x69,0x1B,0x48,0x13,0x68,0x13,0x88,0x0B,0x88,0x0B,0x88,0x0B,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x68,0x0B,0x68,0x13,0x68,0x13,0x48,0x13,0x68,0x13,0x89,0x1B,0xEB,0x33,0x10,0x65,
-    0x5A,0xB7,0xDC,0xCF,0xFC,0xC7,0xDB,0xBF,0xBB,0xB7,0xBB,0xBF,0xFD,0xCF,0xFE,0xDF,0x35,0x8E,0x6E,0x54,0xFD,0xCF,0x56,0x96,0x6A,0x33,0xF0,0x64,0xFE,0xE7,0x5B,0xC7,0x29,0x23,0xCB,0x33,0xB7,0x9E,0x71,0x6D,0x88,0x13,0xA8,0x03,0x88,0x03,0x89,0x23,0x5B,0xC7,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xBE,0xFF,0xBB,0xFE,0x29,0xA2,0xA7,0xA9,0xE8,0xA9,0xA7,0xA1,0x87,0xA1,0xA7,0xA9,0xE8,0xA9,0x87,0xA9,0x66,0xB1,0x66,0xB9,0x86,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x86,0xB1,0x87,0xA1,0xCB,0xB2,0x39,0xFE,0xBB,0xFE,0xE8,0x91,0xA7,0xA1,0x29,0xB2,0xD4,0xF4,0xAB,0xAA,0xA7,0xA1,0xA7,0x99,0xB3,0xCC,0xBE,0xFF,0xFF,0xFF,0xFE,0xDF,0x8E,0x4C,0x68,0x0B,
-    0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x0B,0xAA,0x2B,0x18,0xAF,0xFD,0xDF,0xFE,0xE7,0xDC,0xC7,0x49,0x23,0x88,0x0B,0xA8,0x03,0x88,0x03,0xEA,0x1B,0x75,0x86,0xDC,0xC7,0xFD,0xD7,0xBC,0xCF,0xF8,0xA6,0x0C,0x3C,0x68,0x13,0xCA,0x23,0x0C,0x3C,0xAA,0x33,0x69,0x23,0x49,0x1B,0x68,0x13,0x88,0x13,0x88,0x0B,0x88,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0x88,0x0B,0x88,0x13,0x68,0x13,0x68,0x13,0xAA,0x23,0x8A,0x23,0xEB,0x3B,0x35,0x8E,0x9B,0xC7,0xFE,0xDF,0xFE,0xE7,0xFF,0xEF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0x5C,0xEF,0x75,0xB5,0x2C,0x6B,0xAA,0x5A,0x89,0x5A,0xCA,0x62,0xCA,0x62,0x2C,0x6B,0x92,0x9C,0xBE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0xD6,0x4C,0x73,0xD6,0xC5,0x0F,0x8C,0x89,0x5A,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x68,0x5A,0x6D,0x7B,0x54,0xB5,0x79,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xDE,0xDF,0x9C,0xD7,0xF9,0xB6,0xF5,0x8D,0x2D,0x4C,0x28,0x23,0x48,0x1B,0x68,0x13,0x68,0x0B,0x88,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x0B,0x68,0x0B,0x68,0x13,0x68,0x13,0x88,0x13,0x88,0x13,0xEA,0x23,0x2C,0x3C,0xCE,0x54,0x71,0x65,0xB6,0x86,0x74,0x76,0x69,0x1B,0xB6,0x8E,0x19,0xA7,0xFE,0xE7,0xFE,0xDF,0xD0,0x6C,0x09,0x2B,0x09,0x33,0x4A,0x3B,0x6B,0x43,0x9B,0xC7,0x59,0xAF,0x6E,0x54,0xBB,0xBF,0x0D,0x4C,0x28,0x23,0xAF,0x54,0xFE,0xDF,0xBC,0xD7,0x69,0x23,0x68,0x1B,0xB2,0x6D,0x91,0x65,
-    0x88,0x13,0xA8,0x03,0x88,0x03,0x89,0x23,0x5B,0xC7,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0x9E,0xFF,0xD7,0xFD,0xC8,0xA1,0x86,0xB1,0x86,0xB1,0x66,0xB9,0x66,0xB1,0x66,0xB1,0x66,0xB9,0x66,0xB1,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB1,0x86,0xB1,0x86,0xA9,0x86,0xA1,0xC8,0xA9,0x4A,0xA2,0x51,0xC4,0xDC,0xFE,0x56,0xF5,0xA7,0x89,0xA7,0xA1,0x93,0xFC,0xFC,0xFE,0x7A,0xFE,0x87,0xA1,0xA7,0x99,0xF0,0xBB,0x9E,0xFF,0xFF,0xFF,0xFE,0xDF,0x8E,0x4C,0x68,0x0B,0x88,0x03,0x88,0x03,0x88,0x03,0x68,0x13,0x8E,0x54,0xFD,0xD7,0x12,0x85,0x3A,0xC7,0xFE,0xDF,0x2D,0x4C,0x68,0x13,0xA8,0x03,0xA8,0x03,0x88,0x13,0x29,0x1B,0xB3,0x85,0xFE,0xE7,0xBD,0xE7,0xFE,0xDF,0x31,0x75,
-    0x48,0x1B,0x71,0x5D,0xBB,0xB7,0xFE,0xD7,0xFD,0xCF,0x18,0x97,0x0F,0x55,0x0B,0x2C,0x6C,0x3C,0xEA,0x2B,0xCA,0x23,0x89,0x1B,0x68,0x13,0x68,0x0B,0x68,0x0B,0x88,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0x68,0x13,0x48,0x13,0x28,0x1B,0x6A,0x2B,0x52,0x75,0x97,0xA6,0x5B,0xC7,0xDD,0xDF,0xFE,0xE7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDE,0xFF,0xBE,0xFF,0x3C,0xEF,0xBE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xF3,0xA4,0xCA,0x62,0xF6,0xC5,0xD2,0xA4,0xEA,0x62,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,
-    0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0xEA,0x62,0x50,0x94,0x13,0xAD,0xB2,0x9C,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xEF,0xFE,0xE7,0xBC,0xCF,0xF9,0xAE,0x35,0x8E,0x31,0x65,0x2C,0x3C,0x49,0x1B,0x68,0x13,0x68,0x13,0x88,0x0B,
-    0x88,0x0B,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x68,0x0B,0x69,0x1B,0xEB,0x33,0x6E,0x4C,0x10,0x65,0xB2,0x75,0xCB,0x33,0x55,0x86,0xBB,0xC7,0xFE,0xDF,0xDB,0xBF,0x14,0x7E,0xAD,0x3C,0x68,0x13,0x68,0x13,0x49,0x23,0xBC,0xCF,0xFE,0xE7,0xB0,0x64,0x09,0x2B,0x4E,0x54,0xB3,0x7D,0x49,0x2B,0xD3,0x75,0x79,0xA7,0x0C,0x3C,0x96,0x8E,0xEB,0x33,0x48,0x1B,0x6E,0x4C,0xDD,0xDF,0xFE,0xDF,0x49,0x23,0x68,0x13,0xEA,0x23,0x2B,0x24,0xA8,0x03,0xA8,0x03,0x88,0x03,0x69,0x1B,0x3A,0xBF,0xFF,0xF7,0xFF,0xFF,0xBE,0xFF,0xF8,0xFD,0x08,0x9A,0x86,0xA9,0x66,0xB1,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,
-    0x66,0xB9,0x86,0xB1,0x87,0xA9,0xA7,0xA1,0x49,0xA2,0x4E,0xBB,0xB3,0xD4,0x39,0xF6,0x7E,0xFF,0x7E,0xFF,0xF8,0xFD,0xA7,0x89,0xA7,0xA1,0x4E,0xDB,0x97,0xFD,0xB3,0xFC,0x87,0xA9,0xA7,0x99,0x71,0xC4,0x9E,0xFF,0xFF,0xFF,0xDD,0xDF,0x8E,0x4C,0x68,0x0B,0x88,0x03,0x88,0x03,0x88,0x0B,0x69,0x1B,0x39,0xB7,0xF9,0xB6,0x8C,0x4B,0xF9,0xB6,0xFE,0xDF,0x93,0x7D,0x48,0x13,0x88,0x03,0x88,0x03,0x88,0x0B,0x28,0x1B,0x35,0x8E,0xFE,0xDF,0x12,0x8D,0xFE,0xE7,0xB8,0xAE,0xAA,0x2B,0x28,0x1B,0x2D,0x4C,0x9B,0xBF,0x39,0xAF,0x92,0x6D,0x50,0x55,0x0F,0x55,0x59,0xAF,0x9A,0xBF,0x97,0x9E,0xF4,0x85,0x31,0x6D,0xAF,0x54,0x0B,0x34,0x69,0x1B,0x88,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,
-    0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0x68,0x0B,0x68,0x13,0x68,0x13,0x48,0x1B,0xAA,0x2B,0xEF,0x54,0xD3,0x7D,0x97,0x9E,0x5B,0xC7,0xFE,0xE7,0xFF,0xEF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xEF,0x4D,0x73,0xCA,0x62,0x54,0xAD,0xF6,0xC5,0xEE,0x83,0x48,0x52,0x68,0x52,0x68,0x52,0x68,0x52,0x48,0x52,0xAA,0x5A,0x71,0x9C,0xB6,0xBD,0x91,0x9C,0x0B,0x6B,0x58,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xEF,0xFF,0xEF,0xDD,0xDF,0x56,0x9E,0x11,0x6D,0x8E,0x54,0xCB,0x33,0x48,0x1B,0x68,0x13,0x68,0x0B,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0x88,0x0B,0x68,0x0B,0x68,0x0B,0x68,0x13,0x68,0x0B,0x88,0x0B,0x68,0x0B,0x2B,0x2C,0x54,0x76,0x18,0xA7,0xBC,0xC7,0xDC,0xCF,0xF4,0x8D,0x8A,0x33,0x4E,0x4C,0x98,0xAE,0xDC,0xCF,0xF0,0x64,0x48,0x1B,
-    0x68,0x0B,0x88,0x0B,0x88,0x0B,0x49,0x1B,0x77,0x9E,0xFE,0xE7,0x52,0x75,0x2A,0x33,0x56,0x9E,0xF8,0xA6,0xEB,0x33,0xCB,0x2B,0x6D,0x44,0x69,0x23,0xEB,0x2B,0x89,0x1B,0x68,0x13,0x4D,0x44,0x9C,0xCF,0xFE,0xDF,0x69,0x23,0x68,0x0B,0x88,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x48,0x1B,0xF9,0xB6,0xFF,0xF7,0xFF,0xFF,0x5D,0xFF,0x4D,0xBB,0x87,0xA1,0x66,0xB1,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB1,0x86,0xB1,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x87,0xB1,0x87,0xA1,0xCC,0xBA,0xB3,0xE4,0xD7,0xF5,0x1C,0xFF,0x9E,0xFF,0xBE,0xFF,0xDF,0xFF,0xBE,0xFF,0x3D,0xFF,0x6A,0x92,0xA7,0x99,0xA7,0xA1,0x6A,0xB2,0xE8,0xA1,0x87,0x99,0xE8,0x99,0xD7,0xED,0xBE,0xFF,
-    0xFF,0xFF,0x9C,0xD7,0x4D,0x44,0x68,0x0B,0xA8,0x03,0x88,0x0B,0x48,0x13,0xEF,0x54,0xFE,0xD7,0xD5,0x95,0x0A,0x33,0xB4,0x8D,0xFE,0xE7,0x97,0xA6,0x69,0x1B,0x88,0x03,0x88,0x03,0x88,0x0B,0x28,0x1B,0x96,0x96,0xFE,0xD7,0x6C,0x4B,0xFA,0xC6,0xFE,0xDF,0x6D,0x4C,0x28,0x1B,0x6E,0x5C,0xFD,0xCF,0x72,0x6D,0x28,0x23,0x48,0x1B,0x89,0x23,0x8F,0x64,0xFE,0xDF,0xFD,0xD7,0x15,0x96,0x35,0x8E,0x59,0xA7,0x39,0xA7,0x34,0x7E,0x2C,0x34,0x68,0x13,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0x88,0x13,0x68,0x13,0xAA,0x23,0x4D,0x44,0xF0,0x64,0xB4,0x85,0x5B,0xC7,0xFE,0xE7,0xFF,0xEF,
-    0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xEF,0x69,0x52,0xAA,0x5A,0x71,0x94,0xDA,0xE6,0x1B,0xEF,0x37,0xCE,0x13,0xAD,0x54,0xB5,0x99,0xDE,0xFB,0xE6,0xB6,0xBD,0x4C,0x73,0x89,0x5A,0x75,0xB5,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFE,0xDF,0xD8,0xA6,0x8E,0x54,0xCB,0x33,0xAA,0x23,0x69,0x13,0x68,0x0B,0x88,0x0B,0x88,0x0B,0x88,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0x68,0x0B,0x68,0x13,0x48,0x1B,0x49,0x23,0xEC,0x3B,0x31,0x6D,0x6D,0x4C,0x48,0x1B,0x48,0x13,0xCA,0x1B,0xAD,0x44,0x2D,0x4C,0xFE,0xDF,0xDD,0xCF,0x6F,0x5C,0x09,0x2B,0x4D,0x4C,0xFC,0xCF,0x72,0x75,0x69,0x1B,0x88,0x0B,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x68,0x13,0xB0,0x64,0xFE,0xE7,0xDD,0xD7,0x7B,0xCF,0xFE,0xDF,0xBB,0xC7,0x8D,0x44,0x48,0x1B,0x49,0x23,0x69,0x23,0x68,0x13,0x88,0x0B,0x88,0x0B,0x4C,0x3C,0x5B,0xC7,0xFE,0xE7,
-    0x49,0x23,0x68,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x68,0x13,0x97,0xA6,0xFE,0xEF,0xDF,0xFF,0x38,0xF6,0x4A,0xAA,0x66,0xA9,0x66,0xB1,0x86,0xB9,0x86,0xB1,0x87,0xA9,0xA7,0xA1,0xA7,0xA9,0x86,0xB1,0x66,0xB9,0x66,0xB9,0x86,0xB1,0x09,0xAA,0x76,0xFD,0xDB,0xFE,0x7E,0xFF,0xBF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBE,0xFF,0xD7,0xED,0x09,0x92,0xA7,0x99,0xA7,0x99,0xA7,0x99,0xC8,0x91,0x31,0xCC,0x3D,0xFF,0xDF,0xFF,0xFF,0xF7,0x1A,0xBF,0x0C,0x34,0x88,0x0B,0x88,0x03,0x68,0x0B,0x69,0x23,0x7A,0xB7,0xFE,0xDF,0xDD,0xD7,0x9B,0xC7,0xDD,0xD7,0xFF,0xEF,0x19,0xB7,0xCB,0x2B,0x88,0x0B,0x88,0x03,0x68,0x0B,0x8A,0x2B,0xF8,0x9E,
-    0xFE,0xD7,0x09,0x33,0x52,0x85,0xFE,0xDF,0xF8,0xA6,0x29,0x2B,0xB0,0x6C,0xFE,0xD7,0xAE,0x4C,0x48,0x13,0x88,0x13,0x48,0x1B,0xAF,0x64,0xFE,0xDF,0x9B,0xC7,0x8A,0x33,0x89,0x23,0xCB,0x2B,0xF0,0x5C,0xFD,0xCF,0x59,0xAF,0xCB,0x33,0x68,0x0B,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x0B,0x88,0x13,0x68,0x13,0x69,0x1B,0xAA,0x2B,0x0C,0x3C,0xF4,0x85,0xFD,0xCF,0xFE,0xE7,0xFF,0xEF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xEF,0x2C,0x6B,0x69,0x52,
-    0x69,0x52,0x0F,0x8C,0xD6,0xC5,0x79,0xD6,0x37,0xCE,0xB1,0x9C,0xCA,0x62,0x89,0x5A,0xEB,0x62,0xF7,0xC5,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFE,0xE7,0xBD,0xD7,0x19,0xB7,0x11,0x6D,0x29,0x23,0x48,0x1B,0x68,0x13,0x68,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,
-    0x88,0x0B,0xA9,0x13,0xAA,0x23,0xEB,0x33,0x0F,0x5D,0xD7,0x96,0xFC,0xC7,0xFC,0xC7,0xFD,0xD7,0xFE,0xDF,0x18,0x9F,0x69,0x1B,0x68,0x13,0x68,0x13,0x08,0x23,0xBC,0xC7,0xFE,0xE7,0xB0,0x6C,0x4A,0x3B,0xFD,0xCF,0xB8,0xA6,0x8A,0x3B,0x48,0x13,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x68,0x13,0x4E,0x54,0xFE,0xE7,0x7B,0xCF,0x0D,0x5C,0xF1,0x74,0xFC,0xC7,0xCE,0x54,0x49,0x23,0xFC,0xBF,0xAE,0x4C,0x68,0x0B,0x88,0x03,0x68,0x0B,0xCA,0x2B,0xB8,0xAE,0xFE,0xE7,0x0C,0x44,0x48,0x1B,0x68,0x0B,0xA8,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0x68,0x13,0xAF,0x5C,0xFE,0xEF,0xDE,0xFF,0x56,0xDD,0x08,0xAA,0x66,0xB1,0x66,0xB9,0x66,0xB9,0x87,0xA9,0x11,0xF4,0x5A,0xFE,0x8F,0xDB,
-    0x87,0xA9,0x86,0xB9,0x66,0xB9,0x87,0xB1,0xC8,0x99,0x39,0xFE,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0x9E,0xFF,0x39,0xFE,0xAF,0xC3,0xAB,0xAA,0x0C,0xB3,0x56,0xED,0x5E,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,0xF7,0x15,0x96,0x89,0x1B,0x88,0x0B,0x68,0x0B,0x68,0x13,0xCF,0x5C,0xFD,0xD7,0x53,0x7D,0x2A,0x3B,0xCC,0x4B,0x8F,0x64,0xDD,0xE7,0xBC,0xD7,0xCF,0x54,0x48,0x13,0x88,0x0B,0x68,0x0B,0x0C,0x3C,0x7A,0xB7,0xDB,0xBF,0x08,0x23,0x4E,0x54,0x9B,0xC7,0xFE,0xDF,0x2A,0x3B,0xF1,0x74,0xFC,0xCF,0x2C,0x3C,0x68,0x0B,0x88,0x0B,0x48,0x13,0xF4,0x8D,0xFE,0xDF,0x7A,0xB7,0x49,0x23,0x68,0x13,0x68,0x13,0x49,0x23,0x56,0x96,
-    0xFE,0xDF,0x93,0x7D,0x48,0x13,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0x88,0x0B,0x68,0x13,0x88,0x13,0x89,0x1B,0x89,0x1B,0x88,0x13,0x68,0x0B,0x88,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x68,0x03,0x68,0x13,0x48,0x1B,0x29,0x23,0x2D,0x4C,0x36,0x9E,0x9C,0xCF,0xFE,0xE7,0xFE,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xE7,0x92,0x9C,0x4C,0x73,0x69,0x52,0x69,0x52,0x69,0x52,0x68,0x52,0x89,0x5A,0x6D,0x73,0xB2,0x9C,0xDB,0xE6,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFE,0xE7,0x5B,0xBF,0xB7,0x9E,0x92,0x6D,0x0C,0x3C,0x49,0x1B,0x68,0x13,0x68,0x0B,0x88,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x0B,0x2C,0x13,0x76,0x39,0xAF,0xFD,0xD7,0xDC,0xC7,0xD3,0x7D,0x8E,0x4C,0xEB,0x3B,0x32,0x75,0xFD,0xCF,0xFD,0xCF,0x2C,0x44,0x68,0x13,0x88,0x0B,0x49,0x1B,0x35,0x8E,0xFF,0xE7,0x95,0x9D,0x3B,0xCF,0xFE,0xE7,
-    0xFD,0xDF,0xB4,0x8D,0x8A,0x2B,0x68,0x13,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x68,0x13,0x4D,0x4C,0xFE,0xD7,0xDC,0xCF,0x2A,0x3B,0x8A,0x33,0x55,0x86,0x8D,0x44,0xAA,0x33,0xFD,0xCF,0x72,0x6D,0x68,0x13,0x88,0x0B,0x68,0x13,0xAA,0x33,0x57,0xA6,0xFE,0xE7,0xD4,0x8D,0x4D,0x44,0xCA,0x23,0x88,0x0B,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x13,0x6A,0x2B,0xFE,0xE7,0xDE,0xFF,0x35,0xDD,0xE8,0xA9,0x86,0xB1,0x86,0xB9,0x86,0xB1,0xA7,0xA9,0xD8,0xFD,0xFC,0xFE,0x92,0xEC,0x86,0xA9,0x86,0xB9,0x66,0xB9,0x86,0xA9,0xA7,0x91,0x39,0xFE,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBE,0xFF,0x9E,0xFF,0x7E,0xFF,0x9E,0xFF,
-    0xBF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFE,0xE7,0x92,0x7D,0x68,0x13,0x88,0x0B,0x89,0x1B,0xEF,0x54,0x19,0xB7,0xFE,0xDF,0x6F,0x5C,0xAB,0x3B,0x49,0x2B,0x29,0x2B,0xD9,0xBE,0xFE,0xE7,0x92,0x75,0x48,0x1B,0x68,0x0B,0x68,0x13,0x6E,0x54,0xBB,0xBF,0xB2,0x75,0x29,0x23,0x49,0x2B,0x56,0x96,0xFE,0xDF,0x78,0xB6,0x94,0x95,0x39,0xB7,0x0B,0x34,0x88,0x0B,0x88,0x0B,0x69,0x1B,0x97,0xA6,0xFE,0xE7,0xD7,0x9E,0x48,0x1B,0x88,0x0B,0x68,0x0B,0x48,0x1B,0xF0,0x5C,0xFF,0xE7,0x9B,0xC7,0x48,0x1B,0x68,0x03,0x88,0x03,0x88,0x03,0x68,0x0B,0x89,0x1B,0x6D,0x4C,0x92,0x75,0x35,0x8E,0x14,0x86,0x51,0x65,0x2C,0x3C,0x68,0x1B,0x68,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,
-    0xA8,0x03,0x88,0x03,0x88,0x03,0x68,0x03,0x68,0x0B,0x68,0x13,0x48,0x1B,0x8A,0x2B,0xCF,0x54,0x35,0x8E,0xF9,0xB6,0xDD,0xDF,0xFF,0xEF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xF7,0x9A,0xDE,0x75,0xB5,0xF3,0xAC,0xF3,0xA4,0x33,0xAD,0x96,0xBD,0xFB,0xE6,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFE,0xDF,0x36,0x9E,0x52,0x6D,0x2D,0x44,0x89,0x23,0x48,0x13,0x68,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x68,0x0B,0x68,0x13,0x68,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,0x88,0x0B,0x4C,0x34,0x92,0x6D,0xB4,0x8D,0xFE,0xE7,0x9B,0xCF,0x6A,0x3B,0x28,0x23,0x28,0x23,0x4A,0x3B,0x5A,0xBF,0xFD,0xCF,0xEC,0x3B,0x88,0x13,0x88,0x03,0x68,0x13,0x31,0x65,0xFF,0xE7,0xBE,0xE7,0xFE,0xE7,0x73,0x8D,0x9C,0xD7,0xFD,0xD7,0x56,0x8E,0x6A,0x23,0x68,0x13,0x88,0x0B,0x88,0x03,0x68,0x13,0xEC,0x43,0xBC,0xC7,0xFE,0xDF,0x8B,0x43,0x08,0x23,0x8A,0x2B,0x6A,0x2B,0xD3,0x7D,0xFE,0xDF,0x55,0x8E,0x68,0x13,0x88,0x0B,
-    0x4C,0x2C,0x96,0x8E,0xBB,0xC7,0xFE,0xDF,0xFD,0xCF,0xF7,0x96,0xAD,0x3C,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x0B,0x48,0x1B,0xD8,0xAE,0xFE,0xFF,0x96,0xE5,0x09,0xAA,0x87,0xB1,0x66,0xB9,0x86,0xB1,0x87,0xA9,0x2D,0xD3,0x31,0xE4,0xCC,0xBA,0x86,0xA9,0x66,0xB9,0x86,0xB9,0x86,0xA9,0xE8,0x91,0x59,0xFE,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9B,0xCF,0x8E,0x4C,0x68,0x13,0x88,0x0B,0xCA,0x23,0x75,0x86,0x5A,0xB7,0xFD,0xCF,0x79,0xAF,0xF3,0x75,0xEF,0x4C,0x34,0x7E,0x7B,0xC7,0xFE,0xDF,0x39,0xAF,0x71,0x65,
-    0x68,0x13,0x89,0x23,0xD0,0x64,0xFD,0xCF,0x4D,0x4C,0x08,0x1B,0x49,0x1B,0xEF,0x5C,0xDD,0xD7,0xFE,0xE7,0x1B,0xCF,0x97,0xA6,0xCA,0x23,0x88,0x0B,0x88,0x0B,0xAA,0x2B,0xD9,0xB6,0xFE,0xE7,0x71,0x6D,0x68,0x13,0x88,0x0B,0x88,0x0B,0x48,0x1B,0x11,0x65,0xFF,0xE7,0xDD,0xD7,0x48,0x1B,0x88,0x0B,0xA8,0x03,0x88,0x0B,0x48,0x1B,0x72,0x6D,0x9B,0xBF,0xFE,0xD7,0x97,0x9E,0xF4,0x85,0xF8,0xA6,0x39,0xA7,0xAE,0x54,0x91,0x65,0xAD,0x3C,0x88,0x03,0x88,0x03,0x88,0x0B,0x88,0x0B,0x88,0x0B,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0x88,0x03,0x68,0x0B,0x68,0x13,0x69,0x1B,0xEB,0x33,0xF0,0x64,0xB4,0x85,0x3A,0xBF,0xFE,0xE7,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xBE,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xEF,0xFE,0xE7,0x7B,0xBF,0xF0,0x64,0x2C,0x3C,0xAA,0x23,0x69,0x13,0x88,0x13,0x88,0x0B,0x88,0x0B,0xA8,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x0B,0x28,0x13,0x0C,0x3C,0x96,0x96,0x6E,0x4C,
-    0x68,0x13,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x0B,0x68,0x1B,0xEC,0x43,0xFD,0xD7,0xFE,0xDF,0xED,0x53,0xE9,0x2A,0x4A,0x33,0x73,0x85,0xDD,0xD7,0x31,0x6D,0x69,0x1B,0x88,0x0B,0x88,0x03,0x68,0x13,0x4D,0x44,0xFE,0xDF,0xFF,0xE7,0xAF,0x5C,0x29,0x2B,0xF0,0x64,0xBC,0xC7,0xFE,0xDF,0xF9,0xB6,0xCB,0x3B,0x68,0x1B,0x48,0x13,0x48,0x1B,0xEC,0x4B,0x3A,0xC7,0xFE,0xE7,0x57,0xA6,0x97,0xA6,0xF8,0xAE,0x39,0xB7,0xFD,0xCF,0xFE,0xD7,0xB6,0x8E,0x89,0x13,0x88,0x0B,0xC9,0x1B,0xAD,0x3C,0x8D,0x44,0x2C,0x3C,0x4C,0x34,0x2B,0x2C,0xC9,0x13,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x13,0x0C,0x44,0xFE,0xEF,0x99,0xF6,0x6A,0xAA,0x66,0xA9,0x66,0xB9,0x66,0xB9,
-    0x86,0xB1,0x86,0xB1,0x87,0xA9,0x87,0xA9,0x86,0xB1,0x66,0xB9,0x66,0xB9,0x87,0xA1,0x8F,0xBB,0x1C,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xF9,0xAE,0x69,0x1B,0x88,0x0B,0x88,0x03,0xA9,0x13,0xA9,0x1B,0xCB,0x2B,0x2C,0x34,0x6C,0x34,0x0B,0x2C,0x0B,0x2C,0xAE,0x44,0xCF,0x54,0x96,0x8E,0xFB,0xBF,0xFB,0xAF,0xAA,0x2B,0x99,0xA7,0xBB,0xC7,0xFE,0xDF,0x19,0xAF,0xD3,0x75,0x69,0x1B,0x69,0x23,0x3A,0xBF,0xFF,0xEF,0xFE,0xE7,0xD4,0x8D,0x89,0x1B,0x88,0x0B,0x48,0x0B,0x4D,0x44,0x5B,0xC7,0xFE,0xE7,0x0C,0x3C,0x68,0x13,
-    0x88,0x03,0x68,0x0B,0x69,0x23,0x76,0x96,0xFF,0xE7,0x7B,0xC7,0x48,0x1B,0x88,0x03,0x88,0x03,0x68,0x13,0x2D,0x44,0xFD,0xCF,0xFE,0xDF,0xB4,0x85,0xAA,0x2B,0x89,0x23,0xCB,0x2B,0x14,0x86,0x9B,0xC7,0xFD,0xCF,0xF3,0x6D,0x68,0x13,0x48,0x13,0x48,0x1B,0x48,0x1B,0x48,0x13,0x68,0x13,0x88,0x0B,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0x68,0x0B,0x68,0x13,0x89,0x1B,0xEB,0x33,0x4D,0x4C,0xF8,0xA6,0xFE,0xDF,0xFE,0xEF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFD,0xDF,0x5A,0xBF,0x8A,0x3B,0x28,0x1B,0x69,0x1B,0x68,0x0B,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0x88,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x68,0x0B,0xEC,0x3B,0xFE,0xD7,0xFE,0xDF,0xF9,0xAE,0xEB,0x33,0x68,0x13,0x88,0x03,0xA8,0x03,0x88,0x03,0x88,0x0B,0x69,0x23,0x35,0x8E,0xFE,0xE7,0x1A,0xC7,0xFD,0xCF,0xFD,0xCF,0xFE,0xDF,0x19,0xB7,0xEC,0x43,0x29,0x23,0x68,0x13,0x88,0x0B,0x68,0x13,0xEB,0x33,
-    0x3B,0xC7,0xFF,0xE7,0x8A,0x33,0x49,0x23,0x29,0x23,0xF0,0x6C,0xDD,0xDF,0xFE,0xE7,0x7A,0xB7,0x6D,0x4C,0x0B,0x2C,0xCE,0x44,0xFD,0xCF,0xFD,0xCF,0xFD,0xCF,0xDC,0xCF,0xDC,0xC7,0x55,0x8E,0xAB,0x3B,0xE8,0x1A,0x28,0x23,0x48,0x13,0x88,0x0B,0x88,0x03,0x88,0x0B,0x88,0x0B,0x88,0x13,0x68,0x0B,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0xA9,0x0B,0x89,0x23,0x19,0xBF,0xBD,0xFF,0xCF,0xC3,0xA7,0x99,0x86,0xB1,0x86,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x86,0xB9,0x86,0xB1,0xA7,0x99,0x14,0xDD,0x9E,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFE,0xE7,0x6E,0x4C,0x68,0x13,0x88,0x03,0x88,0x03,0xA8,0x03,0x68,0x03,0x88,0x03,0x88,0x0B,0x88,0x0B,0x88,0x0B,0x68,0x0B,0x89,0x13,0x48,0x13,0x48,0x13,0x48,0x1B,0x48,0x1B,0x48,0x13,0x48,0x1B,0xCB,0x3B,0x55,0x96,0xDB,0xBF,0x58,0x9F,0x89,0x1B,0x48,0x13,0x92,0x75,0xFE,0xDF,0xFE,0xDF,0x31,0x6D,0x68,0x13,0x88,0x0B,0x89,0x1B,0x51,0x6D,0xFD,0xDF,0xFE,0xDF,0x49,0x23,0x48,0x13,0x68,0x13,0x48,0x13,0xAB,0x3B,0xBC,0xC7,0xFE,0xE7,0x93,0x7D,0x48,0x13,0x88,0x03,0x88,0x03,0x48,0x13,0xFD,0xCF,0xFE,0xE7,0xD8,0xAE,0xCB,0x3B,0x68,0x13,0x68,0x0B,0x48,0x13,0x69,0x23,0x5A,0xBF,0xFD,0xD7,
-    0x2D,0x44,0x69,0x23,0xCF,0x54,0xFD,0xC7,0xFD,0xC7,0x38,0x9F,0x4C,0x3C,0x68,0x1B,0x68,0x13,0x88,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xC9,0x0B,0x88,0x0B,0x89,0x13,0x48,0x1B,0x08,0x23,0x52,0x75,0xDD,0xD7,0xFE,0xE7,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xEF,
-    0xBC,0xD7,0xD8,0xAE,0xF3,0x7D,0x89,0x2B,0x48,0x13,0x68,0x13,0x88,0x0B,0x88,0x0B,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x0B,0x68,0x13,0x89,0x1B,0xEB,0x2B,0xCA,0x23,0x88,0x03,0xA8,0x03,0xA8,0x03,0x68,0x13,0x2D,0x4C,0xFE,0xDF,0xDD,0xDF,0xFE,0xE7,0x56,0x96,0x49,0x23,0x68,0x0B,0x88,0x03,0xA8,0x03,0x88,0x0B,0x48,0x1B,0x51,0x6D,0xFE,0xE7,0xFE,0xE7,0x14,0x86,0x10,0x65,0xB3,0x85,0xFD,0xCF,0xFD,0xD7,0x2D,0x54,0x0C,0x3C,0xCA,0x2B,0x48,0x13,0xAA,0x2B,0x77,0xAE,0xFF,0xE7,0x11,0x6D,0x2D,0x4C,0xEC,0x3B,0x10,0x65,0x9B,0xC7,0xDC,0xCF,0x9B,0xBF,0x18,0x9F,0x71,0x5D,0x69,0x1B,0xD2,0x65,0x0B,0x34,0x48,0x1B,0x48,0x1B,0x48,0x13,0x68,0x13,0x68,0x13,0x68,0x0B,
-    0x88,0x0B,0x88,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x68,0x13,0xAF,0x5C,0xBC,0xE7,0xDB,0xFE,0xCC,0xA2,0xA7,0xA1,0x86,0xB1,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x66,0xB9,0x86,0xB1,0xA7,0xA1,0xAF,0xC3,0xFC,0xFE,0xBE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xEF,0xD8,0xAE,0x48,0x1B,0x88,0x0B,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,
-    0x88,0x0B,0x88,0x0B,0x68,0x0B,0x88,0x0B,0x88,0x0B,0x88,0x0B,0x68,0x13,0x68,0x13,0x68,0x13,0x68,0x0B,0x88,0x0B,0x88,0x0B,0x89,0x23,0x54,0x7E,0x75,0x86,0x8D,0x44,0x68,0x13,0x88,0x13,0xB6,0x8E,0xD8,0xA6,0xFE,0xE7,0xBC,0xD7,0xEC,0x43,0xAA,0x2B,0x89,0x2B,0xCC,0x3B,0x36,0x9E,0xFE,0xDF,0x9B,0xBF,0xEB,0x33,0x68,0x0B,0x88,0x03,0x68,0x0B,0x69,0x23,0xFE,0xDF,0xFE,0xE7,0xF4,0x85,0x49,0x1B,0x88,0x0B,0x88,0x03,0x88,0x0B,0x48,0x1B,0x39,0xAF,0xBB,0xC7,0x29,0x23,0x51,0x65,0xFD,0xCF,0x39,0xB7,0x75,0x8E,0xD6,0x96,0xDB,0xBF,0xF3,0x7D,0xCB,0x33,0x0B,0x2C,0xA8,0x13,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,
-    0x88,0x13,0x68,0x13,0x69,0x23,0x10,0x65,0x76,0x96,0x7B,0xC7,0xFE,0xE7,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xEF,0xFE,0xE7,0x5A,0xC7,0xD4,0x8D,0xCF,0x5C,0xAA,0x2B,0x68,0x13,0x68,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x68,0x13,0xAA,0x23,0xAE,0x4C,0x14,0x7E,0xD7,0x96,0x0F,0x4D,0x88,0x0B,0xA8,0x03,0xA8,0x03,0x68,0x13,
-    0xD0,0x64,0xFE,0xDF,0xD5,0x9D,0x3A,0xC7,0xFE,0xDF,0xD4,0x85,0x48,0x1B,0x88,0x0B,0x88,0x03,0x88,0x03,0x68,0x13,0xCF,0x54,0xBD,0xD7,0xFE,0xE7,0xAB,0x3B,0x28,0x23,0x09,0x23,0xD8,0xA6,0xFE,0xDF,0xD5,0x95,0xB3,0x7D,0xB2,0x6D,0x69,0x1B,0x50,0x5D,0x5A,0xBF,0xFE,0xDF,0xDC,0xBF,0xD7,0x96,0xEF,0x54,0x50,0x5D,0x51,0x6D,0xCF,0x5C,0x4D,0x44,0x89,0x23,0x48,0x13,0x68,0x0B,0x68,0x0B,0x88,0x0B,0x88,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0xAA,0x2B,0x35,0x96,
-    0xBD,0xF7,0x59,0xF6,0x4D,0xBB,0xC7,0xA1,0x87,0xA1,0x87,0xA9,0x87,0xA9,0x87,0xA9,0x87,0xA1,0xA7,0x99,0x49,0x9A,0x92,0xCC,0x96,0xCD,0xB6,0xBD,0xB6,0xBD,0xB6,0xBD,0xB6,0xBD,0xB6,0xBD,0xB6,0xBD,0xD6,0xBD,0xF7,0xC5,0xF7,0xC5,0x38,0xCE,0x58,0xCE,0x79,0xD6,0xBA,0xD6,0xFB,0xDE,0x3C,0xE7,0xDE,0xF7,0xFF,0xEF,0x7B,0xC7,0xCB,0x3B,0x68,0x13,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x68,0x0B,0x68,0x13,0x68,0x13,0x68,0x13,0x88,0x0B,0x88,0x13,0x30,0x5D,0xB3,0x75,
-    0x76,0x9E,0x39,0xB7,0xD7,0x9E,0x96,0x8E,0x75,0x8E,0x39,0xA7,0xFE,0xD7,0x5A,0xB7,0xCF,0x54,0x69,0x1B,0x88,0x03,0x88,0x03,0x68,0x0B,0xCB,0x33,0xFE,0xE7,0xDD,0xDF,0x10,0x65,0x68,0x13,0x88,0x0B,0xA8,0x03,0x88,0x03,0x68,0x13,0x51,0x5D,0xB3,0x75,0x8A,0x2B,0x76,0x96,0xFE,0xE7,0x4F,0x64,0xE8,0x22,0x49,0x2B,0x8F,0x5C,0xBB,0xC7,0xD7,0xA6,0x75,0x86,0xEA,0x23,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x0B,0x68,0x13,0x48,0x1B,0x4D,0x44,0x52,0x75,0x98,0xAE,0xDD,0xDF,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xEF,0xFE,0xDF,0xF9,0xAE,0x10,0x65,0x0B,0x34,0x69,0x1B,0x68,0x13,0x68,0x0B,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0x68,0x0B,0xCE,0x4C,0xF8,0xA6,0xBC,0xCF,0xFD,0xD7,0xD3,0x7D,0xAA,0x23,0x88,0x0B,0xA8,0x03,0xA8,0x03,0x68,0x13,0x31,0x6D,0xFD,0xD7,0xB0,0x64,0xF0,0x6C,0xBD,0xD7,0xFE,0xDF,0x92,0x75,0x48,0x1B,0x88,0x0B,0x88,0x03,0x68,0x0B,0xCB,0x2B,0xD9,0xB6,0xFE,0xE7,0xF0,0x6C,0x28,0x23,0x28,0x23,0xF0,0x5C,0xFE,0xE7,0x9C,0xD7,
-    0x5A,0xBF,0x92,0x75,0x69,0x23,0x37,0x97,0x34,0x7E,0x30,0x5D,0x4D,0x3C,0x2B,0x2C,0xA9,0x1B,0x68,0x13,0x68,0x13,0x68,0x13,0x88,0x0B,0x88,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0xA8,0x03,0x88,0x03,0x88,0x0B,0x88,0x0B,0x68,0x13,0x48,0x13,0x68,0x13,0x88,0x0B,0x88,0x0B,0x68,0x13,0x0C,0x3C,0x3A,0xC7,0xDE,0xFF,0xFB,0xFE,0x35,0xDD,0x4D,0xAB,0x08,0x8A,0xC8,0x89,0xC8,0x81,0xE8,0x81,0x08,0x72,0x49,0x6A,0xAA,0x72,0xAA,0x62,0xAA,0x5A,0xAA,0x5A,0xAA,0x5A,0xAA,0x5A,0xAA,0x5A,0xAA,0x5A,0xAA,0x5A,
-    0xEB,0x62,0x2C,0x6B,0x4C,0x6B,0xAE,0x7B,0xEF,0x83,0x71,0x94,0xF3,0xA4,0xB6,0xB5,0x1B,0xDF,0xDD,0xDF,0xF0,0x5C,0x48,0x13,0x68,0x0B,0x88,0x0B,0x68,0x13,0x68,0x13,0x68,0x13,0x68,0x13,0x88,0x0B,0x88,0x0B,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x68,0x0B,0x69,0x13,0xCA,0x23,0x0B,0x34,0x4C,0x34,0xCE,0x44,0xB2,0x65,0xD2,0x6D,0x10,0x55,0x0B,0x34,0x88,0x13,0x88,0x0B,0xA8,0x03,0xA8,0x03,0x68,0x0B,0xCB,0x33,0xFE,0xDF,0xBC,0xD7,0xCF,0x54,0x48,0x13,0x88,0x0B,0xA8,0x03,
-    0x88,0x0B,0x68,0x0B,0x68,0x13,0x89,0x23,0x8A,0x23,0x76,0x96,0xFE,0xE7,0xF9,0xBE,0xCC,0x43,0x08,0x23,0x29,0x23,0x51,0x6D,0xFE,0xDF,0x55,0x8E,0x89,0x1B,0x88,0x03,0xA8,0x03,0xA8,0x03,0x68,0x03,0x68,0x0B,0x88,0x13,0x88,0x0B,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x0B,0x68,0x0B,0x69,0x13,0xCB,0x2B,0x6D,0x44,0x15,0x8E,0xDD,0xD7,0xFF,0xEF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFE,0xE7,0xD8,0xAE,0xCC,0x3B,
-    0x48,0x1B,0x68,0x13,0x88,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0x88,0x0B,0x68,0x0B,0x68,0x13,0x68,0x13,0x68,0x13,0x88,0x13,0x88,0x03,0x68,0x13,0x71,0x6D,0xFD,0xD7,0xDD,0xE7,0xFE,0xE7,0xF4,0x85,0x28,0x1B,0x88,0x0B,0xA8,0x03,0xA8,0x03,0x68,0x13,0xD4,0x85,0xFD,0xD7,0x6E,0x5C,0x09,0x33,0x98,0xAE,0xFE,0xE7,0xBC,0xC7,0xAF,0x54,0x48,0x13,0x88,0x13,0x68,0x0B,0x69,0x23,0x77,0x9E,0xFE,0xE7,0x19,0xAF,0x2D,0x44,0x2C,0x34,0x69,0x23,0xDC,0xC7,0xFE,0xDF,0x9B,0xB7,0x0C,0x3C,0x48,0x1B,0x48,0x13,0x68,0x13,0x48,0x13,0x88,0x13,0x88,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,
-    0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0x88,0x0B,0x88,0x0B,0x68,0x0B,0x68,0x13,0x68,0x13,0x68,0x13,0x68,0x13,0x48,0x13,0x48,0x13,0x48,0x1B,0x49,0x1B,0x28,0x1B,0x69,0x23,0x2D,0x44,0x10,0x65,0xD3,0x75,0x8D,0x44,0x48,0x13,0x88,0x13,0x69,0x13,0x2D,0x4C,0xFE,0xE7,0xFE,0xF7,0xBE,0xFF,0x7E,0xFF,0x5D,0xFF,0x5D,0xFF,0x7E,0xFF,0x9E,0xFF,0xBE,0xFF,0xDE,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xF7,0xFE,0xE7,0x93,0x85,0x69,0x1B,0x89,0x13,0x68,0x13,0x0B,0x2C,0xB2,0x6D,0x31,0x65,0x6E,0x4C,0x8A,0x2B,0x29,0x1B,0x49,0x1B,
-    0x28,0x1B,0x48,0x1B,0x48,0x13,0x68,0x13,0x68,0x13,0x68,0x13,0x68,0x13,0x68,0x13,0x68,0x0B,0x88,0x0B,0x88,0x0B,0x88,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x68,0x0B,0x88,0x13,0x68,0x13,0x68,0x13,0x68,0x13,0x88,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x0B,0x69,0x1B,0xFD,0xD7,0xDD,0xD7,0x10,0x65,0x48,0x1B,0x68,0x13,0x68,0x13,0x68,0x13,0xEE,0x44,0x2B,0x2C,0x48,0x13,0x28,0x1B,0x10,0x65,0xDD,0xD7,0xFE,0xE7,0xFD,0xCF,0x31,0x6D,0x29,0x23,0x8A,0x33,0xFD,0xCF,0xB3,0x75,0x68,0x13,0x88,0x03,0x88,0x03,0x88,0x0B,0x68,0x1B,0x0F,0x55,
-    0xB2,0x6D,0x49,0x1B,0x68,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x68,0x13,0x28,0x13,0x8A,0x2B,0xB3,0x85,0xFD,0xD7,0xFF,0xEF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x3B,0xC7,0x56,0x96,0x0C,0x3C,0x49,0x1B,0x68,0x13,0x68,0x0B,0x88,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0x88,0x0B,0x68,0x13,0xAA,0x23,0x2D,0x44,0x52,0x6D,0x15,0x86,0xCB,0x33,0x68,0x13,0x68,0x13,0x72,0x6D,0xFE,0xD7,0x4F,0x6C,0xFF,0xE7,0xD8,0xA6,0xCB,0x33,
-    0x88,0x0B,0xA8,0x03,0xA8,0x03,0x68,0x13,0x56,0x96,0xFE,0xE7,0x39,0xB7,0x9B,0xC7,0x19,0xB7,0x3A,0xBF,0xFE,0xE7,0xB8,0xAE,0xEC,0x3B,0x89,0x23,0x69,0x1B,0x2C,0x3C,0xD8,0xAE,0xFE,0xDF,0xDC,0xC7,0x79,0xA7,0x50,0x55,0x68,0x13,0x69,0x1B,0x89,0x23,0x69,0x13,0x68,0x13,0x88,0x0B,0x88,0x03,0x88,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0x68,0x0B,0x68,0x13,0x68,0x13,0x69,0x1B,0x8A,0x2B,0xCB,0x33,0x2C,0x44,0x4D,0x4C,0x4E,0x4C,0x4E,0x54,0x52,0x75,0x56,0x9E,0x19,0xB7,0xFD,0xD7,0xFE,0xE7,0xFE,0xE7,0xFF,0xE7,0xFF,0xEF,0xFF,0xEF,0xFF,0xE7,
-    0xFE,0xDF,0x0C,0x44,0x68,0x13,0x68,0x0B,0x68,0x13,0x8E,0x4C,0x9C,0xCF,0xFE,0xF7,0xDE,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFE,0xE7,0x14,0x8E,0x89,0x23,0x68,0x13,0x68,0x13,0x8A,0x2B,0x36,0x96,0xFE,0xE7,0xFF,0xEF,0xFF,0xEF,0xFF,0xE7,0xFF,0xE7,0xFE,0xE7,0xFE,0xDF,0x7B,0xC7,0xB8,0xA6,0xB4,0x85,0x8F,0x64,0x2D,0x54,0x2D,0x4C,0x2D,0x44,0xEC,0x3B,0xCB,0x2B,0x89,0x23,0x69,0x1B,0x68,0x13,0x68,0x0B,0x88,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,
-    0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x48,0x13,0x31,0x6D,0xFD,0xD7,0xD8,0xA6,0x0C,0x44,0x49,0x23,0x69,0x23,0xCF,0x5C,0x9A,0xAF,0x91,0x65,0x89,0x23,0x92,0x75,0xD0,0x64,0x52,0x75,0x7A,0xBF,0xFE,0xDF,0xFE,0xE7,0xB8,0xAE,0x2D,0x54,0x55,0x8E,0xA9,0x23,0x88,0x0B,0x88,0x03,0x88,0x0B,0x68,0x13,0x6E,0x54,0xBC,0xC7,0xFF,0xE7,0x3A,0xB7,0xEB,0x2B,0x88,0x0B,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0x68,0x0B,0x48,0x1B,0x69,0x23,0x92,0x75,0x19,0xBF,0xBD,0xDF,
-    0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xE7,0x90,0x6C,0x09,0x2B,0x28,0x1B,0x68,0x13,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xC9,0x13,0x50,0x55,0x76,0x8E,0xFD,0xD7,0xFE,0xE7,0xFE,0xDF,0x56,0x96,0x89,0x23,0x48,0x1B,0x52,0x75,0xFE,0xD7,0x6B,0x4B,0xBC,0xCF,0xDC,0xCF,0x8E,0x54,0x68,0x13,0xA8,0x03,0xA8,0x03,0x68,0x13,0x97,0xA6,0xFE,0xE7,0x93,0x85,0x4E,0x54,0x2A,0x33,0x4A,0x3B,0x5B,0xC7,0xFE,0xDF,0xD7,0x9E,0x14,0x76,0x0B,0x34,0x14,0x76,0x55,0x8E,0x92,0x75,0xAE,0x54,0xAA,0x2B,
-    0x68,0x13,0x88,0x0B,0x88,0x0B,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x68,0x0B,0x68,0x0B,0x68,0x13,0x68,0x13,0x48,0x13,0x69,0x1B,0xCA,0x2B,0x4D,0x3C,0xCF,0x54,0x51,0x65,0xB3,0x75,0xF4,0x85,0x76,0x9E,0x3A,0xB7,0xBC,0xCF,0xFE,0xDF,0xFE,0xE7,0xFF,0xEF,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x7B,0xC7,0x2D,0x44,0x48,0x13,0x88,0x13,0x68,0x13,0x8E,0x54,0x19,0xB7,0xFE,0xE7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xEF,0xDD,0xDF,0x93,0x7D,0x89,0x23,0x68,0x13,0x68,0x13,0x49,0x1B,0xD4,0x85,0xFE,0xE7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFF,0xEF,0xFF,0xEF,0xFF,0xE7,0xFD,0xDF,0x7B,0xBF,0xB8,0xA6,0x15,0x8E,0xD4,0x7D,0x92,0x6D,0x10,0x5D,0x6D,0x44,0xEB,0x33,0x89,0x23,0x68,0x13,0x48,0x13,0x68,0x13,0x88,0x13,0x68,0x0B,0x88,0x0B,0x88,0x0B,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x0B,0x49,0x1B,0xD3,0x75,
-    0x9B,0xB7,0x39,0xAF,0x14,0x7E,0x35,0x86,0x9A,0xB7,0x96,0x96,0xAA,0x2B,0x8A,0x2B,0xDC,0xC7,0x72,0x7D,0x08,0x23,0xCB,0x3B,0xD4,0x8D,0x7B,0xCF,0xFE,0xE7,0x7B,0xC7,0xCB,0x33,0x68,0x13,0x88,0x0B,0x88,0x0B,0x68,0x13,0x6D,0x44,0x3A,0xB7,0x3B,0xC7,0xFF,0xEF,0x3A,0xBF,0xEB,0x33,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x68,0x0B,0x48,0x13,0x29,0x23,0xAC,0x4B,0x78,0xBE,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0x1B,0xCF,
-    0xD5,0x95,0xEC,0x43,0x48,0x1B,0x68,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0xEA,0x1B,0xF2,0x65,0xD3,0x7D,0xFE,0xE7,0x9C,0xDF,0x7C,0xD7,0xFE,0xDF,0x35,0x8E,0x29,0x2B,0x32,0x75,0xFD,0xD7,0x8B,0x43,0xF4,0x8D,0xFE,0xE7,0x73,0x7D,0x69,0x1B,0x88,0x03,0x88,0x03,0x48,0x13,0x98,0xA6,0xDD,0xD7,0x2A,0x33,0x09,0x23,0x6A,0x2B,0xD3,0x7D,0xBC,0xC7,0xFD,0xD7,0xF8,0x9E,0xB2,0x65,0xA9,0x1B,0xCA,0x1B,0xA9,0x1B,0x68,0x13,0x68,0x13,0x88,0x0B,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0x68,0x13,0x48,0x1B,0x29,0x1B,0x6A,0x2B,0x4E,0x4C,0x52,0x75,
-    0x15,0x96,0x97,0xA6,0xF9,0xB6,0x5B,0xC7,0xBD,0xD7,0xFE,0xE7,0xFF,0xEF,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xD8,0xAE,0x0C,0x3C,0x48,0x13,0x68,0x0B,0x68,0x1B,0x2C,0x3C,0x76,0x96,0xFE,0xDF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFE,0xEF,0x3A,0xBF,0xCF,0x5C,0x48,0x1B,0x68,0x13,0x68,0x13,0x49,0x1B,0xB4,0x85,0xFE,0xE7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFE,0xE7,0xBD,0xDF,0x5B,0xCF,0x1A,0xBF,0xB8,0xAE,0x36,0x9E,0x93,0x7D,0xAF,0x5C,0xCB,0x33,0x49,0x23,0x28,0x1B,0x48,0x13,0x68,0x0B,0x88,0x0B,0xA8,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x68,0x0B,0x89,0x1B,0x6D,0x3C,0x50,0x5D,0xF3,0x75,0xF3,0x75,0x30,0x55,0xEA,0x2B,0x48,0x1B,0x2C,0x3C,0xFE,0xDF,0x77,0x9E,0x8A,0x2B,0x48,0x1B,0x69,0x23,0x8E,0x54,0x5B,0xC7,0xFE,0xE7,0x14,0x7E,0x48,0x13,0x88,0x0B,0x68,0x13,
-    0xCB,0x33,0x59,0xAF,0x7A,0xB7,0x6F,0x64,0xFF,0xEF,0x3A,0xBF,0xEB,0x33,0x88,0x0B,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x68,0x0B,0x48,0x13,0x69,0x23,0x11,0x75,0xB9,0xBE,0x9D,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFE,0xE7,0xDD,0xD7,0xF4,0x7D,0x49,0x1B,0x68,0x13,0x68,0x0B,0x88,0x0B,0x88,0x03,0x88,0x03,0x88,0x0B,0x68,0x13,0x49,0x23,0xD8,0xB6,0x5B,0xCF,0xF6,0xA5,0xDD,0xDF,0xFE,0xDF,0x73,0x85,0x32,0x7D,0xFE,0xD7,
-    0xAB,0x3B,0x4E,0x54,0xFE,0xDF,0xBC,0xCF,0x8A,0x23,0x68,0x13,0x48,0x0B,0x28,0x13,0xD8,0xA6,0xFE,0xDF,0xB7,0x9E,0x55,0x86,0xCB,0x2B,0x59,0x9F,0xCF,0x5C,0xCB,0x33,0x69,0x23,0x68,0x13,0x88,0x0B,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0xA8,0x0B,0x88,0x0B,0x88,0x13,0x68,0x13,0x68,0x13,0x48,0x13,0x49,0x1B,0x8A,0x2B,0x51,0x65,0x97,0x9E,0x7B,0xBF,0xDD,0xD7,0xFE,0xDF,0xFE,0xE7,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFE,0xEF,0xB8,0xAE,0xCB,0x33,0x68,0x1B,0x88,0x13,0x68,0x13,0x49,0x23,0x8E,0x54,0xDD,0xD7,0xFE,0xEF,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFE,0xEF,0xFE,0xDF,0x35,0x8E,0xAA,0x33,0x68,0x13,0x88,0x13,0x88,0x13,0x48,0x1B,0xF4,0x85,0xFE,0xE7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,
-    0xFF,0xF7,0xFF,0xEF,0xFE,0xEF,0xFE,0xE7,0xFD,0xD7,0x9B,0xC7,0xF8,0xA6,0xD4,0x7D,0xEB,0x33,0x28,0x1B,0x28,0x13,0x48,0x13,0x68,0x13,0x68,0x13,0x88,0x0B,0x88,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x0B,0x68,0x0B,0x68,0x13,0x69,0x13,0x89,0x1B,0x88,0x13,0x68,0x13,0x48,0x13,0x58,0x9F,0xFC,0xC7,0x9B,0xC7,0x92,0x6D,0x08,0x1B,0x28,0x1B,0x29,0x2B,0x77,0xA6,0xFE,0xDF,0x55,0x86,0x48,0x13,0x68,0x13,0x49,0x23,0x7A,0xB7,0xDD,0xD7,0xD0,0x6C,0x4B,0x43,0xFF,0xEF,0x3A,0xBF,0xEB,0x33,0x68,0x0B,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x0B,0x68,0x13,0x49,0x1B,0xD0,0x5C,
-    0x5A,0xBF,0xFE,0xE7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFE,0xE7,0xDD,0xD7,0x93,0x7D,0xCB,0x33,0x68,0x13,0x68,0x0B,0xA8,0x03,0xA8,0x03,0x88,0x0B,0x68,0x1B,0xAF,0x5C,0xFE,0xDF,0x32,0x7D,0xB4,0x95,0xFE,0xE7,0x7C,0xD7,0x99,0xBE,0xFD,0xDF,0xCB,0x3B,0xAB,0x3B,0xD9,0xB6,0xFE,0xE7,0xEC,0x43,0x6A,0x2B,0xCA,0x2B,0x51,0x65,0xFC,0xCF,0x7B,0xBF,0x59,0xA7,0x71,0x5D,0x89,0x1B,0x68,0x0B,0x68,0x13,0x68,0x0B,0x88,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,
-    0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x68,0x0B,0x68,0x13,0x69,0x1B,0xAA,0x2B,0xEC,0x3B,0x0D,0x4C,0xD0,0x6C,0x5A,0xBF,0xDD,0xD7,0xFE,0xE7,0xFF,0xEF,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xEF,0x3A,0xBF,0xEC,0x43,0x28,0x1B,0x68,0x13,0x68,0x13,0x48,0x13,0x69,0x23,0x51,0x6D,0x59,0xB7,0xBC,0xD7,0xFE,0xE7,0xFF,0xF7,
-    0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xDD,0xDF,0x7A,0xBF,0xF7,0x9E,0xAA,0x2B,0x68,0x1B,0x68,0x13,0x88,0x13,0x68,0x13,0xAA,0x2B,0x15,0x8E,0xFE,0xE7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFE,0xEF,0xFE,0xE7,0xFD,0xDF,0x9B,0xC7,0x15,0x96,0x4E,0x54,0x0C,0x44,0xEB,0x33,0x69,0x1B,0x68,0x13,0x68,0x0B,0x88,0x0B,0x88,0x03,
-    0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0x88,0x03,0x88,0x0B,0x68,0x13,0xAA,0x2B,0x10,0x5D,0xBB,0xB7,0xBB,0xBF,0xB0,0x5C,0xF0,0x6C,0x9B,0xCF,0xFD,0xCF,0xCB,0x33,0x48,0x1B,0x6A,0x2B,0xB7,0x9E,0xFE,0xDF,0xF9,0xB6,0x2E,0x5C,0xED,0x53,0xFF,0xEF,0x3A,0xBF,0xEB,0x33,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x68,0x13,0xCA,0x2B,0x2D,0x4C,0x5A,0xBF,0xFE,0xE7,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xE7,0x3A,0xBF,0x72,0x75,0xCB,0x2B,0x68,0x13,0x88,0x0B,0x88,0x0B,0x68,0x13,0x8A,0x2B,0x7A,0xB7,0xD8,0xA6,0x8B,0x43,0x15,0x9E,0xFE,0xE7,0xDE,0xE7,0xFE,0xE7,0xCB,0x3B,0x49,0x2B,0xB4,0x8D,0xFE,0xDF,0x39,0xAF,0xF4,0x7D,0x92,0x65,0x30,0x55,0x14,0x7E,0x8A,0x2B,0x28,0x13,0x68,0x13,0x88,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0x88,0x0B,0x88,0x13,0x68,0x13,0x69,0x1B,0xAA,0x2B,0xAE,0x4C,0x51,0x65,0x72,0x75,0x97,0xA6,0xFE,0xDF,0xFE,0xE7,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFE,0xDF,0xF0,0x64,0xAA,0x2B,0x48,0x13,0x68,0x13,0x68,0x13,0x48,0x13,0x48,0x1B,0x8E,0x54,0xF4,0x8D,0xF5,0x95,0x57,0xA6,0x3A,0xC7,0x9C,0xD7,0xBC,0xD7,0x5B,0xC7,0xB8,0xAE,0xF5,0x95,0xF4,0x8D,0x31,0x6D,0x8A,0x2B,0x48,0x1B,0x68,0x13,0x68,0x13,0x68,0x13,0x69,0x1B,0x8E,0x4C,0x77,0xA6,0xFF,0xEF,0xFF,0xF7,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFE,0xDF,0xBC,0xC7,0xD4,0x85,0x71,0x6D,0x10,0x5D,0xCB,0x2B,0x89,0x1B,0x48,0x13,0x68,0x13,0x68,0x0B,0x68,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x68,0x0B,0x48,0x13,0xAE,0x4C,0x35,0x86,0x97,0x96,0x39,0xAF,0x76,0x96,0x10,0x65,
-    0xAB,0x2B,0x0C,0x3C,0xF4,0x85,0xFD,0xD7,0x36,0x9E,0xF4,0x8D,0x19,0xAF,0x5A,0xBF,0xFF,0xEF,0x3A,0xBF,0xEB,0x33,0x88,0x0B,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0x68,0x13,0xAA,0x23,0xCF,0x54,0x97,0x9E,0xFE,0xE7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFE,0xE7,0xD9,0xB6,0xB3,0x7D,0xAA,0x2B,0x68,0x13,0x68,0x13,0x68,0x1B,0x92,0x6D,0xFD,0xD7,0x0D,0x54,
-    0x4A,0x33,0x36,0x96,0xFF,0xEF,0xFF,0xEF,0x2D,0x54,0xCF,0x5C,0x39,0xB7,0xDC,0xCF,0x18,0x9F,0xEF,0x54,0x4C,0x34,0x88,0x13,0x88,0x13,0x88,0x0B,0x88,0x0B,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x68,0x0B,0x68,0x13,0x48,0x1B,0x8A,0x2B,0xEC,0x43,0x72,0x75,0x77,0x9E,0xB8,0xB6,0x9C,0xD7,0xFE,0xE7,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDD,0xDF,0x97,0xA6,0x8E,0x54,0x49,0x23,0x68,0x13,0x68,0x0B,0x68,0x0B,0x68,0x13,0x48,0x13,0x48,0x1B,0x89,0x23,0x2C,0x3C,0x8E,0x44,0x8E,0x4C,0x4D,0x3C,0xCA,0x2B,0x48,0x1B,0x48,0x13,0x68,0x13,0x88,0x13,0x88,0x13,0x68,0x13,0x49,0x1B,0xCB,0x3B,0xF5,0x8D,0x7B,0xCF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFF,0xEF,0xDD,0xDF,0xD9,0xB6,0x77,0xA6,0xD4,0x85,0x4E,0x4C,0xAA,0x2B,0x49,0x1B,0x68,0x13,0x68,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0xA8,0x03,0x88,0x0B,0x68,0x13,0x68,0x13,0xCA,0x23,0x2B,0x34,0x89,0x1B,0x48,0x1B,0xF3,0x75,0x59,0xAF,0xFD,0xD7,0xF9,0xB6,0x4A,0x33,0x29,0x23,0xEC,0x3B,0xD0,0x64,0xFF,0xEF,0x3A,0xBF,0xEB,0x33,0x88,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0x88,0x13,0x48,0x1B,0x4E,0x4C,0x97,0xA6,0x9C,0xD7,
-    0xFF,0xEF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFE,0xE7,0x5A,0xB7,0xEF,0x54,0x68,0x13,0x68,0x13,0x8E,0x4C,0xFC,0xCF,0x36,0x9E,0x09,0x2B,0xCB,0x3B,0xB8,0xAE,0xFE,0xDF,0x8E,0x54,0x10,0x5D,0x72,0x6D,0xCB,0x3B,0xAA,0x2B,0x68,0x13,0x88,0x0B,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,
-    0x88,0x0B,0x68,0x13,0x68,0x13,0x48,0x1B,0x8A,0x23,0x8E,0x4C,0x15,0x8E,0xBC,0xC7,0xDD,0xD7,0xFE,0xE7,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xEF,0xDD,0xDF,0xF9,0xAE,0x6E,0x4C,0x48,0x1B,
-    0x48,0x13,0x68,0x13,0x68,0x13,0x68,0x13,0x68,0x13,0x48,0x13,0x68,0x13,0x68,0x13,0x68,0x13,0x68,0x13,0x68,0x0B,0x68,0x0B,0x68,0x13,0x68,0x13,0x48,0x1B,0xAB,0x33,0xD4,0x85,0xBC,0xCF,0xFE,0xEF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFE,0xEF,0xDD,0xDF,0xBC,0xCF,0xF9,0xAE,0x31,0x65,0xCB,0x2B,0x48,0x1B,0x68,0x13,0x68,0x13,0x68,0x0B,0x88,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0x88,0x03,0x68,0x0B,0xAA,0x23,0xAF,0x54,0xD8,0xA6,0xFC,0xCF,0x79,0x9F,0xAA,0x23,0x28,0x1B,0x6A,0x33,0xFF,0xE7,0x1A,0xBF,0xEB,0x33,0x68,0x0B,0x88,0x03,0xA8,0x03,0x88,0x0B,0x2B,0x2C,0xF8,0xA6,0xDD,0xD7,0xFF,0xEF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xE7,0xF7,0x9E,0xA9,0x23,0x68,0x13,0x69,0x23,0x36,0x9E,0xFD,0xDF,0x73,0x7D,0xF4,0x7D,0xAF,0x5C,0x34,0x7E,0xCA,0x23,0x68,0x13,0x68,0x13,0x68,0x0B,0x88,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x13,0x69,0x1B,0xAA,0x2B,0xAB,0x3B,0xF0,0x6C,0x77,0xA6,0xDD,0xD7,0xFE,0xE7,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xEF,0xFE,0xE7,0x5B,0xC7,0x73,0x7D,0xEC,0x43,0xAA,0x33,0xAA,0x2B,0x8A,0x23,0x69,0x1B,0x49,0x1B,0x48,0x1B,0x48,0x1B,0x89,0x23,0x8A,0x2B,0xAB,0x2B,0xCB,0x3B,0xD0,0x64,0x97,0xA6,0xFE,0xE7,0xFE,0xEF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFF,0xEF,0xFE,0xE7,0x1A,0xBF,0x93,0x7D,0x0D,0x44,0xAB,0x33,0x69,0x1B,0x68,0x13,0x88,0x0B,0x88,0x03,0xA8,0x03,0x88,0x03,
-    0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x0B,0x68,0x13,0x48,0x1B,0xEB,0x2B,0x70,0x55,0x4C,0x3C,0xF7,0x9E,0x76,0x9E,0xFF,0xEF,0x3A,0xC7,0x0C,0x3C,0x68,0x13,0x88,0x03,0x88,0x03,0x68,0x0B,0xF3,0x6D,0xFE,0xDF,0xFF,0xEF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xE7,0x10,0x65,0x48,0x1B,
-    0x68,0x13,0x8D,0x3C,0xD8,0xA6,0xDC,0xCF,0xB7,0x9E,0x91,0x65,0x89,0x23,0x48,0x13,0x88,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0x88,0x13,0x68,0x13,0x48,0x13,0xEB,0x2B,0xCF,0x54,0x72,0x6D,0xD8,0xA6,0xFD,0xD7,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xEF,0xFE,0xE7,0xBC,0xCF,0xD8,0xA6,0x15,0x8E,0x92,0x75,0x31,0x6D,0x11,0x65,0x72,0x6D,0xD4,0x85,0x97,0x9E,0x5A,0xBF,0xFD,0xD7,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFE,0xDF,0x5A,0xBF,0xF4,0x85,0xEF,0x5C,0x4C,0x3C,0x89,0x1B,0x68,0x13,0x88,0x13,0x88,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x0B,0x88,0x0B,0x68,0x0B,0xA9,0x1B,0x10,0x5D,0x55,0x8E,0x7B,0xC7,0xFD,0xCF,0x14,0x76,0xCA,0x1B,0x88,0x03,0xA8,0x03,0x88,0x13,0x0C,0x3C,
-    0xDD,0xD7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9C,0xD7,0x8E,0x4C,0x48,0x13,0x88,0x13,0x70,0x4D,0xF3,0x6D,0xEF,0x54,0x89,0x23,0x68,0x13,0x88,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x0B,0x68,0x13,0x48,0x1B,0xAB,0x33,0xF0,0x64,
-    0xF5,0x8D,0xD9,0xB6,0xDD,0xDF,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xFE,0xE7,0x5B,0xC7,0x56,0x9E,0x93,0x7D,0xEC,0x3B,0x49,0x1B,0x68,0x13,0x88,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0x88,0x0B,0x68,0x13,0x68,0x1B,0x4D,0x3C,0x92,0x65,0x33,0x6E,0x2B,0x24,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x48,0x1B,0x5A,0xBF,0xFF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x56,0x9E,0x8A,0x23,0x88,0x0B,0x68,0x0B,0xA9,0x13,0x89,0x13,0x68,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x0B,0x68,0x13,0x48,0x13,0x69,0x23,0x8E,0x4C,0x97,0x9E,0x9B,0xC7,0xDD,0xDF,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xF7,0xFF,0xEF,0xFE,0xE7,0x9C,0xCF,0x39,0xAF,0x72,0x6D,0xAA,0x2B,0x48,0x1B,0x68,0x13,0x68,0x0B,0x68,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0x88,0x0B,0x68,0x0B,0x88,0x13,0xA9,0x1B,0x88,0x0B,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x68,0x13,0xAF,0x5C,0xFE,0xE7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFE,0xE7,0xD4,0x85,0x48,0x13,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x68,0x0B,0x68,0x1B,0x69,0x23,0xCB,0x3B,0xD4,0x8D,0x9C,0xCF,0xFE,0xE7,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFE,0xEF,0xFE,0xE7,0xFE,0xDF,0xB8,0xAE,0x6F,0x54,0x8A,0x2B,0x69,0x1B,0x68,0x13,0x88,0x0B,0x88,0x03,0x88,0x03,0x88,0x03,0xA8,0x03,0x88,0x03,0x88,0x03,0x88,0x03,
-    0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x0B,0x28,0x23,0xFE,0xD7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBC,0xCF,0x4D,0x4C,0x68,0x13,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x0B,0x68,0x0B,0x48,0x13,0xA9,0x23,0x8D,0x44,0x51,0x6D,0x19,0xB7,0xFE,0xDF,0xFF,0xEF,0xFF,0xF7,
-    0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xEF,0xFE,0xE7,0x9B,0xC7,0xD4,0x85,0xAF,0x54,0x0B,0x34,0x68,0x13,0x68,0x13,0x68,0x0B,0x88,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x0B,0x28,0x13,0xB7,0x9E,0xFF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x39,0xB7,0x49,0x23,0x88,0x0B,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x0B,0x68,0x13,0x49,0x1B,0xCB,0x33,0xB3,0x7D,0x36,0x9E,0x9C,0xD7,0xFE,0xE7,0xFF,0xEF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xEF,0xDD,0xDF,0xF9,0xB6,0xD4,0x8D,0x6E,0x54,0x49,0x23,0x68,0x13,0x88,0x0B,0x88,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0xA8,0x03,0x88,0x03,0x68,0x13,0x8E,0x54,0xFF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xD3,0x7D,0x48,0x13,0x88,0x0B,0xA8,0x03,0x88,0x03,0x88,0x0B,0x68,0x0B,0x68,0x13,0x49,0x1B,0x4D,0x44,0xB7,0x9E,0x7B,0xC7,0xFE,0xE7,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0x9E,0xFF,
-    0xBE,0xFF,0xBE,0xFF,0xBE,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xF7,0xBE,0xF7,0xDE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xBE,0xF7,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0x9E,0xF7,0xBE,0xFF,0xBE,0xFF,0xDE,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xBE,0xF7,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0x9E,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xF7,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBE,0xF7,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xEF,0x9C,0xCF,0x39,0xB7,
-    0x72,0x6D,0x89,0x23,0x48,0x13,0x68,0x0B,0x68,0x0B,0xA8,0x03,0xA8,0x03,0x88,0x03,0x88,0x0B,0xEB,0x33,0xBC,0xD7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xE7,0xCB,0x33,0x68,0x13,0x88,0x0B,0x88,0x0B,0x68,0x13,0x48,0x1B,0x8A,0x2B,0x8F,0x5C,0xFD,0xD7,0xFE,0xE7,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x6D,0x73,0x48,0x52,0x48,0x52,0x68,0x52,0x68,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x68,0x52,0x68,0x52,0x18,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xA9,0x5A,0x68,0x52,0x48,0x52,0x48,0x52,0x68,0x52,0x89,0x5A,0x34,0xAD,0xDF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD2,0x9C,0x89,0x52,0x68,0x52,0x48,0x52,0x48,0x52,0x68,0x52,0x48,0x52,0x68,0x52,0x48,0x52,0x68,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x68,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x68,0x52,0x48,0x52,0xCA,0x62,0xF2,0xA4,0x99,0xDE,0x9E,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0x68,0x52,0x68,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x68,0x52,0x3C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xC5,0x89,0x5A,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x69,0x52,0x69,0x52,0x79,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xF7,0xFE,0xEF,0xFD,0xDF,0xF5,0x8D,0xCB,0x3B,0x48,0x1B,0x68,0x13,0x88,0x0B,0x88,0x03,0x88,0x0B,0x89,0x23,0x15,0x96,0xFF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x7B,0xCF,0x49,0x23,0x68,0x13,0x48,0x13,0xAA,0x23,0x4D,0x44,0xD4,0x7D,0x9C,0xC7,0xFF,0xE7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xBE,0xFF,0x4C,0x6B,0x48,0x52,0x68,0x52,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x68,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x68,0x52,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x68,0x52,0x17,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x17,0xC6,0x68,0x52,0x68,0x52,0x48,0x5A,0x68,0x5A,0x48,0x52,0x68,0x52,0xEF,0x83,0x5C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD2,0x9C,0x89,0x52,0x68,0x52,0x48,0x52,0x48,0x52,0x68,0x5A,0x68,0x5A,0x48,0x52,
-    0x68,0x5A,0x48,0x52,0x68,0x52,0x68,0x52,0x68,0x52,0x68,0x52,0x68,0x52,0x68,0x52,0x68,0x52,0x68,0x52,0x68,0x52,0x68,0x52,0x68,0x52,0x68,0x52,0x68,0x5A,0x68,0x52,0x6C,0x73,0x17,0xC6,0xBE,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0x68,0x52,0x68,0x52,0x48,0x52,0x68,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x68,0x52,0x71,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x30,0x8C,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x68,0x52,0x48,0x52,0x48,0x52,0x69,0x52,0x79,0xD6,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xEF,0xFE,0xDF,0x76,0x9E,0xF0,0x5C,0xEB,0x33,0x69,0x1B,0x68,0x13,0x49,0x1B,0x11,0x75,0xFE,0xE7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xEF,0x73,0x8D,0x09,0x23,0xCB,0x33,0x11,0x6D,0x56,0x9E,0x9C,0xD7,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xB2,0x9C,0x0F,0x8C,0x0F,0x8C,0xAE,0x7B,0x89,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xAA,0x62,0xEF,0x8B,0x0F,0x8C,0x0F,0x8C,0x0F,0x8C,0x0F,0x8C,0xEF,0x83,0xAE,0x7B,0xEB,0x62,
-    0x68,0x52,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x17,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xCE,0x83,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0xEA,0x62,0x38,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xBD,0x0F,0x8C,0x0F,0x8C,0xEF,0x83,0x2C,0x6B,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x68,0x52,0x0F,0x8C,0x50,0x94,0x50,0x8C,0x50,0x8C,0x50,0x8C,0x30,0x8C,0x0F,0x8C,0x8D,0x7B,0x68,0x52,0x68,0x52,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x52,0xEB,0x62,0xD6,0xBD,0xBE,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x0F,0x84,0x0F,0x8C,0xEF,0x83,0x0B,0x6B,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x2C,0x6B,0x7D,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBA,0xDE,0x2C,0x73,0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0xCA,0x62,0xEF,0x83,0x0F,0x8C,0x0F,0x84,0xDB,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xEF,0xFE,0xE7,0xF9,0xB6,0xB3,0x85,0x4D,0x4C,0x29,0x2B,0x4E,0x5C,0x7C,0xD7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFE,0xEF,0xEE,0x63,0xD4,0x8D,0x3A,0xBF,0xDE,0xDF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0x7D,0xEF,0x5C,0xEF,0x3B,0xEF,0x54,0xB5,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x4C,0x73,0x5C,0xF7,0x5D,0xEF,0x5D,0xEF,0x5D,0xEF,0x5D,0xEF,0x5C,0xEF,0x1B,0xEF,0xBA,0xDE,0xF6,0xC5,0xCE,0x83,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x17,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xD6,0x0B,0x6B,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,
-    0x48,0x5A,0x68,0x5A,0x68,0x5A,0xD2,0xA4,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x5D,0xEF,0x5D,0xEF,0x5C,0xF7,0xBA,0xDE,0x0B,0x6B,0x48,0x5A,0x48,0x5A,0x48,0x52,0x68,0x52,0x48,0x52,0xFB,0xE6,0x7D,0xF7,0x7D,0xF7,0x7D,0xF7,0x7D,0xF7,0x7D,0xF7,0x5C,0xEF,0x1B,0xE7,0x58,0xD6,0x0F,0x8C,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x2C,0x6B,0x7D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xEF,0x7C,0xEF,0x5C,0xEF,0xB9,0xDE,0x89,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0xAA,0x62,0xF7,0xC5,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x54,0xB5,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0x48,0x52,0xF6,0xC5,0x5C,0xEF,0x7C,0xEF,0x5D,0xEF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFE,0xE7,0x9B,0xCF,0x77,0xA6,0xB0,0x74,0x98,0xB6,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDE,0xEF,0xFE,0xEF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE6,0x69,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x8D,0x7B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x9D,0xF7,0x0F,0x8C,0x68,0x52,0x68,0x5A,0x48,0x5A,0x68,0x52,0x17,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x34,0xAD,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0xCA,0x62,0x1B,0xE7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xDE,0xFF,0x4C,0x73,0x68,0x52,0x68,0x5A,0x48,0x52,0x68,0x52,0x68,0x52,0x5C,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xEF,0xCE,0x83,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x69,0x52,0x79,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xCA,0x62,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xAD,0x83,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x91,0x9C,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xF7,0x50,0x94,0x48,0x5A,0x48,0x5A,0x89,0x5A,0xEA,0x6A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x69,0x52,0xDA,0xDE,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFE,0xEF,0xFE,0xEF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE6,0x69,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x6D,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xDE,0xFF,0x3C,0xE7,0xDB,0xDE,0xDB,0xDE,0xBE,0xF7,0xFF,0xFF,0x1B,0xE7,0xCA,0x62,0x48,0x5A,0x48,0x5A,0x68,0x52,0x17,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xEF,0xEF,0x83,0x48,0x5A,0x48,0x5A,0x89,0x62,0x4C,0x73,0xAA,0x62,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0xD6,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x4C,0x73,0x68,0x52,0x68,0x5A,0x68,0x5A,0x48,0x52,0x69,0x52,0x5D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x13,0xAD,0x89,0x5A,0x68,0x5A,
-    0x68,0x5A,0x48,0x5A,0x48,0x52,0x75,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xAA,0x62,0x68,0x5A,0x48,0x5A,0x48,0x52,0x70,0x94,0x8C,0x7B,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0xAD,0x7B,0x1B,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xD6,0x69,0x5A,0x48,0x5A,0x48,0x5A,0x2C,0x73,0x13,0xAD,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0xDA,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE6,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x6D,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xEF,0x30,0x8C,0xCA,0x62,0xEB,0x62,0x1B,0xE7,0xDE,0xFF,0xDE,0xFF,0x71,0x94,0x68,0x5A,0x48,0x5A,0x68,0x52,0x17,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x38,0xCE,0x89,0x5A,0x48,0x52,
-    0x68,0x5A,0x0B,0x6B,0xF7,0xC5,0x8D,0x7B,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x2C,0x6B,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x6C,0x73,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x69,0x52,0x5D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x75,0xB5,0xA9,0x62,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0x75,0xB5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xCA,0x62,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x70,0x94,0x95,0xBD,0x68,0x5A,0x68,0x5A,
-    0x48,0x5A,0x68,0x52,0xCA,0x62,0xF7,0xC5,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF3,0xA4,0x68,0x52,0x48,0x5A,0x48,0x5A,0x70,0x94,0x75,0xBD,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0xDA,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE6,0x69,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x6D,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE6,0x8D,0x73,0x68,0x52,0x69,0x5A,0xFB,0xE6,0xFF,0xFF,0xFF,0xFF,0xBA,0xDE,0x68,0x52,0x48,0x52,0x68,0x52,0x17,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xB1,0x9C,0x48,0x5A,0x48,0x5A,0x68,0x52,0xEF,0x8B,0x9E,0xFF,0xB1,0x9C,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x38,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x6C,0x73,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x69,0x52,0x5C,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x13,0xA5,0x69,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x69,0x52,0x58,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xCA,0x62,0x68,0x5A,0x48,0x5A,0x68,0x52,0x70,0x94,0xBA,0xDE,0x0A,0x6B,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0xF3,0xA4,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xCA,0x62,0x48,0x5A,0x48,0x52,0x48,0x52,0xBA,0xDE,0x95,0xBD,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,
-    0x89,0x5A,0xDA,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE6,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x6D,0x73,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x38,0xCE,0xA9,0x5A,0x68,0x5A,0x69,0x5A,0xFB,0xE6,0xFF,0xFF,0xDF,0xFF,0xDE,0xFF,0x89,0x5A,0x48,0x52,0x68,0x52,0x18,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xF7,0xCA,0x62,0x48,0x5A,0x48,0x5A,0x48,0x52,0xB6,0xBD,0xDF,0xFF,0x1B,0xE7,0xA9,0x62,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x69,0x5A,0x0B,0x6B,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x4C,0x6B,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x5C,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0x5C,0xEF,0x0F,0x8C,0x48,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0xEA,0x62,0x7D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xCA,0x62,0x68,0x5A,0x48,0x5A,0x68,0x52,0x71,0x94,0x5C,0xEF,0x2F,0x8C,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x52,0x2C,0x73,0x3C,0xEF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xBD,0x68,0x52,0x48,0x5A,0x68,0x5A,0x0B,0x6B,0xBE,0xFF,0x75,0xB5,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0xDA,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE6,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x6C,0x73,0xBE,0xFF,0xDE,0xFF,0xBE,0xFF,0x3C,0xEF,0x71,0x94,0x68,0x52,0x68,0x5A,0x68,0x5A,0xFB,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4C,0x73,0xA9,0x5A,0xAA,0x5A,0x38,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xB6,0xBD,0x68,0x52,0x48,0x5A,0x48,0x5A,0xAA,0x62,0xDE,0xFF,0xDF,0xFF,0xDE,0xFF,0x4C,0x73,0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0xAA,0x5A,0x1B,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x6C,0x73,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x3B,0xEF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0xBE,0xFF,0x7D,0xF7,0xDA,0xE6,0xD2,0xA4,0x48,0x52,0x48,0x52,0x68,0x5A,0x48,0x5A,0xAA,0x62,0xD6,0xBD,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xCA,0x62,0x68,0x5A,0x48,0x5A,0x68,0x5A,
-    0x71,0x94,0xFF,0xFF,0x95,0xBD,0x89,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x99,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x2C,0x6B,0x48,0x52,0x48,0x5A,0x68,0x5A,0xF6,0xC5,0xDE,0xFF,0x95,0xBD,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0xDA,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE6,0x69,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xEA,0x6A,0x34,0xB5,0x34,0xAD,0x13,0xAD,0xAE,0x83,0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0xFB,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xC5,0x75,0xB5,0x75,0xB5,0x1C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xEB,0x6A,0x48,0x52,0x48,0x5A,0x48,0x5A,0xB2,0x9C,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x58,0xD6,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x71,0x94,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x4C,0x6B,0x68,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0xB2,0xA4,0xF3,0xAC,0xF3,0xA4,0xF3,0xAC,0xF3,0xA4,0xF2,0xA4,0xD2,0xA4,0x2F,0x8C,0x69,0x5A,0x48,0x52,0x68,0x52,0x48,0x52,0x68,0x52,0x6C,0x73,0x95,0xBD,0x9E,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xCA,0x62,0x48,0x52,0x48,0x5A,0x68,0x52,0x71,0x94,0xDF,0xFF,0xBA,0xDE,0x2C,0x73,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0xB1,0x9C,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0xD6,0x68,0x52,0x68,0x5A,0x48,0x5A,0xEB,0x62,0x5D,0xF7,0xFF,0xFF,0x95,0xBD,
-    0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0xDA,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE6,0x69,0x5A,0x48,0x5A,
-    0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x68,0x52,0x48,0x52,0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xFB,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x38,0xCE,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x89,0x5A,0x3C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x0B,0x6B,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x6C,0x73,0xDA,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x6C,0x73,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x48,0x52,0x68,0x52,0x68,0x52,0x68,0x52,0x48,0x52,
-    0x68,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x68,0x5A,0x0B,0x6B,0xEE,0x8B,0x95,0xBD,0xDA,0xDE,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xCA,0x62,0x68,0x5A,0x68,0x5A,0x68,0x52,0x71,0x94,0xDF,0xFF,0xBE,0xFF,0x2F,0x8C,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xAA,0x5A,0xDE,0xFF,0xFF,0xFF,0xDE,0xFF,0x70,0x94,0x68,0x52,0x48,0x52,0x68,0x52,0xB2,0x9C,0xBE,0xFF,0xFF,0xFF,0x95,0xB5,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0xDA,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE6,0x89,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xFB,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xCE,0x83,0x48,0x5A,0x48,0x5A,0x49,0x5A,0x8D,0x7B,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xF6,0xC5,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x52,0x89,0x5A,0x95,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x6C,0x73,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x48,0x52,0x68,0x52,0x68,0x52,0x68,0x52,0x68,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x2C,0x73,0xD2,0xA4,0xFB,0xE6,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,
-    0xCA,0x62,0x68,0x5A,0x48,0x5A,0x48,0x52,0x71,0x94,0xDF,0xFF,0xDF,0xFF,0x75,0xB5,0x89,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x17,0xC6,0xDE,0xFF,0xFB,0xE6,0x4C,0x73,0x48,0x52,0x48,0x5A,0x89,0x5A,0x38,0xCE,0xDF,0xFF,0xFF,0xFF,0x95,0xB5,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0xDA,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE6,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x2C,0x73,0x17,0xCE,0x37,0xCE,0x95,0xBD,0x2C,0x6B,0x89,0x5A,0x68,0x52,0x68,0x5A,0x68,0x52,0xFB,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1B,0xE7,0x0B,0x6B,0x68,0x5A,0x48,0x5A,0x48,0x52,0xB6,0xBD,0x5C,0xEF,0x5C,0xEF,0x5D,0xEF,0x5C,0xEF,0x3C,0xEF,0x99,0xDE,0xAA,0x62,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0xEF,0x83,
-    0x5C,0xEF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x6C,0x73,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0xDA,0xE6,0x7C,0xF7,0x7D,0xF7,0x1B,0xEF,0x99,0xDE,0xD2,0xA4,0x0B,0x6B,0x69,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x89,0x5A,0x13,0xA5,0x9D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xCA,0x62,0x68,0x5A,0x48,0x5A,0x68,0x52,0x71,0x94,0xDF,0xFF,0xFF,0xFF,0xDE,0xFF,0xCA,0x62,0x48,0x5A,0x48,0x52,0x68,0x5A,0x48,0x52,0x2C,0x6B,0xDE,0xFF,0x75,0xB5,0xA9,0x62,0x48,0x52,0x68,0x5A,0xAD,0x7B,
-    0x1B,0xE7,0xFF,0xFF,0xFF,0xFF,0x95,0xB5,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0xDA,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFB,0xE6,0x89,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x6D,0x73,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBE,0xFF,0xD2,0xA4,0x68,0x52,0x68,0x5A,0x68,0x52,0xFB,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0xA4,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x89,0x62,0xA9,0x5A,0xA9,0x5A,0xA9,0x5A,0xAA,0x5A,0x89,0x5A,0xA9,0x5A,0x68,0x5A,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x52,0xAA,0x62,0x79,0xD6,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x6C,0x73,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x5C,0xF7,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x5C,0xEF,0x50,0x94,0x68,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x34,0xAD,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xCA,0x62,0x68,0x5A,0x48,0x5A,0x68,0x52,0x71,0x94,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x83,0x48,0x52,0x48,0x5A,0x48,0x52,0x68,0x52,0xAA,0x62,0xBA,0xDE,0x2F,0x8C,0x48,0x52,0x68,0x5A,0x68,0x5A,0xF3,0xA4,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0x95,0xB5,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0xDA,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE6,0x89,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x6D,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0xD6,0xEB,0x6A,0x68,0x52,0x68,0x52,0xFB,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xEF,0xCE,0x83,0x68,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x68,0x52,0x68,0x5A,0x68,0x52,0x48,0x52,0x68,0x52,0x48,0x52,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xD2,0x9C,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x6C,0x73,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x5C,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xF7,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x8D,0x7B,0x9D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xCA,0x62,0x68,0x5A,0x48,0x5A,0x68,0x52,0x71,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xE6,0x68,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x69,0x5A,0xAE,0x83,0x0B,0x6B,0x68,0x5A,0x48,0x52,0xEB,0x6A,0x58,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x95,0xB5,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x89,0x5A,0xDA,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE6,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x6D,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE6,0x8D,0x7B,0x68,0x52,0x68,0x52,0xFB,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x37,0xCE,0x89,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x0B,0x6B,0x4C,0x73,0x4C,0x6B,0x4C,0x6B,0x4C,0x73,0x4C,0x73,0x4C,0x6B,0x4C,0x6B,0x2C,0x6B,0xAA,0x62,
-    0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0xCA,0x62,0x7D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x6C,0x73,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x49,0x52,0x5C,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD2,0xA4,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x2C,0x73,0xFB,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xCA,0x62,0x68,0x5A,0x48,0x5A,0x68,0x52,0x71,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x0B,0x6B,0x68,0x52,0x48,0x5A,0x48,0x5A,0x48,0x52,0x68,0x5A,0x68,0x5A,
-    0x48,0x5A,0x48,0x5A,0x8D,0x7B,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x95,0xB5,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0xDA,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE6,0x69,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x6D,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0xE7,0xCE,0x7B,0x68,0x52,0x69,0x52,0xFB,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0xB2,0x9C,0x68,0x52,0x68,0x5A,0x48,0x52,0xCE,0x83,0x9D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x14,0xAD,0x89,0x5A,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x52,0xD6,0xBD,0xDE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x6C,0x73,0x68,0x52,0x68,0x5A,
-    0x68,0x5A,0x48,0x5A,0x49,0x52,0x5C,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBA,0xDE,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x2C,0x73,0xBA,0xDE,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0x3C,0xEF,0x5D,0xEF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xCA,0x62,0x68,0x5A,0x48,0x5A,0x68,0x52,0x71,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xF7,0xC5,0x48,0x52,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x34,0xAD,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x95,0xB5,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0xDA,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE6,0x69,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x6D,0x73,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xEF,0x75,0xAD,0x91,0x94,0x91,0x94,
-    0x3C,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xEF,0xEB,0x62,0x48,0x5A,0x48,0x5A,0x69,0x52,0x34,0xAD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFB,0xE6,0xEB,0x6A,0x48,0x52,0x48,0x5A,0x48,0x52,0x68,0x5A,0xA9,0x5A,0x9D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x6C,0x73,0x68,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x52,0x5C,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x5C,0xEF,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x0B,0x6B,0x58,0xCE,0xFF,0xFF,0xFF,0xFF,
-    0x0B,0x6B,0x69,0x52,0x4C,0x6B,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xCA,0x62,0x68,0x5A,0x48,0x5A,0x68,0x52,0x71,0x94,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE6,0xCA,0x62,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x69,0x5A,0x7D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x95,0xB5,0x68,0x52,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x69,0x5A,0xDA,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0xE6,0x69,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x8D,0x7B,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xB6,0xBD,0x68,0x52,0x48,0x5A,0x48,0x5A,0xAA,0x62,0x1B,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDE,0xFF,0xCE,0x83,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0xB6,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x4C,0x73,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x52,0x5C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xF7,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xA9,0x5A,0xB5,0xBD,0xDF,0xFF,0xDF,0xFF,0xEB,0x6A,0x48,0x52,0x4C,0x6B,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xAA,0x62,0x68,0x5A,0x48,0x5A,0x68,0x52,0x71,0x94,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0x30,0x8C,0x68,0x52,
-    0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x0F,0x8C,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x95,0xB5,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x69,0x5A,0xDA,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x78,0xD6,0x69,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x4C,0x73,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xF7,0x0B,0x6B,0x48,0x5A,0x48,0x5A,0x48,0x5A,0xAE,0x7B,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x38,0xCE,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x8D,0x7B,0x5C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xDE,0xFF,0x4C,0x73,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x68,0x52,0x5C,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xF7,0x68,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x13,0xAD,0xDE,0xFF,0xDE,0xFF,0xAA,0x5A,0x68,0x52,0xAD,0x7B,0x7D,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xAA,0x62,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x50,0x94,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x95,0xBD,0x69,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0xDA,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x95,0xB5,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x89,0x5A,0xBA,0xE6,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDE,0xFF,0xFB,0xE6,0x6C,0x73,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xA9,0x5A,0x54,0xB5,0x9D,0xF7,0xDE,0xFF,0xDE,0xFF,
-    0xDE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x9D,0xF7,0x17,0xCE,0x2C,0x6B,0x68,0x52,0x68,0x5A,0x68,0x5A,0x48,0x5A,0xEF,0x8B,0xBE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0x99,0xDE,0x69,0x52,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0xAE,0x7B,0x58,0xD6,0xBE,0xFF,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0x79,0xD6,0x0B,0x6B,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x48,0x52,0x33,0xAD,0xBE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0x48,0x52,0x48,0x52,0x48,0x5A,0x68,0x5A,
-    0x68,0x5A,0xAD,0x7B,0xFA,0xE6,0xB6,0xBD,0x68,0x52,0x48,0x52,0x71,0x94,0x9E,0xF7,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0x79,0xD6,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,0xEA,0x62,0xBA,0xDE,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0x99,0xDE,0x4C,0x73,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x6D,0x73,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xDE,0xFF,0x3C,0xEF,0xEF,0x8B,0x48,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0xB1,0x9C,0x9E,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x8D,0x73,0xAA,0x5A,0x89,0x5A,0x68,0x52,0x48,0x52,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x68,0x5A,0xA9,0x5A,0xCA,0x62,0x13,0xA5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0B,0x6B,0x68,0x52,0x48,0x52,0x68,0x52,0x68,0x52,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x52,0x89,0x5A,0xAA,0x5A,0xAA,0x5A,
-    0xA9,0x5A,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0x6C,0x73,0xA9,0x5A,0xA9,0x5A,0x89,0x5A,0x68,0x5A,0x48,0x52,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x8D,0x73,0xBE,0xFF,0xF3,0xA4,0xAA,0x5A,0xA9,0x5A,0x89,0x5A,0x48,0x52,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x52,0x68,0x52,0x89,0x5A,0x89,0x5A,0x89,0x5A,0x6D,0x73,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xF7,0x0B,0x6B,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x28,0x52,0x69,0x5A,0x48,0x52,0x68,0x5A,0x89,0x5A,0x17,0xC6,0x9D,0xF7,0xA9,0x5A,0xA9,0x5A,0x89,0x5A,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x48,0x52,0x68,0x5A,0x68,0x52,0x89,0x5A,0x89,0x5A,
-    0xAA,0x5A,0xDE,0xFF,0x9D,0xFF,0x50,0x94,0x68,0x5A,0x48,0x52,0x68,0x5A,0x68,0x5A,0x75,0xB5,0xDE,0xFF,0x1B,0xE7,0xAE,0x7B,0xA9,0x5A,0xA9,0x62,0x68,0x52,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x52,0x69,0x5A,0xAA,0x5A,0xA9,0x5A,0x79,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x4C,0x6B,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x68,0x52,0x68,0x52,0x68,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x68,0x52,0x68,0x52,0x69,0x52,0xF3,0xA4,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCA,0x62,0x68,0x52,0x48,0x52,0x48,0x52,0x68,0x52,0x68,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x68,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x5C,0xEF,0xFF,0xFF,0xFF,0xFF,0x2C,0x6B,0x68,0x52,0x68,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x68,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x68,0x52,0x4C,0x73,0xDE,0xFF,
-    0xB2,0x9C,0x89,0x5A,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x68,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x2C,0x6B,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x75,0xB5,0x89,0x5A,0x68,0x5A,0x48,0x52,0x48,0x5A,0x48,0x52,0x68,0x52,0x48,0x52,0x69,0x5A,0xEF,0x83,0x1B,0xE7,0x9D,0xF7,0x68,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x69,0x52,0xDF,0xFF,0xDF,0xFF,0x95,0xB5,0xA9,0x5A,0x68,0x52,0x48,0x52,0xEB,0x6A,0xDA,0xDE,0xDE,0xFF,0x1B,0xE7,0x6D,0x73,0x48,0x52,0x48,0x52,0x48,0x52,0x68,0x52,0x48,0x52,0x48,0x52,0x48,0x52,0x48,0x52,
-    0x48,0x52,0x48,0x5A,0x48,0x52,0x68,0x52,0x68,0x52,0x79,0xD6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xB2,0x9C,0x30,0x8C,0x2F,0x8C,0x2F,0x8C,0x2F,0x8C,0x2F,0x8C,0x2F,0x8C,0x2F,0x8C,0x0F,0x8C,0x10,0x8C,0x10,0x8C,
-    0x2F,0x8C,0x2F,0x8C,0x2F,0x8C,0x50,0x8C,0xF7,0xC5,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x71,0x94,0x30,0x8C,0x2F,0x8C,0x2F,0x8C,0x2F,0x8C,0x2F,0x8C,0x10,0x8C,0x10,0x8C,0x30,0x8C,0x2F,0x8C,0x2F,0x8C,0x30,0x8C,0x30,0x8C,0x9D,0xF7,0xFF,0xFF,0xFF,0xFF,0xB2,0x9C,0x30,0x8C,0x2F,0x8C,0x2F,0x8C,0x10,0x8C,0x30,0x8C,0x10,0x8C,0x10,0x8C,0x30,0x8C,0x30,0x8C,0x10,0x8C,0x30,0x8C,0x2F,0x8C,0x30,0x8C,0xD2,0x9C,0xDE,0xFF,0xD6,0xBD,0x30,0x8C,0x30,0x8C,0x2F,0x8C,0x2F,0x8C,0x2F,0x8C,0x30,0x8C,0x2F,0x8C,0x2F,0x8C,0x2F,0x8C,0x30,0x8C,0x10,0x8C,0x2F,0x8C,0x0F,0x8C,0x0F,0x8C,0xB2,0x9C,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0x5D,0xEF,0xF3,0xA4,0xCA,0x62,0x48,0x52,0x68,0x52,0x48,0x52,0x68,0x52,0x89,0x5A,0x50,0x94,0xFB,0xE6,0xFF,0xFF,0x9E,0xF7,0x30,0x8C,0x2F,0x8C,0x2F,0x8C,0x2F,0x8C,0x0F,0x8C,0x2F,0x8C,0x10,0x8C,0x10,0x8C,0x2F,0x8C,0x2F,0x8C,0x2F,0x8C,0x10,0x8C,0x30,0x8C,0xFF,0xFF,0xFF,0xFF,0x3C,0xEF,0x91,0x94,0x0F,0x8C,0x0F,0x8C,0x54,0xAD,0x9D,0xF7,0xFF,0xFF,0x5C,0xEF,0xF3,0xA4,0x30,0x8C,0x30,0x8C,0x30,0x8C,0x10,0x8C,0x0F,0x8C,0x2F,0x8C,0x10,0x8C,0x30,0x8C,0x10,0x8C,0x0F,0x8C,0x2F,0x8C,0x2F,0x8C,0x2F,0x8C,0xFB,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,
-    0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xBE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xFF,0xFF,0xDF,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x7D,0xF7,0x79,0xD6,0xB6,0xBD,0x75,0xB5,0x58,0xCE,0x7C,0xEF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,
-    0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xDE,0xFF,0xBE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xDE,0xFF,0xBE,0xFF,0xDE,0xFF,0xBE,0xFF,0xDE,0xFF,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+#ifndef LV_ATTRIBUTE_LARGE_CONST
+    #define LV_ATTRIBUTE_LARGE_CONST
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST uint8_t ui_img_cgflogo_png_data[] = {
+    0x4C,0x56,0x54,0x49,0x01,0x04,0x02,0x10,0x2C,0x01,0xAD,0x00,0x40,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x24,0x00,0x00,0x00,
+    0x36,0x00,0x00,0x00,0x48,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x6A,0x00,0x00,0x00,0xC3,0x01,0x00,0x00,0x32,0x04,0x00,0x00,0x04,0x05,0x00,0x00,0x14,0x05,0x00,0x00,
+    0x74,0x06,0x00,0x00,0x32,0x0C,0x00,0x00,0x36,0x11,0x00,0x00,0x25,0x17,0x00,0x00,0xF2,0x17,0x00,0x00,0xEC,0x1C,0x00,0x00,0x04,0x23,0x00,0x00,0x44,0x28,0x00,0x00,
+    0xA2,0x2E,0x00,0x00,0x61,0x32,0x00,0x00,0x75,0x38,0x00,0x00,0xAE,0x3D,0x00,0x00,0x2D,0x42,0x00,0x00,0x9A,0x47,0x00,0x00,0xA3,0x4B,0x00,0x00,0x1A,0x50,0x00,0x00,
+    0x2D,0x53,0x00,0x00,0x13,0x59,0x00,0x00,0xAE,0x5B,0x00,0x00,0x72,0x5E,0x00,0x00,0x7D,0x60,0x00,0x00,0xD8,0x66,0x00,0x00,0x52,0x6C,0x00,0x00,0x64,0x72,0x00,0x00,
+    0xFA,0x72,0x00,0x00,0x54,0x74,0x00,0x00,0xE6,0x76,0x00,0x00,0xAE,0x79,0x00,0x00,0x34,0x7D,0x00,0x00,0x52,0x7D,0x00,0x00,0x64,0x7D,0x00,0x00,0x17,0x80,0x00,0x00,
+    0x72,0x84,0x00,0x00,0x84,0x86,0x00,0x00,0x94,0x86,0x00,0x00,0xA6,0x86,0x00,0x00,0x6B,0x87,0x00,0x00,0xE3,0x88,0x00,0x00,0xAD,0x89,0x00,0x00,0xBD,0x89,0x00,0x00,
+    0xCE,0x89,0x00,0x00,0xDF,0x89,0x00,0x00,0xF0,0x89,0x00,0x00,0x01,0x8A,0x00,0x00,0x10,0x8A,0x00,0x00,0x1F,0xFF,0x01,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,
+    0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xFF,0x01,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xFF,0x01,0x00,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xEE,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xFF,0x01,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xFF,0x01,0x00,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0x6C,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xFF,0x01,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xFF,
+    0x01,0x00,0xFF,0xFF,0xFF,0xFF,0xD2,0x9D,0xDE,0xFF,0xBE,0xFF,0xBE,0xFF,0xDE,0xFF,0xDE,0xEA,0x04,0x4D,0xBE,0xF7,0x71,0x94,0x15,0x00,0x0F,0x11,0x00,0x36,0xF7,0x08,
+    0xBE,0xFF,0xDB,0xE6,0x58,0xD6,0x54,0xB5,0x30,0x8C,0x2C,0x73,0x0B,0x6B,0x8D,0x7B,0xD2,0x9C,0x17,0xC6,0xDA,0xE6,0xDF,0x60,0x00,0x47,0xDE,0xFF,0xAE,0x7B,0x0F,0x00,
+    0x0F,0x0B,0x00,0x38,0xE0,0xDF,0xFF,0x1B,0xE7,0x34,0xAD,0x4C,0x73,0x48,0x52,0x68,0x5A,0x48,0x52,0x02,0x00,0xC2,0x68,0x52,0x68,0x52,0x48,0x52,0x4C,0x73,0x54,0xAD,
+    0x7D,0xF7,0x69,0x00,0x5F,0x9D,0xF7,0x5C,0xEF,0xAD,0x80,0x00,0x2C,0x00,0xCE,0x00,0x80,0xDE,0xFF,0x1B,0xE7,0x79,0xD6,0xFB,0xDE,0x0C,0x00,0x02,0x5A,0x00,0xD4,0xDF,
+    0xFF,0x3C,0xEF,0x6D,0x7B,0x89,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x06,0x00,0x01,0x8A,0x00,0xFF,0x02,0x68,0x52,0x69,0x5A,0x91,0x94,0x7D,0xEF,0xFF,0xFF,0xDF,0xFF,0xF7,
+    0xC5,0x34,0xAD,0x8D,0x80,0x00,0x28,0xF6,0x01,0x7D,0xF7,0xF7,0xC5,0xF3,0xA4,0xAE,0x7B,0xA9,0x5A,0x69,0x52,0x69,0x52,0xD2,0x9C,0x80,0x00,0x64,0xDE,0xFF,0xEA,0x62,
+    0x48,0x52,0x7E,0x00,0x02,0x82,0x00,0x06,0x0E,0x00,0x40,0x68,0x52,0x34,0xAD,0x0C,0x02,0x4F,0xD7,0xBD,0x10,0x8C,0x80,0x00,0x23,0x60,0xDF,0xFF,0xD6,0xBD,0x0B,0x63,
+    0x50,0x01,0xD3,0x48,0x52,0x68,0x52,0x68,0x5A,0x68,0x5A,0x68,0x52,0x50,0x94,0x9D,0x58,0x01,0x40,0xDE,0xFF,0x91,0x9C,0x7E,0x00,0x01,0x18,0x00,0x01,0xFE,0x00,0x04,
+    0x7C,0x00,0x03,0x0E,0x01,0xCF,0x52,0xA9,0x5A,0x79,0xD6,0xFF,0xFF,0x38,0xCE,0x8D,0x7B,0x30,0x80,0x02,0x08,0x06,0xD0,0x00,0x02,0x56,0x01,0x06,0x06,0x00,0x40,0xBE,
+    0xFF,0xF3,0xA4,0xDA,0x01,0x02,0xDA,0x00,0x02,0x06,0x00,0x40,0xEF,0x83,0x3C,0xEF,0x22,0x00,0x60,0xDF,0xFF,0xDA,0xE6,0x0B,0x6B,0x6A,0x00,0x00,0x80,0x00,0x00,0x7A,
+    0x00,0x12,0x48,0x02,0x02,0x03,0x8A,0x01,0x01,0x12,0x00,0xB0,0x52,0x50,0x94,0xDF,0xFF,0x79,0xD6,0x0C,0x6B,0x13,0xAD,0x1F,0xFF,0x01,0x00,0xFF,0xFF,0xFF,0x8D,0x51,
+    0xDE,0xFF,0xDE,0xFF,0xBE,0x02,0x00,0x1F,0xDE,0xA8,0x03,0x18,0x15,0xDF,0x36,0x00,0x1F,0xDF,0x36,0x00,0x10,0xAA,0xDE,0xFF,0x9D,0xF7,0x5C,0xEF,0x1B,0xE7,0xFB,0xE6,
+    0x2E,0x00,0x71,0xDE,0xFF,0xEF,0x83,0xAE,0x7B,0x8D,0x02,0x00,0x6F,0x6D,0x73,0x13,0xA5,0xBE,0xF7,0x4D,0x00,0x10,0xFA,0x08,0xFF,0x9E,0xF7,0x58,0xCE,0x71,0x94,0x8D,
+    0x7B,0x6C,0x73,0x6C,0x73,0x6D,0x73,0xCE,0x83,0x13,0xAD,0xBA,0xDE,0xBE,0xFF,0x5A,0x00,0x17,0xDF,0x10,0x00,0xCA,0xEB,0x62,0xA9,0x5A,0x89,0x5A,0x69,0x52,0x69,0x52,
+    0x0B,0x6B,0x82,0x00,0xFF,0x02,0xDE,0xFF,0x69,0x52,0x48,0x52,0x68,0x52,0x68,0x5A,0x48,0x52,0x48,0x52,0x50,0x8C,0x9D,0x80,0x00,0x0E,0x80,0xDE,0xFF,0xFB,0xE6,0x6C,
+    0x73,0x68,0x52,0x30,0x00,0x20,0x68,0x5A,0x02,0x00,0x00,0x0A,0x00,0x68,0x69,0x52,0xEF,0x83,0x3C,0xEF,0xBC,0x00,0x71,0xDF,0xFF,0x7D,0xF7,0x3C,0xEF,0x9E,0x58,0x01,
+    0xE4,0x68,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x89,0x5A,0x13,0xA5,0x66,0x01,0x71,0xBE,0xFF,0xFB,0xE6,0x7D,0xF7,0x69,0x1A,0x00,0x00,0x48,0x00,0x4F,0x68,
+    0x5A,0xEF,0x83,0x80,0x00,0x0D,0x80,0xDE,0xFF,0xF7,0xC5,0x69,0x5A,0x48,0x52,0x30,0x00,0x02,0x54,0x00,0x00,0x56,0x00,0x00,0x0A,0x00,0x75,0x48,0x52,0xCA,0x62,0x17,
+    0xCE,0xBE,0x83,0x00,0xC1,0xDF,0xFF,0x34,0xAD,0x89,0x5A,0x89,0x5A,0xAA,0x62,0xEB,0x6A,0x20,0x00,0x01,0x80,0x00,0x35,0x68,0x5A,0xCF,0xA8,0x00,0x60,0x3C,0xE7,0xEF,
+    0x83,0x99,0xDE,0x80,0x00,0x03,0x20,0x00,0x2F,0x52,0xCE,0x80,0x00,0x0C,0x65,0xDF,0xFF,0x38,0xCE,0xCA,0x62,0x72,0x00,0x12,0x5A,0x38,0x00,0x06,0x06,0x00,0x42,0xAA,
+    0x62,0x17,0xC6,0x86,0x01,0x61,0x9D,0xF7,0xBE,0xFF,0x10,0x8C,0xF8,0x00,0x00,0x60,0x01,0x01,0x28,0x01,0x00,0xB4,0x00,0x10,0x68,0xA6,0x00,0x12,0xC6,0xA5,0x00,0x75,
+    0x1C,0xE7,0x4C,0x73,0x38,0xD6,0xAA,0x50,0x00,0x4F,0x68,0x52,0xAE,0x7B,0x00,0x01,0x0B,0x42,0x1B,0xE7,0xEF,0x83,0xFC,0x00,0x00,0x4C,0x00,0x02,0x78,0x00,0x06,0x0A,
+    0x00,0x00,0x62,0x01,0xE0,0xAD,0x7B,0x1B,0xE7,0xFF,0xFF,0xBE,0xFF,0x91,0x94,0xB6,0xBD,0xAE,0x7B,0x2C,0x00,0x00,0x26,0x00,0x00,0x24,0x00,0x02,0x04,0x00,0x62,0x48,
+    0x5A,0x68,0x52,0xD2,0xA4,0x26,0x01,0x80,0x5D,0xEF,0x4D,0x73,0xD6,0xC5,0xEA,0x6A,0x38,0x00,0x01,0x1E,0x00,0x4F,0x52,0xAE,0x7B,0x7D,0x00,0x02,0x06,0x71,0xDF,0xFF,
+    0x7D,0xEF,0xB2,0x9C,0x89,0xF4,0x00,0x00,0x2E,0x00,0x03,0x36,0x00,0x03,0xDA,0x01,0x05,0x14,0x01,0x30,0x52,0x75,0xB5,0x4E,0x03,0x62,0x6D,0x73,0x54,0xAD,0xAD,0x7B,
+    0x24,0x00,0x02,0x06,0x00,0x04,0x34,0x00,0x60,0x48,0x5A,0x0B,0x6B,0x1B,0xE7,0x26,0x01,0xA3,0xBE,0xFF,0x6D,0x73,0xB6,0xBD,0x0B,0x6B,0x48,0x52,0x22,0x00,0x2F,0x52,
+    0x8D,0x80,0x00,0x0A,0x40,0xB2,0x9C,0xB2,0x9C,0x52,0x01,0x02,0x4A,0x00,0x00,0x34,0x00,0x60,0xAD,0x83,0xB6,0xC5,0x13,0xAD,0xC2,0x00,0x00,0x0E,0x00,0x00,0x84,0x00,
+    0xEA,0x68,0x5A,0x50,0x94,0x7D,0xF7,0x9D,0xFF,0x0B,0x6B,0x75,0xB5,0x8D,0x7B,0xFC,0x00,0x00,0x20,0x00,0x01,0x12,0x00,0x30,0x52,0xD6,0xBD,0x82,0x01,0x86,0xDF,0xFF,
+    0x8D,0x7B,0x34,0xAD,0x2C,0x73,0x80,0x00,0x39,0x6D,0x73,0x7D,0xC4,0x02,0x00,0x26,0x00,0x04,0x04,0x00,0x60,0xF7,0xBD,0xF3,0xA4,0xAD,0x7B,0x44,0x00,0x04,0x80,0x00,
+    0xA1,0x48,0x5A,0x2C,0x6B,0x2F,0x8C,0xDA,0xE6,0x95,0xBD,0x56,0x00,0x01,0x60,0x02,0x40,0x48,0x5A,0xCA,0x62,0xD6,0x02,0xE0,0x0B,0x63,0x95,0xBD,0x8D,0x7B,0x48,0x5A,
+    0x68,0x5A,0x68,0x5A,0x68,0x5A,0x1F,0xFF,0x01,0x00,0xFF,0xFF,0xFF,0xFF,0x70,0x40,0xDE,0xFF,0xDF,0xFF,0x04,0x00,0x0F,0x87,0x04,0x65,0xFF,0x00,0xAE,0x83,0xD2,0xA4,
+    0x75,0xB5,0x17,0xCE,0x58,0xD6,0x99,0xD6,0x7D,0xF7,0xDF,0x87,0x00,0x5E,0xFF,0x04,0x48,0x52,0x48,0x52,0x68,0x5A,0x68,0x52,0x68,0x52,0xCA,0x62,0x30,0x8C,0x13,0xAD,
+    0xBA,0xDE,0xDE,0x84,0x00,0x5A,0x82,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x48,0x5A,0x88,0x00,0x8F,0x69,0x5A,0x0C,0x6B,0x50,0x94,0x3C,0xEF,0x83,0x00,0x57,0x01,0x7C,0x00,
+    0x03,0x84,0x00,0x03,0x0C,0x00,0x4F,0x52,0x2C,0x6B,0xBA,0x05,0x01,0x56,0x02,0x74,0x00,0x10,0x48,0x02,0x01,0x06,0x04,0x00,0x5A,0x52,0x8D,0x7B,0xDA,0xDE,0x0C,0x02,
+    0xFF,0x09,0xDE,0xFF,0xFB,0xE6,0xF7,0xC5,0xCE,0x83,0xEA,0x62,0x69,0x5A,0x68,0x52,0xAA,0x62,0x4C,0x73,0x30,0x8C,0x38,0xCE,0xFB,0xE6,0xBC,0x02,0x2D,0x01,0x80,0x00,
+    0x00,0x02,0x02,0x03,0x04,0x01,0x02,0x8A,0x00,0x57,0x68,0x52,0x71,0x94,0xBE,0x85,0x01,0x60,0xDF,0xFF,0x58,0xD6,0x6D,0x73,0x26,0x02,0x00,0xB0,0x01,0x21,0x48,0x52,
+    0x26,0x00,0x97,0x52,0x48,0x52,0x2C,0x6B,0x54,0xAD,0x3C,0xE7,0x29,0x00,0x0F,0x0B,0x00,0x19,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xFF,0x01,0x00,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0x6C,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xFF,0x01,0x00,0xFF,0xFF,0x66,0x8F,0xDF,0xFF,0xDF,0xFF,0xDE,0xFF,0xDA,0xDE,0x7F,0x02,0x65,0x8F,0x7D,0xEF,0xB2,0x9C,
+    0x2B,0x6B,0xCA,0x62,0x80,0x00,0x65,0x8F,0x3C,0xEF,0x69,0x52,0x68,0x5A,0x68,0x5A,0x80,0x00,0x67,0x5F,0x89,0x5A,0x48,0x5A,0x48,0x80,0x00,0x4E,0x99,0xDE,0xFF,0xDE,
+    0xFF,0x58,0xCE,0x55,0xAD,0xDF,0xE9,0x00,0x6F,0xBA,0xDE,0xF6,0xC5,0xCA,0x62,0x80,0x00,0x4D,0xE6,0xDF,0xFF,0xBE,0xFF,0xB2,0x9C,0x6D,0x73,0xEA,0x62,0x89,0x5A,0xBA,
+    0xDE,0x82,0x00,0x8F,0xDE,0xFF,0xD6,0xBD,0x70,0x94,0x0A,0x6B,0x80,0x00,0x47,0xB1,0xBE,0xF7,0x7D,0xEF,0x38,0xCE,0x0C,0x6B,0x68,0x52,0x68,0xE6,0x01,0x64,0x68,0x52,
+    0x8D,0x7B,0x9D,0xF7,0x03,0x01,0x9F,0xDE,0xFF,0x17,0xC6,0xCE,0x83,0x2B,0x73,0x48,0x00,0x02,0x46,0x80,0x13,0xA5,0xAA,0x5A,0x68,0x52,0x48,0x52,0x62,0x00,0x11,0x68,
+    0xE8,0x01,0x54,0x89,0x5A,0x34,0xAD,0xBE,0x81,0x00,0x7F,0xFF,0x79,0xD6,0x2C,0x6B,0x6C,0x73,0x00,0x01,0x47,0x42,0x50,0x8C,0x48,0x52,0x78,0x00,0x05,0x82,0x00,0x36,
+    0x52,0x4C,0x73,0xEE,0x03,0x60,0xFB,0xE6,0xCA,0x5A,0xAD,0x7B,0x1C,0x00,0x05,0x93,0x00,0x0F,0x09,0x00,0x38,0x40,0xDE,0xFF,0x78,0xD6,0x78,0x01,0x00,0x60,0x00,0x00,
+    0x64,0x03,0x00,0xE8,0x00,0x62,0x48,0x5A,0x69,0x5A,0xB2,0x9C,0x02,0x01,0x80,0xDF,0xFF,0x9D,0xF7,0x89,0x5A,0xEF,0x8B,0x20,0x00,0x0F,0x77,0x00,0x2B,0x00,0xDE,0x02,
+    0x04,0x04,0x00,0x06,0x60,0x02,0x60,0xEF,0x83,0x74,0xB5,0x2C,0x73,0x00,0x01,0x00,0x7E,0x00,0x00,0x04,0x00,0x03,0x82,0x00,0x34,0x52,0xFB,0xE6,0x70,0x00,0x40,0xCA,
+    0x5A,0x50,0x94,0x1A,0x00,0x04,0x10,0x00,0x0F,0x08,0x00,0x1F,0xF0,0x05,0x5C,0xEF,0x59,0xCE,0x54,0xAD,0x8D,0x7B,0x68,0x52,0x69,0x52,0xAA,0x5A,0x50,0x94,0xF7,0xC5,
+    0x1C,0xE7,0x84,0x00,0x80,0xDF,0xFF,0x8D,0x73,0x4C,0x73,0xF2,0xAC,0x5E,0x00,0x00,0xE2,0x00,0x02,0x08,0x00,0x01,0x82,0x00,0x43,0x52,0x6D,0x73,0x9E,0x86,0x02,0x80,
+    0x4C,0x6B,0xD2,0xA4,0x48,0x5A,0x48,0x5A,0x1F,0xFF,0x01,0x00,0x04,0xF9,0x00,0xDF,0xFF,0xBE,0xFF,0x9D,0xF7,0x38,0xCE,0x91,0x94,0xEF,0x83,0xD6,0xBD,0xDF,0x26,0x00,
+    0xB3,0x7D,0xF7,0xD2,0xA4,0x68,0x52,0x68,0x5A,0x48,0x5A,0x68,0x02,0x00,0x60,0x48,0x5A,0x4C,0x73,0xDA,0xDE,0x25,0x00,0x55,0xBE,0xFF,0x13,0xA5,0x89,0x1A,0x00,0xC0,
+    0x48,0x5A,0x89,0x5A,0x70,0x9C,0xF7,0xCD,0x17,0xCE,0x2C,0x73,0x30,0x00,0x00,0x32,0x00,0xE0,0x48,0x5A,0x48,0x52,0xA9,0x5A,0x9D,0xF7,0x99,0xD6,0x0B,0x6B,0x95,0xBD,
+    0x34,0x00,0x0C,0x04,0x00,0xF9,0x04,0x9D,0xF7,0xDA,0xDE,0xB2,0x9C,0x0B,0x6B,0xAA,0x5A,0x89,0x5A,0x68,0x52,0x48,0x52,0x8D,0x7B,0xBE,0x23,0x00,0x75,0x0B,0x63,0x91,
+    0x9C,0x68,0x52,0x48,0x66,0x00,0x00,0x5A,0x00,0x40,0x89,0x5A,0x38,0xCE,0x25,0x00,0x40,0xDA,0xDE,0x8D,0x7B,0x10,0x00,0x04,0x9A,0x00,0xA0,0xA9,0x62,0x2B,0x6B,0xEA,
+    0x62,0x34,0xAD,0x98,0xDE,0x16,0x00,0x00,0x34,0x00,0x01,0x04,0x00,0x90,0x52,0x78,0xD6,0xBA,0xDE,0x0B,0x6B,0xD6,0xC5,0x34,0x00,0x20,0xDF,0xFF,0x02,0x00,0x10,0xBF,
+    0x0B,0x00,0x52,0xFF,0xDF,0xFF,0x34,0xAD,0x76,0x00,0x00,0x30,0x00,0x01,0x46,0x00,0x47,0x52,0xAA,0x5A,0xB6,0xA8,0x00,0x61,0xDE,0xFF,0xAA,0x5A,0x0F,0x8C,0x46,0x00,
+    0x07,0x82,0x00,0x20,0x68,0x52,0x4C,0x00,0x60,0xDE,0xFF,0x17,0xC6,0x8C,0x7B,0x1C,0x00,0x01,0x3A,0x00,0xF0,0x00,0x5A,0x68,0x5A,0x89,0x5A,0x0B,0x6B,0xA9,0x5A,0x48,
+    0x52,0xB5,0xBD,0xAD,0x83,0x18,0x00,0x02,0x04,0x00,0xF1,0x06,0x68,0x52,0x34,0xAD,0xDA,0xDE,0x4C,0x73,0x17,0xCE,0xFF,0xFF,0xDE,0xFF,0xFB,0xE6,0x17,0xC6,0x75,0xAD,
+    0xD6,0x64,0x00,0x71,0xDF,0xFF,0x58,0xCE,0x48,0x52,0x48,0xDE,0x00,0x03,0x2C,0x00,0x71,0x5A,0x68,0x5A,0x30,0x8C,0x7D,0xEF,0x9F,0x00,0x58,0xFF,0xFF,0xFF,0x9D,0xF7,
+    0x80,0x00,0x00,0x24,0x00,0x01,0x6C,0x00,0xA1,0x52,0x54,0xB5,0xDE,0xFF,0x5C,0xEF,0xF2,0xA4,0xCE,0x68,0x00,0x01,0x14,0x00,0xF0,0x00,0x5A,0x68,0x5A,0x6C,0x73,0xDA,
+    0xE6,0x13,0xAD,0x89,0x5A,0xAE,0x7B,0xB1,0xA4,0x2C,0x00,0x00,0x82,0x01,0xF0,0x0B,0x68,0x5A,0x48,0x52,0x50,0x94,0x3C,0xEF,0xEE,0x83,0x38,0xD6,0xF2,0xA4,0x2F,0x8C,
+    0x8D,0x7B,0xCA,0x62,0x69,0x52,0x6D,0x73,0x7D,0xF7,0x8E,0x00,0x40,0xBA,0xDE,0x89,0x5A,0xFC,0x00,0x00,0x2A,0x00,0x00,0x04,0x00,0x00,0x0C,0x00,0x31,0xCA,0x62,0x58,
+    0x5E,0x01,0x00,0x84,0x00,0x0F,0x80,0x00,0x05,0xA4,0xB1,0x9C,0xBE,0xFF,0xFB,0xE6,0x30,0x8C,0x0F,0x8C,0x7C,0x00,0xF2,0x03,0x68,0x5A,0x68,0x52,0xAE,0x7B,0xDE,0xFF,
+    0xBE,0xFF,0xAE,0x7B,0x4C,0x73,0x33,0xAD,0x48,0x52,0x1A,0x00,0x11,0x48,0x18,0x00,0x70,0x9D,0xF7,0x70,0x94,0x37,0xCE,0x69,0xEC,0x00,0x00,0x18,0x00,0xC9,0x52,0x0B,
+    0x6B,0x99,0xD6,0xDF,0xFF,0x6D,0x73,0x71,0x94,0xAD,0xC2,0x01,0x00,0xB6,0x00,0x41,0x68,0x52,0x50,0x94,0x5F,0x02,0x01,0x00,0x01,0x40,0x89,0x5A,0xCE,0x83,0x96,0x00,
+    0x00,0x1A,0x00,0x00,0x04,0x00,0x01,0x0C,0x00,0xB0,0x52,0x2C,0x6B,0x9D,0xF7,0xDB,0xE6,0xEF,0x83,0x30,0x8C,0x10,0x00,0x02,0x6A,0x00,0x40,0x68,0x52,0xAD,0x7B,0x38,
+    0x00,0x66,0x75,0xB5,0x2C,0x6B,0x54,0xB5,0x80,0x00,0xA0,0x48,0x5A,0x0B,0x6B,0xBD,0xFF,0xB1,0x9C,0x54,0xB5,0x28,0x00,0x00,0x44,0x00,0xE2,0x48,0x5A,0xA9,0x5A,0x75,
+    0xB5,0xDE,0xFF,0x4C,0x6B,0x6D,0x73,0xF2,0xA4,0x16,0x00,0x00,0x06,0x00,0x04,0x4C,0x00,0x40,0x89,0x5A,0xFB,0xE6,0xFE,0x00,0x00,0x80,0x01,0x44,0xA9,0x5A,0xAD,0x83,
+    0x1C,0x00,0x02,0x22,0x01,0x01,0x26,0x00,0x90,0x52,0x7D,0xF7,0xDB,0xE6,0x6D,0x73,0x30,0x94,0x40,0x01,0x02,0x20,0x00,0xE0,0x68,0x52,0x6C,0x73,0x7C,0xEF,0xDF,0xFF,
+    0xBA,0xDE,0x2C,0x6B,0x33,0xAD,0x34,0x03,0x02,0x18,0x00,0x95,0x48,0x5A,0xCA,0x62,0x9D,0xFF,0xF3,0xA4,0x30,0x48,0x02,0x00,0x48,0x00,0x80,0x71,0x94,0x9D,0xFF,0x95,
+    0xB5,0x0B,0x6B,0xB0,0x01,0x01,0x52,0x00,0x01,0x60,0x02,0x00,0x1A,0x00,0x00,0x36,0x00,0x20,0x30,0x8C,0xCA,0x00,0x08,0x80,0x00,0x04,0x1A,0x00,0x00,0x1E,0x00,0x00,
+    0x6C,0x01,0xA4,0x3C,0xEF,0x1B,0xE7,0x2C,0x6B,0x91,0x9C,0xAA,0x62,0x1A,0x00,0x00,0xE8,0x00,0x00,0x56,0x01,0x57,0x7D,0xEF,0xEB,0x6A,0x70,0x98,0x00,0x00,0x98,0x03,
+    0x60,0x7D,0xF7,0x13,0xAD,0x6D,0x73,0x2A,0x00,0x03,0x04,0x00,0xD2,0x52,0xCE,0x83,0x1C,0xEF,0xBE,0xFF,0xAA,0x5A,0x91,0x9C,0x0B,0x6B,0x80,0x00,0x03,0x5A,0x00,0x01,
+    0x88,0x00,0x20,0x69,0x5A,0xE2,0x03,0x55,0xDF,0xFF,0x3C,0xEF,0x89,0x00,0x01,0x00,0x20,0x00,0x00,0x3E,0x00,0x01,0x2E,0x00,0xB6,0x52,0x79,0xD6,0x3C,0xEF,0x6D,0x73,
+    0xF3,0xAC,0x0B,0x6B,0x6A,0x01,0xE0,0x89,0x5A,0x95,0xBD,0xDF,0xFF,0xDE,0xFF,0xEB,0x62,0x2F,0x8C,0x2B,0x73,0x30,0x00,0x02,0x04,0x00,0x60,0x89,0x5A,0xFB,0xEE,0x34,
+    0xAD,0x68,0x00,0x00,0x10,0x00,0x00,0x44,0x00,0xD9,0x48,0x5A,0xAA,0x5A,0x58,0xD6,0xDE,0xFF,0x2B,0x6B,0x50,0x94,0xEE,0xC4,0x02,0x00,0x5E,0x00,0x00,0xA4,0x01,0x11,
+    0x0F,0x02,0x01,0x22,0x1C,0xE7,0x00,0x02,0x00,0x16,0x00,0x00,0x3C,0x00,0x06,0x04,0x00,0xA2,0x71,0x94,0x9D,0xF7,0x51,0x94,0x13,0xAD,0x2C,0x73,0x80,0x00,0x00,0x56,
+    0x00,0x40,0x69,0x5A,0x34,0xAD,0xDE,0x03,0x66,0x0B,0x6B,0x50,0x94,0x8D,0x7B,0x18,0x00,0x80,0x89,0x5A,0x78,0xD6,0x54,0xAD,0xAA,0x5A,0x58,0x00,0x04,0x42,0x00,0x00,
+    0xA6,0x03,0x80,0xDE,0xFF,0x34,0xAD,0x0F,0x8C,0x50,0x94,0x14,0x00,0x04,0x1C,0x00,0x00,0x08,0x00,0x00,0x04,0x00,0x20,0x0B,0x6B,0x04,0x02,0x00,0x80,0x00,0x00,0x00,
+    0x02,0x00,0x12,0x00,0x00,0xA8,0x03,0x00,0x2A,0x00,0x01,0x04,0x00,0xA9,0x52,0x69,0x52,0x9D,0xFF,0x13,0xA5,0xD2,0xA4,0x4C,0x80,0x00,0x20,0xF3,0xA4,0x38,0x02,0x00,
+    0x18,0x02,0x22,0xEF,0x8B,0x80,0x00,0x00,0x2E,0x00,0x80,0x69,0x5A,0xF6,0xC5,0xB6,0xBD,0xCA,0x62,0x46,0x00,0x00,0x10,0x00,0x00,0x08,0x00,0xE0,0x48,0x5A,0x91,0x9C,
+    0xBE,0xFF,0x99,0xD6,0x6D,0x73,0x50,0x94,0x89,0x62,0xE0,0x00,0x00,0xC2,0x00,0x02,0x1A,0x00,0x00,0x0A,0x00,0x11,0x68,0x20,0x00,0x20,0x1C,0xE7,0x80,0x02,0x02,0x16,
+    0x00,0x20,0xCA,0x6A,0x54,0x01,0x02,0x1C,0x00,0x00,0x58,0x05,0x84,0xBE,0xFF,0x95,0xB5,0x0F,0x8C,0xCE,0x83,0x68,0x00,0x00,0x08,0x00,0x20,0xB2,0x9C,0x3E,0x05,0x46,
+    0x92,0x9C,0x70,0x94,0x9A,0x03,0xA2,0x48,0x5A,0x69,0x52,0x34,0xAD,0x99,0xDE,0x2C,0x6B,0x3C,0x00,0x04,0x82,0x00,0xC2,0xCA,0x62,0x7D,0xF7,0x1B,0xE7,0x4C,0x73,0xF2,
+    0xA4,0xEB,0x6A,0x62,0x00,0x02,0x86,0x00,0x02,0x0C,0x00,0x02,0xE6,0x05,0x17,0x1B,0x80,0x00,0x44,0x6C,0x7B,0x2F,0x94,0x8A,0x05,0x00,0x80,0x00,0x80,0x5C,0xEF,0xF7,
+    0xC5,0x6C,0x73,0xF2,0xA4,0x78,0x00,0x00,0x54,0x00,0x00,0x96,0x02,0x20,0x2F,0x8C,0x58,0x04,0x44,0xD6,0xBD,0x50,0x94,0x36,0x05,0x00,0x54,0x00,0x00,0xCC,0x00,0x37,
+    0x3B,0xEF,0x6D,0x12,0x02,0x00,0x64,0x00,0xB7,0x68,0x52,0x1B,0xE7,0x9D,0xF7,0x50,0x94,0x13,0xAD,0x4C,0x30,0x06,0x00,0x30,0x00,0x00,0x1E,0x00,0xA0,0x48,0x5A,0x69,
+    0x5A,0x95,0xB5,0xFB,0xE6,0xAA,0x5A,0x4C,0x05,0x00,0x16,0x00,0x20,0x4C,0x7B,0xAA,0x01,0x02,0x1C,0x00,0x00,0x6C,0x00,0x40,0x38,0xCE,0x99,0xD6,0x56,0x05,0x03,0x7C,
+    0x00,0x00,0xB8,0x02,0x30,0x52,0x8D,0x73,0xB6,0x01,0x40,0x79,0xD6,0xCE,0x83,0x1A,0x05,0x00,0x36,0x00,0x00,0x1E,0x00,0x60,0x48,0x52,0x30,0x8C,0x7D,0xF7,0x2C,0x06,
+    0x00,0x12,0x00,0x00,0x06,0x01,0x00,0x46,0x00,0x11,0x68,0x46,0x05,0x51,0x55,0xB5,0x30,0x8C,0xAD,0x2C,0x02,0x00,0x18,0x00,0x00,0xC4,0x05,0x40,0x0A,0x6B,0xA9,0x62,
+    0xEC,0x01,0x62,0x48,0x5A,0x2C,0x6B,0x99,0xDE,0x00,0x03,0x00,0x1C,0x00,0x40,0xEA,0x6A,0x2F,0x94,0xC4,0x01,0x00,0x52,0x00,0xC6,0x68,0x5A,0x69,0x5A,0x50,0x94,0xFB,
+    0xE6,0x8D,0x7B,0x78,0xD6,0xEA,0x03,0xE0,0x68,0x52,0xEB,0x62,0x9A,0xDE,0xDF,0xFF,0xDA,0xDE,0x2C,0x6B,0x30,0x8C,0xD6,0x01,0x02,0x2C,0x00,0x80,0x68,0x52,0xEF,0x83,
+    0x9D,0xF7,0xAE,0x7B,0x0E,0x00,0x00,0x7A,0x00,0x04,0x04,0x00,0xA0,0x89,0x5A,0xDE,0xFF,0x17,0xCE,0x2C,0x6B,0x95,0xBD,0x44,0x00,0x02,0x16,0x00,0x21,0x88,0x5A,0xBC,
+    0x02,0x00,0xCE,0x00,0x50,0x5A,0x48,0x52,0x33,0xB5,0x80,0x00,0x00,0x1A,0x00,0x00,0x9A,0x00,0x10,0xB1,0x6E,0x02,0x04,0x86,0x07,0x90,0x52,0x8D,0x7B,0x7D,0xF7,0x2F,
+    0x8C,0xF6,0xC5,0x3C,0x00,0x04,0x5A,0x00,0xE0,0xA9,0x5A,0x79,0xD6,0xDF,0xFF,0xFB,0xE6,0xEB,0x62,0xB2,0xA4,0xAA,0x62,0x16,0x00,0xC0,0x68,0x5A,0x68,0x5A,0x48,0x52,
+    0xAE,0x7B,0x9D,0xFF,0xAE,0x7B,0x24,0x68,0x5A,0x02,0x00,0xA0,0x48,0x5A,0x48,0x5A,0x68,0x52,0x4C,0x6B,0xDE,0xFF,0x01,0x00,0x61,0xAE,0x83,0xB2,0xA4,0x6C,0x7B,0x14,
+    0x00,0x90,0x5A,0x68,0x5A,0x48,0x52,0x6C,0x73,0x7D,0xF7,0x18,0x00,0x0E,0x04,0x00,0xA0,0xDE,0xFF,0x2C,0x6B,0x99,0xDE,0xEA,0x6A,0x68,0x5A,0x2E,0x00,0x02,0x04,0x00,
+    0xB0,0x71,0x9C,0xEA,0x62,0x69,0x52,0x70,0x94,0x7C,0xF7,0x69,0x56,0x00,0x00,0x42,0x00,0x00,0x68,0x00,0xC0,0x52,0xDA,0xE6,0x5C,0xEF,0x2C,0x6B,0xF6,0xC5,0x6D,0x7B,
+    0x48,0x10,0x00,0x0D,0x04,0x00,0x00,0x82,0x00,0x20,0x5C,0xEF,0x64,0x00,0x83,0xEF,0x8B,0x0F,0x8C,0xEF,0x8B,0x48,0x52,0x28,0x00,0x41,0x52,0x2C,0x6B,0x5D,0x18,0x00,
+    0x00,0x1C,0x00,0x08,0x04,0x00,0xA2,0xDF,0xFF,0x5C,0xEF,0xCA,0x5A,0x1B,0xE7,0xCA,0x62,0x2C,0x00,0x01,0x80,0x00,0xC5,0x52,0xFB,0xEE,0xDA,0xE6,0x8D,0x73,0x2C,0x6B,
+    0x7C,0xF7,0x89,0x64,0x00,0xE3,0x48,0x5A,0x69,0x52,0xDA,0xDE,0x1B,0xE7,0x4C,0x73,0x17,0xCE,0x4C,0x73,0x58,0x00,0x00,0x9A,0x00,0x10,0x52,0x34,0x00,0x00,0x06,0x01,
+    0x02,0x08,0x00,0xC2,0xAD,0x7B,0xDF,0xFF,0xDE,0xFF,0x30,0x8C,0x6D,0x73,0x70,0x9C,0x54,0x00,0x00,0x1C,0x00,0x0F,0x80,0x00,0x05,0xA0,0xFF,0xFF,0xD6,0xBD,0x89,0x52,
+    0xFB,0xEE,0xCA,0x62,0x52,0x00,0x01,0x04,0x00,0xD8,0x52,0x68,0x52,0x5C,0xEF,0xDE,0xFF,0x13,0xA5,0x2C,0x6B,0x3B,0xEF,0x80,0x00,0xC0,0x89,0x5A,0xDA,0xE6,0x99,0xD6,
+    0x8D,0x73,0xD6,0xC5,0x0B,0x6B,0x2A,0x00,0x00,0x58,0x00,0x00,0x5C,0x01,0x00,0x0C,0x00,0x02,0x04,0x00,0xF3,0x02,0x48,0x5A,0x48,0x52,0xAA,0x5A,0x1B,0xE7,0xDE,0xFF,
+    0x91,0x94,0xEB,0x62,0x13,0xAD,0x68,0x00,0x01,0x42,0x48,0x5A,0x0B,0x6B,0x18,0x01,0x08,0xFC,0x00,0x02,0x0C,0x00,0x71,0x54,0xAD,0x89,0x52,0xFB,0xE6,0xAA,0x80,0x00,
+    0x00,0x52,0x00,0xE0,0x48,0x52,0x68,0x52,0x7D,0xF7,0xDF,0xFF,0x54,0xAD,0x8D,0x7B,0xFB,0xEE,0x12,0x00,0x00,0x04,0x00,0x00,0xDC,0x00,0xC0,0x89,0x5A,0xDB,0xE6,0x17,
+    0xC6,0x8D,0x7B,0x54,0xB5,0xCA,0x62,0x14,0x00,0x00,0x04,0x00,0x42,0x89,0x5A,0x48,0x52,0xBA,0x01,0x04,0x06,0x00,0xC4,0x68,0x5A,0x13,0xAD,0xDE,0xFF,0xD2,0x9C,0x69,
+    0x52,0xB5,0xBD,0x00,0x01,0x0F,0x80,0x00,0x0B,0x55,0xAA,0x5A,0xFA,0xE6,0xA9,0x52,0x00,0x60,0x68,0x5A,0x68,0x52,0xBE,0xFF,0x80,0x00,0x40,0xAE,0x7B,0xDA,0xE6,0x78,
+    0x00,0x00,0x68,0x00,0x00,0x08,0x00,0xA6,0xAA,0x5A,0xDB,0xE6,0x75,0xB5,0xCE,0x83,0x13,0xAD,0x16,0x01,0x00,0x80,0x00,0x00,0x66,0x00,0x00,0x00,0x01,0x00,0x28,0x00,
+    0x00,0x04,0x00,0xA6,0xCE,0x83,0x9D,0xFF,0xF3,0xA4,0x69,0x52,0x17,0xCE,0x00,0x01,0x2F,0xCA,0x62,0x00,0x01,0x07,0x17,0x8A,0x80,0x00,0x01,0x48,0x00,0xD0,0x52,0xDE,
+    0xFF,0xDE,0xFF,0x33,0xA5,0x0F,0x8C,0x58,0xD6,0x68,0x52,0x52,0x00,0x02,0x04,0x00,0x75,0x6C,0x73,0x3C,0xEF,0xD2,0xA4,0xEF,0x80,0x00,0x00,0x94,0x00,0x4C,0x8D,0x7B,
+    0x68,0x52,0x80,0x00,0x88,0xEA,0x62,0x17,0xCE,0x34,0xAD,0x69,0x52,0x3E,0x00,0x0F,0x80,0x00,0x07,0x66,0x33,0xA5,0x69,0x52,0xDA,0xE6,0xD2,0x00,0x60,0x68,0x5A,0x69,
+    0x52,0xFF,0xFF,0x00,0x02,0x40,0x50,0x94,0xD6,0xC5,0xC2,0x00,0x01,0x94,0x00,0xD0,0x5A,0x68,0x52,0x0F,0x8C,0x7C,0xF7,0xEF,0x83,0x30,0x8C,0xF3,0xAC,0x6C,0x01,0x02,
+    0x94,0x00,0x20,0xB2,0xA4,0x0C,0x00,0x00,0x8A,0x00,0x02,0x10,0x00,0x00,0x06,0x00,0x44,0x69,0x52,0xF3,0xAC,0x80,0x00,0x03,0x3C,0x00,0x1F,0x5A,0x80,0x00,0x05,0x53,
+    0xDF,0xFF,0x13,0xA5,0x89,0x80,0x00,0x04,0x2C,0x00,0x22,0xEA,0x62,0x80,0x00,0xF0,0x0B,0xB1,0x9C,0x17,0xCE,0xCE,0x83,0x8D,0x7B,0x6C,0x7B,0x4C,0x73,0xEA,0x6A,0xAA,
+    0x5A,0xD2,0x9C,0x9D,0xF7,0x4C,0x6B,0x70,0x94,0xF2,0xAC,0x96,0x00,0x00,0x6A,0x00,0x40,0x68,0x5A,0xB5,0xBD,0x0C,0x00,0x04,0x3A,0x00,0x02,0x14,0x00,0x62,0x48,0x52,
+    0xAD,0x83,0xF2,0xA4,0x00,0x01,0x00,0x1A,0x00,0x00,0x04,0x00,0x3F,0xCA,0x62,0x3C,0x80,0x03,0x04,0x20,0x13,0xA5,0xD8,0x02,0x00,0xC6,0x00,0x02,0x3E,0x00,0x40,0x68,
+    0x5A,0x2C,0x6B,0x80,0x00,0xF0,0x0D,0xF3,0xA4,0xAE,0x7B,0xF2,0xA4,0xD2,0xA4,0xD2,0xA4,0x34,0xB5,0xD6,0xC5,0x17,0xCE,0xF7,0xC5,0xBA,0xDE,0xBE,0xFF,0xEB,0x62,0xD2,
+    0xA4,0xB1,0xA4,0x74,0x00,0x02,0x2E,0x00,0x2C,0x37,0xCE,0x7E,0x01,0x00,0x04,0x03,0x82,0x89,0x5A,0x50,0x94,0x68,0x52,0x58,0xD6,0x3E,0x04,0x00,0x80,0x00,0x1F,0xAA,
+    0x80,0x00,0x04,0x31,0xFF,0xFF,0x13,0x80,0x01,0x02,0x42,0x01,0x01,0x06,0x00,0x32,0x52,0xAD,0x7B,0x80,0x00,0xE0,0x69,0x52,0x89,0x5A,0xCA,0x5A,0xAA,0x5A,0xCA,0x62,
+    0x0B,0x6B,0x17,0xC6,0x2E,0x03,0x77,0xBE,0xFF,0xCA,0x5A,0x54,0xB5,0x71,0xD8,0x03,0x20,0x99,0xDE,0xBA,0x00,0x00,0x62,0x00,0x00,0x3C,0x00,0x11,0x69,0x2E,0x04,0x00,
+    0x0E,0x00,0x84,0x2C,0x73,0x68,0x5A,0xF7,0xCD,0x48,0x52,0x1E,0x03,0x2F,0x89,0x5A,0x00,0x01,0x03,0x41,0xFF,0xFF,0xF3,0xA4,0x00,0x01,0x07,0x68,0x02,0x21,0xEF,0x83,
+    0x6C,0x00,0xF0,0x00,0xF7,0x5C,0xEF,0x99,0xD6,0x75,0xB5,0x71,0x94,0x6D,0x73,0x2B,0x63,0x38,0xCE,0x14,0x00,0x86,0x9E,0xF7,0x89,0x52,0x95,0xBD,0x0F,0x8C,0x00,0x01,
+    0x26,0xFB,0xE6,0x0C,0x00,0x40,0x89,0x62,0xEF,0x8B,0xC8,0x03,0x04,0x8A,0x00,0x20,0xD6,0xC5,0x1C,0x01,0x00,0x28,0x01,0x3F,0x48,0x5A,0x69,0x80,0x00,0x06,0x20,0xD2,
+    0x9C,0x00,0x02,0x04,0xE8,0x02,0x00,0x42,0x05,0x20,0x50,0x8C,0x00,0x01,0x00,0x70,0x00,0x20,0xDE,0xFF,0xCC,0x04,0x10,0xDF,0x0B,0x00,0x01,0x04,0x00,0x84,0x5C,0xEF,
+    0xAA,0x5A,0xB5,0xBD,0x6D,0x7B,0x58,0x00,0x46,0x68,0x5A,0x3B,0xEF,0x0C,0x00,0x51,0x68,0x5A,0x54,0xB5,0x2C,0x1A,0x05,0x00,0x02,0x01,0x44,0x68,0x5A,0xB5,0xC5,0x80,
+    0x01,0x0F,0x80,0x00,0x0D,0x22,0xB9,0xDE,0x80,0x00,0x00,0xBA,0x00,0x40,0x68,0x52,0x71,0x94,0x72,0x00,0x20,0xDF,0xFF,0x02,0x00,0x01,0x77,0x00,0x05,0x05,0x00,0x51,
+    0xFB,0xE6,0x89,0x52,0xF6,0xFE,0x04,0x01,0x2A,0x00,0x52,0x5A,0x68,0x5A,0x99,0xDE,0x64,0x01,0x00,0xE6,0x00,0x60,0x68,0x52,0xD2,0xA4,0xB2,0xA4,0x1A,0x00,0x04,0x80,
+    0x00,0x11,0x89,0x3E,0x06,0x00,0x12,0x00,0x3F,0x68,0x52,0x1C,0x80,0x02,0x02,0x20,0xFF,0xFF,0x00,0x01,0x21,0xB9,0xDE,0x40,0x00,0x01,0x82,0x06,0xF0,0x07,0x68,0x52,
+    0x92,0x9C,0xDE,0xFF,0x9A,0xD6,0xF3,0x9C,0x54,0xAD,0xD6,0xC5,0x79,0xD6,0xDA,0xDE,0x3C,0xEF,0x9D,0xF7,0x92,0x00,0xA0,0xFF,0xFF,0x79,0xD6,0xAA,0x5A,0x17,0xCE,0xCA,
+    0x6A,0x52,0x00,0x00,0x64,0x00,0x20,0x48,0x5A,0x0C,0x05,0x05,0x0E,0x00,0x52,0x52,0xEB,0x6A,0xDA,0xE6,0x10,0x02,0x00,0xF8,0x01,0x22,0x54,0xB5,0xD6,0x04,0x00,0x2A,
+    0x00,0x2F,0x68,0x52,0x00,0x02,0x05,0x40,0xB2,0x9C,0x89,0x52,0x46,0x02,0x00,0x82,0x00,0x00,0x4A,0x00,0x00,0xC6,0x00,0x60,0xDE,0xFF,0x95,0xBD,0x68,0x52,0x02,0x00,
+    0x04,0x5E,0x01,0xD7,0x69,0x5A,0xEB,0x62,0x17,0xC6,0x95,0xB5,0xCA,0x5A,0x37,0xCE,0xAA,0x2C,0x05,0x31,0x71,0x94,0x8D,0x8E,0x01,0x00,0x64,0x00,0x00,0xBC,0x01,0x26,
+    0x17,0xCE,0x1C,0x07,0x20,0x6C,0x7B,0x0E,0x02,0x00,0x90,0x00,0x00,0x26,0x06,0x25,0xFB,0xE6,0x47,0x01,0x09,0x09,0x00,0x26,0x91,0x94,0x80,0x00,0x00,0x2C,0x00,0x71,
+    0x48,0x52,0xB1,0x9C,0x9D,0xFF,0xF2,0x64,0x03,0x00,0x90,0x00,0x01,0x5A,0x00,0xF0,0x0A,0x52,0x48,0x52,0x0B,0x6B,0x78,0xD6,0xD2,0x9C,0x0B,0x6B,0x37,0xCE,0x89,0x5A,
+    0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x5A,0xF0,0x03,0x68,0x5A,0x68,0x5A,0x6C,0x7B,0x8D,0x7B,0x89,0x5A,0x68,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x12,0x00,
+    0x73,0x48,0x5A,0x89,0x5A,0xDA,0xE6,0xFF,0x01,0x00,0x62,0xDF,0xFF,0x79,0xD6,0x0B,0x6B,0x1E,0x00,0x00,0x20,0x00,0x06,0x26,0x00,0x93,0x68,0x5A,0x89,0x5A,0xCE,0x83,
+    0x3C,0xEF,0xDF,0x2A,0x00,0x46,0xFF,0xFF,0xDF,0xFF,0x0C,0x00,0x05,0x15,0x00,0x0F,0x09,0x00,0x08,0xF0,0x01,0x68,0x5A,0x88,0x5A,0x50,0x94,0xFB,0xEE,0x5C,0xF7,0x8D,
+    0x7B,0x48,0x52,0x48,0x52,0x60,0x00,0x00,0x6A,0x00,0x42,0x68,0x52,0x91,0x94,0x37,0x00,0x62,0xDE,0xFF,0xDA,0xDE,0x4C,0x73,0x96,0x00,0x05,0x1E,0x00,0x01,0xA6,0x00,
+    0x01,0x28,0x00,0x62,0x5A,0x68,0x5A,0x8D,0x7B,0xDE,0x2B,0x00,0x01,0x06,0x00,0x68,0x3C,0xE7,0xBA,0xDE,0x7D,0xEF,0x12,0x00,0x01,0x17,0x00,0x0F,0x05,0x00,0x04,0xF2,
+    0x01,0x68,0x5A,0x48,0x52,0x68,0x52,0x89,0x5A,0x95,0xBD,0x9D,0xFF,0xAE,0x83,0x48,0x52,0x68,0x00,0x60,0x68,0x5A,0x68,0x52,0xEA,0x62,0x44,0x00,0x80,0x9D,0xF7,0x95,
+    0xB5,0xD2,0xA4,0x68,0x52,0xF4,0x00,0x00,0x04,0x00,0x00,0x20,0x00,0x04,0x04,0x00,0x04,0x10,0x00,0x40,0x48,0x52,0x33,0xAD,0xF6,0x00,0x00,0xFC,0x00,0xF7,0x02,0xDF,
+    0xFF,0x75,0xB5,0x8A,0x5A,0x69,0x52,0x2C,0x6B,0xF3,0xA4,0x58,0xD6,0x1B,0xE7,0x5C,0x1C,0x01,0x0F,0x83,0x00,0x01,0x02,0x42,0x01,0x95,0xAA,0x62,0x69,0x52,0x37,0xCE,
+    0x17,0xCE,0x89,0x80,0x01,0xE0,0x48,0x5A,0x69,0x52,0x9D,0xF7,0xDE,0xFF,0x95,0xB5,0x38,0xCE,0xCA,0x62,0x6A,0x00,0x05,0x04,0x00,0x50,0x52,0xEB,0x6A,0x0B,0x6B,0x2A,
+    0x00,0x02,0x12,0x00,0x00,0xC2,0x00,0xF1,0x00,0xAA,0x5A,0x3C,0xEF,0xDE,0xFF,0xBE,0xFF,0xB6,0xB5,0x3C,0xEF,0x13,0xA5,0x69,0x48,0x01,0xAF,0x48,0x52,0x69,0x52,0xEA,
+    0x62,0x30,0x8C,0x5C,0xEF,0x78,0x00,0x01,0x04,0x14,0x00,0xF0,0x01,0x48,0x52,0x0B,0x6B,0xBA,0xDE,0xB2,0x9C,0x89,0x5A,0x4C,0x73,0xBA,0xE6,0x4C,0x73,0x62,0x01,0x01,
+    0x58,0x00,0xB0,0x52,0x68,0x52,0x7D,0xF7,0x58,0xCE,0x71,0x94,0x95,0xB5,0x96,0x01,0x02,0x18,0x00,0x00,0x72,0x01,0x93,0xA9,0x62,0x70,0x9C,0x37,0xD6,0xF3,0xAC,0xAA,
+    0x96,0x00,0x00,0x0E,0x01,0xE1,0x89,0x5A,0x54,0xAD,0xFE,0xFF,0x99,0xD6,0x89,0x52,0x79,0xD6,0x30,0x8C,0x40,0x00,0x10,0x5A,0x2C,0x00,0x62,0x68,0x52,0xCA,0x62,0x7D,
+    0xF7,0x6C,0x00,0x52,0x5D,0xEF,0x99,0xD6,0xBE,0x0B,0x00,0x07,0x06,0x00,0xF0,0x01,0x48,0x52,0x2B,0x6B,0x7D,0xF7,0x3C,0xEF,0x0B,0x6B,0xAA,0x62,0x1B,0xEF,0xAE,0x83,
+    0x4E,0x00,0x03,0x40,0x00,0x90,0x52,0x5C,0xEF,0x54,0xAD,0x96,0xBD,0x50,0x94,0x9A,0x02,0x00,0x18,0x00,0x00,0x04,0x00,0x00,0x24,0x02,0x80,0x89,0x5A,0xAE,0x83,0x1B,
+    0xEF,0xEF,0x8B,0x28,0x00,0x00,0x14,0x00,0x00,0x04,0x00,0xC0,0x50,0x94,0xDE,0xFF,0x34,0xAD,0x69,0x52,0x99,0xDE,0xEA,0x62,0x7A,0x00,0x04,0x1C,0x00,0x20,0xCE,0x83,
+    0xC6,0x01,0x00,0x71,0x00,0xB3,0x58,0xCE,0xEB,0x62,0x0B,0x6B,0xAD,0x7B,0x58,0xCE,0x9E,0x92,0x00,0x00,0x16,0x00,0x40,0x48,0x5A,0x4C,0x73,0x22,0x00,0x71,0xAE,0x7B,
+    0xAA,0x62,0xFB,0xEE,0xAD,0x80,0x00,0x02,0x40,0x00,0x82,0x68,0x5A,0xBA,0xE6,0xAE,0x7B,0xF7,0xC5,0x14,0x01,0x00,0x64,0x00,0x00,0x04,0x00,0xC2,0x91,0x9C,0x54,0xB5,
+    0xCA,0x62,0xCA,0x62,0xF6,0xC5,0x50,0x94,0x28,0x00,0x02,0x6A,0x00,0xA2,0x2F,0x8C,0xDE,0xFF,0x30,0x8C,0xEA,0x62,0x78,0xD6,0x2C,0x02,0x02,0x1C,0x00,0xF0,0x01,0x68,
+    0x5A,0x95,0xBD,0xDE,0xFF,0x9E,0xF7,0xBA,0xDE,0xBE,0xFF,0x54,0xB5,0x68,0x52,0x6C,0x02,0x00,0x6E,0x02,0x40,0xEF,0x83,0x17,0xC6,0x76,0x00,0x60,0xFF,0xFF,0x48,0x52,
+    0x8D,0x7B,0x88,0x00,0x60,0x0F,0x84,0xCA,0x62,0x99,0xDE,0x66,0x03,0x00,0x66,0x00,0x00,0x54,0x00,0xA0,0x89,0x5A,0xB9,0xDE,0xCB,0x62,0xD6,0xC5,0xCA,0x62,0x12,0x00,
+    0x04,0x04,0x00,0xC6,0x13,0xAD,0xBE,0xFF,0x74,0xB5,0xCA,0x62,0xB5,0xBD,0x2F,0x8C,0x94,0x01,0xC2,0x48,0x5A,0x0F,0x8C,0x7C,0xF7,0x6C,0x73,0x74,0xB5,0xB6,0xC5,0xAE,
+    0x01,0x00,0x42,0x00,0x00,0x20,0x00,0x70,0xFB,0xE6,0xFF,0xFF,0xF7,0xC5,0xEB,0x5C,0x01,0x14,0x7B,0x14,0x00,0x71,0x48,0x5A,0x68,0x52,0x48,0x4A,0x9D,0x06,0x01,0x40,
+    0x48,0x52,0xEE,0x83,0x80,0x00,0x46,0xEF,0x83,0xCA,0x62,0x80,0x02,0x00,0xBE,0x00,0x66,0x0B,0x6B,0x99,0xDE,0x4C,0x73,0x80,0x00,0x00,0x4E,0x00,0xE7,0x89,0x5A,0x95,
+    0xB5,0xFE,0xFF,0xFB,0xE6,0xEA,0x62,0x95,0xBD,0xAD,0x7B,0x2E,0x03,0x30,0x5A,0x50,0x94,0xBE,0x00,0x40,0xBA,0xE6,0xCE,0x83,0x80,0x00,0x00,0x40,0x00,0x20,0x48,0x5A,
+    0xDC,0x01,0x00,0xE6,0x00,0x71,0xF3,0xA4,0x0B,0x6B,0x5C,0xF7,0xA9,0x5E,0x04,0x03,0x84,0x00,0x23,0x52,0xAE,0xB4,0x03,0x42,0x68,0x52,0xD2,0xA4,0x80,0x00,0x42,0x2C,
+    0x6B,0x74,0xB5,0x52,0x00,0x00,0xEC,0x00,0xB7,0x48,0x52,0x71,0x9C,0x17,0xCE,0xEF,0x8B,0xF6,0xC5,0xAA,0x00,0x01,0xE0,0x0B,0x6B,0x78,0xCE,0xFE,0xFF,0x79,0xD6,0x2C,
+    0x6B,0x95,0xBD,0x2B,0x6B,0x92,0x00,0x00,0x2C,0x00,0x00,0x04,0x00,0xA0,0xD2,0xA4,0xB6,0xBD,0xEA,0x62,0x9D,0xFF,0x89,0x5A,0x80,0x00,0x01,0x66,0x00,0xEB,0x52,0x68,
+    0x52,0x70,0x94,0xFF,0xFF,0xBE,0xFF,0x71,0x94,0xD2,0xA4,0x37,0x98,0x01,0xC0,0x78,0xD6,0xDE,0xFF,0x7D,0xF7,0xDE,0xFF,0x68,0x52,0x17,0xCE,0xB6,0x04,0x60,0x8D,0x7B,
+    0x95,0xBD,0x0B,0x6B,0x3C,0x00,0x02,0xBC,0x00,0xB1,0x68,0x52,0x58,0xD6,0xD2,0xA4,0x91,0x9C,0x34,0xAD,0x89,0x6C,0x04,0x01,0x52,0x00,0xD2,0x5A,0x8D,0x7B,0x3C,0xEF,
+    0xFE,0xFF,0x54,0xB5,0x6C,0x73,0xB6,0xBD,0xD0,0x00,0x00,0x7C,0x00,0xC6,0x48,0x5A,0x89,0x62,0xD6,0xC5,0xB1,0x9C,0xEF,0x83,0x9D,0xFF,0xFE,0x01,0x60,0x68,0x5A,0x69,
+    0x5A,0x38,0xCE,0x16,0x03,0x51,0x2C,0x6B,0x78,0xD6,0xEE,0xAE,0x02,0x00,0xB2,0x00,0x00,0x4A,0x00,0xC0,0x68,0x52,0x5D,0xF7,0xDA,0xDE,0x0B,0x6B,0x17,0xCE,0x48,0x52,
+    0xA2,0x01,0x64,0x3C,0xEF,0x8D,0x7B,0xF2,0xAC,0xFE,0x00,0x00,0x22,0x00,0x84,0xEB,0x62,0x7D,0xF7,0x6D,0x73,0xB1,0x9C,0xFE,0x02,0x00,0x14,0x00,0xE2,0x48,0x5A,0xCE,
+    0x83,0x9D,0xFF,0xDE,0xFF,0x4C,0x6B,0x30,0x8C,0x74,0xB5,0x02,0x04,0x02,0x80,0x00,0xA6,0xAA,0x62,0x3B,0xEF,0x30,0x8C,0x54,0xAD,0x33,0xAD,0xC2,0x00,0xF3,0x00,0x48,
+    0x5A,0xCA,0x62,0x5C,0xEF,0xFE,0xFF,0x37,0xC6,0xEB,0x62,0xB9,0xDE,0x89,0xAE,0x03,0x02,0x48,0x00,0xF0,0x03,0xEE,0x83,0x9D,0xFF,0x54,0xAD,0xCF,0x83,0x95,0xBD,0x68,
+    0x5A,0xF7,0xCD,0x58,0xD6,0xB2,0x9C,0x62,0x05,0x00,0x1C,0x00,0x02,0x50,0x00,0x00,0x96,0x01,0x80,0xBE,0xFF,0x0B,0x6B,0xD2,0xA4,0x0F,0x8C,0x12,0x00,0x03,0x14,0x01,
+    0x90,0x5A,0x30,0x8C,0xDE,0xFF,0xDE,0xFF,0x89,0x52,0x1A,0x01,0x02,0xEA,0x00,0x00,0x34,0x00,0xC2,0x48,0x5A,0xEB,0x6A,0xFB,0xE6,0xAD,0x7B,0x38,0xCE,0x6C,0x73,0x10,
+    0x00,0x00,0x30,0x00,0x40,0x68,0x52,0xAE,0x7B,0x62,0x01,0x60,0x54,0xAD,0x2F,0x8C,0x37,0xCE,0x98,0x00,0x00,0x1C,0x00,0x00,0xAE,0x04,0xF2,0x03,0x68,0x52,0x74,0xB5,
+    0xBE,0xFF,0x0C,0x6B,0xB2,0x9C,0xD2,0xA4,0x68,0x5A,0xEA,0x6A,0xEA,0x6A,0x64,0x01,0x02,0x6A,0x00,0x00,0x7C,0x05,0xA0,0xEB,0x62,0x79,0xD6,0x9D,0xF7,0xEB,0x62,0x75,
+    0xBD,0x50,0x02,0x00,0x18,0x00,0x01,0x3C,0x00,0xA0,0x52,0x34,0xAD,0xDF,0xFF,0x5C,0xEF,0x89,0x52,0xB5,0x18,0x00,0x01,0x62,0x04,0x00,0x18,0x00,0xA2,0x48,0x52,0x30,
+    0x8C,0x38,0xD6,0x2C,0x73,0xBA,0xE6,0x14,0x01,0x01,0x14,0x00,0x50,0x5A,0x68,0x52,0x34,0xAD,0xE4,0x01,0x63,0xCE,0x83,0x54,0xAD,0x71,0x9C,0x14,0x00,0x00,0x84,0x02,
+    0xB2,0x52,0xAA,0x62,0x58,0xD6,0xBD,0xFF,0xAA,0x5A,0x95,0xB5,0x44,0x04,0x00,0x1C,0x00,0x00,0x64,0x00,0x03,0x04,0x00,0xF0,0x00,0x52,0x48,0x52,0xF3,0xA4,0xDE,0xFF,
+    0xFB,0xE6,0x2C,0x6B,0x58,0xD6,0x6D,0x7B,0x16,0x00,0x00,0xB8,0x01,0x00,0xB8,0x03,0xB1,0x58,0xD6,0xDF,0xFF,0xF7,0xC5,0x69,0x52,0xDA,0xE6,0x2B,0x92,0x06,0x02,0x1C,
+    0x00,0xB0,0x48,0x52,0xFB,0xEE,0xB6,0xBD,0xCE,0x83,0xD6,0xC5,0x69,0x60,0x00,0x03,0x30,0x02,0x20,0x69,0x5A,0xE4,0x03,0x60,0x5C,0xEF,0xEB,0x62,0x75,0xB5,0x18,0x01,
+    0x00,0x2C,0x00,0x00,0x18,0x01,0x00,0xC6,0x01,0xA2,0x1B,0xEF,0x50,0x8C,0x2C,0x6B,0x17,0xCE,0x0B,0x6B,0x7C,0x00,0x01,0x60,0x00,0x01,0xD0,0x00,0x00,0x36,0x02,0xE2,
+    0x50,0x94,0x9D,0xF7,0xDF,0xFF,0xB6,0xBD,0x4C,0x6B,0xB6,0xC5,0xA9,0x62,0x16,0x02,0x00,0xB4,0x03,0xC0,0x89,0x5A,0x5C,0xEF,0xDE,0xFF,0x0F,0x84,0xEB,0x62,0x79,0xDE,
+    0x48,0x01,0x00,0x1A,0x00,0x00,0x18,0x00,0xA0,0x69,0x52,0xBE,0xFF,0xF3,0xA4,0xB2,0x9C,0xB2,0xA4,0x48,0x00,0x00,0x04,0x00,0x00,0x44,0x01,0xB7,0x0B,0x6B,0x79,0xD6,
+    0xFF,0xFF,0x79,0xD6,0x8D,0x73,0x38,0xBE,0x07,0x00,0x1E,0x00,0xC0,0x91,0x9C,0x9D,0xF7,0xEB,0x62,0xEF,0x83,0x75,0xBD,0x68,0x5A,0x1F,0xFF,0x01,0x00,0xFF,0xFF,0x56,
+    0x4F,0xDE,0xFF,0x3C,0xE7,0x6B,0x02,0x41,0xBF,0x79,0xD6,0xAE,0x7B,0xD2,0xA4,0xF7,0xC5,0x9D,0xF7,0xDF,0x5F,0x00,0x3A,0xEF,0x2F,0x8C,0x48,0x52,0x68,0x52,0xAA,0x62,
+    0x4C,0x73,0xEF,0x83,0xDA,0xDE,0x5B,0x00,0x37,0xFF,0x01,0x2C,0x73,0x28,0x52,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x52,0x69,0x52,0x34,0xAD,0x5A,0x00,0x35,0x20,0xCA,
+    0x62,0x56,0x00,0x00,0x58,0x00,0x4F,0x48,0x52,0x69,0x5A,0x58,0x00,0x37,0x11,0x69,0xAC,0x00,0x00,0x58,0x00,0x59,0x68,0x52,0x89,0x5A,0x54,0xB0,0x00,0x6F,0xBE,0xFF,
+    0x1C,0xE7,0xBE,0xFF,0x1D,0x01,0x23,0x10,0x68,0x02,0x01,0x02,0x04,0x00,0x0D,0x58,0x00,0x8F,0x5C,0xEF,0x8D,0x7B,0xEF,0x83,0xF6,0xC5,0x5A,0x00,0x21,0x00,0x06,0x01,
+    0x03,0x5C,0x00,0x07,0x08,0x01,0xFF,0x05,0xBE,0xFF,0x1B,0xE7,0xBE,0xFF,0xD6,0xC5,0x48,0x52,0x48,0x52,0x68,0x5A,0x89,0x5A,0xD2,0xA4,0x5C,0xEF,0x5E,0x00,0x1B,0x01,
+    0x02,0x01,0x03,0xB0,0x00,0x04,0x60,0x01,0xB1,0xDF,0xFF,0x17,0xC6,0x0B,0x63,0xFB,0xE6,0xAD,0x83,0x48,0xD4,0x01,0x01,0x5C,0x00,0x3F,0x52,0xD7,0xBD,0xD4,0x01,0x14,
+    0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xFF,0x01,0x00,0x20,0xF2,0x02,0xDF,0xFF,0x5C,0xEF,0x95,0xBD,0xEF,0x83,0x89,0x5A,0x68,0x52,0x68,0x52,0x68,0x5A,0x68,0x08,0x00,
+    0xF2,0x03,0x52,0xAD,0x7B,0xD6,0xBD,0x9D,0xF7,0xDE,0xFF,0x38,0xCE,0xEB,0x62,0xF2,0xA4,0xCA,0x62,0x48,0x1C,0x00,0x00,0x20,0x00,0x01,0x04,0x00,0x71,0x48,0x5A,0x68,
+    0x52,0x54,0xAD,0xDE,0x72,0x00,0x81,0xEF,0x83,0xD2,0xA4,0x68,0x5A,0x48,0x5A,0x0D,0x00,0x0F,0x05,0x00,0x1A,0x71,0xDE,0xFF,0x1B,0xEF,0x0F,0x8C,0xAA,0x74,0x00,0x31,
+    0x48,0x52,0x48,0x5A,0x00,0x00,0x4A,0x00,0xF2,0x03,0x48,0x5A,0x48,0x52,0xCA,0x62,0x54,0xAD,0xBE,0xFF,0xDE,0xFF,0xEB,0x62,0x50,0x94,0xCE,0x83,0x9C,0x00,0x22,0x48,
+    0x5A,0x24,0x00,0x00,0x06,0x00,0x51,0x48,0x5A,0x0B,0x6B,0xBA,0x81,0x00,0x5F,0x51,0x94,0xB2,0x9C,0x69,0x80,0x00,0x22,0x62,0x9D,0xF7,0x0B,0x6B,0x48,0x52,0xDC,0x00,
+    0x00,0x54,0x00,0x01,0x00,0x01,0x10,0x5A,0x82,0x00,0xF0,0x01,0x68,0x5A,0x48,0x52,0x89,0x5A,0x17,0xC6,0xDE,0xFF,0x75,0xB5,0xEF,0x83,0x50,0x94,0x10,0x00,0x08,0x1E,
+    0x00,0x01,0x24,0x00,0xEF,0x52,0xB2,0x9C,0xDF,0xFF,0xDF,0xFF,0xD2,0x9C,0x50,0x94,0x89,0x5A,0x68,0x00,0x01,0x1E,0x62,0x9D,0xF7,0x6D,0x73,0x68,0x52,0x80,0x00,0x04,
+    0xDA,0x00,0x00,0x58,0x00,0x02,0x0C,0x00,0x00,0x18,0x00,0xCA,0x6D,0x7B,0x5C,0xEF,0xDA,0xDE,0x0C,0x6B,0xB2,0x9C,0xCA,0x62,0xA0,0x00,0x02,0x24,0x00,0x90,0xAA,0x62,
+    0x18,0xCE,0xDE,0xFF,0x13,0xA5,0xCE,0xC0,0x01,0x0F,0x80,0x00,0x1E,0x60,0x95,0xB5,0x69,0x52,0x68,0x52,0x4A,0x00,0x00,0x5C,0x00,0x00,0x04,0x00,0x20,0x89,0x5A,0x76,
+    0x00,0x00,0x12,0x00,0x03,0xEC,0x00,0xB0,0x52,0x95,0xBD,0x7D,0xF7,0xEF,0x83,0xF3,0xA4,0x4C,0x73,0x20,0x00,0x02,0x9E,0x00,0x00,0x1C,0x00,0x00,0x24,0x00,0x00,0x04,
+    0x00,0xAF,0x30,0x8C,0x9D,0xFF,0x95,0xB5,0x6C,0x73,0xCA,0x62,0x00,0x01,0x1D,0x40,0xBE,0xFF,0xEF,0x83,0xF4,0x01,0x00,0x46,0x00,0x00,0x52,0x00,0x88,0x2C,0x73,0x95,
+    0xBD,0x17,0xCE,0x91,0x9C,0xEA,0x01,0xC0,0x48,0x5A,0xCA,0x62,0x9E,0xFF,0x75,0xB5,0x8D,0x7B,0xF2,0xA4,0x24,0x00,0x02,0x2C,0x00,0x00,0x06,0x00,0x04,0x04,0x00,0xCF,
+    0x89,0x5A,0xB6,0xBD,0x38,0xCE,0xEB,0x6A,0xEA,0x6A,0x48,0x52,0x7B,0x02,0x1A,0x50,0xFF,0x1B,0xE7,0x6D,0x73,0xFA,0x01,0x00,0x4A,0x00,0xE0,0x68,0x5A,0xA9,0x62,0x12,
+    0xAD,0x30,0x94,0x50,0x94,0xDA,0xE6,0x50,0x94,0xEA,0x00,0x04,0x04,0x00,0xA0,0x69,0x5A,0x79,0xD6,0x79,0xDE,0x4C,0x73,0x58,0xD6,0x98,0x00,0x02,0x2C,0x00,0x00,0x96,
+    0x00,0x22,0x2C,0x73,0x0C,0x01,0xAF,0x48,0x5A,0xEB,0x6A,0xBA,0xE6,0x0B,0x6B,0x2C,0x73,0x80,0x00,0x05,0xB7,0xBE,0xFF,0x7D,0xEF,0x5C,0xEF,0x5D,0xEF,0x9D,0xF7,0xDF,
+    0xA1,0x00,0x60,0xDF,0xFF,0x79,0xD6,0x0B,0x6B,0x66,0x00,0x00,0xD8,0x00,0x00,0x04,0x00,0x00,0x42,0x02,0x82,0x48,0x52,0xEB,0x62,0xB6,0xC5,0xAA,0x62,0x5C,0x00,0x00,
+    0x16,0x00,0xC0,0x48,0x52,0xAE,0x83,0x7D,0xFF,0x30,0x8C,0x71,0x94,0xEE,0x83,0x2E,0x00,0x00,0x82,0x00,0x00,0x08,0x00,0x33,0xF2,0xAC,0xA9,0x26,0x00,0x8E,0x48,0x5A,
+    0x2F,0x8C,0xAE,0x83,0xCE,0x83,0x80,0x03,0xF2,0x07,0xDE,0xFF,0xFB,0xE6,0xD6,0xBD,0xF2,0xA4,0xCE,0x83,0x2B,0x6B,0x4C,0x73,0x2F,0x8C,0x75,0xB5,0x38,0xCE,0xDE,0xFF,
+    0x86,0x00,0x40,0xDF,0xFF,0xF7,0xC5,0xB4,0x01,0x00,0x4C,0x00,0x00,0x68,0x00,0xE6,0x68,0x5A,0xCE,0x83,0xF3,0xA4,0x50,0x8C,0x89,0x5A,0x2F,0x8C,0xEE,0x8B,0x80,0x00,
+    0xC2,0x68,0x5A,0x0B,0x6B,0xFB,0xE6,0x75,0xB5,0xCA,0x62,0xDA,0xE6,0x7C,0x00,0x02,0x32,0x00,0x21,0xEE,0x8B,0xF4,0x03,0x03,0xB4,0x03,0x4A,0xEE,0x83,0x0F,0x94,0x00,
+    0x01,0x83,0xDF,0xFF,0x3C,0xEF,0xB2,0x9C,0x8D,0x7B,0x52,0x02,0x01,0xE6,0x02,0x80,0x48,0x52,0xEA,0x62,0xF3,0xA4,0x3C,0xEF,0x07,0x01,0x62,0xBE,0xF7,0xF7,0xC5,0x0B,
+    0x6B,0x7A,0x00,0x00,0x06,0x00,0xE0,0x69,0x5A,0xB2,0xA4,0xDE,0xFF,0x9D,0xF7,0xB1,0x9C,0x6D,0x73,0x90,0x9C,0x80,0x00,0x00,0x16,0x00,0x00,0x76,0x03,0xC0,0x89,0x5A,
+    0x33,0xAD,0x1B,0xEF,0x0B,0x6B,0x13,0xAD,0x6D,0x7B,0x30,0x02,0x02,0x1C,0x00,0x41,0x89,0x5A,0x98,0xDE,0xBC,0x03,0x10,0x5A,0x96,0x00,0x48,0xAD,0x83,0xEF,0x8B,0x00,
+    0x01,0x50,0xDF,0xFF,0x38,0xCE,0x6D,0xA2,0x01,0x01,0xB6,0x04,0x00,0xE6,0x01,0x00,0x4E,0x00,0x80,0x48,0x52,0x68,0x52,0x89,0x5A,0x0F,0x8C,0x82,0x00,0x50,0x3C,0xEF,
+    0xB5,0xBD,0x6C,0x22,0x00,0x04,0x52,0x04,0x32,0x52,0xAE,0x7B,0x18,0x00,0x60,0x0B,0x6B,0xD2,0xA4,0x4C,0x73,0x30,0x00,0x00,0x04,0x00,0x00,0xEE,0x00,0xA6,0x0F,0x8C,
+    0x7C,0xF7,0xEF,0x83,0xEA,0x62,0x54,0xB5,0x80,0x00,0x64,0x48,0x52,0xAD,0x7B,0xF7,0xC5,0x3E,0x03,0x37,0xCA,0x62,0xEB,0x80,0x02,0x73,0xDF,0xFF,0x17,0xC6,0xCA,0x62,
+    0x69,0x48,0x04,0x00,0x46,0x00,0x00,0xB4,0x00,0x00,0xA8,0x00,0x00,0xD8,0x04,0xC2,0x68,0x52,0x91,0x94,0xBE,0xFF,0x1B,0xE7,0x13,0xA5,0xAD,0x7B,0x18,0x00,0x02,0x22,
+    0x00,0xE0,0x69,0x52,0x95,0xB5,0xDE,0xFF,0xBE,0xFF,0xB2,0x9C,0x91,0x9C,0xCE,0x83,0x14,0x00,0x03,0x32,0x00,0xD4,0x5A,0xEB,0x6A,0x58,0xD6,0xDA,0xE6,0xA9,0x5A,0x13,
+    0xAD,0xAA,0x62,0x14,0x00,0x00,0x4A,0x00,0x34,0xD6,0xC5,0xCE,0x42,0x03,0x01,0xE8,0x00,0x00,0x58,0x01,0x00,0x04,0x00,0x40,0x9A,0xDE,0xEA,0x62,0x9A,0x00,0x04,0x44,
+    0x00,0x08,0x08,0x00,0x00,0x0C,0x00,0xA1,0x68,0x52,0xB6,0xBD,0x7D,0xF7,0xB2,0x9C,0xD2,0xA4,0x74,0x02,0x01,0x76,0x05,0x00,0xD0,0x05,0xC0,0x50,0x8C,0x7D,0xF7,0xDF,
+    0xFF,0x58,0xCE,0x2C,0x6B,0x74,0xB5,0x7A,0x01,0x03,0x6C,0x00,0xD1,0x52,0x69,0x5A,0x13,0xAD,0xBD,0xFF,0x0B,0x6B,0x0F,0x8C,0x0F,0x8C,0xB0,0x04,0x01,0x74,0x01,0x73,
+    0x68,0x5A,0x6C,0x73,0x75,0xBD,0xA9,0x98,0x04,0x00,0x2C,0x00,0x00,0x7C,0x00,0x41,0xFF,0xFF,0xBE,0xFF,0xD6,0x04,0x05,0x58,0x01,0x01,0x4A,0x00,0x11,0x52,0x06,0x00,
+    0x01,0x12,0x01,0x00,0xBA,0x00,0x7B,0xCA,0x62,0x3C,0xEF,0xF3,0xA4,0xF2,0x68,0x01,0xD3,0x89,0x5A,0xB9,0xDE,0xDE,0xFF,0x3C,0xEF,0xEF,0x83,0x33,0xAD,0x6C,0x1C,0x01,
+    0x00,0x58,0x00,0xA0,0x48,0x52,0x8D,0x7B,0x5C,0xEF,0xD6,0xBD,0x6D,0x73,0x68,0x05,0x01,0x12,0x00,0x01,0x5E,0x00,0x40,0xA9,0x62,0x13,0xAD,0xF8,0x02,0x04,0x46,0x01,
+    0x02,0x80,0x00,0x20,0x58,0xCE,0xFC,0x00,0x00,0x26,0x00,0x00,0x18,0x00,0xA1,0x69,0x5A,0xCE,0x83,0x78,0xD6,0x58,0xD6,0x0F,0x8C,0xFA,0x00,0x01,0xEC,0x00,0x00,0xE4,
+    0x06,0x84,0x91,0x9C,0x75,0xB5,0x2C,0x6B,0x17,0xCE,0x98,0x00,0x00,0x1E,0x00,0x40,0x48,0x52,0x91,0x9C,0x20,0x03,0x62,0x34,0xAD,0x0B,0x6B,0x37,0xCE,0xF0,0x03,0x02,
+    0x18,0x00,0xA6,0x69,0x5A,0x99,0xDE,0x5C,0xEF,0xEA,0x62,0x91,0x9C,0x74,0x02,0x00,0x1A,0x02,0x40,0x8D,0x7B,0x33,0xB5,0x44,0x01,0x01,0x26,0x00,0x01,0x80,0x05,0x20,
+    0xDF,0xFF,0x24,0x01,0x00,0x7A,0x00,0x00,0x82,0x00,0xC2,0x48,0x5A,0xCE,0x83,0x38,0xCE,0x91,0x94,0x54,0xB5,0xBA,0xDE,0x56,0x03,0x00,0x2A,0x00,0x00,0x80,0x00,0xA2,
+    0x8D,0x7B,0x9A,0xDE,0x6D,0x73,0xB6,0xBD,0x2C,0x73,0x28,0x00,0x00,0x4E,0x00,0x40,0x48,0x5A,0xAA,0x5A,0x74,0x07,0x60,0xDB,0xE6,0x2C,0x6B,0x58,0xD6,0xF2,0x05,0x02,
+    0x1C,0x00,0x00,0x30,0x00,0x22,0x51,0x94,0x1A,0x02,0x15,0x6D,0x18,0x01,0x00,0x64,0x00,0xE0,0x68,0x5A,0x95,0xBD,0x8D,0x7B,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x48,0x5A,
+    0x24,0x48,0x5A,0x02,0x00,0x20,0x68,0x5A,0x02,0x00,0xC0,0x69,0x52,0x5C,0xF7,0xDA,0xE6,0x8D,0x7B,0x38,0xD6,0x68,0x52,0x10,0x00,0x11,0x68,0x20,0x00,0x40,0xEE,0x8B,
+    0x50,0x94,0x0E,0x00,0xA2,0x48,0x5A,0x68,0x5A,0xEA,0x6A,0x89,0x5A,0xAD,0x83,0x36,0x00,0x60,0x68,0x5A,0xD2,0xA4,0x8D,0x7B,0x0C,0x00,0x00,0x1E,0x00,0xC2,0x68,0x5A,
+    0x2C,0x73,0x9D,0xFF,0x91,0x94,0x70,0x94,0x2B,0x6B,0x10,0x00,0x00,0x06,0x00,0xE0,0x89,0x5A,0x37,0xCE,0xFE,0xFF,0x1B,0xE7,0x0B,0x6B,0xF3,0xAC,0xCA,0x62,0x42,0x00,
+    0x00,0x16,0x00,0x81,0x48,0x52,0x8D,0x7B,0x5C,0xF7,0xAE,0x7B,0x0C,0x00,0x01,0x64,0x00,0x00,0x0A,0x00,0xD3,0x68,0x5A,0x48,0x52,0x54,0xB5,0x9D,0xF7,0x30,0x8C,0xD2,
+    0xA4,0x0B,0x44,0x00,0x00,0x5E,0x00,0x60,0xCA,0x62,0x95,0xBD,0xAA,0x62,0x0A,0x00,0x00,0x40,0x00,0x20,0x89,0x62,0x80,0x00,0x02,0x30,0x00,0x40,0x90,0x9C,0x6C,0x73,
+    0x18,0x00,0x00,0x0E,0x00,0xC4,0x48,0x5A,0x0B,0x6B,0x3B,0xEF,0x13,0xA5,0x4C,0x73,0x33,0xB5,0xBE,0x00,0xF0,0x01,0x68,0x5A,0x68,0x52,0xB6,0xBD,0xFE,0xFF,0x5C,0xEF,
+    0xEF,0x83,0x54,0xB5,0xCA,0x62,0x28,0x00,0x02,0x04,0x00,0x60,0x6C,0x7B,0x3B,0xEF,0xCE,0x83,0x0C,0x00,0x36,0xEA,0x6A,0xA9,0x18,0x00,0xB2,0x52,0x8D,0x7B,0xDE,0xFF,
+    0xF3,0xA4,0x0B,0x6B,0xF6,0xC5,0x44,0x00,0x00,0x5E,0x00,0x73,0x48,0x5A,0x34,0xB5,0x0F,0x8C,0x48,0x12,0x01,0x02,0x00,0x01,0x00,0x3A,0x00,0x62,0x68,0x5A,0x4C,0x73,
+    0x0F,0x8C,0x0A,0x00,0x00,0x06,0x00,0xA0,0xCA,0x62,0x37,0xCE,0x95,0xB5,0xAA,0x5A,0x99,0xDE,0x0E,0x00,0x00,0xAC,0x00,0x00,0x80,0x00,0xA6,0x13,0xAD,0xDE,0xFF,0x9D,
+    0xFF,0xD2,0x9C,0x75,0xBD,0x80,0x00,0x80,0x48,0x5A,0x2C,0x73,0xB9,0xDE,0xB2,0x9C,0x28,0x00,0x35,0x70,0x9C,0x4C,0xC4,0x00,0xC0,0x68,0x5A,0x0B,0x6B,0x5C,0xEF,0x38,
+    0xCE,0xEA,0x62,0x1B,0xEF,0x1C,0x00,0x00,0x04,0x00,0x00,0x82,0x00,0x51,0x2B,0x6B,0xB9,0xDE,0x89,0xA2,0x01,0x00,0x56,0x00,0x20,0x0B,0x6B,0x06,0x00,0x00,0x2E,0x01,
+    0x42,0x89,0x5A,0x94,0xBD,0x24,0x00,0x00,0xAA,0x01,0xA0,0x89,0x5A,0x54,0xB5,0x99,0xDE,0xEB,0x62,0x3C,0xF7,0xBC,0x00,0x00,0x38,0x00,0x00,0x16,0x00,0xC0,0x0F,0x8C,
+    0xBE,0xFF,0xBE,0xFF,0x54,0xAD,0xD2,0xA4,0xEB,0x6A,0x2C,0x00,0x00,0x04,0x00,0x80,0x48,0x52,0xEA,0x6A,0x17,0xCE,0xB6,0xBD,0x20,0x00,0x40,0x70,0x9C,0x8D,0x7B,0x08,
+    0x00,0x00,0x18,0x00,0xC0,0x68,0x52,0xCA,0x62,0x17,0xC6,0x9D,0xF7,0x4C,0x6B,0x74,0xB5,0x82,0x01,0x02,0x68,0x00,0x00,0x1A,0x00,0x40,0xD6,0xC5,0xEE,0x8B,0x0E,0x00,
+    0x00,0x04,0x00,0x05,0x2E,0x00,0x50,0x5A,0x89,0x5A,0x17,0xCE,0x0E,0x00,0x00,0x16,0x00,0x00,0x04,0x00,0xA2,0xB2,0x9C,0x5C,0xF7,0x0B,0x6B,0x78,0xD6,0x68,0x52,0x2E,
+    0x01,0x00,0x84,0x00,0xB1,0x6C,0x73,0x9D,0xFF,0xDF,0xFF,0x95,0xB5,0xEF,0x83,0xAD,0xF0,0x01,0x00,0x4E,0x00,0x80,0x68,0x5A,0xA9,0x62,0x95,0xBD,0xBA,0xDE,0x3C,0x00,
+    0x40,0x2B,0x73,0x91,0x9C,0x08,0x00,0x00,0x40,0x00,0xE0,0x68,0x52,0x89,0x5A,0xD3,0xA4,0xDE,0xFF,0xCE,0x7B,0x4C,0x6B,0xB1,0x9C,0xC6,0x00,0x00,0x2E,0x00,0x82,0x48,
+    0x5A,0x68,0x52,0x2C,0x73,0xF7,0xCD,0x26,0x00,0x00,0x54,0x00,0x00,0x16,0x00,0x40,0x68,0x5A,0x89,0x5A,0x1A,0x02,0x41,0x89,0x5A,0x48,0x52,0x3C,0x00,0xD2,0x5A,0x68,
+    0x5A,0x50,0x94,0x9D,0xFF,0x6C,0x73,0x30,0x94,0x2C,0x73,0x14,0x00,0x00,0x2C,0x00,0x90,0xCA,0x62,0x7D,0xF7,0xDE,0xFF,0x95,0xB5,0x6D,0x68,0x00,0x03,0xC4,0x01,0x00,
+    0x3C,0x00,0x40,0x74,0xB5,0x3C,0xEF,0x20,0x00,0x33,0x48,0x5A,0xF6,0x5A,0x00,0x02,0x56,0x00,0xA0,0x2F,0x8C,0x7D,0xF7,0x75,0xB5,0xEA,0x62,0x95,0xBD,0xC4,0x00,0x02,
+    0x22,0x00,0x00,0x1A,0x00,0x40,0xB6,0xC5,0x4C,0x73,0x08,0x00,0x00,0x12,0x00,0x00,0x08,0x00,0xA0,0x68,0x5A,0x89,0x62,0xEA,0x62,0xAE,0x83,0xEF,0x8B,0x0E,0x00,0x02,
+    0x16,0x00,0xA2,0xCE,0x83,0x5C,0xEF,0xCE,0x83,0x2C,0x73,0x91,0x9C,0x80,0x00,0x00,0xB2,0x00,0xC5,0x89,0x5A,0x3C,0xEF,0xDF,0xFF,0xF6,0xBD,0x4C,0x73,0x13,0xAD,0xD2,
+    0x00,0x70,0x52,0x69,0x5A,0x33,0xAD,0x9D,0xF7,0x36,0x00,0x60,0x48,0x5A,0x33,0xB5,0xEA,0x6A,0x2A,0x00,0x00,0x0E,0x00,0x00,0x54,0x02,0x82,0xBA,0xDE,0x5C,0xF7,0xAA,
+    0x5A,0xD2,0xA4,0x30,0x02,0x00,0x16,0x00,0x00,0x02,0x01,0x40,0xAD,0x7B,0x34,0xB5,0x26,0x00,0x00,0x6E,0x00,0x02,0x04,0x00,0x73,0x89,0x62,0x2C,0x6B,0xEA,0x62,0xD6,
+    0xAA,0x02,0x00,0x10,0x02,0xA2,0x4C,0x73,0x99,0xDE,0xB2,0x9C,0xAA,0x62,0x34,0xB5,0x12,0x01,0x10,0x48,0x1C,0x01,0xB4,0x52,0xBA,0xDE,0xFF,0xFF,0x9A,0xD6,0x8D,0x73,
+    0xB6,0xC5,0xD2,0x00,0x01,0x98,0x02,0x32,0xA5,0xBE,0xFF,0x5C,0x00,0x20,0xEB,0x6A,0xEC,0x00,0x02,0x0C,0x00,0xC2,0x68,0x5A,0xA9,0x5A,0xD6,0xC5,0xDE,0xFF,0xCA,0x5A,
+    0xEF,0x8B,0x20,0x03,0x00,0x4A,0x00,0x00,0x04,0x00,0x40,0xEB,0x6A,0x34,0xB5,0x7A,0x02,0x00,0x0C,0x00,0x04,0x80,0x00,0x62,0x0F,0x8C,0x0B,0x6B,0xDA,0xE6,0xD6,0x00,
+    0x00,0x40,0x00,0x7A,0xCA,0x62,0x17,0xCE,0x58,0xD6,0xAA,0x3C,0x01,0xB0,0x52,0xD6,0xC5,0xFF,0xFF,0x3C,0xEF,0xCE,0x7B,0x38,0xCE,0x2A,0x00,0x00,0x28,0x00,0x00,0x80,
+    0x00,0x24,0xF3,0xA4,0x80,0x00,0x60,0x68,0x5A,0xB9,0xE6,0x68,0x52,0x18,0x00,0x00,0x04,0x00,0xB1,0x68,0x52,0x13,0xAD,0xBE,0xFF,0xD2,0xA4,0xCE,0x83,0x30,0x76,0x04,
+    0x00,0xF4,0x00,0x02,0x74,0x00,0x26,0xB1,0x9C,0x86,0x03,0x00,0x82,0x00,0xA2,0x89,0x5A,0xF2,0xA4,0x8D,0x7B,0x58,0xD6,0x89,0x5A,0x58,0x00,0x00,0xD6,0x01,0x82,0x95,
+    0xBD,0x5D,0xF7,0xA9,0x5A,0xF3,0xAC,0x36,0x00,0x00,0x38,0x00,0xC0,0x48,0x52,0xD2,0xA4,0xFF,0xFF,0x9D,0xF7,0x0F,0x84,0xF7,0xC5,0x36,0x00,0x01,0x64,0x00,0x52,0x5A,
+    0x68,0x52,0x92,0x9C,0x80,0x01,0x00,0x14,0x00,0x13,0xB1,0xC8,0x04,0x02,0x1C,0x00,0xA4,0xCE,0x83,0x7D,0xF7,0x1B,0xE7,0x4C,0x73,0x2F,0x94,0x74,0x03,0x00,0x18,0x00,
+    0x73,0x4C,0x7B,0x8D,0x7B,0x13,0xAD,0xAA,0x2C,0x04,0x00,0x5A,0x00,0x00,0x70,0x03,0x44,0xAE,0x7B,0x70,0x94,0xD8,0x02,0xC5,0x48,0x52,0x68,0x52,0x33,0xAD,0xBE,0xFF,
+    0x89,0x5A,0x30,0x8C,0x3E,0x03,0xF4,0x00,0x52,0x48,0x5A,0x6D,0x7B,0xFF,0xFF,0xDE,0xFF,0x30,0x8C,0x13,0xAD,0x0B,0x6B,0x18,0x02,0x53,0x68,0x52,0xEF,0x8B,0x5C,0xE4,
+    0x03,0x64,0x88,0x5A,0x0B,0x6B,0x13,0xAD,0xB2,0x00,0xC0,0x48,0x5A,0xAA,0x62,0xFB,0xE6,0x7D,0xF7,0xEB,0x62,0x71,0x9C,0x18,0x02,0x04,0x18,0x00,0x53,0x0F,0x8C,0xA9,
+    0x62,0x75,0x82,0x01,0x00,0x7E,0x00,0xC2,0x68,0x5A,0x69,0x5A,0x34,0xAD,0xEF,0x83,0x6C,0x73,0xB1,0xA4,0x10,0x00,0x00,0x02,0x02,0x80,0x91,0x9C,0x9D,0xFF,0xA9,0x5A,
+    0xEF,0x8B,0x24,0x05,0x02,0x16,0x00,0x51,0x48,0x52,0xCA,0x62,0xDE,0x80,0x00,0x24,0x71,0x9C,0x16,0x00,0x00,0x1A,0x00,0x31,0xEF,0x83,0x3C,0x80,0x00,0x00,0x38,0x05,
+    0x48,0x89,0x5A,0x95,0xBD,0x48,0x03,0x70,0x58,0xD6,0xBE,0xFF,0x50,0x94,0x91,0x9A,0x04,0x05,0x98,0x01,0x62,0x0B,0x6B,0xAD,0x7B,0x50,0x94,0x96,0x03,0x00,0x40,0x00,
+    0x11,0x48,0x80,0x00,0x64,0xD6,0xC5,0xCA,0x62,0x94,0xBD,0x80,0x01,0x11,0x68,0xD8,0x05,0x60,0x91,0x94,0xCE,0x83,0x0F,0x8C,0x34,0x01,0x00,0x5C,0x01,0x00,0x28,0x00,
+    0x91,0x5C,0xEF,0xDE,0xFF,0xB2,0x9C,0xEF,0x8B,0x6C,0x2E,0x06,0x00,0x3E,0x00,0x40,0x68,0x52,0x10,0x8C,0x00,0x01,0x00,0x26,0x00,0x62,0xEB,0x6A,0x69,0x5A,0x50,0x94,
+    0x1C,0x00,0x00,0xEE,0x00,0x40,0x68,0x5A,0x71,0x94,0xB2,0x03,0x20,0x2F,0x8C,0x82,0x02,0x00,0x22,0x00,0x00,0x48,0x00,0x60,0x2B,0x73,0x33,0xAD,0xAA,0x5A,0x5E,0x02,
+    0x02,0x12,0x00,0x00,0x06,0x00,0x80,0xF3,0xA4,0x5C,0xEF,0x69,0x52,0x74,0xB5,0x20,0x00,0x00,0x10,0x00,0xB1,0x48,0x5A,0xCA,0x62,0x1B,0xEF,0x58,0xD6,0xCE,0x83,0x70,
+    0x54,0x04,0x02,0x18,0x00,0xB5,0x68,0x52,0xD2,0xA4,0xDE,0xFF,0xD6,0xC5,0x6D,0x7B,0x89,0x46,0x06,0x00,0xBC,0x06,0x22,0xBE,0xFF,0x20,0x00,0x73,0xA9,0x62,0x0F,0x8C,
+    0x8D,0x7B,0x70,0xB4,0x03,0x00,0x48,0x00,0xA4,0x8A,0x5A,0xDE,0xFF,0x38,0xCE,0x8D,0x7B,0x70,0x94,0x32,0x03,0x00,0x5A,0x00,0x71,0x74,0xB5,0x6D,0x73,0x13,0xAD,0x2F,
+    0x0A,0x06,0x01,0xC4,0x00,0x10,0x5A,0xAA,0x02,0x42,0x69,0x52,0xB1,0x9C,0xD8,0x01,0x00,0x3A,0x00,0xA4,0x69,0x5A,0xDA,0xDE,0x5C,0xEF,0x4C,0x73,0xB1,0x9C,0xB2,0x06,
+    0x00,0x16,0x00,0x71,0xAA,0x62,0xCE,0x83,0xAD,0x83,0x69,0xEA,0x06,0x00,0x10,0x00,0x00,0x3E,0x00,0x22,0x34,0xAD,0x80,0x00,0x00,0x84,0x00,0x60,0x99,0xDE,0x2C,0x6B,
+    0x91,0x9C,0x6E,0x02,0x02,0x1E,0x00,0x91,0x69,0x52,0x7D,0xF7,0xFB,0xE6,0xAE,0x7B,0x95,0xA2,0x05,0x02,0x14,0x00,0x80,0x89,0x5A,0xD2,0xA4,0x30,0x94,0xCA,0x62,0x5E,
+    0x06,0x00,0x12,0x00,0x00,0x2A,0x01,0x00,0x44,0x03,0x51,0xEB,0x62,0x0F,0x8C,0xAD,0xCA,0x06,0x00,0x12,0x00,0xB7,0x48,0x52,0x78,0xD6,0x7D,0xF7,0xCA,0x62,0x33,0xAD,
+    0x4C,0x04,0x05,0x01,0x08,0x04,0x10,0x5A,0x76,0x00,0x00,0x6E,0x00,0xA0,0x48,0x5A,0x68,0x5A,0x0B,0x6B,0x58,0xCE,0xFF,0xFF,0x66,0xCE,0x83,0x50,0x94,0x48,0x5A,0x02,
+    0x00,0x62,0xAE,0x83,0xBA,0xE6,0x48,0x52,0x10,0x00,0x51,0x68,0x5A,0x68,0x5A,0x48,0x04,0x00,0x7F,0x48,0x5A,0x68,0x52,0xB9,0xDE,0xFF,0x01,0x00,0x02,0x60,0x91,0x94,
+    0xEB,0x62,0x79,0xDE,0x2C,0x00,0x00,0x04,0x00,0xA2,0x48,0x52,0x48,0x52,0xEA,0x62,0x79,0xD6,0x30,0x94,0x46,0x00,0x02,0x42,0x00,0xE0,0x68,0x5A,0x48,0x52,0x6D,0x7B,
+    0xFB,0xE6,0x30,0x8C,0x6D,0x73,0xF7,0xC5,0x14,0x00,0x00,0x58,0x00,0x00,0x30,0x00,0x40,0x6C,0x73,0xD1,0xA4,0x6E,0x00,0x02,0x14,0x00,0x82,0x48,0x5A,0x69,0x52,0x1B,
+    0xEF,0x4C,0x7B,0x12,0x00,0x00,0x14,0x00,0x00,0x24,0x00,0x01,0x2C,0x00,0x0F,0x80,0x00,0x08,0x40,0x4C,0x73,0x78,0xD6,0x28,0x00,0x02,0x04,0x00,0x00,0x82,0x00,0x60,
+    0x38,0xD6,0xAD,0x7B,0x68,0x52,0x40,0x00,0x01,0x3C,0x00,0x10,0x5A,0x1A,0x00,0xA0,0xAD,0x7B,0x3C,0xEF,0xCE,0x7B,0x0F,0x84,0xB5,0xBD,0x5E,0x00,0x04,0x18,0x00,0x42,
+    0x0B,0x6B,0x13,0xAD,0x10,0x00,0x00,0x06,0x00,0x80,0x89,0x62,0x69,0x5A,0xEF,0x8B,0x54,0xB5,0x3C,0x00,0x06,0x3E,0x00,0x00,0x2C,0x00,0x4F,0x48,0x52,0x37,0xCE,0xFF,
+    0x00,0x01,0x80,0xDE,0xFF,0x91,0x94,0x6C,0x73,0x58,0xD6,0x3E,0x00,0x00,0x66,0x00,0xC0,0x68,0x5A,0x68,0x52,0x69,0x52,0x78,0xD6,0xCE,0x83,0x68,0x52,0x46,0x00,0x00,
+    0x3C,0x00,0x00,0x18,0x00,0xB3,0x48,0x52,0xCE,0x83,0x7C,0xF7,0x8D,0x73,0x71,0x94,0x33,0x70,0x00,0x00,0x16,0x00,0x51,0x68,0x5A,0xAA,0x5A,0x75,0x90,0x00,0x02,0x6E,
+    0x00,0xA0,0xCE,0x83,0xCA,0x62,0xAA,0x62,0xF7,0xCD,0xA9,0x62,0x38,0x00,0x00,0x54,0x00,0x00,0x08,0x00,0x00,0x2A,0x00,0x3F,0x48,0x52,0x17,0x80,0x00,0x02,0x66,0xFF,
+    0xFF,0x71,0x94,0xCE,0x83,0x80,0x00,0x20,0x48,0x5A,0x00,0x01,0x93,0xF6,0xC5,0xBA,0xDE,0xDA,0xE6,0x58,0xD6,0x89,0xDA,0x01,0x00,0x80,0x01,0xA2,0x0F,0x8C,0x9D,0xFF,
+    0x4C,0x73,0x34,0xAD,0x91,0x9C,0x58,0x00,0x02,0x5A,0x00,0x40,0x89,0x5A,0xD6,0xC5,0x10,0x00,0x02,0x80,0x00,0xA2,0x8D,0x83,0x2F,0x8C,0x89,0x5A,0x33,0xAD,0xEE,0x8B,
+    0x1E,0x00,0x00,0x7A,0x00,0x03,0x04,0x00,0x3F,0x52,0xF7,0xC5,0x00,0x01,0x01,0x00,0x80,0x00,0x43,0x50,0x94,0x37,0xCE,0x26,0x00,0x01,0x30,0x02,0x20,0x89,0x5A,0x02,
+    0x00,0x42,0x8D,0x7B,0x75,0xBD,0x80,0x00,0x00,0x1C,0x00,0x21,0x48,0x52,0x80,0x00,0x52,0x6B,0x17,0xCE,0xCE,0x83,0x70,0x00,0x00,0x16,0x00,0x2A,0x68,0x5A,0x80,0x00,
+    0xB1,0x2B,0x73,0x99,0xDE,0x69,0x52,0x0F,0x8C,0xF3,0xAC,0x69,0x4A,0x00,0x02,0x24,0x00,0x01,0x06,0x00,0x3F,0x52,0xB5,0xBD,0x80,0x00,0x06,0x14,0x8C,0x80,0x00,0x00,
+    0x5A,0x00,0xD1,0x48,0x52,0x33,0xAD,0x38,0xCE,0x33,0xAD,0xCE,0x83,0x75,0xB5,0x69,0xFA,0x01,0x00,0x40,0x00,0x31,0x48,0x52,0x2F,0x00,0x01,0x33,0xDA,0xE6,0x6D,0x5E,
+    0x02,0x00,0x2C,0x00,0x62,0x68,0x5A,0x89,0x52,0x54,0xB5,0xFC,0x00,0x00,0x10,0x00,0xC4,0xCA,0x62,0x1B,0xEF,0x4C,0x6B,0x2C,0x6B,0x34,0xB5,0xEA,0x6A,0x16,0x00,0x02,
+    0x08,0x00,0x3F,0x68,0x52,0x95,0x80,0x00,0x06,0x33,0xB2,0x9C,0x17,0x00,0x01,0x00,0x44,0x00,0xC0,0x68,0x52,0x99,0xD6,0xFE,0xFF,0x79,0xD6,0x30,0x8C,0x34,0xB5,0x00,
+    0x01,0x00,0x7E,0x00,0x00,0x16,0x02,0x20,0x2F,0x8C,0x5C,0x00,0x41,0x3B,0xEF,0xEB,0x6A,0x26,0x00,0x01,0x9A,0x01,0x80,0xA9,0x62,0x89,0x52,0xD2,0xA4,0xEA,0x62,0x64,
+    0x00,0x00,0x28,0x00,0xE0,0xAA,0x62,0x1B,0xE7,0xBA,0xDE,0x89,0x5A,0x54,0xB5,0x8D,0x7B,0x48,0x52,0x12,0x00,0x00,0x1A,0x00,0x01,0x30,0x00,0x3F,0x52,0x54,0xAD,0x00,
+    0x01,0x03,0x40,0x70,0x8C,0x34,0xAD,0x44,0x02,0x04,0x2E,0x00,0xC0,0x69,0x5A,0xBA,0xDE,0xDE,0xFF,0x79,0xD6,0x71,0x94,0xF3,0xAC,0x3E,0x00,0x00,0x18,0x00,0x00,0x4C,
+    0x00,0x93,0xB2,0x9C,0x58,0xCE,0x0B,0x6B,0x5C,0xF7,0xAA,0x5A,0x01,0x00,0x56,0x00,0x80,0xCE,0x83,0x89,0x52,0x71,0x9C,0x2B,0x73,0x0C,0x00,0x00,0xF2,0x01,0xC0,0x89,
+    0x5A,0xFB,0xE6,0x9D,0xF7,0x0B,0x6B,0x50,0x94,0xD2,0xA4,0xBE,0x02,0x02,0x40,0x00,0x00,0x1A,0x00,0x3F,0x68,0x5A,0x13,0x80,0x00,0x08,0x20,0x74,0xB5,0x42,0x00,0x00,
+    0x2E,0x00,0xE2,0x48,0x5A,0xAA,0x5A,0xBA,0xDE,0xFF,0xFF,0x58,0xD6,0x91,0x9C,0xB1,0x9C,0x12,0x00,0x00,0x82,0x00,0x00,0xD4,0x00,0x64,0x95,0xBD,0x0B,0x6B,0x3C,0xEF,
+    0x14,0x01,0x00,0x56,0x00,0x80,0xD2,0xA4,0xAA,0x5A,0x30,0x94,0x8D,0x7B,0x0C,0x00,0x00,0x2C,0x00,0xC4,0x68,0x52,0xDA,0xDE,0xBE,0xFF,0xF3,0xA4,0x0B,0x6B,0x38,0xCE,
+    0x28,0x00,0x00,0x3E,0x00,0x00,0x04,0x00,0x0F,0x80,0x00,0x05,0x42,0x50,0x8C,0xB6,0xBD,0xC4,0x03,0x00,0x26,0x00,0xF1,0x00,0x68,0x5A,0xCA,0x62,0xDB,0xDE,0xDE,0xFF,
+    0xF7,0xC5,0xB2,0x9C,0x50,0x94,0x68,0xCA,0x04,0x00,0x18,0x00,0xA2,0xA9,0x5A,0x17,0xCE,0x33,0xAD,0x0B,0x6B,0xFB,0xE6,0xD8,0x00,0x00,0x14,0x00,0x20,0x48,0x52,0x68,
+    0x01,0x40,0xEE,0x83,0xCE,0x83,0x0E,0x00,0x02,0x80,0x00,0x00,0xBC,0x00,0x82,0x17,0xCE,0x89,0x5A,0xB6,0xBD,0x8D,0x7B,0x16,0x00,0x03,0x06,0x00,0x3F,0x52,0xD2,0x9C,
+    0x80,0x01,0x03,0x51,0x50,0x8C,0x38,0xCE,0xD2,0xC4,0x04,0x02,0xC6,0x00,0x00,0x64,0x00,0x81,0xDE,0xFF,0x14,0xAD,0xD2,0xA4,0x2F,0x8C,0x54,0x00,0x01,0x84,0x02,0xA0,
+    0xAA,0x62,0x78,0xD6,0xF2,0xA4,0x4C,0x73,0x79,0xD6,0x18,0x05,0x02,0x54,0x00,0x95,0x48,0x52,0xB5,0xBD,0xB2,0x9C,0x8D,0x7B,0xEF,0x6E,0x03,0xE0,0x48,0x52,0x99,0xD6,
+    0xDF,0xFF,0x3C,0xEF,0xCE,0x83,0xEF,0x8B,0x57,0xD6,0x3E,0x00,0x02,0x54,0x00,0x00,0x40,0x02,0x0F,0x80,0x00,0x07,0x31,0x17,0xC6,0x95,0x44,0x04,0x00,0x2C,0x00,0xC2,
+    0x48,0x5A,0x89,0x5A,0x79,0xD6,0xDE,0xFF,0x91,0x9C,0xB2,0xA4,0x6A,0x03,0x00,0x16,0x00,0xC2,0x68,0x5A,0xAA,0x62,0xB9,0xDE,0x91,0x9C,0xEF,0x83,0xD6,0xC5,0x80,0x00,
+    0x01,0xB0,0x01,0x92,0x52,0xD6,0xC5,0xB6,0xBD,0x4D,0x73,0x70,0x9C,0x14,0x00,0x00,0x66,0x00,0xE1,0x58,0xD6,0xDF,0xFF,0xBE,0xFF,0xD2,0x9C,0x89,0x5A,0x3B,0xEF,0xCA,
+    0x62,0x26,0x00,0x01,0xC0,0x00,0x3F,0x68,0x52,0xB2,0x00,0x01,0x04,0x51,0x30,0x8C,0xD2,0x9C,0x78,0xD6,0x00,0x02,0x6A,0x00,0xB1,0x48,0x52,0x50,0x94,0x3B,0xEF,0x0F,
+    0x8C,0xAD,0x7B,0xEA,0xEA,0x02,0x02,0x16,0x00,0x00,0x5A,0x03,0x60,0xB1,0x9C,0xF2,0xA4,0x33,0xAD,0x94,0x01,0x00,0xDA,0x00,0x00,0xFC,0x03,0x86,0x37,0xCE,0x38,0xCE,
+    0x2C,0x6B,0xD2,0xA4,0x80,0x00,0x20,0x17,0xCE,0x67,0x06,0x86,0x17,0xC6,0xEB,0x62,0x34,0xB5,0xF3,0xAC,0xAC,0x01,0x3F,0x68,0x52,0x91,0x80,0x00,0x04,0x71,0x50,0x8C,
+    0x2C,0x6B,0xFB,0xE6,0xAA,0xAC,0x00,0x00,0x6C,0x00,0x00,0xEC,0x02,0x40,0xEE,0x83,0xEB,0x6A,0x40,0x02,0x00,0xC0,0x00,0x00,0x14,0x00,0x00,0x16,0x02,0x84,0x5C,0xF7,
+    0xB1,0x9C,0xB6,0xBD,0x2F,0x8C,0x54,0x00,0xB3,0x48,0x5A,0x0B,0x6B,0x99,0xDE,0xBA,0xDE,0x2C,0x73,0xB2,0x80,0x00,0x00,0x2E,0x00,0x20,0x75,0xB5,0xE6,0x01,0x77,0x7D,
+    0xF7,0x6D,0x73,0xCA,0x62,0x58,0x56,0x06,0x40,0x68,0x52,0x71,0x94,0x1A,0x00,0x0C,0x04,0x00,0xA0,0xDF,0xFF,0x71,0x94,0x69,0x52,0x3C,0xEF,0x71,0x9C,0x78,0x00,0x00,
+    0x6C,0x00,0x00,0x46,0x00,0x00,0x04,0x00,0x03,0xE4,0x01,0x01,0xE8,0x03,0xE2,0x68,0x5A,0xEA,0x62,0x7D,0xF7,0x91,0x94,0x38,0xD6,0x4C,0x73,0x68,0x52,0x2A,0x00,0xB1,
+    0x48,0x5A,0x8D,0x7B,0xFB,0xE6,0x3C,0xEF,0x2C,0x6B,0x91,0x28,0x03,0x00,0x14,0x01,0x40,0x48,0x5A,0xB2,0x9C,0x00,0x01,0xA0,0xFF,0xFF,0xB2,0x9C,0x69,0x52,0xF6,0xC5,
+    0x4C,0x73,0x46,0x00,0x01,0x4E,0x00,0x0F,0x80,0x00,0x04,0x40,0xFF,0xFF,0x14,0xA5,0x44,0x04,0x40,0x38,0xD6,0xEB,0x6A,0xDA,0x00,0x06,0x82,0x00,0x02,0x50,0x00,0x00,
+    0x3C,0x00,0x00,0x14,0x00,0xA5,0x0B,0x6B,0x5C,0xEF,0xEF,0x83,0x79,0xD6,0xEA,0x62,0x26,0x00,0x50,0x52,0xEF,0x83,0x5C,0xEF,0x20,0x68,0x5A,0x02,0x00,0x60,0x48,0x5A,
+    0x48,0x5A,0x68,0x5A,0x06,0x00,0xF0,0x01,0xEA,0x62,0x13,0xAD,0x7D,0xEF,0xFF,0xFF,0xFE,0xFF,0x70,0x94,0x8D,0x73,0x74,0xB5,0x14,0x00,0x04,0x04,0x00,0xE2,0x0B,0x6B,
+    0xBE,0xFF,0xDE,0xFF,0xAE,0x7B,0xEF,0x8B,0x95,0xBD,0x68,0x52,0x38,0x00,0xF0,0x01,0x68,0x5A,0x68,0x52,0x0B,0x6B,0x9D,0xF7,0x8D,0x7B,0x75,0xB5,0xEF,0x8B,0x48,0x52,
+    0x48,0x00,0x01,0x1A,0x00,0xE3,0x52,0x0F,0x8C,0x7D,0xF7,0xFF,0xFF,0x91,0x94,0x0F,0x8C,0x13,0xAD,0x89,0x5E,0x00,0x00,0x4A,0x00,0xF0,0x01,0xA9,0x62,0x95,0xBD,0xBA,
+    0xDE,0xAA,0x5A,0xD6,0xC5,0x70,0x9C,0x48,0x52,0x68,0x5A,0x04,0x00,0x00,0x7C,0x00,0x00,0x04,0x00,0x60,0x48,0x5A,0x71,0x94,0xDE,0xFF,0x01,0x00,0x80,0xFE,0xFF,0x6D,
+    0x73,0x0F,0x8C,0x54,0xB5,0x52,0x00,0x00,0x36,0x00,0x00,0x04,0x00,0xC2,0xCE,0x83,0xDE,0xFF,0x7D,0xF7,0x8D,0x73,0xF6,0xC5,0xB2,0xA4,0x68,0x00,0x00,0x06,0x00,0xC0,
+    0x48,0x52,0xD2,0xA4,0x7C,0xF7,0xEB,0x62,0x95,0xBD,0x4C,0x73,0x2E,0x00,0x00,0x7E,0x00,0x00,0x04,0x00,0xC0,0xB2,0x9C,0xDF,0xFF,0xDF,0xFF,0x2C,0x6B,0xF2,0xA4,0xB1,
+    0x9C,0x10,0x00,0x02,0x60,0x00,0xF0,0x07,0x68,0x5A,0x0B,0x6B,0xDA,0xDE,0xF3,0xA4,0x69,0x52,0xFA,0xE6,0xEB,0x6A,0x48,0x5A,0xF3,0xAC,0x0F,0x8C,0xA9,0x62,0x1C,0x00,
+    0x00,0x04,0x00,0x50,0x48,0x5A,0x91,0x9C,0xDF,0x7F,0x00,0x92,0xFF,0xBE,0xFF,0xEA,0x62,0x34,0xAD,0xD2,0xA4,0x52,0x00,0x00,0x7E,0x00,0xE4,0x68,0x52,0x34,0xAD,0xDF,
+    0xFF,0x99,0xDE,0x2C,0x6B,0x9D,0xFF,0x4C,0x73,0x52,0x00,0x00,0x00,0x01,0xA2,0x58,0xCE,0xDA,0xDE,0x6D,0x73,0x74,0xB5,0xEA,0x6A,0x16,0x00,0x00,0x4A,0x00,0xE0,0x89,
+    0x5A,0x74,0xB5,0xDE,0xFF,0xDA,0xDE,0xCA,0x5A,0xD6,0xC5,0xCE,0x83,0xE4,0x00,0x01,0xAC,0x00,0xD0,0x5A,0x48,0x5A,0xAE,0x83,0xBD,0xFF,0x30,0x8C,0x0F,0x8C,0x78,0xDE,
+    0x5C,0x00,0x60,0xD2,0xA4,0x3B,0xEF,0x2F,0x94,0x0A,0x00,0x01,0x3C,0x00,0x31,0x52,0x30,0x8C,0x7F,0x00,0x90,0xFF,0x3C,0xEF,0xA9,0x5A,0x38,0xCE,0xCE,0x83,0x7A,0x00,
+    0x00,0x3A,0x00,0x00,0x68,0x00,0xC0,0xDA,0xE6,0xDE,0xFF,0x75,0xB5,0xCA,0x62,0x7D,0xF7,0x68,0x52,0x32,0x00,0xF0,0x01,0x48,0x5A,0x48,0x52,0x48,0x52,0x89,0x5A,0xDA,
+    0xE6,0xD2,0x9C,0x2F,0x8C,0x74,0xB5,0x66,0x01,0x01,0x46,0x00,0xF3,0x02,0x5A,0x48,0x5A,0x0B,0x6B,0x3C,0xEF,0xDF,0xFF,0x54,0xAD,0xEB,0x62,0xD6,0xC5,0xCA,0x62,0x2E,
+    0x00,0x00,0x86,0x01,0x30,0x52,0xF3,0xAC,0xC4,0x00,0x40,0xDA,0xE6,0x50,0x94,0xA8,0x00,0x51,0x48,0x52,0x99,0xDE,0xB1,0x88,0x01,0x00,0x0E,0x00,0x42,0x68,0x52,0x8D,
+    0x7B,0x00,0x01,0x71,0x79,0xD6,0xA9,0x5A,0x78,0xD6,0xAA,0x1E,0x02,0x02,0x54,0x00,0xB1,0x89,0x5A,0x9D,0xF7,0xDE,0xFF,0x13,0xA5,0x8D,0x7B,0xB9,0xBA,0x00,0x00,0x9A,
+    0x00,0x00,0x34,0x00,0xA3,0x4C,0x73,0x3C,0xEF,0xAA,0x5A,0x71,0x94,0x91,0x9C,0xA8,0x00,0x01,0x48,0x02,0x32,0x6D,0x73,0xDE,0x2C,0x02,0x41,0x83,0xB6,0xBD,0x69,0x12,
+    0x00,0x00,0x1E,0x00,0xC0,0x48,0x5A,0x69,0x52,0xBA,0xE6,0xB6,0xC5,0x0B,0x6B,0x5C,0xF7,0xAE,0x00,0x00,0xC2,0x00,0x60,0xF7,0xCD,0xF2,0xA4,0x68,0x52,0x4E,0x00,0x00,
+    0x04,0x00,0x22,0x0B,0x6B,0x80,0x00,0x00,0xE8,0x00,0x22,0x99,0xDE,0x7A,0x00,0x00,0x18,0x00,0xE8,0x48,0x52,0xEB,0x6A,0xDE,0xFF,0xBE,0xFF,0xB2,0x9C,0x54,0xB5,0x95,
+    0xBD,0xD0,0x00,0x20,0x71,0x9C,0x80,0x00,0x10,0x54,0x7E,0x02,0x01,0x68,0x00,0x00,0x94,0x00,0x20,0x68,0x52,0x48,0x02,0x81,0x3C,0xEF,0xEB,0x62,0x95,0xB5,0x71,0x94,
+    0x40,0x00,0x01,0x1C,0x00,0x10,0x48,0xAC,0x02,0x70,0xFF,0xB2,0x9C,0x71,0x9C,0x58,0xD6,0x94,0x01,0x00,0x7E,0x02,0x44,0x34,0xB5,0x34,0xAD,0x50,0x00,0x42,0x48,0x5A,
+    0x69,0x5A,0x80,0x00,0x60,0x91,0x94,0x6C,0x73,0x78,0xD6,0x80,0x00,0x00,0x3E,0x00,0x00,0x54,0x00,0x00,0x7E,0x02,0x80,0x3C,0xEF,0xCF,0x83,0x58,0xD6,0x0C,0x6B,0xB0,
+    0x00,0x00,0x14,0x00,0x00,0x96,0x01,0xA0,0x54,0xB5,0x18,0xCE,0xCA,0x62,0x79,0xD6,0x2C,0x6B,0x2A,0x00,0x00,0x04,0x00,0x00,0x56,0x00,0xA6,0xBA,0xDE,0xFE,0xFF,0x38,
+    0xCE,0xCA,0x5A,0xFB,0xE6,0x18,0x00,0xE0,0x48,0x5A,0x68,0x52,0xB2,0x9C,0x3C,0xEF,0x8E,0x7B,0xB6,0xBD,0x8D,0x7B,0x74,0x00,0x76,0x68,0x5A,0x89,0x5A,0x70,0x94,0x75,
+    0xE6,0x02,0xD0,0x52,0x48,0x52,0xBE,0xFF,0xFF,0xFF,0xDF,0xFF,0x0F,0x84,0xB2,0x9C,0xE8,0x00,0x00,0x66,0x00,0x00,0x26,0x01,0xD0,0x48,0x52,0xB5,0xBD,0xFF,0xFF,0x9A,
+    0xD6,0x0C,0x6B,0x79,0xD6,0x69,0xF8,0x01,0x00,0xCC,0x01,0xD0,0x5A,0x48,0x5A,0xA9,0x5A,0xF6,0xC5,0x2F,0x8C,0xEA,0x62,0xF6,0xC5,0x94,0x00,0x03,0x7E,0x00,0x12,0x5A,
+    0xAC,0x01,0x64,0x71,0x94,0x8D,0x7B,0xFB,0xE6,0x7E,0x01,0x02,0x1C,0x00,0x91,0x7D,0xF7,0x99,0xD6,0x4C,0x6B,0x58,0xD6,0xCA,0xF4,0x02,0x75,0x48,0x5A,0x89,0x5A,0xEE,
+    0x83,0x95,0xA2,0x01,0x00,0xA0,0x01,0x00,0xB6,0x03,0x82,0x9E,0xF7,0xAE,0x7B,0xF7,0xC5,0x0F,0x8C,0xE6,0x03,0x00,0x06,0x01,0xD1,0x68,0x52,0x99,0xD6,0xFE,0xFF,0x58,
+    0xCE,0x6D,0x73,0x58,0xD6,0x89,0x4C,0x01,0x02,0x9A,0x00,0x60,0x4C,0x73,0x99,0xD6,0x8D,0x73,0x7E,0x02,0x02,0x80,0x00,0x02,0x16,0x00,0xC2,0xAE,0x7B,0xDE,0xFF,0x9D,
+    0xF7,0xEF,0x83,0x33,0xAD,0x13,0xAD,0x18,0x00,0x00,0x7E,0x00,0x80,0x48,0x52,0xEA,0x62,0xBE,0xFF,0x54,0xAD,0xD8,0x03,0x02,0x44,0x00,0x00,0xC0,0x00,0x42,0xAE,0x7B,
+    0xB6,0xC5,0x0E,0x00,0x00,0x3C,0x00,0xE0,0x69,0x52,0x3C,0xEF,0xFF,0xFF,0x1C,0xE7,0x8D,0x73,0xDA,0xE6,0x0B,0x6B,0x34,0x02,0x02,0x7E,0x00,0x20,0x69,0x52,0xFE,0x02,
+    0x60,0xD6,0xBD,0x71,0x94,0x95,0xBD,0x28,0x00,0x00,0x1A,0x00,0x00,0x04,0x00,0xA2,0xEF,0x83,0xDA,0xDE,0x0B,0x6B,0x99,0xDE,0x0F,0x8C,0x16,0x00,0x00,0x14,0x00,0xE1,
+    0x68,0x52,0xB5,0xBD,0xDE,0xFF,0xBA,0xDE,0x6D,0x73,0xBA,0xE6,0x6D,0x7B,0x7A,0x00,0x01,0xB2,0x00,0x40,0x48,0x52,0x13,0xAD,0xC0,0x04,0x20,0x13,0xA5,0xFC,0x02,0x02,
+    0x30,0x00,0x62,0xCA,0x62,0x8D,0x7B,0xD6,0xC5,0x8C,0x02,0x00,0xB8,0x01,0xC0,0x48,0x52,0xFB,0xE6,0xDF,0xFF,0x59,0xCE,0x4C,0x6B,0x3C,0xEF,0x96,0x00,0x01,0x7E,0x00,
+    0xE8,0x5A,0x68,0x52,0x2C,0x6B,0x1B,0xE7,0xDE,0xFF,0xD2,0x9C,0x13,0xA5,0xEE,0x94,0x03,0xA1,0x5A,0x71,0x94,0xD6,0xBD,0xCA,0x5A,0x7C,0xF7,0x89,0x94,0x01,0x00,0x6C,
+    0x00,0xE2,0x68,0x5A,0x69,0x5A,0x1B,0xEF,0xDF,0xFF,0xB6,0xBD,0x4C,0x6B,0xDA,0xE6,0x66,0x00,0x04,0x18,0x00,0xA0,0x78,0xD6,0x3C,0xEF,0xEA,0x62,0x95,0xBD,0xAD,0x7B,
+    0x58,0x00,0x00,0xAC,0x00,0x80,0xCA,0x62,0x6C,0x73,0x17,0xCE,0xAA,0x62,0x8E,0x02,0x00,0x26,0x00,0xB1,0x48,0x52,0xBA,0xDE,0xDE,0xFF,0x96,0xB5,0x6D,0x73,0xFA,0x3C,
+    0x00,0x03,0x28,0x00,0xC3,0x52,0x92,0x9C,0x9D,0xF7,0xBE,0xFF,0xAE,0x7B,0x54,0xAD,0x8D,0xD2,0x00,0x00,0x5A,0x00,0xA5,0x89,0x5A,0x34,0xAD,0xF3,0xA4,0x4C,0x6B,0x3B,
+    0xEF,0x40,0x00,0xE6,0x5A,0x48,0x5A,0x2C,0x6B,0x9E,0xFF,0xDE,0xFF,0x54,0xAD,0x50,0x94,0x74,0x5A,0x02,0x01,0xA8,0x05,0x80,0xDA,0xE6,0xB6,0xBD,0x4C,0x73,0x95,0xBD,
+    0xFE,0x01,0x00,0x40,0x00,0x00,0x2C,0x00,0x60,0x4C,0x73,0x17,0xCE,0xEA,0x62,0x8C,0x00,0x01,0x12,0x00,0xB0,0x52,0x59,0xD6,0xDE,0xFF,0x34,0xAD,0x10,0x8C,0xD6,0xC5,
+    0x90,0x00,0x04,0x80,0x00,0x20,0x34,0xAD,0x7C,0x05,0x61,0x4C,0x6B,0x95,0xBD,0x6C,0x73,0x28,0x00,0x00,0x80,0x02,0x90,0x52,0xCA,0x62,0x37,0xCE,0x50,0x94,0x13,0xAD,
+    0x94,0x01,0x02,0x2A,0x00,0x00,0xE4,0x02,0xC0,0x92,0x9C,0xBE,0xFF,0x5C,0xEF,0xEF,0x83,0xD6,0xBD,0xEF,0x8B,0x58,0x00,0x00,0x04,0x00,0x00,0x2A,0x03,0xA0,0xB1,0x9C,
+    0x9D,0xFF,0x0B,0x6B,0x50,0x94,0x33,0xAD,0x2C,0x00,0x02,0x46,0x00,0x73,0xAD,0x7B,0x2C,0x6B,0x38,0xCE,0x2B,0xEA,0x01,0x00,0x2A,0x00,0x20,0x17,0xCE,0x66,0x04,0x20,
+    0x13,0xAD,0x50,0x04,0x00,0x10,0x00,0x01,0x28,0x00,0xB0,0x52,0x55,0xB5,0xDE,0xFF,0xDB,0xE6,0x6D,0x73,0x75,0xB5,0xB6,0x05,0x02,0x9A,0x00,0xA4,0x48,0x52,0x2B,0x6B,
+    0xBA,0xDE,0xAE,0x7B,0x99,0xDE,0x2A,0x02,0x02,0x18,0x00,0xA8,0xF7,0xC5,0xDF,0xFF,0xFB,0xE6,0xEB,0x62,0xB6,0xBD,0x2C,0x00,0x40,0x68,0x5A,0x34,0xAD,0xD4,0x01,0x42,
+    0xB5,0xBD,0xEE,0x83,0x7C,0x03,0x00,0x86,0x00,0x82,0xEE,0x83,0x2B,0x6B,0x58,0xD6,0x4C,0x73,0xEA,0x02,0x00,0x6A,0x03,0x93,0xB6,0xBD,0x9D,0xFF,0x91,0x94,0xD6,0xBD,
+    0xEF,0xE8,0x01,0x00,0x14,0x00,0x20,0xCA,0x62,0x54,0x00,0x64,0xD6,0xC5,0xAE,0x83,0x13,0xAD,0x50,0x03,0x00,0x98,0x00,0x82,0x8D,0x7B,0x38,0xD6,0x4C,0x73,0xDA,0xE6,
+    0x3E,0x00,0x00,0x12,0x00,0xF2,0x01,0x48,0x5A,0xCA,0x62,0x99,0xD6,0xDF,0xFF,0x38,0xCE,0xEF,0x83,0xB6,0xC5,0xAA,0x62,0x92,0x00,0x00,0x5A,0x02,0x00,0xA6,0x02,0x80,
+    0xF3,0xA4,0xCA,0x5A,0x99,0xDE,0xCA,0x62,0x14,0x03,0x00,0x7E,0x00,0x80,0x68,0x5A,0xD2,0xA4,0xEB,0x62,0x58,0xD6,0xD4,0x01,0x00,0x10,0x00,0x00,0x3E,0x01,0x80,0x54,
+    0xB5,0xFB,0xE6,0x8D,0x73,0xF7,0xC5,0x3C,0x01,0x02,0x3E,0x00,0x40,0x48,0x5A,0x2C,0x73,0x16,0x02,0x62,0x10,0x8C,0x2F,0x8C,0xD2,0xA4,0x66,0x00,0x00,0x1A,0x00,0xA0,
+    0x69,0x5A,0x91,0x9C,0xB6,0xBD,0xCE,0x83,0x58,0xD6,0x80,0x00,0x03,0x2C,0x01,0x30,0x52,0xCE,0x83,0xFA,0x05,0x55,0x10,0x8C,0x91,0x9C,0x71,0xF8,0x06,0x00,0x80,0x00,
+    0x80,0xAE,0x83,0x9D,0xF7,0xAE,0x7B,0xEF,0x83,0x56,0x04,0xA0,0x48,0x52,0x68,0x5A,0x68,0x5A,0x68,0x5A,0x68,0x52,0x34,0x48,0x5A,0x68,0x02,0x00,0xF2,0x06,0x52,0x69,
+    0x5A,0x34,0xAD,0xFF,0xFF,0xFF,0xFF,0xBE,0xFF,0x34,0xAD,0xCE,0x83,0x79,0xDE,0x69,0x5A,0x48,0x5A,0x20,0x00,0x60,0x48,0x5A,0x89,0x5A,0x79,0xD6,0x1C,0x00,0x70,0xDF,
+    0xFF,0x1B,0xE7,0xBE,0xFF,0xDE,0x0B,0x00,0x0F,0x04,0x00,0x0A,0x02,0x38,0x00,0x01,0x5C,0x00,0x05,0x58,0x00,0x80,0x3C,0xEF,0x4C,0x6B,0x95,0xBD,0xD2,0xA4,0x56,0x00,
+    0x00,0x20,0x00,0x00,0x08,0x00,0xFF,0x03,0xCE,0x83,0x3C,0xEF,0xDF,0xFF,0xDF,0xFF,0x3C,0xEF,0x30,0x8C,0xCE,0x83,0x95,0xB5,0x7D,0xF7,0x57,0x00,0x0A,0x10,0xFF,0x34,
+    0x00,0x01,0x56,0x00,0x43,0x5A,0x68,0x5A,0x89,0xB0,0x00,0x86,0x99,0xDE,0xEA,0x62,0xF6,0xC5,0xEB,0x6A,0x1C,0x00,0xFF,0x08,0x69,0x5A,0x13,0xAD,0xDE,0xFF,0x30,0x8C,
+    0xFB,0xE6,0xF7,0xC5,0xCA,0x62,0x48,0x52,0x68,0x5A,0xEA,0x62,0x13,0xAD,0x9D,0x5C,0x00,0x08,0x00,0x90,0x00,0x04,0x58,0x00,0x04,0x08,0x01,0x80,0x91,0x94,0x50,0x94,
+    0xD6,0xC5,0xAA,0x62,0x58,0x00,0x02,0x04,0x00,0xC0,0xEB,0x6A,0x38,0xCE,0xFB,0xE6,0x69,0x52,0x54,0xB5,0xB1,0x9C,0x2E,0x00,0xCF,0x48,0x5A,0x48,0x52,0x48,0x52,0xAA,
+    0x5A,0x30,0x8C,0xDB,0xE6,0xBA,0x00,0x03,0x03,0x26,0x00,0xF0,0x04,0x5A,0x68,0x5A,0x48,0x5A,0x69,0x5A,0x54,0xB5,0xDF,0xFF,0x9E,0xF7,0xEB,0x62,0xF3,0xA4,0x50,0x94,
+    0x12,0x00,0x02,0x56,0x00,0xF2,0x01,0x48,0x52,0xCE,0x83,0x7D,0xFF,0x91,0x94,0xCA,0x5A,0xBA,0xDE,0x2C,0x73,0x48,0x52,0x16,0x00,0x00,0x3A,0x00,0x9D,0x68,0x5A,0xA9,
+    0x5A,0x70,0x94,0x58,0xD6,0xBE,0x15,0x01,0x00,0x1E,0x00,0x02,0x28,0x00,0x04,0x58,0x00,0x80,0xD6,0xBD,0x0B,0x6B,0x38,0xCE,0x8D,0x7B,0xEE,0x00,0x02,0x1A,0x00,0xD0,
+    0x68,0x5A,0x54,0xB5,0x3C,0xEF,0x6D,0x73,0xD2,0x9C,0xB6,0xBD,0x68,0xAA,0x00,0x01,0xD0,0x01,0x00,0xEA,0x00,0x00,0x04,0x00,0x8A,0x68,0x52,0x0B,0x6B,0x30,0x8C,0x3C,
+    0xEF,0x5B,0x00,0x01,0x1A,0x00,0x01,0x12,0x02,0x00,0xF4,0x01,0xB3,0x55,0xB5,0xDE,0xFF,0x6D,0x73,0x8D,0x7B,0x95,0xBD,0x89,0x14,0x00,0x00,0xB6,0x00,0xC4,0x89,0x5A,
+    0x5C,0xF7,0x75,0xB5,0xAA,0x62,0x9D,0xFF,0x8D,0x7B,0x88,0x00,0x00,0x08,0x00,0x00,0x1C,0x00,0x03,0x7A,0x00,0x85,0x52,0x2C,0x6B,0x17,0xCE,0xDE,0xFF,0xDF,0x5D,0x00,
+    0x02,0x20,0x00,0x02,0x06,0x00,0x90,0xCA,0x62,0xB6,0xBD,0xFB,0xE6,0xAA,0x5A,0xB6,0x0C,0x02,0x12,0x52,0x14,0x00,0x00,0x38,0x00,0xC2,0x30,0x8C,0x9D,0xFF,0x71,0x94,
+    0xEF,0x83,0xDA,0xE6,0x68,0x52,0x4C,0x00,0x00,0x1C,0x00,0x00,0x92,0x00,0x00,0x1E,0x00,0x02,0x04,0x00,0x66,0x68,0x52,0xCA,0x62,0xD6,0xBD,0x80,0x02,0x00,0x22,0x00,
+    0x04,0x04,0x00,0x60,0xAA,0x62,0xB6,0xBD,0x14,0xAD,0x46,0x01,0x20,0x0B,0x6B,0x14,0x00,0x01,0x3A,0x00,0xD0,0x52,0x69,0x5A,0xDA,0xE6,0xBA,0xDE,0x2C,0x6B,0x58,0xD6,
+    0x2F,0x8C,0x16,0x00,0x06,0x04,0x00,0x06,0x2A,0x01,0x00,0x5C,0x00,0x00,0x5A,0x00,0x24,0x38,0xCE,0xB1,0x00,0x00,0x12,0x00,0x00,0x04,0x00,0xE0,0x68,0x5A,0x68,0x52,
+    0xEA,0x62,0x96,0xBD,0xCE,0x83,0x92,0x9C,0xF7,0xCD,0x96,0x00,0x02,0x40,0x00,0xC2,0x48,0x52,0x6C,0x73,0xDE,0xFF,0x95,0xB5,0xAE,0x7B,0x99,0xDE,0x5C,0x01,0x02,0x18,
+    0x00,0x77,0x68,0x5A,0xEA,0x6A,0x0F,0x8C,0x89,0x6E,0x01,0x00,0x24,0x02,0x24,0x0B,0x6B,0x1E,0x02,0x00,0x2C,0x00,0x03,0x46,0x00,0x92,0x52,0xEB,0x6A,0x91,0x9C,0x0B,
+    0x6B,0xDA,0xE6,0xB4,0x01,0x03,0x40,0x00,0xB0,0x52,0xF6,0xC5,0xBD,0xFF,0x8E,0x7B,0xF3,0xA4,0x71,0x94,0x80,0x00,0x01,0xC4,0x00,0x00,0x3E,0x02,0x94,0x52,0xEA,0x6A,
+    0xD6,0xC5,0xBA,0xE6,0xAD,0x7B,0x20,0x02,0x00,0x1E,0x00,0x42,0x68,0x52,0xD2,0xA4,0x64,0x01,0x44,0x48,0x5A,0x89,0x62,0x02,0x03,0x82,0xEA,0x6A,0xAE,0x83,0x8D,0x7B,
+    0x1B,0xEF,0x86,0x00,0x00,0x58,0x00,0xE0,0x48,0x5A,0xCA,0x62,0xFA,0xE6,0xBA,0xDE,0x0B,0x6B,0xF7,0xC5,0x8D,0x7B,0x54,0x00,0x00,0x16,0x00,0x02,0x04,0x00,0xA0,0x89,
+    0x5A,0x68,0x52,0x14,0xAD,0xDA,0xE6,0x6D,0x7B,0x52,0x00,0x04,0x1C,0x00,0x22,0x4C,0x73,0x64,0x01,0x62,0x68,0x52,0x13,0xAD,0x0B,0x6B,0x1A,0x00,0x68,0xA9,0x62,0x2C,
+    0x73,0x54,0xB5,0xC0,0x03,0xD1,0x68,0x52,0xF2,0xA4,0x9D,0xF7,0x30,0x8C,0xCF,0x83,0x95,0xBD,0xCA,0x28,0x03,0x02,0x54,0x00,0xE2,0x48,0x5A,0xAE,0x83,0xB1,0x9C,0xAA,
+    0x5A,0xAA,0x62,0xFA,0xE6,0x91,0x9C,0x54,0x00,0x02,0x44,0x00,0x31,0x4C,0x73,0x9E,0x63,0x01,0x60,0x69,0x52,0x5C,0xF7,0xEB,0x6A,0x0A,0x01,0x00,0x18,0x00,0x44,0xCA,
+    0x62,0x17,0xCE,0x66,0x00,0x00,0x14,0x00,0xA5,0xAA,0x62,0xD6,0xC5,0x5C,0xEF,0x8A,0x5A,0x34,0xAD,0x68,0x03,0x01,0x8A,0x04,0x00,0xF2,0x03,0x91,0x7D,0xF7,0x2C,0x73,
+    0x89,0x5A,0xD6,0xBD,0xD2,0x82,0x03,0x00,0x70,0x00,0x00,0x42,0x00,0x13,0x2C,0x58,0x00,0x44,0xCA,0x62,0x7C,0xF7,0xB8,0x04,0x62,0x48,0x5A,0x0F,0x8C,0xB6,0xBD,0x0E,
+    0x00,0x00,0x24,0x00,0x20,0x48,0x5A,0x6E,0x04,0x60,0xD2,0x9C,0xCB,0x62,0x38,0xCE,0x22,0x02,0x05,0x98,0x00,0xF5,0x00,0x52,0x0B,0x6B,0x3C,0xEF,0xDE,0xFF,0xAD,0x7B,
+    0x89,0x5A,0x38,0xCE,0x50,0x94,0x18,0x00,0x52,0x5A,0x68,0x5A,0x4C,0x73,0x7C,0x03,0x26,0x0B,0x6B,0x58,0x00,0x73,0x68,0x5A,0xF3,0xAC,0x0F,0x8C,0x68,0xA8,0x03,0x00,
+    0x2E,0x00,0xA2,0x91,0x9C,0xBD,0xFF,0x4C,0x6B,0x51,0x94,0xB6,0xC5,0x90,0x00,0x00,0x06,0x00,0x00,0x3A,0x02,0x40,0x30,0x8C,0xDE,0xFF,0x42,0x03,0x60,0xCA,0x62,0x1B,
+    0xEF,0xCE,0x83,0x84,0x00,0x00,0x1A,0x00,0xC0,0x48,0x5A,0x68,0x52,0x4C,0x73,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x00,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x8D,0x7B,0x68,
+    0x52,0x68,0x5A,0x68,0x5A,0x48,0x04,0x00,0xF0,0x00,0x52,0xCA,0x62,0x89,0x5A,0x69,0x5A,0x69,0x52,0xAE,0x83,0xF3,0xAC,0xAA,0x62,0x18,0x00,0x02,0x1A,0x00,0xE0,0x89,
+    0x5A,0x54,0xB5,0xB1,0x9C,0xEB,0x6A,0xB5,0xBD,0x68,0x5A,0x48,0x52,0x14,0x00,0x10,0x48,0x32,0x00,0xD0,0x52,0x54,0xB5,0xDE,0xFF,0xDE,0xFF,0x30,0x8C,0x4C,0x73,0x13,
+    0xAD,0x12,0x00,0x01,0x46,0x00,0xF4,0x00,0x5A,0x68,0x5A,0x89,0x5A,0x9D,0xFF,0xF7,0xC5,0x8D,0x7B,0xB1,0x9C,0x48,0x52,0x14,0x00,0x00,0x08,0x00,0x50,0x4C,0x73,0xD6,
+    0xC5,0x89,0x6A,0x00,0x30,0x5A,0x48,0x5A,0x80,0x00,0x42,0xBE,0xFF,0x4C,0x73,0x66,0x00,0x00,0x54,0x00,0xE7,0x68,0x5A,0xEA,0x6A,0x91,0x9C,0x54,0xB5,0x71,0x94,0xAA,
+    0x5A,0xD2,0xA4,0x1A,0x00,0xD2,0x52,0x68,0x52,0xEF,0x83,0x38,0xCE,0xCA,0x5A,0xF2,0xA4,0x8D,0x7B,0x2A,0x00,0x00,0x36,0x00,0xF0,0x01,0x48,0x5A,0x0B,0x6B,0x7D,0xF7,
+    0xDF,0xFF,0x99,0xD6,0x69,0x52,0x34,0xB5,0xEA,0x6A,0x6C,0x00,0x00,0x66,0x00,0x00,0x1C,0x00,0x90,0x75,0xB5,0xFB,0xE6,0xAE,0x7B,0x75,0xB5,0x89,0xA8,0x00,0x10,0x5A,
+    0x12,0x00,0xA2,0x48,0x5A,0x88,0x5A,0x89,0x5A,0x33,0xB5,0x50,0x94,0x28,0x00,0x00,0x80,0x00,0x42,0xDA,0xDE,0x2C,0x6B,0x00,0x01,0x02,0x56,0x00,0xF2,0x01,0x6D,0x7B,
+    0xDA,0xE6,0xDE,0xFF,0x9D,0xF7,0xF3,0xA4,0x2C,0x6B,0x95,0xBD,0x69,0x52,0x1C,0x00,0xB1,0x48,0x52,0x68,0x52,0xCE,0x83,0x1B,0xE7,0x50,0x8C,0x6D,0xE8,0x00,0x00,0x4E,
+    0x00,0x00,0x30,0x00,0x60,0x48,0x5A,0x69,0x5A,0xB6,0xBD,0x46,0x01,0x63,0x0C,0x6B,0xCE,0x83,0x4F,0x94,0x2E,0x00,0xF0,0x00,0x5A,0x48,0x5A,0x48,0x52,0xEB,0x6A,0xBE,
+    0xFF,0x92,0x9C,0x50,0x94,0xCE,0x83,0x18,0x01,0x00,0x32,0x00,0xC0,0x48,0x5A,0x89,0x5A,0x89,0x5A,0xAA,0x62,0x58,0xD6,0xCA,0x62,0x14,0x00,0x00,0x80,0x00,0x42,0x75,
+    0xB5,0x6D,0x73,0x36,0x00,0x00,0x50,0x00,0x00,0x26,0x00,0xE0,0xD6,0xC5,0xDF,0xFF,0xFF,0xFF,0xFB,0xE6,0x8D,0x7B,0xD6,0xC5,0xCA,0x62,0x7A,0x00,0x60,0x68,0x52,0x2B,
+    0x73,0x79,0xD6,0x68,0x01,0x80,0x5C,0xEF,0xCB,0x62,0x50,0x94,0x4C,0x73,0x3E,0x00,0x04,0x04,0x00,0xC4,0xCF,0x83,0xBE,0xFF,0xFF,0xFF,0x58,0xD6,0x0B,0x6B,0xD1,0xA4,
+    0x5A,0x01,0x00,0x1C,0x00,0xA0,0x89,0x5A,0x18,0xCE,0xF7,0xC5,0xCB,0x62,0xFB,0xEE,0x0E,0x00,0x02,0x04,0x00,0x82,0x68,0x5A,0x50,0x9C,0xAA,0x62,0x50,0x94,0xAC,0x01,
+    0x00,0x80,0x00,0x40,0x54,0xAD,0x54,0xB5,0xD2,0x01,0x02,0x36,0x01,0x00,0xB8,0x00,0xF0,0x0B,0x8D,0x7B,0x9D,0xF7,0xFF,0xFF,0xDF,0xFF,0x13,0xA5,0xCB,0x62,0x79,0xDE,
+    0x0B,0x6B,0xCE,0x83,0x95,0xBD,0x58,0xD6,0xF2,0xA4,0xBA,0xDE,0x30,0x00,0x64,0x2F,0x8C,0x0F,0x8C,0x0F,0x8C,0xAC,0x00,0x00,0x56,0x00,0xB5,0x0B,0x6B,0x58,0xCE,0xDE,
+    0xFF,0xBE,0xFF,0x4C,0x6B,0x70,0x9A,0x00,0x00,0xC8,0x00,0xB7,0x68,0x5A,0x70,0x94,0x1C,0xEF,0x6D,0x73,0x75,0xBD,0x2B,0xB0,0x00,0xB1,0x6C,0x7B,0xCE,0x83,0xCA,0x62,
+    0x54,0xB5,0x0B,0x6B,0x68,0x00,0x02,0x60,0x95,0xB5,0x13,0xAD,0x4C,0x73,0x90,0x01,0x00,0x34,0x00,0x00,0x50,0x00,0xF0,0x0B,0x48,0x52,0xB6,0xBD,0xDE,0xFF,0xDF,0xFF,
+    0xFB,0xE6,0x0B,0x6B,0xD2,0xA4,0xB6,0xBD,0x34,0xAD,0xEF,0x83,0x69,0x52,0x0B,0x63,0x17,0xC6,0x80,0x00,0x77,0x99,0xD6,0x0B,0x6B,0xF2,0xA4,0xA9,0x9A,0x02,0xE0,0x68,
+    0x5A,0xF3,0xA4,0xBE,0xFF,0xDE,0xFF,0x54,0xAD,0x0F,0x8C,0xEF,0x8B,0x9A,0x00,0x00,0xCC,0x00,0x00,0x4A,0x00,0x81,0x6D,0x7B,0xFA,0xE6,0xB2,0x9C,0xEB,0x62,0xE2,0x00,
+    0x00,0x94,0x01,0xD2,0x5A,0x68,0x52,0x89,0x5A,0xF6,0xC5,0xEA,0x62,0x50,0x94,0x70,0x9C,0x80,0x00,0x77,0xDA,0xDE,0xAE,0x7B,0x17,0xCE,0x68,0xA4,0x02,0x50,0x48,0x52,
+    0xEB,0x62,0x9D,0x6B,0x00,0xF0,0x02,0xFF,0x13,0xAD,0x89,0x5A,0x8D,0x7B,0x89,0x5A,0xCA,0x62,0x75,0xB5,0x99,0xD6,0x9E,0xF7,0x15,0x00,0x80,0x7D,0xEF,0x50,0x94,0x91,
+    0x9C,0xAD,0x7B,0xAE,0x00,0x02,0x6C,0x00,0xF1,0x00,0x48,0x52,0x4C,0x73,0xDB,0xE6,0xDF,0xFF,0xBA,0xDE,0x4D,0x73,0x34,0xAD,0xAA,0xDA,0x01,0x00,0x1E,0x00,0xD0,0x48,
+    0x5A,0xA9,0x5A,0xD6,0xC5,0xDB,0xE6,0x69,0x52,0x54,0xB5,0xA9,0x16,0x00,0x00,0x66,0x03,0xD0,0x52,0x68,0x52,0xF2,0xA4,0x33,0xAD,0xEA,0x62,0x33,0xAD,0x0B,0x6B,0x50,
+    0x00,0x80,0x9E,0xF7,0x6D,0x73,0xD2,0xA4,0xEE,0x83,0xB4,0x00,0x02,0x36,0x00,0x00,0x3C,0x03,0x20,0x92,0x9C,0x1C,0x00,0x80,0x9D,0xF7,0x89,0x52,0x89,0x5A,0x34,0xAD,
+    0xE2,0x02,0x00,0x14,0x02,0x00,0x14,0x00,0x86,0xDF,0xFF,0x95,0xB5,0xEB,0x62,0xB5,0xBD,0x34,0x02,0x00,0x22,0x02,0x80,0x79,0xD6,0xDF,0xFF,0x7D,0xF7,0x71,0x94,0x56,
+    0x00,0x00,0x9E,0x03,0x00,0x4A,0x00,0x00,0xD6,0x01,0x80,0x50,0x94,0x5D,0xF7,0x2C,0x6B,0x8D,0x7B,0xEE,0x00,0x02,0x62,0x00,0xC2,0x48,0x52,0x0B,0x6B,0x5C,0xEF,0x2B,
+    0x6B,0x13,0xAD,0x0F,0x8C,0x50,0x00,0x84,0xD3,0x9C,0xA9,0x5A,0x95,0xBD,0x89,0x62,0x84,0x01,0x00,0xD6,0x00,0x80,0x0B,0x6B,0x3C,0xEF,0xDF,0xFF,0xDF,0xFF,0xDA,0x01,
+    0x04,0x7A,0x00,0x00,0x2E,0x00,0x00,0x04,0x00,0x73,0x5D,0xEF,0xCE,0x7B,0x13,0xAD,0x8C,0x36,0x04,0x01,0x6A,0x00,0xF6,0x00,0x52,0x4C,0x73,0xBE,0xFF,0xDF,0xFF,0xD6,
+    0xBD,0x2B,0x6B,0x95,0xBD,0x48,0x52,0x82,0x00,0xB1,0x2B,0x6B,0xDA,0xE6,0xF7,0xC5,0x6C,0x73,0xB2,0xA4,0x69,0x86,0x03,0x01,0x84,0x00,0x90,0x52,0x78,0xD6,0x95,0xB5,
+    0x89,0x5A,0x17,0xCE,0x4E,0x00,0x60,0xFF,0xFF,0x7D,0xF7,0x0C,0x6B,0xBA,0x01,0x11,0x69,0xA4,0x03,0x00,0x50,0x00,0x60,0x48,0x52,0x89,0x5A,0xD3,0xA4,0xD6,0x02,0x00,
+    0x88,0x02,0x02,0x26,0x00,0x06,0x06,0x00,0x40,0xDF,0xFF,0x34,0xAD,0x9C,0x03,0x00,0xEC,0x02,0x01,0x2E,0x00,0xD0,0x5A,0x68,0x5A,0x69,0x52,0xBA,0xDE,0xDE,0xFF,0x1B,
+    0xE7,0xAD,0x7B,0xDE,0x01,0x01,0x66,0x00,0x00,0x64,0x04,0xD0,0x52,0x68,0x52,0xB6,0xBD,0xBE,0xFF,0x2C,0x6B,0x30,0x94,0x0B,0x6B,0x12,0x02,0x00,0x30,0x00,0xA4,0x68,
+    0x5A,0x71,0x94,0xDA,0xE6,0x8D,0x7B,0x71,0x94,0x54,0x00,0x60,0xD6,0xBD,0x0B,0x6B,0xB2,0xA4,0x92,0x02,0x00,0x20,0x00,0x00,0x28,0x00,0x51,0x48,0x5A,0x6D,0x73,0xDA,
+    0xF0,0x02,0x04,0x24,0x00,0x08,0x08,0x00,0x73,0x3C,0xEF,0x0B,0x63,0xF2,0xA4,0x6D,0x04,0x02,0x00,0x30,0x01,0x40,0x48,0x5A,0xCE,0x83,0xA0,0x03,0x64,0xB2,0x9C,0x2C,
+    0x6B,0x74,0xB5,0x80,0x00,0xE0,0x68,0x5A,0x68,0x52,0xAD,0x7B,0xDE,0xFF,0x13,0xA5,0x50,0x94,0xAD,0x83,0x5C,0x00,0x02,0x04,0x00,0x71,0xEB,0x6A,0x5C,0xF7,0x34,0xAD,
+    0xCA,0x00,0x03,0x00,0x58,0x00,0x53,0x9D,0xF7,0xCE,0x83,0xD2,0xD8,0x04,0x02,0x7E,0x00,0x00,0x2A,0x04,0x2F,0x74,0xB5,0x81,0x00,0x05,0x73,0xDE,0xFF,0xF3,0xA4,0xEB,
+    0x62,0x34,0xB8,0x03,0x00,0x32,0x00,0x00,0x6A,0x00,0xA2,0xDA,0xE6,0xFE,0xFF,0xFB,0xE6,0xAA,0x5A,0xB5,0xBD,0xB8,0x05,0x01,0x86,0x00,0x70,0x52,0x69,0x52,0x3B,0xEF,
+    0x79,0xD6,0x9C,0x03,0x13,0x88,0x60,0x01,0x00,0x98,0x02,0x60,0x17,0xCE,0x7D,0xF7,0x4C,0x73,0x7C,0x00,0x00,0x04,0x00,0x40,0xDE,0xFF,0x38,0xCE,0x54,0x02,0x10,0x89,
+    0xA6,0x02,0x01,0x28,0x03,0x00,0x08,0x04,0x40,0x4C,0x73,0x3C,0xEF,0x1E,0x00,0x0F,0x04,0x00,0x01,0x71,0x7D,0xF7,0xCA,0x62,0x71,0x9C,0x2B,0xB8,0x03,0x04,0x80,0x00,
+    0x20,0x91,0x94,0xB0,0x00,0x53,0x4C,0x73,0x4C,0x73,0x91,0xF4,0x05,0x00,0x82,0x02,0x80,0x68,0x52,0x54,0xB5,0x3B,0xEF,0xEE,0x83,0x04,0x03,0x02,0xFE,0x00,0x00,0x16,
+    0x00,0x20,0x0F,0x8C,0xB0,0x03,0x04,0x5A,0x00,0xA2,0xDF,0xFF,0x5C,0xEF,0x0F,0x8C,0x91,0x9C,0x30,0x94,0x4C,0x01,0x00,0xBA,0x00,0x5F,0x48,0x5A,0x68,0x52,0x75,0x02,
+    0x01,0x04,0x00,0x6A,0x01,0x60,0xD2,0xA4,0xCE,0x83,0x50,0x94,0x7C,0x00,0x04,0x04,0x00,0xC4,0x2C,0x73,0x1C,0xEF,0xFF,0xFF,0x79,0xD6,0xEB,0x62,0xD2,0xA4,0xCA,0x00,
+    0x00,0x72,0x00,0x00,0x88,0x05,0x62,0x34,0xAD,0x30,0x8C,0xEE,0x8B,0x2A,0x00,0x00,0x2C,0x01,0x42,0x8D,0x7B,0x1B,0xEF,0x60,0x02,0x04,0x84,0x00,0x60,0x17,0xC6,0x0B,
+    0x6B,0xD6,0xC5,0x26,0x02,0x00,0x34,0x00,0x02,0x88,0x00,0x13,0xEA,0x08,0x04,0x04,0x24,0x00,0x00,0x08,0x00,0xF0,0x01,0xDE,0xFF,0xBE,0xF7,0x58,0xCE,0x13,0xA5,0xFB,
+    0xE6,0x4C,0x6B,0xD2,0xA4,0xEA,0x6A,0x2E,0x00,0x02,0x58,0x00,0x20,0xA9,0x62,0xB0,0x00,0x62,0xDE,0xFF,0x6D,0x73,0x0F,0x8C,0xA4,0x06,0x00,0xC8,0x00,0xC2,0x68,0x52,
+    0x68,0x52,0xDE,0xFF,0x58,0xCE,0x6C,0x73,0xD6,0xC5,0x56,0x00,0x00,0x06,0x00,0x40,0xAA,0x62,0xD7,0xC5,0x4E,0x00,0x06,0x04,0x00,0x4B,0xBE,0xFF,0xAE,0x7B,0x3C,0x02,
+    0x41,0x5A,0x48,0x52,0x71,0x54,0x01,0x06,0x26,0x00,0xF0,0x03,0xFF,0xFF,0x99,0xD6,0xEE,0x83,0xEA,0x62,0x69,0x52,0x17,0xC6,0xB2,0x9C,0xB1,0x9C,0x8D,0x7B,0xB6,0x03,
+    0x02,0x80,0x00,0x71,0x48,0x5A,0x0F,0x8C,0x5C,0xEF,0xDE,0x76,0x07,0x11,0x8D,0x74,0x06,0x01,0x80,0x00,0x10,0x5A,0x80,0x00,0x00,0x62,0x02,0x01,0x20,0x07,0x02,0x86,
+    0x03,0x70,0x52,0x48,0x52,0x34,0xAD,0xBE,0xFF,0x31,0x68,0x5A,0x48,0x02,0x00,0xA3,0x5C,0xF7,0x2C,0x6B,0x50,0x94,0x0B,0x6B,0x68,0x5A,0x12,0x00,0xB2,0x52,0xD3,0xA4,
+    0x9D,0xF7,0x50,0x8C,0x34,0xAD,0xCA,0x62,0x22,0x00,0x00,0x06,0x00,0xA0,0x71,0x9C,0x17,0xCE,0xAA,0x5A,0x74,0xB5,0xAD,0x7B,0x0E,0x00,0x00,0x04,0x00,0xA0,0xF3,0xA4,
+    0xBE,0xFF,0x34,0xAD,0x6D,0x7B,0x50,0x94,0x0E,0x00,0x00,0x3E,0x00,0xD3,0x68,0x52,0x54,0xB5,0x9D,0xF7,0x6D,0x73,0x91,0x9C,0xF3,0xAC,0x89,0x4E,0x00,0x02,0x54,0x00,
+    0x00,0x06,0x00,0x00,0x22,0x00,0x01,0x2A,0x00,0x70,0x52,0x70,0x94,0xBE,0xFF,0xFF,0xFF,0x0C,0x00,0x00,0x04,0x00,0x75,0x79,0xDE,0x71,0x94,0x30,0x8C,0x8D,0x58,0x00,
+    0xC0,0x48,0x52,0x0B,0x6B,0xDE,0xFF,0x34,0xAD,0x0F,0x8C,0xEF,0x8B,0x38,0x00,0x11,0x48,0x4A,0x00,0xB1,0xEF,0x8B,0xFB,0xE6,0x6D,0x73,0x8D,0x7B,0x34,0xB5,0x69,0xB6,
+    0x00,0xC6,0x48,0x52,0xD2,0xA4,0xBE,0xFF,0x99,0xDE,0x2C,0x73,0xB1,0xA4,0x26,0x00,0xC4,0xAE,0x7B,0xDE,0xFF,0x54,0xB5,0xEA,0x62,0x17,0xCE,0x50,0x94,0x16,0x00,0x00,
+    0x08,0x00,0x04,0x7C,0x00,0x00,0x70,0x00,0x84,0x2B,0x6B,0xFA,0xDE,0xFF,0xFF,0xFF,0xFF,0x14,0x00,0x84,0xD2,0xA4,0xF6,0xC5,0xCE,0x83,0xEE,0x8B,0x10,0x00,0xC0,0x48,
+    0x52,0xAA,0x5A,0x7D,0xF7,0x38,0xCE,0x0B,0x6B,0x58,0xD6,0x30,0x00,0x02,0x80,0x00,0xC2,0xEB,0x6A,0x79,0xD6,0x75,0xB5,0xAA,0x5A,0x33,0xAD,0x0B,0x6B,0x16,0x00,0x00,
+    0x80,0x00,0x82,0x7D,0xF7,0xEB,0x6A,0x70,0x94,0xA9,0x62,0x24,0x00,0x50,0x48,0x5A,0xAA,0x62,0xDE,0x94,0x00,0x90,0x6B,0x4C,0x73,0x3B,0xEF,0xB1,0x9C,0x68,0x52,0x2A,
+    0x00,0x00,0x58,0x00,0x05,0x84,0x00,0x51,0x52,0x2C,0x6B,0x54,0xAD,0x7F,0x00,0x05,0x00,0x01,0x92,0xEF,0x83,0xDA,0xE6,0x6D,0x73,0x70,0x94,0x89,0xD8,0x00,0xF2,0x02,
+    0x5A,0x48,0x5A,0x89,0x5A,0x54,0xB5,0x1B,0xE7,0x4C,0x6B,0x99,0xDE,0x68,0x5A,0x48,0x52,0x5C,0x00,0xE0,0x89,0x5A,0x17,0xCE,0xBE,0xFF,0xAA,0x5A,0x50,0x94,0x70,0x9C,
+    0x48,0x52,0x18,0x00,0xC0,0xD2,0x9C,0xBE,0xFF,0xDE,0xFF,0x6C,0x73,0x30,0x8C,0xEA,0x6A,0x60,0x00,0x00,0x6C,0x00,0xF0,0x06,0x49,0x52,0xDE,0xFF,0xBE,0xFF,0xB2,0x9C,
+    0x69,0x52,0x0B,0x6B,0x7D,0xF7,0x54,0xB5,0xA9,0x62,0x48,0x52,0x68,0x02,0x00,0xD0,0x5A,0x68,0x52,0x68,0x5A,0x89,0x5A,0x70,0x94,0x0F,0x84,0xBD,0xF7,0xFE,0x00,0x02,
+    0x80,0x01,0x00,0x38,0x00,0xA0,0x2C,0x6B,0x5C,0xF7,0x0F,0x8C,0x95,0xBD,0xCA,0x62,0x6C,0x00,0x00,0x46,0x00,0xC2,0x68,0x5A,0x50,0x94,0xDE,0xFF,0xEF,0x83,0xB1,0x9C,
+    0x4C,0x73,0x7E,0x00,0xF0,0x01,0x48,0x5A,0x68,0x52,0x75,0xB5,0xDE,0xFF,0xB2,0x9C,0x8D,0x7B,0xD2,0xA4,0xA9,0x62,0x80,0x00,0xB3,0x91,0x94,0x9D,0xF7,0xDE,0xFF,0x91,
+    0x94,0x0F,0x8C,0x6C,0xBC,0x01,0x00,0x6A,0x00,0xF2,0x13,0x7D,0xF7,0xFF,0xFF,0x1B,0xE7,0xCE,0x83,0x68,0x52,0x2C,0x6B,0x17,0xCE,0x78,0xDE,0x54,0xB5,0x70,0x94,0x2F,
+    0x8C,0x30,0x8C,0x70,0x94,0x13,0xAD,0xB5,0xBD,0x0F,0x8C,0x58,0xCE,0x7E,0x00,0x00,0x80,0x00,0x00,0x1A,0x01,0xC0,0x48,0x5A,0xAA,0x5A,0xBE,0xFF,0x54,0xAD,0x71,0x94,
+    0x4C,0x73,0x80,0x00,0x00,0x92,0x00,0xC0,0x68,0x52,0xCE,0x83,0x5D,0xF7,0x34,0xAD,0xA9,0x5A,0x54,0xB5,0xB8,0x00,0x02,0x28,0x00,0xC0,0xEF,0x83,0x7D,0xF7,0xDA,0xE6,
+    0xCB,0x62,0x34,0xAD,0x4C,0x73,0x6A,0x00,0xC0,0x2F,0x8C,0x5C,0xEF,0xFF,0xFF,0x75,0xB5,0x30,0x8C,0xCE,0x83,0xE6,0x00,0x71,0x69,0x5A,0x0B,0x6B,0xEF,0x83,0xBA,0x5D,
+    0x01,0xF3,0x0C,0xDA,0xDE,0x0F,0x8C,0x68,0x52,0xAA,0x5A,0xAE,0x7B,0xF3,0xA4,0x74,0xB5,0x74,0xB5,0x34,0xAD,0x91,0x94,0x8D,0x73,0x8D,0x73,0xF6,0xBD,0xBE,0xFE,0x00,
+    0x06,0x00,0x02,0x60,0x68,0x52,0x9D,0xFF,0x17,0xC6,0xAE,0x00,0x00,0xB0,0x01,0x00,0x6C,0x00,0x20,0x68,0x52,0xFC,0x01,0x71,0xDA,0xE6,0x69,0x52,0xF7,0xC5,0x69,0x80,
+    0x01,0x00,0x96,0x00,0xC0,0x0B,0x6B,0x5C,0xF7,0x7D,0xF7,0xEF,0x83,0x51,0x94,0x50,0x94,0x70,0x00,0xF4,0x07,0xCE,0x83,0x3C,0xEF,0xFF,0xFF,0x58,0xCE,0xEF,0x83,0x54,
+    0xAD,0x74,0xB5,0xB6,0xBD,0x17,0xCE,0x9A,0xDE,0x3C,0xEF,0x60,0x00,0xF1,0x07,0x5C,0xEF,0x95,0xB5,0x8D,0x73,0x68,0x52,0x48,0x52,0x69,0x52,0x89,0x52,0x69,0x52,0xEB,
+    0x62,0x75,0xB5,0xBA,0xDE,0x9D,0x00,0x03,0x01,0x01,0x00,0x6A,0x01,0x00,0x04,0x00,0xA0,0x68,0x52,0x99,0xDE,0x1B,0xEF,0x8D,0x7B,0xFA,0xE6,0x2E,0x00,0x01,0x12,0x00,
+    0xD1,0x5A,0x89,0x5A,0x95,0xBD,0xBE,0xFF,0xCA,0x5A,0x51,0x94,0xEB,0x62,0x92,0x00,0x00,0x1C,0x02,0xB0,0x52,0x3B,0xEF,0xDE,0xFF,0xF7,0xC5,0xCA,0x5A,0x38,0xCE,0x56,
+    0x00,0xF2,0x07,0x8D,0x73,0xFB,0xE6,0xDE,0xFF,0xDA,0xDE,0xCE,0x7B,0x17,0xCE,0xEF,0x83,0xEB,0x62,0xCA,0x5A,0x4C,0x6B,0x3C,0xE7,0x5D,0x00,0xF0,0x03,0xDF,0xFF,0xFF,
+    0xFF,0xDE,0xFF,0x9D,0xF7,0x7D,0xF7,0x1C,0xEF,0x3C,0xEF,0x5C,0xEF,0x7D,0xF7,0xAC,0x01,0x02,0x1C,0x00,0x04,0x06,0x00,0x00,0x1C,0x02,0x00,0x6E,0x00,0xC0,0x69,0x5A,
+    0x95,0xB5,0xDE,0xFF,0x71,0x94,0x50,0x94,0x8D,0x7B,0x02,0x01,0x00,0x14,0x00,0x80,0x48,0x52,0xB1,0x9C,0x9D,0xFF,0xEF,0x83,0x1A,0x04,0x00,0x96,0x01,0x00,0x00,0x02,
+    0xF4,0x15,0x69,0x52,0x74,0xB5,0xFF,0xFF,0xDA,0xDE,0x4C,0x73,0x74,0xB5,0xDA,0xE6,0x1B,0xE7,0xDE,0xFF,0xDF,0xFF,0xDF,0xFF,0x1C,0xE7,0xAE,0x7B,0x89,0x52,0xAA,0x5A,
+    0x0B,0x6B,0x6D,0x73,0xCF,0x7B,0x80,0x00,0x04,0x64,0x00,0x0F,0x08,0x00,0x09,0x23,0x13,0xAD,0x6E,0x00,0xD1,0x52,0xF2,0xA4,0xDE,0xFF,0x75,0xB5,0x89,0x5A,0xD6,0xC5,
+    0x48,0x52,0xDC,0x02,0xF0,0x08,0x5A,0x68,0x52,0xAD,0x7B,0x3C,0xEF,0x58,0xCE,0x6D,0x73,0xD2,0xA4,0x69,0x5A,0xCA,0x62,0x2C,0x73,0x0F,0x8C,0xD2,0xA4,0x3C,0x02,0xA0,
+    0xDF,0xFF,0xB2,0x9C,0xEB,0x62,0xCE,0x7B,0xEF,0x83,0x4C,0x01,0xA0,0xDF,0xFF,0x9E,0xF7,0xD6,0xBD,0x34,0xAD,0xB6,0xBD,0x0C,0x01,0x0F,0x6E,0x00,0x09,0x0E,0x1C,0x00,
+    0x32,0x37,0xCE,0x2B,0xCA,0x03,0xD0,0x52,0x50,0x94,0xDF,0xFF,0x5C,0xEF,0xCA,0x62,0xB5,0xBD,0x89,0x5A,0x80,0x00,0xF0,0x09,0x68,0x5A,0x68,0x52,0xCA,0x62,0xBA,0xDE,
+    0xBE,0xFF,0x0B,0x6B,0xD2,0xA4,0x75,0xBD,0xF7,0xC5,0x75,0xB5,0x34,0xAD,0xDA,0xE6,0x72,0x00,0xA0,0xFF,0xFF,0x38,0xCE,0x8D,0x73,0x0F,0x84,0x95,0xB5,0x64,0x01,0x0E,
+    0x56,0x00,0x0F,0x12,0x00,0x17,0x30,0x8D,0x7B,0x74,0xCC,0x04,0x50,0x52,0x48,0x52,0xAD,0x7B,0x4C,0x01,0x40,0x2B,0x6B,0xAD,0x7B,0xCA,0x02,0x00,0x5C,0x02,0x40,0x69,
+    0x5A,0x6C,0x73,0x2E,0x02,0xE2,0x4D,0x73,0xAE,0x7B,0xEF,0x83,0xEB,0x6A,0xCA,0x62,0x8A,0x5A,0xF7,0xC5,0x72,0x00,0x62,0xDF,0xFF,0x7D,0xF7,0x9E,0xF7,0x8C,0x00,0x0F,
+    0x6E,0x00,0x17,0x0E,0x2A,0x00,0x31,0x89,0x52,0x33,0x4A,0x03,0x40,0x48,0x5A,0x4C,0x73,0xB6,0x03,0xE0,0x54,0xAD,0x2B,0x6B,0x33,0xAD,0xEA,0x62,0x8D,0x7B,0x95,0xBD,
+    0x1B,0xEF,0xA2,0x05,0x40,0xFF,0xFF,0x96,0xBD,0x7E,0x01,0x8E,0xEB,0x62,0x8D,0x73,0x96,0xB5,0x7D,0xEF,0x44,0x00,0x0F,0x12,0x00,0x29,0x60,0x2C,0x6B,0xCE,0x83,0xB2,
+    0xA4,0x72,0x01,0x40,0x0B,0x6B,0xDA,0xDE,0xB0,0x02,0xE0,0xEA,0x62,0x95,0xBD,0xF6,0xC5,0x95,0xBD,0x50,0x94,0x6D,0x73,0x38,0xC6,0x5C,0x00,0x60,0x1B,0xE7,0x14,0xA5,
+    0x79,0xD6,0x1E,0x01,0x00,0x6C,0x02,0x00,0x12,0x00,0x0F,0x04,0x00,0x37,0xC0,0x17,0xCE,0xEB,0x62,0x13,0xAD,0x4C,0x73,0x6D,0x73,0xF3,0xA4,0xCA,0x03,0xE0,0xFF,0xFF,
+    0x6D,0x73,0x0B,0x6B,0xCA,0x62,0x69,0x52,0x6D,0x73,0xB2,0x94,0x92,0x00,0x0F,0x6C,0x00,0x37,0x0F,0x4A,0x00,0x01,0xC2,0x9E,0xFF,0xCE,0x83,0x30,0x8C,0x99,0xDE,0xBA,
+    0xDE,0x9E,0xFF,0xDA,0x01,0xC2,0xD6,0xBD,0x4C,0x73,0x54,0xB5,0x99,0xDE,0x3C,0xEF,0x9D,0xF7,0x12,0x00,0x0F,0x38,0x00,0x01,0x0F,0x14,0x00,0x30,0x50,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0x93,0x9D,0xF7,0x0B,0x6B,0x70,0x94,0x89,0x5A,0x48,0x02,0x00,0x40,0xEF,0x83,0xDF,0xFF,0x01,0x00,0xF0,0x05,0x99,0xDE,0x89,0x5A,0x0F,0x8C,0xD2,0xA4,0x68,
+    0x5A,0x68,0x52,0x48,0x5A,0x68,0x52,0x68,0x52,0x30,0x8C,0x18,0x00,0x0E,0x04,0x00,0xF3,0x00,0x1C,0xE7,0xCA,0x62,0xEB,0x62,0x99,0xDE,0x74,0xB5,0xAA,0x62,0x48,0x52,
+    0x68,0x48,0x00,0x02,0x50,0x00,0x20,0x2B,0x73,0x5A,0x00,0x00,0x14,0x00,0x60,0x8D,0x7B,0xDA,0xDE,0x6D,0x73,0x56,0x00,0x00,0x50,0x00,0x02,0x1E,0x00,0xA0,0x30,0x8C,
+    0x7D,0xF7,0xDE,0xFF,0x0B,0x63,0x50,0x94,0x3A,0x00,0x11,0x48,0x68,0x00,0x22,0x6D,0x73,0x80,0x00,0xA0,0xDE,0xFF,0x2B,0x6B,0x6D,0x73,0x75,0xBD,0x4C,0x73,0x02,0x00,
+    0x6E,0x6D,0x7B,0xAE,0x7B,0x13,0xA5,0x7C,0x00,0x20,0xFF,0xFF,0x2E,0x00,0xD4,0xD2,0xA4,0x69,0x52,0xCE,0x7B,0x99,0xDE,0x95,0xBD,0x6C,0x73,0x68,0x82,0x00,0x90,0x52,
+    0x89,0x5A,0xAA,0x62,0x37,0xD6,0xAD,0x83,0x70,0x00,0xC0,0x68,0x5A,0x30,0x8C,0x99,0xD6,0x0C,0x6B,0x79,0xD6,0x48,0x52,0x10,0x00,0x01,0x6C,0x00,0xD0,0x5A,0x71,0x94,
+    0xBE,0xFF,0xDE,0xFF,0x6D,0x73,0x91,0x9C,0xEF,0x83,0xEC,0x00,0x73,0x75,0xB5,0x37,0xCE,0xBA,0xDE,0xDE,0x67,0x00,0xF3,0x03,0x54,0xAD,0xCA,0x62,0x54,0xB5,0x99,0xDE,
+    0x58,0xD6,0x17,0xCE,0x38,0xCE,0xFB,0xE6,0x5D,0xEF,0x19,0x00,0x0D,0x07,0x00,0xF0,0x1E,0x7D,0xF7,0x8D,0x7B,0x69,0x52,0x2C,0x73,0x17,0xCE,0xFB,0xE6,0x58,0xD6,0x74,
+    0xB5,0x50,0x94,0x0F,0x8C,0xF3,0xAC,0xEE,0x83,0x89,0x5A,0x17,0xCE,0x78,0xD6,0x50,0x94,0xAE,0x7B,0x0B,0x6B,0x13,0xA5,0x58,0xCE,0xEB,0x62,0x38,0xCE,0x69,0x80,0x00,
+    0x12,0x52,0x80,0x00,0xF0,0x05,0xD2,0xA4,0xDE,0xFF,0xDF,0xFF,0xEF,0x83,0x34,0xAD,0xB9,0xDE,0x17,0xC6,0x54,0xB5,0x34,0xAD,0xDA,0xE6,0xD0,0x00,0x02,0x61,0x00,0x40,
+    0xDE,0xFF,0x69,0x52,0x02,0x00,0x82,0x68,0x52,0x69,0x52,0x0B,0x6B,0x99,0xD6,0x16,0x00,0x0F,0x06,0x00,0x01,0x40,0xDE,0xFF,0x3C,0xEF,0x82,0x00,0x00,0x2E,0x00,0xF0,
+    0x17,0x2F,0x8C,0x54,0xAD,0x74,0xB5,0x50,0x8C,0xAA,0x5A,0x71,0x94,0x4C,0x73,0x2C,0x6B,0x34,0xAD,0xF7,0xC5,0x5C,0xEF,0xDE,0xFF,0xBE,0xFF,0x38,0xCE,0x4D,0x73,0xFA,
+    0xE6,0xB9,0xDE,0x95,0xBD,0x91,0x9C,0x92,0x00,0xE0,0xCA,0x62,0x55,0xAD,0xDF,0xFF,0xDF,0xFF,0x71,0x94,0x69,0x52,0x89,0x5A,0xC4,0x01,0x48,0x6D,0x73,0x58,0xCE,0x60,
+    0x00,0xE8,0x71,0x94,0xEF,0x83,0x2F,0x8C,0x70,0x94,0x91,0x94,0x13,0xA5,0x3C,0xE7,0x1A,0x00,0x0E,0x0C,0x00,0xF0,0x0F,0x3C,0xEF,0xF3,0xA4,0x6C,0x73,0x2B,0x6B,0x0B,
+    0x63,0x0B,0x6B,0x4C,0x6B,0xCE,0x83,0x79,0xD6,0x9D,0xF7,0x50,0x8C,0x0B,0x63,0xEB,0x62,0xEB,0x62,0x37,0xC6,0xD6,0x00,0xF0,0x01,0x17,0xC6,0x8A,0x5A,0x2C,0x6B,0xCE,
+    0x83,0x71,0x94,0x13,0xAD,0xB5,0xBD,0xBE,0xFF,0x7C,0x00,0x00,0x48,0x00,0xDB,0x18,0xC6,0xF3,0xA4,0x75,0xB5,0xD6,0xC5,0x58,0xCE,0x99,0xD6,0x7D,0x64,0x01,0x50,0xDF,
+    0xFF,0xFE,0xFF,0xFE,0x25,0x00,0x00,0x04,0x00,0x20,0xF7,0xFF,0x02,0x00,0x26,0xEF,0xFF,0x02,0x00,0x00,0x10,0x00,0x00,0x04,0x00,0x00,0x1E,0x00,0xD0,0xFF,0xFF,0xFF,
+    0x7D,0xEF,0xBA,0xDE,0x79,0xD6,0x79,0xD6,0xFB,0xE6,0x58,0x01,0xA2,0xDF,0xFF,0x1B,0xE7,0x99,0xD6,0x58,0xCE,0x17,0xC6,0xBC,0x00,0xF3,0x00,0xBA,0xDE,0x71,0x94,0x30,
+    0x8C,0x0F,0x84,0xAD,0x7B,0xEB,0x62,0x89,0x52,0xBE,0x34,0x00,0x02,0x42,0x02,0x05,0x0D,0x00,0x0F,0x09,0x00,0x05,0xF0,0x00,0xF7,0xFF,0xEF,0xFF,0xE7,0xFE,0xDF,0x9B,
+    0xBF,0x15,0x8E,0x72,0x75,0x51,0x6D,0x02,0x00,0xCF,0x93,0x7D,0xF9,0xAE,0xFE,0xD7,0xFE,0xE7,0xFF,0xEF,0xFF,0xF7,0x37,0x00,0x05,0x08,0x18,0x00,0x82,0xDF,0xFF,0x9E,
+    0xF7,0x5D,0xF7,0x5C,0xEF,0x96,0x00,0x00,0x12,0x01,0x08,0x1E,0x00,0x0F,0x0C,0x00,0x06,0x00,0xE0,0x00,0xF0,0x03,0xEF,0xFE,0xDF,0xF5,0x95,0xAC,0x3B,0x8A,0x33,0x6A,
+    0x2B,0x69,0x23,0x49,0x1B,0x69,0x1B,0x89,0x04,0x00,0xCF,0x23,0x49,0x23,0x8A,0x2B,0x6A,0x33,0x11,0x6D,0xDD,0xD7,0xFF,0x86,0x00,0x12,0x04,0x72,0x01,0x02,0x6C,0x00,
+    0x0F,0x82,0x00,0x10,0xF3,0x00,0xF7,0xFF,0xF7,0xDD,0xDF,0x39,0xB7,0x31,0x65,0x69,0x23,0x48,0x1B,0x68,0x13,0x02,0x00,0x24,0x0B,0x68,0x02,0x00,0x01,0x12,0x00,0xBF,
+    0x48,0x13,0x49,0x1B,0xCB,0x33,0xB7,0x9E,0x9B,0xCF,0xFE,0x0A,0x01,0x14,0x02,0x80,0x00,0x0F,0x06,0x00,0x0E,0xA1,0xF7,0xFE,0xE7,0xB8,0xAE,0x10,0x65,0x49,0x23,0x48,
+    0x68,0x00,0x00,0x7E,0x00,0x71,0x69,0x1B,0xAA,0x23,0xCB,0x2B,0xEB,0x02,0x00,0x42,0xCA,0x23,0x69,0x1B,0x1A,0x00,0xCF,0x48,0x0B,0x69,0x13,0x49,0x1B,0x4D,0x4C,0xF5,
+    0x95,0xBD,0xD7,0x8E,0x01,0x15,0x0F,0x7E,0x00,0x0E,0x70,0xEF,0xFD,0xD7,0x72,0x75,0xEB,0x33,0x76,0x00,0x00,0x04,0x00,0xF4,0x0D,0x49,0x1B,0x0C,0x44,0x31,0x6D,0x36,
+    0x9E,0x98,0xAE,0xD8,0xB6,0xF9,0xB6,0xF9,0xB6,0xD9,0xB6,0xB8,0xAE,0x77,0x9E,0xD4,0x85,0x8E,0x54,0x6A,0x2B,0x1C,0x01,0x8F,0x69,0x1B,0xAF,0x54,0xD8,0xAE,0xFE,0xE7,
+    0x10,0x02,0x13,0x0F,0x82,0x00,0x0A,0x60,0xEF,0x9B,0xC7,0xEC,0x3B,0x69,0x74,0x01,0x30,0x0B,0x68,0x13,0x58,0x00,0x43,0x19,0xAF,0xDC,0xCF,0x6C,0x02,0x00,0x12,0x02,
+    0x02,0x04,0x00,0xA3,0xEF,0xFE,0xE7,0xFD,0xD7,0x9B,0xC7,0xF4,0x7D,0x69,0x24,0x01,0x6F,0x48,0x13,0xAB,0x33,0x36,0x96,0x82,0x00,0x2C,0xF5,0x04,0xF7,0xFE,0xEF,0x19,
+    0xB7,0xEB,0x3B,0x68,0x13,0x88,0x13,0x68,0x13,0x89,0x23,0xEC,0x43,0x5A,0xBF,0x7A,0x00,0x07,0xB5,0x00,0x01,0x40,0x02,0x03,0x88,0x00,0x63,0xDD,0xD7,0x72,0x7D,0x8A,
+    0x2B,0x8E,0x01,0x5F,0x1B,0x35,0x96,0xFE,0xDF,0x04,0x01,0x28,0xFF,0x02,0xEF,0x19,0xB7,0x2D,0x44,0x48,0x13,0x68,0x0B,0x68,0x13,0x0B,0x34,0x15,0x86,0xFE,0xDF,0xD4,
+    0x01,0x01,0x51,0x3C,0xF7,0xBB,0xEE,0x3D,0xFE,0x05,0x01,0x93,0x00,0x70,0xF7,0xFE,0xEF,0xD8,0xAE,0xCF,0x54,0x8A,0x01,0x6F,0x88,0x13,0x28,0x1B,0xF4,0x8D,0x04,0x01,
+    0x26,0x50,0xF7,0xBC,0xCF,0x4D,0x44,0xF2,0x01,0x6F,0x68,0x13,0x4D,0x4C,0xF9,0xB6,0x48,0x00,0x03,0x96,0xDF,0xFF,0x75,0xDD,0x4D,0x9B,0x31,0xB4,0x9E,0x82,0x00,0x80,
+    0xFF,0xFF,0xF7,0x9C,0xD7,0x93,0x7D,0x49,0xB4,0x01,0x3F,0x13,0x69,0x23,0x82,0x00,0x24,0xFB,0x01,0xF7,0xFE,0xE7,0x0D,0x4C,0x48,0x13,0x88,0x13,0x48,0x13,0x2C,0x44,
+    0x9B,0xCF,0xFF,0x10,0x05,0x01,0xEC,0x00,0x10,0xFF,0xB4,0x04,0xF0,0x0B,0x7A,0xFE,0xAB,0x92,0x09,0x82,0xBB,0xFE,0x9E,0xFF,0xBF,0xFF,0x9E,0xFF,0x5D,0xFF,0x1C,0xFF,
+    0x7D,0xFF,0xDE,0xFF,0xFE,0xE7,0xF4,0x85,0x82,0x00,0x6F,0x88,0x13,0xAA,0x33,0x76,0x9E,0x3E,0x00,0x05,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xA2,0xB6,0xBD,0xEB,0x62,0xF7,0xCD,0xAE,0x7B,0x48,0x5A,0x02,0x00,0xF0,0x15,0x68,0x5A,0x91,0x9C,0xBA,0xDE,0x0B,0x63,0xF7,0xC5,0x71,0x94,0x48,0x52,0x68,0x5A,
+    0x48,0x5A,0x68,0x5A,0x68,0x5A,0xCA,0x62,0x17,0xCE,0xBE,0xFF,0xEB,0x62,0x91,0x9C,0xEE,0x8B,0x48,0x52,0x14,0x00,0x00,0x04,0x00,0xC0,0x69,0x52,0x99,0xDE,0x13,0xAD,
+    0xD2,0xA4,0x70,0x94,0x68,0x52,0x26,0x00,0x01,0x04,0x00,0xD0,0x52,0xB2,0x9C,0xBE,0xFF,0xDE,0xFF,0x0B,0x6B,0xF3,0xAC,0xEF,0x8B,0x26,0x00,0x00,0x16,0x00,0xF1,0x00,
+    0x48,0x5A,0x68,0x52,0xB2,0x9C,0xDB,0xE6,0x2C,0x6B,0xB9,0xDE,0x0F,0x8C,0x68,0x42,0x00,0x00,0x18,0x00,0x91,0x68,0x52,0xDA,0xDE,0xEA,0x62,0xD6,0xC5,0xCF,0x56,0x00,
+    0x02,0x82,0x00,0xC4,0xEF,0x8B,0xBA,0xDE,0xEB,0x62,0x95,0xB5,0xF6,0xC5,0x68,0x52,0x6C,0x00,0xC0,0x48,0x5A,0x0F,0x8C,0x78,0xD6,0x89,0x5A,0x2F,0x94,0x89,0x62,0x96,
+    0x00,0x00,0x98,0x00,0xC2,0x48,0x5A,0x69,0x52,0x3C,0xEF,0xEF,0x8B,0x95,0xBD,0x6D,0x7B,0x14,0x00,0x00,0x16,0x00,0xE8,0x89,0x5A,0x54,0xAD,0xFF,0xFF,0xFB,0xE6,0x2C,
+    0x6B,0xB6,0xC5,0x4C,0x73,0x18,0x00,0x93,0x58,0xD6,0x75,0xB5,0xEB,0x62,0x5C,0xF7,0x89,0xEA,0x00,0x02,0x6E,0x00,0x80,0xBD,0xFF,0xCA,0x62,0x96,0xBD,0x0F,0x8C,0xAA,
+    0x00,0x00,0x12,0x00,0xB0,0x68,0x5A,0x4C,0x73,0xDA,0xE6,0x2C,0x6B,0x71,0x94,0x7C,0x2A,0x00,0x10,0x52,0x14,0x00,0x00,0x04,0x00,0x80,0x89,0x5A,0x0B,0x73,0x48,0x5A,
+    0x89,0x62,0xB6,0x00,0x00,0x10,0x00,0x00,0x04,0x00,0xA0,0xD2,0xA4,0x1B,0xEF,0x6C,0x73,0xF6,0xC5,0x0B,0x6B,0x16,0x00,0x00,0x04,0x00,0xE0,0x48,0x5A,0x0C,0x6B,0x9A,
+    0xDE,0xDF,0xFF,0xD3,0x9C,0x6D,0x73,0x95,0xBD,0x6A,0x00,0x00,0x16,0x00,0x00,0x98,0x00,0xA0,0xCA,0x62,0x5D,0xF7,0xD2,0xA4,0xB2,0x9C,0x17,0xCE,0xFE,0x00,0x00,0x3E,
+    0x00,0x00,0x16,0x00,0x91,0x68,0x5A,0xDE,0xFF,0x89,0x5A,0x54,0xB5,0x30,0x14,0x01,0xF0,0x03,0x48,0x5A,0x48,0x52,0x48,0x52,0xAA,0x62,0x5C,0xF7,0x30,0x8C,0xEB,0x62,
+    0x9D,0xF7,0x0F,0x8C,0x24,0x00,0x00,0x2C,0x00,0x06,0x04,0x00,0x00,0x50,0x00,0x01,0x0E,0x00,0xD6,0x52,0x68,0x52,0x3C,0xEF,0x99,0xD6,0x6D,0x73,0x37,0xCE,0x0B,0x6B,
+    0xE8,0x00,0x20,0xAE,0x7B,0x7E,0x01,0x60,0x0C,0x6B,0x30,0x8C,0x33,0xAD,0x28,0x00,0x03,0x42,0x00,0xB4,0x52,0x2F,0x8C,0xFB,0xE6,0x6D,0x7B,0x58,0xD6,0x0B,0x6B,0x80,
+    0x00,0x00,0xCE,0x00,0xF0,0x13,0x89,0x5A,0xDE,0xFF,0xA9,0x5A,0x34,0xAD,0x34,0xAD,0x6D,0x73,0x2C,0x73,0x0B,0x6B,0xCA,0x62,0x69,0x5A,0x89,0x5A,0xBE,0xFF,0x13,0xAD,
+    0x69,0x52,0x95,0xBD,0xDA,0xE6,0xEB,0x6A,0x44,0x00,0x02,0x04,0x00,0x02,0x4A,0x00,0x04,0x80,0x00,0x00,0x68,0x01,0x86,0xBE,0xFF,0x18,0xCE,0x8D,0x7B,0x78,0xD6,0x80,
+    0x00,0xE2,0x68,0x5A,0xAD,0x7B,0xDE,0xFF,0x1B,0xEF,0xAA,0x5A,0x17,0xCE,0xAE,0x83,0x32,0x00,0x00,0x3E,0x00,0xC0,0x69,0x5A,0x79,0xD6,0x58,0xD6,0x4C,0x73,0x38,0xD6,
+    0x68,0x5A,0xAC,0x00,0x00,0x14,0x00,0xF5,0x18,0x68,0x5A,0x4C,0x7B,0x4C,0x73,0xDE,0xFF,0x69,0x52,0xCE,0x83,0x54,0xB5,0x75,0xB5,0x34,0xAD,0x33,0xAD,0x95,0xBD,0x54,
+    0xAD,0xD2,0x9C,0xDE,0xFF,0x38,0xCE,0xEB,0x62,0xCA,0x62,0x58,0xD6,0xD6,0xC5,0xEA,0x82,0x00,0x00,0x7A,0x00,0x02,0x04,0x00,0xF5,0x02,0x48,0x5A,0x69,0x5A,0x50,0x8C,
+    0x3B,0xE7,0xDF,0xFF,0x34,0xAD,0x8D,0x73,0x79,0xDE,0x2B,0x80,0x01,0xC0,0x68,0x5A,0x8D,0x7B,0x7D,0xFF,0x95,0xBD,0xEA,0x62,0xF7,0xC5,0x7E,0x01,0x04,0xD6,0x01,0xA0,
+    0xCA,0x62,0xBD,0xFF,0x54,0xAD,0x71,0x94,0x13,0xAD,0x42,0x00,0x00,0x7E,0x00,0xC0,0x48,0x5A,0x89,0x5A,0x50,0x94,0x6D,0x73,0xDF,0xFF,0x69,0x52,0x02,0x00,0xF0,0x01,
+    0x89,0x5A,0xCA,0x62,0x2C,0x6B,0xF7,0xC5,0xFE,0xFF,0xDE,0xFF,0xFF,0xFF,0x9E,0xF7,0x92,0x01,0x80,0x6D,0x73,0x58,0xD6,0x37,0xCE,0xEB,0x6A,0x88,0x02,0x00,0x38,0x00,
+    0x01,0xD0,0x00,0x00,0x94,0x02,0x70,0x52,0x71,0x94,0x1B,0xE7,0xDE,0xFF,0x80,0x00,0x44,0x2C,0x6B,0x78,0xD6,0x68,0x02,0x00,0x58,0x00,0xA0,0xA9,0x62,0xF3,0xAC,0xCE,
+    0x83,0x50,0x94,0x4C,0x73,0x0E,0x00,0x00,0x80,0x00,0x00,0xF2,0x00,0xA0,0x70,0x94,0xBE,0xFF,0xAE,0x7B,0x34,0xAD,0xCE,0x83,0x2A,0x03,0x00,0x16,0x00,0xF3,0x0A,0x48,
+    0x52,0xEA,0x6A,0xD6,0xC5,0x6C,0x73,0xDF,0xFF,0x9D,0xF7,0x7D,0xF7,0x5D,0xEF,0x3C,0xEF,0xB6,0xBD,0x8D,0x7B,0x75,0xB5,0xFF,0x01,0x00,0xF0,0x03,0x7D,0xF7,0xEB,0x62,
+    0x68,0x52,0xCA,0x62,0x17,0xC6,0x9D,0xF7,0xB9,0xDE,0xEA,0x6A,0x68,0x52,0x3A,0x00,0x00,0x8A,0x00,0x40,0xCA,0x62,0x3C,0xEF,0xE4,0x01,0xB3,0xDF,0xFF,0xFF,0xFF,0xD7,
+    0xBD,0x89,0x5A,0xF6,0xC5,0x50,0x80,0x03,0x03,0x72,0x00,0x30,0x52,0x68,0x5A,0xC6,0x01,0x01,0xAE,0x00,0x01,0xBE,0x03,0x90,0x89,0x5A,0xB9,0xDE,0x5C,0xEF,0x4C,0x6B,
+    0xD6,0x12,0x03,0x01,0xFE,0x02,0x00,0x94,0x00,0x63,0x8D,0x7B,0x99,0xDE,0x4C,0x6B,0x6F,0x00,0x0F,0x07,0x00,0x00,0xF0,0x0A,0x9D,0xF7,0xAE,0x7B,0xCA,0x62,0x69,0x52,
+    0x89,0x5A,0xB5,0xBD,0x79,0xDE,0xB9,0xDE,0x99,0xDE,0x37,0xCE,0x37,0xCE,0x13,0xAD,0xBA,0x21,0x01,0x03,0x30,0x00,0xA4,0x99,0xD6,0x69,0x52,0xD2,0xA4,0x3C,0xEF,0xAA,
+    0x62,0x56,0x02,0x02,0x28,0x01,0x00,0x06,0x00,0x02,0x8E,0x00,0x00,0xEC,0x00,0xB1,0x0F,0x8C,0x5C,0xF7,0x75,0xB5,0xAE,0x7B,0x13,0xAD,0x69,0x7E,0x00,0x00,0x14,0x00,
+    0x7F,0x89,0x5A,0xD6,0xC5,0x99,0xDE,0x2C,0x80,0x00,0x08,0xF7,0x09,0xFF,0xFF,0x9D,0xF7,0xB6,0xBD,0x70,0x94,0x4C,0x73,0xCA,0x62,0xAA,0x5A,0xAA,0x5A,0xEB,0x62,0x4C,
+    0x6B,0xB2,0x9C,0x99,0xD6,0x7F,0x00,0xC1,0xFF,0x3C,0xEF,0x2B,0x6B,0x0B,0x6B,0xBA,0xDE,0x34,0xAD,0x89,0x3C,0x03,0x00,0x5A,0x00,0x00,0xF8,0x00,0x00,0x04,0x00,0x02,
+    0x0C,0x00,0xE0,0x68,0x5A,0x0B,0x6B,0x58,0xD6,0xBE,0xFF,0x4C,0x73,0x91,0x9C,0x91,0x9C,0x50,0x04,0x00,0x98,0x00,0x60,0x68,0x5A,0x68,0x52,0x9D,0xFF,0x0E,0x03,0x03,
+    0xC9,0x00,0x0F,0x07,0x00,0x06,0xFA,0x01,0x9D,0xF7,0xDA,0xDE,0x58,0xCE,0x18,0xCE,0x17,0xC6,0x38,0xCE,0xBA,0xDE,0xBE,0xF7,0x29,0x00,0x40,0xBE,0xF7,0xF3,0xA4,0xC0,
+    0x02,0x61,0x7D,0xF7,0xF3,0xA4,0x89,0x5A,0xA2,0x01,0x12,0x5A,0x7C,0x00,0x04,0x7E,0x00,0xA6,0xA9,0x5A,0xB6,0xBD,0xBE,0xFF,0x3C,0xEF,0xAA,0x5A,0xA8,0x04,0x00,0x82,
+    0x00,0x8A,0x30,0x8C,0xDE,0xFF,0x58,0xD6,0xEB,0x62,0x50,0x00,0x0F,0x0E,0x00,0x01,0x00,0xE8,0x01,0x02,0x18,0x00,0x06,0x0A,0x00,0x02,0x10,0x00,0x00,0x06,0x00,0xD1,
+    0xDA,0xDE,0x6D,0x73,0x49,0x52,0x8D,0x7B,0x3B,0xEF,0xB5,0xBD,0xCA,0x1C,0x05,0x04,0x60,0x03,0x01,0x4C,0x04,0x31,0x5A,0x78,0xCE,0xA8,0x02,0x51,0xA5,0xEB,0x62,0x37,
+    0xCE,0x24,0x01,0x01,0x82,0x01,0x40,0x68,0x52,0xFA,0xE6,0x66,0x03,0x1F,0xCA,0x80,0x00,0x10,0x00,0x66,0x00,0x0F,0x04,0x00,0x09,0x11,0x38,0x80,0x04,0xF1,0x08,0x0B,
+    0x6B,0xF6,0xC5,0x3B,0xEF,0x34,0xAD,0x2B,0x6B,0xEA,0x62,0xCA,0x62,0xA9,0x62,0xAA,0x62,0xAA,0x62,0x92,0x9C,0x7D,0x30,0x01,0x82,0xDE,0xFF,0x8D,0x73,0x91,0x94,0x34,
+    0xAD,0x20,0x01,0x00,0xE6,0x04,0x20,0xCA,0x62,0x1A,0x00,0x4F,0xF7,0xC5,0x8A,0x5A,0x5A,0x00,0x09,0x0F,0x1C,0x00,0x15,0xF1,0x0A,0x79,0xD6,0x0F,0x8C,0xEA,0x62,0x68,
+    0x52,0x2C,0x6B,0xF3,0xA4,0xB5,0xBD,0x95,0xBD,0xD2,0xA4,0x2F,0x8C,0xD2,0xA4,0x38,0xCE,0x9E,0x7E,0x00,0x40,0xFF,0xFF,0x1B,0xE7,0x78,0x06,0x20,0x6C,0x73,0x80,0x00,
+    0x00,0x7E,0x00,0x40,0x48,0x52,0x13,0xAD,0x46,0x02,0x3F,0xF7,0xC5,0xA9,0x80,0x00,0x32,0x00,0x30,0x04,0xF8,0x01,0x38,0xCE,0x34,0xA5,0x30,0x8C,0x4D,0x73,0x0B,0x63,
+    0x4C,0x6B,0x30,0x8C,0x34,0xAD,0xA8,0x02,0x75,0x54,0xAD,0x2C,0x6B,0xDA,0xE6,0x89,0x1A,0x02,0x40,0x89,0x5A,0x17,0xCE,0xDC,0x00,0x3F,0xD6,0xBD,0x89,0x80,0x00,0x34,
+    0x00,0x4E,0x00,0x60,0xDE,0xFF,0x7D,0xF7,0x3C,0xEF,0x02,0x00,0x20,0x7D,0xEF,0xDE,0x00,0x06,0x2E,0x02,0x63,0xD2,0x9C,0x14,0xAD,0x95,0xB5,0xFE,0x00,0xF0,0x00,0x5A,
+    0x48,0x52,0x8E,0x7B,0x1B,0xE7,0xFF,0xFF,0xFE,0xFF,0xB6,0xBD,0x89,0x5A,0xF1,0x03,0x0B,0x6B,0x7C,0xF7,0x48,0x52,0x48,0x5A,0x48,0x5A,0x48,0x52,0x0B,0x6B,0x95,0xBD,
+    0x6C,0x7B,0x0C,0x00,0xF0,0x03,0x5A,0x48,0x5A,0x68,0x5A,0xAA,0x62,0x99,0xDE,0xF7,0xC5,0xEB,0x62,0xDA,0xE6,0xAE,0x83,0x68,0x22,0x00,0x30,0x5A,0x68,0x5A,0x08,0x00,
+    0xF0,0x01,0x68,0x52,0x3C,0xEF,0xDF,0xFF,0x5D,0xEF,0x2C,0x6B,0x6C,0x73,0x38,0xD6,0xCA,0x62,0x32,0x00,0x04,0x1A,0x00,0x40,0xEF,0x83,0xDE,0xFF,0x01,0x00,0x61,0x2C,
+    0x6B,0x7C,0xF7,0x68,0x52,0x2E,0x00,0x70,0x5A,0x6C,0x7B,0x33,0xB5,0xA9,0x62,0x0C,0x00,0x01,0x2A,0x00,0xC1,0x52,0xAE,0x83,0x9D,0xFF,0x91,0x9C,0xEF,0x83,0x99,0xDE,
+    0x89,0x56,0x00,0x00,0x16,0x00,0x00,0x80,0x00,0xE2,0x30,0x8C,0xDE,0xFF,0xDF,0xFF,0x17,0xC6,0xCA,0x62,0x17,0xCE,0xF3,0xAC,0x16,0x00,0xA2,0x68,0x5A,0x48,0x52,0x68,
+    0x5A,0x68,0x52,0xB6,0xBD,0x58,0x00,0x34,0x4C,0x73,0x7D,0xB0,0x00,0x50,0x5A,0x6C,0x7B,0x91,0x9C,0x26,0x00,0x01,0x5A,0x00,0xD1,0x52,0x68,0x52,0xD7,0xC5,0x9A,0xDE,
+    0x4C,0x6B,0x37,0xCE,0xEF,0x8B,0x12,0x00,0x02,0x5C,0x00,0xF3,0x01,0x52,0x48,0x52,0xFB,0xE6,0xDE,0xFF,0xBE,0xFF,0xB2,0x9C,0xEB,0x62,0x7D,0xF7,0xCA,0x88,0x00,0x00,
+    0xB0,0x00,0x00,0x58,0x00,0x20,0x7D,0xEF,0xAE,0x00,0x41,0xFF,0xFF,0x6C,0x73,0x08,0x01,0x00,0x6C,0x00,0x01,0xE4,0x00,0x00,0x00,0x01,0x01,0x5C,0x00,0xB2,0x52,0xCA,
+    0x62,0xBE,0xFF,0xF7,0xC5,0x0B,0x6B,0x99,0xDE,0x56,0x00,0x00,0x3A,0x00,0xF0,0x03,0x48,0x52,0x48,0x52,0x0F,0x8C,0xBD,0xF7,0xFF,0xFF,0xFB,0xE6,0x8D,0x7B,0xB6,0xBD,
+    0x38,0xD6,0x2C,0x00,0x00,0x34,0x00,0x00,0x1E,0x00,0x40,0x68,0x52,0xAE,0x7B,0xCA,0x00,0x00,0x5A,0x00,0x40,0xEF,0x83,0x7D,0xF7,0x38,0x00,0x00,0x18,0x00,0x02,0x20,
+    0x00,0x02,0x06,0x00,0xC2,0x68,0x52,0xD2,0xA4,0x7D,0xF7,0xEF,0x83,0x33,0xAD,0xF2,0xA4,0x3C,0x00,0x02,0x18,0x00,0x40,0x89,0x5A,0xD6,0xC5,0x38,0x00,0x71,0xB6,0xBD,
+    0x2C,0x6B,0xBA,0xE6,0xAA,0xAE,0x00,0x00,0x3C,0x00,0x00,0xAC,0x00,0x40,0x69,0x52,0x58,0xD6,0x1C,0x00,0x00,0x04,0x00,0x62,0x50,0x94,0x7D,0xF7,0x68,0x52,0x34,0x00,
+    0x03,0x20,0x00,0x01,0xF0,0x00,0xC0,0xAA,0x62,0xDA,0xE6,0xBA,0xE6,0x2C,0x73,0xD6,0xC5,0x4C,0x73,0x78,0x00,0x00,0x22,0x00,0x00,0x04,0x00,0xE0,0x8D,0x7B,0xFB,0xE6,
+    0xFF,0xFF,0x9D,0xF7,0x50,0x8C,0xB2,0x9C,0x95,0xBD,0x54,0x01,0x00,0x16,0x00,0x01,0x04,0x00,0x50,0x52,0x4C,0x73,0x9D,0xF7,0x54,0x00,0x00,0x04,0x00,0x31,0x92,0x9C,
+    0x5C,0xB8,0x01,0x04,0x54,0x00,0x00,0x08,0x00,0x00,0xA0,0x00,0x93,0x0F,0x8C,0x7D,0xF7,0xD2,0xA4,0xCE,0x83,0x54,0xCA,0x01,0x00,0x18,0x00,0xF0,0x03,0x68,0x5A,0x69,
+    0x5A,0xD3,0xA4,0xBE,0xF7,0xFF,0xFF,0xDB,0xDE,0x2C,0x6B,0xF6,0xC5,0x8D,0x7B,0x58,0x00,0x00,0x1A,0x00,0x00,0x58,0x00,0x42,0x68,0x5A,0x54,0xB5,0xB4,0x01,0x00,0x58,
+    0x00,0x44,0x54,0xB5,0x5C,0xF7,0x1E,0x00,0x00,0x22,0x00,0x02,0x04,0x00,0xC0,0x69,0x5A,0xD6,0xC5,0xBE,0xFF,0x89,0x5A,0x54,0xB5,0xB1,0x9C,0x12,0x00,0x02,0x38,0x00,
+    0xF0,0x03,0x68,0x5A,0xEB,0x6A,0x79,0xD6,0xFF,0xFF,0xDF,0xFF,0x91,0x94,0x0F,0x8C,0x75,0xB5,0x89,0x62,0x1C,0x00,0x04,0x04,0x00,0x35,0xEA,0x62,0x99,0x06,0x01,0x60,
+    0xFF,0xFF,0x95,0xB5,0x1B,0xEF,0x08,0x01,0x02,0x3A,0x00,0x00,0xAA,0x00,0x00,0x4A,0x02,0xC0,0x2C,0x73,0x99,0xDE,0x95,0xB5,0xEB,0x62,0xD6,0xC5,0x0B,0x6B,0x06,0x01,
+    0x00,0x04,0x00,0x00,0x18,0x00,0x20,0xCE,0x83,0x8C,0x00,0x80,0x9D,0xF7,0xAA,0x5A,0x33,0xAD,0x50,0x94,0x16,0x00,0x04,0x56,0x00,0x50,0x48,0x52,0xB1,0x9C,0xBE,0x1D,
+    0x00,0x03,0x04,0x00,0x46,0x17,0xC6,0xFA,0xE6,0x58,0x00,0x02,0x2A,0x00,0x00,0x24,0x00,0x80,0x7D,0xF7,0x6D,0x73,0x30,0x8C,0x74,0xB5,0x98,0x02,0x03,0x6E,0x00,0x50,
+    0x5A,0x69,0x52,0x18,0xCE,0x37,0x00,0x20,0xD2,0x9C,0x06,0x01,0x04,0x72,0x00,0x00,0x5A,0x00,0x20,0x48,0x5A,0xCC,0x02,0x00,0x1C,0x00,0x04,0x04,0x00,0x4C,0x38,0xCE,
+    0xB9,0xDE,0x58,0x00,0x00,0x24,0x00,0x73,0x58,0xD6,0xCA,0x62,0x78,0xD6,0xAD,0x7E,0x03,0x00,0x70,0x00,0x40,0x48,0x52,0x2C,0x6B,0x92,0x00,0x82,0x3C,0xEF,0xCA,0x62,
+    0xF3,0xA4,0x13,0xAD,0x50,0x00,0x00,0x06,0x00,0x00,0x1E,0x00,0x35,0xAE,0x83,0x9E,0xB4,0x01,0x00,0x5C,0x00,0x4B,0x58,0xCE,0x78,0xD6,0x58,0x00,0x01,0xD8,0x01,0x71,
+    0x70,0x94,0xCE,0x83,0x99,0xDE,0x69,0xD0,0x03,0x00,0x38,0x00,0x00,0x06,0x01,0xC2,0x38,0xCE,0xDF,0xFF,0xDE,0xFF,0x13,0xA5,0x69,0x52,0xBA,0xE6,0xAE,0x00,0x04,0xCA,
+    0x00,0x26,0x68,0x5A,0x62,0x02,0x00,0x56,0x00,0x60,0xFF,0xFF,0x79,0xD6,0x17,0xC6,0xC8,0x03,0x04,0x78,0x00,0x00,0x40,0x00,0xA0,0xF2,0xA4,0x1B,0xE7,0xAD,0x7B,0x17,
+    0xCE,0x2F,0x8C,0x3A,0x04,0x04,0x56,0x00,0xE6,0xEB,0x6A,0xBE,0xFF,0xDE,0xFF,0x5D,0xEF,0xAE,0x7B,0x13,0xAD,0xF6,0xC5,0x90,0x01,0x00,0x3A,0x00,0x32,0xEA,0x62,0xDF,
+    0x4F,0x00,0x05,0x06,0x00,0x4A,0x99,0xDE,0x54,0xB5,0x58,0x00,0x84,0x89,0x5A,0x5C,0xEF,0x95,0xB5,0x4C,0x73,0x16,0x04,0x00,0x38,0x00,0x60,0x48,0x5A,0x68,0x52,0x74,
+    0xB5,0x4C,0x03,0x80,0xD6,0xBD,0x2C,0x6B,0x3C,0xEF,0x0A,0x6B,0x16,0x00,0x00,0x72,0x00,0x00,0x08,0x00,0x28,0x69,0x52,0x0A,0x02,0x02,0x5B,0x00,0x40,0xB9,0xDE,0x91,
+    0x9C,0x58,0x00,0x04,0x80,0x00,0xB7,0x68,0x52,0x30,0x94,0x5C,0xEF,0x30,0x8C,0x13,0xAD,0xB2,0x68,0x03,0xF2,0x01,0x48,0x5A,0x0B,0x6B,0xDA,0xE6,0xDF,0xFF,0x7D,0xF7,
+    0x51,0x94,0xD2,0xA4,0x54,0xB5,0x9A,0x02,0x00,0x06,0x01,0x00,0x68,0x03,0x04,0xC4,0x04,0x02,0x52,0x00,0x02,0x06,0x00,0x48,0xDA,0xE6,0x8D,0x7B,0x60,0x01,0x80,0x69,
+    0x5A,0xB9,0xDE,0xDA,0xDE,0x0B,0x63,0x62,0x02,0x00,0x38,0x00,0x03,0x04,0x00,0x30,0x52,0xB2,0x9C,0x06,0x01,0x80,0xBA,0xDE,0x6D,0x73,0x78,0xD6,0x0B,0x6B,0x8A,0x00,
+    0x02,0xAE,0x00,0x51,0x48,0x5A,0x89,0x5A,0x58,0x26,0x02,0x02,0x50,0x00,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0xFF,0x01,0x00,0xD1,0xFB,0xE6,0x8A,0x5A,
+    0xB2,0xA4,0x6D,0x7B,0x48,0x52,0x48,0x5A,0x68,0x02,0x00,0x62,0x48,0x52,0xAA,0x5A,0x7D,0xF7,0x25,0x00,0xC0,0xDF,0xFF,0xDF,0xFF,0xBA,0xDE,0x4C,0x73,0x48,0x52,0x48,
+    0x52,0x1E,0x00,0xC0,0x6D,0x73,0x17,0xCE,0xCA,0x62,0xB5,0xBD,0x68,0x52,0x48,0x5A,0x02,0x00,0x00,0x14,0x00,0xD3,0xA9,0x5A,0xF6,0xC5,0xBE,0xFF,0x3C,0xEF,0x6C,0x73,
+    0xCA,0x6A,0x68,0x16,0x00,0xE0,0x48,0x52,0x68,0x52,0xFE,0xFF,0xFF,0xFF,0x13,0xA5,0xEA,0x62,0x53,0xB5,0x3C,0x00,0x00,0x5E,0x00,0x62,0xAA,0x5A,0x8E,0x73,0x3C,0xEF,
+    0x5A,0x00,0x06,0x06,0x00,0x80,0x50,0x94,0x2C,0x73,0xD2,0xA4,0xA9,0x62,0x4C,0x00,0x04,0x40,0x00,0x33,0x71,0x9C,0xBE,0x21,0x00,0x33,0x1B,0xE7,0x6D,0x7E,0x00,0x00,
+    0x42,0x00,0xA4,0xA9,0x62,0xD6,0xC5,0x0F,0x8C,0xF3,0xA4,0x8D,0x7B,0x2A,0x00,0x00,0x36,0x00,0x80,0x2B,0x6B,0xD6,0xC5,0xD7,0xC5,0xEE,0x8B,0x22,0x00,0x00,0x18,0x00,
+    0x60,0x68,0x5A,0x68,0x52,0xAE,0x7B,0x41,0x00,0xF0,0x04,0x1B,0xE7,0xCA,0x5A,0x74,0xB5,0x89,0x5A,0x89,0x5A,0xAD,0x83,0x0F,0x8C,0xB6,0xBD,0xBE,0xFF,0xDF,0x17,0x00,
+    0x09,0x04,0x00,0x60,0x5C,0xEF,0x4D,0x73,0x71,0x9C,0x52,0x00,0x00,0x4C,0x00,0x02,0xD6,0x00,0x42,0x4C,0x73,0xBA,0xDE,0x25,0x00,0x60,0xDF,0xFF,0xD2,0xA4,0x69,0x5A,
+    0x56,0x00,0x02,0x5E,0x00,0xA2,0x50,0x94,0x54,0xB5,0x0B,0x6B,0xF7,0xCD,0x89,0x5A,0x10,0x00,0x02,0x34,0x00,0x11,0x68,0x1E,0x01,0x00,0x44,0x01,0x00,0x40,0x00,0x60,
+    0x48,0x5A,0x68,0x52,0x58,0xCE,0x40,0x00,0xF3,0x02,0xDE,0xFF,0xCE,0x7B,0xCE,0x83,0x74,0xB5,0x34,0xB5,0xD6,0xC5,0xB2,0x9C,0x75,0xB5,0x9D,0x58,0x01,0x00,0x1C,0x00,
+    0x04,0x04,0x00,0xA4,0xDE,0xFF,0x75,0xB5,0x8E,0x7B,0x71,0x9C,0x89,0x5A,0x40,0x00,0x62,0x68,0x5A,0x69,0x5A,0x13,0xAD,0x02,0x01,0x40,0x5D,0xEF,0x99,0xDE,0x1C,0x01,
+    0x03,0x58,0x00,0xB0,0x5A,0x2B,0x73,0x17,0xCE,0x6C,0x73,0xB2,0xA4,0x2F,0x8C,0x80,0x00,0x02,0x16,0x00,0x01,0x06,0x00,0x10,0x52,0xA4,0x01,0x00,0x0A,0x00,0x00,0xFE,
+    0x00,0x31,0x2C,0x6B,0x9E,0x5F,0x00,0xF3,0x02,0xDF,0xFF,0x79,0xD6,0x0B,0x6B,0xD2,0xA4,0x6C,0x73,0x0B,0x6B,0x69,0x52,0xAE,0x7B,0xDB,0xD6,0x00,0x01,0x1D,0x00,0x05,
+    0x05,0x00,0x80,0x3C,0xEF,0x8E,0x7B,0x75,0xB5,0xCA,0x62,0x3E,0x00,0x04,0x56,0x00,0xE0,0x2C,0x73,0xFB,0xE6,0xDE,0xFF,0xBE,0xFF,0x13,0xA5,0xCE,0x83,0x91,0x9C,0xE6,
+    0x00,0x02,0x04,0x00,0xD3,0x48,0x52,0x74,0xB5,0x54,0xAD,0xAA,0x5A,0xD6,0xC5,0x0B,0x6B,0x68,0xB2,0x00,0x02,0x1E,0x01,0x02,0x3E,0x00,0x00,0x40,0x00,0x44,0x89,0x5A,
+    0x30,0x8C,0x68,0x01,0xC4,0xDF,0xFF,0xEB,0x62,0x69,0x52,0xA9,0x5A,0x0F,0x8C,0x99,0xD6,0x14,0x00,0x05,0x79,0x00,0x03,0x09,0x00,0x84,0xDF,0xFF,0x75,0xB5,0x4C,0x73,
+    0xB6,0xC5,0x56,0x02,0x20,0x48,0x5A,0x40,0x02,0x20,0x33,0xAD,0x1F,0x00,0x84,0x9A,0xD6,0x4C,0x73,0xF7,0xCD,0xCA,0x62,0x64,0x00,0xA0,0x68,0x52,0xB1,0x9C,0x3C,0xEF,
+    0xEB,0x62,0xEF,0x8B,0x88,0x01,0x02,0x16,0x00,0x00,0x9A,0x00,0x00,0x7E,0x00,0x01,0x0E,0x00,0x74,0x52,0xCA,0x62,0x50,0x94,0x75,0xB5,0x6C,0x00,0x80,0xDF,0xFF,0x95,
+    0xB5,0x75,0xB5,0x5C,0xEF,0xCA,0x02,0x04,0x14,0x00,0x00,0x58,0x00,0x0A,0x04,0x00,0x80,0x1C,0xEF,0xAE,0x7B,0xB2,0xA4,0x0F,0x8C,0x82,0x01,0x04,0x4E,0x00,0xE0,0xEA,
+    0x62,0x5C,0xEF,0xFF,0xFF,0xBE,0xFF,0x92,0x9C,0x8D,0x7B,0xD2,0xA4,0x1A,0x00,0x00,0x64,0x00,0xF8,0x01,0x48,0x5A,0x4C,0x73,0x3B,0xEF,0xB6,0xBD,0xCA,0x5A,0xB2,0x9C,
+    0x95,0xBD,0xCE,0x83,0xB4,0x00,0x80,0x48,0x52,0x89,0x5A,0xEF,0x8B,0xF3,0xA4,0xEC,0x00,0x0A,0x60,0x00,0x0F,0x0E,0x00,0x0D,0x40,0xDF,0xFF,0x95,0xBD,0x54,0x01,0x33,
+    0xA9,0x62,0x68,0x6A,0x03,0x00,0xC6,0x01,0x20,0x91,0x9C,0xB2,0x00,0x62,0xDA,0xE6,0xCA,0x5A,0xF2,0xA4,0x7C,0x00,0x00,0x72,0x01,0xFF,0x16,0x89,0x5A,0xDA,0xE6,0x9E,
+    0xFF,0x91,0x9C,0xCA,0x5A,0x0F,0x8C,0xBA,0xE6,0xD6,0xC5,0xCE,0x83,0xAA,0x62,0x69,0x5A,0x89,0x5A,0x2B,0x73,0xB1,0x9C,0x17,0xCE,0x34,0xAD,0x6C,0x73,0xF3,0xA4,0xBE,
+    0x68,0x02,0x00,0x0F,0x84,0x00,0x09,0xA4,0xDF,0xFF,0xBE,0xFF,0x0B,0x6B,0x8D,0x7B,0xB2,0xA4,0xFE,0x00,0x01,0x70,0x00,0xA1,0x52,0x1B,0xEF,0xDF,0xFF,0xDE,0xFF,0x50,
+    0x8C,0xEA,0x9E,0x03,0x02,0x14,0x00,0x20,0xAA,0x5A,0x1A,0x02,0xF0,0x07,0x1C,0xE7,0xEF,0x83,0x69,0x52,0x89,0x5A,0x54,0xB5,0x3C,0xF7,0x9D,0xFF,0x9D,0xFF,0xBE,0xFF,
+    0x3C,0xF7,0x74,0xB5,0x66,0x02,0x24,0x0F,0x84,0x3E,0x04,0x0F,0x72,0x00,0x09,0x0C,0x1C,0x00,0xA0,0xDF,0xFF,0xDA,0xDE,0xEA,0x62,0xB2,0xA4,0xEB,0x6A,0x42,0x02,0x02,
+    0xCA,0x01,0xA0,0x68,0x5A,0x6D,0x73,0xBA,0xDE,0x5C,0xEF,0x58,0xD6,0x96,0x00,0x00,0x14,0x00,0x00,0x04,0x00,0x20,0xCE,0x83,0x98,0x01,0xF2,0x0B,0xDF,0xFF,0x5C,0xEF,
+    0x30,0x8C,0xAA,0x62,0x48,0x52,0xA9,0x5A,0x2C,0x6B,0x8D,0x7B,0x2C,0x6B,0x89,0x5A,0x69,0x52,0x2C,0x6B,0xF3,0xA4,0x38,0x03,0x0C,0x60,0x00,0x0F,0x10,0x00,0x0F,0x82,
+    0xDF,0xFF,0x51,0x94,0xCE,0x83,0x0F,0x8C,0x6C,0x00,0x00,0x6A,0x00,0x00,0x04,0x00,0x46,0x0B,0x6B,0xEE,0x8B,0xFE,0x00,0x00,0x96,0x01,0x13,0x33,0x9A,0x03,0x00,0x1C,
+    0x02,0xF0,0x01,0xB6,0xBD,0x91,0x9C,0x8D,0x73,0x89,0x52,0x69,0x52,0x0B,0x6B,0x70,0x94,0x13,0xA5,0x1A,0x01,0x0F,0x6A,0x00,0x0F,0x0F,0x22,0x00,0x05,0x80,0xDB,0xDE,
+    0x4C,0x73,0xD2,0xA4,0xEA,0x6A,0x82,0x00,0x01,0x6C,0x01,0x02,0x90,0x05,0x01,0x6A,0x04,0x00,0x10,0x00,0x00,0x18,0x00,0x22,0x0B,0x6B,0x5A,0x04,0x04,0x44,0x00,0xAF,
+    0xBE,0xFF,0xFB,0xE6,0x37,0xCE,0x17,0xCE,0xBA,0xDE,0xF8,0x00,0x25,0x04,0x4A,0x00,0x00,0xD0,0x00,0x62,0x13,0xA5,0x0F,0x8C,0xB2,0xA4,0xB0,0x05,0x00,0x72,0x00,0x00,
+    0x8C,0x01,0x02,0x08,0x00,0x00,0x0A,0x00,0x02,0x80,0x00,0x11,0x38,0xDA,0x04,0x06,0x36,0x00,0x0F,0x0A,0x00,0x39,0x40,0x99,0xD6,0x4C,0x73,0xE2,0x05,0x00,0x0C,0x05,
+    0x00,0x6E,0x00,0x02,0x04,0x00,0x00,0x82,0x00,0x00,0xFA,0x02,0x8F,0x68,0x5A,0x6D,0x7B,0x54,0xB5,0x79,0xD6,0x72,0x00,0x39,0x0A,0x4C,0x00,0xA2,0xBE,0xFF,0xF3,0xA4,
+    0xCA,0x62,0xF6,0xC5,0xD2,0xA4,0xF4,0x01,0x02,0x80,0x00,0x00,0x08,0x02,0xAF,0x68,0x52,0xEA,0x62,0x50,0x94,0x13,0xAD,0xB2,0x9C,0x5C,0x03,0x1D,0x0A,0x62,0x00,0x0F,
+    0x0E,0x00,0x0D,0xC0,0x3C,0xEF,0x4D,0x73,0xCA,0x62,0x54,0xAD,0xF6,0xC5,0xEE,0x83,0x06,0x05,0x20,0x68,0x52,0x12,0x04,0x40,0xAA,0x5A,0x71,0x9C,0x6C,0x02,0x0C,0xFE,
+    0x01,0x0F,0x4E,0x00,0x0D,0x0B,0x20,0x00,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0xD1,0xDF,0xFF,0x17,0xC6,0x89,0x5A,0xAA,0x5A,0x89,0x52,0xDB,0xDE,0xFF,0x01,0x00,0x31,0xDF,
+    0xFF,0xDF,0x08,0x00,0x0F,0x05,0x00,0x55,0xA2,0x3C,0xEF,0xEF,0x83,0xAD,0x7B,0x0F,0x84,0x9A,0xD6,0x72,0x00,0x0F,0x7E,0x00,0x5B,0x00,0x74,0x00,0x5F,0xBA,0xDE,0x3C,
+    0xEF,0xFF,0xF6,0x00,0x5C,0x00,0x78,0x00,0x0F,0x04,0x00,0xE8,0x22,0xF7,0xFF,0x02,0x00,0x1F,0xEF,0x04,0x01,0x50,0x02,0x6A,0x00,0x02,0x06,0x00,0xFF,0x02,0xEF,0xFE,
+    0xEF,0xFE,0xE7,0x9C,0xD7,0x5B,0xCF,0x19,0xBF,0xD9,0xB6,0xD8,0xAE,0xB8,0xA6,0x80,0x00,0x4C,0x21,0xF7,0xFF,0x72,0x00,0xFF,0x0B,0xFD,0xD7,0x5A,0xBF,0xB7,0xA6,0x15,
+    0x8E,0xB3,0x7D,0xB3,0x75,0x71,0x65,0xCF,0x54,0x2D,0x3C,0xAA,0x2B,0x69,0x1B,0x49,0x1B,0x48,0x1B,0x80,0x00,0x3A,0x02,0xE4,0x00,0x30,0xF7,0xFF,0xEF,0x02,0x00,0xF0,
+    0x07,0xFE,0xDF,0x7B,0xCF,0x98,0xAE,0x93,0x85,0xD0,0x64,0x6E,0x54,0x4D,0x4C,0x0C,0x3C,0xCB,0x2B,0x69,0x23,0x68,0x13,0x02,0x00,0x50,0x88,0x13,0x68,0x0B,0x88,0x02,
+    0x00,0x3F,0x03,0x88,0x03,0x80,0x00,0x34,0x02,0x7A,0x00,0xF0,0x06,0xEF,0xFF,0xE7,0xFE,0xDF,0xDC,0xC7,0x76,0x96,0x52,0x6D,0x4D,0x44,0x8A,0x2B,0x69,0x23,0x48,0x1B,
+    0x69,0x1B,0x72,0x00,0x03,0x70,0x00,0x03,0x74,0x00,0x20,0x88,0x03,0x02,0x00,0x11,0xA8,0x06,0x00,0x0F,0x80,0x00,0x28,0x04,0x74,0x00,0xF2,0x03,0xEF,0xDD,0xDF,0x5B,
+    0xCF,0x3A,0xBF,0xD9,0xAE,0x32,0x75,0x4E,0x54,0xAA,0x33,0x49,0x23,0x28,0xE6,0x00,0x30,0x0B,0x68,0x0B,0x68,0x00,0x42,0x88,0x03,0xA8,0x03,0x6C,0x00,0x04,0xF4,0x00,
+    0x20,0x68,0x0B,0x94,0x00,0x6F,0x48,0x13,0x68,0x13,0x48,0x13,0x80,0x00,0x24,0x00,0xD8,0x01,0xF4,0x00,0xE7,0xFE,0xDF,0x19,0xB7,0x15,0x8E,0x14,0x86,0x31,0x65,0xEC,
+    0x33,0x8A,0x23,0xEA,0x00,0x01,0xEC,0x00,0x12,0x03,0x76,0x00,0x04,0x78,0x00,0x03,0x72,0x00,0xFF,0x04,0x1B,0x48,0x1B,0x48,0x13,0xA9,0x23,0xAE,0x4C,0x10,0x65,0x31,
+    0x6D,0x31,0x6D,0x52,0x75,0x52,0x75,0x80,0x00,0x18,0x02,0xF0,0x00,0x01,0x7A,0x00,0xA2,0x9C,0xCF,0x93,0x85,0xAF,0x5C,0xAF,0x54,0xEB,0x33,0x76,0x00,0x04,0xDA,0x00,
+    0x02,0xF0,0x00,0x82,0x88,0x03,0xA8,0x0B,0x88,0x03,0x68,0x03,0x76,0x00,0xFF,0x0F,0x69,0x1B,0x69,0x1B,0x89,0x23,0xEF,0x4C,0x75,0x86,0xB6,0x96,0xB7,0x96,0xEF,0x54,
+    0x6D,0x4C,0xBB,0xBF,0xFD,0xCF,0xFC,0xC7,0x5A,0xBF,0xFE,0xE7,0x5B,0xCF,0x80,0x00,0x14,0x00,0x7C,0x00,0xF0,0x00,0xEF,0xFE,0xE7,0xFC,0xCF,0x19,0xA7,0x6E,0x4C,0xAA,
+    0x2B,0xAA,0x23,0x69,0x1B,0x40,0x01,0x01,0x78,0x00,0x03,0x66,0x01,0x02,0x7C,0x00,0x02,0x74,0x00,0x00,0x1C,0x00,0xF0,0x01,0x89,0x1B,0xEB,0x33,0x10,0x65,0x5A,0xB7,
+    0xDC,0xCF,0xFC,0xC7,0xDB,0xBF,0xBB,0xB7,0x76,0x00,0xFF,0x03,0xFE,0xDF,0x35,0x8E,0x6E,0x54,0xFD,0xCF,0x56,0x96,0x6A,0x33,0xF0,0x64,0xFE,0xE7,0x5B,0xC7,0x80,0x00,
+    0x0A,0x00,0x76,0x00,0xF0,0x01,0xF7,0xFF,0xEF,0xDE,0xDF,0x9C,0xD7,0xF9,0xB6,0xF5,0x8D,0x2D,0x4C,0x28,0x23,0x48,0x50,0x02,0x03,0x48,0x02,0x03,0xD8,0x01,0x12,0x0B,
+    0x74,0x00,0xFF,0x27,0x88,0x13,0x88,0x13,0xEA,0x23,0x2C,0x3C,0xCE,0x54,0x71,0x65,0xB6,0x86,0x74,0x76,0x69,0x1B,0xB6,0x8E,0x19,0xA7,0xFE,0xE7,0xFE,0xDF,0xD0,0x6C,
+    0x09,0x2B,0x09,0x33,0x4A,0x3B,0x6B,0x43,0x9B,0xC7,0x59,0xAF,0x6E,0x54,0xBB,0xBF,0x0D,0x4C,0x28,0x23,0xAF,0x54,0xFE,0xDF,0xBC,0xD7,0x80,0x00,0x06,0x01,0x68,0x01,
+    0xB0,0xBC,0xCF,0xF9,0xAE,0x35,0x8E,0x31,0x65,0x2C,0x3C,0x49,0x78,0x00,0x11,0x13,0xF0,0x00,0x01,0xB8,0x02,0x00,0x7C,0x00,0x00,0x04,0x00,0xF0,0x0B,0x68,0x0B,0x69,
+    0x1B,0xEB,0x33,0x6E,0x4C,0x10,0x65,0xB2,0x75,0xCB,0x33,0x55,0x86,0xBB,0xC7,0xFE,0xDF,0xDB,0xBF,0x14,0x7E,0xAD,0x3C,0x64,0x02,0xFF,0x12,0x49,0x23,0xBC,0xCF,0xFE,
+    0xE7,0xB0,0x64,0x09,0x2B,0x4E,0x54,0xB3,0x7D,0x49,0x2B,0xD3,0x75,0x79,0xA7,0x0C,0x3C,0x96,0x8E,0xEB,0x33,0x48,0x1B,0x6E,0x4C,0xDD,0xDF,0xFE,0xED,0x06,0x01,0x01,
+    0xC0,0x03,0xA3,0xDD,0xDF,0x56,0x9E,0x11,0x6D,0x8E,0x54,0xCB,0x33,0xF2,0x00,0x01,0x76,0x00,0x20,0x88,0x03,0x82,0x00,0x12,0x68,0xF2,0x00,0xF1,0x0E,0x0B,0x88,0x0B,
+    0x68,0x0B,0x2B,0x2C,0x54,0x76,0x18,0xA7,0xBC,0xC7,0xDC,0xCF,0xF4,0x8D,0x8A,0x33,0x4E,0x4C,0x98,0xAE,0xDC,0xCF,0xF0,0x64,0x48,0x1B,0x86,0x02,0xF0,0x14,0x0B,0x49,
+    0x1B,0x77,0x9E,0xFE,0xE7,0x52,0x75,0x2A,0x33,0x56,0x9E,0xF8,0xA6,0xEB,0x33,0xCB,0x2B,0x6D,0x44,0x69,0x23,0xEB,0x2B,0x89,0x1B,0x68,0x13,0x4D,0x44,0x9C,0xCF,0xFE,
+    0xDF,0x17,0xFF,0x01,0x00,0xF7,0x03,0xDF,0xF7,0xFF,0xE7,0x11,0x6D,0x28,0x13,0x68,0x0B,0x48,0x13,0xEC,0x3B,0xFD,0xD7,0xFF,0xEF,0x1D,0x00,0x09,0x0B,0x00,0xF9,0x1B,
+    0xDF,0xFF,0x7E,0xFF,0x4D,0xA3,0xC8,0x89,0x72,0xE4,0xDC,0xFE,0xBB,0xFE,0xCF,0xC3,0x4A,0x9A,0xE8,0x81,0x2D,0x9B,0x1C,0xF7,0xFE,0xF7,0xFE,0xE7,0x72,0x7D,0x69,0x1B,
+    0x68,0x13,0x48,0x13,0x6D,0x4C,0x5B,0xCF,0xFF,0xF7,0x37,0x00,0x0F,0x0D,0x00,0x0D,0xDF,0xEF,0xD9,0xB6,0xCB,0x2B,0x88,0x13,0x68,0x13,0xEB,0x33,0x3A,0xBF,0x7E,0x00,
+    0x05,0xFF,0x1F,0xDF,0xFF,0xDF,0xFF,0x9E,0xFF,0x5D,0xFF,0x56,0xF5,0xA7,0x99,0x4A,0xBA,0x0D,0xC3,0xC7,0x91,0xA7,0x99,0x49,0xAA,0x0D,0xBB,0x72,0xD4,0x59,0xEE,0xBE,
+    0xFF,0xFF,0xF7,0xDD,0xD7,0xCF,0x5C,0x48,0x13,0x68,0x13,0x48,0x1B,0xB4,0x85,0xFE,0xE7,0x73,0x00,0x0D,0x07,0x20,0x00,0xFF,0x00,0xF7,0xBD,0xD7,0xD0,0x64,0x68,0x13,
+    0x68,0x0B,0xAA,0x23,0x15,0x8E,0xFE,0xE7,0xBC,0x00,0x03,0xF0,0x10,0xDF,0xFF,0xBF,0xFF,0x5D,0xFF,0x9A,0xFE,0xD4,0xEC,0x8F,0xD3,0x87,0xA9,0x86,0xB1,0x87,0xA9,0x87,
+    0xA9,0x87,0xA1,0xF0,0xEB,0x11,0xD4,0xD0,0xB3,0x92,0xBC,0xBE,0x4F,0x00,0xDF,0xEF,0x5A,0xBF,0xAB,0x33,0x68,0x13,0x68,0x13,0xAB,0x33,0x9B,0xC7,0x46,0x00,0x03,0x00,
+    0x27,0x00,0x07,0x04,0x00,0x20,0xF7,0xFF,0x02,0x00,0x50,0xEF,0xB7,0xA6,0xAA,0x2B,0x38,0x00,0x48,0xAF,0x54,0xDD,0xD7,0x38,0x00,0xF0,0x07,0xDF,0xFF,0x7D,0xFF,0xDB,
+    0xEE,0x9E,0xFF,0xBF,0xFF,0xBE,0xFF,0x5D,0xFF,0xF8,0xF5,0x6E,0xB3,0x8B,0xAA,0xE8,0xA1,0x7E,0x00,0x20,0x66,0xB9,0x02,0x00,0xF1,0x05,0x87,0xA9,0x6B,0xBA,0x11,0xD4,
+    0x56,0xED,0x14,0xD5,0x1C,0xFF,0xDF,0xFF,0xFF,0xF7,0xFF,0xEF,0xD8,0xA6,0x84,0x01,0x40,0x1B,0x10,0x65,0xFF,0xC8,0x00,0x00,0x5E,0x00,0x07,0x6F,0x00,0x09,0x0B,0x00,
+    0xF8,0x06,0xEF,0xFF,0xEF,0xFF,0xE7,0xFE,0xE7,0xFE,0xDF,0xFD,0xCF,0x92,0x6D,0x48,0x13,0x68,0x0B,0x69,0x1B,0x97,0xA6,0x7C,0x01,0x00,0x6E,0x01,0xF1,0x00,0x14,0xCD,
+    0x09,0x7A,0xB7,0xED,0x3D,0xFF,0x15,0xDD,0x4A,0xA2,0x87,0x99,0x87,0x7C,0x00,0x20,0x86,0xB1,0x7C,0x00,0x01,0x04,0x00,0xC0,0xB1,0x29,0xBA,0xF1,0xDB,0x8A,0x92,0xEC,
+    0x92,0xD7,0xE5,0xDF,0x5D,0x00,0x50,0xF7,0xFE,0xE7,0x4D,0x44,0x84,0x01,0xB0,0x68,0x1B,0xDC,0xBF,0xFE,0xDF,0xFE,0xE7,0xFE,0xE7,0xFF,0x68,0x00,0x11,0xEF,0xE8,0x00,
+    0x09,0x8E,0x00,0xE0,0x15,0x8E,0x93,0x7D,0xF0,0x64,0x6E,0x54,0x0C,0x44,0xCA,0x2B,0x89,0x1B,0x7A,0x02,0x2A,0x0C,0x3C,0x7C,0x01,0xF7,0x01,0xDF,0xFF,0xDB,0xFE,0x2D,
+    0xAB,0xE8,0x89,0xB8,0xFD,0x7A,0xFE,0x4A,0x9A,0x87,0xA1,0x78,0x00,0x01,0xFE,0x00,0x00,0x82,0x00,0xA1,0x87,0xB1,0xEC,0xC2,0xD4,0xF4,0x35,0xF5,0x10,0xB4,0x82,0x01,
+    0xF2,0x16,0xFF,0xFF,0xEF,0xF8,0xA6,0x49,0x1B,0x68,0x13,0x88,0x13,0xAA,0x23,0xEC,0x3B,0x2D,0x4C,0xB0,0x5C,0x52,0x75,0xD4,0x8D,0x77,0x9E,0xB8,0xAE,0xD9,0xB6,0xF9,
+    0xBE,0x3A,0xC7,0x9C,0xD7,0xDD,0xDF,0x94,0x00,0x00,0x70,0x01,0x02,0x04,0x00,0x99,0x88,0x0B,0x88,0x03,0x68,0x0B,0x28,0x1B,0xD8,0xFE,0x00,0xEF,0xFF,0xFF,0xBF,0xFF,
+    0x56,0xF5,0xC8,0x91,0xC8,0xA1,0x4E,0xDB,0xAF,0xE3,0x7E,0x00,0x03,0xC3,0x66,0xB9,0x87,0xB9,0x6A,0xCA,0x6A,0xB2,0xC8,0x89,0xEC,0x92,0x80,0x00,0xD2,0xF7,0x9B,0xCF,
+    0x6D,0x4C,0x68,0x13,0x88,0x03,0x88,0x0B,0x68,0x0B,0x60,0x00,0xF0,0x09,0x48,0x13,0x48,0x13,0x48,0x1B,0x69,0x1B,0x89,0x23,0x0C,0x34,0x8E,0x4C,0x30,0x5D,0x92,0x6D,
+    0xB3,0x75,0xD4,0x7D,0x88,0x03,0x02,0x00,0x22,0xA8,0x03,0x02,0x00,0xB0,0x68,0x0B,0x6A,0x2B,0xFE,0xDF,0xFF,0xF7,0xDF,0xFF,0xBE,0xCA,0x01,0x10,0xFF,0xEC,0x02,0xD6,
+    0x7E,0xFF,0xEC,0xA2,0xC8,0x99,0x29,0xA2,0xA7,0x99,0x87,0xA9,0x66,0x74,0x01,0x05,0xFC,0x00,0xF0,0x00,0x66,0xB9,0x66,0xB1,0x86,0xB1,0x86,0xB1,0xA7,0xA9,0xF0,0xD3,
+    0x59,0xFE,0xBF,0x80,0x01,0x70,0xFF,0xFF,0xF7,0xFE,0xE7,0x93,0x7D,0x80,0x00,0x02,0x58,0x00,0x13,0xA8,0x66,0x00,0x00,0x6C,0x00,0x03,0x94,0x00,0x10,0x0B,0xA4,0x03,
+    0x22,0x48,0x1B,0x12,0x00,0x04,0x26,0x00,0xE0,0x68,0x13,0x8F,0x5C,0xFF,0xE7,0xFF,0xFF,0x7E,0xFF,0x96,0xDD,0xFC,0xFE,0x84,0x00,0xCF,0xDF,0xFF,0xBA,0xF6,0xE8,0x79,
+    0x8F,0xBB,0x9B,0xFE,0x35,0xF5,0xFE,0x00,0x01,0x23,0x86,0xB9,0x04,0x03,0x74,0xB1,0xA7,0xA1,0xF8,0xFD,0x7E,0xFF,0x80,0x00,0x73,0xFF,0xEF,0x15,0x96,0x89,0x1B,0x88,
+    0xD8,0x00,0x02,0x60,0x00,0x02,0x0E,0x00,0x00,0x06,0x00,0x02,0x76,0x00,0x00,0x8A,0x00,0x73,0x89,0x1B,0xEA,0x23,0x2B,0x2C,0xA9,0x2A,0x00,0xF0,0x11,0x68,0x13,0x77,
+    0x9E,0xFF,0xEF,0xDF,0xFF,0x38,0xDE,0xAB,0x8A,0xAB,0x8A,0x9A,0xF6,0xBE,0xFF,0xBE,0xFF,0x3D,0xFF,0xAF,0xAB,0xB7,0xF5,0x5D,0xFF,0x96,0xF5,0x87,0xA1,0xEC,0x01,0x15,
+    0x86,0xFA,0x00,0x00,0x0A,0x00,0x00,0x7E,0x00,0x40,0xEC,0xC2,0xD4,0xFC,0x86,0x03,0x71,0x31,0xDC,0x18,0xFE,0xDB,0xFE,0x9E,0x3A,0x01,0x60,0xFF,0xF7,0xF9,0xB6,0x0B,
+    0x34,0x6C,0x00,0x04,0x7C,0x00,0x11,0x88,0x88,0x01,0x00,0xE6,0x01,0x06,0x16,0x00,0xC0,0xA8,0x03,0x14,0x8E,0x18,0xA7,0x9A,0xB7,0xCF,0x54,0x88,0x0B,0x24,0x01,0x40,
+    0x48,0x13,0xF9,0xB6,0x7A,0x03,0xF2,0x07,0x3C,0xFF,0xCF,0xB3,0xE8,0x81,0xEB,0xA2,0x59,0xFE,0x9E,0xFF,0x9E,0xFF,0x7E,0xFF,0x7E,0xFF,0x7D,0xFF,0x93,0xDC,0x80,0x00,
+    0x00,0x84,0x00,0x04,0x04,0x00,0x02,0x7E,0x00,0x50,0x9A,0xFE,0xF8,0xFD,0xA7,0x0C,0x04,0x81,0xA1,0xC8,0x99,0xEC,0xB2,0x96,0xED,0x7D,0x82,0x00,0x40,0x9C,0xD7,0x6D,
+    0x44,0x56,0x00,0x03,0x80,0x00,0xB2,0x0B,0xEA,0x23,0x10,0x65,0x71,0x6D,0x6C,0x3C,0x88,0x13,0x80,0x00,0x20,0x88,0x03,0x82,0x01,0xA0,0x6F,0x64,0x35,0x96,0xFE,0xD7,
+    0x31,0x65,0x88,0x13,0x80,0x00,0x40,0x69,0x1B,0x3A,0xBF,0x80,0x00,0xF4,0x09,0xBE,0xFF,0xBB,0xFE,0x0C,0xAB,0xC7,0x89,0x6E,0xC3,0x18,0xFE,0xD4,0xD4,0xF0,0xBB,0x55,
+    0xED,0x7A,0xFE,0x0D,0xBB,0x87,0xA9,0x78,0x00,0x00,0x08,0x00,0x01,0xFE,0x00,0x90,0xA9,0xC7,0xA1,0x15,0xF5,0x1C,0xFF,0x4E,0xB3,0x94,0x03,0xF4,0x03,0x87,0xA1,0xA7,
+    0xA1,0x87,0x99,0x8A,0xA2,0x79,0xF6,0xDE,0xFF,0xFF,0xFF,0xDD,0xDF,0x8E,0x4C,0x80,0x00,0x00,0x6C,0x00,0xA0,0xCF,0x54,0xFD,0xD7,0xFE,0xDF,0xB7,0x96,0x68,0x1B,0x16,
+    0x00,0xF2,0x01,0x88,0x03,0xCA,0x13,0xF2,0x65,0x54,0x7E,0x29,0x23,0xCB,0x33,0xB7,0x9E,0x71,0x6D,0x80,0x00,0x31,0x89,0x23,0x5B,0xB2,0x04,0x00,0x80,0x02,0xC0,0xBB,
+    0xFE,0x29,0xA2,0xA7,0xA9,0xE8,0xA9,0xA7,0xA1,0x87,0xA1,0x08,0x00,0x02,0x7E,0x02,0x00,0x76,0x00,0x00,0x7E,0x00,0x00,0x04,0x00,0xF0,0x0B,0x86,0xB1,0x87,0xA1,0xCB,
+    0xB2,0x39,0xFE,0xBB,0xFE,0xE8,0x91,0xA7,0xA1,0x29,0xB2,0xD4,0xF4,0xAB,0xAA,0xA7,0xA1,0xA7,0x99,0xB3,0xCC,0x06,0x03,0x64,0xFE,0xDF,0x8E,0x4C,0x68,0x0B,0xFE,0x00,
+    0xC2,0xAA,0x2B,0x18,0xAF,0xFD,0xDF,0xFE,0xE7,0xDC,0xC7,0x49,0x23,0x80,0x00,0xD3,0xEA,0x1B,0x75,0x86,0xDC,0xC7,0x69,0x23,0x68,0x1B,0xB2,0x6D,0x91,0x00,0x01,0x06,
+    0x80,0x00,0x60,0x9E,0xFF,0xD7,0xFD,0xC8,0xA1,0xD8,0x02,0x00,0xE0,0x02,0x01,0xF8,0x02,0x06,0xFC,0x02,0x00,0xF0,0x02,0xF2,0x12,0xA9,0x86,0xA1,0xC8,0xA9,0x4A,0xA2,
+    0x51,0xC4,0xDC,0xFE,0x56,0xF5,0xA7,0x89,0xA7,0xA1,0x93,0xFC,0xFC,0xFE,0x7A,0xFE,0x87,0xA1,0xA7,0x99,0xF0,0xBB,0x9E,0xFF,0xFF,0xFF,0x80,0x00,0x02,0x6A,0x02,0xF0,
+    0x01,0x68,0x13,0x8E,0x54,0xFD,0xD7,0x12,0x85,0x3A,0xC7,0xFE,0xDF,0x2D,0x4C,0x68,0x13,0x96,0x00,0xE1,0x88,0x13,0x29,0x1B,0xB3,0x85,0x49,0x23,0x68,0x13,0xEA,0x23,
+    0x2B,0x24,0x12,0x00,0x16,0x03,0x80,0x01,0x5F,0xF8,0xFD,0x08,0x9A,0x86,0x70,0x03,0x02,0x00,0xF4,0x01,0xA0,0xA7,0xA1,0x49,0xA2,0x4E,0xBB,0xB3,0xD4,0x39,0xF6,0x1C,
+    0x02,0x20,0xF8,0xFD,0x80,0x00,0xC0,0x4E,0xDB,0x97,0xFD,0xB3,0xFC,0x87,0xA9,0xA7,0x99,0x71,0xC4,0x80,0x00,0x00,0x80,0x01,0x21,0x68,0x0B,0x80,0x00,0xF0,0x01,0x0B,
+    0x69,0x1B,0x39,0xB7,0xF9,0xB6,0x8C,0x4B,0xF9,0xB6,0xFE,0xDF,0x93,0x7D,0x48,0x18,0x04,0xB0,0x03,0x88,0x0B,0x28,0x1B,0x35,0x8E,0x69,0x23,0x68,0x0B,0x94,0x02,0x00,
+    0x80,0x00,0x42,0xA8,0x03,0x48,0x1B,0x80,0x02,0x61,0x5D,0xFF,0x4D,0xBB,0x87,0xA1,0xF6,0x00,0x00,0xEE,0x02,0x16,0xB1,0xF4,0x04,0xD1,0x87,0xB1,0x87,0xA1,0xCC,0xBA,
+    0xB3,0xE4,0xD7,0xF5,0x1C,0xFF,0x9E,0x26,0x04,0x00,0x22,0x03,0xF0,0x01,0x6A,0x92,0xA7,0x99,0xA7,0xA1,0x6A,0xB2,0xE8,0xA1,0x87,0x99,0xE8,0x99,0xD7,0xED,0x80,0x01,
+    0x40,0x9C,0xD7,0x4D,0x44,0x80,0x01,0xF0,0x0F,0x88,0x0B,0x48,0x13,0xEF,0x54,0xFE,0xD7,0xD5,0x95,0x0A,0x33,0xB4,0x8D,0xFE,0xE7,0x97,0xA6,0x69,0x1B,0x88,0x03,0x88,
+    0x03,0x88,0x0B,0x28,0x1B,0x96,0x96,0x1F,0xFF,0x01,0x00,0x4E,0xFF,0x0F,0xDA,0xDE,0x4D,0x73,0xEF,0x83,0x5C,0xF7,0xDA,0xE6,0x13,0xAD,0x0B,0x6B,0xAA,0x5A,0x89,0x5A,
+    0x91,0x94,0x9E,0xFF,0xFF,0xFF,0xDE,0xFF,0x95,0xBD,0x89,0x5A,0x7F,0x00,0x4E,0xFF,0x0F,0xFF,0xBA,0xDE,0xEF,0x83,0xEB,0x62,0x69,0x52,0xCA,0x62,0xF3,0xA4,0x38,0xCE,
+    0x5C,0xEF,0x91,0x94,0x38,0xCE,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0x75,0xB5,0xAA,0x80,0x00,0x50,0xF5,0x00,0xFF,0xFF,0x7D,0xF7,0xD7,0xBD,0x54,0xAD,0x0F,0x84,0xAA,0x5A,
+    0xEF,0x83,0xDE,0xF1,0x00,0x65,0xDF,0xFF,0x54,0xB5,0xCA,0x62,0x0F,0x00,0x0F,0x09,0x00,0x4C,0x86,0xDF,0xFF,0x7D,0xEF,0xDA,0xDE,0x3C,0xEF,0x67,0x00,0x66,0xDE,0xFF,
+    0x13,0xA5,0x0B,0x6B,0x10,0x00,0x0F,0x0A,0x00,0x5D,0xC5,0xBE,0xF7,0xD3,0xA4,0x0B,0x6B,0xFF,0xEF,0xFF,0xEF,0xFF,0xF7,0x02,0x00,0x0F,0x85,0x00,0x58,0xF3,0x01,0xBE,
+    0xFF,0x34,0xAD,0xAA,0x5A,0x76,0x96,0x19,0xB7,0xBC,0xCF,0xFE,0xDF,0xFE,0xE7,0x88,0x00,0x0F,0x82,0x00,0x58,0xF0,0x08,0x3C,0xEF,0x96,0xB5,0xAA,0x23,0xEB,0x33,0x2D,
+    0x44,0x4D,0x4C,0x8F,0x5C,0x52,0x75,0x36,0x96,0x3A,0xBF,0xDD,0xDF,0xFF,0x8A,0x00,0x04,0x14,0x01,0x0F,0x8E,0x00,0x4E,0xF0,0x0B,0x88,0x0B,0x88,0x0B,0x88,0x13,0x68,
+    0x0B,0x68,0x13,0x68,0x13,0x48,0x13,0x49,0x1B,0x69,0x23,0xEC,0x33,0xEF,0x5C,0xF4,0x85,0x7A,0xB7,0x14,0x01,0x32,0xFE,0xEF,0xFE,0x8A,0x00,0x0F,0x88,0x00,0x46,0x28,
+    0xA8,0x03,0x02,0x00,0x40,0x88,0x03,0x88,0x03,0x8C,0x00,0xF1,0x03,0x48,0x1B,0x29,0x1B,0x6A,0x2B,0xEC,0x43,0xD0,0x64,0x56,0x9E,0x19,0xBF,0x3A,0xC7,0x9C,0xD7,0xA0,
+    0x01,0x02,0x8C,0x00,0x1F,0xF7,0x8D,0x00,0x39,0x10,0x68,0x00,0x01,0x07,0x84,0x00,0x00,0x82,0x00,0x50,0x88,0x03,0x88,0x0B,0x68,0x02,0x00,0x01,0x14,0x01,0xE1,0x89,
+    0x23,0xAB,0x2B,0x8E,0x4C,0xD3,0x7D,0x15,0x8E,0x56,0x9E,0xBC,0xCF,0x88,0x00,0x00,0xB0,0x02,0x0F,0x85,0x00,0x34,0xC2,0xCF,0x54,0x69,0x23,0x69,0x1B,0x68,0x13,0x88,
+    0x0B,0x68,0x03,0x8A,0x01,0x43,0x88,0x0B,0xA8,0x0B,0x86,0x00,0x11,0x03,0x08,0x00,0x30,0x0B,0x88,0x0B,0x9C,0x01,0xD6,0x69,0x1B,0x8A,0x23,0x6D,0x4C,0xAF,0x5C,0xB0,
+    0x64,0x5B,0xC7,0xFD,0xB0,0x02,0x0F,0x0E,0x01,0x2C,0xF0,0x04,0xFD,0xD7,0xBC,0xCF,0xF8,0xA6,0x0C,0x3C,0x68,0x13,0xCA,0x23,0x0C,0x3C,0xAA,0x33,0x69,0x23,0x49,0x8E,
+    0x00,0x11,0x13,0x18,0x02,0x23,0x03,0x88,0x1A,0x01,0x04,0x88,0x00,0x20,0x88,0x13,0x28,0x02,0xA0,0xAA,0x23,0x8A,0x23,0xEB,0x3B,0x35,0x8E,0x9B,0xC7,0x24,0x02,0x01,
+    0x38,0x03,0x0F,0x0E,0x01,0x26,0xF0,0x12,0xFE,0xE7,0xBD,0xE7,0xFE,0xDF,0x31,0x75,0x48,0x1B,0x71,0x5D,0xBB,0xB7,0xFE,0xD7,0xFD,0xCF,0x18,0x97,0x0F,0x55,0x0B,0x2C,
+    0x6C,0x3C,0xEA,0x2B,0xCA,0x23,0x89,0x1B,0x68,0x9C,0x02,0x09,0xA4,0x01,0x02,0x8C,0x00,0x00,0x12,0x01,0xB0,0x28,0x1B,0x6A,0x2B,0x52,0x75,0x97,0xA6,0x5B,0xC7,0xDD,
+    0x10,0x01,0x00,0x96,0x01,0x0F,0x0E,0x01,0x1E,0xF4,0x1B,0xFE,0xDF,0x12,0x8D,0xFE,0xE7,0xB8,0xAE,0xAA,0x2B,0x28,0x1B,0x2D,0x4C,0x9B,0xBF,0x39,0xAF,0x92,0x6D,0x50,
+    0x55,0x0F,0x55,0x59,0xAF,0x9A,0xBF,0x97,0x9E,0xF4,0x85,0x31,0x6D,0xAF,0x54,0x0B,0x34,0x69,0x1B,0x88,0x0B,0x0C,0x01,0x00,0xB0,0x02,0x03,0x84,0x00,0x02,0x36,0x03,
+    0xB3,0x1B,0xAA,0x2B,0xEF,0x54,0xD3,0x7D,0x97,0x9E,0x5B,0xC7,0x1E,0x02,0x0F,0x0E,0x01,0x18,0xF8,0x1D,0xFE,0xD7,0x6C,0x4B,0xFA,0xC6,0xFE,0xDF,0x6D,0x4C,0x28,0x1B,
+    0x6E,0x5C,0xFD,0xCF,0x72,0x6D,0x28,0x23,0x48,0x1B,0x89,0x23,0x8F,0x64,0xFE,0xDF,0xFD,0xD7,0x15,0x96,0x35,0x8E,0x59,0xA7,0x39,0xA7,0x34,0x7E,0x2C,0x34,0x68,0x13,
+    0x82,0x00,0x00,0x86,0x00,0x12,0xA8,0x20,0x02,0x02,0x38,0x02,0x95,0x13,0xAA,0x23,0x4D,0x44,0xF0,0x64,0xB4,0x85,0x86,0x00,0x0F,0x0C,0x01,0x0D,0x50,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xB1,0xDA,0xE6,0xAA,0x5A,0x68,0x5A,0x48,0x52,0x68,0x5A,0x48,0x02,0x00,0xC2,0x8D,0x7B,0x9E,0xFF,0x54,0xB5,0x70,0x94,0x95,0xBD,0xAA,0x62,0x12,0x00,0x00,
+    0x1E,0x00,0xF1,0x00,0xAA,0x62,0xF7,0xC5,0xFF,0xFF,0xDE,0xFF,0xF3,0xA4,0x50,0x94,0xD2,0xA4,0x89,0x30,0x00,0x03,0x32,0x00,0x6D,0x52,0xEF,0x8B,0x5C,0xEF,0xFF,0x01,
+    0x00,0x53,0xFB,0xE6,0x89,0x5A,0x68,0x02,0x00,0xE2,0x48,0x5A,0x89,0x5A,0x95,0xBD,0x9D,0xFF,0xEB,0x62,0x13,0xAD,0xEF,0x8B,0x6C,0x00,0x00,0x1C,0x00,0xF4,0x01,0x48,
+    0x52,0xCE,0x83,0x7D,0xF7,0xDF,0xFF,0x3C,0xEF,0x0B,0x6B,0x75,0xB5,0xAD,0x7B,0x70,0x00,0x00,0x1C,0x00,0x4D,0xAA,0x62,0xD6,0xC5,0x55,0x00,0x90,0xFF,0xFF,0xFF,0x1B,
+    0xEF,0x68,0x52,0x68,0x52,0x22,0x00,0xF0,0x03,0x48,0x5A,0x68,0x5A,0x0B,0x6B,0xB9,0xDE,0xD6,0xBD,0x2B,0x6B,0xB5,0xBD,0x0B,0x6B,0x48,0x52,0x12,0x00,0x00,0x44,0x00,
+    0xD0,0x68,0x5A,0x54,0xB5,0xDF,0xFF,0xDF,0xFF,0x30,0x8C,0xEF,0x83,0xF3,0xAE,0x00,0x10,0x5A,0x1A,0x00,0x00,0x34,0x00,0x5F,0x68,0x5A,0xEF,0x83,0x5D,0xAE,0x00,0x00,
+    0x32,0xFF,0xFF,0x3B,0x58,0x00,0x00,0x08,0x01,0xD0,0x52,0x68,0x5A,0x70,0x94,0x7D,0xF7,0x6C,0x73,0x50,0x94,0x54,0xB5,0x36,0x00,0x00,0x3E,0x00,0xF0,0x01,0x48,0x5A,
+    0x48,0x52,0xCA,0x62,0x5C,0xF7,0xDF,0xFF,0x99,0xD6,0xCA,0x5A,0xD6,0xC5,0x70,0x00,0x03,0x02,0x01,0x10,0x5A,0xE0,0x00,0x2F,0x17,0xCE,0xAE,0x00,0x01,0xA0,0xFF,0xFF,
+    0xDA,0xE6,0x38,0xD6,0xCE,0x83,0x89,0x5A,0xB6,0x00,0xC4,0x89,0x5A,0x54,0xB5,0x79,0xDE,0xA9,0x5A,0x58,0xD6,0x4C,0x73,0x58,0x00,0xF0,0x01,0x68,0x5A,0x68,0x52,0x8D,
+    0x7B,0x3C,0xEF,0x7D,0xF7,0xAE,0x7B,0xB6,0xC5,0x0B,0x6B,0x18,0x00,0x04,0x58,0x00,0x00,0x1A,0x00,0x0F,0x56,0x00,0x03,0xF4,0x09,0xFF,0xFF,0x69,0x52,0xEF,0x83,0xF7,
+    0xC5,0x17,0xC6,0xB1,0x9C,0xAD,0x7B,0xEE,0x83,0x1C,0xEF,0x71,0x94,0x8D,0x7B,0x38,0xD6,0x3E,0x00,0x01,0x08,0x00,0x90,0x52,0x68,0x52,0x89,0x5A,0xEB,0x6A,0xEA,0x62,
+    0xC2,0x01,0x00,0xC4,0x00,0x00,0x16,0x00,0x00,0x20,0x01,0x4F,0xEB,0x62,0x9D,0xF7,0x58,0x00,0x05,0xF5,0x07,0xB2,0x9C,0x0B,0x6B,0x69,0x52,0x8D,0x73,0x1B,0xE7,0x9D,
+    0xF7,0x9A,0xD6,0xFB,0xE6,0x8D,0x73,0x38,0xCE,0xEF,0x8B,0x92,0x00,0x01,0xD2,0x01,0x00,0x44,0x00,0x08,0x04,0x00,0x01,0x58,0x00,0x6F,0x52,0x89,0x5A,0xB6,0xBD,0xDE,
+    0x57,0x00,0x05,0xF0,0x0A,0xFF,0xBE,0xFF,0xDA,0xDE,0xD6,0xBD,0xF3,0xA4,0x5C,0xEF,0xDF,0xFF,0xDE,0xFF,0x95,0xB5,0x6D,0x73,0x5C,0xF7,0xCE,0x83,0x68,0x52,0xB6,0x01,
+    0x04,0x9C,0x00,0x00,0x48,0x00,0x00,0x04,0x00,0x00,0x10,0x00,0x03,0x60,0x00,0x5F,0x52,0x68,0x52,0x91,0x9C,0xAE,0x00,0x07,0x02,0x6F,0x00,0x22,0xDE,0xFF,0x78,0x00,
+    0xF0,0x03,0x9D,0xF7,0x91,0x94,0x89,0x5A,0xEF,0x83,0x79,0xD6,0xDA,0xE6,0x0F,0x8C,0x69,0x52,0x68,0x52,0xB6,0x01,0x04,0x52,0x00,0x02,0x08,0x00,0x04,0x58,0x00,0x42,
+    0xCE,0x83,0x3B,0xE7,0x3E,0x00,0x0F,0x06,0x00,0x0F,0xF0,0x05,0xBE,0xF7,0xB6,0xB5,0x8E,0x7B,0xEB,0x62,0x89,0x52,0xAD,0x7B,0xF6,0xC5,0x17,0xCE,0x91,0x9C,0x2C,0x73,
+    0x04,0x03,0x00,0x4C,0x00,0x04,0x1A,0x01,0x00,0x0C,0x00,0x62,0x48,0x52,0xAE,0x7B,0xFB,0xE6,0x8C,0x00,0x0F,0x56,0x00,0x0F,0x02,0x22,0x00,0xF1,0x07,0x9E,0xF7,0x38,
+    0xCE,0xB2,0x9C,0x6D,0x73,0x68,0x52,0x0B,0x6B,0x33,0xAD,0x54,0xB5,0x13,0xAD,0x71,0x9C,0x2C,0x73,0x18,0x01,0x02,0xBE,0x00,0x6F,0x52,0xEB,0x62,0x71,0x94,0x3C,0xB4,
+    0x02,0x02,0x02,0x42,0x00,0x0F,0x06,0x00,0x07,0xF0,0x07,0xDE,0xFF,0xDB,0xE6,0xF6,0xC5,0x6D,0x73,0x89,0x5A,0xCA,0x62,0xCE,0x83,0xEF,0x83,0xD2,0xA4,0xB6,0xBD,0xD6,
+    0xC5,0x64,0x00,0x9F,0x91,0x9C,0x95,0xBD,0x99,0xD6,0xBE,0xFF,0xDF,0x3D,0x00,0x07,0x0F,0x1A,0x00,0x0E,0xA0,0x9D,0xF7,0x5C,0xEF,0x75,0xB5,0x2C,0x6B,0xAA,0x5A,0x60,
+    0x00,0x6F,0xCA,0x62,0x2C,0x6B,0x92,0x9C,0x52,0x00,0x2B,0x08,0x73,0x00,0x00,0x26,0x02,0x4F,0xBE,0xFF,0x3C,0xEF,0x52,0x00,0x37,0x08,0x5E,0x00,0x0F,0x0C,0x00,0x72,
+    0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xFF,0x01,0x00,0x0C,0xFF,0x10,0x3C,0xEF,0x69,0x52,0xAA,0x5A,0x71,0x94,0xDA,0xE6,0x1B,0xEF,0x37,0xCE,0x13,0xAD,0x54,0xB5,0x99,
+    0xDE,0xFB,0xE6,0xB6,0xBD,0x4C,0x73,0x89,0x5A,0x75,0xB5,0xDE,0x3E,0x00,0x0C,0x0F,0x1F,0x00,0x31,0xFF,0x0B,0x5C,0xEF,0x2C,0x6B,0x69,0x52,0x69,0x52,0x0F,0x8C,0xD6,
+    0xC5,0x79,0xD6,0x37,0xCE,0xB1,0x9C,0xCA,0x62,0x89,0x5A,0xEB,0x62,0xF7,0xC5,0x7E,0x00,0x51,0x00,0xC2,0x00,0x60,0x1B,0xE7,0x92,0x9C,0x4C,0x73,0x84,0x00,0xCF,0x69,
+    0x52,0x68,0x52,0x89,0x5A,0x6D,0x73,0xB2,0x9C,0xDB,0xE6,0x7E,0x00,0x55,0x00,0x82,0x00,0xF0,0x02,0x9E,0xF7,0x9A,0xDE,0x75,0xB5,0xF3,0xAC,0xF3,0xA4,0x33,0xAD,0x96,
+    0xBD,0xFB,0xE6,0xBE,0x15,0x00,0x0F,0x04,0x00,0x2D,0x5F,0xF7,0xFF,0xF7,0xFF,0xEF,0x45,0x00,0x19,0x4F,0xBE,0xFF,0xBE,0xFF,0xF6,0x00,0x35,0x8F,0xFE,0xEF,0xFE,0xE7,
+    0x7B,0xBF,0xF0,0x64,0x80,0x00,0x19,0x0F,0x2C,0x00,0x30,0x00,0xF4,0x00,0xDF,0xF7,0xFF,0xEF,0xFD,0xDF,0x5A,0xBF,0x8A,0x3B,0x28,0x1B,0x69,0x1B,0x54,0x00,0x30,0x0F,
+    0x43,0x00,0x17,0xFF,0x04,0xF7,0xFF,0xEF,0xBC,0xD7,0xD8,0xAE,0xF3,0x7D,0x89,0x2B,0x48,0x13,0x68,0x13,0x88,0x0B,0x88,0x0B,0x3D,0x00,0x17,0x0F,0x2A,0x00,0x2A,0xFF,
+    0x0A,0xF7,0xFF,0xEF,0xFE,0xE7,0x5A,0xC7,0xD4,0x8D,0xCF,0x5C,0xAA,0x2B,0x68,0x13,0x68,0x0B,0x88,0x03,0x88,0x03,0xA8,0x03,0xA8,0x03,0x56,0x00,0x2A,0x0F,0x3D,0x00,
+    0x13,0x00,0x7C,0x00,0x94,0xDF,0xF9,0xAE,0x10,0x65,0x0B,0x34,0x69,0x1B,0x7C,0x00,0x00,0x7E,0x00,0x00,0x84,0x00,0x0F,0x43,0x00,0x13,0x0F,0x26,0x00,0x24,0x00,0xEE,
+    0x01,0x91,0xEF,0xFE,0xE7,0xD8,0xAE,0xCC,0x3B,0x48,0x1B,0x70,0x01,0x01,0xF6,0x00,0x60,0x88,0x0B,0x68,0x0B,0x68,0x13,0x02,0x00,0x2F,0x88,0x13,0x5A,0x00,0x24,0x0F,
+    0x37,0x00,0x13,0x82,0xEF,0x3B,0xC7,0x56,0x96,0x0C,0x3C,0x49,0xF6,0x00,0x03,0x74,0x01,0xEF,0x88,0x0B,0x68,0x13,0xAA,0x23,0x2D,0x44,0x52,0x6D,0x15,0x86,0xCB,0x33,
+    0x49,0x00,0x13,0x0F,0x26,0x00,0x23,0x70,0x9E,0xE7,0x90,0x6C,0x09,0x2B,0x28,0xFA,0x00,0x10,0x03,0x6C,0x01,0x00,0xF0,0x01,0xFF,0x01,0xA8,0x03,0xC9,0x13,0x50,0x55,
+    0x76,0x8E,0xFD,0xD7,0xFE,0xE7,0xFE,0xDF,0x56,0x96,0x5A,0x00,0x23,0x0F,0x36,0x00,0x13,0xA0,0xDF,0xF7,0x1B,0xCF,0xD5,0x95,0xEC,0x43,0x48,0x1B,0x70,0x02,0x02,0x7E,
+    0x00,0xFF,0x01,0x88,0x03,0xEA,0x1B,0xF2,0x65,0xD3,0x7D,0xFE,0xE7,0x9C,0xDF,0x7C,0xD7,0xFE,0xDF,0x4A,0x00,0x13,0x0F,0x26,0x00,0x26,0x78,0xF7,0xFE,0xE7,0xDD,0xD7,
+    0xF4,0x7D,0x82,0x01,0x00,0x80,0x01,0x9F,0x49,0x23,0xD8,0xB6,0x5B,0xCF,0xF6,0xA5,0xDD,0x80,0x00,0x4D,0x41,0xFF,0xFF,0xF7,0xFF,0x84,0x00,0x40,0x93,0x7D,0xCB,0x33,
+    0xFC,0x02,0x00,0x06,0x01,0xCF,0x88,0x0B,0x68,0x1B,0xAF,0x5C,0xFE,0xDF,0x32,0x7D,0xB4,0x95,0xDA,0x00,0x26,0x0F,0x39,0x00,0x1B,0x91,0xF7,0xFF,0xE7,0x3A,0xBF,0x72,
+    0x75,0xCB,0x2B,0x06,0x03,0xB0,0x0B,0x68,0x13,0x8A,0x2B,0x7A,0xB7,0xD8,0xA6,0x8B,0x43,0x18,0xFF,0x01,0x00,0xF0,0x05,0xF7,0xFF,0xF7,0xFF,0xEF,0xFE,0xDF,0xD8,0xA6,
+    0x8E,0x54,0xCB,0x33,0xAA,0x23,0x69,0x13,0x68,0x0B,0x88,0x02,0x00,0x40,0x03,0xA8,0x03,0x88,0x02,0x00,0xF0,0x1E,0x0B,0x68,0x0B,0x68,0x13,0x48,0x1B,0x49,0x23,0xEC,
+    0x3B,0x31,0x6D,0x6D,0x4C,0x48,0x1B,0x48,0x13,0xCA,0x1B,0xAD,0x44,0x2D,0x4C,0xFE,0xDF,0xDD,0xCF,0x6F,0x5C,0x09,0x2B,0x4D,0x4C,0xFC,0xCF,0x72,0x75,0x69,0x1B,0x88,
+    0x0B,0xA8,0x03,0x02,0x00,0xF0,0x01,0x68,0x13,0xB0,0x64,0xFE,0xE7,0xDD,0xD7,0x7B,0xCF,0xFE,0xDF,0xBB,0xC7,0x8D,0x44,0x3C,0x00,0x40,0x69,0x23,0x68,0x13,0x56,0x00,
+    0x90,0x4C,0x3C,0x5B,0xC7,0xFE,0xE7,0xFF,0xFF,0xFF,0x76,0x00,0x00,0x78,0x00,0xC0,0xE7,0xBD,0xD7,0x19,0xB7,0x11,0x6D,0x29,0x23,0x48,0x1B,0x68,0x7A,0x00,0x01,0x42,
+    0x00,0x00,0x46,0x00,0x00,0x04,0x00,0xF0,0x08,0x88,0x0B,0xA9,0x13,0xAA,0x23,0xEB,0x33,0x0F,0x5D,0xD7,0x96,0xFC,0xC7,0xFC,0xC7,0xFD,0xD7,0xFE,0xDF,0x18,0x9F,0x69,
+    0x2A,0x00,0xF3,0x05,0x13,0x08,0x23,0xBC,0xC7,0xFE,0xE7,0xB0,0x6C,0x4A,0x3B,0xFD,0xCF,0xB8,0xA6,0x8A,0x3B,0x48,0x13,0x88,0x3C,0x00,0xF0,0x13,0x68,0x13,0x4E,0x54,
+    0xFE,0xE7,0x7B,0xCF,0x0D,0x5C,0xF1,0x74,0xFC,0xC7,0xCE,0x54,0x49,0x23,0xFC,0xBF,0xAE,0x4C,0x68,0x0B,0x88,0x03,0x68,0x0B,0xCA,0x2B,0xB8,0xAE,0xFE,0xE7,0x7E,0x00,
+    0xB0,0xFE,0xE7,0x5B,0xBF,0xB7,0x9E,0x92,0x6D,0x0C,0x3C,0x49,0x50,0x00,0x01,0xF2,0x00,0x04,0x42,0x00,0x00,0x7C,0x00,0x00,0xFE,0x00,0xF0,0x09,0x0B,0x2C,0x13,0x76,
+    0x39,0xAF,0xFD,0xD7,0xDC,0xC7,0xD3,0x7D,0x8E,0x4C,0xEB,0x3B,0x32,0x75,0xFD,0xCF,0xFD,0xCF,0x2C,0x44,0xCC,0x00,0xF2,0x05,0x49,0x1B,0x35,0x8E,0xFF,0xE7,0x95,0x9D,
+    0x3B,0xCF,0xFE,0xE7,0xFD,0xDF,0xB4,0x8D,0x8A,0x2B,0x68,0x13,0x38,0x00,0xF0,0x07,0x68,0x13,0x4D,0x4C,0xFE,0xD7,0xDC,0xCF,0x2A,0x3B,0x8A,0x33,0x55,0x86,0x8D,0x44,
+    0xAA,0x33,0xFD,0xCF,0x72,0x6D,0x34,0x00,0xF1,0x04,0x68,0x13,0xAA,0x33,0x57,0xA6,0xFE,0xE7,0xFE,0xDF,0x36,0x9E,0x52,0x6D,0x2D,0x44,0x89,0x23,0x48,0xF4,0x00,0x02,
+    0x78,0x00,0x00,0x6E,0x01,0x00,0x6C,0x01,0x00,0xAA,0x00,0x00,0x4A,0x00,0xF2,0x22,0x88,0x0B,0x4C,0x34,0x92,0x6D,0xB4,0x8D,0xFE,0xE7,0x9B,0xCF,0x6A,0x3B,0x28,0x23,
+    0x28,0x23,0x4A,0x3B,0x5A,0xBF,0xFD,0xCF,0xEC,0x3B,0x88,0x13,0x88,0x03,0x68,0x13,0x31,0x65,0xFF,0xE7,0xBE,0xE7,0xFE,0xE7,0x73,0x8D,0x9C,0xD7,0xFD,0xD7,0x56,0x8E,
+    0x6A,0x64,0x01,0xF0,0x08,0x03,0x68,0x13,0xEC,0x43,0xBC,0xC7,0xFE,0xDF,0x8B,0x43,0x08,0x23,0x8A,0x2B,0x6A,0x2B,0xD3,0x7D,0xFE,0xDF,0x55,0x8E,0x80,0x00,0xA0,0x4C,
+    0x2C,0x96,0x8E,0xBB,0xC7,0xFE,0xDF,0x2C,0x3C,0xE8,0x01,0x11,0x88,0x92,0x01,0x00,0xE8,0x00,0x00,0x6E,0x00,0xC2,0xA8,0x03,0x88,0x0B,0x28,0x13,0x0C,0x3C,0x96,0x96,
+    0x6E,0x4C,0xCA,0x00,0x80,0x88,0x03,0x88,0x0B,0x68,0x1B,0xEC,0x43,0x76,0x01,0xC0,0xED,0x53,0xE9,0x2A,0x4A,0x33,0x73,0x85,0xDD,0xD7,0x31,0x6D,0xEA,0x01,0x00,0x80,
+    0x00,0xC0,0x4D,0x44,0xFE,0xDF,0xFF,0xE7,0xAF,0x5C,0x29,0x2B,0xF0,0x64,0x70,0x00,0xF0,0x1B,0xF9,0xB6,0xCB,0x3B,0x68,0x1B,0x48,0x13,0x48,0x1B,0xEC,0x4B,0x3A,0xC7,
+    0xFE,0xE7,0x57,0xA6,0x97,0xA6,0xF8,0xAE,0x39,0xB7,0xFD,0xCF,0xFE,0xD7,0xB6,0x8E,0x89,0x13,0x88,0x0B,0xC9,0x1B,0xAD,0x3C,0x8D,0x44,0x2C,0x3C,0xE2,0x00,0x00,0xEE,
+    0x00,0x00,0x62,0x00,0x22,0x88,0x0B,0xFE,0x00,0xF1,0x00,0xA8,0x03,0x68,0x0B,0xEC,0x3B,0xFE,0xD7,0xFE,0xDF,0xF9,0xAE,0xEB,0x33,0x68,0xCE,0x01,0x00,0x20,0x00,0x80,
+    0x69,0x23,0x35,0x8E,0xFE,0xE7,0x1A,0xC7,0x7A,0x01,0x71,0xFE,0xDF,0x19,0xB7,0xEC,0x43,0x29,0xE8,0x00,0xF0,0x0D,0x68,0x13,0xEB,0x33,0x3B,0xC7,0xFF,0xE7,0x8A,0x33,
+    0x49,0x23,0x29,0x23,0xF0,0x6C,0xDD,0xDF,0xFE,0xE7,0x7A,0xB7,0x6D,0x4C,0x0B,0x2C,0xCE,0x44,0x2C,0x00,0xF0,0x00,0xFD,0xCF,0xDC,0xCF,0xDC,0xC7,0x55,0x8E,0xAB,0x3B,
+    0xE8,0x1A,0x28,0x23,0x48,0xEC,0x00,0x10,0x03,0x82,0x02,0x31,0x88,0x13,0x68,0xA8,0x02,0x00,0x5C,0x00,0x82,0x68,0x13,0x89,0x1B,0xEB,0x2B,0xCA,0x23,0x82,0x00,0x21,
+    0x68,0x13,0xD4,0x02,0x70,0xDF,0xFE,0xE7,0x56,0x96,0x49,0x23,0xA4,0x00,0x00,0x14,0x01,0xF0,0x2B,0x48,0x1B,0x51,0x6D,0xFE,0xE7,0xFE,0xE7,0x14,0x86,0x10,0x65,0xB3,
+    0x85,0xFD,0xCF,0xFD,0xD7,0x2D,0x54,0x0C,0x3C,0xCA,0x2B,0x48,0x13,0xAA,0x2B,0x77,0xAE,0xFF,0xE7,0x11,0x6D,0x2D,0x4C,0xEC,0x3B,0x10,0x65,0x9B,0xC7,0xDC,0xCF,0x9B,
+    0xBF,0x18,0x9F,0x71,0x5D,0x69,0x1B,0xD2,0x65,0x0B,0x34,0x48,0x1B,0x2A,0x03,0x21,0x68,0x13,0xD6,0x02,0x05,0x5E,0x02,0x02,0xF6,0x00,0x00,0x74,0x01,0xC2,0x68,0x13,
+    0xAA,0x23,0xAE,0x4C,0x14,0x7E,0xD7,0x96,0x0F,0x4D,0x3A,0x03,0xF0,0x01,0x68,0x13,0xD0,0x64,0xFE,0xDF,0xD5,0x9D,0x3A,0xC7,0xFE,0xDF,0xD4,0x85,0x48,0x1B,0x1A,0x01,
+    0x00,0x68,0x01,0xF3,0x1C,0xCF,0x54,0xBD,0xD7,0xFE,0xE7,0xAB,0x3B,0x28,0x23,0x09,0x23,0xD8,0xA6,0xFE,0xDF,0xD5,0x95,0xB3,0x7D,0xB2,0x6D,0x69,0x1B,0x50,0x5D,0x5A,
+    0xBF,0xFE,0xDF,0xDC,0xBF,0xD7,0x96,0xEF,0x54,0x50,0x5D,0x51,0x6D,0xCF,0x5C,0x4D,0x52,0x02,0x06,0xC2,0x03,0x02,0xDA,0x01,0x0E,0x06,0x00,0xE4,0x68,0x0B,0xCE,0x4C,
+    0xF8,0xA6,0xBC,0xCF,0xFD,0xD7,0xD3,0x7D,0xAA,0x23,0x80,0x00,0xE2,0x31,0x6D,0xFD,0xD7,0xB0,0x64,0xF0,0x6C,0xBD,0xD7,0xFE,0xDF,0x92,0x75,0x82,0x00,0xA0,0x68,0x0B,
+    0xCB,0x2B,0xD9,0xB6,0xFE,0xE7,0xF0,0x6C,0x82,0x02,0xF0,0x08,0xF0,0x5C,0xFE,0xE7,0x9C,0xD7,0x5A,0xBF,0x92,0x75,0x69,0x23,0x37,0x97,0x34,0x7E,0x30,0x5D,0x4D,0x3C,
+    0x2B,0x2C,0xA9,0x42,0x03,0x10,0x13,0x62,0x02,0x02,0xB4,0x00,0x0E,0x70,0x00,0x00,0xF2,0x00,0x06,0x16,0x00,0x00,0xD6,0x00,0xB3,0x71,0x6D,0xFD,0xD7,0xDD,0xE7,0xFE,
+    0xE7,0xF4,0x85,0x28,0x3A,0x04,0xF0,0x05,0x68,0x13,0xD4,0x85,0xFD,0xD7,0x6E,0x5C,0x09,0x33,0x98,0xAE,0xFE,0xE7,0xBC,0xC7,0xAF,0x54,0x48,0x13,0xAE,0x01,0xF2,0x07,
+    0x69,0x23,0x77,0x9E,0xFE,0xE7,0x19,0xAF,0x2D,0x44,0x2C,0x34,0x69,0x23,0xDC,0xC7,0xFE,0xDF,0x9B,0xB7,0x0C,0x3C,0x5E,0x01,0x00,0x22,0x00,0x0F,0x74,0x00,0x07,0x00,
+    0x76,0x00,0x00,0xE8,0x01,0x00,0xF8,0x01,0x01,0x5A,0x03,0x00,0x8E,0x01,0x21,0x13,0x48,0x06,0x00,0xC4,0x72,0x6D,0xFE,0xD7,0x4F,0x6C,0xFF,0xE7,0xD8,0xA6,0xCB,0x33,
+    0x00,0x01,0xF0,0x18,0x56,0x96,0xFE,0xE7,0x39,0xB7,0x9B,0xC7,0x19,0xB7,0x3A,0xBF,0xFE,0xE7,0xB8,0xAE,0xEC,0x3B,0x89,0x23,0x69,0x1B,0x2C,0x3C,0xD8,0xAE,0xFE,0xDF,
+    0xDC,0xC7,0x79,0xA7,0x50,0x55,0x68,0x13,0x69,0x1B,0x89,0x24,0x05,0x04,0x50,0x02,0x03,0x74,0x04,0x06,0xDC,0x00,0x02,0x0A,0x00,0x01,0xE8,0x01,0x01,0x3A,0x05,0x00,
+    0x32,0x00,0xF2,0x11,0x8A,0x2B,0xCB,0x33,0x2C,0x44,0x4D,0x4C,0x4E,0x4C,0x4E,0x54,0x52,0x75,0x56,0x9E,0x89,0x23,0x48,0x1B,0x52,0x75,0xFE,0xD7,0x6B,0x4B,0xBC,0xCF,
+    0xDC,0xCF,0x8E,0x54,0x70,0x03,0xF6,0x13,0x68,0x13,0x97,0xA6,0xFE,0xE7,0x93,0x85,0x4E,0x54,0x2A,0x33,0x4A,0x3B,0x5B,0xC7,0xFE,0xDF,0xD7,0x9E,0x14,0x76,0x0B,0x34,
+    0x14,0x76,0x55,0x8E,0x92,0x75,0xAE,0x54,0xAA,0x2B,0x62,0x01,0x02,0xB2,0x02,0x02,0x6C,0x00,0x00,0x06,0x00,0x01,0x70,0x00,0x23,0x03,0x68,0x72,0x00,0xF0,0x23,0x48,
+    0x13,0x69,0x1B,0xCA,0x2B,0x4D,0x3C,0xCF,0x54,0x51,0x65,0xB3,0x75,0xF4,0x85,0x76,0x9E,0x3A,0xB7,0xBC,0xCF,0xFE,0xDF,0xFE,0xE7,0xFF,0xEF,0xFF,0xEF,0xFF,0xF7,0x35,
+    0x8E,0x29,0x2B,0x32,0x75,0xFD,0xD7,0x8B,0x43,0xF4,0x8D,0xFE,0xE7,0x73,0x7D,0x69,0x1B,0x40,0x00,0xA0,0x48,0x13,0x98,0xA6,0xDD,0xD7,0x2A,0x33,0x09,0x23,0x34,0x04,
+    0xC2,0xBC,0xC7,0xFD,0xD7,0xF8,0x9E,0xB2,0x65,0xA9,0x1B,0xCA,0x1B,0xE0,0x01,0x02,0x26,0x01,0x00,0x6E,0x00,0x08,0x04,0x00,0x00,0x3A,0x00,0x00,0x64,0x01,0x00,0x24,
+    0x06,0xF0,0x01,0x29,0x1B,0x6A,0x2B,0x4E,0x4C,0x52,0x75,0x15,0x96,0x97,0xA6,0xF9,0xB6,0x5B,0xC7,0xB8,0x02,0x02,0x72,0x00,0x00,0x72,0x05,0x01,0x04,0x00,0x01,0x7A,
+    0x06,0xF0,0x09,0xFE,0xDF,0x73,0x85,0x32,0x7D,0xFE,0xD7,0xAB,0x3B,0x4E,0x54,0xFE,0xDF,0xBC,0xCF,0x8A,0x23,0x68,0x13,0x48,0x0B,0x28,0x13,0xDE,0x02,0xC3,0xB7,0x9E,
+    0x55,0x86,0xCB,0x2B,0x59,0x9F,0xCF,0x5C,0xCB,0x33,0x36,0x06,0x00,0x86,0x06,0x09,0x68,0x01,0x00,0x74,0x00,0x10,0xA8,0x54,0x03,0x01,0xCA,0x01,0xE3,0x48,0x13,0x49,
+    0x1B,0x8A,0x2B,0x51,0x65,0x97,0x9E,0x7B,0xBF,0xDD,0xD7,0xE6,0x00,0x02,0x60,0x06,0x11,0xF7,0x6F,0x00,0x0D,0x05,0x00,0xC0,0xFE,0xE7,0x7C,0xD7,0x99,0xBE,0xFD,0xDF,
+    0xCB,0x3B,0xAB,0x3B,0xDC,0x02,0xF1,0x03,0xEC,0x43,0x6A,0x2B,0xCA,0x2B,0x51,0x65,0xFC,0xCF,0x7B,0xBF,0x59,0xA7,0x71,0x5D,0x89,0x1B,0x2E,0x02,0x00,0x62,0x00,0x1C,
+    0x03,0x6A,0x01,0x00,0x54,0x02,0x00,0x1E,0x00,0xB0,0x69,0x1B,0xAA,0x2B,0xEC,0x3B,0x0D,0x4C,0xD0,0x6C,0x5A,0x76,0x00,0x03,0x5A,0x01,0x01,0xE4,0x00,0x02,0x7C,0x00,
+    0x0D,0x76,0x00,0x06,0x11,0x00,0xF2,0x0E,0x15,0x9E,0xFE,0xE7,0xDE,0xE7,0xFE,0xE7,0xCB,0x3B,0x49,0x2B,0xB4,0x8D,0xFE,0xDF,0x39,0xAF,0xF4,0x7D,0x92,0x65,0x30,0x55,
+    0x14,0x7E,0x8A,0x2B,0x28,0x48,0x03,0x0D,0xF0,0x00,0x00,0xC4,0x02,0x20,0x88,0x13,0x4E,0x02,0xA7,0xAA,0x2B,0xAE,0x4C,0x51,0x65,0x72,0x75,0x97,0xA6,0xEC,0x00,0x06,
+    0x5D,0x00,0x0F,0x0A,0x00,0x0B,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0x73,0x49,0x23,0x68,0x0B,0x88,0x03,0xA8,0x02,0x00,0xF0,0x21,0x68,0x13,0x97,0xA6,0xFE,0xEF,0xDF,0xFF,
+    0x38,0xF6,0x4A,0xAA,0x66,0xA9,0x66,0xB1,0x86,0xB9,0x86,0xB1,0x87,0xA9,0xA7,0xA1,0xA7,0xA9,0x86,0xB1,0x66,0xB9,0x66,0xB9,0x86,0xB1,0x09,0xAA,0x76,0xFD,0xDB,0xFE,
+    0x7E,0xFF,0xBF,0xFF,0xDF,0xFF,0xDF,0xFF,0x01,0x00,0xA0,0xDF,0xFF,0xBE,0xFF,0xD7,0xED,0x09,0x92,0xA7,0x99,0x02,0x00,0x50,0xC8,0x91,0x31,0xCC,0x3D,0x1A,0x00,0xF2,
+    0x0E,0xF7,0x1A,0xBF,0x0C,0x34,0x88,0x0B,0x88,0x03,0x68,0x0B,0x69,0x23,0x7A,0xB7,0xFE,0xDF,0xDD,0xD7,0x9B,0xC7,0xDD,0xD7,0xFF,0xEF,0x19,0xB7,0xCB,0x2B,0x18,0x00,
+    0xC2,0x8A,0x2B,0xF8,0x9E,0x0C,0x44,0x48,0x1B,0x68,0x0B,0xA8,0x03,0x84,0x00,0xD1,0x68,0x13,0xAF,0x5C,0xFE,0xEF,0xDE,0xFF,0x56,0xDD,0x08,0xAA,0x66,0x72,0x00,0xF0,
+    0x06,0x87,0xA9,0x11,0xF4,0x5A,0xFE,0x8F,0xDB,0x87,0xA9,0x86,0xB9,0x66,0xB9,0x87,0xB1,0xC8,0x99,0x39,0xFE,0x9E,0x77,0x00,0x07,0x04,0x00,0xF0,0x02,0xBF,0xFF,0x9E,
+    0xFF,0x39,0xFE,0xAF,0xC3,0xAB,0xAA,0x0C,0xB3,0x56,0xED,0x5E,0xFF,0xBF,0x1C,0x00,0xF0,0x10,0xF7,0x15,0x96,0x89,0x1B,0x88,0x0B,0x68,0x0B,0x68,0x13,0xCF,0x5C,0xFD,
+    0xD7,0x53,0x7D,0x2A,0x3B,0xCC,0x4B,0x8F,0x64,0xDD,0xE7,0xBC,0xD7,0xCF,0x54,0x48,0x13,0x1A,0x00,0xC2,0x0C,0x3C,0x7A,0xB7,0xD4,0x8D,0x4D,0x44,0xCA,0x23,0x88,0x0B,
+    0x02,0x01,0xD1,0x88,0x13,0x6A,0x2B,0xFE,0xE7,0xDE,0xFF,0x35,0xDD,0xE8,0xA9,0x86,0xFE,0x00,0x91,0xA7,0xA9,0xD8,0xFD,0xFC,0xFE,0x92,0xEC,0x86,0x80,0x00,0x70,0x86,
+    0xA9,0xA7,0x91,0x39,0xFE,0xBE,0x60,0x00,0x09,0x04,0x00,0x00,0x04,0x01,0x51,0x9E,0xFF,0x7E,0xFF,0x9E,0x18,0x01,0xF0,0x13,0xFF,0xFF,0xFF,0xF7,0xFE,0xE7,0x92,0x7D,
+    0x68,0x13,0x88,0x0B,0x89,0x1B,0xEF,0x54,0x19,0xB7,0xFE,0xDF,0x6F,0x5C,0xAB,0x3B,0x49,0x2B,0x29,0x2B,0xD9,0xBE,0xFE,0xE7,0x92,0x75,0xF4,0x00,0xC2,0x68,0x13,0x6E,
+    0x54,0xBB,0xBF,0xFD,0xCF,0xF7,0x96,0xAD,0x3C,0xFE,0x00,0xF0,0x01,0xA8,0x03,0x88,0x0B,0x48,0x1B,0xD8,0xAE,0xFE,0xFF,0x96,0xE5,0x09,0xAA,0x87,0xB1,0x70,0x01,0xF2,
+    0x05,0x87,0xA9,0x2D,0xD3,0x31,0xE4,0xCC,0xBA,0x86,0xA9,0x66,0xB9,0x86,0xB9,0x86,0xA9,0xE8,0x91,0x59,0xFE,0x78,0x01,0x09,0x81,0x00,0x25,0xFF,0xFF,0x90,0x01,0x01,
+    0x18,0x00,0x50,0xF7,0x9B,0xCF,0x8E,0x4C,0x80,0x00,0xF2,0x17,0xCA,0x23,0x75,0x86,0x5A,0xB7,0xFD,0xCF,0x79,0xAF,0xF3,0x75,0xEF,0x4C,0x34,0x7E,0x7B,0xC7,0xFE,0xDF,
+    0x39,0xAF,0x71,0x65,0x68,0x13,0x89,0x23,0xD0,0x64,0xFD,0xCF,0x4C,0x34,0x2B,0x2C,0xC9,0x13,0xFE,0x00,0x00,0x06,0x00,0x90,0x88,0x13,0x0C,0x44,0xFE,0xEF,0x99,0xF6,
+    0x6A,0x00,0x02,0x01,0xF2,0x01,0x00,0x02,0x02,0x13,0x87,0x00,0x02,0x50,0x87,0xA1,0x8F,0xBB,0x1C,0xDE,0x01,0x01,0x65,0x00,0x0F,0x05,0x00,0x08,0x50,0xEF,0xF9,0xAE,
+    0x69,0x1B,0xE6,0x01,0xF0,0x13,0xA9,0x13,0xA9,0x1B,0xCB,0x2B,0x2C,0x34,0x6C,0x34,0x0B,0x2C,0x0B,0x2C,0xAE,0x44,0xCF,0x54,0x96,0x8E,0xFB,0xBF,0xFB,0xAF,0xAA,0x2B,
+    0x99,0xA7,0xBB,0xC7,0xFE,0xDF,0x88,0x03,0x02,0x00,0x00,0x7A,0x00,0x00,0x04,0x00,0xE0,0x88,0x03,0xA9,0x0B,0x89,0x23,0x19,0xBF,0xBD,0xFF,0xCF,0xC3,0xA7,0x99,0x82,
+    0x01,0x00,0x76,0x02,0x02,0x04,0x00,0x00,0x8C,0x02,0x5F,0xA7,0x99,0x14,0xDD,0x9E,0x80,0x00,0x0F,0x40,0xF7,0xFE,0xE7,0x6E,0xFE,0x00,0x01,0x56,0x02,0x10,0x68,0x62,
+    0x00,0x30,0x0B,0x88,0x0B,0xF2,0x01,0x30,0x89,0x13,0x48,0x02,0x00,0xB0,0x1B,0x48,0x1B,0x48,0x13,0x48,0x1B,0xCB,0x3B,0x55,0x96,0x76,0x00,0x0A,0x04,0x00,0x00,0x84,
+    0x02,0x82,0xBC,0xE7,0xDB,0xFE,0xCC,0xA2,0xA7,0xA1,0xF6,0x02,0x03,0x80,0x00,0x8F,0xB1,0xA7,0xA1,0xAF,0xC3,0xFC,0xFE,0xBE,0x80,0x00,0x0D,0x72,0xF7,0xFF,0xEF,0xD8,
+    0xAE,0x48,0x1B,0x54,0x02,0x00,0xDE,0x00,0x02,0x04,0x00,0x00,0xE4,0x02,0x22,0x88,0x03,0x88,0x00,0x00,0x06,0x00,0x51,0x88,0x0B,0x68,0x13,0x68,0x7A,0x01,0x00,0x20,
+    0x00,0x00,0x84,0x00,0x00,0x08,0x00,0x00,0x22,0x00,0xF1,0x01,0xAA,0x2B,0x35,0x96,0xBD,0xF7,0x59,0xF6,0x4D,0xBB,0xC7,0xA1,0x87,0xA1,0x87,0xA9,0x02,0x00,0xB6,0xA1,
+    0xA7,0x99,0x49,0x9A,0x92,0xCC,0x96,0xCD,0xB6,0xBD,0x02,0x00,0xF3,0x0D,0xD6,0xBD,0xF7,0xC5,0xF7,0xC5,0x38,0xCE,0x58,0xCE,0x79,0xD6,0xBA,0xD6,0xFB,0xDE,0x3C,0xE7,
+    0xDE,0xF7,0xFF,0xEF,0x7B,0xC7,0xCB,0x3B,0x68,0x13,0x4E,0x00,0x00,0xFE,0x00,0x12,0x03,0x7C,0x00,0x00,0x64,0x00,0x0C,0x04,0x00,0x00,0x7A,0x02,0x00,0x74,0x00,0x00,
+    0x8E,0x00,0x20,0x48,0x13,0x32,0x02,0x00,0x0A,0x00,0xF8,0x0F,0x0C,0x3C,0x3A,0xC7,0xDE,0xFF,0xFB,0xFE,0x35,0xDD,0x4D,0xAB,0x08,0x8A,0xC8,0x89,0xC8,0x81,0xE8,0x81,
+    0x08,0x72,0x49,0x6A,0xAA,0x72,0xAA,0x62,0xAA,0x5A,0x02,0x00,0xF0,0x0A,0xEB,0x62,0x2C,0x6B,0x4C,0x6B,0xAE,0x7B,0xEF,0x83,0x71,0x94,0xF3,0xA4,0xB6,0xB5,0x1B,0xDF,
+    0xDD,0xDF,0xF0,0x5C,0x48,0x13,0x68,0x70,0x01,0x10,0x13,0xE2,0x00,0x02,0x54,0x00,0x04,0x8E,0x00,0x00,0x80,0x00,0x00,0x74,0x00,0x00,0x08,0x00,0x00,0x04,0x00,0x00,
+    0x88,0x01,0xF1,0x12,0x49,0x1B,0x28,0x1B,0x69,0x23,0x2D,0x44,0x10,0x65,0xD3,0x75,0x8D,0x44,0x48,0x13,0x88,0x13,0x69,0x13,0x2D,0x4C,0xFE,0xE7,0xFE,0xF7,0xBE,0xFF,
+    0x7E,0xFF,0x5D,0xFF,0x5D,0x5A,0x03,0x5F,0xBE,0xFF,0xDE,0xFF,0xDE,0x73,0x02,0x00,0x00,0x88,0x04,0x04,0x18,0x00,0xF0,0x09,0xFE,0xF7,0xFE,0xE7,0x93,0x85,0x69,0x1B,
+    0x89,0x13,0x68,0x13,0x0B,0x2C,0xB2,0x6D,0x31,0x65,0x6E,0x4C,0x8A,0x2B,0x29,0x1B,0x62,0x00,0x00,0xF4,0x01,0x02,0x90,0x00,0x01,0x06,0x00,0x01,0x12,0x02,0xF0,0x09,
+    0x88,0x0B,0x19,0xB7,0xFD,0xD7,0xFE,0xE7,0xFE,0xE7,0xFF,0xE7,0xFF,0xEF,0xFF,0xEF,0xFF,0xE7,0xFE,0xDF,0x0C,0x44,0x68,0x13,0x36,0x04,0x71,0x8E,0x4C,0x9C,0xCF,0xFE,
+    0xF7,0xDE,0x58,0x03,0x00,0x64,0x00,0x0F,0x76,0x03,0x03,0x09,0x91,0x00,0x70,0xF7,0xFE,0xE7,0x14,0x8E,0x89,0x23,0x60,0x00,0x53,0x8A,0x2B,0x36,0x96,0xFE,0x54,0x00,
+    0xFA,0x11,0xFF,0xE7,0xFE,0xE7,0xFE,0xDF,0x7B,0xC7,0xB8,0xA6,0xB4,0x85,0x8F,0x64,0x2D,0x54,0x2D,0x4C,0x2D,0x44,0xEC,0x3B,0xCB,0x2B,0x89,0x23,0x69,0x1B,0xFF,0xF7,
+    0xFF,0xF7,0x44,0x00,0x31,0x7B,0xC7,0x2D,0x04,0x01,0x30,0x68,0x13,0x8E,0x3A,0x04,0x1B,0xE7,0x20,0x00,0x09,0x2D,0x00,0x07,0x0D,0x00,0x72,0xF7,0xFF,0xEF,0xDD,0xDF,
+    0x93,0x7D,0x7E,0x00,0x58,0x49,0x1B,0xD4,0x85,0xFE,0x3A,0x00,0x00,0x66,0x00,0x00,0x04,0x00,0x00,0xE4,0x00,0xD7,0xEF,0xFF,0xE7,0xFD,0xDF,0x7B,0xBF,0xB8,0xA6,0x15,
+    0x8E,0xD4,0x7D,0x42,0x00,0x04,0x0B,0x00,0x50,0xEF,0xD8,0xAE,0x0C,0x3C,0xC2,0x01,0x8F,0x68,0x1B,0x2C,0x3C,0x76,0x96,0xFE,0xDF,0x82,0x00,0x10,0x90,0xF7,0xFE,0xEF,
+    0x3A,0xBF,0xCF,0x5C,0x48,0x1B,0xFC,0x00,0x3A,0x49,0x1B,0xB4,0x7E,0x00,0x04,0x5A,0x00,0x06,0x08,0x00,0x00,0x8C,0x00,0x00,0x04,0x00,0x16,0xEF,0x13,0x00,0x05,0x0A,
+    0x00,0xF0,0x05,0xF7,0xFE,0xEF,0xB8,0xAE,0xCB,0x33,0x68,0x1B,0x88,0x13,0x68,0x13,0x49,0x23,0x8E,0x54,0xDD,0xD7,0xFE,0xB8,0x00,0x00,0x30,0x00,0x05,0x25,0x00,0x03,
+    0x09,0x00,0x00,0x14,0x00,0xFF,0x03,0xF7,0xFE,0xEF,0xFE,0xDF,0x35,0x8E,0xAA,0x33,0x68,0x13,0x88,0x13,0x88,0x13,0x48,0x1B,0xF4,0x7E,0x00,0x0D,0x03,0x3D,0x00,0x0F,
+    0x07,0x00,0x06,0x81,0xF7,0xFF,0xEF,0x3A,0xBF,0xEC,0x43,0x28,0xCE,0x00,0xA1,0x48,0x13,0x69,0x23,0x51,0x6D,0x59,0xB7,0xBC,0xD7,0x52,0x01,0x00,0x72,0x00,0x02,0x39,
+    0x00,0x00,0x0A,0x00,0xB0,0xEF,0xDD,0xDF,0x7A,0xBF,0xF7,0x9E,0xAA,0x2B,0x68,0x1B,0x7E,0x00,0x61,0x68,0x13,0xAA,0x2B,0x15,0x8E,0x28,0x00,0x02,0x24,0x00,0x0F,0x06,
+    0x00,0x27,0x70,0xF7,0xFE,0xDF,0xF0,0x64,0xAA,0x2B,0x94,0x03,0x11,0x68,0xB4,0x04,0xF2,0x0B,0x8E,0x54,0xF4,0x8D,0xF5,0x95,0x57,0xA6,0x3A,0xC7,0x9C,0xD7,0xBC,0xD7,
+    0x5B,0xC7,0xB8,0xAE,0xF5,0x95,0xF4,0x8D,0x31,0x6D,0x8A,0x2B,0x76,0x01,0xAF,0x68,0x13,0x69,0x1B,0x8E,0x4C,0x77,0xA6,0xFF,0xEF,0xB0,0x01,0x10,0x90,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x21,0xFE,0xD7,0x09,0x33,0x52,0x85,0xFE,0xDF,0xF8,0xA6,0x29,0x2B,0xB0,0x6C,0xFE,0xD7,0xAE,0x4C,0x48,0x13,0x88,0x13,0x48,0x1B,
+    0xAF,0x64,0xFE,0xDF,0x9B,0xC7,0x8A,0x33,0x89,0x23,0xCB,0x2B,0xF0,0x5C,0xFD,0xCF,0x59,0xAF,0xCB,0x33,0x68,0x0B,0xA8,0x03,0x02,0x00,0x20,0x88,0x03,0x02,0x00,0x02,
+    0x12,0x00,0xFF,0x0A,0x88,0x03,0x88,0x0B,0x88,0x13,0x68,0x13,0x69,0x1B,0xAA,0x2B,0x0C,0x3C,0xF4,0x85,0xFD,0xCF,0xFE,0xE7,0xFF,0xEF,0xFF,0xF7,0xFF,0x01,0x00,0x0C,
+    0xF0,0x1F,0xDB,0xBF,0x08,0x23,0x4E,0x54,0x9B,0xC7,0xFE,0xDF,0x2A,0x3B,0xF1,0x74,0xFC,0xCF,0x2C,0x3C,0x68,0x0B,0x88,0x0B,0x48,0x13,0xF4,0x8D,0xFE,0xDF,0x7A,0xB7,
+    0x49,0x23,0x68,0x13,0x68,0x13,0x49,0x23,0x56,0x96,0xFE,0xDF,0x93,0x7D,0x48,0x13,0x70,0x00,0xF0,0x01,0x88,0x03,0xA8,0x03,0x88,0x0B,0x68,0x13,0x88,0x13,0x89,0x1B,
+    0x89,0x1B,0x88,0x13,0x30,0x00,0x00,0x14,0x00,0x02,0x88,0x00,0xF0,0x04,0xA8,0x03,0x68,0x03,0x68,0x13,0x48,0x1B,0x29,0x23,0x2D,0x4C,0x36,0x9E,0x9C,0xCF,0xFE,0xE7,
+    0xFE,0x86,0x00,0x0F,0x88,0x00,0x06,0x60,0xB2,0x75,0x29,0x23,0x49,0x2B,0x60,0x00,0xF1,0x16,0x78,0xB6,0x94,0x95,0x39,0xB7,0x0B,0x34,0x88,0x0B,0x88,0x0B,0x69,0x1B,
+    0x97,0xA6,0xFE,0xE7,0xD7,0x9E,0x48,0x1B,0x88,0x0B,0x68,0x0B,0x48,0x1B,0xF0,0x5C,0xFF,0xE7,0x9B,0xC7,0x48,0x1B,0x68,0xF2,0x00,0xF6,0x05,0x68,0x0B,0x89,0x1B,0x6D,
+    0x4C,0x92,0x75,0x35,0x8E,0x14,0x86,0x51,0x65,0x2C,0x3C,0x68,0x1B,0x68,0x0B,0x82,0x00,0x00,0xA4,0x00,0x40,0x68,0x03,0x68,0x0B,0x86,0x00,0xAF,0x8A,0x2B,0xCF,0x54,
+    0x35,0x8E,0xF9,0xB6,0xDD,0xDF,0x0C,0x01,0x05,0xF0,0x03,0x4D,0x4C,0x08,0x1B,0x49,0x1B,0xEF,0x5C,0xDD,0xD7,0xFE,0xE7,0x1B,0xCF,0x97,0xA6,0xCA,0x23,0x80,0x00,0xA0,
+    0xAA,0x2B,0xD9,0xB6,0xFE,0xE7,0x71,0x6D,0x68,0x13,0x0E,0x00,0x80,0x48,0x1B,0x11,0x65,0xFF,0xE7,0xDD,0xD7,0x8E,0x00,0x00,0xFC,0x00,0xF0,0x07,0x48,0x1B,0x72,0x6D,
+    0x9B,0xBF,0xFE,0xD7,0x97,0x9E,0xF4,0x85,0xF8,0xA6,0x39,0xA7,0xAE,0x54,0x91,0x65,0xAD,0x3C,0x78,0x00,0x00,0x2E,0x00,0x21,0x88,0x0B,0x0A,0x00,0x00,0x26,0x01,0x01,
+    0x86,0x00,0xA3,0x69,0x1B,0xEB,0x33,0xF0,0x64,0xB4,0x85,0x3A,0xBF,0x92,0x01,0x09,0x0C,0x01,0xF0,0x1F,0x19,0xAF,0xD3,0x75,0x69,0x1B,0x69,0x23,0x3A,0xBF,0xFF,0xEF,
+    0xFE,0xE7,0xD4,0x8D,0x89,0x1B,0x88,0x0B,0x48,0x0B,0x4D,0x44,0x5B,0xC7,0xFE,0xE7,0x0C,0x3C,0x68,0x13,0x88,0x03,0x68,0x0B,0x69,0x23,0x76,0x96,0xFF,0xE7,0x7B,0xC7,
+    0x48,0x1B,0x5A,0x00,0xC0,0x68,0x13,0x2D,0x44,0xFD,0xCF,0xFE,0xDF,0xB4,0x85,0xAA,0x2B,0x1E,0x02,0xF0,0x03,0x14,0x86,0x9B,0xC7,0xFD,0xCF,0xF3,0x6D,0x68,0x13,0x48,
+    0x13,0x48,0x1B,0x48,0x1B,0x48,0x13,0xB6,0x00,0x00,0x8E,0x01,0x00,0x2E,0x00,0x00,0x18,0x02,0x00,0x0C,0x01,0xA1,0x89,0x1B,0xEB,0x33,0x4D,0x4C,0xF8,0xA6,0xFE,0xDF,
+    0x90,0x01,0x05,0x16,0x02,0xF1,0x00,0xDB,0xBF,0x58,0x9F,0x89,0x1B,0x48,0x13,0x92,0x75,0xFE,0xDF,0xFE,0xDF,0x31,0xF2,0x00,0xA0,0x89,0x1B,0x51,0x6D,0xFD,0xDF,0xFE,
+    0xDF,0x49,0x23,0x4C,0x00,0x84,0x48,0x13,0xAB,0x3B,0xBC,0xC7,0xFE,0xE7,0x00,0x02,0x20,0x48,0x13,0x5C,0x02,0xF0,0x0E,0xD8,0xAE,0xCB,0x3B,0x68,0x13,0x68,0x0B,0x48,
+    0x13,0x69,0x23,0x5A,0xBF,0xFD,0xD7,0x2D,0x44,0x69,0x23,0xCF,0x54,0xFD,0xC7,0xFD,0xC7,0x38,0x9F,0x4C,0x92,0x01,0x00,0x3A,0x01,0x16,0x03,0x96,0x01,0xC0,0xC9,0x0B,
+    0x88,0x0B,0x89,0x13,0x48,0x1B,0x08,0x23,0x52,0x75,0x6C,0x01,0x01,0x90,0x01,0x30,0xF7,0xFF,0xFF,0x44,0x00,0x00,0x36,0x01,0x80,0x89,0x23,0x54,0x7E,0x75,0x86,0x8D,
+    0x44,0x58,0x02,0xF0,0x09,0xB6,0x8E,0xD8,0xA6,0xFE,0xE7,0xBC,0xD7,0xEC,0x43,0xAA,0x2B,0x89,0x2B,0xCC,0x3B,0x36,0x9E,0xFE,0xDF,0x9B,0xBF,0xEB,0x33,0xE6,0x01,0x00,
+    0x0E,0x01,0x81,0xFE,0xDF,0xFE,0xE7,0xF4,0x85,0x49,0x1B,0x6A,0x01,0xF6,0x0E,0x0B,0x48,0x1B,0x39,0xAF,0xBB,0xC7,0x29,0x23,0x51,0x65,0xFD,0xCF,0x39,0xB7,0x75,0x8E,
+    0xD6,0x96,0xDB,0xBF,0xF3,0x7D,0xCB,0x33,0x0B,0x2C,0xA8,0x13,0x80,0x00,0x04,0x0C,0x01,0x01,0x24,0x03,0xB0,0x23,0x10,0x65,0x76,0x96,0x7B,0xC7,0xFE,0xE7,0xFF,0xF7,
+    0x28,0x01,0x20,0xA8,0x03,0x66,0x01,0x00,0xEA,0x02,0x00,0x3A,0x01,0xF2,0x0A,0x88,0x13,0x30,0x5D,0xB3,0x75,0x76,0x9E,0x39,0xB7,0xD7,0x9E,0x96,0x8E,0x75,0x8E,0x39,
+    0xA7,0xFE,0xD7,0x5A,0xB7,0xCF,0x54,0x69,0x7E,0x01,0x90,0x0B,0xCB,0x33,0xFE,0xE7,0xDD,0xDF,0x10,0x65,0x2C,0x00,0x01,0x3A,0x00,0xF4,0x0C,0x13,0x51,0x5D,0xB3,0x75,
+    0x8A,0x2B,0x76,0x96,0xFE,0xE7,0x4F,0x64,0xE8,0x22,0x49,0x2B,0x8F,0x5C,0xBB,0xC7,0xD7,0xA6,0x75,0x86,0xEA,0x23,0x80,0x00,0x02,0x7E,0x00,0x02,0x6C,0x00,0x00,0x42,
+    0x02,0x00,0x9C,0x02,0x64,0x4D,0x44,0x52,0x75,0x98,0xAE,0x14,0x00,0x06,0x08,0x00,0x00,0x8C,0x00,0xF1,0x06,0x69,0x13,0xCA,0x23,0x0B,0x34,0x4C,0x34,0xCE,0x44,0xB2,
+    0x65,0xD2,0x6D,0x10,0x55,0x0B,0x34,0x88,0x13,0x88,0xFE,0x03,0x10,0x68,0x80,0x00,0x61,0xDF,0xBC,0xD7,0xCF,0x54,0x48,0x12,0x00,0x00,0x20,0x03,0x60,0x68,0x13,0x89,
+    0x23,0x8A,0x23,0x80,0x00,0xF2,0x01,0xF9,0xBE,0xCC,0x43,0x08,0x23,0x29,0x23,0x51,0x6D,0xFE,0xDF,0x55,0x8E,0x89,0x1B,0x80,0x00,0x00,0x0E,0x03,0x04,0x40,0x00,0x02,
+    0x68,0x00,0x02,0x16,0x02,0x40,0x69,0x13,0xCB,0x2B,0x9A,0x00,0x02,0x14,0x00,0x0A,0x06,0x00,0x00,0x18,0x00,0x11,0x68,0x52,0x04,0x00,0x18,0x01,0x00,0x6A,0x01,0x02,
+    0x20,0x00,0x00,0x9C,0x03,0x80,0xFD,0xD7,0xDD,0xD7,0x10,0x65,0x48,0x1B,0x1A,0x00,0xC0,0x68,0x13,0xEE,0x44,0x2B,0x2C,0x48,0x13,0x28,0x1B,0x10,0x65,0xD8,0x01,0xC0,
+    0xFD,0xCF,0x31,0x6D,0x29,0x23,0x8A,0x33,0xFD,0xCF,0xB3,0x75,0xBE,0x02,0x01,0x6A,0x00,0x69,0x1B,0x0F,0x55,0xB2,0x6D,0x49,0xA6,0x03,0x03,0x4E,0x00,0x13,0x03,0x00,
+    0x02,0x09,0xD8,0x04,0x04,0x1C,0x00,0x00,0x84,0x00,0x04,0x04,0x00,0x02,0x14,0x00,0x00,0x70,0x01,0xF0,0x0F,0x48,0x13,0x31,0x6D,0xFD,0xD7,0xD8,0xA6,0x0C,0x44,0x49,
+    0x23,0x69,0x23,0xCF,0x5C,0x9A,0xAF,0x91,0x65,0x89,0x23,0x92,0x75,0xD0,0x64,0x52,0x75,0x7A,0xBF,0x1C,0x02,0x70,0xB8,0xAE,0x2D,0x54,0x55,0x8E,0xA9,0xCA,0x03,0x01,
+    0xAA,0x04,0xA2,0x6E,0x54,0xBC,0xC7,0xFF,0xE7,0x3A,0xB7,0xEB,0x2B,0x44,0x01,0x04,0x4C,0x00,0x00,0x4E,0x00,0xA0,0x92,0x6D,0x10,0x5D,0x6D,0x44,0xEB,0x33,0x89,0x23,
+    0x40,0x03,0x00,0x7E,0x02,0x01,0xD0,0x04,0x01,0x6C,0x01,0x06,0x28,0x00,0x08,0x0A,0x00,0xF0,0x19,0x88,0x0B,0x49,0x1B,0xD3,0x75,0x9B,0xB7,0x39,0xAF,0x14,0x7E,0x35,
+    0x86,0x9A,0xB7,0x96,0x96,0xAA,0x2B,0x8A,0x2B,0xDC,0xC7,0x72,0x7D,0x08,0x23,0xCB,0x3B,0xD4,0x8D,0x7B,0xCF,0xFE,0xE7,0x7B,0xC7,0xCB,0x33,0x20,0x02,0x00,0x28,0x05,
+    0xC2,0x6D,0x44,0x3A,0xB7,0x3B,0xC7,0xFF,0xEF,0x3A,0xBF,0xEB,0x33,0x90,0x01,0x08,0x4E,0x00,0xF0,0x06,0xFE,0xE7,0xBD,0xDF,0x5B,0xCF,0x1A,0xBF,0xB8,0xAE,0x36,0x9E,
+    0x93,0x7D,0xAF,0x5C,0xCB,0x33,0x49,0x23,0x28,0xC4,0x03,0x10,0x0B,0xAC,0x00,0x0E,0x30,0x00,0x00,0xB4,0x00,0x01,0x00,0x05,0xF0,0x0C,0x3C,0x50,0x5D,0xF3,0x75,0xF3,
+    0x75,0x30,0x55,0xEA,0x2B,0x48,0x1B,0x2C,0x3C,0xFE,0xDF,0x77,0x9E,0x8A,0x2B,0x48,0x1B,0x69,0x23,0x8E,0x54,0x3C,0x04,0x20,0x14,0x7E,0x20,0x02,0xA3,0x68,0x13,0xCB,
+    0x33,0x59,0xAF,0x7A,0xB7,0x6F,0x64,0x80,0x00,0x0D,0xD8,0x00,0x03,0x09,0x04,0xF0,0x08,0xF7,0xFF,0xF7,0xFF,0xEF,0xFE,0xEF,0xFE,0xE7,0xFD,0xD7,0x9B,0xC7,0xF8,0xA6,
+    0xD4,0x7D,0xEB,0x33,0x28,0x1B,0x28,0x13,0x00,0x04,0x02,0xC8,0x00,0x08,0x8A,0x00,0x01,0xD4,0x01,0x51,0x0B,0x68,0x13,0x69,0x13,0x00,0x06,0xF0,0x08,0x13,0x48,0x13,
+    0x58,0x9F,0xFC,0xC7,0x9B,0xC7,0x92,0x6D,0x08,0x1B,0x28,0x1B,0x29,0x2B,0x77,0xA6,0xFE,0xDF,0x55,0x86,0x3C,0x00,0xA2,0x49,0x23,0x7A,0xB7,0xDD,0xD7,0xD0,0x6C,0x4B,
+    0x43,0x80,0x00,0x0C,0xC2,0x06,0x23,0xA8,0x03,0x80,0x00,0x02,0x07,0x00,0x00,0x86,0x00,0x00,0x04,0x00,0x02,0x8A,0x00,0xC0,0xDF,0x9B,0xC7,0x15,0x96,0x4E,0x54,0x0C,
+    0x44,0xEB,0x33,0x69,0x6C,0x02,0x16,0x0B,0x86,0x02,0x00,0x42,0x01,0x02,0x1A,0x02,0x00,0x10,0x01,0x00,0x66,0x01,0xF2,0x11,0xAA,0x2B,0x10,0x5D,0xBB,0xB7,0xBB,0xBF,
+    0xB0,0x5C,0xF0,0x6C,0x9B,0xCF,0xFD,0xCF,0xCB,0x33,0x48,0x1B,0x6A,0x2B,0xB7,0x9E,0xFE,0xDF,0xF9,0xB6,0x2E,0x5C,0xED,0x53,0x80,0x00,0x08,0xC6,0x00,0x00,0x3A,0x00,
+    0x22,0x68,0x13,0x79,0x00,0x0F,0x06,0x00,0x04,0x02,0x8C,0x00,0xB0,0xDF,0xBC,0xC7,0xD4,0x85,0x71,0x6D,0x10,0x5D,0xCB,0x2B,0x2A,0x05,0x00,0xB2,0x02,0x00,0x8A,0x04,
+    0x00,0x84,0x00,0x02,0x04,0x00,0x00,0x8A,0x00,0x00,0x0A,0x05,0xD2,0xAE,0x4C,0x35,0x86,0x97,0x96,0x39,0xAF,0x76,0x96,0x10,0x65,0xAB,0x86,0x07,0x93,0xD7,0x36,0x9E,
+    0xF4,0x8D,0x19,0xAF,0x5A,0xBF,0x80,0x00,0x01,0x80,0x01,0xC0,0x88,0x03,0x88,0x03,0x88,0x0B,0x68,0x13,0xAA,0x23,0xCF,0x54,0x1F,0xFF,0x01,0x00,0xFF,0xFE,0x1F,0xF7,
+    0x11,0x02,0x43,0x7F,0xDD,0xDF,0xFF,0xEF,0xFF,0xF7,0xFF,0x5E,0x00,0x3E,0x61,0x6D,0x44,0x15,0x8E,0xDD,0xD7,0x5C,0x00,0x0F,0xB9,0x00,0x3A,0x9F,0x68,0x13,0x28,0x13,
+    0x8A,0x2B,0xB3,0x85,0xFD,0x5C,0x00,0x3C,0xFF,0x01,0x88,0x03,0x88,0x0B,0x68,0x0B,0x48,0x1B,0x69,0x23,0x92,0x75,0x19,0xBF,0xBD,0xDF,0x12,0x01,0x35,0xFF,0x01,0xA8,
+    0x03,0xA8,0x03,0x88,0x03,0x68,0x0B,0x48,0x13,0x29,0x23,0xAC,0x4B,0x78,0xBE,0x58,0x00,0x39,0x00,0x56,0x00,0x8F,0x69,0x23,0x11,0x75,0xB9,0xBE,0x9D,0xE7,0x65,0x01,
+    0x35,0xCF,0x88,0x0B,0x68,0x13,0x49,0x1B,0xD0,0x5C,0x5A,0xBF,0xFE,0xE7,0xAC,0x00,0x35,0x00,0x9C,0x00,0x43,0xCA,0x2B,0x2D,0x4C,0x54,0x00,0x0F,0x6C,0x02,0x3A,0x2F,
+    0x97,0x9E,0xA8,0x00,0x3B,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xFF,0x01,0x00,0x55,0xFF,0x08,0xF7,0xFF,0xF7,0xFE,0xE7,0xD9,0xB6,0xB3,0x7D,0xAA,0x2B,
+    0x68,0x13,0x68,0x13,0x68,0x1B,0x92,0x6D,0xFD,0xD7,0x0D,0x54,0x7F,0x00,0x55,0x03,0x68,0x00,0x70,0xF7,0xFE,0xE7,0x5A,0xB7,0xEF,0x54,0x82,0x00,0x63,0x8E,0x4C,0xFC,
+    0xCF,0x36,0x9E,0x18,0x00,0x0F,0x07,0x00,0x57,0xFF,0x00,0xF7,0xFF,0xE7,0xF7,0x9E,0xA9,0x23,0x68,0x13,0x69,0x23,0x36,0x9E,0xFD,0xDF,0x79,0x00,0x57,0x04,0x6A,0x00,
+    0xE4,0xFE,0xE7,0x10,0x65,0x48,0x1B,0x68,0x13,0x8D,0x3C,0xD8,0xA6,0xDC,0xCF,0x16,0x00,0x0F,0x08,0x00,0x56,0xEF,0xF7,0x9C,0xD7,0x8E,0x4C,0x48,0x13,0x88,0x13,0x70,
+    0x4D,0xF3,0x6D,0xEF,0x00,0x02,0x5D,0xFF,0x02,0xFF,0xFF,0xF7,0x56,0x9E,0x8A,0x23,0x88,0x0B,0x68,0x0B,0xA9,0x13,0x89,0x13,0x68,0x0B,0xF8,0x00,0x56,0x03,0x69,0x00,
+    0x91,0xFE,0xE7,0xD4,0x85,0x48,0x13,0xA8,0x03,0x88,0x02,0x00,0x23,0xA8,0x03,0x17,0x00,0x0F,0x07,0x00,0x55,0xA3,0xF7,0xBC,0xCF,0x4D,0x4C,0x68,0x13,0x88,0x03,0xA8,
+    0x02,0x00,0x0F,0x79,0x00,0x55,0x03,0x68,0x00,0x74,0xF7,0x39,0xB7,0x49,0x23,0x88,0x0B,0x7E,0x00,0x1F,0x88,0x00,0x01,0x5D,0x50,0xEF,0xD3,0x7D,0x48,0x13,0x80,0x00,
+    0x20,0x88,0x03,0x04,0x02,0x23,0x68,0x13,0x98,0x00,0x0F,0x07,0x00,0x54,0xFF,0x03,0xFE,0xE7,0xCB,0x33,0x68,0x13,0x88,0x0B,0x88,0x0B,0x68,0x13,0x48,0x1B,0x8A,0x2B,
+    0x8F,0x5C,0x79,0x00,0x54,0x02,0x67,0x00,0xF2,0x04,0xF7,0x7B,0xCF,0x49,0x23,0x68,0x13,0x48,0x13,0xAA,0x23,0x4D,0x44,0xD4,0x7D,0x9C,0xC7,0xFF,0xE7,0x19,0x00,0x0F,
+    0x06,0x00,0x52,0xFF,0x06,0xF7,0xFF,0xEF,0x73,0x8D,0x09,0x23,0xCB,0x33,0x11,0x6D,0x56,0x9E,0x9C,0xD7,0xFF,0xEF,0xFF,0xF7,0xFF,0xF7,0x7A,0x00,0x52,0x02,0x65,0x00,
+    0xBF,0xF7,0xFE,0xEF,0xEE,0x63,0xD4,0x8D,0x3A,0xBF,0xDE,0xDF,0x7A,0x00,0x5C,0x02,0x80,0x00,0x6F,0xFF,0xFF,0xF7,0xDE,0xEF,0xFE,0xF6,0x00,0x5D,0x04,0x7C,0x00,0x0E,
+    0x08,0x00,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0x11,0x4A,0x33,0x36,0x96,0xFF,0xEF,0xFF,0xEF,0x2D,0x54,0xCF,0x5C,0x39,0xB7,0xDC,0xCF,0x18,0x9F,0xEF,0x54,0x4C,0x34,
+    0x88,0x13,0x88,0x13,0x88,0x0B,0x88,0x0B,0xA8,0x03,0x02,0x00,0xF1,0x0B,0x88,0x03,0x68,0x0B,0x68,0x13,0x48,0x1B,0x8A,0x2B,0xEC,0x43,0x72,0x75,0x77,0x9E,0xB8,0xB6,
+    0x9C,0xD7,0xFE,0xE7,0xFF,0xEF,0xFF,0xF7,0x02,0x00,0x1F,0xFF,0x01,0x00,0x1F,0xFF,0x05,0x09,0x2B,0xCB,0x3B,0xB8,0xAE,0xFE,0xDF,0x8E,0x54,0x10,0x5D,0x72,0x6D,0xCB,
+    0x3B,0xAA,0x2B,0x68,0x13,0x78,0x00,0x01,0x41,0x88,0x0B,0x68,0x13,0x7A,0x00,0x86,0x23,0x8E,0x4C,0x15,0x8E,0xBC,0xC7,0xDD,0x78,0x00,0x0F,0x75,0x00,0x1F,0x07,0x32,
+    0x00,0xA0,0x73,0x7D,0xF4,0x7D,0xAF,0x5C,0x34,0x7E,0xCA,0x23,0x60,0x00,0x79,0x68,0x0B,0x88,0x0B,0x88,0x03,0x88,0xF6,0x00,0xE7,0x88,0x03,0x88,0x13,0x69,0x1B,0xAA,
+    0x2B,0xAB,0x3B,0xF0,0x6C,0x77,0xA6,0x78,0x00,0x00,0xF4,0x00,0x07,0x4A,0x00,0x0F,0x0B,0x00,0x23,0x70,0xB7,0x9E,0x91,0x65,0x89,0x23,0x48,0x6E,0x01,0x07,0x76,0x00,
+    0x00,0x84,0x00,0x30,0x88,0x0B,0x88,0xF2,0x00,0xB3,0x13,0xEB,0x2B,0xCF,0x54,0x72,0x6D,0xD8,0xA6,0xFD,0xD7,0x68,0x01,0x0F,0x69,0x00,0x23,0x0F,0x36,0x00,0x04,0x20,
+    0x89,0x23,0x70,0x01,0x00,0x70,0x00,0x06,0xEA,0x01,0x20,0x88,0x03,0x6E,0x01,0xCF,0x48,0x1B,0xAB,0x33,0xF0,0x64,0xF5,0x8D,0xD9,0xB6,0xDD,0xDF,0x7A,0x00,0x41,0x02,
+    0x91,0x00,0x0F,0x7A,0x00,0x02,0x9F,0x13,0x69,0x23,0x8E,0x4C,0x97,0x9E,0x9B,0xC7,0x7A,0x00,0x49,0x0C,0x80,0x00,0x01,0xDC,0x02,0x95,0x1B,0x69,0x23,0xCB,0x3B,0xD4,
+    0x8D,0x9C,0xCF,0xD6,0x02,0x02,0x27,0x00,0x0F,0x06,0x00,0x46,0x21,0xA8,0x03,0x6E,0x01,0xCF,0x0B,0x48,0x13,0xA9,0x23,0x8D,0x44,0x51,0x6D,0x19,0xB7,0xFE,0x6E,0x01,
+    0x48,0x0E,0xC7,0x00,0x00,0xEA,0x01,0x85,0x49,0x1B,0xCB,0x33,0xB3,0x7D,0x36,0x9E,0xCC,0x03,0x0E,0x27,0x00,0x0F,0x12,0x00,0x46,0xAF,0x49,0x1B,0x4D,0x44,0xB7,0x9E,
+    0x7B,0xC7,0xFE,0xE7,0x42,0x04,0x1D,0x4F,0xBE,0xF7,0xBE,0xFF,0x02,0x00,0x15,0x12,0x9E,0x2A,0x00,0x29,0xF7,0xDF,0xC8,0x00,0x5F,0xDF,0xFF,0xDE,0xFF,0xFD,0x48,0x04,
+    0x24,0xC0,0xBE,0xFF,0x6D,0x73,0x48,0x52,0x48,0x52,0x68,0x52,0x68,0x52,0x08,0x00,0x0F,0x04,0x00,0x0F,0x00,0x2A,0x00,0x29,0x18,0xCE,0x81,0x00,0x5A,0xFF,0xDE,0xFF,
+    0xFF,0xF7,0x12,0x00,0x0F,0x0E,0x00,0x15,0x42,0xBE,0xFF,0x4C,0x6B,0x7E,0x00,0x20,0x68,0x5A,0x02,0x00,0x26,0x48,0x5A,0x02,0x00,0x00,0x6A,0x00,0x04,0x90,0x00,0x00,
+    0x9E,0x00,0x00,0x20,0x00,0x20,0x68,0x5A,0x16,0x00,0x1B,0x17,0x80,0x00,0x2F,0x17,0xC6,0x70,0x00,0x15,0x0C,0x28,0x00,0xD1,0xDE,0xFF,0xB2,0x9C,0x0F,0x8C,0x0F,0x8C,
+    0xAE,0x7B,0x89,0x5A,0x48,0x82,0x00,0x00,0x66,0x00,0x40,0xAA,0x62,0xEF,0x8B,0x16,0x00,0x00,0x04,0x00,0x67,0xEF,0x83,0xAE,0x7B,0xEB,0x62,0x80,0x00,0x3A,0x5A,0x68,
+    0x52,0x80,0x00,0x4C,0xDE,0xFF,0xCE,0x83,0x58,0x00,0x0F,0x10,0x00,0x17,0xB1,0x7D,0xEF,0x7D,0xEF,0x5C,0xEF,0x3B,0xEF,0x54,0xB5,0x68,0xFC,0x00,0x00,0x06,0x00,0x62,
+    0x4C,0x73,0x5C,0xF7,0x5D,0xEF,0x02,0x00,0xA0,0x5C,0xEF,0x1B,0xEF,0xBA,0xDE,0xF6,0xC5,0xCE,0x83,0x9A,0x00,0x01,0xA4,0x00,0x0B,0x80,0x00,0x4F,0x79,0xD6,0x0B,0x6B,
+    0x70,0x00,0x17,0x0F,0x2A,0x00,0x05,0x35,0xFB,0xE6,0x69,0x80,0x00,0x2C,0x8D,0x7B,0x26,0x00,0x80,0xDE,0xFF,0x9D,0xF7,0x0F,0x8C,0x68,0x52,0x9E,0x00,0x0A,0x00,0x01,
+    0x6C,0xDF,0xFF,0x34,0xAD,0x68,0x5A,0x30,0x00,0x0F,0x10,0x00,0x1F,0x40,0xFB,0xE6,0x69,0x52,0xFC,0x01,0x00,0x62,0x00,0x24,0x6D,0x73,0x40,0x00,0xF1,0x01,0xDE,0xFF,
+    0x3C,0xE7,0xDB,0xDE,0xDB,0xDE,0xBE,0xF7,0xFF,0xFF,0x1B,0xE7,0xCA,0x62,0x22,0x00,0x09,0x00,0x01,0x60,0x3C,0xEF,0xEF,0x83,0x48,0x5A,0x1F,0xFF,0x01,0x00,0x07,0xFF,
+    0x2A,0xF7,0xDD,0xDF,0x97,0xA6,0x8E,0x54,0x49,0x23,0x68,0x13,0x68,0x0B,0x68,0x0B,0x68,0x13,0x48,0x13,0x48,0x1B,0x89,0x23,0x2C,0x3C,0x8E,0x44,0x8E,0x4C,0x4D,0x3C,
+    0xCA,0x2B,0x48,0x1B,0x48,0x13,0x68,0x13,0x88,0x13,0x88,0x13,0x68,0x13,0x49,0x1B,0xCB,0x3B,0xF5,0x8D,0x7B,0xCF,0xFF,0xF7,0xFF,0xF7,0x53,0x00,0x07,0x0F,0x1A,0x00,
+    0x1C,0x92,0xF7,0xFF,0xEF,0xDD,0xDF,0xF9,0xAE,0x6E,0x4C,0x6A,0x00,0x20,0x68,0x13,0x02,0x00,0x00,0x74,0x00,0x00,0x08,0x00,0x04,0x96,0x00,0xCF,0x68,0x13,0x48,0x1B,
+    0xAB,0x33,0xD4,0x85,0xBC,0xCF,0xFE,0xEF,0x7C,0x00,0x38,0x04,0xAB,0x00,0xF0,0x08,0xF7,0xFF,0xEF,0xFE,0xE7,0x5B,0xC7,0x73,0x7D,0xEC,0x43,0xAA,0x33,0xAA,0x2B,0x8A,
+    0x23,0x69,0x1B,0x49,0x1B,0x48,0x1B,0x0A,0x01,0xCF,0x8A,0x2B,0xAB,0x2B,0xCB,0x3B,0xD0,0x64,0x97,0xA6,0xFE,0xE7,0x7C,0x00,0x42,0x04,0x84,0x00,0x21,0xFF,0xFF,0x86,
+    0x00,0xF0,0x08,0xBC,0xCF,0xD8,0xA6,0x15,0x8E,0x92,0x75,0x31,0x6D,0x11,0x65,0x72,0x6D,0xD4,0x85,0x97,0x9E,0x5A,0xBF,0xFD,0xD7,0xFF,0xF6,0x00,0x0F,0x74,0x01,0x37,
+    0x06,0x74,0x00,0x0E,0x0A,0x00,0x00,0xDC,0x01,0x00,0x04,0x00,0x13,0xEF,0x74,0x00,0x00,0x0C,0x00,0x0F,0x7A,0x00,0x53,0x0E,0x8C,0x00,0x0F,0x12,0x00,0xFF,0xB5,0x23,
+    0xBE,0xFF,0x02,0x00,0x6F,0xF7,0xBE,0xF7,0xDE,0xFF,0xDF,0xD6,0x01,0x06,0x43,0xDE,0xFF,0xBE,0xF7,0x2A,0x00,0x04,0x32,0x00,0x0B,0x08,0x00,0x11,0x9E,0x20,0x00,0x3F,
+    0xDE,0xFF,0xDE,0x44,0x00,0x02,0x08,0x3E,0x00,0x17,0x9E,0x3A,0x00,0xEF,0xA9,0x5A,0x68,0x52,0x48,0x52,0x48,0x52,0x68,0x52,0x89,0x5A,0x34,0xAD,0x80,0x00,0x07,0x44,
+    0xD2,0x9C,0x89,0x52,0x2A,0x00,0x00,0x2E,0x00,0x02,0x04,0x00,0x02,0x3A,0x00,0x00,0x06,0x00,0x02,0x04,0x00,0x00,0x22,0x00,0x88,0xCA,0x62,0xF2,0xA4,0x99,0xDE,0x9E,
+    0xF7,0x4C,0x00,0x33,0x7D,0xEF,0x68,0x3E,0x00,0x02,0x28,0x00,0x06,0x06,0x00,0x01,0x18,0x00,0x30,0x5A,0x68,0x5A,0x50,0x00,0x4F,0xEF,0x83,0x5C,0xEF,0xBD,0x00,0x02,
+    0x37,0xFF,0xFF,0xFF,0x80,0x00,0x02,0x2E,0x00,0x01,0x32,0x00,0x00,0x3E,0x00,0x0F,0x04,0x00,0x00,0x85,0x5A,0x68,0x52,0x6C,0x73,0x17,0xC6,0xBE,0x84,0x00,0x20,0x9D,
+    0xF7,0x26,0x00,0x00,0x64,0x00,0x56,0x68,0x5A,0x48,0x5A,0x68,0x02,0x00,0x10,0x52,0x10,0x00,0x12,0x48,0x14,0x00,0x5F,0x52,0xEA,0x62,0x38,0xCE,0x80,0x00,0x05,0xA5,
+    0xB6,0xBD,0x0F,0x8C,0x0F,0x8C,0xEF,0x83,0x2C,0x6B,0x3E,0x00,0x90,0x52,0x68,0x52,0x0F,0x8C,0x50,0x94,0x50,0x8C,0x02,0x00,0x60,0x30,0x8C,0x0F,0x8C,0x8D,0x7B,0x66,
+    0x00,0x21,0x68,0x52,0x22,0x00,0x63,0x52,0xEB,0x62,0xD6,0xBD,0xBE,0x4F,0x00,0x40,0xBE,0xF7,0x0F,0x84,0x3E,0x00,0x32,0x0B,0x6B,0x48,0x1E,0x00,0x01,0x82,0x00,0x02,
+    0x8A,0x00,0x00,0x7E,0x00,0x00,0x04,0x00,0x00,0x36,0x00,0x24,0xD2,0xA4,0x32,0x00,0x03,0x39,0x00,0x05,0x07,0x00,0xC0,0xBE,0xF7,0x5D,0xEF,0x5D,0xEF,0x5C,0xF7,0xBA,
+    0xDE,0x0B,0x6B,0x2E,0x00,0x00,0xCC,0x00,0x64,0x48,0x52,0xFB,0xE6,0x7D,0xF7,0x02,0x00,0x85,0x5C,0xEF,0x1B,0xE7,0x58,0xD6,0x0F,0x8C,0x62,0x00,0x45,0x52,0x2C,0x6B,
+    0x7D,0x9E,0x04,0x91,0x5D,0xEF,0x7C,0xEF,0x5C,0xEF,0xB9,0xDE,0x89,0xEC,0x00,0x00,0x7A,0x00,0x21,0x48,0x52,0x06,0x00,0x03,0x10,0x00,0x02,0x54,0x00,0x48,0xCA,0x62,
+    0x1B,0xE7,0xB8,0x01,0x05,0x7F,0x00,0x05,0x09,0x00,0x40,0xDE,0xFF,0x4C,0x73,0xE2,0x00,0x00,0x80,0x00,0x35,0x68,0x52,0x5C,0x60,0x00,0x04,0x21,0x00,0x40,0x1B,0xEF,
+    0xCE,0x83,0xCA,0x00,0x84,0x68,0x5A,0x68,0x52,0x69,0x52,0x79,0xD6,0x18,0x00,0x02,0x08,0x00,0x42,0xDE,0xFF,0xCA,0x62,0x1E,0x00,0x20,0xAD,0x83,0xA8,0x00,0x00,0x76,
+    0x00,0x60,0x89,0x62,0x4C,0x73,0xAA,0x62,0x0A,0x00,0x00,0x34,0x00,0x22,0xD6,0xBD,0x2A,0x00,0x0F,0x06,0x00,0x05,0x04,0x80,0x00,0x00,0x32,0x02,0x3D,0x69,0x52,0x5D,
+    0x80,0x00,0x53,0xDE,0xFF,0x13,0xAD,0x89,0x5E,0x01,0x4A,0x48,0x52,0x75,0xB5,0x48,0x00,0x41,0xDE,0xFF,0xAA,0x62,0xF2,0x01,0x90,0x52,0x70,0x94,0x8C,0x7B,0x68,0x5A,
+    0x48,0x5A,0x1F,0xFF,0x01,0x00,0x0F,0xF1,0x0F,0xF7,0xFF,0xF7,0xFF,0xEF,0xFF,0xEF,0xDD,0xDF,0xD9,0xB6,0x77,0xA6,0xD4,0x85,0x4E,0x4C,0xAA,0x2B,0x49,0x1B,0x68,0x13,
+    0x68,0x0B,0x88,0x03,0x88,0x03,0xA8,0x02,0x00,0x00,0x08,0x00,0xF3,0x16,0x88,0x0B,0x68,0x13,0x68,0x13,0xCA,0x23,0x2B,0x34,0x89,0x1B,0x48,0x1B,0xF3,0x75,0x59,0xAF,
+    0xFD,0xD7,0xF9,0xB6,0x4A,0x33,0x29,0x23,0xEC,0x3B,0xD0,0x64,0xFF,0xEF,0x3A,0xBF,0xEB,0x33,0x88,0x34,0x00,0xAF,0x88,0x13,0x48,0x1B,0x4E,0x4C,0x97,0xA6,0x9C,0xD7,
+    0x7F,0x00,0x0F,0x07,0x22,0x00,0xF0,0x01,0xF7,0xFF,0xF7,0xFE,0xEF,0xDD,0xDF,0xBC,0xCF,0xF9,0xAE,0x31,0x65,0xCB,0x2B,0x48,0x86,0x00,0x00,0x88,0x00,0x10,0x0B,0x80,
+    0x00,0x00,0x8A,0x00,0x00,0x92,0x00,0x00,0x64,0x00,0xF0,0x09,0x68,0x0B,0xAA,0x23,0xAF,0x54,0xD8,0xA6,0xFC,0xCF,0x79,0x9F,0xAA,0x23,0x28,0x1B,0x6A,0x33,0xFF,0xE7,
+    0x1A,0xBF,0xEB,0x33,0xB4,0x00,0xE7,0xA8,0x03,0x88,0x0B,0x2B,0x2C,0xF8,0xA6,0xDD,0xD7,0xFF,0xEF,0xFF,0xF7,0x5E,0x00,0x0F,0x0B,0x00,0x13,0x00,0x0E,0x01,0x01,0x10,
+    0x01,0xE0,0xFE,0xE7,0x1A,0xBF,0x93,0x7D,0x0D,0x44,0xAB,0x33,0x69,0x1B,0x68,0x13,0x76,0x00,0x17,0xA8,0x10,0x01,0x00,0x0E,0x01,0xF0,0x05,0x48,0x1B,0xEB,0x2B,0x70,
+    0x55,0x4C,0x3C,0xF7,0x9E,0x76,0x9E,0xFF,0xEF,0x3A,0xC7,0x0C,0x3C,0x68,0x13,0xA2,0x00,0x6F,0x68,0x0B,0xF3,0x6D,0xFE,0xDF,0x7E,0x00,0x22,0x08,0xA4,0x00,0x00,0x8A,
+    0x00,0xC0,0xEF,0xFE,0xDF,0x5A,0xBF,0xF4,0x85,0xEF,0x5C,0x4C,0x3C,0x89,0x86,0x00,0x01,0x88,0x00,0x02,0x0E,0x01,0xF0,0x07,0x88,0x03,0x88,0x0B,0x88,0x0B,0x68,0x0B,
+    0xA9,0x1B,0x10,0x5D,0x55,0x8E,0x7B,0xC7,0xFD,0xCF,0x14,0x76,0xCA,0x1B,0x1C,0x00,0x6F,0x88,0x13,0x0C,0x3C,0xDD,0xD7,0xFC,0x00,0x20,0x08,0x7E,0x00,0x04,0x0C,0x00,
+    0x02,0x86,0x00,0x90,0xE7,0x5B,0xC7,0x56,0x9E,0x93,0x7D,0xEC,0x3B,0x1A,0x02,0x02,0x0C,0x01,0x00,0x0E,0x01,0x00,0xEE,0x00,0x00,0x0A,0x01,0xA0,0x68,0x1B,0x4D,0x3C,
+    0x92,0x65,0x33,0x6E,0x2B,0x24,0xA6,0x01,0x84,0xA8,0x03,0x48,0x1B,0x5A,0xBF,0xFF,0xEF,0x43,0x00,0x0F,0x08,0x00,0x32,0xC2,0xF7,0xFF,0xEF,0xFE,0xE7,0x9C,0xCF,0x39,
+    0xAF,0x72,0x6D,0xAA,0x1A,0x02,0x10,0x0B,0xEE,0x01,0x00,0xF0,0x00,0x00,0xF2,0x01,0x82,0x68,0x0B,0x88,0x13,0xA9,0x1B,0x88,0x0B,0x80,0x00,0x6F,0x68,0x13,0xAF,0x5C,
+    0xFE,0xE7,0x02,0x01,0x34,0x04,0xBF,0x00,0x00,0x0A,0x01,0xD4,0xF7,0xFE,0xEF,0xFE,0xE7,0xFE,0xDF,0xB8,0xAE,0x6F,0x54,0x8A,0x2B,0x18,0x02,0x00,0x06,0x01,0x04,0x0E,
+    0x01,0x02,0x80,0x00,0x5F,0x88,0x0B,0x28,0x23,0xFE,0x82,0x01,0x35,0x04,0x80,0x00,0x06,0x08,0x00,0x01,0x0C,0x01,0x80,0x9B,0xC7,0xD4,0x85,0xAF,0x54,0x0B,0x34,0x96,
+    0x03,0x20,0x68,0x0B,0x94,0x01,0x02,0x0C,0x01,0x00,0x82,0x00,0x6F,0x88,0x0B,0x28,0x13,0xB7,0x9E,0x82,0x01,0x3C,0x06,0x80,0x00,0x00,0x0A,0x00,0x00,0x0E,0x01,0xB4,
+    0xEF,0xDD,0xDF,0xF9,0xB6,0xD4,0x8D,0x6E,0x54,0x49,0x23,0x22,0x03,0x00,0x7E,0x00,0x00,0x0C,0x01,0x40,0x68,0x13,0x8E,0x54,0x80,0x00,0x30,0xBE,0xF7,0xDE,0x2E,0x00,
+    0x0D,0x04,0x00,0x6F,0xDF,0xFF,0xBE,0xF7,0xBE,0xFF,0x02,0x00,0x00,0x2D,0xF7,0xDF,0x2C,0x00,0x0F,0x11,0x00,0x0A,0xF1,0x01,0xF7,0xFF,0xEF,0x9C,0xCF,0x39,0xB7,0x72,
+    0x6D,0x89,0x23,0x48,0x13,0x68,0x0B,0x68,0x02,0x02,0x00,0x1C,0x03,0x9F,0xEB,0x33,0xBC,0xD7,0xFF,0xF7,0x68,0x52,0x3C,0x88,0x02,0x02,0x6C,0xF7,0xC5,0x89,0x5A,0x48,
+    0x52,0x02,0x00,0x6F,0x69,0x52,0x69,0x52,0x79,0xD6,0x70,0x00,0x0A,0x0E,0x1D,0x00,0x00,0x0A,0x01,0x90,0xF7,0xFE,0xEF,0xFD,0xDF,0xF5,0x8D,0xCB,0x3B,0xB4,0x04,0x01,
+    0x8C,0x01,0xBE,0x0B,0x89,0x23,0x15,0x96,0xFF,0xEF,0x68,0x52,0x71,0x94,0x33,0x00,0xA2,0xBE,0xFF,0x30,0x8C,0x48,0x52,0x48,0x5A,0x68,0x5A,0x04,0x00,0x51,0x48,0x5A,
+    0x48,0x52,0x68,0x8E,0x00,0x0F,0x80,0x00,0x20,0x04,0x5F,0x00,0x00,0x16,0x02,0x61,0xDF,0x76,0x9E,0xF0,0x5C,0xEB,0xB2,0x04,0xBB,0x49,0x1B,0x11,0x75,0xFE,0xE7,0x68,
+    0x5A,0x2C,0x6B,0x7D,0x54,0x01,0x60,0xDF,0xFF,0xBA,0xDE,0x2C,0x73,0x80,0x00,0x00,0x7E,0x00,0x12,0x68,0x86,0x00,0xAF,0x52,0xCA,0x62,0xEF,0x83,0x0F,0x8C,0x0F,0x84,
+    0xDB,0xB1,0x01,0x03,0x04,0x66,0x00,0x0F,0x08,0x00,0x0B,0x00,0x84,0x00,0xFA,0x04,0xE7,0xF9,0xB6,0xB3,0x85,0x4D,0x4C,0x29,0x2B,0x4E,0x5C,0x7C,0xD7,0x48,0x5A,0xAA,
+    0x62,0xF7,0xC5,0x35,0x00,0x71,0xDE,0xFF,0x54,0xB5,0x89,0x5A,0x48,0xFC,0x00,0x02,0x7E,0x00,0x00,0x88,0x01,0x8F,0xF6,0xC5,0x5C,0xEF,0x7C,0xEF,0x5D,0xEF,0x7F,0x00,
+    0x29,0x03,0x68,0x00,0xB0,0xF7,0xFE,0xE7,0x9B,0xCF,0x77,0xA6,0xB0,0x74,0x98,0xB6,0xE2,0x00,0x2A,0x91,0x9C,0x54,0x00,0x40,0x7D,0xF7,0x50,0x94,0x7E,0x00,0x40,0x89,
+    0x5A,0xEA,0x6A,0x20,0x00,0x00,0x84,0x00,0x3A,0x69,0x52,0xDA,0x25,0x00,0x03,0x4B,0x00,0x0F,0x07,0x00,0x24,0x01,0xCA,0x06,0xC8,0xFE,0xEF,0xFF,0xF7,0x48,0x5A,0x68,
+    0x52,0xAD,0x7B,0x1B,0xE7,0x48,0x00,0x31,0x79,0xD6,0x69,0xFE,0x00,0x40,0x2C,0x73,0x13,0xAD,0x7C,0x00,0x00,0x04,0x00,0x48,0x89,0x5A,0xDA,0xE6,0x24,0x00,0x0F,0x0C,
+    0x00,0x30,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0x5F,0xFF,0xEF,0xFF,0xF7,0xFF,0x01,0x00,0xFF,0xFF,0xFF,0xB4,0x0F,0xC6,0x03,0x45,0x0F,0x58,0x00,0x9D,0x0F,0xCC,0x04,0x97,
+    0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xFF,0x01,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xFF,0x01,0x00,0x2E,0xE4,0xFB,0xE6,
+    0x89,0x5A,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x48,0x5A,0x6D,0x73,0x4F,0x00,0xF0,0x01,0x3C,0xEF,0x30,0x8C,0xCA,0x62,0xEB,0x62,0x1B,0xE7,0xDE,0xFF,0xDE,0xFF,0x71,0x94,
+    0x1E,0x00,0x44,0x68,0x52,0x17,0xCE,0x20,0x00,0x84,0xDF,0xFF,0x38,0xCE,0x89,0x5A,0x48,0x52,0x10,0x00,0x0F,0x08,0x00,0x27,0x3F,0xFB,0xE6,0x69,0x80,0x00,0x00,0xA0,
+    0xFB,0xE6,0x8D,0x73,0x68,0x52,0x69,0x5A,0xFB,0xE6,0x5A,0x00,0x68,0xBA,0xDE,0x68,0x52,0x48,0x52,0x80,0x00,0x40,0xBE,0xFF,0xB1,0x9C,0xB6,0x00,0x00,0x1E,0x00,0x0F,
+    0x04,0x00,0x2B,0x0F,0x00,0x01,0x03,0x62,0x38,0xCE,0xA9,0x5A,0x68,0x5A,0x80,0x00,0x40,0xDF,0xFF,0xDE,0xFF,0xEC,0x00,0x35,0x68,0x52,0x18,0x00,0x01,0x4F,0x7D,0xF7,
+    0xCA,0x62,0x80,0x00,0x3F,0xF3,0x02,0x6C,0x73,0xBE,0xFF,0xDE,0xFF,0xBE,0xFF,0x3C,0xEF,0x71,0x94,0x68,0x52,0x68,0x5A,0x68,0x00,0x01,0x95,0xFF,0xFF,0x4C,0x73,0xA9,
+    0x5A,0xAA,0x5A,0x38,0x80,0x00,0x4F,0xB6,0xBD,0x68,0x52,0x80,0x00,0x35,0x00,0x80,0x01,0x00,0x6C,0x00,0xD1,0x68,0x5A,0xEA,0x6A,0x34,0xB5,0x34,0xAD,0x13,0xAD,0xAE,
+    0x83,0x48,0x5E,0x00,0x06,0x80,0x00,0x82,0xF7,0xC5,0x75,0xB5,0x75,0xB5,0x1C,0xE7,0x6C,0x01,0x42,0xBE,0xFF,0xEB,0x6A,0x22,0x00,0x02,0x10,0x00,0x0F,0x06,0x00,0x29,
+    0x02,0x00,0x02,0x02,0x80,0x00,0x40,0x68,0x5A,0x68,0x52,0xEA,0x01,0x02,0x5C,0x00,0x00,0x14,0x00,0x02,0x00,0x02,0x0A,0x60,0x00,0x00,0x7C,0x02,0x00,0x90,0x02,0x4A,
+    0x48,0x5A,0x89,0x5A,0x1A,0x00,0x0F,0x0E,0x00,0x21,0x00,0x00,0x02,0x00,0x6A,0x00,0x00,0x04,0x00,0x22,0x48,0x52,0x02,0x00,0x00,0x5E,0x00,0x00,0x10,0x00,0x06,0x00,
+    0x01,0x08,0x5A,0x00,0x40,0xDE,0xFF,0xCE,0x83,0x7C,0x01,0x48,0x49,0x5A,0x8D,0x7B,0x18,0x00,0x0F,0x0C,0x00,0x23,0x00,0x80,0x00,0x00,0x4E,0x00,0x00,0x74,0x00,0xB0,
+    0x2C,0x73,0x17,0xCE,0x37,0xCE,0x95,0xBD,0x2C,0x6B,0x89,0x0A,0x01,0x3F,0x5A,0x68,0x52,0x00,0x01,0x01,0x40,0x1B,0xE7,0x0B,0x6B,0x2E,0x00,0x4F,0x48,0x52,0xB6,0xBD,
+    0x74,0x00,0x23,0x08,0x36,0x00,0x00,0x80,0x00,0x00,0x4E,0x00,0x00,0x04,0x00,0x02,0x00,0x04,0x61,0xDF,0xFF,0xBE,0xFF,0xD2,0xA4,0x80,0x02,0x0F,0x80,0x00,0x02,0x20,
+    0xF2,0xA4,0x1C,0x01,0x00,0x32,0x04,0x28,0x89,0x62,0x4A,0x00,0x0F,0x0C,0x00,0x23,0x06,0x80,0x00,0x17,0x68,0x80,0x04,0x40,0x79,0xD6,0xEB,0x6A,0x0C,0x02,0x0E,0x00,
+    0x01,0x41,0x3C,0xEF,0xCE,0x83,0x9C,0x00,0x01,0xB4,0x04,0x0F,0x74,0x00,0x23,0x08,0x36,0x00,0x00,0x80,0x00,0x04,0x80,0x01,0x02,0x00,0x01,0x00,0x1E,0x00,0x4F,0xFB,
+    0xE6,0x8D,0x7B,0x80,0x00,0x01,0x51,0xDE,0xFF,0x37,0xCE,0x89,0x2C,0x05,0x55,0x89,0x5A,0x0B,0x6B,0x4C,0x30,0x05,0x00,0x34,0x00,0x0F,0x04,0x00,0x23,0x00,0x00,0x03,
+    0x00,0x7C,0x01,0x00,0xFC,0x02,0x06,0x80,0x00,0x7D,0x1C,0xE7,0xCE,0x7B,0x68,0x52,0x69,0x80,0x01,0x40,0xBE,0xFF,0xB2,0x9C,0xFE,0x00,0x5F,0x48,0x52,0xCE,0x83,0x9D,
+    0x71,0x00,0x23,0x0B,0x36,0x00,0x02,0x80,0x00,0x00,0xD2,0x01,0x26,0x68,0x52,0x80,0x00,0x93,0x7D,0xEF,0x75,0xAD,0x91,0x94,0x91,0x94,0x3C,0xF2,0x03,0x04,0x35,0x00,
+    0x31,0x3C,0xEF,0xEB,0xF8,0x04,0x44,0x69,0x52,0x34,0xAD,0x14,0x00,0x0F,0x08,0x00,0x2B,0x08,0x80,0x00,0x0F,0x50,0x03,0x0D,0x24,0xDF,0xFF,0xF8,0x04,0x3B,0xAA,0x62,
+    0x1B,0x9A,0x00,0x0F,0x86,0x00,0x23,0x61,0xDF,0xFF,0x78,0xD6,0x69,0x5A,0xFE,0x00,0x6F,0x5A,0x68,0x52,0x4C,0x73,0xDE,0x47,0x00,0x0A,0x40,0x7D,0xF7,0x0B,0x6B,0x2C,
+    0x02,0x4F,0x48,0x5A,0xAE,0x7B,0x2A,0x00,0x0B,0x0F,0x47,0x00,0x0A,0x01,0x1D,0x00,0x20,0xDF,0xFF,0x58,0x06,0x40,0xFB,0xE6,0x6C,0x73,0x7E,0x00,0x00,0x4E,0x03,0x80,
+    0x68,0x5A,0xA9,0x5A,0x54,0xB5,0x9D,0xF7,0x72,0x07,0x31,0xDE,0xFF,0xDF,0x26,0x00,0x04,0x05,0x00,0x80,0xDE,0xFF,0x9D,0xF7,0x17,0xCE,0x2C,0x6B,0xFC,0x01,0xC0,0x68,
+    0x5A,0x48,0x5A,0xEF,0x8B,0xBE,0xFF,0xDE,0xFF,0xDE,0xFF,0xFF,0x05,0x68,0x5A,0x0B,0x6B,0xF7,0xC5,0x8D,0x7B,0x48,0x5A,0x48,0x5A,0x68,0x5A,0x68,0x5A,0x2C,0x6B,0xDE,
+    0xFF,0x01,0x00,0x09,0x40,0xDE,0xFF,0x6C,0x73,0x28,0x00,0x00,0x04,0x00,0x4C,0x69,0x52,0x5D,0xF7,0x2C,0x00,0x60,0xDF,0xFF,0x75,0xB5,0xA9,0x62,0x4C,0x00,0x6A,0x48,
+    0x5A,0x48,0x52,0x75,0xB5,0x20,0x00,0x51,0xDE,0xFF,0xCA,0x62,0x68,0x6A,0x00,0x40,0x70,0x94,0x95,0xBD,0x44,0x00,0x80,0x68,0x52,0xEF,0x8B,0x9E,0xFF,0xB1,0x9C,0x16,
+    0x00,0x00,0x36,0x00,0x4A,0x68,0x52,0x38,0xCE,0x34,0x00,0x0A,0x0E,0x00,0x04,0x80,0x00,0x00,0xB0,0x00,0x3D,0x69,0x52,0x5C,0x80,0x00,0x62,0xDE,0xFF,0x13,0xA5,0x69,
+    0x5A,0x4E,0x00,0x3B,0x69,0x52,0x58,0x4C,0x00,0x05,0x80,0x00,0xF1,0x03,0x52,0x70,0x94,0xBA,0xDE,0x0A,0x6B,0x68,0x5A,0x48,0x52,0xB6,0xBD,0xDF,0xFF,0x1B,0xE7,0xA9,
+    0x98,0x00,0x7A,0x48,0x5A,0x69,0x5A,0x0B,0x6B,0xDF,0x73,0x00,0x09,0x0E,0x00,0x40,0xDE,0xFF,0x4C,0x6B,0xB8,0x00,0x00,0x80,0x00,0x1F,0x68,0x80,0x00,0x00,0x62,0x5C,
+    0xEF,0x0F,0x8C,0x48,0x52,0x22,0x00,0x3B,0xEA,0x62,0x7D,0xA0,0x00,0x06,0x80,0x00,0xF1,0x05,0x71,0x94,0x5C,0xEF,0x2F,0x8C,0x48,0x52,0xAA,0x62,0xDE,0xFF,0xDF,0xFF,
+    0xDE,0xFF,0x4C,0x73,0x48,0x52,0x54,0x00,0x59,0x5A,0xAA,0x5A,0x1B,0xE7,0x73,0x00,0x09,0x0D,0x00,0x02,0x00,0x01,0x00,0x2A,0x00,0x86,0x48,0x5A,0x68,0x52,0x3B,0xEF,
+    0xBE,0xFF,0x02,0x00,0x80,0x7D,0xF7,0xDA,0xE6,0xD2,0xA4,0x48,0x52,0x80,0x00,0x6C,0x48,0x5A,0xAA,0x62,0xD6,0xBD,0xCC,0x01,0x05,0x80,0x00,0xB2,0x5A,0x71,0x94,0xFF,
+    0xFF,0x95,0xBD,0x89,0x5A,0xB2,0x9C,0x5F,0x00,0x33,0x58,0xD6,0x68,0x80,0x00,0x4C,0x68,0x52,0x71,0x94,0x38,0x00,0x02,0x24,0x00,0x00,0x06,0x00,0x01,0x00,0x01,0x03,
+    0xE0,0x00,0x71,0x48,0x52,0xB2,0xA4,0xF3,0xAC,0xF3,0x04,0x00,0xB0,0xF2,0xA4,0xD2,0xA4,0x2F,0x8C,0x69,0x5A,0x48,0x52,0x68,0x80,0x00,0x7C,0x52,0x6C,0x73,0x95,0xBD,
+    0x9E,0xF7,0x4A,0x01,0x00,0x80,0x00,0x00,0xE8,0x00,0x00,0x64,0x00,0x80,0xDF,0xFF,0xBA,0xDE,0x2C,0x73,0x3C,0xEF,0x56,0x00,0x60,0xFF,0xFF,0xDE,0xFF,0x0B,0x6B,0xD6,
+    0x00,0x7F,0x68,0x5A,0x68,0x52,0x6C,0x73,0xDA,0x81,0x00,0x06,0x02,0x00,0x01,0x00,0x60,0x01,0x00,0xBC,0x01,0x00,0x6E,0x00,0x13,0x68,0x72,0x00,0x00,0xF8,0x00,0x00,
+    0xFA,0x00,0x8F,0x0B,0x6B,0xEE,0x8B,0x95,0xBD,0xDA,0xDE,0x43,0x00,0x01,0x00,0x80,0x00,0x01,0x3C,0x00,0xA2,0x52,0x71,0x94,0xDF,0xFF,0xBE,0xFF,0x2F,0x8C,0xBE,0x7F,
+    0x00,0x51,0xFF,0xDF,0xFF,0xF6,0xC5,0x9A,0x00,0x73,0x5A,0x68,0x52,0x89,0x5A,0x95,0xBD,0x17,0x00,0x0D,0x07,0x00,0x04,0x80,0x00,0x00,0xAC,0x02,0x00,0x72,0x00,0x00,
+    0x7E,0x00,0x01,0x04,0x00,0x01,0xD6,0x02,0x84,0x68,0x5A,0x2C,0x73,0xD2,0xA4,0xFB,0xE6,0x56,0x00,0x0C,0x3F,0x00,0x02,0x80,0x00,0x00,0x1A,0x03,0x00,0x80,0x00,0x00,
+    0x2C,0x03,0xD1,0x5C,0xEF,0x5C,0xEF,0x5D,0xEF,0x5C,0xEF,0x3C,0xEF,0x99,0xDE,0xAA,0x38,0x03,0x00,0xD8,0x00,0x4C,0xEF,0x83,0x5C,0xEF,0x3C,0x01,0x02,0x4C,0x00,0x02,
+    0x80,0x00,0x00,0x2A,0x01,0x00,0x00,0x02,0xF0,0x01,0xDA,0xE6,0x7C,0xF7,0x7D,0xF7,0x1B,0xEF,0x99,0xDE,0xD2,0xA4,0x0B,0x6B,0x69,0x5A,0x18,0x00,0x00,0xC0,0x00,0x3B,
+    0x13,0xA5,0x9D,0x7A,0x02,0x04,0x3E,0x00,0x03,0x80,0x03,0x01,0x00,0x01,0x00,0x76,0x01,0x20,0xA9,0x5A,0x02,0x00,0x50,0xAA,0x5A,0x89,0x5A,0xA9,0x36,0x03,0x01,0x04,
+    0x02,0x00,0x96,0x02,0x2F,0x79,0xD6,0x80,0x00,0x07,0x00,0x66,0x00,0x00,0x04,0x00,0x08,0x00,0x03,0x60,0xDE,0xFF,0x5C,0xEF,0x50,0x94,0x44,0x02,0x00,0x7C,0x03,0x4F,
+    0x68,0x52,0x34,0xAD,0x80,0x01,0x07,0x00,0xBA,0x00,0x00,0x00,0x01,0x00,0x94,0x00,0x02,0x3C,0x01,0x02,0x34,0x02,0x01,0x50,0x01,0x01,0x86,0x04,0x4F,0x68,0x5A,0xD2,
+    0x9C,0x80,0x00,0x07,0x00,0x62,0x00,0x00,0x80,0x00,0x1B,0x48,0x80,0x03,0x31,0x7D,0xF7,0x89,0x02,0x01,0x00,0x1C,0x00,0x2F,0x8D,0x7B,0x02,0x01,0x01,0x04,0x80,0x01,
+    0x00,0x80,0x02,0x00,0x7E,0x00,0xA0,0xFF,0xFF,0x4C,0x6B,0x4C,0x6B,0x4C,0x73,0x4C,0x73,0x08,0x00,0x41,0x2C,0x6B,0xAA,0x62,0x1E,0x02,0x4D,0x5A,0x48,0x5A,0xCA,0xBC,
+    0x03,0x02,0x30,0x00,0x02,0x80,0x01,0x00,0x26,0x00,0x3B,0x48,0x5A,0x49,0x80,0x00,0x40,0xFF,0xFF,0xD2,0xA4,0x1A,0x00,0x00,0xA0,0x00,0x42,0x2C,0x73,0xFB,0xE6,0x32,
+    0x00,0x08,0x06,0x00,0x0E,0x80,0x00,0x0A,0x1E,0x00,0x44,0x14,0xAD,0x89,0x5A,0x86,0x02,0x00,0xBE,0x03,0x0E,0x04,0x01,0x01,0x80,0x00,0x03,0x80,0x03,0x0E,0x80,0x00,
+    0x31,0xBA,0xDE,0x68,0x1C,0x00,0x00,0x88,0x02,0x11,0xBA,0x81,0x01,0x55,0x7D,0xEF,0x3C,0xEF,0x5D,0x4C,0x02,0x0F,0x80,0x00,0x0B,0x60,0xDF,0xFF,0xFB,0xE6,0xEB,0x6A,
+    0x80,0x00,0x00,0x48,0x03,0x2F,0xA9,0x5A,0x42,0x01,0x03,0x22,0x6C,0x73,0x64,0x00,0x00,0xC6,0x01,0x19,0x5C,0xE2,0x03,0x00,0x04,0x02,0x02,0x00,0x01,0x00,0x56,0x06,
+    0x02,0x7C,0x05,0x75,0x0B,0x6B,0x69,0x52,0x4C,0x6B,0x5D,0xE6,0x03,0x06,0x80,0x02,0x08,0xFA,0x00,0x02,0x0C,0x00,0x00,0x08,0x05,0x20,0xCE,0x83,0x80,0x00,0x01,0x46,
+    0x00,0x2F,0x52,0xB6,0x86,0x03,0x00,0x01,0x2A,0x05,0x00,0xAA,0x02,0x00,0x70,0x03,0x23,0x52,0x5C,0x58,0x00,0x02,0x40,0x00,0x42,0xFF,0xFF,0x7D,0xF7,0x9C,0x00,0xA0,
+    0x68,0x5A,0xA9,0x5A,0xB5,0xBD,0xDF,0xFF,0xDF,0xFF,0xD0,0x00,0x08,0x80,0x00,0x00,0xE2,0x01,0x00,0xBA,0x00,0x04,0x80,0x02,0x04,0x3A,0x00,0x02,0x08,0x00,0x40,0xDF,
+    0xFF,0x38,0xCE,0xC4,0x02,0x00,0xDE,0x03,0x4C,0x68,0x5A,0x8D,0x7B,0x60,0x00,0x00,0x32,0x03,0x14,0x4C,0x00,0x07,0x2F,0x52,0x68,0x80,0x00,0x02,0x00,0x3C,0x00,0xF4,
+    0x01,0x48,0x5A,0x89,0x5A,0x13,0xAD,0xDE,0xFF,0xDE,0xFF,0xAA,0x5A,0x68,0x52,0xAD,0x7B,0x08,0x06,0x23,0xDE,0xFF,0x80,0x00,0x41,0x5A,0x50,0x94,0xFE,0x73,0x00,0x01,
+    0xA5,0x01,0x10,0xFF,0x58,0x00,0x00,0x2E,0x00,0x50,0xDE,0xFF,0x99,0xDE,0x69,0xD0,0x04,0x00,0xDE,0x00,0x90,0x5A,0x48,0x52,0xAE,0x7B,0x58,0xD6,0xBE,0xFF,0x06,0x02,
+    0x00,0x1C,0x01,0x00,0x22,0x00,0x20,0x79,0xD6,0x28,0x05,0x02,0x20,0x01,0x60,0x48,0x52,0x33,0xAD,0xBE,0xFF,0x16,0x00,0x04,0x46,0x00,0x20,0x9D,0xF7,0x44,0x03,0x00,
+    0x82,0x00,0x80,0x68,0x5A,0xAD,0x7B,0xFA,0xE6,0xB6,0xBD,0x5A,0x03,0x42,0x71,0x94,0x9E,0xF7,0x26,0x00,0x20,0x79,0xD6,0x1C,0x00,0xC0,0x48,0x5A,0x48,0x5A,0xEA,0x62,
+    0xBA,0xDE,0xDE,0xFF,0xDE,0xFF,0xA6,0x48,0x5A,0x68,0x52,0xCA,0x62,0xF7,0xC5,0xDF,0xFF,0x01,0x00,0xF1,0x00,0xF3,0xA4,0x68,0x52,0x48,0x5A,0x48,0x5A,0x70,0x94,0x75,
+    0xBD,0x48,0x5A,0x68,0x02,0x00,0x46,0x89,0x5A,0xDA,0xE6,0x22,0x00,0x0F,0x0A,0x00,0x37,0x00,0x68,0x00,0x55,0x68,0x52,0xF3,0xA4,0xBE,0x53,0x00,0xDF,0xDE,0xFF,0xCA,
+    0x62,0x48,0x5A,0x48,0x52,0x48,0x52,0xBA,0xDE,0x95,0x80,0x00,0x50,0x84,0x68,0x5A,0x48,0x52,0x2C,0x73,0x3C,0xEF,0x02,0x01,0x20,0xB6,0xBD,0xFE,0x00,0xAF,0x68,0x5A,
+    0x0B,0x6B,0xBE,0xFF,0x75,0xB5,0x68,0x52,0x00,0x01,0x4B,0x21,0x68,0x5A,0x62,0x01,0x32,0x52,0x99,0xD6,0x01,0x01,0x60,0xDE,0xFF,0x2C,0x6B,0x48,0x52,0x14,0x00,0x6F,
+    0xF6,0xC5,0xDE,0xFF,0x95,0xBD,0x80,0x00,0x4D,0x00,0x6A,0x00,0x00,0x04,0x02,0x31,0xB1,0x9C,0xDE,0x81,0x00,0x20,0x99,0xD6,0x72,0x00,0x70,0x48,0x5A,0xEB,0x62,0x5D,
+    0xF7,0xFF,0x80,0x00,0x01,0xFE,0x01,0x2F,0x68,0x5A,0x00,0x02,0x45,0x00,0x5E,0x01,0x00,0x04,0x02,0x20,0xAA,0x5A,0x80,0x00,0xC0,0xDE,0xFF,0x70,0x94,0x68,0x52,0x48,
+    0x52,0x68,0x52,0xB2,0x9C,0x12,0x02,0x20,0x95,0xB5,0x20,0x00,0x00,0x04,0x00,0x0F,0x80,0x00,0x45,0x20,0x89,0x5A,0x82,0x01,0x00,0x02,0x01,0x80,0x17,0xC6,0xDE,0xFF,
+    0xFB,0xE6,0x4C,0x73,0x7E,0x01,0x40,0x89,0x5A,0x38,0xCE,0x10,0x02,0x0F,0x80,0x00,0x4F,0x02,0xEC,0x02,0x01,0x84,0x02,0xF0,0x00,0x6B,0xDE,0xFF,0x75,0xB5,0xA9,0x62,
+    0x48,0x52,0x68,0x5A,0xAD,0x7B,0x1B,0xE7,0x8F,0x01,0x0F,0x80,0x00,0x4F,0x20,0xEF,0x83,0xF0,0x00,0x00,0x72,0x01,0x60,0xAA,0x62,0xBA,0xDE,0x2F,0x8C,0x7E,0x00,0x40,
+    0x68,0x5A,0xF3,0xA4,0x8E,0x01,0x2F,0xFF,0xFF,0x80,0x00,0x4F,0x22,0xDB,0xE6,0x70,0x02,0x80,0x48,0x5A,0x69,0x5A,0xAE,0x83,0x0B,0x6B,0x0A,0x01,0x40,0xEB,0x6A,0x58,
+    0xCE,0xFE,0x00,0x06,0x80,0x00,0x2F,0x48,0x52,0x00,0x02,0x45,0x40,0xDE,0xFF,0x0B,0x6B,0xF0,0x03,0x00,0x72,0x04,0x00,0x68,0x02,0x00,0x8C,0x02,0x20,0x8D,0x7B,0x7C,
+    0x02,0x00,0x82,0x00,0x0F,0x00,0x01,0x4F,0x40,0xDF,0xFF,0xF7,0xC5,0xEC,0x04,0x00,0x78,0x00,0x02,0x04,0x00,0x40,0x68,0x5A,0x34,0xAD,0x7C,0x02,0x0F,0x80,0x00,0x53,
+    0x51,0xFF,0xFF,0xFB,0xE6,0xCA,0x74,0x02,0x02,0xFE,0x00,0x60,0x68,0x5A,0x69,0x5A,0x7D,0xF7,0x7C,0x00,0x00,0x04,0x00,0x11,0x95,0x00,0x05,0x00,0x24,0x04,0x1F,0x69,
+    0x00,0x06,0x44,0x60,0xFF,0xFF,0x9D,0xF7,0x30,0x8C,0x04,0x02,0x00,0x80,0x00,0x00,0xFE,0x01,0x24,0x0F,0x8C,0xFE,0x00,0x10,0xDF,0x80,0x02,0x01,0x8A,0x06,0x00,0x96,
+    0x00,0x0F,0x80,0x06,0x43,0x20,0xFF,0xFF,0x66,0x05,0x12,0x69,0x86,0x05,0x10,0x5A,0x06,0x02,0x06,0x68,0x00,0x01,0x80,0x00,0x03,0x1A,0x00,0x3F,0x89,0x5A,0xBA,0x00,
+    0x07,0x42,0x80,0xDE,0xFF,0xDE,0xFF,0x99,0xDE,0x4C,0x73,0x86,0x04,0x00,0xFE,0x00,0x22,0x6D,0x73,0x7A,0x03,0x00,0x18,0x00,0x41,0x3C,0xEF,0xEF,0x8B,0x9E,0x03,0x01,
+    0x84,0x05,0x64,0xB1,0x9C,0x9E,0xFF,0xDF,0xFF,0x1C,0x01,0x00,0x9E,0x01,0x0F,0x04,0x00,0x2C,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xFF,0x01,0x00,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0x6C,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xFF,0x01,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xFF,0x01,0x00,0x24,0xF1,
+    0x00,0xBE,0xFF,0x8D,0x73,0xAA,0x5A,0x89,0x5A,0x68,0x52,0x48,0x52,0x48,0x5A,0x68,0x02,0x00,0x00,0x08,0x00,0xAA,0x48,0x52,0x68,0x5A,0xA9,0x5A,0xCA,0x62,0x13,0xA5,
+    0x59,0x00,0x20,0x0B,0x6B,0x2A,0x00,0x20,0x68,0x52,0x06,0x00,0xCA,0x48,0x5A,0x48,0x5A,0x48,0x52,0x89,0x5A,0xAA,0x5A,0xAA,0x5A,0x26,0x00,0x0F,0x0E,0x00,0x17,0x50,
+    0xBE,0xFF,0x4C,0x6B,0x48,0x7C,0x00,0x30,0x52,0x48,0x52,0x56,0x00,0x01,0x58,0x00,0x01,0x10,0x00,0x00,0x0E,0x00,0x4A,0x69,0x52,0xF3,0xA4,0x4C,0x00,0x22,0xCA,0x62,
+    0x22,0x00,0x00,0x1E,0x00,0x02,0x38,0x00,0x02,0x10,0x00,0x0A,0x26,0x00,0x0F,0x0E,0x00,0x17,0x77,0xDE,0xFF,0xB2,0x9C,0x30,0x8C,0x2F,0x02,0x00,0x53,0x0F,0x8C,0x10,
+    0x8C,0x10,0x10,0x00,0x4A,0x50,0x8C,0xF7,0xC5,0x4C,0x00,0x26,0x71,0x94,0x2E,0x00,0x00,0x28,0x00,0x02,0x0E,0x00,0x2A,0x30,0x8C,0x26,0x00,0x0F,0x0E,0x00,0x19,0x3F,
+    0xDF,0xFF,0xDE,0x02,0x00,0x0A,0x0A,0x4C,0x00,0x0F,0x2E,0x00,0x05,0x0A,0x26,0x00,0x0F,0x0E,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,
+    0x06,0xA9,0x5A,0x5D,0xEF,0xFF,0xFF,0xFF,0xFF,0x6C,0x73,0xA9,0x5A,0xA9,0x5A,0x89,0x5A,0x68,0x5A,0x48,0x52,0x48,0x06,0x00,0x00,0x04,0x00,0x21,0x52,0x48,0x02,0x00,
+    0x71,0x8D,0x73,0xBE,0xFF,0xF3,0xA4,0xAA,0x20,0x00,0x00,0x12,0x00,0x22,0x68,0x5A,0x02,0x00,0x60,0x48,0x52,0x68,0x52,0x89,0x5A,0x02,0x00,0x30,0x6D,0x73,0xDE,0x45,
+    0x00,0xF0,0x02,0xFF,0x9D,0xF7,0x0B,0x6B,0x48,0x52,0x68,0x5A,0x48,0x5A,0x48,0x5A,0x28,0x52,0x69,0x5A,0x0C,0x00,0x62,0x89,0x5A,0x17,0xC6,0x9D,0xF7,0x5E,0x00,0x00,
+    0x5C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x02,0x3C,0x00,0x31,0x48,0x52,0x5C,0x80,0x00,0x51,0x2C,0x6B,0x68,0x52,0x68,0x6E,0x00,0x01,0x62,0x00,0x05,0x0A,0x00,0x00,
+    0x64,0x00,0x70,0x4C,0x73,0xDE,0xFF,0xB2,0x9C,0x89,0x9A,0x00,0x03,0x18,0x00,0x06,0x2A,0x00,0x00,0x2E,0x00,0x51,0x48,0x52,0x2C,0x6B,0xDF,0x80,0x00,0x44,0xDE,0xFF,
+    0x75,0xB5,0xC4,0x00,0x00,0x3A,0x00,0xAC,0x48,0x52,0x69,0x5A,0xEF,0x83,0x1B,0xE7,0x9D,0xF7,0x32,0x00,0x02,0x38,0x00,0x60,0x48,0x52,0x30,0x8C,0x9D,0xF7,0x3B,0x00,
+    0xD1,0xB2,0x9C,0x30,0x8C,0x2F,0x8C,0x2F,0x8C,0x10,0x8C,0x30,0x8C,0x10,0x06,0x00,0x00,0x08,0x00,0x00,0x14,0x00,0xA0,0x30,0x8C,0xD2,0x9C,0xDE,0xFF,0xD6,0xBD,0x30,
+    0x8C,0x0E,0x00,0x00,0x24,0x00,0x06,0x08,0x00,0xA2,0x10,0x8C,0x2F,0x8C,0x0F,0x8C,0x0F,0x8C,0xB2,0x9C,0x80,0x00,0x82,0xFF,0xFF,0x5D,0xEF,0xF3,0xA4,0xCA,0x62,0x7C,
+    0x00,0x00,0xE2,0x00,0x84,0x50,0x94,0xFB,0xE6,0xFF,0xFF,0x9E,0xF7,0x34,0x00,0x11,0x0F,0x64,0x00,0x00,0x38,0x00,0x00,0x4A,0x00,0x22,0x10,0x8C,0x38,0x01,0x33,0xFF,
+    0xFF,0xDE,0x02,0x00,0x13,0xBE,0x08,0x00,0x04,0x10,0x00,0x02,0x08,0x00,0x3F,0xFF,0xFF,0xDF,0x18,0x00,0x02,0x02,0x1E,0x00,0x00,0x06,0x00,0x00,0xC4,0x00,0x02,0x04,
+    0x00,0xEC,0xDE,0xFF,0x7D,0xF7,0x79,0xD6,0xB6,0xBD,0x75,0xB5,0x58,0xCE,0x7C,0xEF,0x60,0x00,0x00,0x2C,0x00,0x08,0x04,0x00,0x02,0x34,0x00,0x0F,0x06,0x00,0x3F,0x24,
+    0xDF,0xFF,0x12,0x01,0x0F,0x5C,0x00,0x3F,0x0F,0x52,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x39,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x13,0xAA,0x5A,0xDE,0xFF,0x9D,0xFF,0x50,
+    0x94,0x68,0x5A,0x48,0x52,0x68,0x5A,0x68,0x5A,0x75,0xB5,0xDE,0xFF,0x1B,0xE7,0xAE,0x7B,0xA9,0x5A,0xA9,0x62,0x68,0x52,0x48,0x52,0x48,0x5A,0x02,0x00,0x10,0x68,0x06,
+    0x00,0xAF,0x52,0x69,0x5A,0xAA,0x5A,0xA9,0x5A,0x79,0xD6,0xFF,0x01,0x00,0x38,0xA0,0x69,0x52,0xDF,0xFF,0xDF,0xFF,0x95,0xB5,0xA9,0x5A,0x6E,0x00,0x40,0xEB,0x6A,0xDA,
+    0xDE,0x80,0x00,0x30,0x6D,0x73,0x48,0x7C,0x00,0x10,0x52,0x14,0x00,0x02,0x0A,0x00,0x01,0x8A,0x00,0x5F,0x52,0x68,0x52,0x68,0x52,0x80,0x00,0x3B,0x20,0x30,0x8C,0xCD,
+    0x00,0xF0,0x05,0x3C,0xEF,0x91,0x94,0x0F,0x8C,0x0F,0x8C,0x54,0xAD,0x9D,0xF7,0xFF,0xFF,0x5C,0xEF,0xF3,0xA4,0x30,0x8C,0x02,0x00,0xA2,0x10,0x8C,0x0F,0x8C,0x2F,0x8C,
+    0x10,0x8C,0x30,0x8C,0x0A,0x00,0x60,0x2F,0x8C,0x2F,0x8C,0xFB,0xE6,0x32,0x00,0x0F,0x04,0x00,0x35,0x13,0xDE,0x49,0x00,0x77,0xDE,0xFF,0xDE,0xFF,0xBE,0xFF,0xDF,0x0E,
+    0x00,0x00,0x12,0x00,0x06,0x04,0x00,0x11,0xBE,0x20,0x00,0x00,0x24,0x00,0x03,0x23,0x00,0x0F,0x07,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x35,0x50,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0x1F,0xFF,0x01,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x6C,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xFF,0x01,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6D,0x50,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0x1F,0xFF,0x01,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6D,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xFF,0x01,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6D,0x50,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0x1F,0xFF,0x01,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6D,0x50,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xFF,0x01,0x00,0xFF,0xFF,0xFF,0xFF,0x63,0x50,0xFF,
+    0xFF,0xFF,0xFF,0xFF,
 };
+
 const lv_img_dsc_t ui_img_cgflogo_png = {
     .header.always_zero = 0,
     .header.w = 300,
     .header.h = 173,
     .data_size = sizeof(ui_img_cgflogo_png_data),
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_RAW,
     .data = ui_img_cgflogo_png_data
 };
-
@@ -72,6 +72,23 @@ void setup() {
     ui_init(); // This should handle lv_init, buffer, disp/indev driver setup
     Serial.println("M7: UI Initialized.");
 
+    // Pre-render the glyphs of the label fonts once, instead of unpacking them on every redraw.
+    // The temperature label needs only " -.0-9%" and "C" (~14 KB), the status labels all of ASCII (~22 KB).
+    // Together with the glyph caches (~1.3 KB each) it's about 15% of the 256 KB LVGL heap.
+    if (lv_font_fmt_txt_cache_create(&lv_font_montserrat_36) != LV_RES_OK ||
+        lv_font_fmt_txt_cache_create(&lv_font_montserrat_26) != LV_RES_OK) {
+        Serial.println("M7: WARNING - Font glyph cache allocation failed.");
+    }
+    if (lv_font_fmt_txt_atlas_create(&lv_font_montserrat_36, ' ', 'C') != LV_RES_OK) {
+        Serial.println("M7: WARNING - Font atlas of the temperature label failed, drawing it unpacked.");
+    }
+    if (lv_font_fmt_txt_atlas_create(&lv_font_montserrat_26, ' ', '~') != LV_RES_OK) {
+        Serial.println("M7: WARNING - Font atlas of the status labels failed, drawing them unpacked.");
+    }
+
+    // The panels aren't drawn from layer snapshots (LV_OBJ_FLAG_CACHE_LAYER): the temperature and settings labels
+    // in them are set on every data exchange, which is slower with a snapshot to update.
+
     initialize_wifi(); 
     
     initialize_ntp_and_rtc(); // Uses RTC, then tries NTP
@@ -249,6 +266,12 @@ void loop() {
     if (currentTimeMs - lastLoopHeartbeat >= LOOP_HEARTBEAT) {
         Serial.println("M7 Loop Heartbeat...");
         get_reset_reason();
+#if LV_USE_PERF_STATS
+        static char perfTextBuf[256];
+        lv_perf_stats_to_text(perfTextBuf, sizeof(perfTextBuf));
+        Serial.println("LVGL perf:");
+        Serial.println(perfTextBuf);
+#endif
         lastLoopHeartbeat = currentTimeMs;
     }
     
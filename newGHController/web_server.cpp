@@ -8,6 +8,7 @@
 #include <WiFi.h>
 #include <RPC.h>
 #include <stdio.h>
+#include "lvgl.h"
 
 WiFiServer M7webServer(80);
 bool serverIsInitialized_ws = false;
@@ -432,6 +433,23 @@ void handle_web_server_clients() {
                 client.println("HTTP/1.1 302 Found"); client.println("Location: /"); client.println("Connection: close"); client.println();
                 sentSpecificResponse = true;
             } 
+#if LV_USE_PERF_STATS
+            else if (httpRequestPathAndParams == "/perf" || httpRequestPathAndParams.startsWith("/perf?")) {
+                // LVGL refresh statistics as JSON. "/perf?overlay=1" (or 0) toggles the on-screen overlay.
+                if (httpRequestPathAndParams.indexOf("overlay=1") != -1) lv_perf_stats_set_overlay(true);
+                else if (httpRequestPathAndParams.indexOf("overlay=0") != -1) lv_perf_stats_set_overlay(false);
+                if (httpRequestPathAndParams.indexOf("reset=1") != -1) lv_perf_stats_reset();
+
+                static char perfJsonBuf[1024];
+                uint32_t perfJsonLen = lv_perf_stats_to_json(perfJsonBuf, sizeof(perfJsonBuf));
+                if (perfJsonLen >= sizeof(perfJsonBuf)) perfJsonLen = sizeof(perfJsonBuf) - 1; // Truncated, still send what fits
+                Serial.println("WebServer-DBG: Serving LVGL perf stats JSON.");
+                client.println("HTTP/1.1 200 OK"); client.println("Content-Type: application/json"); client.println("Connection: close");
+                client.print("Content-Length: "); client.println(perfJsonLen); client.println();
+                client.write((const uint8_t*)perfJsonBuf, perfJsonLen);
+                sentSpecificResponse = true;
+            }
+#endif
             else if (httpRequestPathAndParams == "/" || httpRequestPathAndParams.startsWith("/index.html") || httpRequestPathAndParams.length() == 0) {
                 Serial.println("WebServer-DBG: Serving main HTML page.");
                 client.println("HTTP/1.1 200 OK"); client.println("Content-type:text/html"); client.println("Connection: close"); client.println();
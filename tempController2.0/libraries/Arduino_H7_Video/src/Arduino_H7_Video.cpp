@@ -49,6 +49,11 @@ static void inc_thd() {
 static rtos::Thread lvgl_inc_thd;
 #else
 void lvgl_displayFlushing(lv_disp_drv_t * disp, const lv_area_t * area, lv_color_t * color_p);
+void lvgl_displayFlushingDirect(lv_disp_drv_t * disp, const lv_area_t * area, lv_color_t * color_p);
+static void lvgl_flushRotated(lv_disp_drv_t * disp, const lv_area_t * area, lv_color_t * color_p);
+static void lvgl_rotate(const lv_color_t * src, lv_color_t * dest, lv_coord_t w, lv_coord_t h, uint32_t destStride, lv_disp_rot_t rotation);
+static void lvgl_flushReady();
+static lv_disp_drv_t * lvgl_flushingDisp = nullptr;
 #endif
 #endif
 
@@ -61,6 +66,7 @@ Arduino_H7_Video::Arduino_H7_Video(int width, int height, H7DisplayShield &shiel
   _height   = height;
   _width    = width;
   _shield   = &shield;
+  _renderMode = H7_VIDEO_RENDER_PARTIAL;
   _edidMode = _shield->getEdidMode(width, height);
 
   switch(_edidMode) {
@@ -92,6 +98,9 @@ int Arduino_H7_Video::begin() {
   /* Video controller/bridge init */
   _shield->init(_edidMode);
 
+  /* Configure SDRAM, the LVGL draw buffers may be allocated there */
+  SDRAM.begin(dsi_getFramebufferEnd()); //FIXME: SDRAM init after video controller init can cause display glitch at start-up
+
   #if __has_include("lvgl.h")
     /* Initiliaze LVGL library */
     lv_init();
@@ -123,19 +132,50 @@ int Arduino_H7_Video::begin() {
 
   #else //LVGL_VERSION_MAJOR
 
+    /* Direct rendering needs the LVGL and frame buffer lines to match */
+    if (_renderMode == H7_VIDEO_RENDER_DIRECT && (_rotated || (uint32_t)width() != dsi_getDisplayXSize())) {
+      _renderMode = H7_VIDEO_RENDER_DOUBLE_PARTIAL;
+    }
+
       /* Create a draw buffer */
     static lv_disp_draw_buf_t draw_buf;
     static lv_color_t * buf1;
-    buf1 = (lv_color_t*)malloc((width() * height() / 10) * sizeof(lv_color_t)); /* Declare a buffer for 1/10 screen size */
-    if (buf1 == NULL) {
-      return 2; /* Insuff memory err */
+    static lv_color_t * buf2;
+    uint32_t buf_size;
+    switch (_renderMode) {
+      case H7_VIDEO_RENDER_DIRECT:
+        buf_size = width() * height();
+        buf1 = (lv_color_t*)dsi_getCurrentFrameBuffer();  /* Back buffer, shown after the first frame */
+        buf2 = (lv_color_t*)dsi_getActiveFrameBuffer();
+        break;
+      case H7_VIDEO_RENDER_DOUBLE_PARTIAL:
+        buf_size = width() * height() / 10;
+        buf1 = (lv_color_t*)SDRAM.malloc(buf_size * sizeof(lv_color_t)); /* Declare two buffers for 1/10 screen size */
+        buf2 = (lv_color_t*)SDRAM.malloc(buf_size * sizeof(lv_color_t));
+        if (buf1 == NULL || buf2 == NULL) {
+          return 2; /* Insuff memory err */
+        }
+        break;
+      default:
+        buf_size = width() * height() / 10;
+        buf1 = (lv_color_t*)malloc(buf_size * sizeof(lv_color_t)); /* Declare a buffer for 1/10 screen size */
+        buf2 = NULL;
+        if (buf1 == NULL) {
+          return 2; /* Insuff memory err */
+        }
+        break;
     }
-    lv_disp_draw_buf_init(&draw_buf, buf1, NULL, width() * height() / 10);      /* Initialize the display buffer. */
+    lv_disp_draw_buf_init(&draw_buf, buf1, buf2, buf_size);      /* Initialize the display buffer. */
 
     /* Initialize display features for LVGL library */
     static lv_disp_drv_t disp_drv;              /* Descriptor of a display driver */
     lv_disp_drv_init(&disp_drv);                /* Basic initialization */
-    disp_drv.flush_cb = lvgl_displayFlushing;   /* Set your driver function */
+    if (_renderMode == H7_VIDEO_RENDER_DIRECT) {
+      disp_drv.flush_cb = lvgl_displayFlushingDirect;
+      disp_drv.direct_mode = 1;
+    } else {
+      disp_drv.flush_cb = lvgl_displayFlushing;   /* Set your driver function */
+    }
     disp_drv.draw_buf = &draw_buf;              /* Assign the buffer to the display */
     if(_rotated) {
       disp_drv.hor_res = height();        /* Set the horizontal resolution of the display */
@@ -146,15 +186,12 @@ int Arduino_H7_Video::begin() {
       disp_drv.ver_res = height();        /* Set the vertical resolution of the display */
       disp_drv.rotated  = LV_DISP_ROT_NONE;
     }
-    disp_drv.sw_rotate = 1;
+    disp_drv.sw_rotate = 0;                     /* The flush rotates the areas, LVGL doesn't need to */
     lv_disp_drv_register(&disp_drv);        /* Finally register the driver */
 
   #endif
   #endif
 
-  /* Configure SDRAM */
-  SDRAM.begin(dsi_getFramebufferEnd()); //FIXME: SDRAM init after video controller init can cause display glitch at start-up
-
   return 0;
 }
 
@@ -170,6 +207,14 @@ bool Arduino_H7_Video::isRotated() {
   return _rotated;
 }
 
+void Arduino_H7_Video::setRenderMode(H7VideoRenderMode mode) {
+  _renderMode = mode;
+}
+
+H7VideoRenderMode Arduino_H7_Video::getRenderMode() {
+  return _renderMode;
+}
+
 void Arduino_H7_Video::end() {
 #ifdef HAS_ARDUINOGRAPHICS
   ArduinoGraphics::end();
@@ -231,48 +276,150 @@ void Arduino_H7_Video::set(int x, int y, uint8_t r, uint8_t g, uint8_t b) {
 
 #if __has_include("lvgl.h")
 #if (LVGL_VERSION_MAJOR == 9)
-static uint8_t* rotated_buf = nullptr;
 void lvgl_displayFlushing(lv_display_t * disp, const lv_area_t * area, unsigned char * px_map) {
     uint32_t w     = lv_area_get_width(area);
     uint32_t h     = lv_area_get_height(area);
-    lv_area_t* area_in_use = (lv_area_t *)area;
 
-    // TODO: find a smart way to tackle sw rotation
     lv_display_rotation_t rotation = lv_display_get_rotation(disp);
-    lv_area_t rotated_area;
     if (rotation != LV_DISPLAY_ROTATION_0) {
-        rotated_buf = (uint8_t*)realloc(rotated_buf, w * h * 4);
+        /* Rotate straight into the frame buffer: no temporary buffer and no second copy by the DMA2D */
+        uint32_t x1 = lv_display_get_vertical_resolution(disp) - area->y2 - 1;
+        uint32_t y1 = area->x1;
+        uint32_t fbStride = dsi_getDisplayXSize() * sizeof(uint16_t);
+        uint8_t * fbLine = (uint8_t *)dsi_getActiveFrameBuffer() + y1 * fbStride;
         lv_color_format_t cf = lv_display_get_color_format(disp);
-        lv_draw_sw_rotate(px_map, rotated_buf,
-                          w, h, lv_draw_buf_width_to_stride(w, cf),
-                          lv_draw_buf_width_to_stride(h, cf),
+
+        dsi_waitTransfer();
+        lv_draw_sw_rotate(px_map, fbLine + x1 * sizeof(uint16_t),
+                          w, h, lv_draw_buf_width_to_stride(w, cf), fbStride,
                           LV_DISPLAY_ROTATION_90, cf);
-        rotated_area.x1 = lv_display_get_vertical_resolution(disp) - area->y2 - 1;
-        rotated_area.y1 = area->x1;
-        //rotated_area.y2 = dsi_getDisplayYSize() - area->x1 - 1;
-        rotated_area.x2 = rotated_area.x1 + h - 1;
-        rotated_area.y2 = rotated_area.y1 + w + 1;
-
-        area_in_use = &rotated_area;
-        px_map = rotated_buf;
-        auto temp = w;
-        w = h;
-        h = temp;
+#if defined(__CORTEX_M7)
+        /* The LTDC reads the frame buffer from the SDRAM */
+        SCB_CleanDCache_by_Addr((uint32_t *)((uint32_t)fbLine & ~31UL), w * fbStride + 32);
+#endif
+        lv_display_flush_ready(disp);
+        return;
     }
 
-    uint32_t offsetPos  = (area_in_use->x1 + (dsi_getDisplayXSize() * area_in_use->y1)) * sizeof(uint16_t);
+    uint32_t offsetPos  = (area->x1 + (dsi_getDisplayXSize() * area->y1)) * sizeof(uint16_t);
 
     dsi_lcdDrawImage((void *) px_map, (void *)(dsi_getActiveFrameBuffer() + offsetPos), w, h, DMA2D_INPUT_RGB565);
     lv_display_flush_ready(disp);         /* Indicate you are ready with the flushing*/
 }
 #else
 void lvgl_displayFlushing(lv_disp_drv_t * disp, const lv_area_t * area, lv_color_t * color_p) {
+    if (disp->rotated != LV_DISP_ROT_NONE) {
+      lvgl_flushRotated(disp, area, color_p);
+      return;
+    }
+
     uint32_t width      = lv_area_get_width(area);
     uint32_t height     = lv_area_get_height(area);
     uint32_t offsetPos  = (area->x1 + (dsi_getDisplayXSize() * area->y1)) * sizeof(uint16_t);
 
-    dsi_lcdDrawImage((void *) color_p, (void *)(dsi_getActiveFrameBuffer() + offsetPos), width, height, DMA2D_INPUT_RGB565);
-    lv_disp_flush_ready(disp);         /* Indicate you are ready with the flushing*/
+    /* Start the copy and return, LVGL can render into the other buffer meanwhile */
+    lvgl_flushingDisp = disp;
+    dsi_lcdDrawImageAsync((void *) color_p, (void *)(dsi_getActiveFrameBuffer() + offsetPos), width, height, DMA2D_INPUT_RGB565, lvgl_flushReady);
+}
+
+void lvgl_displayFlushingDirect(lv_disp_drv_t * disp, const lv_area_t * area, lv_color_t * color_p) {
+    /* The areas are already in the frame buffer, show it when the last one is rendered */
+    if (!lv_disp_flush_is_last(disp)) {
+      lv_disp_flush_ready(disp);
+      return;
+    }
+
+    lvgl_flushingDisp = disp;
+    dsi_drawCurrentFrameBufferAsync(lvgl_flushReady);
+}
+
+static void lvgl_flushRotated(lv_disp_drv_t * disp, const lv_area_t * area, lv_color_t * color_p) {
+    /* The DMA2D can't rotate: transpose the area straight into the frame buffer.
+     * lvgl_rotate() works in cache sized tiles, so it needs neither a temporary buffer nor a second copy. */
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t h = lv_area_get_height(area);
+    uint32_t x1, y1, lines;
+    switch (disp->rotated) {
+      case LV_DISP_ROT_90:
+        x1 = area->y1;
+        y1 = disp->ver_res - area->x2 - 1;
+        lines = w;
+        break;
+      case LV_DISP_ROT_180:
+        x1 = disp->hor_res - area->x2 - 1;
+        y1 = disp->ver_res - area->y2 - 1;
+        lines = h;
+        break;
+      default: /* LV_DISP_ROT_270 */
+        x1 = disp->hor_res - area->y2 - 1;
+        y1 = area->x1;
+        lines = w;
+        break;
+    }
+
+    uint32_t fbStride = dsi_getDisplayXSize();
+    lv_color_t * fbLine = (lv_color_t *)dsi_getActiveFrameBuffer() + y1 * fbStride;
+
+    /* A previous flush could still be written by the DMA2D */
+    dsi_waitTransfer();
+    lvgl_rotate(color_p, fbLine + x1, w, h, fbStride, disp->rotated);
+
+#if defined(__CORTEX_M7)
+    /* The LTDC reads the frame buffer from the SDRAM */
+    SCB_CleanDCache_by_Addr((uint32_t *)((uint32_t)fbLine & ~31UL), lines * fbStride * sizeof(lv_color_t) + 32);
+#endif
+
+    lv_disp_flush_ready(disp);
+}
+
+#define LVGL_ROTATE_TILE_SIZE   32
+
+/* Rotate a w x h area to dest, whose lines are destStride pixels apart. The LVGL 8 of the
+ * sketchbook has no rotate with a stride, and 90/270 degrees are walked in tiles here. */
+static void lvgl_rotate(const lv_color_t * src, lv_color_t * dest, lv_coord_t w, lv_coord_t h, uint32_t destStride, lv_disp_rot_t rotation) {
+    lv_coord_t x, y;
+
+    if (rotation == LV_DISP_ROT_180) {
+      dest += (h - 1) * destStride + w - 1;
+      for (y = 0; y < h; y++) {
+        for (x = 0; x < w; x++) {
+          *(dest - x) = src[x];
+        }
+        src += w;
+        dest -= destStride;
+      }
+      return;
+    }
+
+    /* 90: (x;y) goes to (y;w - 1 - x), 270: (x;y) goes to (h - 1 - y;x).
+     * Each source column of a tile is one run of a destination row. */
+    for (lv_coord_t tileY = 0; tileY < h; tileY += LVGL_ROTATE_TILE_SIZE) {
+      lv_coord_t tileH = LV_MIN(LVGL_ROTATE_TILE_SIZE, h - tileY);
+      for (lv_coord_t tileX = 0; tileX < w; tileX += LVGL_ROTATE_TILE_SIZE) {
+        lv_coord_t tileXEnd = LV_MIN(tileX + LVGL_ROTATE_TILE_SIZE, w);
+        for (x = tileX; x < tileXEnd; x++) {
+          const lv_color_t * srcPx = src + tileY * w + x;
+          if (rotation == LV_DISP_ROT_270) {
+            lv_color_t * destPx = dest + x * destStride + (h - 1 - tileY);
+            for (y = 0; y < tileH; y++) {
+              *destPx-- = *srcPx;
+              srcPx += w;
+            }
+          } else {
+            lv_color_t * destPx = dest + (w - 1 - x) * destStride + tileY;
+            for (y = 0; y < tileH; y++) {
+              *destPx++ = *srcPx;
+              srcPx += w;
+            }
+          }
+        }
+      }
+    }
+}
+
+static void lvgl_flushReady() {
+    /* Called from the DMA2D or LTDC interrupt */
+    lv_disp_flush_ready(lvgl_flushingDisp);  /* Indicate you are ready with the flushing*/
 }
 #endif
 #endif
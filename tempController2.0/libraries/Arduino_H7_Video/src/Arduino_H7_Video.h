@@ -39,6 +39,16 @@
 
 /* Exported enumeration ------------------------------------------------------*/
 
+/**
+ * @enum H7VideoRenderMode
+ * @brief How LVGL renders and flushes to the display.
+ */
+enum H7VideoRenderMode {
+  H7_VIDEO_RENDER_PARTIAL = 0,    /**< One 1/10 screen draw buffer in internal RAM. The CPU waits for every flush. */
+  H7_VIDEO_RENDER_DOUBLE_PARTIAL, /**< Two 1/10 screen draw buffers in SDRAM. A stripe is rendered while the previous one is copied by the DMA2D. */
+  H7_VIDEO_RENDER_DIRECT          /**< LVGL renders into the two frame buffers, which are swapped on vertical blanking. Not available on rotated displays. */
+};
+
 /* Class ----------------------------------------------------------------------*/
 
 /**
@@ -106,6 +116,24 @@ public:
    */
   bool isRotated();
 
+  /**
+   * @brief Select how LVGL renders and flushes to the display. Must be called before begin().
+   * 
+   * @param mode The render mode:
+   *             - H7_VIDEO_RENDER_PARTIAL: single 1/10 screen buffer (default)
+   *             - H7_VIDEO_RENDER_DOUBLE_PARTIAL: two 1/10 screen buffers in SDRAM, flush overlaps rendering
+   *             - H7_VIDEO_RENDER_DIRECT: render into the frame buffers. Falls back to 
+   *               H7_VIDEO_RENDER_DOUBLE_PARTIAL if the display is rotated.
+   */
+  void setRenderMode(H7VideoRenderMode mode);
+
+  /**
+   * @brief Get the render mode in use.
+   * 
+   * @return H7VideoRenderMode The render mode. After begin() it reflects the fallback, if any.
+   */
+  H7VideoRenderMode getRenderMode();
+
 #ifdef HAS_ARDUINOGRAPHICS
   /**
    * @brief Clear the display.
@@ -139,6 +167,7 @@ private:
     int                 _edidMode;
     uint32_t            _width;
     uint32_t            _height;
+    H7VideoRenderMode   _renderMode;
 };
 
 #endif /* _ARDUINO_H7_VIDEO_H */
\ No newline at end of file
@@ -23,6 +23,8 @@
 #define FB_ADDRESS_0 		(FB_BASE_ADDRESS)
 #define FB_ADDRESS_1 		(FB_BASE_ADDRESS + (LCD_MAX_X_SIZE * LCD_MAX_Y_SIZE * BYTES_PER_PIXEL))
 
+#define DMA2D_TIMEOUT_MS	100
+
 /* Private variables ---------------------------------------------------------*/
 static DMA2D_HandleTypeDef dma2d;
 static LTDC_HandleTypeDef  ltdc;
@@ -37,12 +39,18 @@ static uint32_t pend_buffer = 0;
 
 volatile uint32_t reloadLTDC_status = 0;
 
+static volatile bool dma2d_busy = false;
+static volatile dsi_transferCallback dma2d_callback = NULL;
+static volatile dsi_transferCallback reload_callback = NULL;
+
 /* Exported variables --------------------------------------------------------*/
 DSI_HandleTypeDef   dsi;
 
 /* Private function prototypes -----------------------------------------------*/
 static void dsi_fillBuffer(uint32_t LayerIndex, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex);
 static void dsi_layerInit(uint16_t LayerIndex, uint32_t FB_Address);
+static uint32_t dsi_bytesPerPixel(uint32_t ColorMode);
+static void dsi_dma2dTransferComplete(DMA2D_HandleTypeDef *hdma2d);
 
 /* Functions -----------------------------------------------------------------*/
 int dsi_init(uint8_t bus, struct edid *edid, struct display_timing *dt) {
@@ -266,6 +274,8 @@ void dsi_lcdFillArea(void *pDst, uint32_t xSize, uint32_t ySize, uint32_t ColorM
 }
 
 void dsi_lcdDrawImage(void *pSrc, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t ColorMode) {
+	dsi_waitTransfer();
+
 #if defined(__CORTEX_M7) 
 	SCB_CleanInvalidateDCache();
 	SCB_InvalidateICache();
@@ -299,7 +309,74 @@ void dsi_lcdDrawImage(void *pSrc, void *pDst, uint32_t xSize, uint32_t ySize, ui
 	}
 }
 
+void dsi_lcdDrawImageAsync(void *pSrc, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t ColorMode, dsi_transferCallback callback) {
+	/* The DMA2D has one channel: let the previous transfer finish first */
+	dsi_waitTransfer();
+
+#if defined(__CORTEX_M7)
+	/* Write back only the source lines, the DMA2D doesn't read anything else */
+	uint32_t start = (uint32_t)pSrc & ~31UL;
+	uint32_t end = ((uint32_t)pSrc + xSize * ySize * dsi_bytesPerPixel(ColorMode) + 31) & ~31UL;
+	SCB_CleanDCache_by_Addr((uint32_t *)start, end - start);
+#endif
+
+	/* Configure the DMA2D Mode, Color Mode and output offset */
+	dma2d.Init.Mode         = DMA2D_M2M_PFC;
+	dma2d.Init.ColorMode    = DMA2D_OUTPUT_RGB565;
+	dma2d.Init.OutputOffset = lcd_x_size - xSize;
+
+	if (pDst == NULL) {
+		pDst = (uint32_t *)(ltdc.LayerCfg[pend_buffer%2].FBStartAdress);
+	}
+
+	/* Foreground Configuration */
+	dma2d.LayerCfg[1].AlphaMode = DMA2D_REPLACE_ALPHA;
+	dma2d.LayerCfg[1].InputAlpha = 0x00;
+	dma2d.LayerCfg[1].InputColorMode = ColorMode;
+	dma2d.LayerCfg[1].InputOffset = 0;
+
+	dma2d.Instance = DMA2D;
+
+	/* DMA2D Initialization */
+	if(HAL_DMA2D_Init(&dma2d) == HAL_OK) {
+		dma2d.XferCpltCallback = dsi_dma2dTransferComplete;
+		dma2d.XferErrorCallback = dsi_dma2dTransferComplete;
+		if(HAL_DMA2D_ConfigLayer(&dma2d, 1) == HAL_OK) {
+			dma2d_callback = callback;
+			dma2d_busy = true;
+			/* Completion is signaled from DMA2D_IRQHandler() */
+			if (HAL_DMA2D_Start_IT(&dma2d, (uint32_t)pSrc, (uint32_t)pDst, xSize, ySize) == HAL_OK) {
+				return;
+			}
+			dma2d_busy = false;
+			dma2d_callback = NULL;
+		}
+	}
+
+	/* The transfer couldn't be started, don't leave the caller waiting */
+	if (callback != NULL) {
+		callback();
+	}
+}
+
+bool dsi_isTransferActive(void) {
+	return dma2d_busy;
+}
+
+void dsi_waitTransfer(void) {
+	uint32_t start = millis();
+	while (dma2d_busy) {
+		if (millis() - start > DMA2D_TIMEOUT_MS) {
+			/* The interrupt got lost or the DMA2D hung up: stop it and release the waiting side */
+			HAL_DMA2D_Abort(&dma2d);
+			dsi_dma2dTransferComplete(&dma2d);
+		}
+	}
+}
+
 void dsi_configueCLUT(uint32_t *colors) {
+	dsi_waitTransfer();
+
 	memcpy(L8_CLUT, colors, 256 * 4);
 	clut.pCLUT = (uint32_t *)L8_CLUT;
 	clut.CLUTColorMode = DMA2D_CCM_ARGB8888;
@@ -323,6 +400,20 @@ uint32_t dsi_getFramebufferEnd(void) {
 	return (FB_BASE_ADDRESS + 2 * (lcd_x_size * lcd_y_size * BYTES_PER_PIXEL));
 }
 
+void dsi_drawCurrentFrameBufferAsync(dsi_transferCallback callback) {
+#if defined(__CORTEX_M7)
+	/* The CPU could have rendered into the frame buffer: write it back before the LTDC reads it */
+	SCB_CleanDCache();
+#endif
+
+	dsi_drawCurrentFrameBuffer(false);
+
+	/* LTDC reload request within next vertical blanking, the callback is called from LTDC_IRQHandler() */
+	reload_callback = callback;
+	reloadLTDC_status = 0;
+	HAL_LTDC_Reload(&ltdc, LTDC_SRCR_VBR);
+}
+
 void dsi_drawCurrentFrameBuffer(bool reload) {
 	int fb = pend_buffer++ % 2;
 
@@ -384,6 +475,8 @@ void dsi_layerInit(uint16_t LayerIndex, uint32_t FB_Address) {
 }
 
 void dsi_fillBuffer(uint32_t LayerIndex, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex) {
+	dsi_waitTransfer();
+
 	/* Register to memory mode with ARGB8888 as color Mode */
 	dma2d.Init.Mode         = DMA2D_R2M;
 	dma2d.Init.ColorMode    = DMA2D_OUTPUT_RGB565;	//DMA2D_OUTPUT_ARGB8888
@@ -402,6 +495,32 @@ void dsi_fillBuffer(uint32_t LayerIndex, void *pDst, uint32_t xSize, uint32_t yS
 	}
 }
 
+static uint32_t dsi_bytesPerPixel(uint32_t ColorMode) {
+	switch (ColorMode) {
+		case DMA2D_INPUT_ARGB8888:	return 4;
+		case DMA2D_INPUT_RGB888:	return 3;
+		case DMA2D_INPUT_RGB565:
+		case DMA2D_INPUT_ARGB1555:
+		case DMA2D_INPUT_ARGB4444:	return 2;
+		default:					return 1;
+	}
+}
+
+static void dsi_dma2dTransferComplete(DMA2D_HandleTypeDef *hdma2d) {
+	dsi_transferCallback callback = dma2d_callback;
+	dma2d_callback = NULL;
+	dma2d_busy = false;
+
+	if (callback != NULL) {
+		callback();
+	}
+}
+
+/* Handler for DMA2D global interrupt request */
+extern "C" void DMA2D_IRQHandler(void) {
+	HAL_DMA2D_IRQHandler(&dma2d);
+}
+
 /* Handler for LTDC global interrupt request */
 extern "C" void LTDC_IRQHandler(void) {
 	HAL_LTDC_IRQHandler(&ltdc);
@@ -410,6 +529,12 @@ extern "C" void LTDC_IRQHandler(void) {
 /* Reload LTDC event callback */
 extern "C" void HAL_LTDC_ReloadEventCallback(LTDC_HandleTypeDef *hltdc) {
   reloadLTDC_status = 1;
+
+  dsi_transferCallback callback = reload_callback;
+  reload_callback = NULL;
+  if (callback != NULL) {
+    callback();
+  }
 }
 
 /**** END OF FILE ****/
@@ -12,6 +12,8 @@
 #ifndef _DSI_H
 #define _DSI_H
 
+#include "dsi_transfer.h"
+
 /* Exported struct -----------------------------------------------------------*/
 struct display_timing {
 	unsigned int pixelclock;
@@ -27,6 +29,9 @@ struct display_timing {
 	unsigned int vpol : 1;
 };
 
+/* Exported types ------------------------------------------------------------*/
+typedef void (*dsi_transferCallback)(void);
+
 /* Exported variables --------------------------------------------------------*/
 extern DSI_HandleTypeDef dsi;
 
@@ -34,9 +39,11 @@ extern DSI_HandleTypeDef dsi;
 int			dsi_init(uint8_t bus, struct edid *edid, struct display_timing *dt);
 void		dsi_lcdClear(uint32_t color);
 void		dsi_lcdDrawImage(void *pSrc, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t ColorMode);
+void		dsi_lcdDrawImageAsync(void *pSrc, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t ColorMode, dsi_transferCallback callback);
 void		dsi_lcdFillArea(void *pDst, uint32_t xSize, uint32_t ySize, uint32_t ColorMode);
 void		dsi_configueCLUT(uint32_t* clut);
 void		dsi_drawCurrentFrameBuffer(bool reload = true);
+void		dsi_drawCurrentFrameBufferAsync(dsi_transferCallback callback);
 uint32_t	dsi_getCurrentFrameBuffer(void);
 uint32_t 	dsi_getActiveFrameBuffer(void);
 uint32_t	dsi_getFramebufferEnd(void);
@@ -0,0 +1,32 @@
+/**
+  ******************************************************************************
+  * @file    dsi_transfer.h
+  * @author  
+  * @version 
+  * @date    
+  * @brief   DMA2D ownership of the display driver, usable from C
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#ifndef _DSI_TRANSFER_H
+#define _DSI_TRANSFER_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported functions --------------------------------------------------------*/
+/* The asynchronous transfers of the driver (e.g. the LVGL flush) are finished only when the DMA2D interrupt
+ * has handled them. Other DMA2D users (e.g. LVGL's DMA2D draw backend) must wait for them before touching
+ * the DMA2D registers, else the interrupt is lost and the transfer never completes. */
+bool		dsi_isTransferActive(void);
+void		dsi_waitTransfer(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DSI_TRANSFER_H */